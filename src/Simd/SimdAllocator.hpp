@@ -60,6 +60,51 @@ namespace Simd
 #endif
         }
 
+        /*!
+            \fn void * Allocate(size_t size, size_t align, int flags);
+
+            \short Allocates aligned memory block with using of given allocation flags.
+
+            \note The memory allocated by this function is must be deleted by function Simd::Allocator::Free.
+
+            \param [in] size - a size of required memory block.
+            \param [in] align - an align of allocated memory address.
+            \param [in] flags - a combination of flags of memory allocation (see ::SimdAllocateFlags).
+            \return a pointer to allocated memory.
+        */
+        static SIMD_INLINE void * Allocate(size_t size, size_t align, int flags)
+        {
+#ifdef __SimdMemory_h__
+            return Simd::Allocate(size, align, flags);
+#else
+            return SimdAllocateWithFlags(size, align, flags);
+#endif
+        }
+
+        /*!
+            \fn int Flags();
+
+            \short Gets global flags of memory allocation.
+
+            \return current global flags of memory allocation (see ::SimdAllocateFlags).
+        */
+        static SIMD_INLINE int Flags()
+        {
+            return SimdGetAllocateFlags();
+        }
+
+        /*!
+            \fn void SetFlags(int flags);
+
+            \short Sets global flags of memory allocation. They are used by all allocations of Simd::View, Simd::Frame and internal buffers of %Simd Library.
+
+            \param [in] flags - a combination of flags of memory allocation (see ::SimdAllocateFlags).
+        */
+        static SIMD_INLINE void SetFlags(int flags)
+        {
+            SimdSetAllocateFlags(flags);
+        }
+
         /*!
             \fn void Free(void * ptr);
 
@@ -38,7 +38,7 @@ namespace Simd
             : data(0)
             , size(0)
         {
-            Resize(size_, clear);
+            Resize(size_, clear, align);
         }
 
         SIMD_INLINE ~Array()
@@ -106,6 +106,14 @@ namespace Simd
 
         void BgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+        void BgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        void BgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        void BgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        void BgraToNv12(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
+
         void BgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height,
             uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride);
 
@@ -116,6 +124,18 @@ namespace Simd
 
         void BgrToGray(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * gray, size_t grayStride);
 
+        void BgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride);
+
+        void BgrToHsl32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * hsl, size_t hslStride);
+
+        void BgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride);
+
+        void BgrToHsv32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * hsv, size_t hsvStride);
+
+        void BgrToLab(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride);
+
+        void BgrToLab32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * lab, size_t labStride);
+
         void BgrToRgb(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
 
         void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
@@ -124,6 +144,14 @@ namespace Simd
 
         void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+        void BgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        void BgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        void BgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        void BgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
+
         void Binarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
             uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType);
 
@@ -155,6 +183,20 @@ namespace Simd
 
         void DeinterleaveBgra(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride, uint8_t * a, size_t aStride);
 
+        void YuyvToGray(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * gray, size_t grayStride);
+
+        void UyvyToGray(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * gray, size_t grayStride);
+
+        void YuyvToNv12(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride);
+
+        void UyvyToNv12(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride);
+
+        void YuyvToYuv420p(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+        void UyvyToYuv420p(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
         void DetectionHaarDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride,
             ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
@@ -211,6 +253,8 @@ namespace Simd
 
         void Uint8ToFloat32(const uint8_t * src, size_t size, const float * lower, const float * upper, float * dst);
 
+        void Uint16ToFloat32(const uint16_t * src, size_t size, int bits, const float * lower, const float * upper, float * dst);
+
         void CosineDistance32f(const float * a, const float * b, size_t size, float * distance);
 
         void GaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
@@ -256,8 +300,14 @@ namespace Simd
 
         void HogLiteCreateMask(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const float * threshold, size_t scale, size_t size, uint32_t * dst, size_t dstStride);
 
+        void HslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride);
+
+        void HsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride);
+
         void Int16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride);
 
+        void Uint16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, int shift, uint8_t * dst, size_t dstStride);
+
         void Integral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
             uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
             SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat);
@@ -278,6 +328,8 @@ namespace Simd
 
         void InterleaveBgra(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride, const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride);
 
+        void LabToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride);
+
         void Laplace(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
 
         void LaplaceAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
@@ -374,6 +426,9 @@ namespace Simd
         void ResizeBilinear(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
             uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
 
+        void ResizeBilinear(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount, size_t yBeg, size_t yEnd);
+
         void RgbToBgra(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* bgra, size_t bgraStride, uint8_t alpha);
 
         void RgbToGray(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* gray, size_t grayStride);
@@ -479,6 +534,12 @@ namespace Simd
         void SynetSetInput(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
             const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat);
 
+        void SynetSetInputRows(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+            const float * lower, const float * upper, float * dst, size_t plane, size_t channels, SimdTensorFormatType dstFormat);
+
+        void SynetSetInputBatch(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+            const float * rois, size_t count, size_t dstWidth, size_t dstHeight, const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat);
+
         void SynetSigmoid32f(const float* src, size_t size, const float* slope, float* dst);
 
         void SynetSoftmaxLayerForward(const float * src, size_t outer, size_t size, size_t inner, float * dst);
@@ -536,6 +597,75 @@ namespace Simd
 
         void Yuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgb, size_t rgbStride);
+
+        void Yuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        void Yuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        void Yuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        void Yuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        void Yuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        void Yuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        void Yuv420pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        void Yuv422pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        void Yuv444pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        void Nv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        void Nv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        void Nv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height,
+            uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        void Nv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height,
+            uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        void YuyvToBgra(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        void YuyvToBgr(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        void YuyvToRgb(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        void UyvyToBgra(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        void UyvyToBgr(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+            uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        void UyvyToRgb(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+            uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        void Yuv420p16ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        void P016ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
     }
 #endif// SIMD_AVX2_ENABLE
 }
@@ -0,0 +1,191 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdColorSpace.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        /* Exact truncating division by 255 for values in [0, 2^20): the half offset keeps multiples of 255 from rounding down. */
+        SIMD_INLINE __m256i DivideBy255(__m256i value)
+        {
+            return _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_add_ps(_mm256_cvtepi32_ps(value), _mm256_set1_ps(0.5f)), _mm256_set1_ps(1.0f / 255.0f)));
+        }
+
+        SIMD_INLINE __m256i HueDividend(__m256i blue, __m256i green, __m256i red, __m256i max, __m256i range)
+        {
+            __m256i range2 = _mm256_add_epi32(range, range), range4 = _mm256_add_epi32(range2, range2);
+            __m256i dividend = _mm256_add_epi32(_mm256_sub_epi32(red, green), range4);
+            dividend = _mm256_blendv_epi8(dividend, _mm256_add_epi32(_mm256_sub_epi32(blue, red), range2), _mm256_cmpeq_epi32(green, max));
+            return _mm256_blendv_epi8(dividend, _mm256_add_epi32(_mm256_sub_epi32(green, blue), _mm256_add_epi32(range4, range2)), _mm256_cmpeq_epi32(red, max));
+        }
+
+        SIMD_INLINE __m256i BgrToHue(__m256i blue, __m256i green, __m256i red, __m256i max, __m256i range)
+        {
+            __m256i dividend = HueDividend(blue, green, red, max, range);
+            __m256 hue = _mm256_div_ps(_mm256_mul_ps(_mm256_set1_ps(Base::KF_255_DIV_6), _mm256_cvtepi32_ps(dividend)), _mm256_cvtepi32_ps(range));
+            return _mm256_andnot_si256(_mm256_cmpeq_epi32(range, K_ZERO), _mm256_cvttps_epi32(hue));
+        }
+
+        SIMD_INLINE void BgrToHsv(const uint8_t * bgr, uint8_t * hsv)
+        {
+            __m256i blue, green, red;
+            LoadBgr32i(bgr, blue, green, red);
+            __m256i max = _mm256_max_epi32(blue, _mm256_max_epi32(green, red));
+            __m256i range = _mm256_sub_epi32(max, _mm256_min_epi32(blue, _mm256_min_epi32(green, red)));
+            __m256i hue = BgrToHue(blue, green, red, max, range);
+            __m256 saturation = _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_slli_epi32(range, 8), range)), _mm256_cvtepi32_ps(max));
+            StoreBgr32i(hsv, hue, _mm256_andnot_si256(_mm256_cmpeq_epi32(max, K_ZERO), _mm256_cvttps_epi32(saturation)), max);
+        }
+
+        void BgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
+        {
+            ColorSpace<BgrToHsv>(bgr, width, height, bgrStride, hsv, hsvStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void BgrToHsl(const uint8_t * bgr, uint8_t * hsl)
+        {
+            __m256i blue, green, red;
+            LoadBgr32i(bgr, blue, green, red);
+            __m256i max = _mm256_max_epi32(blue, _mm256_max_epi32(green, red));
+            __m256i min = _mm256_min_epi32(blue, _mm256_min_epi32(green, red));
+            __m256i range = _mm256_sub_epi32(max, min), sum = _mm256_add_epi32(max, min);
+            __m256i hue = BgrToHue(blue, green, red, max, range);
+            __m256i divisor = _mm256_min_epi32(sum, _mm256_sub_epi32(_mm256_set1_epi32(510), sum));
+            __m256 saturation = _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_slli_epi32(range, 8), range)), _mm256_cvtepi32_ps(divisor));
+            StoreBgr32i(hsl, hue, _mm256_andnot_si256(_mm256_cmpeq_epi32(divisor, K_ZERO), _mm256_cvttps_epi32(saturation)), _mm256_srli_epi32(sum, 1));
+        }
+
+        void BgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride)
+        {
+            ColorSpace<BgrToHsl>(bgr, width, height, bgrStride, hsl, hslStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m256 BgrToHue32f(__m256i blue, __m256i green, __m256i red, __m256i max, __m256i range)
+        {
+            __m256i dividend = HueDividend(blue, green, red, max, range);
+            __m256 hue = _mm256_div_ps(_mm256_mul_ps(_mm256_set1_ps(60.0f), _mm256_cvtepi32_ps(dividend)), _mm256_cvtepi32_ps(range));
+            hue = _mm256_sub_ps(hue, _mm256_and_ps(_mm256_cmp_ps(hue, _mm256_set1_ps(360.0f), _CMP_GE_OQ), _mm256_set1_ps(360.0f)));
+            return _mm256_andnot_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(range, K_ZERO)), hue);
+        }
+
+        SIMD_INLINE void BgrToHsv32f(const uint8_t * bgr, float * hsv)
+        {
+            __m256i blue, green, red;
+            LoadBgr32i(bgr, blue, green, red);
+            __m256i max = _mm256_max_epi32(blue, _mm256_max_epi32(green, red));
+            __m256i range = _mm256_sub_epi32(max, _mm256_min_epi32(blue, _mm256_min_epi32(green, red)));
+            __m256 hue = BgrToHue32f(blue, green, red, max, range);
+            __m256 _max = _mm256_cvtepi32_ps(max);
+            __m256 saturation = _mm256_andnot_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(max, K_ZERO)), _mm256_div_ps(_mm256_cvtepi32_ps(range), _max));
+            StoreBgr32f(hsv, hue, saturation, _mm256_mul_ps(_max, _mm256_set1_ps(1.0f / 255.0f)));
+        }
+
+        void BgrToHsv32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * hsv, size_t hsvStride)
+        {
+            ColorSpace32f<BgrToHsv32f>(bgr, width, height, bgrStride, hsv, hsvStride);
+        }
+
+        SIMD_INLINE void BgrToHsl32f(const uint8_t * bgr, float * hsl)
+        {
+            __m256i blue, green, red;
+            LoadBgr32i(bgr, blue, green, red);
+            __m256i max = _mm256_max_epi32(blue, _mm256_max_epi32(green, red));
+            __m256i min = _mm256_min_epi32(blue, _mm256_min_epi32(green, red));
+            __m256i range = _mm256_sub_epi32(max, min), sum = _mm256_add_epi32(max, min);
+            __m256 hue = BgrToHue32f(blue, green, red, max, range);
+            __m256i divisor = _mm256_min_epi32(sum, _mm256_sub_epi32(_mm256_set1_epi32(510), sum));
+            __m256 saturation = _mm256_andnot_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(divisor, K_ZERO)), _mm256_div_ps(_mm256_cvtepi32_ps(range), _mm256_cvtepi32_ps(divisor)));
+            StoreBgr32f(hsl, hue, saturation, _mm256_mul_ps(_mm256_cvtepi32_ps(sum), _mm256_set1_ps(1.0f / 510.0f)));
+        }
+
+        void BgrToHsl32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * hsl, size_t hslStride)
+        {
+            ColorSpace32f<BgrToHsl32f>(bgr, width, height, bgrStride, hsl, hslStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void HueToBgr(__m256i hue, __m256i min, __m256i max, uint8_t * bgr)
+        {
+            __m256i hue6 = _mm256_add_epi32(_mm256_slli_epi32(hue, 2), _mm256_slli_epi32(hue, 1));
+            __m256i sector = DivideBy255(hue6);
+            __m256i delta = DivideBy255(_mm256_mullo_epi32(_mm256_sub_epi32(max, min), _mm256_sub_epi32(hue6, _mm256_sub_epi32(_mm256_slli_epi32(sector, 8), sector))));
+            __m256i up = _mm256_add_epi32(min, delta), down = _mm256_sub_epi32(max, delta);
+            __m256i s1 = _mm256_cmpeq_epi32(sector, _mm256_set1_epi32(1));
+            __m256i s2 = _mm256_cmpeq_epi32(sector, _mm256_set1_epi32(2));
+            __m256i s3 = _mm256_cmpeq_epi32(sector, _mm256_set1_epi32(3));
+            __m256i s4 = _mm256_cmpeq_epi32(sector, _mm256_set1_epi32(4));
+            __m256i s5 = _mm256_cmpeq_epi32(sector, _mm256_set1_epi32(5));
+            __m256i blue = _mm256_blendv_epi8(min, up, s2);
+            blue = _mm256_blendv_epi8(blue, max, _mm256_or_si256(s3, s4));
+            blue = _mm256_blendv_epi8(blue, down, s5);
+            __m256i green = _mm256_blendv_epi8(up, max, _mm256_or_si256(s1, s2));
+            green = _mm256_blendv_epi8(green, down, s3);
+            green = _mm256_blendv_epi8(green, min, _mm256_or_si256(s4, s5));
+            __m256i red = _mm256_blendv_epi8(max, down, s1);
+            red = _mm256_blendv_epi8(red, min, _mm256_or_si256(s2, s3));
+            red = _mm256_blendv_epi8(red, up, s4);
+            StoreBgr32i(bgr, blue, green, red);
+        }
+
+        SIMD_INLINE void HsvToBgr(const uint8_t * hsv, uint8_t * bgr)
+        {
+            __m256i hue, saturation, value;
+            LoadBgr32i(hsv, hue, saturation, value);
+            __m256i min = DivideBy255(_mm256_mullo_epi32(_mm256_sub_epi32(K32_000000FF, saturation), value));
+            HueToBgr(hue, min, value, bgr);
+        }
+
+        void HsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride)
+        {
+            ColorSpace<HsvToBgr>(hsv, width, height, hsvStride, bgr, bgrStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void HslToBgr(const uint8_t * hsl, uint8_t * bgr)
+        {
+            __m256i hue, saturation, lightness;
+            LoadBgr32i(hsl, hue, saturation, lightness);
+            __m256i dark = DivideBy255(_mm256_mullo_epi32(lightness, _mm256_add_epi32(K32_000000FF, saturation)));
+            __m256i light = DivideBy255(_mm256_add_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(K32_000000FF, lightness), saturation),
+                _mm256_sub_epi32(_mm256_slli_epi32(lightness, 8), lightness)));
+            __m256i max = _mm256_blendv_epi8(dark, light, _mm256_cmpgt_epi32(lightness, _mm256_set1_epi32(128)));
+            __m256i min = DivideBy255(_mm256_mullo_epi32(_mm256_sub_epi32(K32_000000FF, saturation), max));
+            HueToBgr(hue, min, max, bgr);
+        }
+
+        void HslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride)
+        {
+            ColorSpace<HslToBgr>(hsl, width, height, hslStride, bgr, bgrStride);
+        }
+    }
+#endif//SIMD_AVX2_ENABLE
+}
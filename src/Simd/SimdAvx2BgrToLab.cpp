@@ -0,0 +1,142 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdColorSpace.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256 Gather(const float * table, __m256i index)
+        {
+            return _mm256_i32gather_ps(table, index, 4);
+        }
+
+        SIMD_INLINE __m256i Gather(const int32_t * table, __m256i index)
+        {
+            return _mm256_i32gather_epi32(table, index, 4);
+        }
+
+        SIMD_INLINE __m256i RestrictRange8u(__m256i value)
+        {
+            return _mm256_min_epi32(_mm256_max_epi32(value, K_ZERO), K32_000000FF);
+        }
+
+        SIMD_INLINE __m256 LabCbrt(__m256 value)
+        {
+            __m256 t = _mm256_mul_ps(_mm256_max_ps(_mm256_setzero_ps(), _mm256_min_ps(_mm256_set1_ps(1.0f), value)), _mm256_set1_ps((float)Base::LAB_CBRT_TABLE_SIZE));
+            __m256i i = _mm256_min_epi32(_mm256_cvttps_epi32(t), _mm256_set1_epi32(Base::LAB_CBRT_TABLE_SIZE - 1));
+            __m256 f = _mm256_sub_ps(t, _mm256_cvtepi32_ps(i));
+            __m256 c0 = Gather(Base::LAB_TABLES.cbrt, i);
+            __m256 c1 = Gather(Base::LAB_TABLES.cbrt + 1, i);
+            return _mm256_add_ps(c0, _mm256_mul_ps(_mm256_sub_ps(c1, c0), f));
+        }
+
+        SIMD_INLINE __m256 Dot(__m256 r, __m256 g, __m256 b, float kr, float kg, float kb)
+        {
+            return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(r, _mm256_set1_ps(kr)), _mm256_mul_ps(g, _mm256_set1_ps(kg))), _mm256_mul_ps(b, _mm256_set1_ps(kb)));
+        }
+
+        SIMD_INLINE void LabF(__m256 b, __m256 g, __m256 r, __m256 & fx, __m256 & fy, __m256 & fz)
+        {
+            fx = LabCbrt(Dot(r, g, b, Base::LAB_XR, Base::LAB_XG, Base::LAB_XB));
+            fy = LabCbrt(Dot(r, g, b, Base::LAB_YR, Base::LAB_YG, Base::LAB_YB));
+            fz = LabCbrt(Dot(r, g, b, Base::LAB_ZR, Base::LAB_ZG, Base::LAB_ZB));
+        }
+
+        SIMD_INLINE void BgrToLab(const uint8_t * bgr, uint8_t * lab)
+        {
+            __m256i blue, green, red;
+            LoadBgr32i(bgr, blue, green, red);
+            __m256 b = Gather(Base::LAB_TABLES.gamma, blue);
+            __m256 g = Gather(Base::LAB_TABLES.gamma, green);
+            __m256 r = Gather(Base::LAB_TABLES.gamma, red);
+            __m256 fx, fy, fz;
+            LabF(b, g, r, fx, fy, fz);
+            __m256i l = _mm256_cvtps_epi32(_mm256_sub_ps(_mm256_mul_ps(fy, _mm256_set1_ps(Base::LAB_L_SCALE)), _mm256_set1_ps(Base::LAB_L_SHIFT)));
+            __m256i a = _mm256_cvtps_epi32(_mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(fx, fy), _mm256_set1_ps(Base::LAB_A_SCALE)), _mm256_set1_ps(Base::LAB_AB_SHIFT)));
+            __m256i _b = _mm256_cvtps_epi32(_mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(fy, fz), _mm256_set1_ps(Base::LAB_B_SCALE)), _mm256_set1_ps(Base::LAB_AB_SHIFT)));
+            StoreBgr32i(lab, RestrictRange8u(l), RestrictRange8u(a), RestrictRange8u(_b));
+        }
+
+        void BgrToLab(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride)
+        {
+            ColorSpace<BgrToLab>(bgr, width, height, bgrStride, lab, labStride);
+        }
+
+        SIMD_INLINE void BgrToLab32f(const uint8_t * bgr, float * lab)
+        {
+            __m256i blue, green, red;
+            LoadBgr32i(bgr, blue, green, red);
+            __m256 fx, fy, fz;
+            LabF(Gather(Base::LAB_TABLES.gamma, blue), Gather(Base::LAB_TABLES.gamma, green), Gather(Base::LAB_TABLES.gamma, red), fx, fy, fz);
+            __m256 l = _mm256_sub_ps(_mm256_mul_ps(fy, _mm256_set1_ps(Base::LAB_L_SCALE_32F)), _mm256_set1_ps(Base::LAB_L_SHIFT_32F));
+            __m256 a = _mm256_mul_ps(_mm256_sub_ps(fx, fy), _mm256_set1_ps(Base::LAB_A_SCALE));
+            __m256 _b = _mm256_mul_ps(_mm256_sub_ps(fy, fz), _mm256_set1_ps(Base::LAB_B_SCALE));
+            StoreBgr32f(lab, l, a, _b);
+        }
+
+        void BgrToLab32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * lab, size_t labStride)
+        {
+            ColorSpace32f<BgrToLab32f>(bgr, width, height, bgrStride, lab, labStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m256 LabInvF(__m256 f)
+        {
+            __m256 cube = _mm256_mul_ps(_mm256_mul_ps(f, f), f);
+            __m256 linear = _mm256_mul_ps(_mm256_sub_ps(f, _mm256_set1_ps(Base::LAB_F_SHIFT)), _mm256_set1_ps(Base::LAB_F_LINEAR));
+            return _mm256_blendv_ps(linear, cube, _mm256_cmp_ps(f, _mm256_set1_ps(Base::LAB_F_THRESHOLD), _CMP_GT_OQ));
+        }
+
+        SIMD_INLINE __m256i LabToSrgb(__m256 value)
+        {
+            __m256 index = _mm256_mul_ps(_mm256_max_ps(_mm256_setzero_ps(), _mm256_min_ps(_mm256_set1_ps(1.0f), value)), _mm256_set1_ps((float)Base::LAB_SRGB_TABLE_SIZE));
+            return Gather(Base::LAB_TABLES.srgb, _mm256_cvtps_epi32(index));
+        }
+
+        SIMD_INLINE void LabToBgr(const uint8_t * lab, uint8_t * bgr)
+        {
+            __m256i l, a, b;
+            LoadBgr32i(lab, l, a, b);
+            __m256 fy = _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(l), _mm256_set1_ps(Base::LAB_INV_L_SCALE)), _mm256_set1_ps(Base::LAB_F_SHIFT));
+            __m256 fx = _mm256_add_ps(fy, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(a, _mm256_set1_epi32(128))), _mm256_set1_ps(Base::LAB_INV_A_SCALE)));
+            __m256 fz = _mm256_sub_ps(fy, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(b, _mm256_set1_epi32(128))), _mm256_set1_ps(Base::LAB_INV_B_SCALE)));
+            __m256 x = _mm256_mul_ps(LabInvF(fx), _mm256_set1_ps(Base::LAB_WHITE_X));
+            __m256 y = LabInvF(fy);
+            __m256 z = _mm256_mul_ps(LabInvF(fz), _mm256_set1_ps(Base::LAB_WHITE_Z));
+            __m256i blue = LabToSrgb(Dot(x, y, z, Base::LAB_BX, Base::LAB_BY, Base::LAB_BZ));
+            __m256i green = LabToSrgb(Dot(x, y, z, Base::LAB_GX, Base::LAB_GY, Base::LAB_GZ));
+            __m256i red = LabToSrgb(Dot(x, y, z, Base::LAB_RX, Base::LAB_RY, Base::LAB_RZ));
+            StoreBgr32i(bgr, blue, green, red);
+        }
+
+        void LabToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride)
+        {
+            ColorSpace<LabToBgr>(lab, width, height, labStride, bgr, bgrStride);
+        }
+    }
+#endif//SIMD_AVX2_ENABLE
+}
@@ -24,6 +24,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdConversion.h"
+#include "Simd/SimdYuvToBgr.h"
 
 namespace Simd
 {
@@ -237,6 +238,197 @@ namespace Simd
             else
                 BgrToYuv444p<false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
         }
+
+        //---------------------------------------------------------------------
+
+        const __m256i K8_SHUFFLE_BGRA_TO_PLANES = SIMD_MM256_SETR_EPI8(
+            0x0, 0x4, 0x8, 0xC, 0x1, 0x5, 0x9, 0xD, 0x2, 0x6, 0xA, 0xE, 0x3, 0x7, 0xB, 0xF,
+            0x0, 0x4, 0x8, 0xC, 0x1, 0x5, 0x9, 0xD, 0x2, 0x6, 0xA, 0xE, 0x3, 0x7, 0xB, 0xF);
+        const __m256i K32_PERMUTE_PLANES = SIMD_MM256_SETR_EPI32(0, 4, 1, 5, 2, 6, 3, 7);
+
+        template<size_t N> SIMD_INLINE void LoadAny(const uint8_t * src, __m256i & b, __m256i & g, __m256i & r);
+
+        template<> SIMD_INLINE void LoadAny<3>(const uint8_t * src, __m256i & b, __m256i & g, __m256i & r)
+        {
+            LoadBgr<false>((__m256i*)src, b, g, r);
+        }
+
+        template<> SIMD_INLINE void LoadAny<4>(const uint8_t * src, __m256i & b, __m256i & g, __m256i & r)
+        {
+            __m256i x0 = _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src + 0), K8_SHUFFLE_BGRA_TO_PLANES);
+            __m256i x1 = _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src + 1), K8_SHUFFLE_BGRA_TO_PLANES);
+            __m256i x2 = _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src + 2), K8_SHUFFLE_BGRA_TO_PLANES);
+            __m256i x3 = _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src + 3), K8_SHUFFLE_BGRA_TO_PLANES);
+            __m256i bg01 = _mm256_unpacklo_epi32(x0, x1), ra01 = _mm256_unpackhi_epi32(x0, x1);
+            __m256i bg23 = _mm256_unpacklo_epi32(x2, x3), ra23 = _mm256_unpackhi_epi32(x2, x3);
+            b = _mm256_permutevar8x32_epi32(_mm256_unpacklo_epi64(bg01, bg23), K32_PERMUTE_PLANES);
+            g = _mm256_permutevar8x32_epi32(_mm256_unpackhi_epi64(bg01, bg23), K32_PERMUTE_PLANES);
+            r = _mm256_permutevar8x32_epi32(_mm256_unpacklo_epi64(ra01, ra23), K32_PERMUTE_PLANES);
+        }
+
+        template<class T, size_t N, int sy> SIMD_INLINE void AnyToYuv2x(const uint8_t * src, size_t srcStride, uint8_t * y, size_t yStride, __m256i & u, __m256i & v)
+        {
+            __m256i b, g, r, b16[2], g16[2], r16[2];
+            for (size_t i = 0; i < 2; ++i)
+            {
+                b16[i] = _mm256_set1_epi16(1 << sy), g16[i] = b16[i], r16[i] = b16[i];
+                for (size_t dy = 0; dy < (size_t(1) << sy); ++dy)
+                {
+                    LoadAny<N>(src + dy * srcStride + i * A * N, b, g, r);
+                    _mm256_storeu_si256((__m256i*)(y + dy * yStride + i * A), BgrToY8<T>(b, g, r));
+                    b16[i] = _mm256_add_epi16(b16[i], _mm256_maddubs_epi16(b, K8_01));
+                    g16[i] = _mm256_add_epi16(g16[i], _mm256_maddubs_epi16(g, K8_01));
+                    r16[i] = _mm256_add_epi16(r16[i], _mm256_maddubs_epi16(r, K8_01));
+                }
+                b16[i] = _mm256_srli_epi16(b16[i], 1 + sy);
+                g16[i] = _mm256_srli_epi16(g16[i], 1 + sy);
+                r16[i] = _mm256_srli_epi16(r16[i], 1 + sy);
+            }
+            u = PackI16ToU8(BgrToU16<T>(b16[0], g16[0], r16[0]), BgrToU16<T>(b16[1], g16[1], r16[1]));
+            v = PackI16ToU8(BgrToV16<T>(b16[0], g16[0], r16[0]), BgrToV16<T>(b16[1], g16[1], r16[1]));
+        }
+
+        template<class T, size_t N, int sx, int sy> SIMD_INLINE void AnyToYuv(const uint8_t * src, size_t srcStride, uint8_t * y, size_t yStride, uint8_t * u, uint8_t * v)
+        {
+            __m256i b, g, r;
+            if (sx == 0)
+            {
+                LoadAny<N>(src, b, g, r);
+                _mm256_storeu_si256((__m256i*)y, BgrToY8<T>(b, g, r));
+                _mm256_storeu_si256((__m256i*)u, BgrToU8<T>(b, g, r));
+                _mm256_storeu_si256((__m256i*)v, BgrToV8<T>(b, g, r));
+            }
+            else
+            {
+                __m256i _u, _v;
+                AnyToYuv2x<T, N, sy>(src, srcStride, y, yStride, _u, _v);
+                _mm256_storeu_si256((__m256i*)u, _u);
+                _mm256_storeu_si256((__m256i*)v, _v);
+            }
+        }
+
+        template<class T, size_t N, int sx, int sy> void AnyToYuvV2(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            const size_t step = A << sx;
+            assert((width % (1 << sx) == 0) && (height % (1 << sy) == 0) && (width >= step));
+
+            size_t widthS = AlignLo(width, step), tail = width - step;
+            for (size_t row = 0; row < height; row += size_t(1) << sy)
+            {
+                for (size_t col = 0; col < widthS; col += step)
+                    AnyToYuv<T, N, sx, sy>(src + col * N, srcStride, y + col, yStride, u + (col >> sx), v + (col >> sx));
+                if (widthS != width)
+                    AnyToYuv<T, N, sx, sy>(src + tail * N, srcStride, y + tail, yStride, u + (tail >> sx), v + (tail >> sx));
+                src += srcStride << sy;
+                y += yStride << sy;
+                u += uStride;
+                v += vStride;
+            }
+        }
+
+        template<size_t N, int sx, int sy> void AnyToYuvV2(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: AnyToYuvV2<Base::Bt601, N, sx, sy>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: AnyToYuvV2<Base::Bt709, N, sx, sy>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: AnyToYuvV2<Base::Bt601Full, N, sx, sy>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: AnyToYuvV2<Base::Bt709Full, N, sx, sy>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            default: assert(0);
+            }
+        }
+
+        void BgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            AnyToYuvV2<3, 1, 1>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        void BgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            AnyToYuvV2<3, 1, 0>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        void BgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            AnyToYuvV2<3, 0, 0>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        void BgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            AnyToYuvV2<4, 1, 1>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        void BgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            AnyToYuvV2<4, 1, 0>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        void BgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            AnyToYuvV2<4, 0, 0>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        //---------------------------------------------------------------------
+
+        template<class T, size_t N> SIMD_INLINE void AnyToNv12(const uint8_t * src, size_t srcStride, uint8_t * y, size_t yStride, uint8_t * uv)
+        {
+            __m256i u, v;
+            AnyToYuv2x<T, N, 1>(src, srcStride, y, yStride, u, v);
+            __m256i lo = _mm256_unpacklo_epi8(u, v), hi = _mm256_unpackhi_epi8(u, v);
+            _mm256_storeu_si256((__m256i*)uv + 0, _mm256_permute2x128_si256(lo, hi, 0x20));
+            _mm256_storeu_si256((__m256i*)uv + 1, _mm256_permute2x128_si256(lo, hi, 0x31));
+        }
+
+        template<class T, size_t N> void AnyToNv12(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA));
+
+            size_t widthDA = AlignLo(width, DA), tail = width - DA;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < widthDA; col += DA)
+                    AnyToNv12<T, N>(src + col * N, srcStride, y + col, yStride, uv + col);
+                if (widthDA != width)
+                    AnyToNv12<T, N>(src + tail * N, srcStride, y + tail, yStride, uv + tail);
+                src += 2 * srcStride;
+                y += 2 * yStride;
+                uv += uvStride;
+            }
+        }
+
+        template<size_t N> void AnyToNv12(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: AnyToNv12<Base::Bt601, N>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709: AnyToNv12<Base::Bt709, N>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt601Full: AnyToNv12<Base::Bt601Full, N>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709Full: AnyToNv12<Base::Bt709Full, N>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            default: assert(0);
+            }
+        }
+
+        void BgraToNv12(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            AnyToNv12<4>(bgra, width, height, bgraStride, y, yStride, uv, uvStride, yuvType);
+        }
+
+        void BgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            AnyToNv12<3>(bgr, width, height, bgrStride, y, yStride, uv, uvStride, yuvType);
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
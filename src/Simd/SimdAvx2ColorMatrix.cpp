@@ -0,0 +1,138 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdColorSpace.h"
+#include "Simd/SimdColorMatrix.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i Gather(const int32_t * table, __m256i index)
+        {
+            return _mm256_i32gather_epi32(table, index, 4);
+        }
+
+        struct ColorMatrixConst
+        {
+            __m256i bg[3], r[3], offset[3];
+            __m256 m[3][4];
+
+            SIMD_INLINE ColorMatrixConst(const Base::ColorMatrixCoefs & coefs)
+            {
+                for (int c = 0; c < 3; ++c)
+                {
+                    bg[c] = _mm256_set1_epi32((coefs.fixed[c][0] & 0xFFFF) | (coefs.fixed[c][1] << 16));
+                    r[c] = _mm256_set1_epi32(coefs.fixed[c][2] & 0xFFFF);
+                    offset[c] = _mm256_set1_epi32(coefs.fixed[c][3]);
+                    for (int k = 0; k < 4; ++k)
+                        m[c][k] = _mm256_set1_ps(coefs.floats[c][k]);
+                }
+            }
+        };
+
+        template<bool precise, bool gamma> SIMD_INLINE void ColorMatrixPixels(const Base::ColorMatrixCoefs & coefs, const ColorMatrixConst & k, __m256i & b, __m256i & g, __m256i & r)
+        {
+            __m256i dst[3];
+            if (precise)
+            {
+                __m256 _b = _mm256_cvtepi32_ps(b), _g = _mm256_cvtepi32_ps(g), _r = _mm256_cvtepi32_ps(r);
+                for (int c = 0; c < 3; ++c)
+                {
+                    __m256 value = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_b, k.m[c][0]), _mm256_mul_ps(_g, k.m[c][1])), _mm256_mul_ps(_r, k.m[c][2])), k.m[c][3]);
+                    value = _mm256_min_ps(_mm256_max_ps(value, _mm256_setzero_ps()), _mm256_set1_ps(255.0f));
+                    dst[c] = _mm256_cvttps_epi32(_mm256_add_ps(value, _mm256_set1_ps(0.5f)));
+                }
+            }
+            else
+            {
+                __m256i bg = _mm256_or_si256(b, _mm256_slli_epi32(g, 16));
+                for (int c = 0; c < 3; ++c)
+                {
+                    __m256i value = _mm256_add_epi32(_mm256_add_epi32(_mm256_madd_epi16(bg, k.bg[c]), _mm256_madd_epi16(r, k.r[c])), k.offset[c]);
+                    dst[c] = _mm256_min_epi32(_mm256_max_epi32(_mm256_srai_epi32(value, Base::COLOR_MATRIX_SHIFT), K_ZERO), K32_000000FF);
+                }
+            }
+            b = gamma ? Gather(coefs.gamma[0], dst[0]) : dst[0];
+            g = gamma ? Gather(coefs.gamma[1], dst[1]) : dst[1];
+            r = gamma ? Gather(coefs.gamma[2], dst[2]) : dst[2];
+        }
+
+        template<size_t channels, bool precise, bool gamma> void ColorMatrixRow(const Base::ColorMatrixCoefs & coefs, const uint8_t * src, size_t width, uint8_t * dst)
+        {
+            ColorMatrixConst k(coefs);
+            size_t widthF = AlignLo(width, F);
+            __m256i alpha = _mm256_set1_epi32(0xFF000000);
+            for (size_t col = 0; col < widthF; col += F)
+            {
+                __m256i b, g, r;
+                if (channels == 3)
+                {
+                    LoadBgr32i(src + col * 3, b, g, r);
+                    ColorMatrixPixels<precise, gamma>(coefs, k, b, g, r);
+                    StoreBgr32i(dst + col * 3, b, g, r);
+                }
+                else
+                {
+                    __m256i bgra = _mm256_loadu_si256((__m256i*)(src + col * 4));
+                    b = _mm256_and_si256(bgra, K32_000000FF);
+                    g = _mm256_and_si256(_mm256_srli_epi32(bgra, 8), K32_000000FF);
+                    r = _mm256_and_si256(_mm256_srli_epi32(bgra, 16), K32_000000FF);
+                    ColorMatrixPixels<precise, gamma>(coefs, k, b, g, r);
+                    bgra = _mm256_or_si256(_mm256_and_si256(bgra, alpha), _mm256_or_si256(b, _mm256_slli_epi32(g, 8)));
+                    _mm256_storeu_si256((__m256i*)(dst + col * 4), _mm256_or_si256(bgra, _mm256_slli_epi32(r, 16)));
+                }
+            }
+            Base::ColorMatrixTail<channels, precise, gamma>(coefs, src, widthF, width, dst);
+        }
+
+        template<size_t channels, bool precise> Base::ColorMatrixRowPtr GetColorMatrixRow(bool gamma)
+        {
+            return gamma ? ColorMatrixRow<channels, precise, true> : ColorMatrixRow<channels, precise, false>;
+        }
+
+        template<size_t channels> Base::ColorMatrixRowPtr GetColorMatrixRow(const ColorMatrixParam & param)
+        {
+            return param.precise ? GetColorMatrixRow<channels, true>(param.gamma) : GetColorMatrixRow<channels, false>(param.gamma);
+        }
+
+        ColorMatrixDefault::ColorMatrixDefault(const ColorMatrixParam& param, const float* matrix, const uint8_t* gamma)
+            : Sse41::ColorMatrixDefault(param, matrix, gamma)
+        {
+            _row = _param.format == SimdPixelFormatBgr24 ? GetColorMatrixRow<3>(_param) : GetColorMatrixRow<4>(_param);
+        }
+
+        //---------------------------------------------------------------------
+
+        void* ColorMatrixInit(const float* matrix, const uint8_t* gamma, SimdPixelFormatType format, SimdBool precise)
+        {
+            ColorMatrixParam param(format, precise, gamma != NULL);
+            if (matrix == NULL || !param.Valid())
+                return NULL;
+            return new ColorMatrixDefault(param, matrix, gamma);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -61,7 +61,8 @@ namespace Simd
 
         bool GetEnable()
         {
-            return SupportedByCPU() && SupportedByOS();
+            static const bool enable = SupportedByCPU() && SupportedByOS();
+            return enable;
         }
     }
 #endif
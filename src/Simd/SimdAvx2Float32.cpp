@@ -105,6 +105,37 @@ namespace Simd
                 Uint8ToFloat32<false>(src, size, lower, upper, dst);
         }
 
+        template <bool align> SIMD_INLINE void Uint16ToFloat32(const uint16_t * src, const __m256 & lower, const __m256 & boost, float * dst)
+        {
+            __m256i _src = Load<align>((__m256i*)src);
+            Avx::Store<align>(dst + 0, _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(_src))), boost), lower));
+            Avx::Store<align>(dst + F, _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(_src, 1))), boost), lower));
+        }
+
+        template <bool align> void Uint16ToFloat32(const uint16_t * src, size_t size, int bits, const float * lower, const float * upper, float * dst)
+        {
+            assert(size >= HA);
+            if (align)
+                assert(Aligned(src) && Aligned(dst));
+
+            __m256 _lower = _mm256_set1_ps(lower[0]);
+            __m256 boost = _mm256_set1_ps((upper[0] - lower[0]) / float((1 << bits) - 1));
+
+            size_t alignedSize = AlignLo(size, HA);
+            for (size_t i = 0; i < alignedSize; i += HA)
+                Uint16ToFloat32<align>(src + i, _lower, boost, dst + i);
+            if (alignedSize != size)
+                Uint16ToFloat32<false>(src + size - HA, _lower, boost, dst + size - HA);
+        }
+
+        void Uint16ToFloat32(const uint16_t * src, size_t size, int bits, const float * lower, const float * upper, float * dst)
+        {
+            if (Aligned(src) && Aligned(dst))
+                Uint16ToFloat32<true>(src, size, bits, lower, upper, dst);
+            else
+                Uint16ToFloat32<false>(src, size, bits, lower, upper, dst);
+        }
+
         template<bool align> void CosineDistance32f(const float * a, const float * b, size_t size, float * distance)
         {
             if (align)
@@ -0,0 +1,213 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdColorSpace.h"
+#include "Simd/SimdLut3d.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i Gather(const uint32_t * table, __m256i index)
+        {
+            return _mm256_i32gather_epi32((int*)table, index, 4);
+        }
+
+        struct Lut3dConst
+        {
+            __m256i size, size2, last, mask;
+            __m256 scale, output, half;
+
+            SIMD_INLINE Lut3dConst(size_t s)
+            {
+                size = _mm256_set1_epi32((int)s);
+                size2 = _mm256_set1_epi32((int)(s * s));
+                last = _mm256_set1_epi32((int)s - 2);
+                mask = _mm256_set1_epi32(Base::LUT3D_MASK);
+                scale = _mm256_set1_ps(float(s - 1) / 255.0f);
+                output = _mm256_set1_ps(Base::LUT3D_SCALE);
+                half = _mm256_set1_ps(0.5f);
+            }
+        };
+
+        SIMD_INLINE void Lut3dIndex(__m256i value, const Lut3dConst & k, __m256i & index, __m256 & frac)
+        {
+            __m256 x = _mm256_mul_ps(_mm256_cvtepi32_ps(value), k.scale);
+            index = _mm256_min_epi32(_mm256_cvttps_epi32(x), k.last);
+            frac = _mm256_sub_ps(x, _mm256_cvtepi32_ps(index));
+        }
+
+        SIMD_INLINE void Lut3dValue(__m256i node, const Lut3dConst & k, __m256 * value)
+        {
+            value[0] = _mm256_cvtepi32_ps(_mm256_and_si256(node, k.mask));
+            value[1] = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(node, Base::LUT3D_BITS), k.mask));
+            value[2] = _mm256_cvtepi32_ps(_mm256_srli_epi32(node, 2 * Base::LUT3D_BITS));
+        }
+
+        SIMD_INLINE void Lut3dLerp(const __m256 * a, const __m256 * b, __m256 f, __m256 * dst)
+        {
+            for (int c = 0; c < 3; ++c)
+                dst[c] = _mm256_add_ps(a[c], _mm256_mul_ps(_mm256_sub_ps(b[c], a[c]), f));
+        }
+
+        SIMD_INLINE void Lut3dLerp(const uint32_t * table, __m256i i0, __m256i i1, __m256 f, const Lut3dConst & k, __m256 * dst)
+        {
+            __m256 v0[3], v1[3];
+            Lut3dValue(Gather(table, i0), k, v0);
+            Lut3dValue(Gather(table, i1), k, v1);
+            Lut3dLerp(v0, v1, f, dst);
+        }
+
+        SIMD_INLINE __m256i Lut3dOutput(__m256 value, const Lut3dConst & k)
+        {
+            return _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(value, k.output), k.half));
+        }
+
+        SIMD_INLINE void Lut3dTrilinear(const uint32_t * table, const Lut3dConst & k, __m256i & b, __m256i & g, __m256i & r)
+        {
+            __m256i ib, ig, ir;
+            __m256 fb, fg, fr;
+            Lut3dIndex(b, k, ib, fb);
+            Lut3dIndex(g, k, ig, fg);
+            Lut3dIndex(r, k, ir, fr);
+            __m256i i00 = _mm256_add_epi32(ir, _mm256_add_epi32(_mm256_mullo_epi32(ig, k.size), _mm256_mullo_epi32(ib, k.size2)));
+            __m256i i10 = _mm256_add_epi32(i00, k.size);
+            __m256i i01 = _mm256_add_epi32(i00, k.size2);
+            __m256i i11 = _mm256_add_epi32(i10, k.size2);
+            __m256 v00[3], v10[3], v01[3], v11[3], v0[3], v1[3], v[3];
+            Lut3dLerp(table, i00, _mm256_add_epi32(i00, K32_00000001), fr, k, v00);
+            Lut3dLerp(table, i10, _mm256_add_epi32(i10, K32_00000001), fr, k, v10);
+            Lut3dLerp(table, i01, _mm256_add_epi32(i01, K32_00000001), fr, k, v01);
+            Lut3dLerp(table, i11, _mm256_add_epi32(i11, K32_00000001), fr, k, v11);
+            Lut3dLerp(v00, v10, fg, v0);
+            Lut3dLerp(v01, v11, fg, v1);
+            Lut3dLerp(v0, v1, fb, v);
+            b = Lut3dOutput(v[0], k);
+            g = Lut3dOutput(v[1], k);
+            r = Lut3dOutput(v[2], k);
+        }
+
+        SIMD_INLINE void Lut3dSort(__m256 & fa, __m256i & oa, __m256 & fb, __m256i & ob)
+        {
+            __m256 mask = _mm256_cmp_ps(fa, fb, _CMP_LT_OQ);
+            __m256 f = fa;
+            fa = _mm256_blendv_ps(fa, fb, mask);
+            fb = _mm256_blendv_ps(fb, f, mask);
+            __m256i o = oa;
+            oa = _mm256_blendv_epi8(oa, ob, _mm256_castps_si256(mask));
+            ob = _mm256_blendv_epi8(ob, o, _mm256_castps_si256(mask));
+        }
+
+        SIMD_INLINE void Lut3dTetrahedral(const uint32_t * table, const Lut3dConst & k, __m256i & b, __m256i & g, __m256i & r)
+        {
+            __m256i ib, ig, ir;
+            __m256 f0, f1, f2;
+            Lut3dIndex(r, k, ir, f0);
+            Lut3dIndex(g, k, ig, f1);
+            Lut3dIndex(b, k, ib, f2);
+            __m256i o0 = K32_00000001, o1 = k.size, o2 = k.size2;
+            Lut3dSort(f0, o0, f1, o1);
+            Lut3dSort(f1, o1, f2, o2);
+            Lut3dSort(f0, o0, f1, o1);
+            __m256i i0 = _mm256_add_epi32(ir, _mm256_add_epi32(_mm256_mullo_epi32(ig, k.size), _mm256_mullo_epi32(ib, k.size2)));
+            __m256i i1 = _mm256_add_epi32(i0, o0);
+            __m256i i2 = _mm256_add_epi32(i1, o1);
+            __m256i i3 = _mm256_add_epi32(i0, _mm256_add_epi32(K32_00000001, _mm256_add_epi32(k.size, k.size2)));
+            __m256 c0[3], c1[3], c2[3], c3[3];
+            Lut3dValue(Gather(table, i0), k, c0);
+            Lut3dValue(Gather(table, i1), k, c1);
+            Lut3dValue(Gather(table, i2), k, c2);
+            Lut3dValue(Gather(table, i3), k, c3);
+            __m256 w0 = _mm256_sub_ps(_mm256_set1_ps(1.0f), f0), w1 = _mm256_sub_ps(f0, f1), w2 = _mm256_sub_ps(f1, f2), w3 = f2;
+            __m256 v[3];
+            for (int c = 0; c < 3; ++c)
+                v[c] = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(c0[c], w0), _mm256_mul_ps(c1[c], w1)), _mm256_mul_ps(c2[c], w2)), _mm256_mul_ps(c3[c], w3));
+            b = Lut3dOutput(v[0], k);
+            g = Lut3dOutput(v[1], k);
+            r = Lut3dOutput(v[2], k);
+        }
+
+        template<SimdLut3dInterpolationType interpolation> SIMD_INLINE void Lut3dPixels(const uint32_t * table, const Lut3dConst & k, __m256i & b, __m256i & g, __m256i & r)
+        {
+            if (interpolation == SimdLut3dInterpolationTrilinear)
+                Lut3dTrilinear(table, k, b, g, r);
+            else
+                Lut3dTetrahedral(table, k, b, g, r);
+        }
+
+        template<size_t channels, SimdLut3dInterpolationType interpolation> void Lut3dRow(const uint32_t * table, size_t size, const uint8_t * src, size_t width, uint8_t * dst)
+        {
+            Lut3dConst k(size);
+            size_t widthF = AlignLo(width, F);
+            __m256i alpha = _mm256_set1_epi32(0xFF000000);
+            for (size_t col = 0; col < widthF; col += F)
+            {
+                __m256i b, g, r;
+                if (channels == 3)
+                {
+                    LoadBgr32i(src + col * 3, b, g, r);
+                    Lut3dPixels<interpolation>(table, k, b, g, r);
+                    StoreBgr32i(dst + col * 3, b, g, r);
+                }
+                else
+                {
+                    __m256i bgra = _mm256_loadu_si256((__m256i*)(src + col * 4));
+                    b = _mm256_and_si256(bgra, K32_000000FF);
+                    g = _mm256_and_si256(_mm256_srli_epi32(bgra, 8), K32_000000FF);
+                    r = _mm256_and_si256(_mm256_srli_epi32(bgra, 16), K32_000000FF);
+                    Lut3dPixels<interpolation>(table, k, b, g, r);
+                    bgra = _mm256_or_si256(_mm256_and_si256(bgra, alpha), _mm256_or_si256(b, _mm256_slli_epi32(g, 8)));
+                    _mm256_storeu_si256((__m256i*)(dst + col * 4), _mm256_or_si256(bgra, _mm256_slli_epi32(r, 16)));
+                }
+            }
+            Base::Lut3dTail<channels, interpolation>(table, size, src, widthF, width, dst);
+        }
+
+        template<SimdLut3dInterpolationType interpolation> Base::Lut3dRowPtr GetLut3dRow(SimdPixelFormatType format)
+        {
+            return format == SimdPixelFormatBgr24 ? Lut3dRow<3, interpolation> : Lut3dRow<4, interpolation>;
+        }
+
+        Lut3dDefault::Lut3dDefault(const Lut3dParam& param, const float* table)
+            : Sse41::Lut3dDefault(param, table)
+        {
+            if (_param.interpolation == SimdLut3dInterpolationTrilinear)
+                _row = GetLut3dRow<SimdLut3dInterpolationTrilinear>(_param.format);
+            else
+                _row = GetLut3dRow<SimdLut3dInterpolationTetrahedral>(_param.format);
+        }
+
+        //---------------------------------------------------------------------
+
+        void* Lut3dInit(const float* table, size_t size, SimdPixelFormatType format, SimdLut3dInterpolationType interpolation)
+        {
+            Lut3dParam param(size, format, interpolation);
+            if (table == NULL || !param.Valid())
+                return NULL;
+            return new Lut3dDefault(param, table);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
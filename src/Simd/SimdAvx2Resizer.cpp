@@ -119,8 +119,7 @@ namespace Simd
                 }
             }
             size_t size = AlignHi(_param.dstW, _param.align)*_param.channels * 2;
-            _bx[0].Resize(size, false, _param.align);
-            _bx[1].Resize(size, false, _param.align);
+            _bufSize = size + _param.align; // the last gray block stores a whole vector past the row end
         }
 
         template <size_t channelCount> void ResizerByteBilinearInterpolateX(const __m256i * alpha, __m256i * buffer);
@@ -226,7 +225,7 @@ namespace Simd
             Store<false>((__m256i*)dst, PackI16ToU8(lo, hi));
         }
 
-        template<size_t N> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
         {
             struct One { uint8_t val[N * 1]; };
             struct Two { uint8_t val[N * 2]; };
@@ -237,11 +236,12 @@ namespace Simd
             size_t dstW = _param.dstW;
             ptrdiff_t previous = -2;
             __m256i a[2];
-            uint8_t * bx[2] = { _bx[0].data, _bx[1].data };
+            uint8_t * bx[2] = { buf, buf + _bufSize };
             const uint8_t * ax = _ax.data;
             const int32_t * ix = _ix.data;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t yDst = yBeg; yDst < yEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm256_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm256_set1_epi16(int16_t(_ay[yDst]));
@@ -278,7 +278,7 @@ namespace Simd
             }
         }
 
-        void ResizerByteBilinear::RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteBilinear::RunG(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
         {
             size_t bufW = AlignHi(_param.dstW, A) * 2;
             size_t size = 2 * _param.dstW;
@@ -286,11 +286,12 @@ namespace Simd
             size_t blocks = _blocks;
             ptrdiff_t previous = -2;
             __m256i a[2];
-            uint8_t * bx[2] = { _bx[0].data, _bx[1].data };
+            uint8_t * bx[2] = { buf, buf + _bufSize };
             const uint8_t * ax = _ax.data;
             const Idx * ixg = _ixg.data;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t yDst = yBeg; yDst < yEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm256_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm256_set1_epi16(int16_t(_ay[yDst]));
@@ -323,22 +324,21 @@ namespace Simd
             }
         }
 
-        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteBilinear::RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
         {
             assert(_param.dstW >= A);
 
-            EstimateParams();
             switch (_param.channels)
             {
             case 1:
                 if (_blocks)
-                    RunG(src, srcStride, dst, dstStride);
+                    RunG(src, srcStride, yBeg, yEnd, dst, dstStride, buf);
                 else
-                    Run<1>(src, srcStride, dst, dstStride);
+                    Run<1>(src, srcStride, yBeg, yEnd, dst, dstStride, buf);
                 break;
-            case 2: Run<2>(src, srcStride, dst, dstStride); break;
-            case 3: Run<3>(src, srcStride, dst, dstStride); break;
-            case 4: Run<4>(src, srcStride, dst, dstStride); break;
+            case 2: Run<2>(src, srcStride, yBeg, yEnd, dst, dstStride, buf); break;
+            case 3: Run<3>(src, srcStride, yBeg, yEnd, dst, dstStride, buf); break;
+            case 4: Run<4>(src, srcStride, yBeg, yEnd, dst, dstStride, buf); break;
             default:
                 assert(0);
             }
@@ -478,14 +478,16 @@ namespace Simd
             ResizerByteAreaResult34<3>(src, count, curr, zero, next, dst);
         }
 
-        template<size_t N> void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, int32_t * by)
         {
             size_t dstW = _param.dstW, rowSize = _param.srcW*N, rowRest = dstStride - dstW * N;
             const int32_t * iy = _iy.data, *ix = _ix.data, *ay = _ay.data, *ax = _ax.data;
             int32_t ay0 = ay[0], ax0 = ax[0];
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
+            src += iy[yBeg] * srcStride;
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += rowRest)
             {
-                int32_t * buf = _by.data;
+                int32_t * buf = by;
                 size_t yn = iy[dy + 1] - iy[dy];
                 ResizerByteAreaRowSum(src, srcStride, yn, rowSize, ay[dy], ay0, ay[dy + 1], buf), src += yn * srcStride;
                 for (size_t dx = 0; dx < dstW; dx++, dst += N)
@@ -496,14 +498,14 @@ namespace Simd
             }
         }
 
-        void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteArea::RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
         {
             switch (_param.channels)
             {
-            case 1: Run<1>(src, srcStride, dst, dstStride); return;
-            case 2: Run<2>(src, srcStride, dst, dstStride); return;
-            case 3: Run<3>(src, srcStride, dst, dstStride); return;
-            case 4: Run<4>(src, srcStride, dst, dstStride); return;
+            case 1: Run<1>(src, srcStride, yBeg, yEnd, dst, dstStride, (int32_t*)buf); return;
+            case 2: Run<2>(src, srcStride, yBeg, yEnd, dst, dstStride, (int32_t*)buf); return;
+            case 3: Run<3>(src, srcStride, yBeg, yEnd, dst, dstStride, (int32_t*)buf); return;
+            case 4: Run<4>(src, srcStride, yBeg, yEnd, dst, dstStride, (int32_t*)buf); return;
             default:
                 assert(0);
             }
@@ -516,15 +518,16 @@ namespace Simd
         {
         }
 
-        void ResizerFloatBilinear::Run(const float * src, size_t srcStride, float * dst, size_t dstStride)
+        void ResizerFloatBilinear::Run(const float * src, size_t srcStride, size_t yBeg, size_t yEnd, float * dst, size_t dstStride, float * buf)
         {
             size_t cn = _param.channels;
             size_t rs = _param.dstW * cn;
-            float * pbx[2] = { _bx[0].data, _bx[1].data };
+            float * pbx[2] = { buf, buf + AlignHi(rs, _param.align / sizeof(float)) };
             int32_t prev = -2;
             size_t rsa = AlignLo(rs, Avx::F);
             size_t rsh = AlignLo(rs, Sse::F);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -638,6 +641,81 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        ResizerShortBilinear::ResizerShortBilinear(const ResParam & param)
+            : Base::ResizerShortBilinear(param)
+        {
+        }
+
+        SIMD_INLINE __m256i ResizerShortBilinearRow(const float * pb0, const float * pb1, __m256 fy0, __m256 fy1)
+        {
+            __m256 m0 = _mm256_fmadd_ps(_mm256_load_ps(pb0 + 0), fy0, _mm256_mul_ps(_mm256_load_ps(pb1 + 0), fy1));
+            __m256 m1 = _mm256_fmadd_ps(_mm256_load_ps(pb0 + F), fy0, _mm256_mul_ps(_mm256_load_ps(pb1 + F), fy1));
+            return _mm256_permute4x64_epi64(_mm256_packus_epi32(_mm256_cvtps_epi32(m0), _mm256_cvtps_epi32(m1)), 0xD8);
+        }
+
+        void ResizerShortBilinear::Run(const uint16_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint16_t * dst, size_t dstStride, float * buf)
+        {
+            size_t cn = _param.channels;
+            size_t rs = _param.dstW * cn;
+            float * pbx[2] = { buf, buf + AlignHi(rs, _param.align / sizeof(float)) };
+            int32_t prev = -2;
+            size_t rsf = AlignLo(rs, F);
+            size_t rsh = AlignLo(rs, HA);
+            __m256 _1 = _mm256_set1_ps(1.0f);
+            __m256i _cn = _mm256_set1_epi32((int)cn - 1);
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
+            {
+                float fy1 = _ay[dy];
+                float fy0 = 1.0f - fy1;
+                int32_t sy = _iy[dy];
+                int32_t k = 0;
+
+                if (sy == prev)
+                    k = 2;
+                else if (sy == prev + 1)
+                {
+                    Swap(pbx[0], pbx[1]);
+                    k = 1;
+                }
+
+                prev = sy;
+
+                for (; k < 2; k++)
+                {
+                    float * pb = pbx[k];
+                    const uint16_t * ps = src + (sy + k)*srcStride;
+                    size_t dx = 0;
+                    for (; dx < rsf; dx += F)
+                    {
+                        __m256i i0 = _mm256_load_si256((__m256i*)(_ix.data + dx));
+                        __m256i i1 = _mm256_add_epi32(i0, _cn);
+                        __m256 s0 = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_i32gather_epi32((int*)ps, i0, 2), K32_0000FFFF));
+                        __m256 s1 = _mm256_cvtepi32_ps(_mm256_srli_epi32(_mm256_i32gather_epi32((int*)ps, i1, 2), 16));
+                        __m256 fx1 = _mm256_load_ps(_ax.data + dx);
+                        __m256 fx0 = _mm256_sub_ps(_1, fx1);
+                        _mm256_store_ps(pb + dx, _mm256_fmadd_ps(s0, fx0, _mm256_mul_ps(s1, fx1)));
+                    }
+                    for (; dx < rs; dx++)
+                    {
+                        int32_t sx = _ix[dx];
+                        float fx = _ax[dx];
+                        pb[dx] = ps[sx] * (1.0f - fx) + ps[sx + cn] * fx;
+                    }
+                }
+
+                size_t dx = 0;
+                __m256 _fy0 = _mm256_set1_ps(fy0);
+                __m256 _fy1 = _mm256_set1_ps(fy1);
+                for (; dx < rsh; dx += HA)
+                    _mm256_storeu_si256((__m256i*)(dst + dx), ResizerShortBilinearRow(pbx[0] + dx, pbx[1] + dx, _fy0, _fy1));
+                for (; dx < rs; dx++)
+                    dst[dx] = (uint16_t)Round(pbx[0][dx] * fy0 + pbx[1][dx] * fy1);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m256i));
@@ -647,6 +725,16 @@ namespace Simd
                 return new ResizerByteArea(param);
             else if (param.IsFloatBilinear())
                 return new ResizerFloatBilinear(param);
+            else if (param.IsShortBilinear())
+                return new ResizerShortBilinear(param);
+            else if (param.IsFilter())
+                return new ResizerFilter(param);
+            else if (param.IsNearest())
+                return new ResizerNearest(param);
+            else if (param.IsShortArea())
+                return new ResizerShortArea(param);
+            else if (param.IsFloatArea())
+                return new ResizerFloatArea(param);
             else
                 return Avx::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
         }
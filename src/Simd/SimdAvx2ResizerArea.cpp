@@ -0,0 +1,178 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdLoad.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        template<class T> SIMD_INLINE __m256 ResizerAreaLoad(const T * src);
+
+        template<> SIMD_INLINE __m256 ResizerAreaLoad<uint16_t>(const uint16_t * src)
+        {
+            return _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i*)src)));
+        }
+
+        template<> SIMD_INLINE __m256 ResizerAreaLoad<float>(const float * src)
+        {
+            return _mm256_loadu_ps(src);
+        }
+
+        template<class T> SIMD_INLINE void ResizerAreaStore(__m256 value, T * dst);
+
+        template<> SIMD_INLINE void ResizerAreaStore<uint16_t>(__m256 value, uint16_t * dst)
+        {
+            value = _mm256_min_ps(_mm256_max_ps(value, _mm256_setzero_ps()), _mm256_set1_ps(65535.0f));
+            __m256i _value = _mm256_cvttps_epi32(_mm256_add_ps(value, _mm256_set1_ps(0.5f)));
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi32(_mm256_castsi256_si128(_value), _mm256_extracti128_si256(_value, 1)));
+        }
+
+        template<> SIMD_INLINE void ResizerAreaStore<float>(__m256 value, float * dst)
+        {
+            _mm256_storeu_ps(dst, value);
+        }
+
+        template<class T> SIMD_INLINE void ResizerAreaVerticalBlock(const uint8_t * src, size_t srcStride, size_t x, const float * weight, size_t kernel, float * dst)
+        {
+            __m256 sum = _mm256_mul_ps(ResizerAreaLoad((const T*)src + x), _mm256_set1_ps(weight[0]));
+            for (size_t k = 1; k < kernel; ++k)
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(ResizerAreaLoad((const T*)(src + k * srcStride) + x), _mm256_set1_ps(weight[k])));
+            _mm256_storeu_ps(dst + x, sum);
+        }
+
+        template<class T> void ResizerAreaVertical(const uint8_t * src, size_t srcStride, size_t width, const float * weight, size_t kernel, float * dst)
+        {
+            if (width < F)
+            {
+                Base::ResizerFilterVertical<T>(src, srcStride, width, weight, kernel, dst);
+                return;
+            }
+            size_t widthF = AlignLo(width, F);
+            for (size_t x = 0; x < widthF; x += F)
+                ResizerAreaVerticalBlock<T>(src, srcStride, x, weight, kernel, dst);
+            if (widthF < width)
+                ResizerAreaVerticalBlock<T>(src, srcStride, width - F, weight, kernel, dst);
+        }
+
+        template<class T> SIMD_INLINE void ResizerAreaHorizontalBlock(const float * src, const int32_t * index, const float * weight, size_t kernel, const __m256i & channels, size_t width, size_t x, T * dst)
+        {
+            __m256i idx = _mm256_loadu_si256((__m256i*)(index + x));
+            __m256 sum = _mm256_mul_ps(_mm256_i32gather_ps(src, idx, 4), _mm256_loadu_ps(weight + x));
+            for (size_t k = 1; k < kernel; ++k)
+            {
+                idx = _mm256_add_epi32(idx, channels);
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_i32gather_ps(src, idx, 4), _mm256_loadu_ps(weight + k * width + x)));
+            }
+            ResizerAreaStore<T>(sum, dst + x);
+        }
+
+        template<class T> void ResizerAreaHorizontal(const float * src, const int32_t * index, const float * weight, size_t kernel, size_t channels, size_t width, uint8_t * dst)
+        {
+            if (width < F)
+            {
+                Base::ResizerFilterHorizontal<T>(src, index, weight, kernel, channels, width, dst);
+                return;
+            }
+            __m256i _channels = _mm256_set1_epi32((int)channels);
+            size_t widthF = AlignLo(width, F);
+            for (size_t x = 0; x < widthF; x += F)
+                ResizerAreaHorizontalBlock<T>(src, index, weight, kernel, _channels, width, x, (T*)dst);
+            if (widthF < width)
+                ResizerAreaHorizontalBlock<T>(src, index, weight, kernel, _channels, width, width - F, (T*)dst);
+        }
+
+        template<size_t N> SIMD_INLINE __m256 ResizerAreaSum1(const float * src);
+
+        template<> SIMD_INLINE __m256 ResizerAreaSum1<2>(const float * src)
+        {
+            __m256 sum = _mm256_hadd_ps(_mm256_loadu_ps(src + 0), _mm256_loadu_ps(src + F));
+            return _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(sum), 0xD8));
+        }
+
+        template<> SIMD_INLINE __m256 ResizerAreaSum1<4>(const float * src)
+        {
+            __m256 sum01 = _mm256_hadd_ps(_mm256_loadu_ps(src + 0 * F), _mm256_loadu_ps(src + 1 * F));
+            __m256 sum23 = _mm256_hadd_ps(_mm256_loadu_ps(src + 2 * F), _mm256_loadu_ps(src + 3 * F));
+            return _mm256_permutevar8x32_ps(_mm256_hadd_ps(sum01, sum23), _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+        }
+
+        template<class T, size_t N> void ResizerAreaHorizontal(const float * src, const int32_t * index, const float * weight, size_t kernel, size_t channels, size_t width, uint8_t * dst)
+        {
+            __m256 norm = _mm256_set1_ps(1.0f / float(N));
+            if (channels == 4)
+            {
+                size_t width8 = AlignLo(width, 8), x = 0;
+                for (; x < width8; x += 8, src += N * 8)
+                {
+                    __m256 sum = Avx::Load<false>(src, src + N * 4);
+                    for (size_t k = 1; k < N; ++k)
+                        sum = _mm256_add_ps(sum, Avx::Load<false>(src + k * 4, src + (N + k) * 4));
+                    ResizerAreaStore<T>(_mm256_mul_ps(sum, norm), (T*)dst + x);
+                }
+                if (x < width)
+                    Base::ResizerAreaHorizontal<T, N>(src, index, weight, kernel, channels, width - x, (uint8_t*)((T*)dst + x));
+            }
+            else if (channels == 1 && N != 3)
+            {
+                size_t widthF = AlignLo(width, F), x = 0;
+                for (; x < widthF; x += F)
+                    ResizerAreaStore<T>(_mm256_mul_ps(ResizerAreaSum1<N == 3 ? 2 : N>(src + x * N), norm), (T*)dst + x);
+                if (x < width)
+                    Base::ResizerAreaHorizontal<T, N>(src + x * N, index, weight, kernel, channels, width - x, (uint8_t*)((T*)dst + x));
+            }
+            else
+                Base::ResizerAreaHorizontal<T, N>(src, index, weight, kernel, channels, width, dst);
+        }
+
+        template<class T> Base::ResizerFloatArea::HorizontalPtr GetResizerAreaHorizontal(size_t fx)
+        {
+            switch (fx)
+            {
+            case 2: return ResizerAreaHorizontal<T, 2>;
+            case 3: return ResizerAreaHorizontal<T, 3>;
+            case 4: return ResizerAreaHorizontal<T, 4>;
+            default: return ResizerAreaHorizontal<T>;
+            }
+        }
+
+        ResizerFloatArea::ResizerFloatArea(const ResParam & param)
+            : Sse41::ResizerFloatArea(param)
+        {
+            _vertical = ResizerAreaVertical<float>;
+            _horizontal = GetResizerAreaHorizontal<float>(_fx);
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerShortArea::ResizerShortArea(const ResParam & param)
+            : Sse41::ResizerShortArea(param)
+        {
+            _vertical = ResizerAreaVertical<uint16_t>;
+            _horizontal = GetResizerAreaHorizontal<uint16_t>(_fx);
+        }
+    }
+#endif //SIMD_AVX2_ENABLE
+}
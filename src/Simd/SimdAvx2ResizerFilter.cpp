@@ -0,0 +1,129 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        template<class T> SIMD_INLINE __m256 ResizerFilterLoad(const T * src);
+
+        template<> SIMD_INLINE __m256 ResizerFilterLoad<uint8_t>(const uint8_t * src)
+        {
+            return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)src)));
+        }
+
+        template<> SIMD_INLINE __m256 ResizerFilterLoad<float>(const float * src)
+        {
+            return _mm256_loadu_ps(src);
+        }
+
+        template<class T> SIMD_INLINE void ResizerFilterStore(__m256 value, T * dst);
+
+        template<> SIMD_INLINE void ResizerFilterStore<uint8_t>(__m256 value, uint8_t * dst)
+        {
+            value = _mm256_min_ps(_mm256_max_ps(value, _mm256_setzero_ps()), _mm256_set1_ps(255.0f));
+            __m256i _value = _mm256_cvttps_epi32(_mm256_add_ps(value, _mm256_set1_ps(0.5f)));
+            __m128i packed = _mm_packs_epi32(_mm256_castsi256_si128(_value), _mm256_extracti128_si256(_value, 1));
+            _mm_storel_epi64((__m128i*)dst, _mm_packus_epi16(packed, packed));
+        }
+
+        template<> SIMD_INLINE void ResizerFilterStore<float>(__m256 value, float * dst)
+        {
+            _mm256_storeu_ps(dst, value);
+        }
+
+        template<class T> SIMD_INLINE void ResizerFilterVerticalBlock(const uint8_t * src, size_t srcStride, size_t x, const float * weight, size_t kernel, float * dst)
+        {
+            __m256 sum = _mm256_mul_ps(ResizerFilterLoad((const T*)src + x), _mm256_set1_ps(weight[0]));
+            for (size_t k = 1; k < kernel; ++k)
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(ResizerFilterLoad((const T*)(src + k * srcStride) + x), _mm256_set1_ps(weight[k])));
+            _mm256_storeu_ps(dst + x, sum);
+        }
+
+        template<class T> void ResizerFilterVertical(const uint8_t * src, size_t srcStride, size_t width, const float * weight, size_t kernel, float * dst)
+        {
+            if (width < F)
+            {
+                Base::ResizerFilterVertical<T>(src, srcStride, width, weight, kernel, dst);
+                return;
+            }
+            size_t widthF = AlignLo(width, F);
+            for (size_t x = 0; x < widthF; x += F)
+                ResizerFilterVerticalBlock<T>(src, srcStride, x, weight, kernel, dst);
+            if (widthF < width)
+                ResizerFilterVerticalBlock<T>(src, srcStride, width - F, weight, kernel, dst);
+        }
+
+        SIMD_INLINE __m256 Gather(const float * src, __m256i index)
+        {
+            return _mm256_i32gather_ps(src, index, 4);
+        }
+
+        template<class T> SIMD_INLINE void ResizerFilterHorizontalBlock(const float * src, const int32_t * index, const float * weight, size_t kernel, const __m256i & channels, size_t width, size_t x, T * dst)
+        {
+            __m256i idx = _mm256_loadu_si256((__m256i*)(index + x));
+            __m256 sum = _mm256_mul_ps(Gather(src, idx), _mm256_loadu_ps(weight + x));
+            for (size_t k = 1; k < kernel; ++k)
+            {
+                idx = _mm256_add_epi32(idx, channels);
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(Gather(src, idx), _mm256_loadu_ps(weight + k * width + x)));
+            }
+            ResizerFilterStore<T>(sum, dst + x);
+        }
+
+        template<class T> void ResizerFilterHorizontal(const float * src, const int32_t * index, const float * weight, size_t kernel, size_t channels, size_t width, uint8_t * dst)
+        {
+            if (width < F)
+            {
+                Base::ResizerFilterHorizontal<T>(src, index, weight, kernel, channels, width, dst);
+                return;
+            }
+            __m256i _channels = _mm256_set1_epi32((int)channels);
+            size_t widthF = AlignLo(width, F);
+            for (size_t x = 0; x < widthF; x += F)
+                ResizerFilterHorizontalBlock<T>(src, index, weight, kernel, _channels, width, x, (T*)dst);
+            if (widthF < width)
+                ResizerFilterHorizontalBlock<T>(src, index, weight, kernel, _channels, width, width - F, (T*)dst);
+        }
+
+        ResizerFilter::ResizerFilter(const ResParam & param)
+            : Sse41::ResizerFilter(param)
+        {
+            if (_param.type == SimdResizeChannelByte)
+            {
+                _vertical = ResizerFilterVertical<uint8_t>;
+                _horizontal = ResizerFilterHorizontal<uint8_t>;
+            }
+            else
+            {
+                _vertical = ResizerFilterVertical<float>;
+                _horizontal = ResizerFilterHorizontal<float>;
+            }
+        }
+    }
+#endif //SIMD_AVX2_ENABLE
+}
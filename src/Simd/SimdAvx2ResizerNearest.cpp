@@ -0,0 +1,93 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        ResizerNearest::ResizerNearest(const ResParam & param)
+            : Sse41::ResizerNearest(param)
+            , _avx2(false)
+        {
+            Array32i offsets, indices;
+            for (size_t loads = 1; loads <= 2 && !_avx2; ++loads)
+            {
+                size_t pixels;
+                if (EstimateBlocks(A, 4, loads, pixels, offsets, indices))
+                {
+                    _avx2 = true;
+                    _loads = loads;
+                    _pixels = pixels;
+                    _offsets.Swap(offsets);
+                    _permute.Resize(indices.size * loads);
+                    for (size_t b = 0, blocks = _offsets.size / 2; b < blocks; ++b)
+                    {
+                        for (size_t i = 0; i < F; ++i)
+                        {
+                            int32_t idx = indices[b * F + i];
+                            _permute[b * loads * F + i] = Max(idx, 0) & (F - 1);
+                            if (loads > 1)
+                                _permute[b * loads * F + F + i] = idx >= int32_t(F) ? -1 : 0;
+                        }
+                    }
+                }
+            }
+        }
+
+        template<size_t loads> SIMD_INLINE __m256i ResizerNearestPermute(const uint8_t * src, const int32_t * permute)
+        {
+            __m256i _permute = _mm256_loadu_si256((__m256i*)permute);
+            __m256i value = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((__m256i*)src), _permute);
+            if (loads > 1)
+                value = _mm256_blendv_epi8(value, _mm256_permutevar8x32_epi32(_mm256_loadu_si256((__m256i*)src + 1), _permute), 
+                    _mm256_loadu_si256((__m256i*)permute + 1));
+            return value;
+        }
+
+        template<size_t loads> void ResizerNearestRow(const uint8_t * src, const int32_t * offsets, const int32_t * permute, size_t blocks, size_t tail, uint8_t * dst)
+        {
+            size_t b = 0, last = blocks - 1;
+            for (; b < last; ++b, offsets += 2, permute += loads * F)
+                _mm256_storeu_si256((__m256i*)(dst + offsets[0]), ResizerNearestPermute<loads>(src + offsets[1], permute));
+            uint8_t SIMD_ALIGNED(32) buffer[A];
+            _mm256_storeu_si256((__m256i*)buffer, ResizerNearestPermute<loads>(src + offsets[1], permute));
+            memcpy(dst + offsets[0], buffer, tail);
+        }
+
+        void ResizerNearest::RunRow(const uint8_t * src, uint8_t * dst)
+        {
+            size_t blocks = _offsets.size / 2, tail = _pixels * _pixelSize;
+            if (_avx2 && _loads == 1)
+                ResizerNearestRow<1>(src, _offsets.data, _permute.data, blocks, tail, dst);
+            else if (_avx2 && _loads == 2)
+                ResizerNearestRow<2>(src, _offsets.data, _permute.data, blocks, tail, dst);
+            else
+                Sse41::ResizerNearest::RunRow(src, dst);
+        }
+    }
+#endif //SIMD_AVX2_ENABLE
+}
@@ -478,9 +478,9 @@ namespace Simd
             SynetSetInput1Gray8(BgrToBlue(_rgb), scale[2], shift[2], dst + 2 * channel);
         }
 
-        template<SimdPixelFormatType format, size_t step> void SynetSetInputNchw3(const uint8_t * src, size_t width, size_t height, size_t stride, const float * scale, const float * shift, float * dst)
+        template<SimdPixelFormatType format, size_t step> void SynetSetInputNchw3(const uint8_t * src, size_t width, size_t height, size_t stride, const float * scale, const float * shift, float * dst, size_t channel)
         {
-            size_t aligned = AlignLo(width, A), channel = width * height;
+            size_t aligned = AlignLo(width, A);
             __m256 _scale[3], _shift[3];
             for (size_t i = 0; i < 3; ++i)
             {
@@ -607,8 +607,8 @@ namespace Simd
             }
         }
 
-        void SynetSetInput(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
-            const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat)
+        void SynetSetInputRows(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+            const float * lower, const float * upper, float * dst, size_t plane, size_t channels, SimdTensorFormatType dstFormat)
         {
             assert(width >= A);
 
@@ -633,10 +633,10 @@ namespace Simd
                 case SimdTensorFormatNchw:
                     switch (srcFormat)
                     {
-                    case SimdPixelFormatGray8: SynetSetInputNchw3<SimdPixelFormatGray8, 1>(src, width, height, stride, scale, lower, dst); return;
-                    case SimdPixelFormatBgr24: SynetSetInputNchw3<SimdPixelFormatBgr24, 3>(src, width, height, stride, scale, lower, dst); return;
-                    case SimdPixelFormatBgra32: SynetSetInputNchw3<SimdPixelFormatBgra32, 4>(src, width, height, stride, scale, lower, dst); return;
-                    case SimdPixelFormatRgb24: SynetSetInputNchw3<SimdPixelFormatRgb24, 3>(src, width, height, stride, scale, lower, dst); return;
+                    case SimdPixelFormatGray8: SynetSetInputNchw3<SimdPixelFormatGray8, 1>(src, width, height, stride, scale, lower, dst, plane); return;
+                    case SimdPixelFormatBgr24: SynetSetInputNchw3<SimdPixelFormatBgr24, 3>(src, width, height, stride, scale, lower, dst, plane); return;
+                    case SimdPixelFormatBgra32: SynetSetInputNchw3<SimdPixelFormatBgra32, 4>(src, width, height, stride, scale, lower, dst, plane); return;
+                    case SimdPixelFormatRgb24: SynetSetInputNchw3<SimdPixelFormatRgb24, 3>(src, width, height, stride, scale, lower, dst, plane); return;
                     default: assert(0);
                     }
                     break;
@@ -655,6 +655,51 @@ namespace Simd
             default: assert(0);
             }
         }
+
+        void SynetSetInput(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+            const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat)
+        {
+            SynetSetInputRows(src, width, height, stride, srcFormat, lower, upper, dst, width * height, channels, dstFormat);
+        }
+
+        //---------------------------------------------------------------------
+
+        void SynetSetInputBatchVertical(const uint8_t * src0, const uint8_t * src1, size_t size, float weight, float * dst)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m256 _weight = _mm256_set1_ps(weight);
+            for (; i < sizeF; i += F)
+            {
+                __m256 s0 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(src0 + i))));
+                __m256 s1 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(src1 + i))));
+                _mm256_storeu_ps(dst + i, _mm256_fmadd_ps(_mm256_sub_ps(s1, s0), _weight, s0));
+            }
+            for (; i < size; ++i)
+                dst[i] = float(src0[i]) + float(src1[i] - src0[i]) * weight;
+        }
+
+        void SynetSetInputBatchHorizontal(const float * src, const int32_t * offset, const float * weight, size_t width, size_t step, float coef, float shift, float * dst, bool accumulate)
+        {
+            size_t widthF = AlignLo(width, F), x = 0;
+            __m256 _coef = _mm256_set1_ps(coef), _shift = _mm256_set1_ps(shift);
+            for (; x < widthF; x += F)
+            {
+                __m256i _offset = _mm256_loadu_si256((__m256i*)(offset + x));
+                __m256 s0 = _mm256_i32gather_ps(src, _offset, 4);
+                __m256 s1 = _mm256_i32gather_ps(src + step, _offset, 4);
+                __m256 value = _mm256_fmadd_ps(_mm256_sub_ps(s1, s0), _mm256_loadu_ps(weight + x), s0);
+                _mm256_storeu_ps(dst + x, _mm256_fmadd_ps(value, _coef, accumulate ? _mm256_loadu_ps(dst + x) : _shift));
+            }
+            if (x < width)
+                Base::SynetSetInputBatchHorizontal(src, offset + x, weight + x, width - x, step, coef, shift, dst + x, accumulate);
+        }
+
+        void SynetSetInputBatch(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+            const float * rois, size_t count, size_t dstWidth, size_t dstHeight, const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat)
+        {
+            Base::SynetSetInputBatch(src, width, height, stride, srcFormat, rois, count, dstWidth, dstHeight, lower, upper, dst, channels, dstFormat,
+                SynetSetInputBatchVertical, SynetSetInputBatchHorizontal);
+        }
     }
 #endif//SIMD_AVX2_ENABLE
 }
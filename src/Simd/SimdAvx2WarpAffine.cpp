@@ -0,0 +1,252 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdWarpAffine.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        const __m256i K8_WARP_AFFINE_SHUFFLE = SIMD_MM256_SETR_EPI8(
+            0x0, -1, 0x1, -1, 0x4, -1, 0x5, -1, 0x8, -1, 0x9, -1, 0xC, -1, 0xD, -1,
+            0x0, -1, 0x1, -1, 0x4, -1, 0x5, -1, 0x8, -1, 0x9, -1, 0xC, -1, 0xD, -1);
+
+        SIMD_INLINE __m256i WarpAffineInside(__m256i x, __m256i y, __m256i w, __m256i h)
+        {
+            return _mm256_and_si256(_mm256_and_si256(_mm256_cmpgt_epi32(x, K_INV_ZERO), _mm256_cmpgt_epi32(w, x)),
+                _mm256_and_si256(_mm256_cmpgt_epi32(y, K_INV_ZERO), _mm256_cmpgt_epi32(h, y)));
+        }
+
+        SIMD_INLINE void WarpAffineStore8(__m256i value, uint8_t* dst)
+        {
+            static const __m256i PERMUTE = SIMD_MM256_SETR_EPI32(0, 4, 1, 1, 1, 1, 1, 1);
+            __m256i u8 = _mm256_packus_epi16(_mm256_packs_epi32(value, K_ZERO), K_ZERO);
+            _mm_storel_epi64((__m128i*)dst, _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(u8, PERMUTE)));
+        }
+
+        template<bool constant> SIMD_INLINE void WarpAffineNearestIndex(const int32_t* ax, const int32_t* ay, __m256i bx, __m256i by, __m256i w, __m256i h, __m256i s, __m256i ps, int32_t* index)
+        {
+            __m256i x = _mm256_srai_epi32(_mm256_add_epi32(_mm256_loadu_si256((__m256i*)ax), bx), Base::WARP_AFFINE_BITS);
+            __m256i y = _mm256_srai_epi32(_mm256_add_epi32(_mm256_loadu_si256((__m256i*)ay), by), Base::WARP_AFFINE_BITS);
+            if (constant)
+            {
+                __m256i offset = _mm256_add_epi32(_mm256_mullo_epi32(y, s), _mm256_mullo_epi32(x, ps));
+                _mm256_storeu_si256((__m256i*)index, _mm256_blendv_epi8(K_INV_ZERO, offset, WarpAffineInside(x, y, w, h)));
+            }
+            else
+            {
+                x = _mm256_min_epi32(_mm256_max_epi32(x, K_ZERO), w);
+                y = _mm256_min_epi32(_mm256_max_epi32(y, K_ZERO), h);
+                _mm256_storeu_si256((__m256i*)index, _mm256_add_epi32(_mm256_mullo_epi32(y, s), _mm256_mullo_epi32(x, ps)));
+            }
+        }
+
+        template<bool constant> void WarpAffineNearestIndex(const WarpAffParam& p, const int32_t* ax, const int32_t* ay, int32_t bx, int32_t by, int32_t* index)
+        {
+            __m256i _bx = _mm256_set1_epi32(bx + Base::WARP_AFFINE_ROUND);
+            __m256i _by = _mm256_set1_epi32(by + Base::WARP_AFFINE_ROUND);
+            __m256i w = _mm256_set1_epi32(constant ? (int)p.srcW : (int)p.srcW - 1);
+            __m256i h = _mm256_set1_epi32(constant ? (int)p.srcH : (int)p.srcH - 1);
+            __m256i s = _mm256_set1_epi32((int)p.srcS);
+            __m256i ps = _mm256_set1_epi32((int)p.PixelSize());
+            size_t width = p.dstW, widthF = AlignLo(width, F);
+            for (size_t x = 0; x < widthF; x += F)
+                WarpAffineNearestIndex<constant>(ax + x, ay + x, _bx, _by, w, h, s, ps, index + x);
+            if (widthF < width)
+                WarpAffineNearestIndex<constant>(ax + width - F, ay + width - F, _bx, _by, w, h, s, ps, index + width - F);
+        }
+
+        void WarpAffineNearestRow1(const WarpAffParam& p, const uint8_t* src, const int32_t* index, uint8_t* dst)
+        {
+            size_t width = p.dstW, widthF = AlignLo(width, F), x = 0;
+            __m256i safe = _mm256_set1_epi32((int)((p.srcH - 1) * p.srcS + p.srcW) - 4);
+            __m256i border = _mm256_set1_epi32(p.border[0]);
+            for (; x < widthF; x += F)
+            {
+                __m256i idx = _mm256_loadu_si256((__m256i*)(index + x));
+                if (!_mm256_testz_si256(_mm256_cmpgt_epi32(idx, safe), K_INV_ZERO))
+                    break;
+                __m256i val = _mm256_and_si256(_mm256_i32gather_epi32((int*)src, _mm256_max_epi32(idx, K_ZERO), 1), K32_000000FF);
+                WarpAffineStore8(_mm256_blendv_epi8(val, border, _mm256_cmpgt_epi32(K_ZERO, idx)), dst + x);
+            }
+            Base::WarpAffineNearestRow<1>(src, p.border, index, x, width, dst);
+        }
+
+        void WarpAffineNearestRow4(const WarpAffParam& p, const uint8_t* src, const int32_t* index, uint8_t* dst)
+        {
+            size_t width = p.dstW, widthF = AlignLo(width, F), x = 0;
+            __m256i border = _mm256_set1_epi32(*(int32_t*)p.border);
+            for (; x < widthF; x += F)
+            {
+                __m256i idx = _mm256_loadu_si256((__m256i*)(index + x));
+                __m256i mask = _mm256_cmpgt_epi32(idx, K_INV_ZERO);
+                _mm256_storeu_si256((__m256i*)(dst + 4 * x), _mm256_mask_i32gather_epi32(border, (int*)src, idx, mask, 1));
+            }
+            Base::WarpAffineNearestRow<4>(src, p.border, index, x, width, dst);
+        }
+
+        WarpAffineNearest::WarpAffineNearest(const WarpAffParam& param)
+            : Sse41::WarpAffineNearest(param)
+        {
+        }
+
+        void WarpAffineNearest::EstimateIndex(int32_t bx, int32_t by, int32_t* index)
+        {
+            if (_param.dstW < F)
+                Sse41::WarpAffineNearest::EstimateIndex(bx, by, index);
+            else if (_param.IsConstant())
+                WarpAffineNearestIndex<true>(_param, _ax.data, _ay.data, bx, by, index);
+            else
+                WarpAffineNearestIndex<false>(_param, _ax.data, _ay.data, bx, by, index);
+        }
+
+        void WarpAffineNearest::RunRow(const uint8_t* src, const int32_t* index, uint8_t* dst)
+        {
+            if (_param.PixelSize() == 1)
+                WarpAffineNearestRow1(_param, src, index, dst);
+            else if (_param.PixelSize() == 4)
+                WarpAffineNearestRow4(_param, src, index, dst);
+            else
+                Sse41::WarpAffineNearest::RunRow(src, index, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void WarpAffineBilinearIndex(const int32_t* ax, const int32_t* ay, __m256i bx, __m256i by, __m256i w, __m256i h, __m256i s, __m256i ps, int32_t* index, int32_t* xs, int32_t* ys)
+        {
+            __m256i fx = _mm256_add_epi32(_mm256_loadu_si256((__m256i*)ax), bx);
+            __m256i fy = _mm256_add_epi32(_mm256_loadu_si256((__m256i*)ay), by);
+            _mm256_storeu_si256((__m256i*)xs, fx);
+            _mm256_storeu_si256((__m256i*)ys, fy);
+            __m256i x = _mm256_srai_epi32(fx, Base::WARP_AFFINE_BITS);
+            __m256i y = _mm256_srai_epi32(fy, Base::WARP_AFFINE_BITS);
+            __m256i offset = _mm256_add_epi32(_mm256_mullo_epi32(y, s), _mm256_mullo_epi32(x, ps));
+            _mm256_storeu_si256((__m256i*)index, _mm256_blendv_epi8(K_INV_ZERO, offset, WarpAffineInside(x, y, w, h)));
+        }
+
+        void WarpAffineBilinearRowByte1(const WarpAffParam& p, const uint8_t* src, const int32_t* index, const int32_t* xs, const int32_t* ys, uint8_t* dst)
+        {
+            size_t width = p.dstW, widthF = AlignLo(width, F), x = 0;
+            __m256i safe = _mm256_set1_epi32((int)((p.srcH - 2) * p.srcS + p.srcW) - 4);
+            __m256i mask = _mm256_set1_epi32(Base::WARP_AFFINE_MASK), range = _mm256_set1_epi32(Base::WARP_AFFINE_RANGE);
+            __m256i round = _mm256_set1_epi32(Base::WARP_AFFINE_BILINEAR_ROUND);
+            const int* src1 = (const int*)(src + p.srcS);
+            for (; x < widthF; x += F)
+            {
+                __m256i idx = _mm256_loadu_si256((__m256i*)(index + x));
+                if (!_mm256_testz_si256(_mm256_or_si256(_mm256_cmpgt_epi32(idx, safe), _mm256_cmpgt_epi32(K_ZERO, idx)), K_INV_ZERO))
+                {
+                    Base::WarpAffineBilinearRow<uint8_t, 1>(p, src, index, xs, ys, x, x + F, dst);
+                    continue;
+                }
+                __m256i fx = _mm256_and_si256(_mm256_loadu_si256((__m256i*)(xs + x)), mask);
+                __m256i fy = _mm256_and_si256(_mm256_loadu_si256((__m256i*)(ys + x)), mask);
+                __m256i s0 = _mm256_i32gather_epi32((const int*)src, idx, 1);
+                __m256i s1 = _mm256_i32gather_epi32(src1, idx, 1);
+                __m256i kx = _mm256_or_si256(_mm256_slli_epi32(fx, 16), _mm256_sub_epi32(range, fx));
+                __m256i top = _mm256_madd_epi16(_mm256_shuffle_epi8(s0, K8_WARP_AFFINE_SHUFFLE), kx);
+                __m256i bot = _mm256_madd_epi16(_mm256_shuffle_epi8(s1, K8_WARP_AFFINE_SHUFFLE), kx);
+                __m256i sum = _mm256_add_epi32(_mm256_mullo_epi32(top, _mm256_sub_epi32(range, fy)), _mm256_mullo_epi32(bot, fy));
+                WarpAffineStore8(_mm256_srli_epi32(_mm256_add_epi32(sum, round), 2 * Base::WARP_AFFINE_BITS), dst + x);
+            }
+            Base::WarpAffineBilinearRow<uint8_t, 1>(p, src, index, xs, ys, x, width, dst);
+        }
+
+        void WarpAffineBilinearRowFloat1(const WarpAffParam& p, const uint8_t* src, const int32_t* index, const int32_t* xs, const int32_t* ys, uint8_t* dst)
+        {
+            size_t width = p.dstW, widthF = AlignLo(width, F), x = 0;
+            __m256i mask = _mm256_set1_epi32(Base::WARP_AFFINE_MASK);
+            __m256 scale = _mm256_set1_ps(1.0f / Base::WARP_AFFINE_RANGE);
+            const float* src00 = (const float*)src, * src01 = (const float*)(src + 4);
+            const float* src10 = (const float*)(src + p.srcS), * src11 = (const float*)(src + p.srcS + 4);
+            float* pd = (float*)dst;
+            for (; x < widthF; x += F)
+            {
+                __m256i idx = _mm256_loadu_si256((__m256i*)(index + x));
+                if (!_mm256_testz_si256(_mm256_cmpgt_epi32(K_ZERO, idx), K_INV_ZERO))
+                {
+                    Base::WarpAffineBilinearRow<float, 1>(p, src, index, xs, ys, x, x + F, dst);
+                    continue;
+                }
+                __m256 fx1 = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_mm256_loadu_si256((__m256i*)(xs + x)), mask)), scale);
+                __m256 fy1 = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_mm256_loadu_si256((__m256i*)(ys + x)), mask)), scale);
+                __m256 fx0 = _mm256_sub_ps(_mm256_set1_ps(1.0f), fx1), fy0 = _mm256_sub_ps(_mm256_set1_ps(1.0f), fy1);
+                __m256 top = _mm256_add_ps(_mm256_mul_ps(_mm256_i32gather_ps(src00, idx, 1), fx0), _mm256_mul_ps(_mm256_i32gather_ps(src01, idx, 1), fx1));
+                __m256 bot = _mm256_add_ps(_mm256_mul_ps(_mm256_i32gather_ps(src10, idx, 1), fx0), _mm256_mul_ps(_mm256_i32gather_ps(src11, idx, 1), fx1));
+                _mm256_storeu_ps(pd + x, _mm256_add_ps(_mm256_mul_ps(top, fy0), _mm256_mul_ps(bot, fy1)));
+            }
+            Base::WarpAffineBilinearRow<float, 1>(p, src, index, xs, ys, x, width, dst);
+        }
+
+        WarpAffineBilinear::WarpAffineBilinear(const WarpAffParam& param)
+            : Sse41::WarpAffineBilinear(param)
+        {
+        }
+
+        void WarpAffineBilinear::EstimateIndex(int32_t bx, int32_t by, int32_t* index, int32_t* xs, int32_t* ys)
+        {
+            size_t width = _param.dstW, widthF = AlignLo(width, F);
+            if (width < F)
+            {
+                Sse41::WarpAffineBilinear::EstimateIndex(bx, by, index, xs, ys);
+                return;
+            }
+            __m256i _bx = _mm256_set1_epi32(bx), _by = _mm256_set1_epi32(by);
+            __m256i w = _mm256_set1_epi32((int)_param.srcW - 1), h = _mm256_set1_epi32((int)_param.srcH - 1);
+            __m256i s = _mm256_set1_epi32((int)_param.srcS), ps = _mm256_set1_epi32((int)_param.PixelSize());
+            for (size_t x = 0; x < widthF; x += F)
+                WarpAffineBilinearIndex(_ax.data + x, _ay.data + x, _bx, _by, w, h, s, ps, index + x, xs + x, ys + x);
+            if (widthF < width)
+            {
+                size_t x = width - F;
+                WarpAffineBilinearIndex(_ax.data + x, _ay.data + x, _bx, _by, w, h, s, ps, index + x, xs + x, ys + x);
+            }
+        }
+
+        void WarpAffineBilinear::RunRow(const uint8_t* src, const int32_t* index, const int32_t* xs, const int32_t* ys, uint8_t* dst)
+        {
+            if (_param.channels == 1 && _param.IsByte())
+                WarpAffineBilinearRowByte1(_param, src, index, xs, ys, dst);
+            else if (_param.channels == 1)
+                WarpAffineBilinearRowFloat1(_param, src, index, xs, ys, dst);
+            else
+                Sse41::WarpAffineBilinear::RunRow(src, index, xs, ys, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            WarpAffParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, mat, flags, border, A);
+            if (mat == NULL || !param.Valid())
+                return NULL;
+            if (param.IsNearest())
+                return new WarpAffineNearest(param);
+            else
+                return new WarpAffineBilinear(param);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
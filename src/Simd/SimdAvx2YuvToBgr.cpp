@@ -24,6 +24,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdConversion.h"
+#include "Simd/SimdYuvToBgr.h"
 
 namespace Simd
 {
@@ -337,6 +338,428 @@ namespace Simd
             else
                 Yuv420pToRgb<false>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
         }
+
+        //---------------------------------------------------------------------
+
+        template<int sx> SIMD_INLINE __m256i LoadUv(const uint8_t * uv);
+
+        template<> SIMD_INLINE __m256i LoadUv<0>(const uint8_t * uv)
+        {
+            return _mm256_loadu_si256((__m256i*)uv);
+        }
+
+        template<> SIMD_INLINE __m256i LoadUv<1>(const uint8_t * uv)
+        {
+            __m256i _uv = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)uv));
+            return _mm256_or_si256(_uv, _mm256_slli_epi16(_uv, 8));
+        }
+
+        template<size_t N, bool rgb> SIMD_INLINE void StoreAny(__m256i b, __m256i g, __m256i r, __m256i a, uint8_t * dst);
+
+        template<> SIMD_INLINE void StoreAny<4, false>(__m256i b, __m256i g, __m256i r, __m256i a, uint8_t * dst)
+        {
+            __m256i bgLo = _mm256_unpacklo_epi8(b, g), bgHi = _mm256_unpackhi_epi8(b, g);
+            __m256i raLo = _mm256_unpacklo_epi8(r, a), raHi = _mm256_unpackhi_epi8(r, a);
+            __m256i q0 = _mm256_unpacklo_epi16(bgLo, raLo), q1 = _mm256_unpackhi_epi16(bgLo, raLo);
+            __m256i q2 = _mm256_unpacklo_epi16(bgHi, raHi), q3 = _mm256_unpackhi_epi16(bgHi, raHi);
+            _mm256_storeu_si256((__m256i*)dst + 0, _mm256_permute2x128_si256(q0, q1, 0x20));
+            _mm256_storeu_si256((__m256i*)dst + 1, _mm256_permute2x128_si256(q2, q3, 0x20));
+            _mm256_storeu_si256((__m256i*)dst + 2, _mm256_permute2x128_si256(q0, q1, 0x31));
+            _mm256_storeu_si256((__m256i*)dst + 3, _mm256_permute2x128_si256(q2, q3, 0x31));
+        }
+
+        template<> SIMD_INLINE void StoreAny<3, false>(__m256i b, __m256i g, __m256i r, __m256i a, uint8_t * dst)
+        {
+            _mm256_storeu_si256((__m256i*)dst + 0, InterleaveBgr<0>(b, g, r));
+            _mm256_storeu_si256((__m256i*)dst + 1, InterleaveBgr<1>(b, g, r));
+            _mm256_storeu_si256((__m256i*)dst + 2, InterleaveBgr<2>(b, g, r));
+        }
+
+        template<> SIMD_INLINE void StoreAny<3, true>(__m256i b, __m256i g, __m256i r, __m256i a, uint8_t * dst)
+        {
+            _mm256_storeu_si256((__m256i*)dst + 0, InterleaveBgr<0>(r, g, b));
+            _mm256_storeu_si256((__m256i*)dst + 1, InterleaveBgr<1>(r, g, b));
+            _mm256_storeu_si256((__m256i*)dst + 2, InterleaveBgr<2>(r, g, b));
+        }
+
+        template<class T, size_t N, bool rgb, int sx> SIMD_INLINE void YuvToAny(const uint8_t * y, const uint8_t * u, const uint8_t * v, __m256i a, uint8_t * dst)
+        {
+            __m256i b, g, r;
+            YuvToBgr<T>(_mm256_loadu_si256((__m256i*)y), LoadUv<sx>(u), LoadUv<sx>(v), b, g, r);
+            StoreAny<N, rgb>(b, g, r, a, dst);
+        }
+
+        template<class T, size_t N, bool rgb, int sx, int sy> void YuvToAnyV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride,
+            const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % (1 << sx) == 0) && (height % (1 << sy) == 0) && (width >= A));
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            __m256i _alpha = _mm256_set1_epi8(alpha);
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint8_t * u0 = u + (row >> sy) * uStride;
+                const uint8_t * v0 = v + (row >> sy) * vStride;
+                for (size_t col = 0; col < widthA; col += A)
+                    YuvToAny<T, N, rgb, sx>(y + col, u0 + (col >> sx), v0 + (col >> sx), _alpha, dst + col * N);
+                if (widthA != width)
+                    YuvToAny<T, N, rgb, sx>(y + tail, u0 + (tail >> sx), v0 + (tail >> sx), _alpha, dst + tail * N);
+                y += yStride;
+                dst += dstStride;
+            }
+        }
+
+        template<size_t N, bool rgb, int sx, int sy> void YuvToAnyV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride,
+            const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: YuvToAnyV2<Base::Bt601, N, rgb, sx, sy>(y, yStride, u, uStride, v, vStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: YuvToAnyV2<Base::Bt709, N, rgb, sx, sy>(y, yStride, u, uStride, v, vStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt601Full: YuvToAnyV2<Base::Bt601Full, N, rgb, sx, sy>(y, yStride, u, uStride, v, vStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709Full: YuvToAnyV2<Base::Bt709Full, N, rgb, sx, sy>(y, yStride, u, uStride, v, vStride, width, height, dst, dstStride, alpha); break;
+            default: assert(0);
+            }
+        }
+
+        void Yuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<4, false, 1, 1>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Yuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<4, false, 1, 0>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Yuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<4, false, 0, 0>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Yuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<3, false, 1, 1>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, 0, yuvType);
+        }
+
+        void Yuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<3, false, 1, 0>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, 0, yuvType);
+        }
+
+        void Yuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<3, false, 0, 0>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, 0, yuvType);
+        }
+
+        void Yuv420pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<3, true, 1, 1>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, 0, yuvType);
+        }
+
+        void Yuv422pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<3, true, 1, 0>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, 0, yuvType);
+        }
+
+        void Yuv444pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<3, true, 0, 0>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, 0, yuvType);
+        }
+
+        //---------------------------------------------------------------------
+
+        const __m256i K8_SHUFFLE_UV_TO_U = SIMD_MM256_SETR_EPI8(
+            0x0, 0x0, 0x2, 0x2, 0x4, 0x4, 0x6, 0x6, 0x8, 0x8, 0xA, 0xA, 0xC, 0xC, 0xE, 0xE,
+            0x0, 0x0, 0x2, 0x2, 0x4, 0x4, 0x6, 0x6, 0x8, 0x8, 0xA, 0xA, 0xC, 0xC, 0xE, 0xE);
+        const __m256i K8_SHUFFLE_UV_TO_V = SIMD_MM256_SETR_EPI8(
+            0x1, 0x1, 0x3, 0x3, 0x5, 0x5, 0x7, 0x7, 0x9, 0x9, 0xB, 0xB, 0xD, 0xD, 0xF, 0xF,
+            0x1, 0x1, 0x3, 0x3, 0x5, 0x5, 0x7, 0x7, 0x9, 0x9, 0xB, 0xB, 0xD, 0xD, 0xF, 0xF);
+
+        template<class T, size_t N, bool rgb, bool nv21> SIMD_INLINE void NvToAny(const uint8_t * y, const uint8_t * uv, __m256i a, uint8_t * dst)
+        {
+            __m256i _uv = _mm256_loadu_si256((__m256i*)uv), b, g, r;
+            __m256i u = _mm256_shuffle_epi8(_uv, nv21 ? K8_SHUFFLE_UV_TO_V : K8_SHUFFLE_UV_TO_U);
+            __m256i v = _mm256_shuffle_epi8(_uv, nv21 ? K8_SHUFFLE_UV_TO_U : K8_SHUFFLE_UV_TO_V);
+            YuvToBgr<T>(_mm256_loadu_si256((__m256i*)y), u, v, b, g, r);
+            StoreAny<N, rgb>(b, g, r, a, dst);
+        }
+
+        template<class T, size_t N, bool rgb, bool nv21> void NvToAny(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A));
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            __m256i _alpha = _mm256_set1_epi8(alpha);
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint8_t * uv0 = uv + (row >> 1) * uvStride;
+                for (size_t col = 0; col < widthA; col += A)
+                    NvToAny<T, N, rgb, nv21>(y + col, uv0 + col, _alpha, dst + col * N);
+                if (widthA != width)
+                    NvToAny<T, N, rgb, nv21>(y + tail, uv0 + tail, _alpha, dst + tail * N);
+                y += yStride;
+                dst += dstStride;
+            }
+        }
+
+        template<size_t N, bool rgb, bool nv21> void NvToAny(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: NvToAny<Base::Bt601, N, rgb, nv21>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: NvToAny<Base::Bt709, N, rgb, nv21>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt601Full: NvToAny<Base::Bt601Full, N, rgb, nv21>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709Full: NvToAny<Base::Bt709Full, N, rgb, nv21>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            default: assert(0);
+            }
+        }
+
+        void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            NvToAny<4, false, false>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            NvToAny<3, false, false>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, 0, yuvType);
+        }
+
+        void Nv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            NvToAny<3, true, false>(y, yStride, uv, uvStride, width, height, rgb, rgbStride, 0, yuvType);
+        }
+
+        void Nv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            NvToAny<4, false, true>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height,
+            uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            NvToAny<3, false, true>(y, yStride, vu, vuStride, width, height, bgr, bgrStride, 0, yuvType);
+        }
+
+        void Nv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height,
+            uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            NvToAny<3, true, true>(y, yStride, vu, vuStride, width, height, rgb, rgbStride, 0, yuvType);
+        }
+
+        //---------------------------------------------------------------------
+
+        const __m256i K8_SHUFFLE_YUYV_TO_YU = SIMD_MM256_SETR_EPI8(
+            0x0, 0x2, 0x4, 0x6, 0x8, 0xA, 0xC, 0xE, 0x1, 0x1, 0x5, 0x5, 0x9, 0x9, 0xD, 0xD,
+            0x0, 0x2, 0x4, 0x6, 0x8, 0xA, 0xC, 0xE, 0x1, 0x1, 0x5, 0x5, 0x9, 0x9, 0xD, 0xD);
+        const __m256i K8_SHUFFLE_YUYV_TO_V = SIMD_MM256_SETR_EPI8(
+            0x3, 0x3, 0x7, 0x7, 0xB, 0xB, 0xF, 0xF, -1, -1, -1, -1, -1, -1, -1, -1,
+            0x3, 0x3, 0x7, 0x7, 0xB, 0xB, 0xF, 0xF, -1, -1, -1, -1, -1, -1, -1, -1);
+        const __m256i K8_SHUFFLE_UYVY_TO_YU = SIMD_MM256_SETR_EPI8(
+            0x1, 0x3, 0x5, 0x7, 0x9, 0xB, 0xD, 0xF, 0x0, 0x0, 0x4, 0x4, 0x8, 0x8, 0xC, 0xC,
+            0x1, 0x3, 0x5, 0x7, 0x9, 0xB, 0xD, 0xF, 0x0, 0x0, 0x4, 0x4, 0x8, 0x8, 0xC, 0xC);
+        const __m256i K8_SHUFFLE_UYVY_TO_V = SIMD_MM256_SETR_EPI8(
+            0x2, 0x2, 0x6, 0x6, 0xA, 0xA, 0xE, 0xE, -1, -1, -1, -1, -1, -1, -1, -1,
+            0x2, 0x2, 0x6, 0x6, 0xA, 0xA, 0xE, 0xE, -1, -1, -1, -1, -1, -1, -1, -1);
+
+        template<class T, size_t N, bool rgb, bool uyvy> SIMD_INLINE void PackedYuvToAny(const uint8_t * src, __m256i a, uint8_t * dst)
+        {
+            __m256i src0 = _mm256_loadu_si256((__m256i*)src + 0), src1 = _mm256_loadu_si256((__m256i*)src + 1), b, g, r;
+            __m256i yu0 = _mm256_shuffle_epi8(src0, uyvy ? K8_SHUFFLE_UYVY_TO_YU : K8_SHUFFLE_YUYV_TO_YU);
+            __m256i yu1 = _mm256_shuffle_epi8(src1, uyvy ? K8_SHUFFLE_UYVY_TO_YU : K8_SHUFFLE_YUYV_TO_YU);
+            __m256i v0 = _mm256_shuffle_epi8(src0, uyvy ? K8_SHUFFLE_UYVY_TO_V : K8_SHUFFLE_YUYV_TO_V);
+            __m256i v1 = _mm256_shuffle_epi8(src1, uyvy ? K8_SHUFFLE_UYVY_TO_V : K8_SHUFFLE_YUYV_TO_V);
+            __m256i y = _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(yu0, yu1), 0xD8);
+            __m256i u = _mm256_permute4x64_epi64(_mm256_unpackhi_epi64(yu0, yu1), 0xD8);
+            __m256i v = _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(v0, v1), 0xD8);
+            YuvToBgr<T>(y, u, v, b, g, r);
+            StoreAny<N, rgb>(b, g, r, a, dst);
+        }
+
+        template<class T, size_t N, bool rgb, bool uyvy> void PackedYuvToAny(const uint8_t * src, size_t srcStride,
+            size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (width >= A));
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            __m256i _alpha = _mm256_set1_epi8(alpha);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    PackedYuvToAny<T, N, rgb, uyvy>(src + col * 2, _alpha, dst + col * N);
+                if (widthA != width)
+                    PackedYuvToAny<T, N, rgb, uyvy>(src + tail * 2, _alpha, dst + tail * N);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        template<size_t N, bool rgb, bool uyvy> void PackedYuvToAny(const uint8_t * src, size_t srcStride,
+            size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: PackedYuvToAny<Base::Bt601, N, rgb, uyvy>(src, srcStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: PackedYuvToAny<Base::Bt709, N, rgb, uyvy>(src, srcStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt601Full: PackedYuvToAny<Base::Bt601Full, N, rgb, uyvy>(src, srcStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709Full: PackedYuvToAny<Base::Bt709Full, N, rgb, uyvy>(src, srcStride, width, height, dst, dstStride, alpha); break;
+            default: assert(0);
+            }
+        }
+
+        void YuyvToBgra(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            PackedYuvToAny<4, false, false>(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void YuyvToBgr(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            PackedYuvToAny<3, false, false>(yuyv, yuyvStride, width, height, bgr, bgrStride, 0, yuvType);
+        }
+
+        void YuyvToRgb(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            PackedYuvToAny<3, true, false>(yuyv, yuyvStride, width, height, rgb, rgbStride, 0, yuvType);
+        }
+
+        void UyvyToBgra(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            PackedYuvToAny<4, false, true>(uyvy, uyvyStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void UyvyToBgr(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+            uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            PackedYuvToAny<3, false, true>(uyvy, uyvyStride, width, height, bgr, bgrStride, 0, yuvType);
+        }
+
+        void UyvyToRgb(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+            uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            PackedYuvToAny<3, true, true>(uyvy, uyvyStride, width, height, rgb, rgbStride, 0, yuvType);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m256i Uint16ToUint8(const uint16_t * src, __m128i shift)
+        {
+            __m256i lo = _mm256_min_epu16(_mm256_srl_epi16(_mm256_loadu_si256((__m256i*)src + 0), shift), K16_00FF);
+            __m256i hi = _mm256_min_epu16(_mm256_srl_epi16(_mm256_loadu_si256((__m256i*)src + 1), shift), K16_00FF);
+            return PackI16ToU8(lo, hi);
+        }
+
+        SIMD_INLINE __m256i Uint16ToUint8x2(const uint16_t * src, __m128i shift)
+        {
+            __m256i val = _mm256_min_epu16(_mm256_srl_epi16(_mm256_loadu_si256((__m256i*)src), shift), K16_00FF);
+            val = _mm256_packus_epi16(val, val);
+            return _mm256_unpacklo_epi8(val, val);
+        }
+
+        template<class T> SIMD_INLINE void Yuv420p16ToBgra(const uint16_t * y, const uint16_t * u, const uint16_t * v, __m128i shift, __m256i a, uint8_t * dst)
+        {
+            __m256i b, g, r;
+            YuvToBgr<T>(Uint16ToUint8(y, shift), Uint16ToUint8x2(u, shift), Uint16ToUint8x2(v, shift), b, g, r);
+            StoreAny<4, false>(b, g, r, a, dst);
+        }
+
+        template<class T> void Yuv420p16ToBgra(const uint16_t * y, size_t yStride, const uint16_t * u, size_t uStride, const uint16_t * v, size_t vStride,
+            size_t width, size_t height, int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A));
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            __m256i _alpha = _mm256_set1_epi8(alpha);
+            __m128i _shift = _mm_cvtsi32_si128(shift);
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint16_t * u0 = u + (row >> 1) * uStride;
+                const uint16_t * v0 = v + (row >> 1) * vStride;
+                for (size_t col = 0; col < widthA; col += A)
+                    Yuv420p16ToBgra<T>(y + col, u0 + col / 2, v0 + col / 2, _shift, _alpha, bgra + col * 4);
+                if (widthA != width)
+                    Yuv420p16ToBgra<T>(y + tail, u0 + tail / 2, v0 + tail / 2, _shift, _alpha, bgra + tail * 4);
+                y += yStride;
+                bgra += bgraStride;
+            }
+        }
+
+        void Yuv420p16ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            const uint16_t * y16 = (const uint16_t*)y, * u16 = (const uint16_t*)u, * v16 = (const uint16_t*)v;
+            yStride /= sizeof(uint16_t), uStride /= sizeof(uint16_t), vStride /= sizeof(uint16_t);
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420p16ToBgra<Base::Bt601>(y16, yStride, u16, uStride, v16, vStride, width, height, shift, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Yuv420p16ToBgra<Base::Bt709>(y16, yStride, u16, uStride, v16, vStride, width, height, shift, bgra, bgraStride, alpha); break;
+            case SimdYuvBt601Full: Yuv420p16ToBgra<Base::Bt601Full>(y16, yStride, u16, uStride, v16, vStride, width, height, shift, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709Full: Yuv420p16ToBgra<Base::Bt709Full>(y16, yStride, u16, uStride, v16, vStride, width, height, shift, bgra, bgraStride, alpha); break;
+            default: assert(0);
+            }
+        }
+
+        template<class T> SIMD_INLINE void P016ToBgra(const uint16_t * y, const uint16_t * uv, __m128i shift, __m256i a, uint8_t * dst)
+        {
+            __m256i _uv = Uint16ToUint8(uv, shift), b, g, r;
+            __m256i u = _mm256_shuffle_epi8(_uv, K8_SHUFFLE_UV_TO_U);
+            __m256i v = _mm256_shuffle_epi8(_uv, K8_SHUFFLE_UV_TO_V);
+            YuvToBgr<T>(Uint16ToUint8(y, shift), u, v, b, g, r);
+            StoreAny<4, false>(b, g, r, a, dst);
+        }
+
+        template<class T> void P016ToBgra(const uint16_t * y, size_t yStride, const uint16_t * uv, size_t uvStride,
+            size_t width, size_t height, int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A));
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            __m256i _alpha = _mm256_set1_epi8(alpha);
+            __m128i _shift = _mm_cvtsi32_si128(shift);
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint16_t * uv0 = uv + (row >> 1) * uvStride;
+                for (size_t col = 0; col < widthA; col += A)
+                    P016ToBgra<T>(y + col, uv0 + col, _shift, _alpha, bgra + col * 4);
+                if (widthA != width)
+                    P016ToBgra<T>(y + tail, uv0 + tail, _shift, _alpha, bgra + tail * 4);
+                y += yStride;
+                bgra += bgraStride;
+            }
+        }
+
+        void P016ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            const uint16_t * y16 = (const uint16_t*)y, * uv16 = (const uint16_t*)uv;
+            yStride /= sizeof(uint16_t), uvStride /= sizeof(uint16_t);
+            switch (yuvType)
+            {
+            case SimdYuvBt601: P016ToBgra<Base::Bt601>(y16, yStride, uv16, uvStride, width, height, shift, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: P016ToBgra<Base::Bt709>(y16, yStride, uv16, uvStride, width, height, shift, bgra, bgraStride, alpha); break;
+            case SimdYuvBt601Full: P016ToBgra<Base::Bt601Full>(y16, yStride, uv16, uvStride, width, height, shift, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709Full: P016ToBgra<Base::Bt709Full>(y16, yStride, uv16, uvStride, width, height, shift, bgra, bgraStride, alpha); break;
+            default: assert(0);
+            }
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
@@ -0,0 +1,191 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdColorSpace.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        /* Exact truncating division by 255 for values in [0, 2^20): the half offset keeps multiples of 255 from rounding down. */
+        SIMD_INLINE __m512i DivideBy255(__m512i value)
+        {
+            return _mm512_cvttps_epi32(_mm512_mul_ps(_mm512_add_ps(_mm512_cvtepi32_ps(value), _mm512_set1_ps(0.5f)), _mm512_set1_ps(1.0f / 255.0f)));
+        }
+
+        SIMD_INLINE __m512i HueDividend(__m512i blue, __m512i green, __m512i red, __m512i max, __m512i range)
+        {
+            __m512i range2 = _mm512_add_epi32(range, range), range4 = _mm512_add_epi32(range2, range2);
+            __m512i dividend = _mm512_add_epi32(_mm512_sub_epi32(red, green), range4);
+            dividend = _mm512_mask_blend_epi32(_mm512_cmpeq_epi32_mask(green, max), dividend, _mm512_add_epi32(_mm512_sub_epi32(blue, red), range2));
+            return _mm512_mask_blend_epi32(_mm512_cmpeq_epi32_mask(red, max), dividend, _mm512_add_epi32(_mm512_sub_epi32(green, blue), _mm512_add_epi32(range4, range2)));
+        }
+
+        SIMD_INLINE __m512i BgrToHue(__m512i blue, __m512i green, __m512i red, __m512i max, __m512i range)
+        {
+            __m512i dividend = HueDividend(blue, green, red, max, range);
+            __m512 hue = _mm512_div_ps(_mm512_mul_ps(_mm512_set1_ps(Base::KF_255_DIV_6), _mm512_cvtepi32_ps(dividend)), _mm512_cvtepi32_ps(range));
+            return _mm512_maskz_mov_epi32(_mm512_cmpneq_epi32_mask(range, K_ZERO), _mm512_cvttps_epi32(hue));
+        }
+
+        SIMD_INLINE void BgrToHsv(const uint8_t * bgr, uint8_t * hsv, __mmask64 tail)
+        {
+            __m512i blue, green, red;
+            LoadBgr32i(bgr, tail, blue, green, red);
+            __m512i max = _mm512_max_epi32(blue, _mm512_max_epi32(green, red));
+            __m512i range = _mm512_sub_epi32(max, _mm512_min_epi32(blue, _mm512_min_epi32(green, red)));
+            __m512i hue = BgrToHue(blue, green, red, max, range);
+            __m512 saturation = _mm512_div_ps(_mm512_cvtepi32_ps(_mm512_sub_epi32(_mm512_slli_epi32(range, 8), range)), _mm512_cvtepi32_ps(max));
+            StoreBgr32i(hsv, tail, hue, _mm512_maskz_mov_epi32(_mm512_cmpneq_epi32_mask(max, K_ZERO), _mm512_cvttps_epi32(saturation)), max);
+        }
+
+        void BgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
+        {
+            ColorSpace<BgrToHsv>(bgr, width, height, bgrStride, hsv, hsvStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void BgrToHsl(const uint8_t * bgr, uint8_t * hsl, __mmask64 tail)
+        {
+            __m512i blue, green, red;
+            LoadBgr32i(bgr, tail, blue, green, red);
+            __m512i max = _mm512_max_epi32(blue, _mm512_max_epi32(green, red));
+            __m512i min = _mm512_min_epi32(blue, _mm512_min_epi32(green, red));
+            __m512i range = _mm512_sub_epi32(max, min), sum = _mm512_add_epi32(max, min);
+            __m512i hue = BgrToHue(blue, green, red, max, range);
+            __m512i divisor = _mm512_min_epi32(sum, _mm512_sub_epi32(_mm512_set1_epi32(510), sum));
+            __m512 saturation = _mm512_div_ps(_mm512_cvtepi32_ps(_mm512_sub_epi32(_mm512_slli_epi32(range, 8), range)), _mm512_cvtepi32_ps(divisor));
+            StoreBgr32i(hsl, tail, hue, _mm512_maskz_mov_epi32(_mm512_cmpneq_epi32_mask(divisor, K_ZERO), _mm512_cvttps_epi32(saturation)), _mm512_srli_epi32(sum, 1));
+        }
+
+        void BgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride)
+        {
+            ColorSpace<BgrToHsl>(bgr, width, height, bgrStride, hsl, hslStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m512 BgrToHue32f(__m512i blue, __m512i green, __m512i red, __m512i max, __m512i range)
+        {
+            __m512i dividend = HueDividend(blue, green, red, max, range);
+            __m512 hue = _mm512_div_ps(_mm512_mul_ps(_mm512_set1_ps(60.0f), _mm512_cvtepi32_ps(dividend)), _mm512_cvtepi32_ps(range));
+            hue = _mm512_mask_sub_ps(hue, _mm512_cmp_ps_mask(hue, _mm512_set1_ps(360.0f), _CMP_GE_OQ), hue, _mm512_set1_ps(360.0f));
+            return _mm512_maskz_mov_ps(_mm512_cmpneq_epi32_mask(range, K_ZERO), hue);
+        }
+
+        SIMD_INLINE void BgrToHsv32f(const uint8_t * bgr, float * hsv, __mmask64 srcTail, const __mmask16 * dstTail)
+        {
+            __m512i blue, green, red;
+            LoadBgr32i(bgr, srcTail, blue, green, red);
+            __m512i max = _mm512_max_epi32(blue, _mm512_max_epi32(green, red));
+            __m512i range = _mm512_sub_epi32(max, _mm512_min_epi32(blue, _mm512_min_epi32(green, red)));
+            __m512 hue = BgrToHue32f(blue, green, red, max, range);
+            __m512 _max = _mm512_cvtepi32_ps(max);
+            __m512 saturation = _mm512_maskz_div_ps(_mm512_cmpneq_epi32_mask(max, K_ZERO), _mm512_cvtepi32_ps(range), _max);
+            StoreBgr32f(hsv, dstTail, hue, saturation, _mm512_mul_ps(_max, _mm512_set1_ps(1.0f / 255.0f)));
+        }
+
+        void BgrToHsv32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * hsv, size_t hsvStride)
+        {
+            ColorSpace32f<BgrToHsv32f>(bgr, width, height, bgrStride, hsv, hsvStride);
+        }
+
+        SIMD_INLINE void BgrToHsl32f(const uint8_t * bgr, float * hsl, __mmask64 srcTail, const __mmask16 * dstTail)
+        {
+            __m512i blue, green, red;
+            LoadBgr32i(bgr, srcTail, blue, green, red);
+            __m512i max = _mm512_max_epi32(blue, _mm512_max_epi32(green, red));
+            __m512i min = _mm512_min_epi32(blue, _mm512_min_epi32(green, red));
+            __m512i range = _mm512_sub_epi32(max, min), sum = _mm512_add_epi32(max, min);
+            __m512 hue = BgrToHue32f(blue, green, red, max, range);
+            __m512i divisor = _mm512_min_epi32(sum, _mm512_sub_epi32(_mm512_set1_epi32(510), sum));
+            __m512 saturation = _mm512_maskz_div_ps(_mm512_cmpneq_epi32_mask(divisor, K_ZERO), _mm512_cvtepi32_ps(range), _mm512_cvtepi32_ps(divisor));
+            StoreBgr32f(hsl, dstTail, hue, saturation, _mm512_mul_ps(_mm512_cvtepi32_ps(sum), _mm512_set1_ps(1.0f / 510.0f)));
+        }
+
+        void BgrToHsl32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * hsl, size_t hslStride)
+        {
+            ColorSpace32f<BgrToHsl32f>(bgr, width, height, bgrStride, hsl, hslStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void HueToBgr(__m512i hue, __m512i min, __m512i max, uint8_t * bgr, __mmask64 tail)
+        {
+            __m512i hue6 = _mm512_add_epi32(_mm512_slli_epi32(hue, 2), _mm512_slli_epi32(hue, 1));
+            __m512i sector = DivideBy255(hue6);
+            __m512i delta = DivideBy255(_mm512_mullo_epi32(_mm512_sub_epi32(max, min), _mm512_sub_epi32(hue6, _mm512_sub_epi32(_mm512_slli_epi32(sector, 8), sector))));
+            __m512i up = _mm512_add_epi32(min, delta), down = _mm512_sub_epi32(max, delta);
+            __mmask16 s1 = _mm512_cmpeq_epi32_mask(sector, _mm512_set1_epi32(1));
+            __mmask16 s2 = _mm512_cmpeq_epi32_mask(sector, _mm512_set1_epi32(2));
+            __mmask16 s3 = _mm512_cmpeq_epi32_mask(sector, _mm512_set1_epi32(3));
+            __mmask16 s4 = _mm512_cmpeq_epi32_mask(sector, _mm512_set1_epi32(4));
+            __mmask16 s5 = _mm512_cmpeq_epi32_mask(sector, _mm512_set1_epi32(5));
+            __m512i blue = _mm512_mask_blend_epi32(s2, min, up);
+            blue = _mm512_mask_blend_epi32(s3 | s4, blue, max);
+            blue = _mm512_mask_blend_epi32(s5, blue, down);
+            __m512i green = _mm512_mask_blend_epi32(s1 | s2, up, max);
+            green = _mm512_mask_blend_epi32(s3, green, down);
+            green = _mm512_mask_blend_epi32(s4 | s5, green, min);
+            __m512i red = _mm512_mask_blend_epi32(s1, max, down);
+            red = _mm512_mask_blend_epi32(s2 | s3, red, min);
+            red = _mm512_mask_blend_epi32(s4, red, up);
+            StoreBgr32i(bgr, tail, blue, green, red);
+        }
+
+        SIMD_INLINE void HsvToBgr(const uint8_t * hsv, uint8_t * bgr, __mmask64 tail)
+        {
+            __m512i hue, saturation, value;
+            LoadBgr32i(hsv, tail, hue, saturation, value);
+            __m512i min = DivideBy255(_mm512_mullo_epi32(_mm512_sub_epi32(K32_000000FF, saturation), value));
+            HueToBgr(hue, min, value, bgr, tail);
+        }
+
+        void HsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride)
+        {
+            ColorSpace<HsvToBgr>(hsv, width, height, hsvStride, bgr, bgrStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void HslToBgr(const uint8_t * hsl, uint8_t * bgr, __mmask64 tail)
+        {
+            __m512i hue, saturation, lightness;
+            LoadBgr32i(hsl, tail, hue, saturation, lightness);
+            __m512i dark = DivideBy255(_mm512_mullo_epi32(lightness, _mm512_add_epi32(K32_000000FF, saturation)));
+            __m512i light = DivideBy255(_mm512_add_epi32(_mm512_mullo_epi32(_mm512_sub_epi32(K32_000000FF, lightness), saturation),
+                _mm512_sub_epi32(_mm512_slli_epi32(lightness, 8), lightness)));
+            __m512i max = _mm512_mask_blend_epi32(_mm512_cmpgt_epi32_mask(lightness, _mm512_set1_epi32(128)), dark, light);
+            __m512i min = DivideBy255(_mm512_mullo_epi32(_mm512_sub_epi32(K32_000000FF, saturation), max));
+            HueToBgr(hue, min, max, bgr, tail);
+        }
+
+        void HslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride)
+        {
+            ColorSpace<HslToBgr>(hsl, width, height, hslStride, bgr, bgrStride);
+        }
+    }
+#endif//SIMD_AVX512BW_ENABLE
+}
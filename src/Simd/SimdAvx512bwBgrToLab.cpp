@@ -0,0 +1,142 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdColorSpace.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        SIMD_INLINE __m512 Gather(const float * table, __m512i index)
+        {
+            return _mm512_i32gather_ps(index, table, 4);
+        }
+
+        SIMD_INLINE __m512i Gather(const int32_t * table, __m512i index)
+        {
+            return _mm512_i32gather_epi32(index, table, 4);
+        }
+
+        SIMD_INLINE __m512i RestrictRange8u(__m512i value)
+        {
+            return _mm512_min_epi32(_mm512_max_epi32(value, K_ZERO), K32_000000FF);
+        }
+
+        SIMD_INLINE __m512 LabCbrt(__m512 value)
+        {
+            __m512 t = _mm512_mul_ps(_mm512_max_ps(_mm512_setzero_ps(), _mm512_min_ps(_mm512_set1_ps(1.0f), value)), _mm512_set1_ps((float)Base::LAB_CBRT_TABLE_SIZE));
+            __m512i i = _mm512_min_epi32(_mm512_cvttps_epi32(t), _mm512_set1_epi32(Base::LAB_CBRT_TABLE_SIZE - 1));
+            __m512 f = _mm512_sub_ps(t, _mm512_cvtepi32_ps(i));
+            __m512 c0 = Gather(Base::LAB_TABLES.cbrt, i);
+            __m512 c1 = Gather(Base::LAB_TABLES.cbrt + 1, i);
+            return _mm512_add_ps(c0, _mm512_mul_ps(_mm512_sub_ps(c1, c0), f));
+        }
+
+        SIMD_INLINE __m512 Dot(__m512 r, __m512 g, __m512 b, float kr, float kg, float kb)
+        {
+            return _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(r, _mm512_set1_ps(kr)), _mm512_mul_ps(g, _mm512_set1_ps(kg))), _mm512_mul_ps(b, _mm512_set1_ps(kb)));
+        }
+
+        SIMD_INLINE void LabF(__m512 b, __m512 g, __m512 r, __m512 & fx, __m512 & fy, __m512 & fz)
+        {
+            fx = LabCbrt(Dot(r, g, b, Base::LAB_XR, Base::LAB_XG, Base::LAB_XB));
+            fy = LabCbrt(Dot(r, g, b, Base::LAB_YR, Base::LAB_YG, Base::LAB_YB));
+            fz = LabCbrt(Dot(r, g, b, Base::LAB_ZR, Base::LAB_ZG, Base::LAB_ZB));
+        }
+
+        SIMD_INLINE void BgrToLab(const uint8_t * bgr, uint8_t * lab, __mmask64 tail)
+        {
+            __m512i blue, green, red;
+            LoadBgr32i(bgr, tail, blue, green, red);
+            __m512 b = Gather(Base::LAB_TABLES.gamma, blue);
+            __m512 g = Gather(Base::LAB_TABLES.gamma, green);
+            __m512 r = Gather(Base::LAB_TABLES.gamma, red);
+            __m512 fx, fy, fz;
+            LabF(b, g, r, fx, fy, fz);
+            __m512i l = _mm512_cvtps_epi32(_mm512_sub_ps(_mm512_mul_ps(fy, _mm512_set1_ps(Base::LAB_L_SCALE)), _mm512_set1_ps(Base::LAB_L_SHIFT)));
+            __m512i a = _mm512_cvtps_epi32(_mm512_add_ps(_mm512_mul_ps(_mm512_sub_ps(fx, fy), _mm512_set1_ps(Base::LAB_A_SCALE)), _mm512_set1_ps(Base::LAB_AB_SHIFT)));
+            __m512i _b = _mm512_cvtps_epi32(_mm512_add_ps(_mm512_mul_ps(_mm512_sub_ps(fy, fz), _mm512_set1_ps(Base::LAB_B_SCALE)), _mm512_set1_ps(Base::LAB_AB_SHIFT)));
+            StoreBgr32i(lab, tail, RestrictRange8u(l), RestrictRange8u(a), RestrictRange8u(_b));
+        }
+
+        void BgrToLab(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride)
+        {
+            ColorSpace<BgrToLab>(bgr, width, height, bgrStride, lab, labStride);
+        }
+
+        SIMD_INLINE void BgrToLab32f(const uint8_t * bgr, float * lab, __mmask64 srcTail, const __mmask16 * dstTail)
+        {
+            __m512i blue, green, red;
+            LoadBgr32i(bgr, srcTail, blue, green, red);
+            __m512 fx, fy, fz;
+            LabF(Gather(Base::LAB_TABLES.gamma, blue), Gather(Base::LAB_TABLES.gamma, green), Gather(Base::LAB_TABLES.gamma, red), fx, fy, fz);
+            __m512 l = _mm512_sub_ps(_mm512_mul_ps(fy, _mm512_set1_ps(Base::LAB_L_SCALE_32F)), _mm512_set1_ps(Base::LAB_L_SHIFT_32F));
+            __m512 a = _mm512_mul_ps(_mm512_sub_ps(fx, fy), _mm512_set1_ps(Base::LAB_A_SCALE));
+            __m512 _b = _mm512_mul_ps(_mm512_sub_ps(fy, fz), _mm512_set1_ps(Base::LAB_B_SCALE));
+            StoreBgr32f(lab, dstTail, l, a, _b);
+        }
+
+        void BgrToLab32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * lab, size_t labStride)
+        {
+            ColorSpace32f<BgrToLab32f>(bgr, width, height, bgrStride, lab, labStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m512 LabInvF(__m512 f)
+        {
+            __m512 cube = _mm512_mul_ps(_mm512_mul_ps(f, f), f);
+            __m512 linear = _mm512_mul_ps(_mm512_sub_ps(f, _mm512_set1_ps(Base::LAB_F_SHIFT)), _mm512_set1_ps(Base::LAB_F_LINEAR));
+            return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(f, _mm512_set1_ps(Base::LAB_F_THRESHOLD), _CMP_GT_OQ), linear, cube);
+        }
+
+        SIMD_INLINE __m512i LabToSrgb(__m512 value)
+        {
+            __m512 index = _mm512_mul_ps(_mm512_max_ps(_mm512_setzero_ps(), _mm512_min_ps(_mm512_set1_ps(1.0f), value)), _mm512_set1_ps((float)Base::LAB_SRGB_TABLE_SIZE));
+            return Gather(Base::LAB_TABLES.srgb, _mm512_cvtps_epi32(index));
+        }
+
+        SIMD_INLINE void LabToBgr(const uint8_t * lab, uint8_t * bgr, __mmask64 tail)
+        {
+            __m512i l, a, b;
+            LoadBgr32i(lab, tail, l, a, b);
+            __m512 fy = _mm512_add_ps(_mm512_mul_ps(_mm512_cvtepi32_ps(l), _mm512_set1_ps(Base::LAB_INV_L_SCALE)), _mm512_set1_ps(Base::LAB_F_SHIFT));
+            __m512 fx = _mm512_add_ps(fy, _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_sub_epi32(a, _mm512_set1_epi32(128))), _mm512_set1_ps(Base::LAB_INV_A_SCALE)));
+            __m512 fz = _mm512_sub_ps(fy, _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_sub_epi32(b, _mm512_set1_epi32(128))), _mm512_set1_ps(Base::LAB_INV_B_SCALE)));
+            __m512 x = _mm512_mul_ps(LabInvF(fx), _mm512_set1_ps(Base::LAB_WHITE_X));
+            __m512 y = LabInvF(fy);
+            __m512 z = _mm512_mul_ps(LabInvF(fz), _mm512_set1_ps(Base::LAB_WHITE_Z));
+            __m512i blue = LabToSrgb(Dot(x, y, z, Base::LAB_BX, Base::LAB_BY, Base::LAB_BZ));
+            __m512i green = LabToSrgb(Dot(x, y, z, Base::LAB_GX, Base::LAB_GY, Base::LAB_GZ));
+            __m512i red = LabToSrgb(Dot(x, y, z, Base::LAB_RX, Base::LAB_RY, Base::LAB_RZ));
+            StoreBgr32i(bgr, tail, blue, green, red);
+        }
+
+        void LabToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride)
+        {
+            ColorSpace<LabToBgr>(lab, width, height, labStride, bgr, bgrStride);
+        }
+    }
+#endif//SIMD_AVX512BW_ENABLE
+}
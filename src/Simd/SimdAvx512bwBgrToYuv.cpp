@@ -24,6 +24,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdConversion.h"
+#include "Simd/SimdYuvToBgr.h"
 
 namespace Simd
 {
@@ -258,6 +259,224 @@ namespace Simd
             else
                 BgrToYuv444p<false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
         }
+
+        //---------------------------------------------------------------------
+
+        const __m512i K8_SHUFFLE_BGRA_TO_PLANES = SIMD_MM512_SETR_EPI8(
+            0x0, 0x4, 0x8, 0xC, 0x1, 0x5, 0x9, 0xD, 0x2, 0x6, 0xA, 0xE, 0x3, 0x7, 0xB, 0xF,
+            0x0, 0x4, 0x8, 0xC, 0x1, 0x5, 0x9, 0xD, 0x2, 0x6, 0xA, 0xE, 0x3, 0x7, 0xB, 0xF,
+            0x0, 0x4, 0x8, 0xC, 0x1, 0x5, 0x9, 0xD, 0x2, 0x6, 0xA, 0xE, 0x3, 0x7, 0xB, 0xF,
+            0x0, 0x4, 0x8, 0xC, 0x1, 0x5, 0x9, 0xD, 0x2, 0x6, 0xA, 0xE, 0x3, 0x7, 0xB, 0xF);
+        const __m512i K8_SHUFFLE_BGR_TO_PLANES = SIMD_MM512_SETR_EPI8(
+            0x0, 0x3, 0x6, 0x9, 0x1, 0x4, 0x7, 0xA, 0x2, 0x5, 0x8, 0xB, -1, -1, -1, -1,
+            0x0, 0x3, 0x6, 0x9, 0x1, 0x4, 0x7, 0xA, 0x2, 0x5, 0x8, 0xB, -1, -1, -1, -1,
+            0x0, 0x3, 0x6, 0x9, 0x1, 0x4, 0x7, 0xA, 0x2, 0x5, 0x8, 0xB, -1, -1, -1, -1,
+            0x0, 0x3, 0x6, 0x9, 0x1, 0x4, 0x7, 0xA, 0x2, 0x5, 0x8, 0xB, -1, -1, -1, -1);
+        const __m512i K32_PERMUTE_PLANES = SIMD_MM512_SETR_EPI32(0x0, 0x4, 0x8, 0xC, 0x1, 0x5, 0x9, 0xD, 0x2, 0x6, 0xA, 0xE, 0x3, 0x7, 0xB, 0xF);
+
+        SIMD_INLINE void PlanesToBgr(__m512i x0, __m512i x1, __m512i x2, __m512i x3, __m512i & b, __m512i & g, __m512i & r)
+        {
+            __m512i bg01 = _mm512_unpacklo_epi32(x0, x1), ra01 = _mm512_unpackhi_epi32(x0, x1);
+            __m512i bg23 = _mm512_unpacklo_epi32(x2, x3), ra23 = _mm512_unpackhi_epi32(x2, x3);
+            b = _mm512_permutexvar_epi32(K32_PERMUTE_PLANES, _mm512_unpacklo_epi64(bg01, bg23));
+            g = _mm512_permutexvar_epi32(K32_PERMUTE_PLANES, _mm512_unpackhi_epi64(bg01, bg23));
+            r = _mm512_permutexvar_epi32(K32_PERMUTE_PLANES, _mm512_unpacklo_epi64(ra01, ra23));
+        }
+
+        template<size_t N> SIMD_INLINE void LoadAny(const uint8_t * src, __m512i & b, __m512i & g, __m512i & r);
+
+        template<> SIMD_INLINE void LoadAny<3>(const uint8_t * src, __m512i & b, __m512i & g, __m512i & r)
+        {
+            __m512i bgr0 = _mm512_loadu_si512((__m512i*)src + 0);
+            __m512i bgr1 = _mm512_loadu_si512((__m512i*)src + 1);
+            __m512i bgr2 = _mm512_loadu_si512((__m512i*)src + 2);
+            __m512i x0 = _mm512_shuffle_epi8(_mm512_permutexvar_epi32(K32_PERMUTE_BGR_TO_BGRA_0, bgr0), K8_SHUFFLE_BGR_TO_PLANES);
+            __m512i x1 = _mm512_shuffle_epi8(_mm512_permutex2var_epi32(bgr0, K32_PERMUTE_BGR_TO_BGRA_1, bgr1), K8_SHUFFLE_BGR_TO_PLANES);
+            __m512i x2 = _mm512_shuffle_epi8(_mm512_permutex2var_epi32(bgr1, K32_PERMUTE_BGR_TO_BGRA_2, bgr2), K8_SHUFFLE_BGR_TO_PLANES);
+            __m512i x3 = _mm512_shuffle_epi8(_mm512_permutexvar_epi32(K32_PERMUTE_BGR_TO_BGRA_3, bgr2), K8_SHUFFLE_BGR_TO_PLANES);
+            PlanesToBgr(x0, x1, x2, x3, b, g, r);
+        }
+
+        template<> SIMD_INLINE void LoadAny<4>(const uint8_t * src, __m512i & b, __m512i & g, __m512i & r)
+        {
+            __m512i x0 = _mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src + 0), K8_SHUFFLE_BGRA_TO_PLANES);
+            __m512i x1 = _mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src + 1), K8_SHUFFLE_BGRA_TO_PLANES);
+            __m512i x2 = _mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src + 2), K8_SHUFFLE_BGRA_TO_PLANES);
+            __m512i x3 = _mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src + 3), K8_SHUFFLE_BGRA_TO_PLANES);
+            PlanesToBgr(x0, x1, x2, x3, b, g, r);
+        }
+
+        SIMD_INLINE __m512i PackI16ToU8(__m512i lo, __m512i hi)
+        {
+            return _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _mm512_packus_epi16(lo, hi));
+        }
+
+        template<class T, size_t N, int sy> SIMD_INLINE void AnyToYuv2x(const uint8_t * src, size_t srcStride, uint8_t * y, size_t yStride, __m512i & u, __m512i & v)
+        {
+            __m512i b, g, r, b16[2], g16[2], r16[2];
+            for (size_t i = 0; i < 2; ++i)
+            {
+                b16[i] = _mm512_set1_epi16(1 << sy), g16[i] = b16[i], r16[i] = b16[i];
+                for (size_t dy = 0; dy < (size_t(1) << sy); ++dy)
+                {
+                    LoadAny<N>(src + dy * srcStride + i * A * N, b, g, r);
+                    _mm512_storeu_si512((__m512i*)(y + dy * yStride + i * A), BgrToY8<T>(b, g, r));
+                    b16[i] = _mm512_add_epi16(b16[i], _mm512_maddubs_epi16(b, K8_01));
+                    g16[i] = _mm512_add_epi16(g16[i], _mm512_maddubs_epi16(g, K8_01));
+                    r16[i] = _mm512_add_epi16(r16[i], _mm512_maddubs_epi16(r, K8_01));
+                }
+                b16[i] = _mm512_srli_epi16(b16[i], 1 + sy);
+                g16[i] = _mm512_srli_epi16(g16[i], 1 + sy);
+                r16[i] = _mm512_srli_epi16(r16[i], 1 + sy);
+            }
+            u = PackI16ToU8(BgrToU16<T>(b16[0], g16[0], r16[0]), BgrToU16<T>(b16[1], g16[1], r16[1]));
+            v = PackI16ToU8(BgrToV16<T>(b16[0], g16[0], r16[0]), BgrToV16<T>(b16[1], g16[1], r16[1]));
+        }
+
+        template<class T, size_t N, int sx, int sy> SIMD_INLINE void AnyToYuv(const uint8_t * src, size_t srcStride, uint8_t * y, size_t yStride, uint8_t * u, uint8_t * v)
+        {
+            __m512i b, g, r;
+            if (sx == 0)
+            {
+                LoadAny<N>(src, b, g, r);
+                _mm512_storeu_si512((__m512i*)y, BgrToY8<T>(b, g, r));
+                _mm512_storeu_si512((__m512i*)u, BgrToU8<T>(b, g, r));
+                _mm512_storeu_si512((__m512i*)v, BgrToV8<T>(b, g, r));
+            }
+            else
+            {
+                __m512i _u, _v;
+                AnyToYuv2x<T, N, sy>(src, srcStride, y, yStride, _u, _v);
+                _mm512_storeu_si512((__m512i*)u, _u);
+                _mm512_storeu_si512((__m512i*)v, _v);
+            }
+        }
+
+        template<class T, size_t N, int sx, int sy> void AnyToYuvV2(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            const size_t step = A << sx;
+            assert((width % (1 << sx) == 0) && (height % (1 << sy) == 0) && (width >= step));
+
+            size_t widthS = AlignLo(width, step), tail = width - step;
+            for (size_t row = 0; row < height; row += size_t(1) << sy)
+            {
+                for (size_t col = 0; col < widthS; col += step)
+                    AnyToYuv<T, N, sx, sy>(src + col * N, srcStride, y + col, yStride, u + (col >> sx), v + (col >> sx));
+                if (widthS != width)
+                    AnyToYuv<T, N, sx, sy>(src + tail * N, srcStride, y + tail, yStride, u + (tail >> sx), v + (tail >> sx));
+                src += srcStride << sy;
+                y += yStride << sy;
+                u += uStride;
+                v += vStride;
+            }
+        }
+
+        template<size_t N, int sx, int sy> void AnyToYuvV2(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: AnyToYuvV2<Base::Bt601, N, sx, sy>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: AnyToYuvV2<Base::Bt709, N, sx, sy>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: AnyToYuvV2<Base::Bt601Full, N, sx, sy>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: AnyToYuvV2<Base::Bt709Full, N, sx, sy>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            default: assert(0);
+            }
+        }
+
+        void BgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            AnyToYuvV2<3, 1, 1>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        void BgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            AnyToYuvV2<3, 1, 0>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        void BgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            AnyToYuvV2<3, 0, 0>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        void BgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            AnyToYuvV2<4, 1, 1>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        void BgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            AnyToYuvV2<4, 1, 0>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        void BgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            AnyToYuvV2<4, 0, 0>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        //---------------------------------------------------------------------
+
+        const __m512i K64_PERMUTE_UV_0 = SIMD_MM512_SETR_EPI64(0x0, 0x1, 0x8, 0x9, 0x2, 0x3, 0xA, 0xB);
+        const __m512i K64_PERMUTE_UV_1 = SIMD_MM512_SETR_EPI64(0x4, 0x5, 0xC, 0xD, 0x6, 0x7, 0xE, 0xF);
+
+        template<class T, size_t N> SIMD_INLINE void AnyToNv12(const uint8_t * src, size_t srcStride, uint8_t * y, size_t yStride, uint8_t * uv)
+        {
+            __m512i u, v;
+            AnyToYuv2x<T, N, 1>(src, srcStride, y, yStride, u, v);
+            __m512i lo = _mm512_unpacklo_epi8(u, v), hi = _mm512_unpackhi_epi8(u, v);
+            _mm512_storeu_si512((__m512i*)uv + 0, _mm512_permutex2var_epi64(lo, K64_PERMUTE_UV_0, hi));
+            _mm512_storeu_si512((__m512i*)uv + 1, _mm512_permutex2var_epi64(lo, K64_PERMUTE_UV_1, hi));
+        }
+
+        template<class T, size_t N> void AnyToNv12(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA));
+
+            size_t widthDA = AlignLo(width, DA), tail = width - DA;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < widthDA; col += DA)
+                    AnyToNv12<T, N>(src + col * N, srcStride, y + col, yStride, uv + col);
+                if (widthDA != width)
+                    AnyToNv12<T, N>(src + tail * N, srcStride, y + tail, yStride, uv + tail);
+                src += 2 * srcStride;
+                y += 2 * yStride;
+                uv += uvStride;
+            }
+        }
+
+        template<size_t N> void AnyToNv12(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: AnyToNv12<Base::Bt601, N>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709: AnyToNv12<Base::Bt709, N>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt601Full: AnyToNv12<Base::Bt601Full, N>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709Full: AnyToNv12<Base::Bt709Full, N>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            default: assert(0);
+            }
+        }
+
+        void BgraToNv12(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            AnyToNv12<4>(bgra, width, height, bgraStride, y, yStride, uv, uvStride, yuvType);
+        }
+
+        void BgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            AnyToNv12<3>(bgr, width, height, bgrStride, y, yStride, uv, uvStride, yuvType);
+        }
     }
 #endif// SIMD_AVX512BW_ENABLE
 }
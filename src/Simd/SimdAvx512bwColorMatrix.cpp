@@ -0,0 +1,144 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdColorSpace.h"
+#include "Simd/SimdColorMatrix.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        SIMD_INLINE __m512i Gather(const int32_t * table, __m512i index)
+        {
+            return _mm512_i32gather_epi32(index, table, 4);
+        }
+
+        struct ColorMatrixConst
+        {
+            __m512i bg[3], r[3], offset[3];
+            __m512 m[3][4];
+
+            SIMD_INLINE ColorMatrixConst(const Base::ColorMatrixCoefs & coefs)
+            {
+                for (int c = 0; c < 3; ++c)
+                {
+                    bg[c] = _mm512_set1_epi32((coefs.fixed[c][0] & 0xFFFF) | (coefs.fixed[c][1] << 16));
+                    r[c] = _mm512_set1_epi32(coefs.fixed[c][2] & 0xFFFF);
+                    offset[c] = _mm512_set1_epi32(coefs.fixed[c][3]);
+                    for (int k = 0; k < 4; ++k)
+                        m[c][k] = _mm512_set1_ps(coefs.floats[c][k]);
+                }
+            }
+        };
+
+        template<bool precise, bool gamma> SIMD_INLINE void ColorMatrixPixels(const Base::ColorMatrixCoefs & coefs, const ColorMatrixConst & k, __m512i & b, __m512i & g, __m512i & r)
+        {
+            __m512i dst[3];
+            if (precise)
+            {
+                __m512 _b = _mm512_cvtepi32_ps(b), _g = _mm512_cvtepi32_ps(g), _r = _mm512_cvtepi32_ps(r);
+                for (int c = 0; c < 3; ++c)
+                {
+                    __m512 value = _mm512_add_ps(_mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(_b, k.m[c][0]), _mm512_mul_ps(_g, k.m[c][1])), _mm512_mul_ps(_r, k.m[c][2])), k.m[c][3]);
+                    value = _mm512_min_ps(_mm512_max_ps(value, _mm512_setzero_ps()), _mm512_set1_ps(255.0f));
+                    dst[c] = _mm512_cvttps_epi32(_mm512_add_ps(value, _mm512_set1_ps(0.5f)));
+                }
+            }
+            else
+            {
+                __m512i bg = _mm512_or_si512(b, _mm512_slli_epi32(g, 16));
+                for (int c = 0; c < 3; ++c)
+                {
+                    __m512i value = _mm512_add_epi32(_mm512_add_epi32(_mm512_madd_epi16(bg, k.bg[c]), _mm512_madd_epi16(r, k.r[c])), k.offset[c]);
+                    dst[c] = _mm512_min_epi32(_mm512_max_epi32(_mm512_srai_epi32(value, Base::COLOR_MATRIX_SHIFT), K_ZERO), K32_000000FF);
+                }
+            }
+            b = gamma ? Gather(coefs.gamma[0], dst[0]) : dst[0];
+            g = gamma ? Gather(coefs.gamma[1], dst[1]) : dst[1];
+            r = gamma ? Gather(coefs.gamma[2], dst[2]) : dst[2];
+        }
+
+        template<size_t channels, bool precise, bool gamma> SIMD_INLINE void ColorMatrixPixels(const Base::ColorMatrixCoefs & coefs, const ColorMatrixConst & k, 
+            const uint8_t * src, uint8_t * dst, __mmask64 tail)
+        {
+            __m512i b, g, r;
+            if (channels == 3)
+            {
+                LoadBgr32i(src, tail, b, g, r);
+                ColorMatrixPixels<precise, gamma>(coefs, k, b, g, r);
+                StoreBgr32i(dst, tail, b, g, r);
+            }
+            else
+            {
+                __m512i bgra = _mm512_maskz_loadu_epi8(tail, src);
+                b = _mm512_and_si512(bgra, K32_000000FF);
+                g = _mm512_and_si512(_mm512_srli_epi32(bgra, 8), K32_000000FF);
+                r = _mm512_and_si512(_mm512_srli_epi32(bgra, 16), K32_000000FF);
+                ColorMatrixPixels<precise, gamma>(coefs, k, b, g, r);
+                bgra = _mm512_or_si512(_mm512_and_si512(bgra, _mm512_set1_epi32(0xFF000000)), _mm512_or_si512(b, _mm512_slli_epi32(g, 8)));
+                _mm512_mask_storeu_epi8(dst, tail, _mm512_or_si512(bgra, _mm512_slli_epi32(r, 16)));
+            }
+        }
+
+        template<size_t channels, bool precise, bool gamma> void ColorMatrixRow(const Base::ColorMatrixCoefs & coefs, const uint8_t * src, size_t width, uint8_t * dst)
+        {
+            ColorMatrixConst k(coefs);
+            size_t widthF = AlignLo(width, F);
+            __mmask64 body = TailMask64(F * channels), tail = TailMask64((width - widthF) * channels);
+            size_t col = 0;
+            for (; col < widthF; col += F)
+                ColorMatrixPixels<channels, precise, gamma>(coefs, k, src + col * channels, dst + col * channels, body);
+            if (col < width)
+                ColorMatrixPixels<channels, precise, gamma>(coefs, k, src + col * channels, dst + col * channels, tail);
+        }
+
+        template<size_t channels, bool precise> Base::ColorMatrixRowPtr GetColorMatrixRow(bool gamma)
+        {
+            return gamma ? ColorMatrixRow<channels, precise, true> : ColorMatrixRow<channels, precise, false>;
+        }
+
+        template<size_t channels> Base::ColorMatrixRowPtr GetColorMatrixRow(const ColorMatrixParam & param)
+        {
+            return param.precise ? GetColorMatrixRow<channels, true>(param.gamma) : GetColorMatrixRow<channels, false>(param.gamma);
+        }
+
+        ColorMatrixDefault::ColorMatrixDefault(const ColorMatrixParam& param, const float* matrix, const uint8_t* gamma)
+            : Avx2::ColorMatrixDefault(param, matrix, gamma)
+        {
+            _row = _param.format == SimdPixelFormatBgr24 ? GetColorMatrixRow<3>(_param) : GetColorMatrixRow<4>(_param);
+        }
+
+        //---------------------------------------------------------------------
+
+        void* ColorMatrixInit(const float* matrix, const uint8_t* gamma, SimdPixelFormatType format, SimdBool precise)
+        {
+            ColorMatrixParam param(format, precise, gamma != NULL);
+            if (matrix == NULL || !param.Valid())
+                return NULL;
+            return new ColorMatrixDefault(param, matrix, gamma);
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
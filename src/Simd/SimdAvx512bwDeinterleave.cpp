@@ -224,6 +224,140 @@ namespace Simd
             else
                 DeinterleaveBgra<false>(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
         }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m512i PackI16ToU8(__m512i lo, __m512i hi)
+        {
+            return _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _mm512_packus_epi16(lo, hi));
+        }
+
+        template<bool uyvy> SIMD_INLINE __m512i PackedYuvToY(__m512i src0, __m512i src1)
+        {
+            if (uyvy)
+                return PackI16ToU8(_mm512_srli_epi16(src0, 8), _mm512_srli_epi16(src1, 8));
+            else
+                return PackI16ToU8(_mm512_and_si512(src0, K16_00FF), _mm512_and_si512(src1, K16_00FF));
+        }
+
+        template<bool uyvy> SIMD_INLINE __m512i PackedYuvToUv(__m512i src0, __m512i src1)
+        {
+            return PackedYuvToY<!uyvy>(src0, src1);
+        }
+
+        template<bool uyvy> void PackedYuvToGray(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * gray, size_t grayStride)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    _mm512_storeu_si512((__m512i*)(gray + col), PackedYuvToY<uyvy>(
+                        _mm512_loadu_si512((__m512i*)(src + 2 * col) + 0), _mm512_loadu_si512((__m512i*)(src + 2 * col) + 1)));
+                if (widthA != width)
+                    _mm512_storeu_si512((__m512i*)(gray + tail), PackedYuvToY<uyvy>(
+                        _mm512_loadu_si512((__m512i*)(src + 2 * tail) + 0), _mm512_loadu_si512((__m512i*)(src + 2 * tail) + 1)));
+                src += srcStride;
+                gray += grayStride;
+            }
+        }
+
+        void YuyvToGray(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * gray, size_t grayStride)
+        {
+            PackedYuvToGray<false>(yuyv, yuyvStride, width, height, gray, grayStride);
+        }
+
+        void UyvyToGray(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * gray, size_t grayStride)
+        {
+            PackedYuvToGray<true>(uyvy, uyvyStride, width, height, gray, grayStride);
+        }
+
+        template<bool uyvy> SIMD_INLINE void PackedYuvToNv12(const uint8_t * src0, const uint8_t * src1, uint8_t * y0, uint8_t * y1, uint8_t * uv)
+        {
+            __m512i s00 = _mm512_loadu_si512((__m512i*)src0 + 0), s01 = _mm512_loadu_si512((__m512i*)src0 + 1);
+            __m512i s10 = _mm512_loadu_si512((__m512i*)src1 + 0), s11 = _mm512_loadu_si512((__m512i*)src1 + 1);
+            _mm512_storeu_si512((__m512i*)y0, PackedYuvToY<uyvy>(s00, s01));
+            _mm512_storeu_si512((__m512i*)y1, PackedYuvToY<uyvy>(s10, s11));
+            _mm512_storeu_si512((__m512i*)uv, PackedYuvToUv<uyvy>(_mm512_avg_epu8(s00, s10), _mm512_avg_epu8(s01, s11)));
+        }
+
+        template<bool uyvy> void PackedYuvToNv12(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A));
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    PackedYuvToNv12<uyvy>(src + 2 * col, src + srcStride + 2 * col, y + col, y + yStride + col, uv + col);
+                if (widthA != width)
+                    PackedYuvToNv12<uyvy>(src + 2 * tail, src + srcStride + 2 * tail, y + tail, y + yStride + tail, uv + tail);
+                src += 2 * srcStride;
+                y += 2 * yStride;
+                uv += uvStride;
+            }
+        }
+
+        void YuyvToNv12(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+        {
+            PackedYuvToNv12<false>(yuyv, yuyvStride, width, height, y, yStride, uv, uvStride);
+        }
+
+        void UyvyToNv12(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+        {
+            PackedYuvToNv12<true>(uyvy, uyvyStride, width, height, y, yStride, uv, uvStride);
+        }
+
+        template<bool uyvy> SIMD_INLINE void PackedYuvToYuv420p(const uint8_t * src0, const uint8_t * src1, uint8_t * y0, uint8_t * y1, uint8_t * u, uint8_t * v)
+        {
+            __m512i s00 = _mm512_loadu_si512((__m512i*)src0 + 0), s01 = _mm512_loadu_si512((__m512i*)src0 + 1);
+            __m512i s02 = _mm512_loadu_si512((__m512i*)src0 + 2), s03 = _mm512_loadu_si512((__m512i*)src0 + 3);
+            __m512i s10 = _mm512_loadu_si512((__m512i*)src1 + 0), s11 = _mm512_loadu_si512((__m512i*)src1 + 1);
+            __m512i s12 = _mm512_loadu_si512((__m512i*)src1 + 2), s13 = _mm512_loadu_si512((__m512i*)src1 + 3);
+            _mm512_storeu_si512((__m512i*)y0 + 0, PackedYuvToY<uyvy>(s00, s01));
+            _mm512_storeu_si512((__m512i*)y0 + 1, PackedYuvToY<uyvy>(s02, s03));
+            _mm512_storeu_si512((__m512i*)y1 + 0, PackedYuvToY<uyvy>(s10, s11));
+            _mm512_storeu_si512((__m512i*)y1 + 1, PackedYuvToY<uyvy>(s12, s13));
+            __m512i uv0 = PackedYuvToUv<uyvy>(_mm512_avg_epu8(s00, s10), _mm512_avg_epu8(s01, s11));
+            __m512i uv1 = PackedYuvToUv<uyvy>(_mm512_avg_epu8(s02, s12), _mm512_avg_epu8(s03, s13));
+            _mm512_storeu_si512((__m512i*)u, PackedYuvToY<false>(uv0, uv1));
+            _mm512_storeu_si512((__m512i*)v, PackedYuvToY<true>(uv0, uv1));
+        }
+
+        template<bool uyvy> void PackedYuvToYuv420p(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA));
+
+            size_t widthDA = AlignLo(width, DA), tail = width - DA;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < widthDA; col += DA)
+                    PackedYuvToYuv420p<uyvy>(src + 2 * col, src + srcStride + 2 * col, y + col, y + yStride + col, u + col / 2, v + col / 2);
+                if (widthDA != width)
+                    PackedYuvToYuv420p<uyvy>(src + 2 * tail, src + srcStride + 2 * tail, y + tail, y + yStride + tail, u + tail / 2, v + tail / 2);
+                src += 2 * srcStride;
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+            }
+        }
+
+        void YuyvToYuv420p(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            PackedYuvToYuv420p<false>(yuyv, yuyvStride, width, height, y, yStride, u, uStride, v, vStride);
+        }
+
+        void UyvyToYuv420p(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            PackedYuvToYuv420p<true>(uyvy, uyvyStride, width, height, y, yStride, u, uStride, v, vStride);
+        }
     }
 #endif// SIMD_AVX512BW_ENABLE
 }
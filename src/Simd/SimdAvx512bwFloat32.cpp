@@ -117,6 +117,42 @@ namespace Simd
                 Uint8ToFloat32<false>(src, size, lower, upper, dst);
         }
 
+        template <bool align, bool mask> SIMD_INLINE void Uint16ToFloat32(const uint16_t * src, const __m512 & lower, const __m512 & boost, float * dst, __mmask32 srcTail, const __mmask16 * dstTails)
+        {
+            __m512i _src = Load<align, mask>(src, srcTail);
+            Avx512f::Store<align, mask>(dst + 0, _mm512_add_ps(_mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(_src, 0))), boost), lower), dstTails[0]);
+            Avx512f::Store<align, mask>(dst + F, _mm512_add_ps(_mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(_src, 1))), boost), lower), dstTails[1]);
+        }
+
+        template <bool align> void Uint16ToFloat32(const uint16_t * src, size_t size, int bits, const float * lower, const float * upper, float * dst)
+        {
+            if (align)
+                assert(Aligned(src) && Aligned(dst));
+
+            __m512 _lower = _mm512_set1_ps(lower[0]);
+            __m512 boost = _mm512_set1_ps((upper[0] - lower[0]) / float((1 << bits) - 1));
+
+            size_t alignedSize = AlignLo(size, HA);
+            __mmask32 srcTailMask = TailMask32(size - alignedSize);
+            __mmask16 dstTailMasks[2];
+            for (size_t c = 0; c < 2; ++c)
+                dstTailMasks[c] = TailMask16(size - alignedSize - F*c);
+
+            size_t i = 0;
+            for (; i < alignedSize; i += HA)
+                Uint16ToFloat32<align, false>(src + i, _lower, boost, dst + i, srcTailMask, dstTailMasks);
+            if (i < size)
+                Uint16ToFloat32<align, true>(src + i, _lower, boost, dst + i, srcTailMask, dstTailMasks);
+        }
+
+        void Uint16ToFloat32(const uint16_t * src, size_t size, int bits, const float * lower, const float * upper, float * dst)
+        {
+            if (Aligned(src) && Aligned(dst))
+                Uint16ToFloat32<true>(src, size, bits, lower, upper, dst);
+            else
+                Uint16ToFloat32<false>(src, size, bits, lower, upper, dst);
+        }
+
         template<bool align> void CosineDistance32f(const float * a, const float * b, size_t size, float * distance)
         {
             if (align)
@@ -71,6 +71,41 @@ namespace Simd
             else
                 Int16ToGray<false>((const int16_t *)src, width, height, srcStride / sizeof(int16_t), dst, dstStride);
         }
+
+        template <bool align, bool mask> SIMD_INLINE void Uint16ToGray(const uint16_t * src, __m128i shift, uint8_t * dst, __mmask64 tail = -1)
+        {
+            __m512i src0 = _mm512_min_epu16(_mm512_srl_epi16(Load<align, mask>(src + 00, __mmask32(tail >> 00)), shift), K16_00FF);
+            __m512i src1 = _mm512_min_epu16(_mm512_srl_epi16(Load<align, mask>(src + HA, __mmask32(tail >> 32)), shift), K16_00FF);
+            Store<align, mask>(dst, _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _mm512_packus_epi16(src0, src1)), tail);
+        }
+
+        template <bool align> void Uint16ToGray(const uint16_t * src, size_t width, size_t height, size_t srcStride, int shift, uint8_t * dst, size_t dstStride)
+        {
+            if (align)
+                assert(Aligned(src) && Aligned(srcStride, HA) && Aligned(dst) && Aligned(dstStride));
+
+            __m128i _shift = _mm_cvtsi32_si128(shift);
+            size_t alignedWidth = AlignLo(width, A);
+            __mmask64 tailMask = TailMask64(width - alignedWidth);
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                    Uint16ToGray<align, false>(src + col, _shift, dst + col);
+                if (col < width)
+                    Uint16ToGray<false, true>(src + col, _shift, dst + col, tailMask);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        void Uint16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, int shift, uint8_t * dst, size_t dstStride)
+        {
+            if (Aligned(src) && Aligned(srcStride) && Aligned(dst) && Aligned(dstStride))
+                Uint16ToGray<true>((const uint16_t *)src, width, height, srcStride / sizeof(uint16_t), shift, dst, dstStride);
+            else
+                Uint16ToGray<false>((const uint16_t *)src, width, height, srcStride / sizeof(uint16_t), shift, dst, dstStride);
+        }
     }
 #endif// SIMD_AVX512BW_ENABLE
 }
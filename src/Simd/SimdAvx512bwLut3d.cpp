@@ -0,0 +1,219 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdColorSpace.h"
+#include "Simd/SimdLut3d.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        SIMD_INLINE __m512i Gather(const uint32_t * table, __m512i index)
+        {
+            return _mm512_i32gather_epi32(index, (const int*)table, 4);
+        }
+
+        struct Lut3dConst
+        {
+            __m512i size, size2, last, mask;
+            __m512 scale, output, half;
+
+            SIMD_INLINE Lut3dConst(size_t s)
+            {
+                size = _mm512_set1_epi32((int)s);
+                size2 = _mm512_set1_epi32((int)(s * s));
+                last = _mm512_set1_epi32((int)s - 2);
+                mask = _mm512_set1_epi32(Base::LUT3D_MASK);
+                scale = _mm512_set1_ps(float(s - 1) / 255.0f);
+                output = _mm512_set1_ps(Base::LUT3D_SCALE);
+                half = _mm512_set1_ps(0.5f);
+            }
+        };
+
+        SIMD_INLINE void Lut3dIndex(__m512i value, const Lut3dConst & k, __m512i & index, __m512 & frac)
+        {
+            __m512 x = _mm512_mul_ps(_mm512_cvtepi32_ps(value), k.scale);
+            index = _mm512_min_epi32(_mm512_cvttps_epi32(x), k.last);
+            frac = _mm512_sub_ps(x, _mm512_cvtepi32_ps(index));
+        }
+
+        SIMD_INLINE void Lut3dValue(__m512i node, const Lut3dConst & k, __m512 * value)
+        {
+            value[0] = _mm512_cvtepi32_ps(_mm512_and_si512(node, k.mask));
+            value[1] = _mm512_cvtepi32_ps(_mm512_and_si512(_mm512_srli_epi32(node, Base::LUT3D_BITS), k.mask));
+            value[2] = _mm512_cvtepi32_ps(_mm512_srli_epi32(node, 2 * Base::LUT3D_BITS));
+        }
+
+        SIMD_INLINE void Lut3dLerp(const __m512 * a, const __m512 * b, __m512 f, __m512 * dst)
+        {
+            for (int c = 0; c < 3; ++c)
+                dst[c] = _mm512_add_ps(a[c], _mm512_mul_ps(_mm512_sub_ps(b[c], a[c]), f));
+        }
+
+        SIMD_INLINE void Lut3dLerp(const uint32_t * table, __m512i i0, __m512i i1, __m512 f, const Lut3dConst & k, __m512 * dst)
+        {
+            __m512 v0[3], v1[3];
+            Lut3dValue(Gather(table, i0), k, v0);
+            Lut3dValue(Gather(table, i1), k, v1);
+            Lut3dLerp(v0, v1, f, dst);
+        }
+
+        SIMD_INLINE __m512i Lut3dOutput(__m512 value, const Lut3dConst & k)
+        {
+            return _mm512_cvttps_epi32(_mm512_add_ps(_mm512_mul_ps(value, k.output), k.half));
+        }
+
+        SIMD_INLINE void Lut3dTrilinear(const uint32_t * table, const Lut3dConst & k, __m512i & b, __m512i & g, __m512i & r)
+        {
+            __m512i ib, ig, ir;
+            __m512 fb, fg, fr;
+            Lut3dIndex(b, k, ib, fb);
+            Lut3dIndex(g, k, ig, fg);
+            Lut3dIndex(r, k, ir, fr);
+            __m512i i00 = _mm512_add_epi32(ir, _mm512_add_epi32(_mm512_mullo_epi32(ig, k.size), _mm512_mullo_epi32(ib, k.size2)));
+            __m512i i10 = _mm512_add_epi32(i00, k.size);
+            __m512i i01 = _mm512_add_epi32(i00, k.size2);
+            __m512i i11 = _mm512_add_epi32(i10, k.size2);
+            __m512 v00[3], v10[3], v01[3], v11[3], v0[3], v1[3], v[3];
+            Lut3dLerp(table, i00, _mm512_add_epi32(i00, K32_00000001), fr, k, v00);
+            Lut3dLerp(table, i10, _mm512_add_epi32(i10, K32_00000001), fr, k, v10);
+            Lut3dLerp(table, i01, _mm512_add_epi32(i01, K32_00000001), fr, k, v01);
+            Lut3dLerp(table, i11, _mm512_add_epi32(i11, K32_00000001), fr, k, v11);
+            Lut3dLerp(v00, v10, fg, v0);
+            Lut3dLerp(v01, v11, fg, v1);
+            Lut3dLerp(v0, v1, fb, v);
+            b = Lut3dOutput(v[0], k);
+            g = Lut3dOutput(v[1], k);
+            r = Lut3dOutput(v[2], k);
+        }
+
+        SIMD_INLINE void Lut3dSort(__m512 & fa, __m512i & oa, __m512 & fb, __m512i & ob)
+        {
+            __mmask16 mask = _mm512_cmp_ps_mask(fa, fb, _CMP_LT_OQ);
+            __m512 f = fa;
+            fa = _mm512_mask_blend_ps(mask, fa, fb);
+            fb = _mm512_mask_blend_ps(mask, fb, f);
+            __m512i o = oa;
+            oa = _mm512_mask_blend_epi32(mask, oa, ob);
+            ob = _mm512_mask_blend_epi32(mask, ob, o);
+        }
+
+        SIMD_INLINE void Lut3dTetrahedral(const uint32_t * table, const Lut3dConst & k, __m512i & b, __m512i & g, __m512i & r)
+        {
+            __m512i ib, ig, ir;
+            __m512 f0, f1, f2;
+            Lut3dIndex(r, k, ir, f0);
+            Lut3dIndex(g, k, ig, f1);
+            Lut3dIndex(b, k, ib, f2);
+            __m512i o0 = K32_00000001, o1 = k.size, o2 = k.size2;
+            Lut3dSort(f0, o0, f1, o1);
+            Lut3dSort(f1, o1, f2, o2);
+            Lut3dSort(f0, o0, f1, o1);
+            __m512i i0 = _mm512_add_epi32(ir, _mm512_add_epi32(_mm512_mullo_epi32(ig, k.size), _mm512_mullo_epi32(ib, k.size2)));
+            __m512i i1 = _mm512_add_epi32(i0, o0);
+            __m512i i2 = _mm512_add_epi32(i1, o1);
+            __m512i i3 = _mm512_add_epi32(i0, _mm512_add_epi32(K32_00000001, _mm512_add_epi32(k.size, k.size2)));
+            __m512 c0[3], c1[3], c2[3], c3[3];
+            Lut3dValue(Gather(table, i0), k, c0);
+            Lut3dValue(Gather(table, i1), k, c1);
+            Lut3dValue(Gather(table, i2), k, c2);
+            Lut3dValue(Gather(table, i3), k, c3);
+            __m512 w0 = _mm512_sub_ps(_mm512_set1_ps(1.0f), f0), w1 = _mm512_sub_ps(f0, f1), w2 = _mm512_sub_ps(f1, f2), w3 = f2;
+            __m512 v[3];
+            for (int c = 0; c < 3; ++c)
+                v[c] = _mm512_add_ps(_mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(c0[c], w0), _mm512_mul_ps(c1[c], w1)), _mm512_mul_ps(c2[c], w2)), _mm512_mul_ps(c3[c], w3));
+            b = Lut3dOutput(v[0], k);
+            g = Lut3dOutput(v[1], k);
+            r = Lut3dOutput(v[2], k);
+        }
+
+        template<SimdLut3dInterpolationType interpolation> SIMD_INLINE void Lut3dPixels(const uint32_t * table, const Lut3dConst & k, __m512i & b, __m512i & g, __m512i & r)
+        {
+            if (interpolation == SimdLut3dInterpolationTrilinear)
+                Lut3dTrilinear(table, k, b, g, r);
+            else
+                Lut3dTetrahedral(table, k, b, g, r);
+        }
+
+        template<size_t channels, SimdLut3dInterpolationType interpolation> SIMD_INLINE void Lut3dPixels(const uint32_t * table, const Lut3dConst & k, 
+            const uint8_t * src, uint8_t * dst, __mmask64 tail)
+        {
+            __m512i b, g, r;
+            if (channels == 3)
+            {
+                LoadBgr32i(src, tail, b, g, r);
+                Lut3dPixels<interpolation>(table, k, b, g, r);
+                StoreBgr32i(dst, tail, b, g, r);
+            }
+            else
+            {
+                __m512i bgra = _mm512_maskz_loadu_epi8(tail, src);
+                b = _mm512_and_si512(bgra, K32_000000FF);
+                g = _mm512_and_si512(_mm512_srli_epi32(bgra, 8), K32_000000FF);
+                r = _mm512_and_si512(_mm512_srli_epi32(bgra, 16), K32_000000FF);
+                Lut3dPixels<interpolation>(table, k, b, g, r);
+                bgra = _mm512_or_si512(_mm512_and_si512(bgra, _mm512_set1_epi32(0xFF000000)), _mm512_or_si512(b, _mm512_slli_epi32(g, 8)));
+                _mm512_mask_storeu_epi8(dst, tail, _mm512_or_si512(bgra, _mm512_slli_epi32(r, 16)));
+            }
+        }
+
+        template<size_t channels, SimdLut3dInterpolationType interpolation> void Lut3dRow(const uint32_t * table, size_t size, const uint8_t * src, size_t width, uint8_t * dst)
+        {
+            Lut3dConst k(size);
+            size_t widthF = AlignLo(width, F);
+            __mmask64 body = TailMask64(F * channels), tail = TailMask64((width - widthF) * channels);
+            size_t col = 0;
+            for (; col < widthF; col += F)
+                Lut3dPixels<channels, interpolation>(table, k, src + col * channels, dst + col * channels, body);
+            if (col < width)
+                Lut3dPixels<channels, interpolation>(table, k, src + col * channels, dst + col * channels, tail);
+        }
+
+        template<SimdLut3dInterpolationType interpolation> Base::Lut3dRowPtr GetLut3dRow(SimdPixelFormatType format)
+        {
+            return format == SimdPixelFormatBgr24 ? Lut3dRow<3, interpolation> : Lut3dRow<4, interpolation>;
+        }
+
+        Lut3dDefault::Lut3dDefault(const Lut3dParam& param, const float* table)
+            : Avx2::Lut3dDefault(param, table)
+        {
+            if (_param.interpolation == SimdLut3dInterpolationTrilinear)
+                _row = GetLut3dRow<SimdLut3dInterpolationTrilinear>(_param.format);
+            else
+                _row = GetLut3dRow<SimdLut3dInterpolationTetrahedral>(_param.format);
+        }
+
+        //---------------------------------------------------------------------
+
+        void* Lut3dInit(const float* table, size_t size, SimdPixelFormatType format, SimdLut3dInterpolationType interpolation)
+        {
+            Lut3dParam param(size, format, interpolation);
+            if (table == NULL || !param.Valid())
+                return NULL;
+            return new Lut3dDefault(param, table);
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
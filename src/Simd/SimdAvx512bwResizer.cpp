@@ -203,7 +203,7 @@ namespace Simd
             }
         }
 
-        template<size_t N> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
         {
             struct One { uint8_t val[N * 1]; };
             struct Two { uint8_t val[N * 2]; };
@@ -213,12 +213,13 @@ namespace Simd
             const size_t step = A * N;
             ptrdiff_t previous = -2;
             __m512i a[2];
-            uint8_t * bx[2] = { _bx[0].data, _bx[1].data };
+            uint8_t * bx[2] = { buf, buf + _bufSize };
             const uint8_t * ax = _ax.data;
             const int32_t * ix = _ix.data;
             size_t dstW = _param.dstW;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t yDst = yBeg; yDst < yEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm512_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm512_set1_epi16(int16_t(_ay[yDst]));
@@ -252,7 +253,7 @@ namespace Simd
             }
         }
 
-        void ResizerByteBilinear::RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteBilinear::RunG(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
         {
             size_t bufW = AlignHi(_param.dstW, A) * 2;
             size_t size = 2 * _param.dstW;
@@ -260,11 +261,12 @@ namespace Simd
             size_t blocks = _blocks;
             ptrdiff_t previous = -2;
             __m512i a[2];
-            uint8_t * bx[2] = { _bx[0].data, _bx[1].data };
+            uint8_t * bx[2] = { buf, buf + _bufSize };
             const uint8_t * ax = _ax.data;
             const Idx * ixg = _ixg.data;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t yDst = yBeg; yDst < yEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm512_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm512_set1_epi16(int16_t(_ay[yDst]));
@@ -297,22 +299,21 @@ namespace Simd
             }
         }
 
-        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteBilinear::RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
         {
             assert(_param.dstW >= A);
 
-            EstimateParams();
             switch (_param.channels)
             {
             case 1:
                 if (_blocks)
-                    RunG(src, srcStride, dst, dstStride);
+                    RunG(src, srcStride, yBeg, yEnd, dst, dstStride, buf);
                 else
-                    Run<1>(src, srcStride, dst, dstStride);
+                    Run<1>(src, srcStride, yBeg, yEnd, dst, dstStride, buf);
                 break;
-            case 2: Run<2>(src, srcStride, dst, dstStride); break;
-            case 3: Run<3>(src, srcStride, dst, dstStride); break;
-            case 4: Run<4>(src, srcStride, dst, dstStride); break;
+            case 2: Run<2>(src, srcStride, yBeg, yEnd, dst, dstStride, buf); break;
+            case 3: Run<3>(src, srcStride, yBeg, yEnd, dst, dstStride, buf); break;
+            case 4: Run<4>(src, srcStride, yBeg, yEnd, dst, dstStride, buf); break;
             default:
                 assert(0);
             }
@@ -464,16 +465,18 @@ namespace Simd
             ResizerByteAreaResult34<3>(src, count, curr, zero, next, dst);
         }
 
-        template<size_t N> void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, int32_t * by)
         {
             size_t dstW = _param.dstW, rowSize = _param.srcW*N, rowRest = dstStride - dstW * N;
             const int32_t * iy = _iy.data, *ix = _ix.data, *ay = _ay.data, *ax = _ax.data;
             int32_t ay0 = ay[0], ax0 = ax[0];
             size_t rowSizeA = AlignLo(rowSize, A);
             __mmask64 tail = TailMask64(rowSize - rowSizeA);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
+            src += iy[yBeg] * srcStride;
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += rowRest)
             {
-                int32_t * buf = _by.data;
+                int32_t * buf = by;
                 size_t yn = iy[dy + 1] - iy[dy];
                 ResizerByteAreaRowSum(src, srcStride, yn, rowSize, rowSizeA, ay[dy], ay0, ay[dy + 1], buf, tail), src += yn * srcStride;
                 for (size_t dx = 0; dx < dstW; dx++, dst += N)
@@ -484,14 +487,14 @@ namespace Simd
             }
         }
 
-        void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteArea::RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
         {
             switch (_param.channels)
             {
-            case 1: Run<1>(src, srcStride, dst, dstStride); return;
-            case 2: Run<2>(src, srcStride, dst, dstStride); return;
-            case 3: Run<3>(src, srcStride, dst, dstStride); return;
-            case 4: Run<4>(src, srcStride, dst, dstStride); return;
+            case 1: Run<1>(src, srcStride, yBeg, yEnd, dst, dstStride, (int32_t*)buf); return;
+            case 2: Run<2>(src, srcStride, yBeg, yEnd, dst, dstStride, (int32_t*)buf); return;
+            case 3: Run<3>(src, srcStride, yBeg, yEnd, dst, dstStride, (int32_t*)buf); return;
+            case 4: Run<4>(src, srcStride, yBeg, yEnd, dst, dstStride, (int32_t*)buf); return;
             default:
                 assert(0);
             }
@@ -506,6 +509,14 @@ namespace Simd
                 return new ResizerByteBilinear(param);
             else if (param.IsByteArea())
                 return new ResizerByteArea(param);
+            else if (param.IsFilter())
+                return new ResizerFilter(param);
+            else if (param.IsNearest())
+                return new ResizerNearest(param);
+            else if (param.IsShortArea())
+                return new ResizerShortArea(param);
+            else if (param.IsFloatArea())
+                return new ResizerFloatArea(param);
             else
                 return Avx512f::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
         }
@@ -0,0 +1,175 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdLoad.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        template<class T> SIMD_INLINE __m512 ResizerAreaLoad(const T * src, __mmask16 tail);
+
+        template<> SIMD_INLINE __m512 ResizerAreaLoad<uint16_t>(const uint16_t * src, __mmask16 tail)
+        {
+            return _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm256_maskz_loadu_epi16(tail, src)));
+        }
+
+        template<> SIMD_INLINE __m512 ResizerAreaLoad<float>(const float * src, __mmask16 tail)
+        {
+            return _mm512_maskz_loadu_ps(tail, src);
+        }
+
+        template<class T> SIMD_INLINE void ResizerAreaStore(__m512 value, T * dst, __mmask16 tail);
+
+        template<> SIMD_INLINE void ResizerAreaStore<uint16_t>(__m512 value, uint16_t * dst, __mmask16 tail)
+        {
+            value = _mm512_min_ps(_mm512_max_ps(value, _mm512_setzero_ps()), _mm512_set1_ps(65535.0f));
+            __m512i _value = _mm512_cvttps_epi32(_mm512_add_ps(value, _mm512_set1_ps(0.5f)));
+            _mm256_mask_storeu_epi16(dst, tail, _mm512_cvtepi32_epi16(_value));
+        }
+
+        template<> SIMD_INLINE void ResizerAreaStore<float>(__m512 value, float * dst, __mmask16 tail)
+        {
+            _mm512_mask_storeu_ps(dst, tail, value);
+        }
+
+        template<class T> SIMD_INLINE void ResizerAreaVertical(const uint8_t * src, size_t srcStride, size_t x, const float * weight, size_t kernel, float * dst, __mmask16 tail)
+        {
+            __m512 sum = _mm512_mul_ps(ResizerAreaLoad((const T*)src + x, tail), _mm512_set1_ps(weight[0]));
+            for (size_t k = 1; k < kernel; ++k)
+                sum = _mm512_add_ps(sum, _mm512_mul_ps(ResizerAreaLoad((const T*)(src + k * srcStride) + x, tail), _mm512_set1_ps(weight[k])));
+            _mm512_mask_storeu_ps(dst + x, tail, sum);
+        }
+
+        template<class T> void ResizerAreaVertical(const uint8_t * src, size_t srcStride, size_t width, const float * weight, size_t kernel, float * dst)
+        {
+            size_t widthF = AlignLo(width, F), x = 0;
+            __mmask16 tail = TailMask16(width - widthF);
+            for (; x < widthF; x += F)
+                ResizerAreaVertical<T>(src, srcStride, x, weight, kernel, dst, __mmask16(-1));
+            if (x < width)
+                ResizerAreaVertical<T>(src, srcStride, x, weight, kernel, dst, tail);
+        }
+
+        template<class T> SIMD_INLINE void ResizerAreaHorizontal(const float * src, const int32_t * index, const float * weight, size_t kernel, const __m512i & channels, size_t width, size_t x, T * dst, __mmask16 tail)
+        {
+            __m512i idx = _mm512_maskz_loadu_epi32(tail, index + x);
+            __m512 sum = _mm512_mul_ps(_mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail, idx, src, 4), _mm512_maskz_loadu_ps(tail, weight + x));
+            for (size_t k = 1; k < kernel; ++k)
+            {
+                idx = _mm512_add_epi32(idx, channels);
+                sum = _mm512_add_ps(sum, _mm512_mul_ps(_mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail, idx, src, 4), _mm512_maskz_loadu_ps(tail, weight + k * width + x)));
+            }
+            ResizerAreaStore<T>(sum, dst + x, tail);
+        }
+
+        template<class T> void ResizerAreaHorizontal(const float * src, const int32_t * index, const float * weight, size_t kernel, size_t channels, size_t width, uint8_t * dst)
+        {
+            __m512i _channels = _mm512_set1_epi32((int)channels);
+            size_t widthF = AlignLo(width, F), x = 0;
+            __mmask16 tail = TailMask16(width - widthF);
+            for (; x < widthF; x += F)
+                ResizerAreaHorizontal<T>(src, index, weight, kernel, _channels, width, x, (T*)dst, __mmask16(-1));
+            if (x < width)
+                ResizerAreaHorizontal<T>(src, index, weight, kernel, _channels, width, x, (T*)dst, tail);
+        }
+
+        const __m512i K32_PERMUTE_AREA_EVEN = SIMD_MM512_SETR_EPI32(0x00, 0x02, 0x04, 0x06, 0x08, 0x0A, 0x0C, 0x0E, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1A, 0x1C, 0x1E);
+        const __m512i K32_PERMUTE_AREA_ODD = SIMD_MM512_SETR_EPI32(0x01, 0x03, 0x05, 0x07, 0x09, 0x0B, 0x0D, 0x0F, 0x11, 0x13, 0x15, 0x17, 0x19, 0x1B, 0x1D, 0x1F);
+
+        SIMD_INLINE __m512 ResizerAreaSum2(__m512 a, __m512 b)
+        {
+            return _mm512_add_ps(_mm512_permutex2var_ps(a, K32_PERMUTE_AREA_EVEN, b), _mm512_permutex2var_ps(a, K32_PERMUTE_AREA_ODD, b));
+        }
+
+        template<size_t N> SIMD_INLINE __m512 ResizerAreaSum1(const float * src);
+
+        template<> SIMD_INLINE __m512 ResizerAreaSum1<2>(const float * src)
+        {
+            return ResizerAreaSum2(_mm512_loadu_ps(src + 0), _mm512_loadu_ps(src + F));
+        }
+
+        template<> SIMD_INLINE __m512 ResizerAreaSum1<4>(const float * src)
+        {
+            return ResizerAreaSum2(ResizerAreaSum1<2>(src + 0), ResizerAreaSum1<2>(src + 2 * F));
+        }
+
+        template<class T, size_t N> void ResizerAreaHorizontal(const float * src, const int32_t * index, const float * weight, size_t kernel, size_t channels, size_t width, uint8_t * dst)
+        {
+            __m512 norm = _mm512_set1_ps(1.0f / float(N));
+            if (channels == 4)
+            {
+                size_t widthF = AlignLo(width, F), x = 0;
+                for (; x < widthF; x += F, src += N * F)
+                {
+                    __m512 sum = Avx512f::Load<false>(src, src + N * 4, src + N * 8, src + N * 12);
+                    for (size_t k = 1; k < N; ++k)
+                        sum = _mm512_add_ps(sum, Avx512f::Load<false>(src + k * 4, src + (N + k) * 4, src + (2 * N + k) * 4, src + (3 * N + k) * 4));
+                    ResizerAreaStore<T>(_mm512_mul_ps(sum, norm), (T*)dst + x, __mmask16(-1));
+                }
+                if (x < width)
+                    Base::ResizerAreaHorizontal<T, N>(src, index, weight, kernel, channels, width - x, (uint8_t*)((T*)dst + x));
+            }
+            else if (channels == 1 && N != 3)
+            {
+                size_t widthF = AlignLo(width, F), x = 0;
+                for (; x < widthF; x += F)
+                    ResizerAreaStore<T>(_mm512_mul_ps(ResizerAreaSum1<N == 3 ? 2 : N>(src + x * N), norm), (T*)dst + x, __mmask16(-1));
+                if (x < width)
+                    Base::ResizerAreaHorizontal<T, N>(src + x * N, index, weight, kernel, channels, width - x, (uint8_t*)((T*)dst + x));
+            }
+            else
+                Base::ResizerAreaHorizontal<T, N>(src, index, weight, kernel, channels, width, dst);
+        }
+
+        template<class T> Base::ResizerFloatArea::HorizontalPtr GetResizerAreaHorizontal(size_t fx)
+        {
+            switch (fx)
+            {
+            case 2: return ResizerAreaHorizontal<T, 2>;
+            case 3: return ResizerAreaHorizontal<T, 3>;
+            case 4: return ResizerAreaHorizontal<T, 4>;
+            default: return ResizerAreaHorizontal<T>;
+            }
+        }
+
+        ResizerFloatArea::ResizerFloatArea(const ResParam & param)
+            : Avx2::ResizerFloatArea(param)
+        {
+            _vertical = ResizerAreaVertical<float>;
+            _horizontal = GetResizerAreaHorizontal<float>(_fx);
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerShortArea::ResizerShortArea(const ResParam & param)
+            : Avx2::ResizerShortArea(param)
+        {
+            _vertical = ResizerAreaVertical<uint16_t>;
+            _horizontal = GetResizerAreaHorizontal<uint16_t>(_fx);
+        }
+    }
+#endif //SIMD_AVX512BW_ENABLE
+}
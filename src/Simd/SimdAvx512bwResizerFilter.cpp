@@ -0,0 +1,115 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        template<class T> SIMD_INLINE __m512 ResizerFilterLoad(const T * src, __mmask16 tail);
+
+        template<> SIMD_INLINE __m512 ResizerFilterLoad<uint8_t>(const uint8_t * src, __mmask16 tail)
+        {
+            return _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(tail, src)));
+        }
+
+        template<> SIMD_INLINE __m512 ResizerFilterLoad<float>(const float * src, __mmask16 tail)
+        {
+            return _mm512_maskz_loadu_ps(tail, src);
+        }
+
+        template<class T> SIMD_INLINE void ResizerFilterStore(__m512 value, T * dst, __mmask16 tail);
+
+        template<> SIMD_INLINE void ResizerFilterStore<uint8_t>(__m512 value, uint8_t * dst, __mmask16 tail)
+        {
+            value = _mm512_min_ps(_mm512_max_ps(value, _mm512_setzero_ps()), _mm512_set1_ps(255.0f));
+            __m512i _value = _mm512_cvttps_epi32(_mm512_add_ps(value, _mm512_set1_ps(0.5f)));
+            _mm_mask_storeu_epi8(dst, tail, _mm512_cvtepi32_epi8(_value));
+        }
+
+        template<> SIMD_INLINE void ResizerFilterStore<float>(__m512 value, float * dst, __mmask16 tail)
+        {
+            _mm512_mask_storeu_ps(dst, tail, value);
+        }
+
+        template<class T> SIMD_INLINE void ResizerFilterVertical(const uint8_t * src, size_t srcStride, size_t x, const float * weight, size_t kernel, float * dst, __mmask16 tail)
+        {
+            __m512 sum = _mm512_mul_ps(ResizerFilterLoad((const T*)src + x, tail), _mm512_set1_ps(weight[0]));
+            for (size_t k = 1; k < kernel; ++k)
+                sum = _mm512_add_ps(sum, _mm512_mul_ps(ResizerFilterLoad((const T*)(src + k * srcStride) + x, tail), _mm512_set1_ps(weight[k])));
+            _mm512_mask_storeu_ps(dst + x, tail, sum);
+        }
+
+        template<class T> void ResizerFilterVertical(const uint8_t * src, size_t srcStride, size_t width, const float * weight, size_t kernel, float * dst)
+        {
+            size_t widthF = AlignLo(width, F), x = 0;
+            __mmask16 tail = TailMask16(width - widthF);
+            for (; x < widthF; x += F)
+                ResizerFilterVertical<T>(src, srcStride, x, weight, kernel, dst, __mmask16(-1));
+            if (x < width)
+                ResizerFilterVertical<T>(src, srcStride, x, weight, kernel, dst, tail);
+        }
+
+        template<class T> SIMD_INLINE void ResizerFilterHorizontal(const float * src, const int32_t * index, const float * weight, size_t kernel, const __m512i & channels, size_t width, size_t x, T * dst, __mmask16 tail)
+        {
+            __m512i idx = _mm512_maskz_loadu_epi32(tail, index + x);
+            __m512 sum = _mm512_mul_ps(_mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail, idx, src, 4), _mm512_maskz_loadu_ps(tail, weight + x));
+            for (size_t k = 1; k < kernel; ++k)
+            {
+                idx = _mm512_add_epi32(idx, channels);
+                sum = _mm512_add_ps(sum, _mm512_mul_ps(_mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail, idx, src, 4), _mm512_maskz_loadu_ps(tail, weight + k * width + x)));
+            }
+            ResizerFilterStore<T>(sum, dst + x, tail);
+        }
+
+        template<class T> void ResizerFilterHorizontal(const float * src, const int32_t * index, const float * weight, size_t kernel, size_t channels, size_t width, uint8_t * dst)
+        {
+            __m512i _channels = _mm512_set1_epi32((int)channels);
+            size_t widthF = AlignLo(width, F), x = 0;
+            __mmask16 tail = TailMask16(width - widthF);
+            for (; x < widthF; x += F)
+                ResizerFilterHorizontal<T>(src, index, weight, kernel, _channels, width, x, (T*)dst, __mmask16(-1));
+            if (x < width)
+                ResizerFilterHorizontal<T>(src, index, weight, kernel, _channels, width, x, (T*)dst, tail);
+        }
+
+        ResizerFilter::ResizerFilter(const ResParam & param)
+            : Avx2::ResizerFilter(param)
+        {
+            if (_param.type == SimdResizeChannelByte)
+            {
+                _vertical = ResizerFilterVertical<uint8_t>;
+                _horizontal = ResizerFilterHorizontal<uint8_t>;
+            }
+            else
+            {
+                _vertical = ResizerFilterVertical<float>;
+                _horizontal = ResizerFilterHorizontal<float>;
+            }
+        }
+    }
+#endif //SIMD_AVX512BW_ENABLE
+}
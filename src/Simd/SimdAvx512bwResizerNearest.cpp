@@ -0,0 +1,86 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        ResizerNearest::ResizerNearest(const ResParam & param)
+            : Avx2::ResizerNearest(param)
+            , _avx512bw(false)
+        {
+            Array32i offsets, indices;
+            for (size_t loads = 1; loads <= 2 && !_avx512bw; ++loads)
+            {
+                size_t pixels;
+                if (EstimateBlocks(A, 4, loads, pixels, offsets, indices))
+                {
+                    _avx512bw = true;
+                    _loads = loads;
+                    _pixels = pixels;
+                    _offsets.Swap(offsets);
+                    _permute.Resize(indices.size);
+                    for (size_t i = 0; i < indices.size; ++i)
+                        _permute[i] = Max(indices[i], 0);
+                }
+            }
+        }
+
+        template<size_t loads> SIMD_INLINE __m512i ResizerNearestPermute(const uint8_t * src, const int32_t * permute);
+
+        template<> SIMD_INLINE __m512i ResizerNearestPermute<1>(const uint8_t * src, const int32_t * permute)
+        {
+            return _mm512_permutexvar_epi32(_mm512_loadu_si512(permute), _mm512_loadu_si512(src));
+        }
+
+        template<> SIMD_INLINE __m512i ResizerNearestPermute<2>(const uint8_t * src, const int32_t * permute)
+        {
+            return _mm512_permutex2var_epi32(_mm512_loadu_si512(src), _mm512_loadu_si512(permute), _mm512_loadu_si512(src + A));
+        }
+
+        template<size_t loads> void ResizerNearestRow(const uint8_t * src, const int32_t * offsets, const int32_t * permute, size_t blocks, __mmask64 tail, uint8_t * dst)
+        {
+            size_t b = 0, last = blocks - 1;
+            for (; b < last; ++b, offsets += 2, permute += F)
+                _mm512_storeu_si512(dst + offsets[0], ResizerNearestPermute<loads>(src + offsets[1], permute));
+            _mm512_mask_storeu_epi8(dst + offsets[0], tail, ResizerNearestPermute<loads>(src + offsets[1], permute));
+        }
+
+        void ResizerNearest::RunRow(const uint8_t * src, uint8_t * dst)
+        {
+            size_t blocks = _offsets.size / 2;
+            __mmask64 tail = TailMask64(_pixels * _pixelSize);
+            if (_avx512bw && _loads == 1)
+                ResizerNearestRow<1>(src, _offsets.data, _permute.data, blocks, tail, dst);
+            else if (_avx512bw && _loads == 2)
+                ResizerNearestRow<2>(src, _offsets.data, _permute.data, blocks, tail, dst);
+            else
+                Avx2::ResizerNearest::RunRow(src, dst);
+        }
+    }
+#endif //SIMD_AVX512BW_ENABLE
+}
@@ -566,9 +566,9 @@ namespace Simd
             SynetSetInputNchw3Rgb(_mm512_permutexvar_epi32(K32_PERMUTE_BGR_TO_BGRA_END, Load<false>(src - F)), scale, shift, dst, channel);
         }
 
-        template<SimdPixelFormatType format, size_t step> void SynetSetInputNchw3(const uint8_t * src, size_t width, size_t height, size_t stride, const float * scale, const float * shift, float * dst)
+        template<SimdPixelFormatType format, size_t step> void SynetSetInputNchw3(const uint8_t * src, size_t width, size_t height, size_t stride, const float * scale, const float * shift, float * dst, size_t channel)
         {
-            size_t widthF = AlignLo(width, F), widthA = AlignLo(width, A), channel = width * height;
+            size_t widthF = AlignLo(width, F), widthA = AlignLo(width, A);
             __m512 _scale[3], _shift[3];
             for (size_t i = 0; i < 3; ++i)
             {
@@ -741,8 +741,8 @@ namespace Simd
             }
         }
 
-        void SynetSetInput(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
-            const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat)
+        void SynetSetInputRows(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+            const float * lower, const float * upper, float * dst, size_t plane, size_t channels, SimdTensorFormatType dstFormat)
         {
             assert(width >= A);
 
@@ -767,10 +767,10 @@ namespace Simd
                 case SimdTensorFormatNchw:
                     switch (srcFormat)
                     {
-                    case SimdPixelFormatGray8: SynetSetInputNchw3<SimdPixelFormatGray8, 1>(src, width, height, stride, scale, lower, dst); return;
-                    case SimdPixelFormatBgr24: SynetSetInputNchw3<SimdPixelFormatBgr24, 3>(src, width, height, stride, scale, lower, dst); return;
-                    case SimdPixelFormatBgra32: SynetSetInputNchw3<SimdPixelFormatBgra32, 4>(src, width, height, stride, scale, lower, dst); return;
-                    case SimdPixelFormatRgb24: SynetSetInputNchw3<SimdPixelFormatRgb24, 3>(src, width, height, stride, scale, lower, dst); return;
+                    case SimdPixelFormatGray8: SynetSetInputNchw3<SimdPixelFormatGray8, 1>(src, width, height, stride, scale, lower, dst, plane); return;
+                    case SimdPixelFormatBgr24: SynetSetInputNchw3<SimdPixelFormatBgr24, 3>(src, width, height, stride, scale, lower, dst, plane); return;
+                    case SimdPixelFormatBgra32: SynetSetInputNchw3<SimdPixelFormatBgra32, 4>(src, width, height, stride, scale, lower, dst, plane); return;
+                    case SimdPixelFormatRgb24: SynetSetInputNchw3<SimdPixelFormatRgb24, 3>(src, width, height, stride, scale, lower, dst, plane); return;
                     default: assert(0);
                     }
                     break;
@@ -789,6 +789,47 @@ namespace Simd
             default: assert(0);
             }
         }
+
+        void SynetSetInput(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+            const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat)
+        {
+            SynetSetInputRows(src, width, height, stride, srcFormat, lower, upper, dst, width * height, channels, dstFormat);
+        }
+
+        //---------------------------------------------------------------------
+
+        void SynetSetInputBatchVertical(const uint8_t * src0, const uint8_t * src1, size_t size, float weight, float * dst)
+        {
+            __m512 _weight = _mm512_set1_ps(weight);
+            for (size_t i = 0; i < size; i += F)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                __m512 s0 = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(tail, src0 + i)));
+                __m512 s1 = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(tail, src1 + i)));
+                _mm512_mask_storeu_ps(dst + i, tail, _mm512_fmadd_ps(_mm512_sub_ps(s1, s0), _weight, s0));
+            }
+        }
+
+        void SynetSetInputBatchHorizontal(const float * src, const int32_t * offset, const float * weight, size_t width, size_t step, float coef, float shift, float * dst, bool accumulate)
+        {
+            __m512 _coef = _mm512_set1_ps(coef), _shift = _mm512_set1_ps(shift);
+            for (size_t x = 0; x < width; x += F)
+            {
+                __mmask16 tail = TailMask16(width - x);
+                __m512i _offset = _mm512_maskz_loadu_epi32(tail, offset + x);
+                __m512 s0 = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail, _offset, src, 4);
+                __m512 s1 = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail, _offset, src + step, 4);
+                __m512 value = _mm512_fmadd_ps(_mm512_sub_ps(s1, s0), _mm512_maskz_loadu_ps(tail, weight + x), s0);
+                _mm512_mask_storeu_ps(dst + x, tail, _mm512_fmadd_ps(value, _coef, accumulate ? _mm512_maskz_loadu_ps(tail, dst + x) : _shift));
+            }
+        }
+
+        void SynetSetInputBatch(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+            const float * rois, size_t count, size_t dstWidth, size_t dstHeight, const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat)
+        {
+            Base::SynetSetInputBatch(src, width, height, stride, srcFormat, rois, count, dstWidth, dstHeight, lower, upper, dst, channels, dstFormat,
+                SynetSetInputBatchVertical, SynetSetInputBatchHorizontal);
+        }
     }
 #endif//SIMD_AVX512BW_ENABLE
 }
@@ -0,0 +1,248 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdWarpAffine.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        const __m512i K8_WARP_AFFINE_SHUFFLE = SIMD_MM512_SETR_EPI8(
+            0x0, -1, 0x1, -1, 0x4, -1, 0x5, -1, 0x8, -1, 0x9, -1, 0xC, -1, 0xD, -1,
+            0x0, -1, 0x1, -1, 0x4, -1, 0x5, -1, 0x8, -1, 0x9, -1, 0xC, -1, 0xD, -1,
+            0x0, -1, 0x1, -1, 0x4, -1, 0x5, -1, 0x8, -1, 0x9, -1, 0xC, -1, 0xD, -1,
+            0x0, -1, 0x1, -1, 0x4, -1, 0x5, -1, 0x8, -1, 0x9, -1, 0xC, -1, 0xD, -1);
+
+        SIMD_INLINE __mmask16 WarpAffineInside(__m512i x, __m512i y, __m512i w, __m512i h)
+        {
+            return _mm512_cmpge_epi32_mask(x, K_ZERO) & _mm512_cmplt_epi32_mask(x, w) & 
+                _mm512_cmpge_epi32_mask(y, K_ZERO) & _mm512_cmplt_epi32_mask(y, h);
+        }
+
+        template<bool constant> SIMD_INLINE void WarpAffineNearestIndex(const int32_t* ax, const int32_t* ay, __m512i bx, __m512i by, __m512i w, __m512i h, __m512i s, __m512i ps, int32_t* index)
+        {
+            __m512i x = _mm512_srai_epi32(_mm512_add_epi32(_mm512_loadu_si512(ax), bx), Base::WARP_AFFINE_BITS);
+            __m512i y = _mm512_srai_epi32(_mm512_add_epi32(_mm512_loadu_si512(ay), by), Base::WARP_AFFINE_BITS);
+            if (constant)
+            {
+                __m512i offset = _mm512_add_epi32(_mm512_mullo_epi32(y, s), _mm512_mullo_epi32(x, ps));
+                _mm512_storeu_si512(index, _mm512_mask_blend_epi32(WarpAffineInside(x, y, w, h), K_INV_ZERO, offset));
+            }
+            else
+            {
+                x = _mm512_min_epi32(_mm512_max_epi32(x, K_ZERO), w);
+                y = _mm512_min_epi32(_mm512_max_epi32(y, K_ZERO), h);
+                _mm512_storeu_si512(index, _mm512_add_epi32(_mm512_mullo_epi32(y, s), _mm512_mullo_epi32(x, ps)));
+            }
+        }
+
+        template<bool constant> void WarpAffineNearestIndex(const WarpAffParam& p, const int32_t* ax, const int32_t* ay, int32_t bx, int32_t by, int32_t* index)
+        {
+            __m512i _bx = _mm512_set1_epi32(bx + Base::WARP_AFFINE_ROUND);
+            __m512i _by = _mm512_set1_epi32(by + Base::WARP_AFFINE_ROUND);
+            __m512i w = _mm512_set1_epi32(constant ? (int)p.srcW : (int)p.srcW - 1);
+            __m512i h = _mm512_set1_epi32(constant ? (int)p.srcH : (int)p.srcH - 1);
+            __m512i s = _mm512_set1_epi32((int)p.srcS);
+            __m512i ps = _mm512_set1_epi32((int)p.PixelSize());
+            size_t width = p.dstW, widthF = AlignLo(width, F);
+            for (size_t x = 0; x < widthF; x += F)
+                WarpAffineNearestIndex<constant>(ax + x, ay + x, _bx, _by, w, h, s, ps, index + x);
+            if (widthF < width)
+                WarpAffineNearestIndex<constant>(ax + width - F, ay + width - F, _bx, _by, w, h, s, ps, index + width - F);
+        }
+
+        void WarpAffineNearestRow1(const WarpAffParam& p, const uint8_t* src, const int32_t* index, uint8_t* dst)
+        {
+            size_t width = p.dstW, widthF = AlignLo(width, F), x = 0;
+            __m512i safe = _mm512_set1_epi32((int)((p.srcH - 1) * p.srcS + p.srcW) - 4);
+            __m512i border = _mm512_set1_epi32(p.border[0]);
+            for (; x < widthF; x += F)
+            {
+                __m512i idx = _mm512_loadu_si512(index + x);
+                if (_mm512_cmpgt_epi32_mask(idx, safe))
+                    break;
+                __mmask16 inside = _mm512_cmpge_epi32_mask(idx, K_ZERO);
+                __m512i val = _mm512_and_si512(_mm512_mask_i32gather_epi32(border, inside, idx, src, 1), K32_000000FF);
+                _mm_storeu_si128((__m128i*)(dst + x), _mm512_cvtepi32_epi8(val));
+            }
+            Base::WarpAffineNearestRow<1>(src, p.border, index, x, width, dst);
+        }
+
+        void WarpAffineNearestRow4(const WarpAffParam& p, const uint8_t* src, const int32_t* index, uint8_t* dst)
+        {
+            size_t width = p.dstW, widthF = AlignLo(width, F), x = 0;
+            __m512i border = _mm512_set1_epi32(*(int32_t*)p.border);
+            for (; x < widthF; x += F)
+            {
+                __m512i idx = _mm512_loadu_si512(index + x);
+                __mmask16 inside = _mm512_cmpge_epi32_mask(idx, K_ZERO);
+                _mm512_storeu_si512(dst + 4 * x, _mm512_mask_i32gather_epi32(border, inside, idx, src, 1));
+            }
+            Base::WarpAffineNearestRow<4>(src, p.border, index, x, width, dst);
+        }
+
+        WarpAffineNearest::WarpAffineNearest(const WarpAffParam& param)
+            : Avx2::WarpAffineNearest(param)
+        {
+        }
+
+        void WarpAffineNearest::EstimateIndex(int32_t bx, int32_t by, int32_t* index)
+        {
+            if (_param.dstW < F)
+                Avx2::WarpAffineNearest::EstimateIndex(bx, by, index);
+            else if (_param.IsConstant())
+                WarpAffineNearestIndex<true>(_param, _ax.data, _ay.data, bx, by, index);
+            else
+                WarpAffineNearestIndex<false>(_param, _ax.data, _ay.data, bx, by, index);
+        }
+
+        void WarpAffineNearest::RunRow(const uint8_t* src, const int32_t* index, uint8_t* dst)
+        {
+            if (_param.PixelSize() == 1)
+                WarpAffineNearestRow1(_param, src, index, dst);
+            else if (_param.PixelSize() == 4)
+                WarpAffineNearestRow4(_param, src, index, dst);
+            else
+                Avx2::WarpAffineNearest::RunRow(src, index, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void WarpAffineBilinearIndex(const int32_t* ax, const int32_t* ay, __m512i bx, __m512i by, __m512i w, __m512i h, __m512i s, __m512i ps, int32_t* index, int32_t* xs, int32_t* ys)
+        {
+            __m512i fx = _mm512_add_epi32(_mm512_loadu_si512(ax), bx);
+            __m512i fy = _mm512_add_epi32(_mm512_loadu_si512(ay), by);
+            _mm512_storeu_si512(xs, fx);
+            _mm512_storeu_si512(ys, fy);
+            __m512i x = _mm512_srai_epi32(fx, Base::WARP_AFFINE_BITS);
+            __m512i y = _mm512_srai_epi32(fy, Base::WARP_AFFINE_BITS);
+            __m512i offset = _mm512_add_epi32(_mm512_mullo_epi32(y, s), _mm512_mullo_epi32(x, ps));
+            _mm512_storeu_si512(index, _mm512_mask_blend_epi32(WarpAffineInside(x, y, w, h), K_INV_ZERO, offset));
+        }
+
+        void WarpAffineBilinearRowByte1(const WarpAffParam& p, const uint8_t* src, const int32_t* index, const int32_t* xs, const int32_t* ys, uint8_t* dst)
+        {
+            size_t width = p.dstW, widthF = AlignLo(width, F), x = 0;
+            __m512i safe = _mm512_set1_epi32((int)((p.srcH - 2) * p.srcS + p.srcW) - 4);
+            __m512i mask = _mm512_set1_epi32(Base::WARP_AFFINE_MASK), range = _mm512_set1_epi32(Base::WARP_AFFINE_RANGE);
+            __m512i round = _mm512_set1_epi32(Base::WARP_AFFINE_BILINEAR_ROUND);
+            const uint8_t* src1 = src + p.srcS;
+            for (; x < widthF; x += F)
+            {
+                __m512i idx = _mm512_loadu_si512(index + x);
+                if (_mm512_cmpgt_epi32_mask(idx, safe) | _mm512_cmplt_epi32_mask(idx, K_ZERO))
+                {
+                    Base::WarpAffineBilinearRow<uint8_t, 1>(p, src, index, xs, ys, x, x + F, dst);
+                    continue;
+                }
+                __m512i fx = _mm512_and_si512(_mm512_loadu_si512(xs + x), mask);
+                __m512i fy = _mm512_and_si512(_mm512_loadu_si512(ys + x), mask);
+                __m512i s0 = _mm512_i32gather_epi32(idx, src, 1);
+                __m512i s1 = _mm512_i32gather_epi32(idx, src1, 1);
+                __m512i kx = _mm512_or_si512(_mm512_slli_epi32(fx, 16), _mm512_sub_epi32(range, fx));
+                __m512i top = _mm512_madd_epi16(_mm512_shuffle_epi8(s0, K8_WARP_AFFINE_SHUFFLE), kx);
+                __m512i bot = _mm512_madd_epi16(_mm512_shuffle_epi8(s1, K8_WARP_AFFINE_SHUFFLE), kx);
+                __m512i sum = _mm512_add_epi32(_mm512_mullo_epi32(top, _mm512_sub_epi32(range, fy)), _mm512_mullo_epi32(bot, fy));
+                __m512i res = _mm512_srli_epi32(_mm512_add_epi32(sum, round), 2 * Base::WARP_AFFINE_BITS);
+                _mm_storeu_si128((__m128i*)(dst + x), _mm512_cvtepi32_epi8(res));
+            }
+            Base::WarpAffineBilinearRow<uint8_t, 1>(p, src, index, xs, ys, x, width, dst);
+        }
+
+        void WarpAffineBilinearRowFloat1(const WarpAffParam& p, const uint8_t* src, const int32_t* index, const int32_t* xs, const int32_t* ys, uint8_t* dst)
+        {
+            size_t width = p.dstW, widthF = AlignLo(width, F), x = 0;
+            __m512i mask = _mm512_set1_epi32(Base::WARP_AFFINE_MASK);
+            __m512 scale = _mm512_set1_ps(1.0f / Base::WARP_AFFINE_RANGE);
+            const uint8_t* src00 = src, * src01 = src + 4, * src10 = src + p.srcS, * src11 = src + p.srcS + 4;
+            float* pd = (float*)dst;
+            for (; x < widthF; x += F)
+            {
+                __m512i idx = _mm512_loadu_si512(index + x);
+                if (_mm512_cmplt_epi32_mask(idx, K_ZERO))
+                {
+                    Base::WarpAffineBilinearRow<float, 1>(p, src, index, xs, ys, x, x + F, dst);
+                    continue;
+                }
+                __m512 fx1 = _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_and_si512(_mm512_loadu_si512(xs + x), mask)), scale);
+                __m512 fy1 = _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_and_si512(_mm512_loadu_si512(ys + x), mask)), scale);
+                __m512 fx0 = _mm512_sub_ps(_mm512_set1_ps(1.0f), fx1), fy0 = _mm512_sub_ps(_mm512_set1_ps(1.0f), fy1);
+                __m512 top = _mm512_add_ps(_mm512_mul_ps(_mm512_i32gather_ps(idx, src00, 1), fx0), _mm512_mul_ps(_mm512_i32gather_ps(idx, src01, 1), fx1));
+                __m512 bot = _mm512_add_ps(_mm512_mul_ps(_mm512_i32gather_ps(idx, src10, 1), fx0), _mm512_mul_ps(_mm512_i32gather_ps(idx, src11, 1), fx1));
+                _mm512_storeu_ps(pd + x, _mm512_add_ps(_mm512_mul_ps(top, fy0), _mm512_mul_ps(bot, fy1)));
+            }
+            Base::WarpAffineBilinearRow<float, 1>(p, src, index, xs, ys, x, width, dst);
+        }
+
+        WarpAffineBilinear::WarpAffineBilinear(const WarpAffParam& param)
+            : Avx2::WarpAffineBilinear(param)
+        {
+        }
+
+        void WarpAffineBilinear::EstimateIndex(int32_t bx, int32_t by, int32_t* index, int32_t* xs, int32_t* ys)
+        {
+            size_t width = _param.dstW, widthF = AlignLo(width, F);
+            if (width < F)
+            {
+                Avx2::WarpAffineBilinear::EstimateIndex(bx, by, index, xs, ys);
+                return;
+            }
+            __m512i _bx = _mm512_set1_epi32(bx), _by = _mm512_set1_epi32(by);
+            __m512i w = _mm512_set1_epi32((int)_param.srcW - 1), h = _mm512_set1_epi32((int)_param.srcH - 1);
+            __m512i s = _mm512_set1_epi32((int)_param.srcS), ps = _mm512_set1_epi32((int)_param.PixelSize());
+            for (size_t x = 0; x < widthF; x += F)
+                WarpAffineBilinearIndex(_ax.data + x, _ay.data + x, _bx, _by, w, h, s, ps, index + x, xs + x, ys + x);
+            if (widthF < width)
+            {
+                size_t x = width - F;
+                WarpAffineBilinearIndex(_ax.data + x, _ay.data + x, _bx, _by, w, h, s, ps, index + x, xs + x, ys + x);
+            }
+        }
+
+        void WarpAffineBilinear::RunRow(const uint8_t* src, const int32_t* index, const int32_t* xs, const int32_t* ys, uint8_t* dst)
+        {
+            if (_param.channels == 1 && _param.IsByte())
+                WarpAffineBilinearRowByte1(_param, src, index, xs, ys, dst);
+            else if (_param.channels == 1)
+                WarpAffineBilinearRowFloat1(_param, src, index, xs, ys, dst);
+            else
+                Avx2::WarpAffineBilinear::RunRow(src, index, xs, ys, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            WarpAffParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, mat, flags, border, A);
+            if (mat == NULL || !param.Valid())
+                return NULL;
+            if (param.IsNearest())
+                return new WarpAffineNearest(param);
+            else
+                return new WarpAffineBilinear(param);
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
@@ -37,15 +37,16 @@ namespace Simd
         {
         }
 
-        void ResizerFloatBilinear::Run(const float * src, size_t srcStride, float * dst, size_t dstStride)
+        void ResizerFloatBilinear::Run(const float * src, size_t srcStride, size_t yBeg, size_t yEnd, float * dst, size_t dstStride, float * buf)
         {
             size_t cn = _param.channels;
             size_t rs = _param.dstW * cn;
-            float * pbx[2] = { _bx[0].data, _bx[1].data };
+            float * pbx[2] = { buf, buf + AlignHi(rs, _param.align / sizeof(float)) };
             int32_t prev = -2;
             size_t rsa = AlignLo(rs, Avx512f::F);
             __mmask16 tail = TailMask16(rs - rsa);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
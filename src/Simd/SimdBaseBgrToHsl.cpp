@@ -39,5 +39,18 @@ namespace Simd
                 }
             }
         }
+
+        void BgrToHsl32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * hsl, size_t hslStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint8_t * pBgr = bgr + row*bgrStride;
+                float * pHsl = (float*)((uint8_t*)hsl + row*hslStride);
+                for (const uint8_t * pBgrEnd = pBgr + width * 3; pBgr < pBgrEnd; pBgr += 3, pHsl += 3)
+                {
+                    BgrToHsl(pBgr[0], pBgr[1], pBgr[2], pHsl);
+                }
+            }
+        }
     }
 }
@@ -39,5 +39,18 @@ namespace Simd
                 }
             }
         }
+
+        void BgrToHsv32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * hsv, size_t hsvStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint8_t * pBgr = bgr + row*bgrStride;
+                float * pHsv = (float*)((uint8_t*)hsv + row*hsvStride);
+                for (const uint8_t * pBgrEnd = pBgr + width * 3; pBgr < pBgrEnd; pBgr += 3, pHsv += 3)
+                {
+                    BgrToHsv(pBgr[0], pBgr[1], pBgr[2], pHsv);
+                }
+            }
+        }
     }
 }
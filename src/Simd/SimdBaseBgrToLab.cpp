@@ -0,0 +1,91 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdColorSpace.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        LabTables::LabTables()
+        {
+            for (int i = 0; i < 256; ++i)
+            {
+                double v = i / 255.0;
+                gamma[i] = float(v > 0.04045 ? ::pow((v + 0.055) / 1.055, 2.4) : v / 12.92);
+            }
+            for (int i = 0; i <= LAB_CBRT_TABLE_SIZE; ++i)
+            {
+                double v = double(i) / LAB_CBRT_TABLE_SIZE;
+                cbrt[i] = float(v > 0.008856 ? ::pow(v, 1.0 / 3.0) : 7.787 * v + 16.0 / 116.0);
+            }
+            for (int i = 0; i <= LAB_SRGB_TABLE_SIZE; ++i)
+            {
+                double v = double(i) / LAB_SRGB_TABLE_SIZE;
+                v = v > 0.0031308 ? 1.055 * ::pow(v, 1.0 / 2.4) - 0.055 : 12.92 * v;
+                srgb[i] = RestrictRange(Round(v * 255.0), 0, 255);
+            }
+        }
+
+        const LabTables LAB_TABLES;
+
+        void BgrToLab(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint8_t * pBgr = bgr + row * bgrStride;
+                uint8_t * pLab = lab + row * labStride;
+                for (const uint8_t * pBgrEnd = pBgr + width * 3; pBgr < pBgrEnd; pBgr += 3, pLab += 3)
+                {
+                    BgrToLab(pBgr[0], pBgr[1], pBgr[2], pLab);
+                }
+            }
+        }
+
+        void BgrToLab32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * lab, size_t labStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint8_t * pBgr = bgr + row * bgrStride;
+                float * pLab = (float*)((uint8_t*)lab + row * labStride);
+                for (const uint8_t * pBgrEnd = pBgr + width * 3; pBgr < pBgrEnd; pBgr += 3, pLab += 3)
+                {
+                    BgrToLab(pBgr[0], pBgr[1], pBgr[2], pLab);
+                }
+            }
+        }
+
+        void LabToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint8_t * pLab = lab + row * labStride;
+                uint8_t * pBgr = bgr + row * bgrStride;
+                for (const uint8_t * pLabEnd = pLab + width * 3; pLab < pLabEnd; pLab += 3, pBgr += 3)
+                {
+                    LabToBgr(pLab[0], pLab[1], pLab[2], pBgr);
+                }
+            }
+        }
+    }
+}
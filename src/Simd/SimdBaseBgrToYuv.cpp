@@ -23,6 +23,7 @@
 * SOFTWARE.
 */
 #include "Simd/SimdConversion.h"
+#include "Simd/SimdYuvToBgr.h"
 
 namespace Simd
 {
@@ -114,5 +115,149 @@ namespace Simd
                 bgr += bgrStride;
             }
         }
+
+        //---------------------------------------------------------------------
+
+        template<class T, size_t N, int sx, int sy> void AnyToYuvV2(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert((width % (1 << sx) == 0) && (height % (1 << sy) == 0));
+
+            const size_t count = size_t(1) << (sx + sy);
+            for (size_t row = 0; row < height; row += size_t(1) << sy)
+            {
+                for (size_t dy = 0; dy < (size_t(1) << sy); ++dy)
+                {
+                    const uint8_t * s = src + dy * srcStride;
+                    uint8_t * d = y + dy * yStride;
+                    for (size_t col = 0; col < width; ++col, s += N)
+                        d[col] = BgrToY<T>(s[0], s[1], s[2]);
+                }
+                for (size_t col = 0; col < width; col += size_t(1) << sx)
+                {
+                    int blue = 0, green = 0, red = 0;
+                    for (size_t dy = 0; dy < (size_t(1) << sy); ++dy)
+                    {
+                        for (size_t dx = 0; dx < (size_t(1) << sx); ++dx)
+                        {
+                            const uint8_t * s = src + dy * srcStride + (col + dx) * N;
+                            blue += s[0], green += s[1], red += s[2];
+                        }
+                    }
+                    blue = int((blue + count / 2) >> (sx + sy));
+                    green = int((green + count / 2) >> (sx + sy));
+                    red = int((red + count / 2) >> (sx + sy));
+                    u[col >> sx] = BgrToU<T>(blue, green, red);
+                    v[col >> sx] = BgrToV<T>(blue, green, red);
+                }
+                src += srcStride << sy;
+                y += yStride << sy;
+                u += uStride;
+                v += vStride;
+            }
+        }
+
+        template<size_t N, int sx, int sy> void AnyToYuvV2(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: AnyToYuvV2<Bt601, N, sx, sy>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: AnyToYuvV2<Bt709, N, sx, sy>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: AnyToYuvV2<Bt601Full, N, sx, sy>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: AnyToYuvV2<Bt709Full, N, sx, sy>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            default: assert(0);
+            }
+        }
+
+        void BgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            AnyToYuvV2<3, 1, 1>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        void BgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            AnyToYuvV2<3, 1, 0>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        void BgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            AnyToYuvV2<3, 0, 0>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        void BgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            AnyToYuvV2<4, 1, 1>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        void BgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            AnyToYuvV2<4, 1, 0>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        void BgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            AnyToYuvV2<4, 0, 0>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        //---------------------------------------------------------------------
+
+        template<class T, size_t N> void AnyToNv12(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            for (size_t row = 0; row < height; row += 2)
+            {
+                const uint8_t * s0 = src, * s1 = src + srcStride;
+                uint8_t * y0 = y, * y1 = y + yStride;
+                for (size_t col = 0; col < width; col += 2, s0 += 2 * N, s1 += 2 * N)
+                {
+                    y0[col + 0] = BgrToY<T>(s0[0], s0[1], s0[2]);
+                    y0[col + 1] = BgrToY<T>(s0[N + 0], s0[N + 1], s0[N + 2]);
+                    y1[col + 0] = BgrToY<T>(s1[0], s1[1], s1[2]);
+                    y1[col + 1] = BgrToY<T>(s1[N + 0], s1[N + 1], s1[N + 2]);
+                    int blue = (s0[0] + s0[N + 0] + s1[0] + s1[N + 0] + 2) >> 2;
+                    int green = (s0[1] + s0[N + 1] + s1[1] + s1[N + 1] + 2) >> 2;
+                    int red = (s0[2] + s0[N + 2] + s1[2] + s1[N + 2] + 2) >> 2;
+                    uv[col + 0] = BgrToU<T>(blue, green, red);
+                    uv[col + 1] = BgrToV<T>(blue, green, red);
+                }
+                src += 2 * srcStride;
+                y += 2 * yStride;
+                uv += uvStride;
+            }
+        }
+
+        template<size_t N> void AnyToNv12(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: AnyToNv12<Bt601, N>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709: AnyToNv12<Bt709, N>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt601Full: AnyToNv12<Bt601Full, N>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709Full: AnyToNv12<Bt709Full, N>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            default: assert(0);
+            }
+        }
+
+        void BgraToNv12(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            AnyToNv12<4>(bgra, width, height, bgraStride, y, yStride, uv, uvStride, yuvType);
+        }
+
+        void BgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            AnyToNv12<3>(bgr, width, height, bgrStride, y, yStride, uv, uvStride, yuvType);
+        }
     }
-}
+}
\ No newline at end of file
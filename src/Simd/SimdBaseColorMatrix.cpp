@@ -0,0 +1,106 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdDefs.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdColorMatrix.h"
+
+namespace Simd
+{
+    ColorMatrixParam::ColorMatrixParam(SimdPixelFormatType f, SimdBool p, bool g)
+        : format(f)
+        , precise(p)
+        , gamma(g)
+    {
+    }
+
+    bool ColorMatrixParam::Valid() const
+    {
+        return format == SimdPixelFormatBgr24 || format == SimdPixelFormatBgra32;
+    }
+
+    //---------------------------------------------------------------------
+
+    ColorMatrix::ColorMatrix(const ColorMatrixParam& param)
+        : _param(param)
+    {
+    }
+
+    //---------------------------------------------------------------------
+
+    namespace Base
+    {
+        template<size_t channels, bool precise, bool gamma> void ColorMatrixRow(const ColorMatrixCoefs& coefs, const uint8_t* src, size_t width, uint8_t* dst)
+        {
+            ColorMatrixTail<channels, precise, gamma>(coefs, src, 0, width, dst);
+        }
+
+        template<size_t channels, bool precise> ColorMatrixRowPtr GetColorMatrixRow(bool gamma)
+        {
+            return gamma ? ColorMatrixRow<channels, precise, true> : ColorMatrixRow<channels, precise, false>;
+        }
+
+        template<size_t channels> ColorMatrixRowPtr GetColorMatrixRow(const ColorMatrixParam& param)
+        {
+            return param.precise ? GetColorMatrixRow<channels, true>(param.gamma) : GetColorMatrixRow<channels, false>(param.gamma);
+        }
+
+        ColorMatrixDefault::ColorMatrixDefault(const ColorMatrixParam& param, const float* matrix, const uint8_t* gamma)
+            : Simd::ColorMatrix(param)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                for (int k = 0; k < 3; ++k)
+                {
+                    _coefs.floats[c][k] = matrix[c * 4 + k];
+                    _coefs.fixed[c][k] = Simd::RestrictRange(Round(matrix[c * 4 + k] * COLOR_MATRIX_RANGE), INT16_MIN, INT16_MAX);
+                }
+                _coefs.floats[c][3] = matrix[c * 4 + 3];
+                _coefs.fixed[c][3] = Round(Simd::RestrictRange(matrix[c * 4 + 3], -1024.0f, 1024.0f) * COLOR_MATRIX_RANGE) + (1 << (COLOR_MATRIX_SHIFT - 1));
+                for (int i = 0; i < 256; ++i)
+                    _coefs.gamma[c][i] = gamma ? gamma[c * 256 + i] : i;
+            }
+            _row = _param.format == SimdPixelFormatBgr24 ? GetColorMatrixRow<3>(_param) : GetColorMatrixRow<4>(_param);
+        }
+
+        void ColorMatrixDefault::Run(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                _row(_coefs, src, width, dst);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void* ColorMatrixInit(const float* matrix, const uint8_t* gamma, SimdPixelFormatType format, SimdBool precise)
+        {
+            ColorMatrixParam param(format, precise, gamma != NULL);
+            if (matrix == NULL || !param.Valid())
+                return NULL;
+            return new ColorMatrixDefault(param, matrix, gamma);
+        }
+    }
+}
@@ -22,11 +22,16 @@
 * SOFTWARE.
 */
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdEnable.h"
 
 #include <vector>
 #include <thread>
 #include <sstream>
 #include <iostream>
+#include <cstdlib>
+#include <cctype>
+#include <atomic>
+#include <mutex>
 
 #if defined(_MSC_VER)
 
@@ -220,6 +225,95 @@ namespace Simd
 #else
 #error This platform is unsupported!
 #endif
+
+#if defined(SIMD_X86_ENABLE) || defined(SIMD_X64_ENABLE)
+        std::string CpuModel()
+        {
+            unsigned int registers[12] = { 0 };
+#if defined(_MSC_VER)
+            __cpuid((int*)registers, 0x80000000);
+            if (registers[0] < 0x80000004)
+                return "Unknown";
+            for (unsigned int i = 0; i < 3; ++i)
+                __cpuid((int*)(registers + 4 * i), 0x80000002 + i);
+#else
+            if (__get_cpuid_max(0x80000000, NULL) < 0x80000004)
+                return "Unknown";
+            for (unsigned int i = 0; i < 3; ++i)
+                __cpuid(0x80000002 + i, registers[4 * i + 0], registers[4 * i + 1], registers[4 * i + 2], registers[4 * i + 3]);
+#endif
+            std::string model((char*)registers, sizeof(registers));
+            model = model.substr(0, model.find('\0'));
+            size_t beg = model.find_first_not_of(' '), end = model.find_last_not_of(' ');
+            return beg == std::string::npos ? std::string("Unknown") : model.substr(beg, end - beg + 1);
+        }
+#else
+        std::string CpuModel()
+        {
+            return "Unknown";
+        }
+#endif
+
+        static SimdIsaType ReadEnvironmentMaxIsa()
+        {
+            const char * value = ::getenv("SIMD_MAX_ISA");
+            if (value)
+            {
+                const char * names[] = { "base", "sse41", "avx2", "avx512bw", "avx512vnni", "vmx", "vsx", "neon", "sse2" };
+                std::string name(value);
+                for (size_t i = 0; i < name.size(); ++i)
+                    name[i] = (char)::tolower(name[i]);
+                for (int isa = SimdIsaBase; isa <= SimdIsaSse2; ++isa)
+                    if (name == names[isa])
+                        return (SimdIsaType)isa;
+            }
+            return SimdIsaAvx512vnni;
+        }
+
+        std::atomic<uint32_t> g_isaState(0);
+
+        static std::atomic<int> g_maxIsa(SimdIsaAvx512vnni);
+        static std::mutex g_isaStateMutex;
+
+        static uint32_t ComputeIsaState(SimdIsaType maxIsa)
+        {
+            static const SimdIsaType environmentMaxIsa = ReadEnvironmentMaxIsa();
+            uint32_t state = ISA_STATE_READY | (ISA_STATE_READY << ISA_STATE_ALLOWED_SHIFT);
+            for (const IsaEnable * const * enable = IsaEnables(); *enable; ++enable)
+            {
+                if ((*enable)->getEnable() && IsaAllowed((*enable)->isa, environmentMaxIsa))
+                {
+                    state |= (*enable)->bit;
+                    if (IsaAllowed((*enable)->isa, maxIsa))
+                        state |= (*enable)->bit << ISA_STATE_ALLOWED_SHIFT;
+                }
+            }
+            return state;
+        }
+
+        uint32_t InitIsaState()
+        {
+            std::lock_guard<std::mutex> lock(g_isaStateMutex);
+            uint32_t state = g_isaState.load(std::memory_order_relaxed);
+            if (state == 0)
+            {
+                state = ComputeIsaState((SimdIsaType)g_maxIsa.load(std::memory_order_relaxed));
+                g_isaState.store(state, std::memory_order_relaxed);
+            }
+            return state;
+        }
+
+        SimdIsaType GetMaxIsa()
+        {
+            return (SimdIsaType)g_maxIsa.load(std::memory_order_relaxed);
+        }
+
+        void SetMaxIsa(SimdIsaType isa)
+        {
+            std::lock_guard<std::mutex> lock(g_isaStateMutex);
+            g_maxIsa.store(isa, std::memory_order_relaxed);
+            g_isaState.store(ComputeIsaState(isa), std::memory_order_relaxed);
+        }
     }
 
     namespace Cpu
@@ -22,6 +22,7 @@
 * SOFTWARE.
 */
 #include "Simd/SimdDefs.h"
+#include "Simd/SimdMath.h"
 
 namespace Simd
 {
@@ -80,5 +81,87 @@ namespace Simd
                 a += aStride;
             }
         }
+
+        //---------------------------------------------------------------------
+
+        template<bool uyvy> void PackedYuvToGray(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * gray, size_t grayStride)
+        {
+            const size_t Y = uyvy ? 1 : 0;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < width; ++col)
+                    gray[col] = src[col * 2 + Y];
+                src += srcStride;
+                gray += grayStride;
+            }
+        }
+
+        void YuyvToGray(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * gray, size_t grayStride)
+        {
+            PackedYuvToGray<false>(yuyv, yuyvStride, width, height, gray, grayStride);
+        }
+
+        void UyvyToGray(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * gray, size_t grayStride)
+        {
+            PackedYuvToGray<true>(uyvy, uyvyStride, width, height, gray, grayStride);
+        }
+
+        template<bool uyvy, bool nv12> void PackedYuvTo420(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            const size_t Y = uyvy ? 1 : 0, U = uyvy ? 0 : 1, V = uyvy ? 2 : 3;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                const uint8_t * src0 = src, * src1 = src + srcStride;
+                uint8_t * y0 = y, * y1 = y + yStride;
+                for (size_t col = 0; col < width; col += 2, src0 += 4, src1 += 4)
+                {
+                    y0[col + 0] = src0[Y + 0];
+                    y0[col + 1] = src0[Y + 2];
+                    y1[col + 0] = src1[Y + 0];
+                    y1[col + 1] = src1[Y + 2];
+                    if (nv12)
+                    {
+                        u[col + 0] = Average(src0[U], src1[U]);
+                        u[col + 1] = Average(src0[V], src1[V]);
+                    }
+                    else
+                    {
+                        u[col / 2] = Average(src0[U], src1[U]);
+                        v[col / 2] = Average(src0[V], src1[V]);
+                    }
+                }
+                src += 2 * srcStride;
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+            }
+        }
+
+        void YuyvToYuv420p(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            PackedYuvTo420<false, false>(yuyv, yuyvStride, width, height, y, yStride, u, uStride, v, vStride);
+        }
+
+        void UyvyToYuv420p(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            PackedYuvTo420<true, false>(uyvy, uyvyStride, width, height, y, yStride, u, uStride, v, vStride);
+        }
+
+        void YuyvToNv12(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+        {
+            PackedYuvTo420<false, true>(yuyv, yuyvStride, width, height, y, yStride, uv, uvStride, NULL, 0);
+        }
+
+        void UyvyToNv12(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+        {
+            PackedYuvTo420<true, true>(uyvy, uyvyStride, width, height, y, yStride, uv, uvStride, NULL, 0);
+        }
     }
 }
@@ -70,6 +70,22 @@ namespace Simd
                 dst[i] = Uint8ToFloat32(src[i], _lower, boost);
         }
 
+        void Uint16ToFloat32(const uint16_t * src, size_t size, int bits, const float * lower, const float * upper, float * dst)
+        {
+            float _lower = lower[0], boost = (upper[0] - lower[0]) / float((1 << bits) - 1);
+            size_t alignedSize = Simd::AlignLo(size, 4);
+            size_t i = 0;
+            for (; i < alignedSize; i += 4)
+            {
+                dst[i + 0] = Uint8ToFloat32(src[i + 0], _lower, boost);
+                dst[i + 1] = Uint8ToFloat32(src[i + 1], _lower, boost);
+                dst[i + 2] = Uint8ToFloat32(src[i + 2], _lower, boost);
+                dst[i + 3] = Uint8ToFloat32(src[i + 3], _lower, boost);
+            }
+            for (; i < size; ++i)
+                dst[i] = Uint8ToFloat32(src[i], _lower, boost);
+        }
+
         void CosineDistance32f(const float * a, const float * b, size_t size, float * distance)
         {
             float aa = 0, ab = 0, bb = 0;
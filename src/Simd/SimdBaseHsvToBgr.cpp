@@ -0,0 +1,56 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void HsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint8_t * pHsv = hsv + row * hsvStride;
+                uint8_t * pBgr = bgr + row * bgrStride;
+                for (const uint8_t * pHsvEnd = pHsv + width * 3; pHsv < pHsvEnd; pHsv += 3, pBgr += 3)
+                {
+                    HsvToBgr(pHsv[0], pHsv[1], pHsv[2], pBgr);
+                }
+            }
+        }
+
+        void HslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint8_t * pHsl = hsl + row * hslStride;
+                uint8_t * pBgr = bgr + row * bgrStride;
+                for (const uint8_t * pHslEnd = pHsl + width * 3; pHsl < pHslEnd; pHsl += 3, pBgr += 3)
+                {
+                    HslToBgr(pHsl[0], pHsl[1], pHsl[2], pBgr);
+                }
+            }
+        }
+    }
+}
@@ -43,5 +43,21 @@ namespace Simd
         {
             Int16ToGray((const int16_t *)src, width, height, srcStride / sizeof(int16_t), dst, dstStride);
         }
+
+        static void Uint16ToGray(const uint16_t * src, size_t width, size_t height, size_t srcStride, int shift, uint8_t * dst, size_t dstStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < width; ++col)
+                    dst[col] = (uint8_t)Min(src[col] >> shift, 0xFF);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        void Uint16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, int shift, uint8_t * dst, size_t dstStride)
+        {
+            Uint16ToGray((const uint16_t *)src, width, height, srcStride / sizeof(uint16_t), shift, dst, dstStride);
+        }
     }
 }
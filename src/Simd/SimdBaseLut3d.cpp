@@ -0,0 +1,104 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdDefs.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdLut3d.h"
+
+namespace Simd
+{
+    Lut3dParam::Lut3dParam(size_t s, SimdPixelFormatType f, SimdLut3dInterpolationType i)
+        : size(s)
+        , format(f)
+        , interpolation(i)
+    {
+    }
+
+    bool Lut3dParam::Valid() const
+    {
+        return
+            size >= 2 && size <= 256 &&
+            (format == SimdPixelFormatBgr24 || format == SimdPixelFormatBgra32) &&
+            (interpolation == SimdLut3dInterpolationTrilinear || interpolation == SimdLut3dInterpolationTetrahedral);
+    }
+
+    //---------------------------------------------------------------------
+
+    Lut3d::Lut3d(const Lut3dParam& param)
+        : _param(param)
+    {
+    }
+
+    //---------------------------------------------------------------------
+
+    namespace Base
+    {
+        SIMD_INLINE uint32_t Lut3dNode(float value)
+        {
+            return Simd::Round(Simd::RestrictRange(value, 0.0f, 1.0f) * LUT3D_RANGE);
+        }
+
+        template<size_t channels, SimdLut3dInterpolationType interpolation> void Lut3dRow(const uint32_t* table, size_t size, const uint8_t* src, size_t width, uint8_t* dst)
+        {
+            Lut3dTail<channels, interpolation>(table, size, src, 0, width, dst);
+        }
+
+        template<SimdLut3dInterpolationType interpolation> Lut3dRowPtr GetLut3dRow(SimdPixelFormatType format)
+        {
+            return format == SimdPixelFormatBgr24 ? Lut3dRow<3, interpolation> : Lut3dRow<4, interpolation>;
+        }
+
+        Lut3dDefault::Lut3dDefault(const Lut3dParam& param, const float* table)
+            : Simd::Lut3d(param)
+        {
+            size_t nodes = _param.size * _param.size * _param.size;
+            _table.Resize(nodes);
+            for (size_t i = 0; i < nodes; ++i, table += 3)
+                _table[i] = Lut3dNode(table[2]) | (Lut3dNode(table[1]) << LUT3D_BITS) | (Lut3dNode(table[0]) << (2 * LUT3D_BITS));
+            if (_param.interpolation == SimdLut3dInterpolationTrilinear)
+                _row = GetLut3dRow<SimdLut3dInterpolationTrilinear>(_param.format);
+            else
+                _row = GetLut3dRow<SimdLut3dInterpolationTetrahedral>(_param.format);
+        }
+
+        void Lut3dDefault::Run(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                _row(_table.data, _param.size, src, width, dst);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void* Lut3dInit(const float* table, size_t size, SimdPixelFormatType format, SimdLut3dInterpolationType interpolation)
+        {
+            Lut3dParam param(size, format, interpolation);
+            if (table == NULL || !param.Valid())
+                return NULL;
+            return new Lut3dDefault(param, table);
+        }
+    }
+}
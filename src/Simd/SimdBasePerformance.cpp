@@ -23,7 +23,6 @@
 */
 #include "Simd/SimdPerformance.h"
 
-#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
 namespace Simd
 {
     namespace Base
@@ -33,31 +32,59 @@ namespace Simd
             return double(count) / double(TimeFrequency()) * 1000.0;
         }
 
-        PerformanceMeasurer::PerformanceMeasurer(const String& name, int64_t flop)
+        SIMD_INLINE size_t HistogramIndex(int64_t value)
+        {
+            if (value < 4)
+                return (size_t)std::max<int64_t>(value, 0);
+            size_t msb = 63;
+            while ((value >> msb) == 0)
+                msb--;
+            return msb * 4 + size_t((value >> (msb - 2)) & 3);
+        }
+
+        SIMD_INLINE double HistogramValue(size_t index)
+        {
+            if (index < 4)
+                return double(index);
+            size_t msb = index / 4, mantissa = index & 3;
+            return double(8 + 2 * mantissa + 1) * double(int64_t(1) << (msb - 2)) * 0.5;
+        }
+
+        //---------------------------------------------------------------------
+
+        std::atomic<int64_t> PerformanceMeasurer::s_generation(0);
+
+        PerformanceMeasurer::PerformanceMeasurer(const String& name, int64_t flop, int64_t bytes)
             : _name(name)
-            , _flop(flop)
-            , _count(0)
             , _current(0)
             , _total(0)
             , _min(std::numeric_limits<int64_t>::max())
             , _max(std::numeric_limits<int64_t>::min())
+            , _count(0)
+            , _flop(flop)
+            , _bytes(bytes)
+            , _generation(s_generation.load())
             , _entered(false)
             , _paused(false)
         {
+            std::fill(_histogram, _histogram + HISTOGRAM_SIZE, 0);
         }
 
         PerformanceMeasurer::PerformanceMeasurer(const PerformanceMeasurer & pm)
             : _name(pm._name)
-            , _flop(pm._flop)
-            , _count(pm._count)
             , _start(pm._start)
             , _current(pm._current)
             , _total(pm._total)
             , _min(pm._min)
             , _max(pm._max)
+            , _count(pm._count)
+            , _flop(pm._flop)
+            , _bytes(pm._bytes)
+            , _generation(pm._generation)
             , _entered(pm._entered)
             , _paused(pm._paused)
         {
+            std::copy(pm._histogram, pm._histogram + HISTOGRAM_SIZE, _histogram);
         }
 
         void PerformanceMeasurer::Enter()
@@ -81,16 +108,24 @@ namespace Simd
                 }
                 if (!pause)
                 {
-                    _total += _current;
-                    _min = std::min(_min, _current);
-                    _max = std::max(_max, _current);
-                    ++_count;
+                    Add(_current);
                     _current = 0;
                 }
                 _paused = pause;
             }
         }
 
+        void PerformanceMeasurer::Add(int64_t duration)
+        {
+            if (!Actual())
+                Reset();
+            _total += duration;
+            _min = std::min(_min, duration);
+            _max = std::max(_max, duration);
+            _histogram[HistogramIndex(duration)]++;
+            ++_count;
+        }
+
         String PerformanceMeasurer::Statistic() const
         {
             std::stringstream ss;
@@ -101,15 +136,87 @@ namespace Simd
             ss << std::setprecision(3) << " {min=" << Miliseconds(_min) << "; max=" << Miliseconds(_max) << "}";
             if (_flop)
                 ss << " " << std::setprecision(1) << GFlops() << " GFlops";
+            if (_bytes)
+                ss << " " << std::setprecision(1) << GBps() << " GB/s";
+            return ss.str();
+        }
+
+        String PerformanceMeasurer::Json() const
+        {
+            std::stringstream ss;
+            ss << "{\"name\": \"";
+            for (size_t i = 0; i < _name.size(); ++i)
+            {
+                char c = _name[i];
+                if (c == '"' || c == '\\')
+                    ss << '\\' << c;
+                else if ((unsigned char)c < 0x20)
+                    ss << ' ';
+                else
+                    ss << c;
+            }
+            ss << "\", \"count\": " << _count;
+            ss << std::setprecision(3) << std::fixed;
+            ss << ", \"total_ms\": " << Miliseconds(_total) << ", \"average_ms\": " << Average();
+            ss << ", \"min_ms\": " << (_count ? Miliseconds(_min) : 0.0) << ", \"max_ms\": " << (_count ? Miliseconds(_max) : 0.0);
+            ss << ", \"p50_ms\": " << Percentile(0.50) << ", \"p90_ms\": " << Percentile(0.90) << ", \"p99_ms\": " << Percentile(0.99);
+            ss << ", \"gflops\": " << GFlops() << ", \"gbps\": " << GBps() << "}";
+            return ss.str();
+        }
+
+        String PerformanceMeasurer::Csv() const
+        {
+            std::stringstream ss;
+            ss << '"';
+            for (size_t i = 0; i < _name.size(); ++i)
+            {
+                if (_name[i] == '"')
+                    ss << '"';
+                ss << _name[i];
+            }
+            ss << "\"," << _count;
+            ss << std::setprecision(3) << std::fixed;
+            ss << "," << Miliseconds(_total) << "," << Average();
+            ss << "," << (_count ? Miliseconds(_min) : 0.0) << "," << (_count ? Miliseconds(_max) : 0.0);
+            ss << "," << Percentile(0.50) << "," << Percentile(0.90) << "," << Percentile(0.99);
+            ss << "," << GFlops() << "," << GBps();
             return ss.str();
         }
 
+        String PerformanceMeasurer::CsvHeader()
+        {
+            return "name,count,total_ms,average_ms,min_ms,max_ms,p50_ms,p90_ms,p99_ms,gflops,gbps";
+        }
+
         void PerformanceMeasurer::Combine(const PerformanceMeasurer& other)
         {
             _count += other._count;
             _total += other._total;
             _min = std::min(_min, other._min);
             _max = std::max(_max, other._max);
+            for (size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+                _histogram[i] += other._histogram[i];
+        }
+
+        void PerformanceMeasurer::Reset()
+        {
+            _count = 0;
+            _current = 0;
+            _total = 0;
+            _min = std::numeric_limits<int64_t>::max();
+            _max = std::numeric_limits<int64_t>::min();
+            std::fill(_histogram, _histogram + HISTOGRAM_SIZE, 0);
+            _generation = s_generation.load();
+        }
+
+        void PerformanceMeasurer::ResetAll()
+        {
+            s_generation++;
+        }
+
+        bool PerformanceMeasurer::Actual() const
+        {
+            return _generation == s_generation.load();
         }
 
         double PerformanceMeasurer::Average() const
@@ -122,14 +229,76 @@ namespace Simd
             return _count && _flop && _total > 0 ? (double(_flop) * _count / Miliseconds(_total) / 1000000.0) : 0;
         }
 
+        double PerformanceMeasurer::GBps() const
+        {
+            return _count && _bytes && _total > 0 ? (double(_bytes) * _count / Miliseconds(_total) / 1000000.0) : 0;
+        }
+
+        double PerformanceMeasurer::Percentile(double p) const
+        {
+            if (_count == 0)
+                return 0;
+            int64_t rank = std::max<int64_t>(int64_t(std::ceil(p * double(_count))), 1), sum = 0;
+            for (size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+            {
+                sum += _histogram[i];
+                if (sum >= rank)
+                    return std::min(std::max(HistogramValue(i), double(_min)), double(_max)) / double(TimeFrequency()) * 1000.0;
+            }
+            return Miliseconds(_max);
+        }
+
         //---------------------------------------------------------------------
 
         PerformanceMeasurerStorage PerformanceMeasurerStorage::s_storage;
 
         const char * PerformanceMeasurerStorage::PerformanceStatistic()
+        {
+            return PerformanceStatistic(SimdPerformanceStatisticText);
+        }
+
+        const char * PerformanceMeasurerStorage::PerformanceStatistic(SimdPerformanceStatisticFormatType format)
         {
             if (_map.empty())
                 return "";
+            FunctionMap combined = Combined();
+            std::stringstream report;
+            switch (format)
+            {
+            case SimdPerformanceStatisticText:
+                report << std::endl << "Simd Library Internal Performance Statistics:" << std::endl;
+                for (FunctionMap::const_iterator it = combined.begin(); it != combined.end(); ++it)
+                    report << it->second->Statistic() << std::endl;
+                break;
+            case SimdPerformanceStatisticJson:
+                report << "[" << std::endl;
+                for (FunctionMap::const_iterator it = combined.begin(); it != combined.end(); ++it)
+                {
+                    if (it != combined.begin())
+                        report << "," << std::endl;
+                    report << "  " << it->second->Json();
+                }
+                report << std::endl << "]" << std::endl;
+                break;
+            case SimdPerformanceStatisticCsv:
+                report << PerformanceMeasurer::CsvHeader() << std::endl;
+                for (FunctionMap::const_iterator it = combined.begin(); it != combined.end(); ++it)
+                    report << it->second->Csv() << std::endl;
+                break;
+            default:
+                return "";
+            }
+            _report = report.str();
+            return _report.c_str();
+        }
+
+        void PerformanceMeasurerStorage::Reset()
+        {
+            PerformanceMeasurer::ResetAll();
+        }
+
+        PerformanceMeasurerStorage::FunctionMap PerformanceMeasurerStorage::Combined() const
+        {
             FunctionMap combined;
             std::lock_guard<std::mutex> lock(_mutex);
             for (ThreadMap::const_iterator thread = _map.begin(); thread != _map.end(); ++thread)
@@ -137,18 +306,16 @@ namespace Simd
                 for (FunctionMap::const_iterator function = thread->second.begin(); function != thread->second.end(); ++function)
                 {
                     if (combined.find(function->first) == combined.end())
+                    {
                         combined[function->first].reset(new PerformanceMeasurer(*function->second));
-                    else
+                        if (!function->second->Actual())
+                            combined[function->first]->Reset();
+                    }
+                    else if (function->second->Actual())
                         combined[function->first]->Combine(*function->second);
                 }
             }
-            std::stringstream report;
-            report << std::endl << "Simd Library Internal Performance Statistics:" << std::endl;
-            for (FunctionMap::const_iterator it = combined.begin(); it != combined.end(); ++it)
-                report << it->second->Statistic() << std::endl;
-            _report = report.str();
-            return _report.c_str();
+            return combined;
         }
     }
 }
-#endif//SIMD_PERFORMANCE_STATISTIC
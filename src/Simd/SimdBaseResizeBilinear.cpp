@@ -90,7 +90,7 @@ namespace Simd
 
         void ResizeBilinear(
             const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount, size_t yBeg, size_t yEnd)
         {
             assert(channelCount >= 1 && channelCount <= 4);
 
@@ -104,7 +104,8 @@ namespace Simd
 
             ptrdiff_t previous = -2;
 
-            for (size_t yDst = 0; yDst < dstHeight; yDst++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t yDst = yBeg; yDst < yEnd; yDst++, dst += dstStride)
             {
                 int fy = buffer.ay[yDst];
                 ptrdiff_t sy = buffer.iy[yDst];
@@ -149,6 +150,13 @@ namespace Simd
                 }
             }
         }
+
+        void ResizeBilinear(
+            const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+        {
+            ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount, 0, dstHeight);
+        }
     }
 }
 
@@ -23,13 +23,50 @@
 */
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdResizer.h"
+#include "Simd/SimdParallelRows.h"
 
 namespace Simd
 {
+    void Resizer::RunBands(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride)
+    {
+        if (yBeg >= yEnd)
+            return;
+        size_t height = yEnd - yBeg, bands = ParallelRowsBands(_param.dstW * _param.channels, height, 2);
+        if (bands < 2)
+        {
+            _buffer.Resize(BufferSize(), false, _param.align);
+            RunBand(src, srcStride, yBeg, yEnd, dst, dstStride, _buffer.data);
+        }
+        else
+        {
+            Parallel(0, bands, [&](size_t thread, size_t begin, size_t end)
+            {
+                Array8u buffer(BufferSize(), false, _param.align);
+                for (size_t band = begin; band < end; ++band)
+                    RunBand(src, srcStride, yBeg + ParallelRowsBound(height, bands, band, 1),
+                        yBeg + ParallelRowsBound(height, bands, band + 1, 1), dst, dstStride, buffer.data);
+            }, bands);
+        }
+    }
+
+    size_t Resizer::RunStrip(const uint8_t * src, size_t srcStride, size_t srcRowBeg, size_t srcRowEnd, uint8_t * dst, size_t dstStride)
+    {
+        size_t yBeg = 0, yEnd = 0;
+        while (yBeg < _param.dstH && SrcRows(yBeg) <= srcRowBeg)
+            yBeg++;
+        for (yEnd = yBeg; yEnd < _param.dstH && SrcRows(yEnd) <= srcRowEnd;)
+            yEnd++;
+        RunBands(src, srcStride, yBeg, yEnd, dst, dstStride);
+        return yEnd;
+    }
+
+    //-------------------------------------------------------------------------
+
     namespace Base
     {
         ResizerByteBilinear::ResizerByteBilinear(const ResParam & param)
             : Resizer(param)
+            , _bufSize(0)
         {
             _ay.Resize(_param.dstH);
             _iy.Resize(_param.dstH);
@@ -67,21 +104,47 @@ namespace Simd
             }
         }        
 
+        void ResizerByteBilinear::EstimateParams()
+        {
+            if (_ax.data)
+                return;
+            size_t rs = _param.dstW * _param.channels;
+            _ax.Resize(rs);
+            _ix.Resize(rs);
+            EstimateIndexAlpha(_param.srcW, _param.dstW, _param.channels, _ix.data, _ax.data);
+            _bufSize = rs * sizeof(int32_t);
+        }
+
+        size_t ResizerByteBilinear::SrcRows(size_t dy) const
+        {
+            return Simd::Min<size_t>(_iy[dy] + 2, _param.srcH);
+        }
+
+        size_t ResizerByteBilinear::BufferSize() const
+        {
+            return _bufSize * 2;
+        }
+
         void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            EstimateParams();
+            RunBands(src, srcStride, 0, _param.dstH, dst, dstStride);
+        }
+
+        size_t ResizerByteBilinear::RunRows(const uint8_t * src, size_t srcStride, size_t srcRowBeg, size_t srcRowEnd, uint8_t * dst, size_t dstStride)
+        {
+            EstimateParams();
+            return RunStrip(src, srcStride, srcRowBeg, srcRowEnd, dst, dstStride);
+        }
+
+        void ResizerByteBilinear::RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
         {
             size_t cn =  _param.channels;
             size_t rs = _param.dstW * cn;
-            if (_ax.data == 0)
-            {
-                _ax.Resize(rs);
-                _ix.Resize(rs);
-                EstimateIndexAlpha(_param.srcW, _param.dstW, cn, _ix.data, _ax.data);
-                _bx[0].Resize(rs);
-                _bx[1].Resize(rs);
-            }
-            int32_t * pbx[2] = { _bx[0].data, _bx[1].data };
+            int32_t * pbx[2] = { (int32_t*)buf, (int32_t*)(buf + _bufSize) };
             int32_t prev = -2;
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
             {
                 int32_t fy = _ay[dy];
                 int32_t sy = _iy[dy];
@@ -189,11 +252,12 @@ namespace Simd
                 dst[c] = uint8_t((src[c] + Base::AREA_ROUND) >> Base::AREA_SHIFT);
         }
 
-        template<size_t N> void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride)
         {
             int32_t ts[N], rs[N];
             int32_t ayb = _ay.data[0], axb = _ax.data[0];
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
             {
                 size_t by = _iy.data[dy], ey = _iy.data[dy + 1];
                 int32_t ayn = _ay.data[dy], ayt = - _ay.data[dy + 1];
@@ -217,14 +281,29 @@ namespace Simd
             }
         }
 
+        size_t ResizerByteArea::SrcRows(size_t dy) const
+        {
+            return Simd::Min<size_t>(_iy[dy + 1] + 1, _param.srcH);
+        }
+
         void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            RunBands(src, srcStride, 0, _param.dstH, dst, dstStride);
+        }
+
+        size_t ResizerByteArea::RunRows(const uint8_t * src, size_t srcStride, size_t srcRowBeg, size_t srcRowEnd, uint8_t * dst, size_t dstStride)
+        {
+            return RunStrip(src, srcStride, srcRowBeg, srcRowEnd, dst, dstStride);
+        }
+
+        void ResizerByteArea::RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
         {
             switch (_param.channels)
             {
-            case 1: Run<1>(src, srcStride, dst, dstStride); return;
-            case 2: Run<2>(src, srcStride, dst, dstStride); return;
-            case 3: Run<3>(src, srcStride, dst, dstStride); return;
-            case 4: Run<4>(src, srcStride, dst, dstStride); return;
+            case 1: Run<1>(src, srcStride, yBeg, yEnd, dst, dstStride); return;
+            case 2: Run<2>(src, srcStride, yBeg, yEnd, dst, dstStride); return;
+            case 3: Run<3>(src, srcStride, yBeg, yEnd, dst, dstStride); return;
+            case 4: Run<4>(src, srcStride, yBeg, yEnd, dst, dstStride); return;
             default:
                 assert(0);
             }
@@ -242,8 +321,6 @@ namespace Simd
             _ax.Resize(rs, false, _param.align);
             _ix.Resize(rs, false, _param.align);
             EstimateIndexAlpha(_param.srcW, _param.dstW, _param.channels, _ix.data, _ax.data);
-            _bx[0].Resize(rs, false, _param.align);
-            _bx[1].Resize(rs, false, _param.align);
         }
 
         void ResizerFloatBilinear::EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t * indices, float * alphas)
@@ -326,18 +403,39 @@ namespace Simd
 
         }
 
+        size_t ResizerFloatBilinear::SrcRows(size_t dy) const
+        {
+            return Simd::Min<size_t>(_iy[dy] + 2, _param.srcH);
+        }
+
+        size_t ResizerFloatBilinear::BufferSize() const
+        {
+            return AlignHi(_param.dstW * _param.channels, _param.align / sizeof(float)) * 2 * sizeof(float);
+        }
+
         void ResizerFloatBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
         {
-            Run((const float*)src, srcStride / sizeof(float), (float*)dst, dstStride / sizeof(float));
+            RunBands(src, srcStride, 0, _param.dstH, dst, dstStride);
         }
 
-        void ResizerFloatBilinear::Run(const float * src, size_t srcStride, float * dst, size_t dstStride)
+        size_t ResizerFloatBilinear::RunRows(const uint8_t * src, size_t srcStride, size_t srcRowBeg, size_t srcRowEnd, uint8_t * dst, size_t dstStride)
+        {
+            return RunStrip(src, srcStride, srcRowBeg, srcRowEnd, dst, dstStride);
+        }
+
+        void ResizerFloatBilinear::RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
+        {
+            Run((const float*)src, srcStride / sizeof(float), yBeg, yEnd, (float*)dst, dstStride / sizeof(float), (float*)buf);
+        }
+
+        void ResizerFloatBilinear::Run(const float * src, size_t srcStride, size_t yBeg, size_t yEnd, float * dst, size_t dstStride, float * buf)
         {
             size_t cn = _param.channels;
             size_t rs = _param.dstW * cn;
-            float * pbx[2] = { _bx[0].data, _bx[1].data };
+            float * pbx[2] = { buf, buf + rs };
             int32_t prev = -2;
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -373,6 +471,59 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        ResizerShortBilinear::ResizerShortBilinear(const ResParam & param)
+            : ResizerFloatBilinear(param)
+        {
+        }
+
+        void ResizerShortBilinear::RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
+        {
+            Run((const uint16_t*)src, srcStride / sizeof(uint16_t), yBeg, yEnd, (uint16_t*)dst, dstStride / sizeof(uint16_t), (float*)buf);
+        }
+
+        void ResizerShortBilinear::Run(const uint16_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint16_t * dst, size_t dstStride, float * buf)
+        {
+            size_t cn = _param.channels;
+            size_t rs = _param.dstW * cn;
+            float * pbx[2] = { buf, buf + rs };
+            int32_t prev = -2;
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
+            {
+                float fy1 = _ay[dy];
+                float fy0 = 1.0f - fy1;
+                int32_t sy = _iy[dy];
+                int32_t k = 0;
+
+                if (sy == prev)
+                    k = 2;
+                else if (sy == prev + 1)
+                {
+                    Swap(pbx[0], pbx[1]);
+                    k = 1;
+                }
+
+                prev = sy;
+
+                for (; k < 2; k++)
+                {
+                    float * pb = pbx[k];
+                    const uint16_t * ps = src + (sy + k)*srcStride;
+                    for (size_t dx = 0; dx < rs; dx++)
+                    {
+                        int32_t sx = _ix[dx];
+                        float fx = _ax[dx];
+                        pb[dx] = ps[sx]*(1.0f - fx) + ps[sx + cn]*fx;
+                    }
+                }
+
+                for (size_t dx = 0; dx < rs; dx++)
+                    dst[dx] = (uint16_t)Round(pbx[0][dx]*fy0 + pbx[1][dx]*fy1);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(void*));
@@ -382,6 +533,16 @@ namespace Simd
                 return new ResizerByteArea(param);
             else if (param.IsFloatBilinear())
                 return new ResizerFloatBilinear(param);
+            else if (param.IsShortBilinear())
+                return new ResizerShortBilinear(param);
+            else if (param.IsFilter())
+                return new ResizerFilter(param);
+            else if (param.IsNearest())
+                return new ResizerNearest(param);
+            else if (param.IsShortArea())
+                return new ResizerShortArea(param);
+            else if (param.IsFloatArea())
+                return new ResizerFloatArea(param);
             else
                 return NULL;
         }
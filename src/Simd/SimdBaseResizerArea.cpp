@@ -0,0 +1,134 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdResizer.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<class T> ResizerFloatArea::HorizontalPtr GetResizerAreaHorizontal(size_t fx)
+        {
+            switch (fx)
+            {
+            case 2: return ResizerAreaHorizontal<T, 2>;
+            case 3: return ResizerAreaHorizontal<T, 3>;
+            case 4: return ResizerAreaHorizontal<T, 4>;
+            default: return ResizerFilterHorizontal<T>;
+            }
+        }
+
+        ResizerFloatArea::ResizerFloatArea(const ResParam & param)
+            : Resizer(param)
+        {
+            EstimateWeights(_param.srcH, _param.dstH, _ky, _iy, _ay);
+
+            Array32i ix;
+            Array32f ax;
+            EstimateWeights(_param.srcW, _param.dstW, _kx, ix, ax);
+            size_t cn = _param.channels, rs = _param.dstW * cn;
+            _ix.Resize(rs, false, _param.align);
+            _ax.Resize(rs * _kx, false, _param.align);
+            for (size_t dx = 0; dx < _param.dstW; ++dx)
+            {
+                for (size_t c = 0; c < cn; ++c)
+                {
+                    size_t offset = dx * cn + c;
+                    _ix[offset] = ix[dx] * int32_t(cn) + int32_t(c);
+                    for (size_t k = 0; k < _kx; ++k)
+                        _ax[k * rs + offset] = ax[dx * _kx + k];
+                }
+            }
+            _fx = (_param.srcW == _param.dstW * _kx && _kx >= 2 && _kx <= 4) ? _kx : 0;
+
+            _vertical = ResizerFilterVertical<float>;
+            _horizontal = GetResizerAreaHorizontal<float>(_fx);
+        }
+
+        void ResizerFloatArea::EstimateWeights(size_t srcSize, size_t dstSize, size_t & kernel, Array32i & index, Array32f & weight)
+        {
+            kernel = 1;
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                size_t beg = i * srcSize, end = beg + srcSize;
+                kernel = Simd::Max(kernel, DivHi(end, dstSize) - beg / dstSize);
+            }
+            kernel = Simd::Min(kernel, srcSize);
+
+            index.Resize(dstSize, false, _param.align);
+            weight.Resize(dstSize * kernel, true, _param.align);
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                size_t beg = i * srcSize, end = beg + srcSize;
+                size_t first = beg / dstSize, last = DivHi(end, dstSize);
+                size_t start = Simd::Min(first, srcSize - kernel);
+                index[i] = int32_t(start);
+                for (size_t s = first; s < last; ++s)
+                {
+                    size_t overlap = Simd::Min((s + 1) * dstSize, end) - Simd::Max(s * dstSize, beg);
+                    weight[i * kernel + s - start] = float(overlap) / float(srcSize);
+                }
+            }
+        }
+
+        void ResizerFloatArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            RunBands(src, srcStride, 0, _param.dstH, dst, dstStride);
+        }
+
+        size_t ResizerFloatArea::RunRows(const uint8_t * src, size_t srcStride, size_t srcRowBeg, size_t srcRowEnd, uint8_t * dst, size_t dstStride)
+        {
+            return RunStrip(src, srcStride, srcRowBeg, srcRowEnd, dst, dstStride);
+        }
+
+        size_t ResizerFloatArea::SrcRows(size_t dy) const
+        {
+            return _iy[dy] + _ky;
+        }
+
+        size_t ResizerFloatArea::BufferSize() const
+        {
+            return _param.srcW * _param.channels * sizeof(float);
+        }
+
+        void ResizerFloatArea::RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
+        {
+            size_t cn = _param.channels, srcRow = _param.srcW * cn, dstRow = _param.dstW * cn;
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
+            {
+                _vertical(src + _iy[dy] * srcStride, srcStride, srcRow, _ay.data + dy * _ky, _ky, (float*)buf);
+                _horizontal((float*)buf, _ix.data, _ax.data, _kx, cn, dstRow, dst);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerShortArea::ResizerShortArea(const ResParam & param)
+            : ResizerFloatArea(param)
+        {
+            _vertical = ResizerFilterVertical<uint16_t>;
+            _horizontal = GetResizerAreaHorizontal<uint16_t>(_fx);
+        }
+    }
+}
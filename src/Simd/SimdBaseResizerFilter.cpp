@@ -0,0 +1,145 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE float ResizerCubic(float x, float a)
+        {
+            x = ::fabs(x);
+            if (x < 1.0f)
+                return ((a + 2.0f) * x - (a + 3.0f)) * x * x + 1.0f;
+            if (x < 2.0f)
+                return ((x - 5.0f) * x + 8.0f) * x * a - 4.0f * a;
+            return 0.0f;
+        }
+
+        SIMD_INLINE float ResizerLanczos(float x)
+        {
+            const float pi = 3.14159265358979f;
+            x = ::fabs(x);
+            if (x < 1.0e-7f)
+                return 1.0f;
+            if (x < 3.0f)
+                return 3.0f * ::sin(pi * x) * ::sin(pi * x / 3.0f) / (pi * pi * x * x);
+            return 0.0f;
+        }
+
+        ResizerFilter::ResizerFilter(const ResParam & param)
+            : Resizer(param)
+        {
+            EstimateWeights(_param.srcH, _param.dstH, _ky, _iy, _ay);
+
+            Array32i ix;
+            Array32f ax;
+            EstimateWeights(_param.srcW, _param.dstW, _kx, ix, ax);
+            size_t cn = _param.channels, rs = _param.dstW * cn;
+            _ix.Resize(rs, false, _param.align);
+            _ax.Resize(rs * _kx, false, _param.align);
+            for (size_t dx = 0; dx < _param.dstW; ++dx)
+            {
+                for (size_t c = 0; c < cn; ++c)
+                {
+                    size_t offset = dx * cn + c;
+                    _ix[offset] = ix[dx] * int32_t(cn) + int32_t(c);
+                    for (size_t k = 0; k < _kx; ++k)
+                        _ax[k * rs + offset] = ax[dx * _kx + k];
+                }
+            }
+            if (_param.type == SimdResizeChannelByte)
+            {
+                _vertical = ResizerFilterVertical<uint8_t>;
+                _horizontal = ResizerFilterHorizontal<uint8_t>;
+            }
+            else
+            {
+                _vertical = ResizerFilterVertical<float>;
+                _horizontal = ResizerFilterHorizontal<float>;
+            }
+        }
+
+        void ResizerFilter::EstimateWeights(size_t srcSize, size_t dstSize, size_t & kernel, Array32i & index, Array32f & weight)
+        {
+            SimdResizeMethodType method = _param.method;
+            float scale = float(srcSize) / float(dstSize);
+            float filterScale = method == SimdResizeMethodBicubic ? 1.0f : Simd::Max(scale, 1.0f);
+            float support = (method == SimdResizeMethodLanczos ? 3.0f : 2.0f) * filterScale;
+            kernel = method == SimdResizeMethodBicubic ? 4 : size_t(::ceil(support)) * 2 + 1;
+            kernel = Simd::Min(kernel, srcSize);
+
+            index.Resize(dstSize, false, _param.align);
+            weight.Resize(dstSize * kernel, true, _param.align);
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                ptrdiff_t beg, end;
+                float center, sum = 1.0f;
+                if (method == SimdResizeMethodBicubic)
+                {
+                    center = (float(i) + 0.5f) * scale - 0.5f;
+                    beg = (ptrdiff_t)::floor(center) - 1;
+                    end = beg + 4;
+                }
+                else
+                {
+                    center = (float(i) + 0.5f) * scale;
+                    beg = Simd::Max<ptrdiff_t>(ptrdiff_t(center - support + 0.5f), 0);
+                    end = Simd::Min<ptrdiff_t>(ptrdiff_t(center + support + 0.5f), srcSize);
+                    center -= 0.5f;
+                    sum = 0.0f;
+                    for (ptrdiff_t s = beg; s < end; ++s)
+                        sum += method == SimdResizeMethodLanczos ? ResizerLanczos((float(s) - center) / filterScale) : ResizerCubic((float(s) - center) / filterScale, -0.5f);
+                }
+                ptrdiff_t start = Simd::Min(Simd::Max<ptrdiff_t>(beg, 0), ptrdiff_t(srcSize - kernel));
+                index[i] = int32_t(start);
+                for (ptrdiff_t s = beg; s < end; ++s)
+                {
+                    float w;
+                    if (method == SimdResizeMethodBicubic)
+                        w = ResizerCubic(float(s) - center, -0.75f);
+                    else if (method == SimdResizeMethodLanczos)
+                        w = ResizerLanczos((float(s) - center) / filterScale) / sum;
+                    else
+                        w = ResizerCubic((float(s) - center) / filterScale, -0.5f) / sum;
+                    ptrdiff_t pos = Simd::RestrictRange<ptrdiff_t>(s, 0, srcSize - 1) - start;
+                    assert(pos >= 0 && pos < (ptrdiff_t)kernel);
+                    weight[i * kernel + pos] += w;
+                }
+            }
+        }
+
+        void ResizerFilter::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            size_t cn = _param.channels, srcRow = _param.srcW * cn, dstRow = _param.dstW * cn;
+            Array32f buf(srcRow, false, _param.align);
+            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            {
+                _vertical(src + _iy[dy] * srcStride, srcStride, srcRow, _ay.data + dy * _ky, _ky, buf.data);
+                _horizontal(buf.data, _ix.data, _ax.data, _kx, cn, dstRow, dst);
+            }
+        }
+    }
+}
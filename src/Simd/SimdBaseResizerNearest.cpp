@@ -0,0 +1,122 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<size_t N> SIMD_INLINE void ResizerNearestRow(const uint8_t * src, const int32_t * ix, size_t width, uint8_t * dst)
+        {
+            for (size_t dx = 0; dx < width; dx++, dst += N)
+                memcpy(dst, src + ix[dx], N);
+        }
+
+        ResizerNearest::ResizerNearest(const ResParam & param)
+            : Resizer(param)
+        {
+            switch (_param.type)
+            {
+            case SimdResizeChannelByte: _pixelSize = _param.channels; break;
+            case SimdResizeChannelShort: _pixelSize = _param.channels * 2; break;
+            case SimdResizeChannelFloat: _pixelSize = _param.channels * 4; break;
+            default: assert(0);
+            }
+            _iy.Resize(_param.dstH, false, _param.align);
+            EstimateIndex(_param.srcH, _param.dstH, 1, _iy.data);
+            _ix.Resize(_param.dstW, false, _param.align);
+            EstimateIndex(_param.srcW, _param.dstW, _pixelSize, _ix.data);
+        }
+
+        void ResizerNearest::EstimateIndex(size_t srcSize, size_t dstSize, size_t pixelSize, int32_t * indices)
+        {
+            for (size_t i = 0; i < dstSize; ++i)
+                indices[i] = int32_t(Simd::Min(i * srcSize / dstSize, srcSize - 1) * pixelSize);
+        }
+
+        bool ResizerNearest::EstimateBlocks(size_t window, size_t granule, size_t loads, size_t & pixels, Array32i & offsets, Array32i & indices) const
+        {
+            size_t ps = _pixelSize, dstW = _param.dstW, srcRow = _param.srcW * ps, region = window * loads;
+            if (ps % granule || ps > window)
+                return false;
+            size_t n = window / ps, size = window / granule;
+            if (dstW < n || srcRow < region)
+                return false;
+            size_t blocks = DivHi(dstW, n);
+            Array32i o(blocks * 2), i(blocks * size);
+            for (size_t b = 0; b < blocks; ++b)
+            {
+                size_t p = Simd::Min(b * n, dstW - n);
+                size_t lo = Simd::Min<size_t>(_ix[p], srcRow - region);
+                if (_ix[p + n - 1] + ps > lo + region)
+                    return false;
+                o[2 * b + 0] = int32_t(p * ps);
+                o[2 * b + 1] = int32_t(lo);
+                int32_t * idx = i.data + b * size;
+                for (size_t e = 0; e < size; ++e)
+                    idx[e] = -1;
+                for (size_t j = 0; j < n; ++j)
+                    for (size_t g = 0; g < ps / granule; ++g)
+                        idx[j * ps / granule + g] = int32_t((_ix[p + j] - lo) / granule + g);
+            }
+            pixels = n;
+            offsets.Swap(o);
+            indices.Swap(i);
+            return true;
+        }
+
+        void ResizerNearest::RunRow(const uint8_t * src, uint8_t * dst)
+        {
+            const int32_t * ix = _ix.data;
+            size_t width = _param.dstW;
+            switch (_pixelSize)
+            {
+            case 1: ResizerNearestRow<1>(src, ix, width, dst); break;
+            case 2: ResizerNearestRow<2>(src, ix, width, dst); break;
+            case 3: ResizerNearestRow<3>(src, ix, width, dst); break;
+            case 4: ResizerNearestRow<4>(src, ix, width, dst); break;
+            case 6: ResizerNearestRow<6>(src, ix, width, dst); break;
+            case 8: ResizerNearestRow<8>(src, ix, width, dst); break;
+            case 12: ResizerNearestRow<12>(src, ix, width, dst); break;
+            case 16: ResizerNearestRow<16>(src, ix, width, dst); break;
+            default:
+                for (size_t dx = 0; dx < width; dx++, dst += _pixelSize)
+                    memcpy(dst, src + ix[dx], _pixelSize);
+            }
+        }
+
+        void ResizerNearest::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            size_t rowSize = _param.dstW * _pixelSize;
+            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            {
+                if (dy && _iy[dy] == _iy[dy - 1])
+                    memcpy(dst, dst - dstStride, rowSize);
+                else
+                    RunRow(src + _iy[dy] * srcStride, dst);
+            }
+        }
+    }
+}
@@ -0,0 +1,120 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdRuntime.h"
+#include "Simd/SimdCpu.h"
+
+#include <fstream>
+#include <cstdlib>
+
+namespace Simd
+{
+    namespace Base
+    {
+        RuntimeCache & RuntimeCache::Global()
+        {
+            static RuntimeCache cache;
+            return cache;
+        }
+
+        RuntimeCache::RuntimeCache()
+            : _cpu(CpuModel())
+        {
+            const char * path = ::getenv("SIMD_RUNTIME_CACHE");
+            if (path)
+                Load(path);
+        }
+
+        bool RuntimeCache::Find(const String & key, String & best) const
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            Map::const_iterator it = _map.find(_cpu + "|" + key);
+            if (it == _map.end())
+                return false;
+            best = it->second;
+            return true;
+        }
+
+        void RuntimeCache::Add(const String & key, const String & best)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _map[_cpu + "|" + key] = best;
+        }
+
+        void RuntimeCache::Clear()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _map.clear();
+        }
+
+        String RuntimeCache::Export() const
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            std::stringstream ss;
+            for (Map::const_iterator it = _map.begin(); it != _map.end(); ++it)
+                ss << it->first << "|" << it->second << std::endl;
+            return ss.str();
+        }
+
+        bool RuntimeCache::Import(const String & data)
+        {
+            Map map;
+            std::stringstream ss(data);
+            String line;
+            while (std::getline(ss, line))
+            {
+                if (line.size() && line.back() == '\r')
+                    line.pop_back();
+                if (line.empty() || line[0] == '#')
+                    continue;
+                size_t pos = line.rfind('|');
+                if (pos == String::npos || pos == 0 || pos + 1 == line.size())
+                    return false;
+                map[line.substr(0, pos)] = line.substr(pos + 1);
+            }
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (Map::const_iterator it = map.begin(); it != map.end(); ++it)
+                _map[it->first] = it->second;
+            return true;
+        }
+
+        bool RuntimeCache::Save(const String & path) const
+        {
+            std::ofstream ofs(path.c_str());
+            if (!ofs.is_open())
+                return false;
+            ofs << Export();
+            return ofs.good();
+        }
+
+        bool RuntimeCache::Load(const String & path)
+        {
+            std::ifstream ifs(path.c_str());
+            if (!ifs.is_open())
+                return false;
+            std::stringstream ss;
+            ss << ifs.rdbuf();
+            return Import(ss.str());
+        }
+    }
+}
@@ -22,9 +22,12 @@
 * SOFTWARE.
 */
 #include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdConversion.h"
 #include "Simd/SimdSynet.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdCpu.h"
 
 namespace Simd
 {
@@ -153,10 +156,10 @@ namespace Simd
             return src[2 - channel];
         }
 
-        template<SimdPixelFormatType format, size_t step> void SynetSetInputNchw3(const uint8_t* src, size_t width, size_t height, size_t stride, const float* scale, const float* shift, float* dst0)
+        template<SimdPixelFormatType format, size_t step> void SynetSetInputNchw3(const uint8_t* src, size_t width, size_t height, size_t stride, const float* scale, const float* shift, float* dst0, size_t channel)
         {
-            float* dst1 = dst0 + width * height;
-            float* dst2 = dst1 + width * height;
+            float* dst1 = dst0 + channel;
+            float* dst2 = dst1 + channel;
             for (size_t y = 0; y < height; ++y)
             {
                 for (size_t x = 0; x < width; ++x, src += step)
@@ -183,8 +186,8 @@ namespace Simd
             }
         }
 
-        void SynetSetInput(const uint8_t* src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
-            const float* lower, const float* upper, float* dst, size_t channels, SimdTensorFormatType dstFormat)
+        void SynetSetInputRows(const uint8_t* src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+            const float* lower, const float* upper, float* dst, size_t plane, size_t channels, SimdTensorFormatType dstFormat)
         {
             float scale[3];
             for (size_t i = 0; i < channels; ++i)
@@ -207,10 +210,10 @@ namespace Simd
                 case SimdTensorFormatNchw:
                     switch (srcFormat)
                     {
-                    case SimdPixelFormatGray8: SynetSetInputNchw3<SimdPixelFormatGray8, 1>(src, width, height, stride, scale, lower, dst); return;
-                    case SimdPixelFormatBgr24: SynetSetInputNchw3<SimdPixelFormatBgr24, 3>(src, width, height, stride, scale, lower, dst); return;
-                    case SimdPixelFormatBgra32: SynetSetInputNchw3<SimdPixelFormatBgr24, 4>(src, width, height, stride, scale, lower, dst); return;
-                    case SimdPixelFormatRgb24: SynetSetInputNchw3<SimdPixelFormatRgb24, 3>(src, width, height, stride, scale, lower, dst); return;
+                    case SimdPixelFormatGray8: SynetSetInputNchw3<SimdPixelFormatGray8, 1>(src, width, height, stride, scale, lower, dst, plane); return;
+                    case SimdPixelFormatBgr24: SynetSetInputNchw3<SimdPixelFormatBgr24, 3>(src, width, height, stride, scale, lower, dst, plane); return;
+                    case SimdPixelFormatBgra32: SynetSetInputNchw3<SimdPixelFormatBgr24, 4>(src, width, height, stride, scale, lower, dst, plane); return;
+                    case SimdPixelFormatRgb24: SynetSetInputNchw3<SimdPixelFormatRgb24, 3>(src, width, height, stride, scale, lower, dst, plane); return;
                     default: assert(0);
                     }
                     break;
@@ -230,6 +233,257 @@ namespace Simd
             }
         }
 
+        void SynetSetInput(const uint8_t* src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+            const float* lower, const float* upper, float* dst, size_t channels, SimdTensorFormatType dstFormat)
+        {
+            SynetSetInputRows(src, width, height, stride, srcFormat, lower, upper, dst, width * height, channels, dstFormat);
+        }
+
+        //---------------------------------------------------------------------
+
+        class SynetSetInputBatchIndex
+        {
+            Array32i _index;
+            Array32f _weight;
+            float _extent, _fraction, _first, _last;
+            ptrdiff_t _offset;
+            bool _valid;
+
+        public:
+            SynetSetInputBatchIndex(size_t dstSize)
+                : _index(dstSize)
+                , _weight(dstSize)
+                , _valid(false)
+            {
+            }
+
+            const int32_t * Index() const { return _index.data; }
+            const float * Weight() const { return _weight.data; }
+
+            // Fills offsets (relative to returned origin and multiplied by step) and weights for region [begin, end).
+            // The tables depend only on extent and fractional offset of region, so they are reused while region lies inside the image.
+            size_t Init(size_t srcSize, float begin, float end, size_t step)
+            {
+                size_t dstSize = _index.size;
+                float origin = ::floor(begin), fraction = begin - origin, extent = end - begin;
+                if (_valid && extent == _extent && fraction == _fraction && origin + _first >= 0.0f && origin + _last < float(srcSize - 1))
+                    return size_t(ptrdiff_t(origin) + _offset);
+                float scale = extent / dstSize;
+                for (size_t i = 0; i < dstSize; ++i)
+                {
+                    float pos = Simd::RestrictRange(origin + (fraction + (i + 0.5f) * scale - 0.5f), 0.0f, float(srcSize - 1));
+                    int idx = Simd::Min((int)pos, (int)srcSize - 2);
+                    _index[i] = idx;
+                    _weight[i] = pos - idx;
+                }
+                int32_t first = _index[0];
+                for (size_t i = 0; i < dstSize; ++i)
+                    _index[i] = int32_t((_index[i] - first) * step);
+                _first = fraction + 0.5f * scale - 0.5f;
+                _last = fraction + (dstSize - 0.5f) * scale - 0.5f;
+                _valid = origin + _first >= 0.0f && origin + _last < float(srcSize - 1);
+                _extent = extent;
+                _fraction = fraction;
+                _offset = first - ptrdiff_t(origin);
+                return first;
+            }
+        };
+
+        void SynetSetInputBatchVertical(const uint8_t * src0, const uint8_t * src1, size_t size, float weight, float * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = float(src0[i]) + float(src1[i] - src0[i]) * weight;
+        }
+
+        void SynetSetInputBatchHorizontal(const float * src, const int32_t * offset, const float * weight, size_t width, size_t step, float coef, float shift, float * dst, bool accumulate)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                const float * ps = src + offset[x];
+                float value = (ps[0] + (ps[step] - ps[0]) * weight[x]) * coef;
+                dst[x] = accumulate ? dst[x] + value : value + shift;
+            }
+        }
+
+        void SynetSetInputBatch(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+            const float * rois, size_t count, size_t dstWidth, size_t dstHeight, const float * lower, const float * upper, float * dst, 
+            size_t channels, SimdTensorFormatType dstFormat, SynetSetInputBatchVerticalPtr vertical, SynetSetInputBatchHorizontalPtr horizontal)
+        {
+            assert(width >= 2 && height >= 2 && (channels == 1 || channels == 3));
+
+            size_t srcChannels = 0;
+            int map[3] = { 0, 1, 2 };
+            switch (srcFormat)
+            {
+            case SimdPixelFormatGray8: srcChannels = 1; map[1] = 0, map[2] = 0; break;
+            case SimdPixelFormatBgr24: srcChannels = 3; break;
+            case SimdPixelFormatBgra32: srcChannels = 4; break;
+            case SimdPixelFormatRgb24: srcChannels = 3; map[0] = 2, map[2] = 0; break;
+            default: assert(0); return;
+            }
+            // Colour source is converted to gray before interpolation with the same BgrToGray as SynetSetInput uses.
+            bool toGray = channels == 1 && srcChannels > 1;
+            size_t step = toGray ? 1 : srcChannels;
+            float coefs[3][3] = { { 0 } };
+            for (size_t c = 0; c < channels; ++c)
+                coefs[c][toGray ? 0 : map[c]] = (upper[c] - lower[c]) / 255.0f;
+
+            size_t dstSize = dstWidth * dstHeight;
+            SynetSetInputBatchIndex bx(dstWidth), by(dstHeight);
+            Array8u gray(toGray ? 2 * width : 0);
+            Array32f buf(width * step), tmp(dstFormat == SimdTensorFormatNhwc ? dstWidth * channels : 0);
+            for (size_t n = 0; n < count; ++n, rois += 4, dst += dstSize * channels)
+            {
+                size_t x0 = bx.Init(width, Simd::Min(rois[0], rois[2]), Simd::Max(rois[0], rois[2]), step);
+                size_t y0 = by.Init(height, Simd::Min(rois[1], rois[3]), Simd::Max(rois[1], rois[3]), 1);
+                const int32_t * ix = bx.Index(), * iy = by.Index();
+                const float * fx = bx.Weight(), * fy = by.Weight();
+                size_t size = ix[dstWidth - 1] + 2 * step;
+                for (size_t y = 0; y < dstHeight; ++y)
+                {
+                    const uint8_t * src0 = src + (y0 + iy[y]) * stride + x0 * srcChannels;
+                    size_t srcStride = stride;
+                    if (toGray)
+                    {
+                        switch (srcFormat)
+                        {
+                        case SimdPixelFormatBgr24: BgrToGray(src0, size, 2, stride, gray.data, width); break;
+                        case SimdPixelFormatBgra32: BgraToGray(src0, size, 2, stride, gray.data, width); break;
+                        case SimdPixelFormatRgb24: RgbToGray(src0, size, 2, stride, gray.data, width); break;
+                        default: assert(0);
+                        }
+                        src0 = gray.data;
+                        srcStride = width;
+                    }
+                    vertical(src0, src0 + srcStride, size, fy[y], buf.data);
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        float * pd = dstFormat == SimdTensorFormatNchw ? dst + c * dstSize + y * dstWidth : tmp.data + c * dstWidth;
+                        bool accumulate = false;
+                        for (size_t k = 0; k < 3; ++k)
+                        {
+                            if (coefs[c][k] == 0.0f)
+                                continue;
+                            horizontal(buf.data + k, ix, fx, dstWidth, step, coefs[c][k], lower[c], pd, accumulate);
+                            accumulate = true;
+                        }
+                        if (!accumulate)
+                            for (size_t x = 0; x < dstWidth; ++x)
+                                pd[x] = lower[c];
+                    }
+                    if (dstFormat == SimdTensorFormatNhwc)
+                    {
+                        float * pd = dst + y * dstWidth * channels;
+                        for (size_t x = 0; x < dstWidth; ++x)
+                            for (size_t c = 0; c < channels; ++c)
+                                *pd++ = tmp[c * dstWidth + x];
+                    }
+                }
+            }
+        }
+
+        void SynetSetInputBatch(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+            const float * rois, size_t count, size_t dstWidth, size_t dstHeight, const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat)
+        {
+            SynetSetInputBatch(src, width, height, stride, srcFormat, rois, count, dstWidth, dstHeight, lower, upper, dst, channels, dstFormat,
+                SynetSetInputBatchVertical, SynetSetInputBatchHorizontal);
+        }
+
+        //---------------------------------------------------------------------
+
+        SynetSetInputContext::SynetSetInputContext(Resizer * resizer, SynetSetInputRowsPtr setInput, size_t srcHeight, size_t width, size_t height, SimdPixelFormatType format, size_t pixelSize,
+            size_t left, size_t top, size_t innerHeight, const float * lower, const float * upper, size_t channels, SimdTensorFormatType dstFormat, uint8_t padding)
+            : _resizer(resizer)
+            , _setInput(setInput)
+            , _srcHeight(srcHeight)
+            , _width(width)
+            , _height(height)
+            , _stride(width * pixelSize)
+            , _offset(top * width * pixelSize + left * pixelSize)
+            , _top(top)
+            , _innerHeight(innerHeight)
+            , _ready(0)
+            , _channels(channels)
+            , _format(format)
+            , _dstFormat(dstFormat)
+        {
+            for (size_t c = 0; c < channels; ++c)
+            {
+                _lower[c] = lower[c];
+                _upper[c] = upper[c];
+            }
+            _buffer.Resize(_height * _stride);
+            memset(_buffer.data, padding, _buffer.size);
+            size_t band = Simd::Max<size_t>(AlgCacheL1() / (_width * _channels * sizeof(float)), 1);
+            _srcStep = Simd::Max<size_t>(_srcHeight * band / _innerHeight, 1);
+        }
+
+        SynetSetInputContext::~SynetSetInputContext()
+        {
+            delete _resizer;
+        }
+
+        void SynetSetInputContext::Run(const uint8_t * src, size_t srcStride, float * dst)
+        {
+            for (size_t row = 0; row < _srcHeight; row += _srcStep)
+                RunRows(src, srcStride, row, Simd::Min(row + _srcStep, _srcHeight), dst);
+        }
+
+        size_t SynetSetInputContext::RunRows(const uint8_t * src, size_t srcStride, size_t srcRowBeg, size_t srcRowEnd, float * dst)
+        {
+            if (srcRowBeg == 0)
+            {
+                _ready = 0;
+                SetRows(0, _top, dst);
+                SetRows(_top + _innerHeight, _height, dst);
+            }
+            size_t ready = _resizer->RunRows(src, srcStride, srcRowBeg, srcRowEnd, _buffer.data + _offset, _stride);
+            SetRows(_top + _ready, _top + ready, dst);
+            _ready = Simd::Max(_ready, ready);
+            return _ready < _innerHeight ? _top + _ready : _height;
+        }
+
+        void SynetSetInputContext::SetRows(size_t yBeg, size_t yEnd, float * dst)
+        {
+            if (yBeg >= yEnd)
+                return;
+            size_t offset = yBeg * _width * (_dstFormat == SimdTensorFormatNhwc ? _channels : 1);
+            _setInput(_buffer.data + yBeg * _stride, _width, yEnd - yBeg, _stride, _format, _lower, _upper, dst + offset, _width * _height, _channels, _dstFormat);
+        }
+
+        void * SynetSetInputInit(size_t srcWidth, size_t srcHeight, SimdPixelFormatType srcFormat, size_t dstWidth, size_t dstHeight,
+            const float * lower, const float * upper, size_t channels, SimdTensorFormatType dstFormat, SimdResizeMethodType method, SimdBool letterbox, uint8_t padding,
+            ResizerInitPtr resizerInit, SynetSetInputRowsPtr setInput)
+        {
+            size_t pixelSize = 0;
+            switch (srcFormat)
+            {
+            case SimdPixelFormatGray8: pixelSize = 1; break;
+            case SimdPixelFormatBgr24: pixelSize = 3; break;
+            case SimdPixelFormatBgra32: pixelSize = 4; break;
+            case SimdPixelFormatRgb24: pixelSize = 3; break;
+            default: return NULL;
+            }
+            if (srcWidth == 0 || srcHeight == 0 || dstWidth == 0 || dstHeight == 0 || (channels != 1 && channels != 3) ||
+                (dstFormat != SimdTensorFormatNchw && dstFormat != SimdTensorFormatNhwc))
+                return NULL;
+
+            size_t left = 0, top = 0, innerW = dstWidth, innerH = dstHeight;
+            if (letterbox)
+            {
+                double scale = Simd::Min(double(dstWidth) / srcWidth, double(dstHeight) / srcHeight);
+                innerW = Simd::Min(Simd::Max<size_t>(size_t(srcWidth * scale + 0.5), 1), dstWidth);
+                innerH = Simd::Min(Simd::Max<size_t>(size_t(srcHeight * scale + 0.5), 1), dstHeight);
+                left = (dstWidth - innerW) / 2;
+                top = (dstHeight - innerH) / 2;
+            }
+
+            Resizer * resizer = (Resizer*)resizerInit(srcWidth, srcHeight, innerW, innerH, pixelSize, SimdResizeChannelByte, method);
+            if (resizer == NULL)
+                return NULL;
+            return new SynetSetInputContext(resizer, setInput, srcHeight, dstWidth, dstHeight, srcFormat, pixelSize, left, top, innerH, lower, upper, channels, dstFormat, padding);
+        }
+
         //---------------------------------------------------------------------
 
         template<size_t N> SIMD_INLINE void Copy(const float * src, float * dst)
@@ -33,7 +33,8 @@ namespace Simd
     Base::PerformanceMeasurer * SynetConvolution32f::Perf(const char* func)
     {
         if (_perf == NULL)
-            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop());
+            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop(),
+                (Param().SizeS() + Param().SizeW() + Param().SizeD()) * sizeof(float));
         return _perf;
     }
 #endif
@@ -1,7 +1,7 @@
 /*
 * Simd Library (http://ermig1979.github.io/Simd).
 *
-* Copyright (c) 2011-2018 Yermalayeu Ihar.
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
 *
 * Permission is hereby granted, free of charge, to any person obtaining a copy
 * of this software and associated documentation files (the "Software"), to deal
@@ -23,23 +23,46 @@
 */
 #include "Simd/SimdMath.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 #include <thread>
+#include <atomic>
 
 namespace Simd
 {
     namespace Base
     {
-        size_t g_threadNumber = 1;
+        std::atomic<size_t> g_threadNumber(1);
 
         size_t GetThreadNumber()
         {
-            return g_threadNumber;
+            return g_threadNumber.load(std::memory_order_relaxed);
         }
 
         void SetThreadNumber(size_t threadNumber)
         {
-            g_threadNumber = Simd::RestrictRange<size_t>(threadNumber, 1, std::thread::hardware_concurrency());
+            ForceThreadNumber(Simd::RestrictRange<size_t>(threadNumber, 1, Simd::Max<size_t>(std::thread::hardware_concurrency(), 1)));
+        }
+
+        void ForceThreadNumber(size_t threadNumber)
+        {
+            threadNumber = Simd::Max<size_t>(threadNumber, 1);
+            g_threadNumber.store(threadNumber, std::memory_order_relaxed);
+#ifndef SIMD_FUTURE_DISABLE
+            Simd::ThreadPool::Global().Resize(Simd::Min<size_t>(threadNumber, Simd::Max<size_t>(std::thread::hardware_concurrency(), 1)) - 1);
+#endif
+        }
+
+        std::atomic<size_t> g_parallelThreshold(512 * 512);
+
+        size_t GetParallelThreshold()
+        {
+            return g_parallelThreshold.load(std::memory_order_relaxed);
+        }
+
+        void SetParallelThreshold(size_t threshold)
+        {
+            g_parallelThreshold.store(threshold, std::memory_order_relaxed);
         }
     }
 }
@@ -0,0 +1,175 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdTrace.h"
+#include "Simd/SimdTime.h"
+
+#include <vector>
+#include <list>
+#include <mutex>
+#include <fstream>
+#include <iomanip>
+
+namespace Simd
+{
+    namespace Base
+    {
+        std::atomic<const TraceSink*> g_traceSink(NULL);
+
+        void SetTraceCallback(SimdTraceCallbackPtr callback, void * userData)
+        {
+            // Sinks are immutable and never freed: a region may still hold the previous one.
+            // Equal pairs are shared, so the list only grows with distinct callbacks.
+            static std::mutex mutex;
+            static std::list<TraceSink> sinks;
+            const TraceSink * sink = NULL;
+            if (callback)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                for (std::list<TraceSink>::const_iterator it = sinks.begin(); it != sinks.end() && sink == NULL; ++it)
+                    if (it->callback == callback && it->userData == userData)
+                        sink = &*it;
+                if (sink == NULL)
+                {
+                    TraceSink value = { callback, userData };
+                    sinks.push_back(value);
+                    sink = &sinks.back();
+                }
+            }
+            g_traceSink.store(sink);
+        }
+
+        size_t TraceThread()
+        {
+            static std::atomic<size_t> counter(0);
+            static thread_local size_t thread = counter++;
+            return thread;
+        }
+
+        void TraceEvent(SimdTraceEventType type, const char * name, int64_t size)
+        {
+            const TraceSink * sink = g_traceSink.load();
+            if (sink)
+                sink->callback(sink->userData, type, name, TraceThread(), size);
+        }
+
+        //---------------------------------------------------------------------
+
+        class ChromeTrace
+        {
+            struct Event
+            {
+                SimdTraceEventType type;
+                std::string name;
+                size_t thread;
+                int64_t time, size;
+            };
+
+            std::mutex _mutex;
+            std::vector<Event> _events;
+            std::ofstream _file;
+            int64_t _start;
+
+            static void Callback(void * userData, SimdTraceEventType type, const char * name, size_t thread, int64_t size)
+            {
+                ChromeTrace * trace = (ChromeTrace*)userData;
+                Event event = { type, name, thread, TimeCounter() - trace->_start, size };
+                std::lock_guard<std::mutex> lock(trace->_mutex);
+                trace->_events.push_back(event);
+            }
+
+            static void Write(std::ostream & os, const std::string & name)
+            {
+                for (size_t i = 0; i < name.size(); ++i)
+                {
+                    char c = name[i];
+                    if (c == '"' || c == '\\')
+                        os << '\\' << c;
+                    else if ((unsigned char)c < 0x20)
+                        os << ' ';
+                    else
+                        os << c;
+                }
+            }
+
+        public:
+            bool Start(const char * path)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_file.is_open())
+                    return false;
+                _file.open(path);
+                if (!_file.is_open())
+                    return false;
+                _events.clear();
+                _start = TimeCounter();
+                SetTraceCallback(Callback, this);
+                return true;
+            }
+
+            bool Stop()
+            {
+                const TraceSink * sink = g_traceSink.load();
+                if (sink && sink->callback == Callback)
+                    SetTraceCallback(NULL, NULL);
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_file.is_open())
+                    return false;
+                double scale = 1000000.0 / double(TimeFrequency());
+                _file << "{\"traceEvents\": [" << std::endl;
+                for (size_t i = 0; i < _events.size(); ++i)
+                {
+                    const Event & e = _events[i];
+                    _file << "  {\"name\": \"";
+                    Write(_file, e.name);
+                    _file << "\", \"cat\": \"Simd\", \"ph\": \"" << (e.type == SimdTraceEventBegin ? "B" : "E") << "\", \"pid\": 0, \"tid\": " << e.thread;
+                    _file << ", \"ts\": " << std::fixed << std::setprecision(3) << double(e.time) * scale;
+                    if (e.type == SimdTraceEventBegin && e.size)
+                        _file << ", \"args\": {\"size\": " << e.size << "}";
+                    _file << (i + 1 < _events.size() ? "}," : "}") << std::endl;
+                }
+                _file << "], \"displayTimeUnit\": \"ms\"}" << std::endl;
+                bool result = _file.good();
+                _file.close();
+                _events.clear();
+                return result;
+            }
+
+            static ChromeTrace & Global()
+            {
+                static ChromeTrace trace;
+                return trace;
+            }
+        };
+
+        bool ChromeTraceStart(const char * path)
+        {
+            return ChromeTrace::Global().Start(path);
+        }
+
+        bool ChromeTraceStop()
+        {
+            return ChromeTrace::Global().Stop();
+        }
+    }
+}
@@ -0,0 +1,224 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdDefs.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdWarpAffine.h"
+#include "Simd/SimdParallelRows.h"
+
+namespace Simd
+{
+    WarpAffParam::WarpAffParam(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border, size_t align)
+        : srcW(srcW)
+        , srcH(srcH)
+        , srcS(srcS)
+        , dstW(dstW)
+        , dstH(dstH)
+        , dstS(dstS)
+        , channels(channels)
+        , flags(flags)
+        , align(align)
+    {
+        for (size_t i = 0; i < 6; ++i)
+            this->mat[i] = mat ? mat[i] : 0.0f;
+        memset(this->border, 0, sizeof(this->border));
+        if (border && channels <= 4)
+            memcpy(this->border, border, PixelSize());
+    }
+
+    bool WarpAffParam::Valid() const
+    {
+        const int mask = SimdWarpAffineChannelMask | SimdWarpAffineInterpMask | SimdWarpAffineBorderMask;
+        if (channels < 1 || channels > 4 || (flags & ~mask) != 0)
+            return false;
+        if (srcW == 0 || srcH == 0 || dstW == 0 || dstH == 0 || srcS < srcW * PixelSize() || dstS < dstW * PixelSize() || srcS * srcH > INT32_MAX)
+            return false;
+        float inv[6];
+        if (!Base::WarpAffineInvert(mat, inv))
+            return false;
+        const float limit = float(1 << (29 - Base::WARP_AFFINE_BITS));
+        for (size_t i = 0; i < 4; ++i)
+        {
+            float x = (i & 1) ? float(dstW) : 0.0f, y = (i & 2) ? float(dstH) : 0.0f;
+            if (::fabs(inv[0] * x + inv[1] * y + inv[2]) >= limit || ::fabs(inv[3] * x + inv[4] * y + inv[5]) >= limit)
+                return false;
+        }
+        return true;
+    }
+
+    //---------------------------------------------------------------------
+
+    WarpAffine::WarpAffine(const WarpAffParam& param)
+        : _param(param)
+    {
+        Base::WarpAffineInvert(_param.mat, _inv);
+        _ax.Resize(_param.dstW, false, _param.align);
+        _ay.Resize(_param.dstW, false, _param.align);
+        for (size_t dx = 0; dx < _param.dstW; ++dx)
+        {
+            _ax[dx] = Base::WarpAffineFixed(double(_inv[0]) * double(dx));
+            _ay[dx] = Base::WarpAffineFixed(double(_inv[3]) * double(dx));
+        }
+    }
+
+    void WarpAffine::Run(const uint8_t* src, uint8_t* dst)
+    {
+        ParallelRows(_param.dstW, _param.dstH, 1, [=](size_t begin, size_t end)
+        {
+            RunRows(src, begin, end, dst);
+        });
+    }
+
+    //---------------------------------------------------------------------
+
+    namespace Base
+    {
+        WarpAffineNearest::WarpAffineNearest(const WarpAffParam& param)
+            : Simd::WarpAffine(param)
+        {
+        }
+
+        void WarpAffineNearest::RunRows(const uint8_t* src, size_t yBeg, size_t yEnd, uint8_t* dst)
+        {
+            Array32i index(_param.dstW, false, _param.align);
+            dst += yBeg * _param.dstS;
+            for (size_t dy = yBeg; dy < yEnd; ++dy, dst += _param.dstS)
+            {
+                int32_t bx = WarpAffineFixed(double(_inv[1]) * double(dy) + double(_inv[2]));
+                int32_t by = WarpAffineFixed(double(_inv[4]) * double(dy) + double(_inv[5]));
+                EstimateIndex(bx, by, index.data);
+                RunRow(src, index.data, dst);
+            }
+        }
+
+        void WarpAffineNearest::EstimateIndex(int32_t bx, int32_t by, int32_t* index)
+        {
+            int32_t w = (int32_t)_param.srcW, h = (int32_t)_param.srcH, s = (int32_t)_param.srcS, ps = (int32_t)_param.PixelSize();
+            bool constant = _param.IsConstant();
+            for (size_t dx = 0; dx < _param.dstW; ++dx)
+            {
+                int32_t x = (_ax[dx] + bx + WARP_AFFINE_ROUND) >> WARP_AFFINE_BITS;
+                int32_t y = (_ay[dx] + by + WARP_AFFINE_ROUND) >> WARP_AFFINE_BITS;
+                if (constant)
+                    index[dx] = (x >= 0 && x < w && y >= 0 && y < h) ? y * s + x * ps : -1;
+                else
+                    index[dx] = Simd::RestrictRange(y, 0, h - 1) * s + Simd::RestrictRange(x, 0, w - 1) * ps;
+            }
+        }
+
+        void WarpAffineNearest::RunRow(const uint8_t* src, const int32_t* index, uint8_t* dst)
+        {
+            const uint8_t* border = _param.border;
+            size_t width = _param.dstW;
+            switch (_param.PixelSize())
+            {
+            case 1: WarpAffineNearestRow<1>(src, border, index, 0, width, dst); break;
+            case 2: WarpAffineNearestRow<2>(src, border, index, 0, width, dst); break;
+            case 3: WarpAffineNearestRow<3>(src, border, index, 0, width, dst); break;
+            case 4: WarpAffineNearestRow<4>(src, border, index, 0, width, dst); break;
+            case 8: WarpAffineNearestRow<8>(src, border, index, 0, width, dst); break;
+            case 12: WarpAffineNearestRow<12>(src, border, index, 0, width, dst); break;
+            case 16: WarpAffineNearestRow<16>(src, border, index, 0, width, dst); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        WarpAffineBilinear::WarpAffineBilinear(const WarpAffParam& param)
+            : Simd::WarpAffine(param)
+        {
+        }
+
+        void WarpAffineBilinear::RunRows(const uint8_t* src, size_t yBeg, size_t yEnd, uint8_t* dst)
+        {
+            size_t width = AlignHi(_param.dstW, _param.align);
+            Array32i buf(width * 3, false, _param.align);
+            int32_t* index = buf.data, * xs = index + width, * ys = xs + width;
+            dst += yBeg * _param.dstS;
+            for (size_t dy = yBeg; dy < yEnd; ++dy, dst += _param.dstS)
+            {
+                int32_t bx = WarpAffineFixed(double(_inv[1]) * double(dy) + double(_inv[2]));
+                int32_t by = WarpAffineFixed(double(_inv[4]) * double(dy) + double(_inv[5]));
+                EstimateIndex(bx, by, index, xs, ys);
+                RunRow(src, index, xs, ys, dst);
+            }
+        }
+
+        void WarpAffineBilinear::EstimateIndex(int32_t bx, int32_t by, int32_t* index, int32_t* xs, int32_t* ys)
+        {
+            int32_t w = (int32_t)_param.srcW - 1, h = (int32_t)_param.srcH - 1, s = (int32_t)_param.srcS, ps = (int32_t)_param.PixelSize();
+            for (size_t dx = 0; dx < _param.dstW; ++dx)
+            {
+                xs[dx] = _ax[dx] + bx;
+                ys[dx] = _ay[dx] + by;
+                int32_t x = xs[dx] >> WARP_AFFINE_BITS, y = ys[dx] >> WARP_AFFINE_BITS;
+                index[dx] = (x >= 0 && x < w && y >= 0 && y < h) ? y * s + x * ps : -1;
+            }
+        }
+
+        void WarpAffineBilinear::RunRow(const uint8_t* src, const int32_t* index, const int32_t* xs, const int32_t* ys, uint8_t* dst)
+        {
+            const WarpAffParam& p = _param;
+            size_t width = _param.dstW;
+            if (_param.IsByte())
+            {
+                switch (_param.channels)
+                {
+                case 1: WarpAffineBilinearRow<uint8_t, 1>(p, src, index, xs, ys, 0, width, dst); break;
+                case 2: WarpAffineBilinearRow<uint8_t, 2>(p, src, index, xs, ys, 0, width, dst); break;
+                case 3: WarpAffineBilinearRow<uint8_t, 3>(p, src, index, xs, ys, 0, width, dst); break;
+                case 4: WarpAffineBilinearRow<uint8_t, 4>(p, src, index, xs, ys, 0, width, dst); break;
+                default:
+                    assert(0);
+                }
+            }
+            else
+            {
+                switch (_param.channels)
+                {
+                case 1: WarpAffineBilinearRow<float, 1>(p, src, index, xs, ys, 0, width, dst); break;
+                case 2: WarpAffineBilinearRow<float, 2>(p, src, index, xs, ys, 0, width, dst); break;
+                case 3: WarpAffineBilinearRow<float, 3>(p, src, index, xs, ys, 0, width, dst); break;
+                case 4: WarpAffineBilinearRow<float, 4>(p, src, index, xs, ys, 0, width, dst); break;
+                default:
+                    assert(0);
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            WarpAffParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, mat, flags, border, sizeof(void*));
+            if (mat == NULL || !param.Valid())
+                return NULL;
+            if (param.IsNearest())
+                return new WarpAffineNearest(param);
+            else
+                return new WarpAffineBilinear(param);
+        }
+    }
+}
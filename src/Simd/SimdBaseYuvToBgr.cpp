@@ -22,6 +22,7 @@
 * SOFTWARE.
 */
 #include "Simd/SimdConversion.h"
+#include "Simd/SimdYuvToBgr.h"
 
 namespace Simd
 {
@@ -142,5 +143,312 @@ namespace Simd
                 rgb += rgbStride;
             }
         }
+
+        //---------------------------------------------------------------------
+
+        template<class T, size_t N, bool rgb> SIMD_INLINE void YuvToAny(int y, int u, int v, int alpha, uint8_t * dst)
+        {
+            dst[rgb ? 2 : 0] = YuvToBlue<T>(y, u);
+            dst[1] = YuvToGreen<T>(y, u, v);
+            dst[rgb ? 0 : 2] = YuvToRed<T>(y, v);
+            if (N == 4)
+                dst[3] = alpha;
+        }
+
+        template<class T, size_t N, bool rgb, int sx, int sy> void YuvToAnyV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, 
+            const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % (1 << sx) == 0) && (height % (1 << sy) == 0));
+
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint8_t * u0 = u + (row >> sy) * uStride;
+                const uint8_t * v0 = v + (row >> sy) * vStride;
+                for (size_t col = 0; col < width; ++col)
+                    YuvToAny<T, N, rgb>(y[col], u0[col >> sx], v0[col >> sx], alpha, dst + col * N);
+                y += yStride;
+                dst += dstStride;
+            }
+        }
+
+        template<size_t N, bool rgb, int sx, int sy> void YuvToAnyV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride,
+            const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: YuvToAnyV2<Bt601, N, rgb, sx, sy>(y, yStride, u, uStride, v, vStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: YuvToAnyV2<Bt709, N, rgb, sx, sy>(y, yStride, u, uStride, v, vStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt601Full: YuvToAnyV2<Bt601Full, N, rgb, sx, sy>(y, yStride, u, uStride, v, vStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709Full: YuvToAnyV2<Bt709Full, N, rgb, sx, sy>(y, yStride, u, uStride, v, vStride, width, height, dst, dstStride, alpha); break;
+            default: assert(0);
+            }
+        }
+
+        void Yuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<4, false, 1, 1>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Yuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<4, false, 1, 0>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Yuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<4, false, 0, 0>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Yuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<3, false, 1, 1>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, 0, yuvType);
+        }
+
+        void Yuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<3, false, 1, 0>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, 0, yuvType);
+        }
+
+        void Yuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<3, false, 0, 0>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, 0, yuvType);
+        }
+
+        void Yuv420pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<3, true, 1, 1>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, 0, yuvType);
+        }
+
+        void Yuv422pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<3, true, 1, 0>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, 0, yuvType);
+        }
+
+        void Yuv444pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<3, true, 0, 0>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, 0, yuvType);
+        }
+
+        //---------------------------------------------------------------------
+
+        template<class T, size_t N, bool rgb, bool nv21> void NvToAny(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            const size_t U = nv21 ? 1 : 0, V = nv21 ? 0 : 1;
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint8_t * uv0 = uv + (row >> 1) * uvStride;
+                for (size_t col = 0; col < width; col += 2)
+                {
+                    YuvToAny<T, N, rgb>(y[col + 0], uv0[col + U], uv0[col + V], alpha, dst + (col + 0) * N);
+                    YuvToAny<T, N, rgb>(y[col + 1], uv0[col + U], uv0[col + V], alpha, dst + (col + 1) * N);
+                }
+                y += yStride;
+                dst += dstStride;
+            }
+        }
+
+        template<size_t N, bool rgb, bool nv21> void NvToAny(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: NvToAny<Bt601, N, rgb, nv21>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: NvToAny<Bt709, N, rgb, nv21>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt601Full: NvToAny<Bt601Full, N, rgb, nv21>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709Full: NvToAny<Bt709Full, N, rgb, nv21>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            default: assert(0);
+            }
+        }
+
+        void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            NvToAny<4, false, false>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            NvToAny<3, false, false>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, 0, yuvType);
+        }
+
+        void Nv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            NvToAny<3, true, false>(y, yStride, uv, uvStride, width, height, rgb, rgbStride, 0, yuvType);
+        }
+
+        void Nv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            NvToAny<4, false, true>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height,
+            uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            NvToAny<3, false, true>(y, yStride, vu, vuStride, width, height, bgr, bgrStride, 0, yuvType);
+        }
+
+        void Nv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height,
+            uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            NvToAny<3, true, true>(y, yStride, vu, vuStride, width, height, rgb, rgbStride, 0, yuvType);
+        }
+
+        //---------------------------------------------------------------------
+
+        template<class T, size_t N, bool rgb, bool uyvy> void PackedYuvToAny(const uint8_t * src, size_t srcStride,
+            size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            assert(width % 2 == 0);
+
+            const size_t Y = uyvy ? 1 : 0, U = uyvy ? 0 : 1, V = uyvy ? 2 : 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint8_t * s = src;
+                for (size_t col = 0; col < width; col += 2, s += 4)
+                {
+                    YuvToAny<T, N, rgb>(s[Y + 0], s[U], s[V], alpha, dst + (col + 0) * N);
+                    YuvToAny<T, N, rgb>(s[Y + 2], s[U], s[V], alpha, dst + (col + 1) * N);
+                }
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        template<size_t N, bool rgb, bool uyvy> void PackedYuvToAny(const uint8_t * src, size_t srcStride,
+            size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: PackedYuvToAny<Bt601, N, rgb, uyvy>(src, srcStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: PackedYuvToAny<Bt709, N, rgb, uyvy>(src, srcStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt601Full: PackedYuvToAny<Bt601Full, N, rgb, uyvy>(src, srcStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709Full: PackedYuvToAny<Bt709Full, N, rgb, uyvy>(src, srcStride, width, height, dst, dstStride, alpha); break;
+            default: assert(0);
+            }
+        }
+
+        void YuyvToBgra(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            PackedYuvToAny<4, false, false>(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void YuyvToBgr(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            PackedYuvToAny<3, false, false>(yuyv, yuyvStride, width, height, bgr, bgrStride, 0, yuvType);
+        }
+
+        void YuyvToRgb(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            PackedYuvToAny<3, true, false>(yuyv, yuyvStride, width, height, rgb, rgbStride, 0, yuvType);
+        }
+
+        void UyvyToBgra(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            PackedYuvToAny<4, false, true>(uyvy, uyvyStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void UyvyToBgr(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+            uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            PackedYuvToAny<3, false, true>(uyvy, uyvyStride, width, height, bgr, bgrStride, 0, yuvType);
+        }
+
+        void UyvyToRgb(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+            uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            PackedYuvToAny<3, true, true>(uyvy, uyvyStride, width, height, rgb, rgbStride, 0, yuvType);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE int Uint16ToUint8(int value, int shift)
+        {
+            return Min(value >> shift, 0xFF);
+        }
+
+        template<class T> void Yuv420p16ToBgra(const uint16_t * y, size_t yStride, const uint16_t * u, size_t uStride, const uint16_t * v, size_t vStride,
+            size_t width, size_t height, int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint16_t * u0 = u + (row >> 1) * uStride;
+                const uint16_t * v0 = v + (row >> 1) * vStride;
+                for (size_t col = 0; col < width; ++col)
+                    YuvToAny<T, 4, false>(Uint16ToUint8(y[col], shift), Uint16ToUint8(u0[col >> 1], shift), 
+                        Uint16ToUint8(v0[col >> 1], shift), alpha, bgra + col * 4);
+                y += yStride;
+                bgra += bgraStride;
+            }
+        }
+
+        void Yuv420p16ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            const uint16_t * y16 = (const uint16_t*)y, * u16 = (const uint16_t*)u, * v16 = (const uint16_t*)v;
+            yStride /= sizeof(uint16_t), uStride /= sizeof(uint16_t), vStride /= sizeof(uint16_t);
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420p16ToBgra<Bt601>(y16, yStride, u16, uStride, v16, vStride, width, height, shift, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Yuv420p16ToBgra<Bt709>(y16, yStride, u16, uStride, v16, vStride, width, height, shift, bgra, bgraStride, alpha); break;
+            case SimdYuvBt601Full: Yuv420p16ToBgra<Bt601Full>(y16, yStride, u16, uStride, v16, vStride, width, height, shift, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709Full: Yuv420p16ToBgra<Bt709Full>(y16, yStride, u16, uStride, v16, vStride, width, height, shift, bgra, bgraStride, alpha); break;
+            default: assert(0);
+            }
+        }
+
+        template<class T> void P016ToBgra(const uint16_t * y, size_t yStride, const uint16_t * uv, size_t uvStride,
+            size_t width, size_t height, int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint16_t * uv0 = uv + (row >> 1) * uvStride;
+                for (size_t col = 0; col < width; col += 2)
+                {
+                    int u = Uint16ToUint8(uv0[col + 0], shift), v = Uint16ToUint8(uv0[col + 1], shift);
+                    YuvToAny<T, 4, false>(Uint16ToUint8(y[col + 0], shift), u, v, alpha, bgra + (col + 0) * 4);
+                    YuvToAny<T, 4, false>(Uint16ToUint8(y[col + 1], shift), u, v, alpha, bgra + (col + 1) * 4);
+                }
+                y += yStride;
+                bgra += bgraStride;
+            }
+        }
+
+        void P016ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, 
+            int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            const uint16_t * y16 = (const uint16_t*)y, * uv16 = (const uint16_t*)uv;
+            yStride /= sizeof(uint16_t), uvStride /= sizeof(uint16_t);
+            switch (yuvType)
+            {
+            case SimdYuvBt601: P016ToBgra<Bt601>(y16, yStride, uv16, uvStride, width, height, shift, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: P016ToBgra<Bt709>(y16, yStride, uv16, uvStride, width, height, shift, bgra, bgraStride, alpha); break;
+            case SimdYuvBt601Full: P016ToBgra<Bt601Full>(y16, yStride, uv16, uvStride, width, height, shift, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709Full: P016ToBgra<Bt709Full>(y16, yStride, uv16, uvStride, width, height, shift, bgra, bgraStride, alpha); break;
+            default: assert(0);
+            }
+        }
     }
-}
+}
\ No newline at end of file
@@ -0,0 +1,154 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdColorMatrix_h__
+#define __SimdColorMatrix_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    struct ColorMatrixParam
+    {
+        SimdPixelFormatType format;
+        SimdBool precise;
+        bool gamma;
+
+        ColorMatrixParam(SimdPixelFormatType f, SimdBool p, bool g);
+        bool Valid() const;
+    };
+
+    class ColorMatrix : Deletable
+    {
+    public:
+        ColorMatrix(const ColorMatrixParam& param);
+
+        virtual void Run(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride) = 0;
+
+    protected:
+        ColorMatrixParam _param;
+    };
+
+    namespace Base
+    {
+        const int COLOR_MATRIX_SHIFT = 12;
+        const float COLOR_MATRIX_RANGE = float(1 << COLOR_MATRIX_SHIFT);
+
+        struct ColorMatrixCoefs
+        {
+            int32_t fixed[3][4];
+            float floats[3][4];
+            int32_t gamma[3][256];
+        };
+
+        SIMD_INLINE int ColorMatrixFixed(const int32_t* m, int b, int g, int r)
+        {
+            return RestrictRange((b * m[0] + g * m[1] + r * m[2] + m[3]) >> COLOR_MATRIX_SHIFT);
+        }
+
+        SIMD_INLINE int ColorMatrixFloat(const float* m, int b, int g, int r)
+        {
+            float value = float(b) * m[0] + float(g) * m[1] + float(r) * m[2] + m[3];
+            return int(Simd::RestrictRange(value, 0.0f, 255.0f) + 0.5f);
+        }
+
+        template<bool precise, bool gamma> SIMD_INLINE void ColorMatrixPixel(const ColorMatrixCoefs& coefs, const uint8_t* src, uint8_t* dst)
+        {
+            int b = src[0], g = src[1], r = src[2];
+            for (int c = 0; c < 3; ++c)
+            {
+                int value = precise ? ColorMatrixFloat(coefs.floats[c], b, g, r) : ColorMatrixFixed(coefs.fixed[c], b, g, r);
+                dst[c] = gamma ? coefs.gamma[c][value] : value;
+            }
+        }
+
+        template<size_t channels, bool precise, bool gamma> SIMD_INLINE void ColorMatrixTail(const ColorMatrixCoefs& coefs, const uint8_t* src, size_t begin, size_t end, uint8_t* dst)
+        {
+            for (size_t col = begin, offset = begin * channels; col < end; col += 1, offset += channels)
+            {
+                if (channels == 4)
+                    dst[offset + 3] = src[offset + 3];
+                ColorMatrixPixel<precise, gamma>(coefs, src + offset, dst + offset);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        typedef void (*ColorMatrixRowPtr)(const ColorMatrixCoefs& coefs, const uint8_t* src, size_t width, uint8_t* dst);
+
+        class ColorMatrixDefault : public Simd::ColorMatrix
+        {
+        public:
+            ColorMatrixDefault(const ColorMatrixParam& param, const float* matrix, const uint8_t* gamma);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride);
+
+        protected:
+            ColorMatrixCoefs _coefs;
+            ColorMatrixRowPtr _row;
+        };
+
+        void* ColorMatrixInit(const float* matrix, const uint8_t* gamma, SimdPixelFormatType format, SimdBool precise);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class ColorMatrixDefault : public Base::ColorMatrixDefault
+        {
+        public:
+            ColorMatrixDefault(const ColorMatrixParam& param, const float* matrix, const uint8_t* gamma);
+        };
+
+        void* ColorMatrixInit(const float* matrix, const uint8_t* gamma, SimdPixelFormatType format, SimdBool precise);
+    }
+#endif //SIMD_SSE41_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class ColorMatrixDefault : public Sse41::ColorMatrixDefault
+        {
+        public:
+            ColorMatrixDefault(const ColorMatrixParam& param, const float* matrix, const uint8_t* gamma);
+        };
+
+        void* ColorMatrixInit(const float* matrix, const uint8_t* gamma, SimdPixelFormatType format, SimdBool precise);
+    }
+#endif //SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class ColorMatrixDefault : public Avx2::ColorMatrixDefault
+        {
+        public:
+            ColorMatrixDefault(const ColorMatrixParam& param, const float* matrix, const uint8_t* gamma);
+        };
+
+        void* ColorMatrixInit(const float* matrix, const uint8_t* gamma, SimdPixelFormatType format, SimdBool precise);
+    }
+#endif //SIMD_AVX512BW_ENABLE
+}
+#endif//__SimdColorMatrix_h__
@@ -0,0 +1,378 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdColorSpace_h__
+#define __SimdColorSpace_h__
+
+#include "Simd/SimdConst.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdMemory.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const int LAB_CBRT_TABLE_SIZE = 1024;
+        const int LAB_SRGB_TABLE_SIZE = 4096;
+
+        const float LAB_XR = 0.412453f / 0.950456f, LAB_XG = 0.357580f / 0.950456f, LAB_XB = 0.180423f / 0.950456f;
+        const float LAB_YR = 0.212671f, LAB_YG = 0.715160f, LAB_YB = 0.072169f;
+        const float LAB_ZR = 0.019334f / 1.088754f, LAB_ZG = 0.119193f / 1.088754f, LAB_ZB = 0.950227f / 1.088754f;
+
+        const float LAB_RX = 3.240479f, LAB_RY = -1.537150f, LAB_RZ = -0.498535f;
+        const float LAB_GX = -0.969256f, LAB_GY = 1.875991f, LAB_GZ = 0.041556f;
+        const float LAB_BX = 0.055648f, LAB_BY = -0.204043f, LAB_BZ = 1.057311f;
+
+        const float LAB_WHITE_X = 0.950456f, LAB_WHITE_Z = 1.088754f;
+
+        const float LAB_L_SCALE = 116.0f * 255.0f / 100.0f, LAB_L_SHIFT = 16.0f * 255.0f / 100.0f;
+        const float LAB_A_SCALE = 500.0f, LAB_B_SCALE = 200.0f, LAB_AB_SHIFT = 128.0f;
+        const float LAB_L_SCALE_32F = 116.0f, LAB_L_SHIFT_32F = 16.0f;
+
+        const float LAB_INV_L_SCALE = 100.0f / 255.0f / 116.0f, LAB_F_SHIFT = 16.0f / 116.0f;
+        const float LAB_INV_A_SCALE = 1.0f / 500.0f, LAB_INV_B_SCALE = 1.0f / 200.0f;
+        const float LAB_F_THRESHOLD = 6.0f / 29.0f, LAB_F_LINEAR = 3.0f * (6.0f / 29.0f) * (6.0f / 29.0f);
+
+        struct LabTables
+        {
+            float gamma[256];
+            float cbrt[LAB_CBRT_TABLE_SIZE + 1];
+            int32_t srgb[LAB_SRGB_TABLE_SIZE + 1];
+
+            LabTables();
+        };
+
+        extern const LabTables LAB_TABLES;
+
+        SIMD_INLINE float LabCbrt(float value)
+        {
+            float t = Simd::RestrictRange(value, 0.0f, 1.0f) * LAB_CBRT_TABLE_SIZE;
+            int i = Min((int)t, LAB_CBRT_TABLE_SIZE - 1);
+            float f = t - (float)i;
+            return LAB_TABLES.cbrt[i] + (LAB_TABLES.cbrt[i + 1] - LAB_TABLES.cbrt[i]) * f;
+        }
+
+        SIMD_INLINE void BgrToLab(int blue, int green, int red, uint8_t * lab)
+        {
+            float b = LAB_TABLES.gamma[blue], g = LAB_TABLES.gamma[green], r = LAB_TABLES.gamma[red];
+            float fx = LabCbrt(r * LAB_XR + g * LAB_XG + b * LAB_XB);
+            float fy = LabCbrt(r * LAB_YR + g * LAB_YG + b * LAB_YB);
+            float fz = LabCbrt(r * LAB_ZR + g * LAB_ZG + b * LAB_ZB);
+            lab[0] = RestrictRange(Round(fy * LAB_L_SCALE - LAB_L_SHIFT), 0, 255);
+            lab[1] = RestrictRange(Round((fx - fy) * LAB_A_SCALE + LAB_AB_SHIFT), 0, 255);
+            lab[2] = RestrictRange(Round((fy - fz) * LAB_B_SCALE + LAB_AB_SHIFT), 0, 255);
+        }
+
+        SIMD_INLINE void BgrToLab(int blue, int green, int red, float * lab)
+        {
+            float b = LAB_TABLES.gamma[blue], g = LAB_TABLES.gamma[green], r = LAB_TABLES.gamma[red];
+            float fx = LabCbrt(r * LAB_XR + g * LAB_XG + b * LAB_XB);
+            float fy = LabCbrt(r * LAB_YR + g * LAB_YG + b * LAB_YB);
+            float fz = LabCbrt(r * LAB_ZR + g * LAB_ZG + b * LAB_ZB);
+            lab[0] = fy * LAB_L_SCALE_32F - LAB_L_SHIFT_32F;
+            lab[1] = (fx - fy) * LAB_A_SCALE;
+            lab[2] = (fy - fz) * LAB_B_SCALE;
+        }
+
+        SIMD_INLINE float LabInvF(float f)
+        {
+            return f > LAB_F_THRESHOLD ? f * f * f : (f - LAB_F_SHIFT) * LAB_F_LINEAR;
+        }
+
+        SIMD_INLINE int LabToSrgb(float value)
+        {
+            return LAB_TABLES.srgb[Round(Simd::RestrictRange(value, 0.0f, 1.0f) * LAB_SRGB_TABLE_SIZE)];
+        }
+
+        SIMD_INLINE void LabToBgr(int l, int a, int b, uint8_t * bgr)
+        {
+            float fy = (float)l * LAB_INV_L_SCALE + LAB_F_SHIFT;
+            float fx = fy + (float)(a - 128) * LAB_INV_A_SCALE;
+            float fz = fy - (float)(b - 128) * LAB_INV_B_SCALE;
+            float x = LabInvF(fx) * LAB_WHITE_X, y = LabInvF(fy), z = LabInvF(fz) * LAB_WHITE_Z;
+            bgr[0] = LabToSrgb(x * LAB_BX + y * LAB_BY + z * LAB_BZ);
+            bgr[1] = LabToSrgb(x * LAB_GX + y * LAB_GY + z * LAB_GZ);
+            bgr[2] = LabToSrgb(x * LAB_RX + y * LAB_RY + z * LAB_RZ);
+        }
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        const __m128i K8_SHUFFLE_BGR_TO_B32 = SIMD_MM_SETR_EPI8(0x0, -1, -1, -1, 0x3, -1, -1, -1, 0x6, -1, -1, -1, 0x9, -1, -1, -1);
+        const __m128i K8_SHUFFLE_BGR_TO_G32 = SIMD_MM_SETR_EPI8(0x1, -1, -1, -1, 0x4, -1, -1, -1, 0x7, -1, -1, -1, 0xA, -1, -1, -1);
+        const __m128i K8_SHUFFLE_BGR_TO_R32 = SIMD_MM_SETR_EPI8(0x2, -1, -1, -1, 0x5, -1, -1, -1, 0x8, -1, -1, -1, 0xB, -1, -1, -1);
+        const __m128i K8_SHUFFLE_32_TO_BGR = SIMD_MM_SETR_EPI8(0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+
+        SIMD_INLINE void LoadBgr32i(const uint8_t * src, __m128i & b, __m128i & g, __m128i & r)
+        {
+            __m128i bgr = _mm_insert_epi32(_mm_loadl_epi64((__m128i*)src), *(int32_t*)(src + 8), 2);
+            b = _mm_shuffle_epi8(bgr, K8_SHUFFLE_BGR_TO_B32);
+            g = _mm_shuffle_epi8(bgr, K8_SHUFFLE_BGR_TO_G32);
+            r = _mm_shuffle_epi8(bgr, K8_SHUFFLE_BGR_TO_R32);
+        }
+
+        SIMD_INLINE void StoreBgr32i(uint8_t * dst, __m128i b, __m128i g, __m128i r)
+        {
+            __m128i bgr = _mm_or_si128(_mm_and_si128(b, Sse2::K32_000000FF), _mm_slli_epi32(_mm_and_si128(g, Sse2::K32_000000FF), 8));
+            bgr = _mm_shuffle_epi8(_mm_or_si128(bgr, _mm_slli_epi32(r, 16)), K8_SHUFFLE_32_TO_BGR);
+            _mm_storel_epi64((__m128i*)dst, bgr);
+            *(int32_t*)(dst + 8) = _mm_extract_epi32(bgr, 2);
+        }
+
+        typedef void(*ColorSpacePtr)(const uint8_t * src, uint8_t * dst);
+
+        template<ColorSpacePtr convert> void ColorSpace(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            const size_t F = 4;
+            assert(width >= F);
+            size_t widthF = AlignLo(width, F);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthF; col += F)
+                    convert(src + col * 3, dst + col * 3);
+                if (widthF != width)
+                    convert(src + (width - F) * 3, dst + (width - F) * 3);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        SIMD_INLINE void StoreBgr32f(float * dst, __m128 b, __m128 g, __m128 r)
+        {
+            __m128 bg01 = _mm_unpacklo_ps(b, g), bg23 = _mm_unpackhi_ps(b, g);
+            __m128 gr01 = _mm_unpacklo_ps(g, r), gr23 = _mm_unpackhi_ps(g, r);
+            __m128 rb01 = _mm_unpacklo_ps(r, b), rb23 = _mm_unpackhi_ps(r, b);
+            _mm_storeu_ps(dst + 0, _mm_shuffle_ps(bg01, rb01, _MM_SHUFFLE(3, 0, 1, 0)));
+            _mm_storeu_ps(dst + 4, _mm_shuffle_ps(gr01, bg23, _MM_SHUFFLE(1, 0, 3, 2)));
+            _mm_storeu_ps(dst + 8, _mm_shuffle_ps(rb23, gr23, _MM_SHUFFLE(3, 2, 3, 0)));
+        }
+
+        typedef void(*ColorSpace32fPtr)(const uint8_t * src, float * dst);
+
+        template<ColorSpace32fPtr convert> void ColorSpace32f(const uint8_t * src, size_t width, size_t height, size_t srcStride, float * dst, size_t dstStride)
+        {
+            const size_t F = 4;
+            assert(width >= F);
+            size_t widthF = AlignLo(width, F);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthF; col += F)
+                    convert(src + col * 3, dst + col * 3);
+                if (widthF != width)
+                    convert(src + (width - F) * 3, dst + (width - F) * 3);
+                src += srcStride;
+                dst = (float*)((uint8_t*)dst + dstStride);
+            }
+        }
+    }
+#endif//SIMD_SSE41_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        const __m256i K8_SHUFFLE_BGR_TO_B32 = SIMD_MM256_SETR_EPI8(
+            0x0, -1, -1, -1, 0x3, -1, -1, -1, 0x6, -1, -1, -1, 0x9, -1, -1, -1,
+            0x0, -1, -1, -1, 0x3, -1, -1, -1, 0x6, -1, -1, -1, 0x9, -1, -1, -1);
+        const __m256i K8_SHUFFLE_BGR_TO_G32 = SIMD_MM256_SETR_EPI8(
+            0x1, -1, -1, -1, 0x4, -1, -1, -1, 0x7, -1, -1, -1, 0xA, -1, -1, -1,
+            0x1, -1, -1, -1, 0x4, -1, -1, -1, 0x7, -1, -1, -1, 0xA, -1, -1, -1);
+        const __m256i K8_SHUFFLE_BGR_TO_R32 = SIMD_MM256_SETR_EPI8(
+            0x2, -1, -1, -1, 0x5, -1, -1, -1, 0x8, -1, -1, -1, 0xB, -1, -1, -1,
+            0x2, -1, -1, -1, 0x5, -1, -1, -1, 0x8, -1, -1, -1, 0xB, -1, -1, -1);
+        const __m256i K8_SHUFFLE_32_TO_BGR = SIMD_MM256_SETR_EPI8(
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+        const __m256i K32_PERMUTE_BGR_TO_32 = SIMD_MM256_SETR_EPI32(0, 1, 2, 0, 3, 4, 5, 0);
+        const __m256i K32_PERMUTE_32_TO_BGR = SIMD_MM256_SETR_EPI32(0, 1, 2, 4, 5, 6, 0, 0);
+        const __m256i K32_BGR_MASK = SIMD_MM256_SETR_EPI32(-1, -1, -1, -1, -1, -1, 0, 0);
+
+        SIMD_INLINE void LoadBgr32i(const uint8_t * src, __m256i & b, __m256i & g, __m256i & r)
+        {
+            __m256i bgr = _mm256_permutevar8x32_epi32(_mm256_maskload_epi32((int*)src, K32_BGR_MASK), K32_PERMUTE_BGR_TO_32);
+            b = _mm256_shuffle_epi8(bgr, K8_SHUFFLE_BGR_TO_B32);
+            g = _mm256_shuffle_epi8(bgr, K8_SHUFFLE_BGR_TO_G32);
+            r = _mm256_shuffle_epi8(bgr, K8_SHUFFLE_BGR_TO_R32);
+        }
+
+        SIMD_INLINE void StoreBgr32i(uint8_t * dst, __m256i b, __m256i g, __m256i r)
+        {
+            __m256i bgr = _mm256_or_si256(_mm256_and_si256(b, K32_000000FF), _mm256_slli_epi32(_mm256_and_si256(g, K32_000000FF), 8));
+            bgr = _mm256_shuffle_epi8(_mm256_or_si256(bgr, _mm256_slli_epi32(r, 16)), K8_SHUFFLE_32_TO_BGR);
+            _mm256_maskstore_epi32((int*)dst, K32_BGR_MASK, _mm256_permutevar8x32_epi32(bgr, K32_PERMUTE_32_TO_BGR));
+        }
+
+        typedef void(*ColorSpacePtr)(const uint8_t * src, uint8_t * dst);
+
+        template<ColorSpacePtr convert> void ColorSpace(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            const size_t F = 8;
+            assert(width >= F);
+            size_t widthF = AlignLo(width, F);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthF; col += F)
+                    convert(src + col * 3, dst + col * 3);
+                if (widthF != width)
+                    convert(src + (width - F) * 3, dst + (width - F) * 3);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        SIMD_INLINE void StoreBgr32f(float * dst, __m256 b, __m256 g, __m256 r)
+        {
+            __m256 bg01 = _mm256_unpacklo_ps(b, g), bg23 = _mm256_unpackhi_ps(b, g);
+            __m256 gr01 = _mm256_unpacklo_ps(g, r), gr23 = _mm256_unpackhi_ps(g, r);
+            __m256 rb01 = _mm256_unpacklo_ps(r, b), rb23 = _mm256_unpackhi_ps(r, b);
+            __m256 bgr0 = _mm256_shuffle_ps(bg01, rb01, _MM_SHUFFLE(3, 0, 1, 0));
+            __m256 bgr1 = _mm256_shuffle_ps(gr01, bg23, _MM_SHUFFLE(1, 0, 3, 2));
+            __m256 bgr2 = _mm256_shuffle_ps(rb23, gr23, _MM_SHUFFLE(3, 2, 3, 0));
+            _mm256_storeu_ps(dst + 0, _mm256_permute2f128_ps(bgr0, bgr1, 0x20));
+            _mm256_storeu_ps(dst + 8, _mm256_permute2f128_ps(bgr2, bgr0, 0x30));
+            _mm256_storeu_ps(dst + 16, _mm256_permute2f128_ps(bgr1, bgr2, 0x31));
+        }
+
+        typedef void(*ColorSpace32fPtr)(const uint8_t * src, float * dst);
+
+        template<ColorSpace32fPtr convert> void ColorSpace32f(const uint8_t * src, size_t width, size_t height, size_t srcStride, float * dst, size_t dstStride)
+        {
+            const size_t F = 8;
+            assert(width >= F);
+            size_t widthF = AlignLo(width, F);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthF; col += F)
+                    convert(src + col * 3, dst + col * 3);
+                if (widthF != width)
+                    convert(src + (width - F) * 3, dst + (width - F) * 3);
+                src += srcStride;
+                dst = (float*)((uint8_t*)dst + dstStride);
+            }
+        }
+    }
+#endif//SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        const __m512i K8_SHUFFLE_BGR_TO_B32 = SIMD_MM512_SETR_EPI8(
+            0x0, -1, -1, -1, 0x3, -1, -1, -1, 0x6, -1, -1, -1, 0x9, -1, -1, -1,
+            0x0, -1, -1, -1, 0x3, -1, -1, -1, 0x6, -1, -1, -1, 0x9, -1, -1, -1,
+            0x0, -1, -1, -1, 0x3, -1, -1, -1, 0x6, -1, -1, -1, 0x9, -1, -1, -1,
+            0x0, -1, -1, -1, 0x3, -1, -1, -1, 0x6, -1, -1, -1, 0x9, -1, -1, -1);
+        const __m512i K8_SHUFFLE_BGR_TO_G32 = SIMD_MM512_SETR_EPI8(
+            0x1, -1, -1, -1, 0x4, -1, -1, -1, 0x7, -1, -1, -1, 0xA, -1, -1, -1,
+            0x1, -1, -1, -1, 0x4, -1, -1, -1, 0x7, -1, -1, -1, 0xA, -1, -1, -1,
+            0x1, -1, -1, -1, 0x4, -1, -1, -1, 0x7, -1, -1, -1, 0xA, -1, -1, -1,
+            0x1, -1, -1, -1, 0x4, -1, -1, -1, 0x7, -1, -1, -1, 0xA, -1, -1, -1);
+        const __m512i K8_SHUFFLE_BGR_TO_R32 = SIMD_MM512_SETR_EPI8(
+            0x2, -1, -1, -1, 0x5, -1, -1, -1, 0x8, -1, -1, -1, 0xB, -1, -1, -1,
+            0x2, -1, -1, -1, 0x5, -1, -1, -1, 0x8, -1, -1, -1, 0xB, -1, -1, -1,
+            0x2, -1, -1, -1, 0x5, -1, -1, -1, 0x8, -1, -1, -1, 0xB, -1, -1, -1,
+            0x2, -1, -1, -1, 0x5, -1, -1, -1, 0x8, -1, -1, -1, 0xB, -1, -1, -1);
+        const __m512i K8_SHUFFLE_32_TO_BGR = SIMD_MM512_SETR_EPI8(
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+        const __m512i K32_PERMUTE_BGR_TO_32 = SIMD_MM512_SETR_EPI32(0, 1, 2, 0, 3, 4, 5, 0, 6, 7, 8, 0, 9, 10, 11, 0);
+        const __m512i K32_PERMUTE_32_TO_BGR = SIMD_MM512_SETR_EPI32(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 0, 0, 0, 0);
+
+        SIMD_INLINE void LoadBgr32i(const uint8_t * src, __mmask64 tail, __m512i & b, __m512i & g, __m512i & r)
+        {
+            __m512i bgr = _mm512_permutexvar_epi32(K32_PERMUTE_BGR_TO_32, _mm512_maskz_loadu_epi8(tail, src));
+            b = _mm512_shuffle_epi8(bgr, K8_SHUFFLE_BGR_TO_B32);
+            g = _mm512_shuffle_epi8(bgr, K8_SHUFFLE_BGR_TO_G32);
+            r = _mm512_shuffle_epi8(bgr, K8_SHUFFLE_BGR_TO_R32);
+        }
+
+        SIMD_INLINE void StoreBgr32i(uint8_t * dst, __mmask64 tail, __m512i b, __m512i g, __m512i r)
+        {
+            __m512i bgr = _mm512_or_si512(_mm512_and_si512(b, K32_000000FF), _mm512_slli_epi32(_mm512_and_si512(g, K32_000000FF), 8));
+            bgr = _mm512_shuffle_epi8(_mm512_or_si512(bgr, _mm512_slli_epi32(r, 16)), K8_SHUFFLE_32_TO_BGR);
+            _mm512_mask_storeu_epi8(dst, tail, _mm512_permutexvar_epi32(K32_PERMUTE_32_TO_BGR, bgr));
+        }
+
+        typedef void(*ColorSpacePtr)(const uint8_t * src, uint8_t * dst, __mmask64 tail);
+
+        template<ColorSpacePtr convert> void ColorSpace(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            const size_t F = 16;
+            size_t widthF = AlignLo(width, F);
+            __mmask64 body = TailMask64(F * 3), tail = TailMask64((width - widthF) * 3);
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < widthF; col += F)
+                    convert(src + col * 3, dst + col * 3, body);
+                if (col < width)
+                    convert(src + col * 3, dst + col * 3, tail);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        const __m512i K32_PERMUTE_BGR32F_B = SIMD_MM512_SETR_EPI32(0, 1, 2, 3, 16, 17, 18, 19, 0, 0, 0, 0, 4, 5, 6, 7);
+        const __m512i K32_PERMUTE_BGR32F_G = SIMD_MM512_SETR_EPI32(20, 21, 22, 23, 0, 0, 0, 0, 8, 9, 10, 11, 24, 25, 26, 27);
+        const __m512i K32_PERMUTE_BGR32F_R = SIMD_MM512_SETR_EPI32(0, 0, 0, 0, 12, 13, 14, 15, 28, 29, 30, 31, 0, 0, 0, 0);
+        const __m512i K32_PERMUTE_BGR32F_C = SIMD_MM512_SETR_EPI32(8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15);
+
+        SIMD_INLINE void StoreBgr32f(float * dst, const __mmask16 * tail, __m512 b, __m512 g, __m512 r)
+        {
+            __m512 bg01 = _mm512_unpacklo_ps(b, g), bg23 = _mm512_unpackhi_ps(b, g);
+            __m512 gr01 = _mm512_unpacklo_ps(g, r), gr23 = _mm512_unpackhi_ps(g, r);
+            __m512 rb01 = _mm512_unpacklo_ps(r, b), rb23 = _mm512_unpackhi_ps(r, b);
+            __m512 bgr0 = _mm512_shuffle_ps(bg01, rb01, _MM_SHUFFLE(3, 0, 1, 0));
+            __m512 bgr1 = _mm512_shuffle_ps(gr01, bg23, _MM_SHUFFLE(1, 0, 3, 2));
+            __m512 bgr2 = _mm512_permutexvar_ps(K32_PERMUTE_BGR32F_C, _mm512_shuffle_ps(rb23, gr23, _MM_SHUFFLE(3, 2, 3, 0)));
+            _mm512_mask_storeu_ps(dst + 0 * F, tail[0], _mm512_mask_blend_ps(0x0F00, _mm512_permutex2var_ps(bgr0, K32_PERMUTE_BGR32F_B, bgr1), bgr2));
+            _mm512_mask_storeu_ps(dst + 1 * F, tail[1], _mm512_mask_blend_ps(0x00F0, _mm512_permutex2var_ps(bgr0, K32_PERMUTE_BGR32F_G, bgr1), bgr2));
+            _mm512_mask_storeu_ps(dst + 2 * F, tail[2], _mm512_mask_blend_ps(0xF00F, _mm512_permutex2var_ps(bgr0, K32_PERMUTE_BGR32F_R, bgr1), bgr2));
+        }
+
+        typedef void(*ColorSpace32fPtr)(const uint8_t * src, float * dst, __mmask64 srcTail, const __mmask16 * dstTail);
+
+        template<ColorSpace32fPtr convert> void ColorSpace32f(const uint8_t * src, size_t width, size_t height, size_t srcStride, float * dst, size_t dstStride)
+        {
+            const size_t F = 16;
+            size_t widthF = AlignLo(width, F), tailF = (width - widthF) * 3;
+            __mmask64 srcBody = TailMask64(F * 3), srcTail = TailMask64(tailF);
+            __mmask16 dstBody[3] = { __mmask16(-1), __mmask16(-1), __mmask16(-1) };
+            __mmask16 dstTail[3] = { TailMask16(tailF), TailMask16(tailF - F), TailMask16(tailF - 2 * F) };
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < widthF; col += F)
+                    convert(src + col * 3, dst + col * 3, srcBody, dstBody);
+                if (col < width)
+                    convert(src + col * 3, dst + col * 3, srcTail, dstTail);
+                src += srcStride;
+                dst = (float*)((uint8_t*)dst + dstStride);
+            }
+        }
+    }
+#endif//SIMD_AVX512BW_ENABLE
+}
+
+#endif//__SimdColorSpace_h__
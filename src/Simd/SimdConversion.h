@@ -124,6 +124,34 @@ namespace Simd
             hsv[2] = max;
         }
 
+        SIMD_INLINE void BgrToHsv(int blue, int green, int red, float * hsv)
+        {
+            int max = Max(red, Max(green, blue));
+            int min = Min(red, Min(green, blue));
+            int range = max - min;
+
+            if (range)
+            {
+                int dividend;
+
+                if (red == max)
+                    dividend = green - blue + 6 * range;
+                else if (green == max)
+                    dividend = blue - red + 2 * range;
+                else
+                    dividend = red - green + 4 * range;
+
+                float hue = 60.0f * dividend / range;
+                hsv[0] = hue >= 360.0f ? hue - 360.0f : hue;
+            }
+            else
+                hsv[0] = 0.0f;
+
+            hsv[1] = max ? float(range) / float(max) : 0.0f;
+
+            hsv[2] = float(max) * (1.0f / 255.0f);
+        }
+
         SIMD_INLINE void YuvToHsv(int y, int u, int v, uint8_t * hsv)
         {
             int blue = YuvToBlue(y, u);
@@ -165,6 +193,36 @@ namespace Simd
             hsl[2] = sum / 2;
         }
 
+        SIMD_INLINE void BgrToHsl(int blue, int green, int red, float * hsl)
+        {
+            int max = Max(red, Max(green, blue));
+            int min = Min(red, Min(green, blue));
+            int range = max - min;
+            int sum = max + min;
+
+            if (range)
+            {
+                int dividend;
+
+                if (red == max)
+                    dividend = green - blue + 6 * range;
+                else if (green == max)
+                    dividend = blue - red + 2 * range;
+                else
+                    dividend = red - green + 4 * range;
+
+                float hue = 60.0f * dividend / range;
+                hsl[0] = hue >= 360.0f ? hue - 360.0f : hue;
+            }
+            else
+                hsl[0] = 0.0f;
+
+            int divisor = Min(sum, 510 - sum);
+            hsl[1] = divisor ? float(range) / float(divisor) : 0.0f;
+
+            hsl[2] = float(sum) * (1.0f / 510.0f);
+        }
+
         SIMD_INLINE void YuvToHsl(int y, int u, int v, uint8_t * hsl)
         {
             int blue = YuvToBlue(y, u);
@@ -184,6 +242,7 @@ namespace Simd
                 switch (sector)
                 {
                 case 0:
+                case 6:
                     bgr[0] = min;
                     bgr[1] = min + delta;
                     bgr[2] = value;
@@ -241,6 +300,7 @@ namespace Simd
                 switch (sector)
                 {
                 case 0:
+                case 6:
                     bgr[0] = min;
                     bgr[1] = min + delta;
                     bgr[2] = max;
@@ -26,6 +26,8 @@
 
 #include "Simd/SimdDefs.h"
 
+#include <string>
+
 namespace Simd
 {
 #if defined(SIMD_X86_ENABLE) || defined(SIMD_X64_ENABLE)
@@ -107,6 +109,8 @@ namespace Simd
 
         size_t CpuCacheSize(size_t level);
 
+        std::string CpuModel();
+
         SIMD_INLINE size_t AlgCacheL1()
         {
             return Cpu::L1_CACHE_SIZE;
@@ -35,7 +35,7 @@
 #include <limits.h>
 
 #ifndef SIMD_CHECK_PERFORMANCE
-#define SIMD_CHECK_PERFORMANCE()
+#define SIMD_CHECK_PERFORMANCE() Simd::TraceScope simdTraceScope(__FUNCTION__)
 #endif
 
 namespace Simd
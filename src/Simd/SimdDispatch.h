@@ -0,0 +1,122 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdDispatch_h__
+#define __SimdDispatch_h__
+
+#include "Simd/SimdEnable.h"
+
+namespace Simd
+{
+    /*
+    * Table of implementations of one API function, resolved once (at first call of this function).
+    * Implementations are added in order of priority: the first one whose minimal size is not greater 
+    * than the size passed to Get() and whose instruction set is not restricted by SimdSetMaxIsa() is selected. 
+    * The last one (Base) has no restrictions.
+    * Support of instruction sets is checked in Add() at building of the table: it reads Base::g_isaState
+    * (Enable objects are initialized statically), so the table is correct even if it is built from dynamic 
+    * initializer of other module.
+    * Implementations are added in order of decreasing level, so the ones restricted by SimdSetMaxIsa() form 
+    * a prefix of the table. Its length is cached together with the state it was resolved for, so Get() only 
+    * compares the size with minimal sizes until SimdSetMaxIsa() is called again.
+    */
+    template<class Func> class Dispatch
+    {
+    public:
+        Dispatch()
+            : _size(0)
+            , _start(0)
+        {
+        }
+
+        Dispatch(const Dispatch & dispatch)
+            : _size(dispatch._size)
+            , _start(0)
+        {
+            for (size_t i = 0; i < _size; ++i)
+                _items[i] = dispatch._items[i];
+        }
+
+        Dispatch & Add(const IsaEnable & enable, Func func, size_t minSize = 0)
+        {
+            assert(_size < CAPACITY - 1);
+            if (enable.Supported())
+            {
+                _items[_size].func = func;
+                _items[_size].minSize = minSize;
+                _items[_size].bit = enable.bit;
+                _size++;
+            }
+            return *this;
+        }
+
+        Dispatch & Add(Func func)
+        {
+            assert(_size < CAPACITY);
+            _items[_size].func = func;
+            _items[_size].minSize = 0;
+            _items[_size].bit = 0;
+            _size++;
+            return *this;
+        }
+
+        SIMD_INLINE Func Get(size_t size = 0) const
+        {
+            uint32_t allowed = Base::IsaAllowedBits();
+            uint32_t start = _start.load(std::memory_order_relaxed);
+            if ((start >> START_SHIFT) != allowed)
+                start = Resolve(allowed);
+            const Item * item = _items + (start & START_MASK);
+            while (size < item->minSize)
+                item++;
+            return item->func;
+        }
+
+    private:
+        // One item for each instruction set of an architecture (11 on x86: from SSE to AVX-512VNNI) and one for Base.
+        static const size_t CAPACITY = 12;
+        static const int START_SHIFT = 8;
+        static const uint32_t START_MASK = (1 << START_SHIFT) - 1;
+
+        struct Item
+        {
+            Func func;
+            size_t minSize;
+            uint32_t bit;
+        } _items[CAPACITY];
+        size_t _size;
+        mutable std::atomic<uint32_t> _start;
+
+        SIMD_NOINLINE uint32_t Resolve(uint32_t allowed) const
+        {
+            uint32_t index = 0;
+            while (_items[index].bit && (_items[index].bit & allowed) == 0)
+                index++;
+            uint32_t start = (allowed << START_SHIFT) | index;
+            _start.store(start, std::memory_order_relaxed);
+            return start;
+        }
+    };
+}
+
+#endif//__SimdDispatch_h__
@@ -26,14 +26,147 @@
 
 #include "Simd/SimdDefs.h"
 
+#include <atomic>
+
 namespace Simd
 {
+    namespace Base
+    {
+        /*
+        * Bits of instruction sets in Base::g_isaState (one bit per Enable object below).
+        * The low half of the state is a set of instruction sets which are supported by CPU and OS and not restricted by SIMD_MAX_ISA.
+        * The high half is the same set restricted by SimdSetMaxIsa() in addition. ISA_STATE_READY is set in both halves when the state is computed.
+        */
+        enum IsaBit
+        {
+            IsaBitSse = 1 << 0,
+            IsaBitSse2 = 1 << 1,
+            IsaBitSse3 = 1 << 2,
+            IsaBitSsse3 = 1 << 3,
+            IsaBitSse41 = 1 << 4,
+            IsaBitSse42 = 1 << 5,
+            IsaBitAvx = 1 << 6,
+            IsaBitAvx2 = 1 << 7,
+            IsaBitAvx512f = 1 << 8,
+            IsaBitAvx512bw = 1 << 9,
+            IsaBitAvx512vnni = 1 << 10,
+            IsaBitVmx = 1 << 11,
+            IsaBitVsx = 1 << 12,
+            IsaBitNeon = 1 << 13,
+        };
+
+        const uint32_t ISA_STATE_READY = 1 << 15;
+        const int ISA_STATE_ALLOWED_SHIFT = 16;
+
+        extern std::atomic<uint32_t> g_isaState;
+
+        uint32_t InitIsaState();
+
+        SimdIsaType GetMaxIsa();
+
+        void SetMaxIsa(SimdIsaType isa);
+
+        SIMD_INLINE uint32_t IsaState()
+        {
+            uint32_t state = g_isaState.load(std::memory_order_relaxed);
+            return state ? state : InitIsaState();
+        }
+
+        /*
+        * Returns a set of instruction sets which can be used now (the high half of Base::g_isaState), it is never zero.
+        */
+        SIMD_INLINE uint32_t IsaAllowedBits()
+        {
+            return IsaState() >> ISA_STATE_ALLOWED_SHIFT;
+        }
+
+        enum IsaFamily
+        {
+            IsaFamilyNone,
+            IsaFamilyX86,
+            IsaFamilyPowerPc,
+            IsaFamilyArm,
+        };
+
+        SIMD_INLINE IsaFamily GetIsaFamily(SimdIsaType isa)
+        {
+            switch (isa)
+            {
+            case SimdIsaSse2: case SimdIsaSse41: case SimdIsaAvx2: case SimdIsaAvx512bw: case SimdIsaAvx512vnni: return IsaFamilyX86;
+            case SimdIsaVmx: case SimdIsaVsx: return IsaFamilyPowerPc;
+            case SimdIsaNeon: return IsaFamilyArm;
+            default: return IsaFamilyNone;
+            }
+        }
+
+        SIMD_INLINE int GetIsaLevel(SimdIsaType isa)
+        {
+            switch (isa)
+            {
+            case SimdIsaSse2: case SimdIsaVmx: case SimdIsaNeon: return 1;
+            case SimdIsaSse41: case SimdIsaVsx: return 2;
+            case SimdIsaAvx2: return 3;
+            case SimdIsaAvx512bw: return 4;
+            case SimdIsaAvx512vnni: return 5;
+            default: return 0;
+            }
+        }
+
+        /*
+        * Checks if instruction set 'isa' is not restricted by maximal level 'max'.
+        * Levels are compared only within one architecture: a level of other architecture doesn't restrict 'isa', SimdIsaBase restricts everything.
+        */
+        SIMD_INLINE bool IsaAllowed(SimdIsaType isa, SimdIsaType max)
+        {
+            if (GetIsaFamily(isa) != GetIsaFamily(max))
+                return isa == SimdIsaBase || max != SimdIsaBase;
+            return GetIsaLevel(isa) <= GetIsaLevel(max);
+        }
+    }
+
+    /*
+    * It is an aggregate, so every Enable object below is initialized statically (before any dynamic initializer of any module).
+    * Support of the instruction set (GetEnable() caches the result of CPU and OS checks), SIMD_MAX_ISA and SimdSetMaxIsa() 
+    * are resolved together into Base::g_isaState, so every check of Enable is a single load.
+    */
+    struct IsaEnable
+    {
+        bool (*getEnable)();
+        SimdIsaType isa;
+        uint32_t bit;
+
+        SIMD_INLINE operator bool() const
+        {
+            return (Base::IsaAllowedBits() & bit) != 0;
+        }
+
+        SIMD_INLINE bool Supported() const
+        {
+            return (Base::IsaState() & bit) != 0;
+        }
+
+        SIMD_INLINE SimdIsaType Isa() const
+        {
+            return isa;
+        }
+    };
+
+    namespace Base
+    {
+        /*
+        * Returns Enable objects of all instruction sets compiled into the library (terminated by NULL).
+        * It is defined in SimdLib.cpp: only this file is compiled with flags of every enabled instruction set, 
+        * other Base files don't see SIMD_SSE41_ENABLE, SIMD_AVX2_ENABLE and so on.
+        */
+        const IsaEnable * const * IsaEnables();
+    }
+
 #ifdef SIMD_SSE_ENABLE
     namespace Sse
     {
         bool GetEnable();
 
-        const bool Enable = GetEnable();
+        const IsaEnable Enable = { GetEnable, SimdIsaSse2, Base::IsaBitSse };
     }
 #endif
 
@@ -42,7 +175,7 @@ namespace Simd
     {
         bool GetEnable();
 
-        const bool Enable = GetEnable();
+        const IsaEnable Enable = { GetEnable, SimdIsaSse2, Base::IsaBitSse2 };
     }
 #endif
 
@@ -51,7 +184,7 @@ namespace Simd
     {
         bool GetEnable();
 
-        const bool Enable = GetEnable();
+        const IsaEnable Enable = { GetEnable, SimdIsaSse2, Base::IsaBitSse3 };
     }
 #endif
 
@@ -60,7 +193,7 @@ namespace Simd
     {
         bool GetEnable();
 
-        const bool Enable = GetEnable();
+        const IsaEnable Enable = { GetEnable, SimdIsaSse2, Base::IsaBitSsse3 };
     }
 #endif
 
@@ -69,7 +202,7 @@ namespace Simd
     {
         bool GetEnable();
 
-        const bool Enable = GetEnable();
+        const IsaEnable Enable = { GetEnable, SimdIsaSse41, Base::IsaBitSse41 };
     }
 #endif
 
@@ -78,7 +211,7 @@ namespace Simd
     {
         bool GetEnable();
 
-        const bool Enable = GetEnable();
+        const IsaEnable Enable = { GetEnable, SimdIsaSse41, Base::IsaBitSse42 };
     }
 #endif
 
@@ -87,7 +220,7 @@ namespace Simd
     {
         bool GetEnable();
 
-        const bool Enable = GetEnable();
+        const IsaEnable Enable = { GetEnable, SimdIsaAvx2, Base::IsaBitAvx };
     }
 #endif
 
@@ -96,7 +229,7 @@ namespace Simd
     {
         bool GetEnable();
 
-        const bool Enable = GetEnable();
+        const IsaEnable Enable = { GetEnable, SimdIsaAvx2, Base::IsaBitAvx2 };
     }
 #endif
 
@@ -105,7 +238,7 @@ namespace Simd
     {
         bool GetEnable();
 
-        const bool Enable = GetEnable();
+        const IsaEnable Enable = { GetEnable, SimdIsaAvx512bw, Base::IsaBitAvx512f };
     }
 #endif
 
@@ -114,7 +247,7 @@ namespace Simd
     {
         bool GetEnable();
 
-        const bool Enable = GetEnable();
+        const IsaEnable Enable = { GetEnable, SimdIsaAvx512bw, Base::IsaBitAvx512bw };
     }
 #endif
 
@@ -123,7 +256,7 @@ namespace Simd
     {
         bool GetEnable();
 
-        const bool Enable = GetEnable();
+        const IsaEnable Enable = { GetEnable, SimdIsaAvx512vnni, Base::IsaBitAvx512vnni };
     }
 #endif
 
@@ -132,7 +265,7 @@ namespace Simd
     {
         bool GetEnable();
 
-        const bool Enable = GetEnable();
+        const IsaEnable Enable = { GetEnable, SimdIsaVmx, Base::IsaBitVmx };
     }
 #endif
 
@@ -141,7 +274,7 @@ namespace Simd
     {
         bool GetEnable();
 
-        const bool Enable = GetEnable();
+        const IsaEnable Enable = { GetEnable, SimdIsaVsx, Base::IsaBitVsx };
     }
 #endif
 
@@ -150,7 +283,7 @@ namespace Simd
     {
         bool GetEnable();
 
-        const bool Enable = GetEnable();
+        const IsaEnable Enable = { GetEnable, SimdIsaNeon, Base::IsaBitNeon };
     }
 #endif
 }
@@ -64,6 +64,14 @@ namespace Simd
             Gray8,
             /*! One plane 24-bit (3 8-bit channels) RGB (Red, Green, Blue) pixel format. */
             Rgb24,
+            /*! One plane 16-bit packed YUV 4:2:2 (bytes Y0 U Y1 V for each pair of pixels) YUYV pixel format. */
+            Yuyv16,
+            /*! One plane 16-bit packed YUV 4:2:2 (bytes U Y0 V Y1 for each pair of pixels) UYVY pixel format. */
+            Uyvy16,
+            /*! Two planes (16-bit full size Y plane, 32-bit interlived half size UV plane) P010/P016 pixel format. Samples are MSB-aligned. */
+            P010,
+            /*! Three planes (16-bit full size Y plane, 16-bit half size U plane, 16-bit half size V plane) YUV420P 16-bit pixel format. Samples are MSB-aligned. */
+            Yuv420p16,
         };
 
         const size_t width; /*!< \brief A width of the frame. */
@@ -332,16 +340,128 @@ namespace Simd
 
     /*! @ingroup cpp_frame_functions
 
-        \fn template <template<class> class A> void Convert(const Frame<A> & src, Frame<A> & dst);
+        \short Describes a way which is used by Simd::Convert to convert frames.
+    */
+    enum FrameConvertPath
+    {
+        FrameConvertNone, /*!< Conversion between given formats is not supported. */
+        FrameConvertCopy, /*!< Formats are equal: planes of the frame are copied. */
+        FrameConvertDirect, /*!< Conversion is performed by single pass function(s) without intermediate buffers. */
+        FrameConvertStrip, /*!< Conversion is performed by two functions fused by horizontal strips through intermediate buffer which fits in L2 cache. */
+    };
+
+    /*! @ingroup cpp_frame_functions
+
+        \fn template <template<class> class A> FrameConvertPath ConvertPath(const Frame<A> & src, const Frame<A> & dst);
+
+        \short Gets a way which will be used by Simd::Convert to convert one frame to another.
+
+        \param [in] src - an input frame.
+        \param [in] dst - an output frame.
+        \return - a conversion path (see ::FrameConvertPath).
+    */
+    template <template<class> class A> FrameConvertPath ConvertPath(const Frame<A> & src, const Frame<A> & dst);
+
+    /*! @ingroup cpp_frame_functions
+
+        \fn template <template<class> class A> FrameConvertPath Convert(const Frame<A> & src, Frame<A> & dst, SimdYuvType yuvType = SimdYuvBt601);
 
         \short Converts one frame to another frame.
 
         The frames must have the same width and height.
+        YUYV and UYVY (packed YUV 4:2:2) frames are supported only as input frames.
+        High bit depth P010 and YUV420P 16-bit frames are also supported only as input frames. 
+        Their MSB-aligned samples are reduced to 8 bits.
+        If there is no single pass conversion for given pair of formats then conversion is performed by horizontal strips 
+        through small intermediate frame (no full size temporary frames are allocated).
 
         \param [in] src - an input frame.
         \param [out] dst - an output frame.
+        \param [in] yuvType - a type of YUV colour matrix and range used in conversions between YUV and BGR(A) frames. By default it is ::SimdYuvBt601.
+        \return - a used conversion path (see ::FrameConvertPath).
+    */
+    template <template<class> class A> FrameConvertPath Convert(const Frame<A> & src, Frame<A> & dst, SimdYuvType yuvType = SimdYuvBt601);
+
+    /*! @ingroup cpp_frame_functions
+
+        \fn template <template<class> class A> void SynetSetInput(const Frame<A> & src, const Rectangle<ptrdiff_t> & roi, size_t width, size_t height, const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType format, bool letterbox = false, uint8_t padding = 0, SimdYuvType yuvType = SimdYuvBt601, SimdResizeMethodType method = SimdResizeMethodBilinear);
+
+        \short Sets region of the frame to the input of neural network of <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        The region of interest of Gray8, Bgr24, Bgra32 and Rgb24 frames (and Y plane of YUV frames if channels is 1) is resized directly from the source frame,
+        other formats are converted to BGR-24 (or gray) in the region of interest by horizontal strips, and each strip is resized and normalized (as in ::SimdSynetSetInput) right after its conversion.
+        This function creates temporary Simd::SynetSetInputContext. Use this structure directly in order to reuse resizer and buffers for a sequence of frames.
+
+        \param [in] src - an input frame.
+        \param [in] roi - a region of interest in the input frame. It is cropped by the frame boundaries.
+        \param [in] width - a width of output image tensor.
+        \param [in] height - a height of output image tensor.
+        \param [in] lower - a pointer to the array with lower bound of values of the output tensor. The size of the array have to correspond number of channels in the output image tensor.
+        \param [in] upper - a pointer to the array with upper bound of values of the output tensor. The size of the array have to correspond number of channels in the output image tensor.
+        \param [out] dst - a pointer to the output 32-bit float image tensor.
+        \param [in] channels - a number of channels in the output image tensor. It can be 1 or 3.
+        \param [in] format - a format of output image tensor. There are supported following tensor formats: ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc.
+        \param [in] letterbox - a flag to keep aspect ratio of the region of interest. If it is true then resized region is placed in the center of the output tensor and the rest of tensor is padded. By default it is false.
+        \param [in] padding - a value (in range [0, 255], before normalization) of padding pixels in letterbox mode. By default it is equal to 0.
+        \param [in] yuvType - a type of YUV colour matrix and range used in conversion of YUV frames. By default it is ::SimdYuvBt601.
+        \param [in] method - a method of resizing of the region of interest. By default it is ::SimdResizeMethodBilinear.
     */
-    template <template<class> class A> void Convert(const Frame<A> & src, Frame<A> & dst);
+    template <template<class> class A> void SynetSetInput(const Frame<A> & src, const Rectangle<ptrdiff_t> & roi, size_t width, size_t height, 
+        const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType format, bool letterbox = false, uint8_t padding = 0, 
+        SimdYuvType yuvType = SimdYuvBt601, SimdResizeMethodType method = SimdResizeMethodBilinear);
+
+    /*! @ingroup cpp_frame
+
+        \short The SynetSetInputContext structure sets regions of frames to the input of neural network of <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        It keeps the context of ::SimdSynetSetInputInit and the buffer of converted region between calls, they are recreated only if size of region or parameters are changed.
+
+        \note This structure is a C++ wrapper for functions ::SimdSynetSetInputInit, ::SimdSynetSetInputRun and ::SimdSynetSetInputRunRows. It must not be used from several threads at the same time.
+    */
+    template <template<class> class A>
+    struct SynetSetInputContext
+    {
+        /*!
+            Creates empty context.
+        */
+        SynetSetInputContext()
+            : _context(NULL)
+        {
+        }
+
+        /*!
+            Releases context.
+        */
+        ~SynetSetInputContext()
+        {
+            if (_context)
+                ::SimdRelease(_context);
+        }
+
+        /*!
+            Sets region of the frame to the input of neural network. Parameters are the same as in function Simd::SynetSetInput(const Frame<A> & src, const Rectangle<ptrdiff_t> & roi, size_t width, size_t height, const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType format, bool letterbox, uint8_t padding, SimdYuvType yuvType, SimdResizeMethodType method).
+        */
+        void Run(const Frame<A> & src, const Rectangle<ptrdiff_t> & roi, size_t width, size_t height,
+            const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType format, bool letterbox = false, uint8_t padding = 0,
+            SimdYuvType yuvType = SimdYuvBt601, SimdResizeMethodType method = SimdResizeMethodBilinear);
+
+    private:
+        void * _context;
+        size_t _srcW, _srcH, _dstW, _dstH, _channels;
+        typename View<A>::Format _srcFormat;
+        SimdTensorFormatType _format;
+        SimdResizeMethodType _method;
+        bool _letterbox;
+        uint8_t _padding;
+        float _lower[3], _upper[3];
+        Frame<A> _converted;
+
+        SynetSetInputContext(const SynetSetInputContext &);
+        SynetSetInputContext & operator = (const SynetSetInputContext &);
+
+        bool Actual(const View<A> & src, size_t width, size_t height, const float * lower, const float * upper,
+            size_t channels, SimdTensorFormatType format, bool letterbox, uint8_t padding, SimdResizeMethodType method) const;
+    };
 
     //-------------------------------------------------------------------------
 
@@ -380,6 +500,8 @@ namespace Simd
         case View<A>::Bgr24: (Format&)format = Bgr24; break;
         case View<A>::Bgra32: (Format&)format = Bgra32; break;
         case View<A>::Rgb24: (Format&)format = Rgb24; break;
+        case View<A>::Yuyv16: (Format&)format = Yuyv16; break;
+        case View<A>::Uyvy16: (Format&)format = Uyvy16; break;
         default:
             assert(0);
         }
@@ -441,6 +563,25 @@ namespace Simd
         case Rgb24:
             planes[0] = View<A>(width, height, stride0, View<A>::Rgb24, data0);
             break;
+        case Yuyv16:
+            assert((width & 1) == 0);
+            planes[0] = View<A>(width, height, stride0, View<A>::Yuyv16, data0);
+            break;
+        case Uyvy16:
+            assert((width & 1) == 0);
+            planes[0] = View<A>(width, height, stride0, View<A>::Uyvy16, data0);
+            break;
+        case P010:
+            assert((width & 1) == 0 && (height & 1) == 0);
+            planes[0] = View<A>(width, height, stride0, View<A>::Int16, data0);
+            planes[1] = View<A>(width / 2, height / 2, stride1, View<A>::Uv32, data1);
+            break;
+        case Yuv420p16:
+            assert((width & 1) == 0 && (height & 1) == 0);
+            planes[0] = View<A>(width, height, stride0, View<A>::Int16, data0);
+            planes[1] = View<A>(width / 2, height / 2, stride1, View<A>::Int16, data1);
+            planes[2] = View<A>(width / 2, height / 2, stride2, View<A>::Int16, data2);
+            break;
         default:
             assert(0);
         }
@@ -531,6 +672,25 @@ namespace Simd
         case Rgb24:
             planes[0].Recreate(width, height, View<A>::Rgb24);
             break;
+        case Yuyv16:
+            assert((width & 1) == 0);
+            planes[0].Recreate(width, height, View<A>::Yuyv16);
+            break;
+        case Uyvy16:
+            assert((width & 1) == 0);
+            planes[0].Recreate(width, height, View<A>::Uyvy16);
+            break;
+        case P010:
+            assert((width & 1) == 0 && (height & 1) == 0);
+            planes[0].Recreate(width, height, View<A>::Int16);
+            planes[1].Recreate(width / 2, height / 2, View<A>::Uv32);
+            break;
+        case Yuv420p16:
+            assert((width & 1) == 0 && (height & 1) == 0);
+            planes[0].Recreate(width, height, View<A>::Int16);
+            planes[1].Recreate(width / 2, height / 2, View<A>::Int16);
+            planes[2].Recreate(width / 2, height / 2, View<A>::Int16);
+            break;
         default:
             assert(0);
         }
@@ -556,7 +716,7 @@ namespace Simd
             right = std::min<ptrdiff_t>(std::max<ptrdiff_t>(right, 0), width);
             bottom = std::min<ptrdiff_t>(std::max<ptrdiff_t>(bottom, 0), height);
 
-            if (format == Nv12 || format == Yuv420p)
+            if (format == Nv12 || format == Yuv420p || format == P010 || format == Yuv420p16)
             {
                 left = left & ~1;
                 top = top & ~1;
@@ -564,6 +724,12 @@ namespace Simd
                 bottom = (bottom + 1) & ~1;
             }
 
+            if (format == Yuyv16 || format == Uyvy16)
+            {
+                left = left & ~1;
+                right = (right + 1) & ~1;
+            }
+
             Frame frame;
             *(size_t*)&frame.width = right - left;
             *(size_t*)&frame.height = bottom - top;
@@ -573,10 +739,10 @@ namespace Simd
 
             frame.planes[0] = planes[0].Region(left, top, right, bottom);
 
-            if (format == Nv12 || format == Yuv420p)
+            if (format == Nv12 || format == Yuv420p || format == P010 || format == Yuv420p16)
                 frame.planes[1] = planes[1].Region(left / 2, top / 2, right / 2, bottom / 2);
 
-            if (format == Yuv420p)
+            if (format == Yuv420p || format == Yuv420p16)
                 frame.planes[2] = planes[2].Region(left / 2, top / 2, right / 2, bottom / 2);
 
             return frame;
@@ -647,6 +813,10 @@ namespace Simd
         case Bgr24:   return 1;
         case Gray8:   return 1;
         case Rgb24:   return 1;
+        case Yuyv16:  return 1;
+        case Uyvy16:  return 1;
+        case P010:    return 2;
+        case Yuv420p16: return 3;
         default: assert(0); return 0;
         }
     }
@@ -683,199 +853,415 @@ namespace Simd
         }
     }
 
-    template <template<class> class A> SIMD_INLINE void Convert(const Frame<A> & src, Frame<A> & dst)
+    namespace Detail
     {
-        assert(EqualSize(src, dst) && src.format && dst.format && src.flipped == dst.flipped);
-
-        if (src.format == dst.format)
+        template <template<class> class A> SIMD_INLINE typename Frame<A>::Format ConvertStripFormat(typename Frame<A>::Format src, typename Frame<A>::Format dst)
         {
-            Copy(src, dst);
-            return;
-        }
-
-        switch (src.format)
-        {
-        case Frame<A>::Nv12:
-            switch (dst.format)
-            {
-            case Frame<A>::Yuv420p:
-                Copy(src.planes[0], dst.planes[0]);
-                DeinterleaveUv(src.planes[1], dst.planes[1], dst.planes[2]);
-                break;
-            case Frame<A>::Bgra32:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Yuv420pToBgra(src.planes[0], u, v, dst.planes[0]);
-                break;
-            }
-            case Frame<A>::Bgr24:
+            switch (src)
             {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Yuv420pToBgr(src.planes[0], u, v, dst.planes[0]);
-                break;
-            }
-            case Frame<A>::Gray8:
-                Copy(src.planes[0], dst.planes[0]);
-                break;
             case Frame<A>::Rgb24:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                View<A> bgr(src.Size(), View<A>::Bgr24);
-                Yuv420pToBgr(src.planes[0], u, v, bgr);
-                BgrToRgb(bgr, dst.planes[0]);
-                break;
-            }
+                return dst == Frame<A>::Nv12 || dst == Frame<A>::Yuv420p ? Frame<A>::Bgr24 : Frame<A>::None;
+            case Frame<A>::P010:
+                return dst == Frame<A>::Yuv420p || dst == Frame<A>::Bgr24 || dst == Frame<A>::Rgb24 ? Frame<A>::Nv12 : Frame<A>::None;
+            case Frame<A>::Yuv420p16:
+                return dst == Frame<A>::Nv12 || dst == Frame<A>::Bgr24 || dst == Frame<A>::Rgb24 ? Frame<A>::Yuv420p : Frame<A>::None;
             default:
-                assert(0);
+                return Frame<A>::None;
             }
-            break;
+        }
 
-        case Frame<A>::Yuv420p:
-            switch (dst.format)
+        template <template<class> class A> SIMD_INLINE void ConvertDirect(const Frame<A> & src, Frame<A> & dst, SimdYuvType yuvType)
+        {
+            switch (src.format)
             {
             case Frame<A>::Nv12:
-                Copy(src.planes[0], dst.planes[0]);
-                InterleaveUv(src.planes[1], src.planes[2], dst.planes[1]);
+                switch (dst.format)
+                {
+                case Frame<A>::Yuv420p:
+                    Copy(src.planes[0], dst.planes[0]);
+                    DeinterleaveUv(src.planes[1], dst.planes[1], dst.planes[2]);
+                    break;
+                case Frame<A>::Bgra32:
+                    Nv12ToBgra(src.planes[0], src.planes[1], dst.planes[0], 0xFF, yuvType);
+                    break;
+                case Frame<A>::Bgr24:
+                    Nv12ToBgr(src.planes[0], src.planes[1], dst.planes[0], yuvType);
+                    break;
+                case Frame<A>::Gray8:
+                    Copy(src.planes[0], dst.planes[0]);
+                    break;
+                case Frame<A>::Rgb24:
+                    Nv12ToRgb(src.planes[0], src.planes[1], dst.planes[0], yuvType);
+                    break;
+                default:
+                    assert(0);
+                }
+                break;
+
+            case Frame<A>::Yuv420p:
+                switch (dst.format)
+                {
+                case Frame<A>::Nv12:
+                    Copy(src.planes[0], dst.planes[0]);
+                    InterleaveUv(src.planes[1], src.planes[2], dst.planes[1]);
+                    break;
+                case Frame<A>::Bgra32:
+                    Yuv420pToBgra(src.planes[0], src.planes[1], src.planes[2], dst.planes[0], yuvType);
+                    break;
+                case Frame<A>::Bgr24:
+                    Yuv420pToBgr(src.planes[0], src.planes[1], src.planes[2], dst.planes[0], yuvType);
+                    break;
+                case Frame<A>::Gray8:
+                    Copy(src.planes[0], dst.planes[0]);
+                    break;
+                case Frame<A>::Rgb24:
+                    Yuv420pToRgb(src.planes[0], src.planes[1], src.planes[2], dst.planes[0], yuvType);
+                    break;
+                default:
+                    assert(0);
+                }
                 break;
+
             case Frame<A>::Bgra32:
-                Yuv420pToBgra(src.planes[0], src.planes[1], src.planes[2], dst.planes[0]);
+                switch (dst.format)
+                {
+                case Frame<A>::Nv12:
+                    BgraToNv12(src.planes[0], dst.planes[0], dst.planes[1], yuvType);
+                    break;
+                case Frame<A>::Yuv420p:
+                    BgraToYuv420p(src.planes[0], dst.planes[0], dst.planes[1], dst.planes[2], yuvType);
+                    break;
+                case Frame<A>::Bgr24:
+                    BgraToBgr(src.planes[0], dst.planes[0]);
+                    break;
+                case Frame<A>::Gray8:
+                    BgraToGray(src.planes[0], dst.planes[0]);
+                    break;
+                case Frame<A>::Rgb24:
+                    BgraToRgb(src.planes[0], dst.planes[0]);
+                    break;
+                default:
+                    assert(0);
+                }
                 break;
+
             case Frame<A>::Bgr24:
-                Yuv420pToBgr(src.planes[0], src.planes[1], src.planes[2], dst.planes[0]);
+                switch (dst.format)
+                {
+                case Frame<A>::Nv12:
+                    BgrToNv12(src.planes[0], dst.planes[0], dst.planes[1], yuvType);
+                    break;
+                case Frame<A>::Yuv420p:
+                    BgrToYuv420p(src.planes[0], dst.planes[0], dst.planes[1], dst.planes[2], yuvType);
+                    break;
+                case Frame<A>::Bgra32:
+                    BgrToBgra(src.planes[0], dst.planes[0]);
+                    break;
+                case Frame<A>::Gray8:
+                    BgrToGray(src.planes[0], dst.planes[0]);
+                    break;
+                case Frame<A>::Rgb24:
+                    BgrToRgb(src.planes[0], dst.planes[0]);
+                    break;
+                default:
+                    assert(0);
+                }
                 break;
+
             case Frame<A>::Gray8:
-                Copy(src.planes[0], dst.planes[0]);
+                switch (dst.format)
+                {
+                case Frame<A>::Nv12:
+                    Copy(src.planes[0], dst.planes[0]);
+                    Fill(dst.planes[1], 128);
+                    break;
+                case Frame<A>::Yuv420p:
+                    Copy(src.planes[0], dst.planes[0]);
+                    Fill(dst.planes[1], 128);
+                    Fill(dst.planes[2], 128);
+                    break;
+                case Frame<A>::Bgra32:
+                    GrayToBgra(src.planes[0], dst.planes[0]);
+                    break;
+                case Frame<A>::Bgr24:
+                    GrayToBgr(src.planes[0], dst.planes[0]);
+                    break;
+                case Frame<A>::Rgb24:
+                    GrayToBgr(src.planes[0], dst.planes[0]);
+                    break;
+                default:
+                    assert(0);
+                }
                 break;
+
             case Frame<A>::Rgb24:
-            {
-                View<A> bgr(src.Size(), View<A>::Bgr24);
-                Yuv420pToBgr(src.planes[0], src.planes[1], src.planes[2], bgr);
-                BgrToRgb(bgr, dst.planes[0]);
+                switch (dst.format)
+                {
+                case Frame<A>::Bgr24:
+                    BgrToRgb(src.planes[0], dst.planes[0]);
+                    break;
+                case Frame<A>::Bgra32:
+                    RgbToBgra(src.planes[0], dst.planes[0]);
+                    break;
+                case Frame<A>::Gray8:
+                    RgbToGray(src.planes[0], dst.planes[0]);
+                    break;
+                default:
+                    assert(0);
+                }
                 break;
-            }
-            default:
-                assert(0);
-            }
-            break;
 
-        case Frame<A>::Bgra32:
-            switch (dst.format)
-            {
-            case Frame<A>::Nv12:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                BgraToYuv420p(src.planes[0], dst.planes[0], u, v);
-                InterleaveUv(u, v, dst.planes[1]);
-                break;
-            }
-            case Frame<A>::Yuv420p:
-                BgraToYuv420p(src.planes[0], dst.planes[0], dst.planes[1], dst.planes[2]);
+            case Frame<A>::Yuyv16:
+                switch (dst.format)
+                {
+                case Frame<A>::Nv12:
+                    YuyvToNv12(src.planes[0], dst.planes[0], dst.planes[1]);
+                    break;
+                case Frame<A>::Yuv420p:
+                    YuyvToYuv420p(src.planes[0], dst.planes[0], dst.planes[1], dst.planes[2]);
+                    break;
+                case Frame<A>::Bgra32:
+                    YuyvToBgra(src.planes[0], dst.planes[0], 0xFF, yuvType);
+                    break;
+                case Frame<A>::Bgr24:
+                    YuyvToBgr(src.planes[0], dst.planes[0], yuvType);
+                    break;
+                case Frame<A>::Gray8:
+                    YuyvToGray(src.planes[0], dst.planes[0]);
+                    break;
+                case Frame<A>::Rgb24:
+                    YuyvToRgb(src.planes[0], dst.planes[0], yuvType);
+                    break;
+                default:
+                    assert(0);
+                }
                 break;
-            case Frame<A>::Bgr24:
-                BgraToBgr(src.planes[0], dst.planes[0]);
+
+            case Frame<A>::Uyvy16:
+                switch (dst.format)
+                {
+                case Frame<A>::Nv12:
+                    UyvyToNv12(src.planes[0], dst.planes[0], dst.planes[1]);
+                    break;
+                case Frame<A>::Yuv420p:
+                    UyvyToYuv420p(src.planes[0], dst.planes[0], dst.planes[1], dst.planes[2]);
+                    break;
+                case Frame<A>::Bgra32:
+                    UyvyToBgra(src.planes[0], dst.planes[0], 0xFF, yuvType);
+                    break;
+                case Frame<A>::Bgr24:
+                    UyvyToBgr(src.planes[0], dst.planes[0], yuvType);
+                    break;
+                case Frame<A>::Gray8:
+                    UyvyToGray(src.planes[0], dst.planes[0]);
+                    break;
+                case Frame<A>::Rgb24:
+                    UyvyToRgb(src.planes[0], dst.planes[0], yuvType);
+                    break;
+                default:
+                    assert(0);
+                }
                 break;
-            case Frame<A>::Gray8:
-                BgraToGray(src.planes[0], dst.planes[0]);
+
+            case Frame<A>::P010:
+                switch (dst.format)
+                {
+                case Frame<A>::Nv12:
+                    Uint16ToGray(src.planes[0], dst.planes[0], 8);
+                    Uint16ToGray(src.planes[1], dst.planes[1], 8);
+                    break;
+                case Frame<A>::Bgra32:
+                    P016ToBgra(src.planes[0], src.planes[1], dst.planes[0], 8, 0xFF, yuvType);
+                    break;
+                case Frame<A>::Gray8:
+                    Uint16ToGray(src.planes[0], dst.planes[0], 8);
+                    break;
+                default:
+                    assert(0);
+                }
                 break;
-            case Frame<A>::Rgb24:
-                BgraToRgb(src.planes[0], dst.planes[0]);
+
+            case Frame<A>::Yuv420p16:
+                switch (dst.format)
+                {
+                case Frame<A>::Yuv420p:
+                    Uint16ToGray(src.planes[0], dst.planes[0], 8);
+                    Uint16ToGray(src.planes[1], dst.planes[1], 8);
+                    Uint16ToGray(src.planes[2], dst.planes[2], 8);
+                    break;
+                case Frame<A>::Bgra32:
+                    Yuv420p16ToBgra(src.planes[0], src.planes[1], src.planes[2], dst.planes[0], 8, 0xFF, yuvType);
+                    break;
+                case Frame<A>::Gray8:
+                    Uint16ToGray(src.planes[0], dst.planes[0], 8);
+                    break;
+                default:
+                    assert(0);
+                }
                 break;
+
             default:
                 assert(0);
             }
-            break;
+        }
+    }
 
+    template <template<class> class A> SIMD_INLINE FrameConvertPath ConvertPath(const Frame<A> & src, const Frame<A> & dst)
+    {
+        if (src.format == Frame<A>::None || dst.format == Frame<A>::None)
+            return FrameConvertNone;
+        if (src.format == dst.format)
+            return FrameConvertCopy;
+        if (Detail::ConvertStripFormat<A>(src.format, dst.format) != Frame<A>::None)
+            return FrameConvertStrip;
+        switch (dst.format)
+        {
+        case Frame<A>::Nv12:
+        case Frame<A>::Yuv420p:
+        case Frame<A>::Bgra32:
         case Frame<A>::Bgr24:
-            switch (dst.format)
-            {
-            case Frame<A>::Nv12:
+        case Frame<A>::Gray8:
+        case Frame<A>::Rgb24:
+            return FrameConvertDirect;
+        default:
+            return FrameConvertNone;
+        }
+    }
+
+    template <template<class> class A> SIMD_INLINE FrameConvertPath Convert(const Frame<A> & src, Frame<A> & dst, SimdYuvType yuvType)
+    {
+        assert(EqualSize(src, dst) && src.format && dst.format && src.flipped == dst.flipped);
+
+        FrameConvertPath path = ConvertPath(src, dst);
+        switch (path)
+        {
+        case FrameConvertCopy:
+            Copy(src, dst);
+            break;
+        case FrameConvertDirect:
+            Detail::ConvertDirect(src, dst, yuvType);
+            break;
+        case FrameConvertStrip:
+        {
+            size_t stripSize = std::max<size_t>(SimdCpuInfo(SimdCpuInfoCacheL2), 256 * 1024) / 2;
+            size_t stripHeight = std::max<size_t>(stripSize / (src.width * 4) & ~size_t(1), 2);
+            Frame<A> buffer(src.width, std::min(stripHeight, src.height), Detail::ConvertStripFormat<A>(src.format, dst.format), src.flipped);
+            for (size_t row = 0; row < src.height; row += stripHeight)
             {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                BgrToYuv420p(src.planes[0], dst.planes[0], u, v);
-                InterleaveUv(u, v, dst.planes[1]);
-                break;
-            }
-            case Frame<A>::Yuv420p:
-                BgrToYuv420p(src.planes[0], dst.planes[0], dst.planes[1], dst.planes[2]);
-                break;
-            case Frame<A>::Bgra32:
-                BgrToBgra(src.planes[0], dst.planes[0]);
-                break;
-            case Frame<A>::Gray8:
-                BgrToGray(src.planes[0], dst.planes[0]);
-                break;
-            case Frame<A>::Rgb24:
-                BgrToRgb(src.planes[0], dst.planes[0]);
-                break;
-            default:
-                assert(0);
+                size_t end = std::min(row + stripHeight, src.height);
+                Frame<A> srcStrip = src.Region(0, row, src.width, end);
+                Frame<A> dstStrip = dst.Region(0, row, dst.width, end);
+                Frame<A> bufStrip = buffer.Region(0, 0, buffer.width, end - row);
+                Detail::ConvertDirect(srcStrip, bufStrip, yuvType);
+                Detail::ConvertDirect(bufStrip, dstStrip, yuvType);
             }
             break;
+        }
+        default:
+            assert(0);
+        }
+        return path;
+    }
+
+    template <template<class> class A> SIMD_INLINE void SynetSetInput(const Frame<A> & src, const Rectangle<ptrdiff_t> & roi, size_t width, size_t height,
+        const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType format, bool letterbox, uint8_t padding,
+        SimdYuvType yuvType, SimdResizeMethodType method)
+    {
+        SynetSetInputContext<A> context;
+        context.Run(src, roi, width, height, lower, upper, dst, channels, format, letterbox, padding, yuvType, method);
+    }
+
+    //-------------------------------------------------------------------------
+
+    // struct SynetSetInputContext implementation:
+
+    template <template<class> class A> SIMD_INLINE void SynetSetInputContext<A>::Run(const Frame<A> & src, const Rectangle<ptrdiff_t> & roi, size_t width, size_t height,
+        const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType format, bool letterbox, uint8_t padding,
+        SimdYuvType yuvType, SimdResizeMethodType method)
+    {
+        assert(src.format && (channels == 1 || channels == 3) && width && height);
 
+        Frame<A> crop = src.Region(roi);
+        if (crop.format == Frame<A>::None || crop.width == 0 || crop.height == 0)
+            return;
+
+        bool convert = false;
+        switch (crop.format)
+        {
         case Frame<A>::Gray8:
-            switch (dst.format)
-            {
-            case Frame<A>::Nv12:
-                Copy(src.planes[0], dst.planes[0]);
-                Fill(dst.planes[1], 128);
-                break;
-            case Frame<A>::Yuv420p:
-                Copy(src.planes[0], dst.planes[0]);
-                Fill(dst.planes[1], 128);
-                Fill(dst.planes[2], 128);
-                break;
-            case Frame<A>::Bgra32:
-                GrayToBgra(src.planes[0], dst.planes[0]);
-                break;
-            case Frame<A>::Bgr24:
-                GrayToBgr(src.planes[0], dst.planes[0]);
-                break;
-            case Frame<A>::Rgb24:
-                GrayToBgr(src.planes[0], dst.planes[0]);
-                break;
-            default:
-                assert(0);
-            }
+        case Frame<A>::Bgra32:
+        case Frame<A>::Bgr24:
+        case Frame<A>::Rgb24:
             break;
+        case Frame<A>::Nv12:
+        case Frame<A>::Yuv420p:
+            convert = channels == 3;
+            break;
+        default:
+            convert = true;
+        }
 
-        case Frame<A>::Rgb24:
-            switch (dst.format)
-            {
-            case Frame<A>::Nv12:
+        View<A> image = crop.planes[0];
+        if (convert)
+        {
+            typename Frame<A>::Format bufFormat = channels == 1 ? Frame<A>::Gray8 : Frame<A>::Bgr24;
+            if (_converted.width != crop.width || _converted.height != crop.height || _converted.format != bufFormat)
+                _converted.Recreate(crop.width, crop.height, bufFormat);
+            _converted.flipped = crop.flipped;
+            image = _converted.planes[0];
+        }
+
+        if (!Actual(image, width, height, lower, upper, channels, format, letterbox, padding, method))
+        {
+            if (_context)
+                ::SimdRelease(_context);
+            _context = ::SimdSynetSetInputInit(image.width, image.height, (SimdPixelFormatType)image.format, width, height,
+                lower, upper, channels, format, method, letterbox ? SimdTrue : SimdFalse, padding);
+            _srcW = image.width;
+            _srcH = image.height;
+            _srcFormat = image.format;
+            _dstW = width;
+            _dstH = height;
+            _channels = channels;
+            _format = format;
+            _method = method;
+            _letterbox = letterbox;
+            _padding = padding;
+            for (size_t c = 0; c < channels; ++c)
             {
-                View<A> bgr(src.Size(), View<A>::Bgr24);
-                BgrToRgb(src.planes[0], bgr);
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                BgrToYuv420p(bgr, dst.planes[0], u, v);
-                InterleaveUv(u, v, dst.planes[1]);
-                break;
+                _lower[c] = lower[c];
+                _upper[c] = upper[c];
             }
-            case Frame<A>::Yuv420p:
+        }
+        assert(_context);
+
+        if (convert)
+        {
+            size_t stripSize = std::max<size_t>(SimdCpuInfo(SimdCpuInfoCacheL2), 256 * 1024) / 2;
+            size_t stripHeight = std::max<size_t>(stripSize / (crop.width * 4) & ~size_t(1), 2);
+            for (size_t row = 0; row < crop.height; row += stripHeight)
             {
-                View<A> bgr(src.Size(), View<A>::Bgr24);
-                BgrToRgb(src.planes[0], bgr);
-                BgrToYuv420p(bgr, dst.planes[0], dst.planes[1], dst.planes[2]);
-                break;
+                size_t end = std::min(row + stripHeight, crop.height);
+                Frame<A> srcStrip = crop.Region(0, row, crop.width, end);
+                Frame<A> dstStrip = _converted.Region(0, row, _converted.width, end);
+                Convert(srcStrip, dstStrip, yuvType);
+                ::SimdSynetSetInputRunRows(_context, image.data, image.stride, row, end, dst);
             }
-            case Frame<A>::Bgra32:
-                RgbToBgra(src.planes[0], dst.planes[0]);
-                break;
-            case Frame<A>::Gray8:
-                RgbToGray(src.planes[0], dst.planes[0]);
-                break;
-            case Frame<A>::Rgb24:
-                BgrToRgb(src.planes[0], dst.planes[0]);
-                break;
-            default:
-                assert(0);
-            }
-
-        default:
-            assert(0);
         }
+        else
+            ::SimdSynetSetInputRun(_context, image.data, image.stride, dst);
+    }
+
+    template <template<class> class A> SIMD_INLINE bool SynetSetInputContext<A>::Actual(const View<A> & src, size_t width, size_t height, const float * lower, const float * upper,
+        size_t channels, SimdTensorFormatType format, bool letterbox, uint8_t padding, SimdResizeMethodType method) const
+    {
+        if (_context == NULL || src.width != _srcW || src.height != _srcH || src.format != _srcFormat || width != _dstW || height != _dstH ||
+            channels != _channels || format != _format || letterbox != _letterbox || padding != _padding || method != _method)
+            return false;
+        for (size_t c = 0; c < channels; ++c)
+            if (lower[c] != _lower[c] || upper[c] != _upper[c])
+                return false;
+        return true;
     }
 }
 
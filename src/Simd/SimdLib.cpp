@@ -61,15 +61,22 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdConst.h"
 #include "Simd/SimdLog.h"
 #include "Simd/SimdPerformance.h"
+#include "Simd/SimdParallelRows.h"
+#include "Simd/SimdDispatch.h"
 
 #include "Simd/SimdGaussianBlur.h"
+#include "Simd/SimdColorMatrix.h"
+#include "Simd/SimdLut3d.h"
+#include "Simd/SimdWarpAffine.h"
 #include "Simd/SimdResizer.h"
+#include "Simd/SimdSynet.h"
 #include "Simd/SimdSynetConvolution8i.h"
 #include "Simd/SimdSynetConvolution32f.h"
 #include "Simd/SimdSynetDeconvolution32f.h"
 #include "Simd/SimdSynetMergedConvolution32f.h"
 #include "Simd/SimdSynetMergedConvolution8i.h"
 #include "Simd/SimdSynetScale8i.h"
+#include "Simd/SimdSynetWorkspace.h"
 
 #include "Simd/SimdBase.h"
 #include "Simd/SimdSse1.h"
@@ -94,6 +101,58 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 namespace Simd
 {
     const size_t ALIGNMENT = GetAlignment();
+
+    namespace Base
+    {
+        const IsaEnable * const * IsaEnables()
+        {
+            static const IsaEnable * const enables[] = {
+#ifdef SIMD_SSE_ENABLE
+                &Sse::Enable,
+#endif
+#ifdef SIMD_SSE2_ENABLE
+                &Sse2::Enable,
+#endif
+#ifdef SIMD_SSE3_ENABLE
+                &Sse3::Enable,
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+                &Ssse3::Enable,
+#endif
+#ifdef SIMD_SSE41_ENABLE
+                &Sse41::Enable,
+#endif
+#ifdef SIMD_SSE42_ENABLE
+                &Sse42::Enable,
+#endif
+#ifdef SIMD_AVX_ENABLE
+                &Avx::Enable,
+#endif
+#ifdef SIMD_AVX2_ENABLE
+                &Avx2::Enable,
+#endif
+#ifdef SIMD_AVX512F_ENABLE
+                &Avx512f::Enable,
+#endif
+#ifdef SIMD_AVX512BW_ENABLE
+                &Avx512bw::Enable,
+#endif
+#ifdef SIMD_AVX512VNNI_ENABLE
+                &Avx512vnni::Enable,
+#endif
+#ifdef SIMD_VMX_ENABLE
+                &Vmx::Enable,
+#endif
+#ifdef SIMD_VSX_ENABLE
+                &Vsx::Enable,
+#endif
+#ifdef SIMD_NEON_ENABLE
+                &Neon::Enable,
+#endif
+                NULL };
+            return enables;
+        }
+    }
 }
 
 SIMD_API const char * SimdVersion()
@@ -103,6 +162,43 @@ SIMD_API const char * SimdVersion()
 
 using namespace Simd;
 
+static SimdIsaType UsedIsa()
+{
+#ifdef SIMD_AVX512VNNI_ENABLE
+    if (Avx512vnni::Enable)
+        return SimdIsaAvx512vnni;
+#endif
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        return SimdIsaAvx512bw;
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return SimdIsaAvx2;
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        return SimdIsaSse41;
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        return SimdIsaSse2;
+#endif
+#ifdef SIMD_VSX_ENABLE
+    if (Vsx::Enable)
+        return SimdIsaVsx;
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if (Vmx::Enable)
+        return SimdIsaVmx;
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable)
+        return SimdIsaNeon;
+#endif
+    return SimdIsaBase;
+}
+
 SIMD_API size_t SimdCpuInfo(SimdCpuInfoType type)
 {
     switch (type)
@@ -155,11 +251,22 @@ SIMD_API size_t SimdCpuInfo(SimdCpuInfoType type)
 #ifdef SIMD_NEON_ENABLE
     case SimdCpuInfoNeon: return Neon::Enable ? 1 : 0;
 #endif
+    case SimdCpuInfoIsa: return UsedIsa();
     default:
         return 0;
     }
 }
 
+SIMD_API SimdIsaType SimdGetMaxIsa()
+{
+    return Base::GetMaxIsa();
+}
+
+SIMD_API void SimdSetMaxIsa(SimdIsaType isa)
+{
+    Base::SetMaxIsa((SimdIsaType)RestrictRange<int>(isa, SimdIsaBase, SimdIsaSse2));
+}
+
 SIMD_API const char * SimdPerformanceStatistic()
 {
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
@@ -169,11 +276,67 @@ SIMD_API const char * SimdPerformanceStatistic()
 #endif
 }
 
+SIMD_API const char * SimdPerformanceStatisticExport(SimdPerformanceStatisticFormatType format)
+{
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+    return Base::PerformanceMeasurerStorage::s_storage.PerformanceStatistic(format);
+#else
+    return "";
+#endif
+}
+
+SIMD_API void SimdPerformanceStatisticReset()
+{
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+    Base::PerformanceMeasurerStorage::s_storage.Reset();
+#endif
+}
+
+SIMD_API void SimdSetTraceCallback(SimdTraceCallbackPtr callback, void * userData)
+{
+    Base::SetTraceCallback(callback, userData);
+}
+
+SIMD_API SimdBool SimdTraceEnabled()
+{
+    return Base::TraceEnabled() ? SimdTrue : SimdFalse;
+}
+
+SIMD_API void SimdTraceEvent(SimdTraceEventType type, const char * name, int64_t size)
+{
+    Base::TraceEvent(type, name, size);
+}
+
+SIMD_API SimdBool SimdChromeTraceStart(const char * path)
+{
+    return Base::ChromeTraceStart(path) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API SimdBool SimdChromeTraceStop()
+{
+    return Base::ChromeTraceStop() ? SimdTrue : SimdFalse;
+}
+
 SIMD_API void * SimdAllocate(size_t size, size_t align)
 {
     return Allocate(size, align);
 }
 
+SIMD_API void * SimdAllocateWithFlags(size_t size, size_t align, int flags)
+{
+    return Allocate(size, align, flags);
+}
+
+SIMD_API int SimdGetAllocateFlags()
+{
+    return Base::GetAllocateFlags();
+}
+
+SIMD_API void SimdSetAllocateFlags(int flags)
+{
+    Base::SetAllocateFlags(flags);
+}
+
 SIMD_API void SimdFree(void * ptr)
 {
     Free(ptr);
@@ -204,6 +367,16 @@ SIMD_API void SimdSetThreadNumber(size_t threadNumber)
     Base::SetThreadNumber(threadNumber);
 }
 
+SIMD_API size_t SimdGetParallelThreshold()
+{
+    return Base::GetParallelThreshold();
+}
+
+SIMD_API void SimdSetParallelThreshold(size_t threshold)
+{
+    Base::SetParallelThreshold(threshold);
+}
+
 SIMD_API SimdBool SimdGetFastMode()
 {
 #ifdef SIMD_SSE_ENABLE
@@ -233,1184 +406,1360 @@ SIMD_API void SimdSetFastMode(SimdBool value)
 
 SIMD_API uint32_t SimdCrc32c(const void * src, size_t size)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::Crc32c)>()
 #ifdef SIMD_SSE42_ENABLE
-    if(Sse42::Enable)
-        return Sse42::Crc32c(src, size);
-    else
+        .Add(Sse42::Enable, Sse42::Crc32c)
 #endif
-        return Base::Crc32c(src, size);
+        .Add(Base::Crc32c);
+    return dispatch.Get()(src, size);
 }
 
 SIMD_API void SimdAbsDifference(const uint8_t *a, size_t aStride, const uint8_t * b, size_t bStride, uint8_t *c, size_t cStride,
     size_t width, size_t height)
 {
+    typedef void(*SimdAbsDifferencePtr) (const uint8_t *a, size_t aStride, const uint8_t * b, size_t bStride, uint8_t *c, size_t cStride, size_t width, size_t height);
+    static const auto dispatch = Dispatch<SimdAbsDifferencePtr>()
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::AbsDifference(a, aStride, b, bStride, c, cStride, width, height);
-    else
+        .Add(Avx2::Enable, Avx2::AbsDifference, Avx2::A)
 #endif
-    Base::AbsDifference(a, aStride, b, bStride, c, cStride, width, height);
+        .Add(Base::AbsDifference);
+    dispatch.Get(width)(a, aStride, b, bStride, c, cStride, width, height);
 }
 
 SIMD_API void SimdAbsDifferenceSum(const uint8_t *a, size_t aStride, const uint8_t * b, size_t bStride,
                                    size_t width, size_t height, uint64_t * sum)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::AbsDifferenceSum)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::AbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::AbsDifferenceSum)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::AbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
+        .Add(Avx2::Enable, Avx2::AbsDifferenceSum, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::AbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
+        .Add(Sse2::Enable, Sse2::AbsDifferenceSum, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::AbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
+        .Add(Vmx::Enable, Vmx::AbsDifferenceSum, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::AbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
+        .Add(Neon::Enable, Neon::AbsDifferenceSum, Neon::A)
 #endif
-        Base::AbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
+        .Add(Base::AbsDifferenceSum);
+    dispatch.Get(width)(a, aStride, b, bStride, width, height, sum);
 }
 
 SIMD_API void SimdAbsDifferenceSumMasked(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
                                          const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::AbsDifferenceSumMasked)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::AbsDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::AbsDifferenceSumMasked)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::AbsDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
+        .Add(Avx2::Enable, Avx2::AbsDifferenceSumMasked, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::AbsDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
+        .Add(Sse2::Enable, Sse2::AbsDifferenceSumMasked, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::AbsDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
+        .Add(Vmx::Enable, Vmx::AbsDifferenceSumMasked, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::AbsDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
+        .Add(Neon::Enable, Neon::AbsDifferenceSumMasked, Neon::A)
 #endif
-        Base::AbsDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
+        .Add(Base::AbsDifferenceSumMasked);
+    dispatch.Get(width)(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
 }
 
 SIMD_API void SimdAbsDifferenceSums3x3(const uint8_t *current, size_t currentStride, const uint8_t * background, size_t backgroundStride,
                                        size_t width, size_t height, uint64_t * sums)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::AbsDifferenceSums3x3)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::AbsDifferenceSums3x3(current, currentStride, background, backgroundStride, width, height, sums);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::AbsDifferenceSums3x3)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::AbsDifferenceSums3x3(current, currentStride, background, backgroundStride, width, height, sums);
-    else
+        .Add(Avx2::Enable, Avx2::AbsDifferenceSums3x3, Avx2::A + 2)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 2)
-        Sse2::AbsDifferenceSums3x3(current, currentStride, background, backgroundStride, width, height, sums);
-    else
+        .Add(Sse2::Enable, Sse2::AbsDifferenceSums3x3, Sse2::A + 2)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A + 2)
-        Vmx::AbsDifferenceSums3x3(current, currentStride, background, backgroundStride, width, height, sums);
-    else
+        .Add(Vmx::Enable, Vmx::AbsDifferenceSums3x3, Vmx::A + 2)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::AbsDifferenceSums3x3(current, currentStride, background, backgroundStride, width, height, sums);
-    else
+        .Add(Neon::Enable, Neon::AbsDifferenceSums3x3, Neon::A + 2)
 #endif
-        Base::AbsDifferenceSums3x3(current, currentStride, background, backgroundStride, width, height, sums);
+        .Add(Base::AbsDifferenceSums3x3);
+    dispatch.Get(width)(current, currentStride, background, backgroundStride, width, height, sums);
 }
 
 SIMD_API void SimdAbsDifferenceSums3x3Masked(const uint8_t *current, size_t currentStride, const uint8_t *background, size_t backgroundStride,
                                              const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sums)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::AbsDifferenceSums3x3Masked)>()
 #if defined(SIMD_AVX512BW_ENABLE) && !defined(SIMD_MASKZ_LOAD_ERROR)
-    if (Avx512bw::Enable)
-        Avx512bw::AbsDifferenceSums3x3Masked(current, currentStride, background, backgroundStride, mask, maskStride, index, width, height, sums);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::AbsDifferenceSums3x3Masked)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::AbsDifferenceSums3x3Masked(current, currentStride, background, backgroundStride, mask, maskStride, index, width, height, sums);
-    else
+        .Add(Avx2::Enable, Avx2::AbsDifferenceSums3x3Masked, Avx2::A + 2)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 2)
-        Sse2::AbsDifferenceSums3x3Masked(current, currentStride, background, backgroundStride, mask, maskStride, index, width, height, sums);
-    else
+        .Add(Sse2::Enable, Sse2::AbsDifferenceSums3x3Masked, Sse2::A + 2)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A + 2)
-        Vmx::AbsDifferenceSums3x3Masked(current, currentStride, background, backgroundStride, mask, maskStride, index, width, height, sums);
-    else
+        .Add(Vmx::Enable, Vmx::AbsDifferenceSums3x3Masked, Vmx::A + 2)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::AbsDifferenceSums3x3Masked(current, currentStride, background, backgroundStride, mask, maskStride, index, width, height, sums);
-    else
+        .Add(Neon::Enable, Neon::AbsDifferenceSums3x3Masked, Neon::A + 2)
 #endif
-        Base::AbsDifferenceSums3x3Masked(current, currentStride, background, backgroundStride, mask, maskStride, index, width, height, sums);
+        .Add(Base::AbsDifferenceSums3x3Masked);
+    dispatch.Get(width)(current, currentStride, background, backgroundStride, mask, maskStride, index, width, height, sums);
 }
 
-SIMD_API void SimdAbsGradientSaturatedSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-                                          uint8_t * dst, size_t dstStride)
+static void AbsGradientSaturatedSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                                    uint8_t * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::AbsGradientSaturatedSum)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Simd::Avx512bw::AbsGradientSaturatedSum(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::AbsGradientSaturatedSum)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Simd::Avx2::AbsGradientSaturatedSum(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::AbsGradientSaturatedSum, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::AbsGradientSaturatedSum(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::AbsGradientSaturatedSum, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::AbsGradientSaturatedSum(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::AbsGradientSaturatedSum, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::AbsGradientSaturatedSum(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::AbsGradientSaturatedSum, Neon::A)
 #endif
-        Base::AbsGradientSaturatedSum(src, srcStride, width, height, dst, dstStride);
+        .Add(Base::AbsGradientSaturatedSum);
+    dispatch.Get(width)(src, srcStride, width, height, dst, dstStride);
+}
+
+SIMD_API void SimdAbsGradientSaturatedSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                                          uint8_t * dst, size_t dstStride)
+{
+    ParallelRows(width, height, 1, dst, dstStride, width, [=](size_t begin, size_t end, uint8_t * dst)
+    {
+        AbsGradientSaturatedSum(src + begin * srcStride, srcStride, width, end - begin, dst, dstStride);
+    });
 }
 
 SIMD_API void SimdAddFeatureDifference(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                        const uint8_t * lo, size_t loStride, const uint8_t * hi, size_t hiStride,
                                        uint16_t weight, uint8_t * difference, size_t differenceStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::AddFeatureDifference)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::AddFeatureDifference(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::AddFeatureDifference)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::AddFeatureDifference(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
-    else
+        .Add(Avx2::Enable, Avx2::AddFeatureDifference, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::AddFeatureDifference(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
-    else
+        .Add(Sse2::Enable, Sse2::AddFeatureDifference, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::AddFeatureDifference(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
-    else
+        .Add(Vmx::Enable, Vmx::AddFeatureDifference, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::AddFeatureDifference(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
-    else
+        .Add(Neon::Enable, Neon::AddFeatureDifference, Neon::A)
 #endif
-        Base::AddFeatureDifference(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
+        .Add(Base::AddFeatureDifference);
+    dispatch.Get(width)(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
 }
 
 SIMD_API void SimdAlphaBlending(const uint8_t *src, size_t srcStride, size_t width, size_t height, size_t channelCount,
                    const uint8_t *alpha, size_t alphaStride, uint8_t *dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::AlphaBlending)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::AlphaBlending)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::AlphaBlending, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::AlphaBlending, Ssse3::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::AlphaBlending, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::AlphaBlending, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::AlphaBlending, Neon::A)
 #endif
-        Base::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
+        .Add(Base::AlphaBlending);
+    dispatch.Get(width)(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
 }
 
 SIMD_API void SimdAlphaFilling(uint8_t * dst, size_t dstStride, size_t width, size_t height, const uint8_t * channel, size_t channelCount, const uint8_t * alpha, size_t alphaStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::AlphaFilling)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::AlphaFilling(dst, dstStride, width, height, channel, channelCount, alpha, alphaStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::AlphaFilling)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::AlphaFilling(dst, dstStride, width, height, channel, channelCount, alpha, alphaStride);
-    else
+        .Add(Avx2::Enable, Avx2::AlphaFilling, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::AlphaFilling(dst, dstStride, width, height, channel, channelCount, alpha, alphaStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::AlphaFilling, Ssse3::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::AlphaFilling(dst, dstStride, width, height, channel, channelCount, alpha, alphaStride);
-    else
+        .Add(Sse2::Enable, Sse2::AlphaFilling, Sse2::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::AlphaFilling(dst, dstStride, width, height, channel, channelCount, alpha, alphaStride);
-    else
+        .Add(Neon::Enable, Neon::AlphaFilling, Neon::A)
 #endif
-        Base::AlphaFilling(dst, dstStride, width, height, channel, channelCount, alpha, alphaStride);
+        .Add(Base::AlphaFilling);
+    dispatch.Get(width)(dst, dstStride, width, height, channel, channelCount, alpha, alphaStride);
 }
 
 SIMD_API void SimdAlphaPremultiply(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::AlphaPremultiply)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::AlphaPremultiply(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::AlphaPremultiply)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::AlphaPremultiply(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::AlphaPremultiply, Avx2::F)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Sse2::F)
-        Ssse3::AlphaPremultiply(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::AlphaPremultiply, Sse2::F)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::F)
-        Sse2::AlphaPremultiply(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::AlphaPremultiply, Sse2::F)
 #endif
-        Base::AlphaPremultiply(src, srcStride, width, height, dst, dstStride);
+        .Add(Base::AlphaPremultiply);
+    dispatch.Get(width)(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdAlphaUnpremultiply(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::AlphaUnpremultiply)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::AlphaUnpremultiply(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::AlphaUnpremultiply)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::AlphaUnpremultiply(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::AlphaUnpremultiply, Avx2::A)
 #endif
 #ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::AlphaUnpremultiply(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Sse41::Enable, Sse41::AlphaUnpremultiply, Sse41::A)
 #endif
-        Base::AlphaUnpremultiply(src, srcStride, width, height, dst, dstStride);
+        .Add(Base::AlphaUnpremultiply);
+    dispatch.Get(width)(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                           uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::BackgroundGrowRangeSlow)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BackgroundGrowRangeSlow(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BackgroundGrowRangeSlow)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundGrowRangeSlow(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
+        .Add(Avx2::Enable, Avx2::BackgroundGrowRangeSlow, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundGrowRangeSlow(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
+        .Add(Sse2::Enable, Sse2::BackgroundGrowRangeSlow, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundGrowRangeSlow(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
+        .Add(Vmx::Enable, Vmx::BackgroundGrowRangeSlow, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BackgroundGrowRangeSlow(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
+        .Add(Neon::Enable, Neon::BackgroundGrowRangeSlow, Neon::A)
 #endif
-        Base::BackgroundGrowRangeSlow(value, valueStride, width, height, lo, loStride, hi, hiStride);
+        .Add(Base::BackgroundGrowRangeSlow);
+    dispatch.Get(width)(value, valueStride, width, height, lo, loStride, hi, hiStride);
 }
 
 SIMD_API void SimdBackgroundGrowRangeFast(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                           uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::BackgroundGrowRangeFast)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BackgroundGrowRangeFast(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BackgroundGrowRangeFast)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundGrowRangeFast(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
+        .Add(Avx2::Enable, Avx2::BackgroundGrowRangeFast, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundGrowRangeFast(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
+        .Add(Sse2::Enable, Sse2::BackgroundGrowRangeFast, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundGrowRangeFast(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
+        .Add(Vmx::Enable, Vmx::BackgroundGrowRangeFast, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BackgroundGrowRangeFast(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
+        .Add(Neon::Enable, Neon::BackgroundGrowRangeFast, Neon::A)
 #endif
-        Base::BackgroundGrowRangeFast(value, valueStride, width, height, lo, loStride, hi, hiStride);
+        .Add(Base::BackgroundGrowRangeFast);
+    dispatch.Get(width)(value, valueStride, width, height, lo, loStride, hi, hiStride);
 }
 
 SIMD_API void SimdBackgroundIncrementCount(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                            const uint8_t * loValue, size_t loValueStride, const uint8_t * hiValue, size_t hiValueStride,
                                            uint8_t * loCount, size_t loCountStride, uint8_t * hiCount, size_t hiCountStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::BackgroundIncrementCount)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BackgroundIncrementCount(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BackgroundIncrementCount)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundIncrementCount(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride);
-    else
+        .Add(Avx2::Enable, Avx2::BackgroundIncrementCount, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundIncrementCount(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride);
-    else
+        .Add(Sse2::Enable, Sse2::BackgroundIncrementCount, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundIncrementCount(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride);
-    else
+        .Add(Vmx::Enable, Vmx::BackgroundIncrementCount, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BackgroundIncrementCount(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride);
-    else
+        .Add(Neon::Enable, Neon::BackgroundIncrementCount, Neon::A)
 #endif
-        Base::BackgroundIncrementCount(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride);
+        .Add(Base::BackgroundIncrementCount);
+    dispatch.Get(width)(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride);
 }
 
 SIMD_API void SimdBackgroundAdjustRange(uint8_t * loCount, size_t loCountStride, size_t width, size_t height,
                                         uint8_t * loValue, size_t loValueStride, uint8_t * hiCount, size_t hiCountStride,
                                         uint8_t * hiValue, size_t hiValueStride, uint8_t threshold)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::BackgroundAdjustRange)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BackgroundAdjustRange(loCount, loCountStride, width, height, loValue, loValueStride,
-            hiCount, hiCountStride, hiValue, hiValueStride, threshold);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BackgroundAdjustRange)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundAdjustRange(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride, hiValue, hiValueStride, threshold);
-    else
+        .Add(Avx2::Enable, Avx2::BackgroundAdjustRange, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundAdjustRange(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride, hiValue, hiValueStride, threshold);
-    else
+        .Add(Sse2::Enable, Sse2::BackgroundAdjustRange, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundAdjustRange(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride, hiValue, hiValueStride, threshold);
-    else
+        .Add(Vmx::Enable, Vmx::BackgroundAdjustRange, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BackgroundAdjustRange(loCount, loCountStride, width, height, loValue, loValueStride,
-            hiCount, hiCountStride, hiValue, hiValueStride, threshold);
-    else
+        .Add(Neon::Enable, Neon::BackgroundAdjustRange, Neon::A)
 #endif
-        Base::BackgroundAdjustRange(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride, hiValue, hiValueStride, threshold);
+        .Add(Base::BackgroundAdjustRange);
+    dispatch.Get(width)(loCount, loCountStride, width, height, loValue, loValueStride, hiCount, hiCountStride, hiValue, hiValueStride, threshold);
 }
 
 SIMD_API void SimdBackgroundAdjustRangeMasked(uint8_t * loCount, size_t loCountStride, size_t width, size_t height,
                                               uint8_t * loValue, size_t loValueStride, uint8_t * hiCount, size_t hiCountStride,
                                               uint8_t * hiValue, size_t hiValueStride, uint8_t threshold, const uint8_t * mask, size_t maskStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::BackgroundAdjustRangeMasked)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BackgroundAdjustRangeMasked(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride, hiValue, hiValueStride, threshold, mask, maskStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BackgroundAdjustRangeMasked)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundAdjustRangeMasked(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride,hiValue, hiValueStride, threshold, mask, maskStride);
-    else
+        .Add(Avx2::Enable, Avx2::BackgroundAdjustRangeMasked, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundAdjustRangeMasked(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride,hiValue, hiValueStride, threshold, mask, maskStride);
-    else
+        .Add(Sse2::Enable, Sse2::BackgroundAdjustRangeMasked, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundAdjustRangeMasked(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride,hiValue, hiValueStride, threshold, mask, maskStride);
-    else
+        .Add(Vmx::Enable, Vmx::BackgroundAdjustRangeMasked, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BackgroundAdjustRangeMasked(loCount, loCountStride, width, height, loValue, loValueStride,
-            hiCount, hiCountStride, hiValue, hiValueStride, threshold, mask, maskStride);
-    else
+        .Add(Neon::Enable, Neon::BackgroundAdjustRangeMasked, Neon::A)
 #endif
-        Base::BackgroundAdjustRangeMasked(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride, hiValue, hiValueStride, threshold, mask, maskStride);
+        .Add(Base::BackgroundAdjustRangeMasked);
+    dispatch.Get(width)(loCount, loCountStride, width, height, loValue, loValueStride, hiCount, hiCountStride, hiValue, hiValueStride, threshold, mask, maskStride);
 }
 
 SIMD_API void SimdBackgroundShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                        uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::BackgroundShiftRange)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BackgroundShiftRange(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BackgroundShiftRange)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundShiftRange(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
+        .Add(Avx2::Enable, Avx2::BackgroundShiftRange, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundShiftRange(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
+        .Add(Sse2::Enable, Sse2::BackgroundShiftRange, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundShiftRange(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
+        .Add(Vmx::Enable, Vmx::BackgroundShiftRange, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BackgroundShiftRange(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
+        .Add(Neon::Enable, Neon::BackgroundShiftRange, Neon::A)
 #endif
-        Base::BackgroundShiftRange(value, valueStride, width, height, lo, loStride, hi, hiStride);
+        .Add(Base::BackgroundShiftRange);
+    dispatch.Get(width)(value, valueStride, width, height, lo, loStride, hi, hiStride);
 }
 
 SIMD_API void SimdBackgroundShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                              uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride, const uint8_t * mask, size_t maskStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::BackgroundShiftRangeMasked)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BackgroundShiftRangeMasked(value, valueStride, width, height, lo, loStride, hi, hiStride, mask, maskStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BackgroundShiftRangeMasked)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundShiftRangeMasked(value, valueStride, width, height, lo, loStride, hi, hiStride, mask, maskStride);
-    else
+        .Add(Avx2::Enable, Avx2::BackgroundShiftRangeMasked, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundShiftRangeMasked(value, valueStride, width, height, lo, loStride, hi, hiStride, mask, maskStride);
-    else
+        .Add(Sse2::Enable, Sse2::BackgroundShiftRangeMasked, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundShiftRangeMasked(value, valueStride, width, height, lo, loStride, hi, hiStride, mask, maskStride);
-    else
+        .Add(Vmx::Enable, Vmx::BackgroundShiftRangeMasked, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BackgroundShiftRangeMasked(value, valueStride, width, height, lo, loStride, hi, hiStride, mask, maskStride);
-    else
+        .Add(Neon::Enable, Neon::BackgroundShiftRangeMasked, Neon::A)
 #endif
-        Base::BackgroundShiftRangeMasked(value, valueStride, width, height, lo, loStride, hi, hiStride, mask, maskStride);
+        .Add(Base::BackgroundShiftRangeMasked);
+    dispatch.Get(width)(value, valueStride, width, height, lo, loStride, hi, hiStride, mask, maskStride);
 }
 
 SIMD_API void SimdBackgroundInitMask(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                      uint8_t index, uint8_t value, uint8_t * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::BackgroundInitMask)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BackgroundInitMask)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::BackgroundInitMask, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::BackgroundInitMask, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::BackgroundInitMask, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::BackgroundInitMask, Neon::A)
 #endif
-        Base::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
+        .Add(Base::BackgroundInitMask);
+    dispatch.Get(width)(src, srcStride, width, height, index, value, dst, dstStride);
 }
 
 SIMD_API void SimdBayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::BayerToBgr)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::A + 2)
-        Avx512bw::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BayerToBgr, Avx512bw::A + 2)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
-    else
+        .Add(Avx2::Enable, Avx2::BayerToBgr, Avx2::A + 2)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A + 2)
-        Ssse3::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::BayerToBgr, Ssse3::A + 2)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
-    else
+        .Add(Neon::Enable, Neon::BayerToBgr, Neon::A + 2)
 #endif
-        Base::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+        .Add(Base::BayerToBgr);
+    dispatch.Get(width)(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
 }
 
 SIMD_API void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::BayerToBgra)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::A + 2)
-        Avx512bw::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BayerToBgra, Avx512bw::A + 2)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
-    else
+        .Add(Avx2::Enable, Avx2::BayerToBgra, Avx2::A + 2)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A + 2)
-        Sse2::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
-    else
+        .Add(Sse2::Enable, Sse2::BayerToBgra, Sse2::A + 2)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
-    else
+        .Add(Neon::Enable, Neon::BayerToBgra, Neon::A + 2)
 #endif
-        Base::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+        .Add(Base::BayerToBgra);
+    dispatch.Get(width)(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
 }
 
 SIMD_API void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::BgraToBayer)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BgraToBayer)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
-    else
+        .Add(Ssse3::Enable, Ssse3::BgraToBayer, Ssse3::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
-    else
+        .Add(Vmx::Enable, Vmx::BgraToBayer, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
-    else
+        .Add(Neon::Enable, Neon::BgraToBayer, Neon::A)
 #endif
-        Base::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
+        .Add(Base::BgraToBayer);
+    dispatch.Get(width)(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
 }
 
-SIMD_API void SimdBgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride)
+static void BgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride)
 {
+    typedef void(*SimdBgraToBgrPtr) (const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride);
+    static const auto dispatch = Dispatch<SimdBgraToBgrPtr>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BgraToBgr)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
-    else
+        .Add(Avx2::Enable, Avx2::BgraToBgr, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::BgraToBgr, Ssse3::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
-    else
+        .Add(Vmx::Enable, Vmx::BgraToBgr, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
-    else
+        .Add(Neon::Enable, Neon::BgraToBgr, Neon::A)
 #endif
-        Base::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
+        .Add(Base::BgraToBgr);
+    dispatch.Get(width)(bgra, width, height, bgraStride, bgr, bgrStride);
 }
 
-SIMD_API void SimdBgraToGray(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
+SIMD_API void SimdBgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        BgraToBgr(bgra + begin * bgraStride, width, end - begin, bgraStride, bgr + begin * bgrStride, bgrStride);
+    });
+}
+
+static void BgraToGray(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::BgraToGray)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BgraToGray)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
-    else
+        .Add(Avx2::Enable, Avx2::BgraToGray, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
-    else
+        .Add(Sse2::Enable, Sse2::BgraToGray, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
-    else
+        .Add(Vmx::Enable, Vmx::BgraToGray, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
-    else
+        .Add(Neon::Enable, Neon::BgraToGray, Neon::HA)
 #endif
-        Base::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
+        .Add(Base::BgraToGray);
+    dispatch.Get(width)(bgra, width, height, bgraStride, gray, grayStride);
 }
 
-SIMD_API void SimdBgraToRgb(const uint8_t* bgra, size_t width, size_t height, size_t bgraStride, uint8_t* rgb, size_t rgbStride)
+SIMD_API void SimdBgraToGray(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        BgraToGray(bgra + begin * bgraStride, width, end - begin, bgraStride, gray + begin * grayStride, grayStride);
+    });
+}
+
+static void BgraToNv12(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::BgraToNv12)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgraToRgb(bgra, width, height, bgraStride, rgb, rgbStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BgraToNv12, Avx512bw::DA)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::BgraToRgb(bgra, width, height, bgraStride, rgb, rgbStride);
-    else
+        .Add(Avx2::Enable, Avx2::BgraToNv12, Avx2::DA)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::BgraToNv12, Sse41::DA)
+#endif
+        .Add(Base::BgraToNv12);
+    dispatch.Get(width)(bgra, width, height, bgraStride, y, yStride, uv, uvStride, yuvType);
+}
+
+SIMD_API void SimdBgraToNv12(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+{
+    ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+    {
+        BgraToNv12(bgra + begin * bgraStride, width, end - begin, bgraStride, y + begin * yStride, yStride, uv + begin / 2 * uvStride, uvStride, yuvType);
+    });
+}
+
+static void BgraToRgb(const uint8_t* bgra, size_t width, size_t height, size_t bgraStride, uint8_t* rgb, size_t rgbStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::BgraToRgb)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::BgraToRgb)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::BgraToRgb, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::BgraToRgb(bgra, width, height, bgraStride, rgb, rgbStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::BgraToRgb, Ssse3::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgraToRgb(bgra, width, height, bgraStride, rgb, rgbStride);
-    else
+        .Add(Neon::Enable, Neon::BgraToRgb, Neon::A)
 #endif
-        Base::BgraToRgb(bgra, width, height, bgraStride, rgb, rgbStride);
+        .Add(Base::BgraToRgb);
+    dispatch.Get(width)(bgra, width, height, bgraStride, rgb, rgbStride);
 }
 
-SIMD_API void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+SIMD_API void SimdBgraToRgb(const uint8_t* bgra, size_t width, size_t height, size_t bgraStride, uint8_t* rgb, size_t rgbStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        BgraToRgb(bgra + begin * bgraStride, width, end - begin, bgraStride, rgb + begin * rgbStride, rgbStride);
+    });
+}
+
+static void BgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::BgraToYuv420p)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BgraToYuv420p)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
+        .Add(Avx2::Enable, Avx2::BgraToYuv420p, Avx2::DA)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::DA)
-        Ssse3::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::BgraToYuv420p, Ssse3::DA)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::DA)
-        Sse2::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
+        .Add(Sse2::Enable, Sse2::BgraToYuv420p, Sse2::DA)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
+        .Add(Vmx::Enable, Vmx::BgraToYuv420p, Vmx::DA)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
+        .Add(Neon::Enable, Neon::BgraToYuv420p, Neon::DA)
 #endif
-        Base::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        .Add(Base::BgraToYuv420p);
+    dispatch.Get(width)(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
 }
 
-SIMD_API void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+SIMD_API void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+    ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+    {
+        BgraToYuv420p(bgra + begin * bgraStride, width, end - begin, bgraStride, y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride);
+    });
+}
+
+static void BgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::BgraToYuv420pV2)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BgraToYuv420pV2, Avx512bw::DA)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        .Add(Avx2::Enable, Avx2::BgraToYuv420pV2, Avx2::DA)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::BgraToYuv420pV2, Sse41::DA)
+#endif
+        .Add(Base::BgraToYuv420pV2);
+    dispatch.Get(width)(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+}
+
+SIMD_API void SimdBgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+    if (yuvType == SimdYuvBt601)
+        SimdBgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
     else
+    {
+        ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+        {
+            BgraToYuv420pV2(bgra + begin * bgraStride, width, end - begin, bgraStride, y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, yuvType);
+        });
+    }
+}
+
+static void BgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::BgraToYuv422p)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::BgraToYuv422p)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::BgraToYuv422p, Avx2::DA)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::DA)
-        Ssse3::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::BgraToYuv422p, Ssse3::DA)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::DA)
-        Sse2::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
+        .Add(Sse2::Enable, Sse2::BgraToYuv422p, Sse2::DA)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
+        .Add(Vmx::Enable, Vmx::BgraToYuv422p, Vmx::DA)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
+        .Add(Neon::Enable, Neon::BgraToYuv422p, Neon::DA)
 #endif
-        Base::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        .Add(Base::BgraToYuv422p);
+    dispatch.Get(width)(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
 }
 
-SIMD_API void SimdBgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+SIMD_API void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        BgraToYuv422p(bgra + begin * bgraStride, width, end - begin, bgraStride, y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride);
+    });
+}
+
+static void BgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::BgraToYuv422pV2)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BgraToYuv422pV2, Avx512bw::DA)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        .Add(Avx2::Enable, Avx2::BgraToYuv422pV2, Avx2::DA)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::BgraToYuv422pV2, Sse41::DA)
+#endif
+        .Add(Base::BgraToYuv422pV2);
+    dispatch.Get(width)(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+}
+
+SIMD_API void SimdBgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+    if (yuvType == SimdYuvBt601)
+        SimdBgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
     else
+    {
+        ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+        {
+            BgraToYuv422pV2(bgra + begin * bgraStride, width, end - begin, bgraStride, y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, yuvType);
+        });
+    }
+}
+
+static void BgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::BgraToYuv444p)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::BgraToYuv444p)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::BgraToYuv444p, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
+        .Add(Sse2::Enable, Sse2::BgraToYuv444p, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
+        .Add(Vmx::Enable, Vmx::BgraToYuv444p, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
+        .Add(Neon::Enable, Neon::BgraToYuv444p, Neon::A)
 #endif
-        Base::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        .Add(Base::BgraToYuv444p);
+    dispatch.Get(width)(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
 }
 
-SIMD_API void SimdBgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, 
-    uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride)
+SIMD_API void SimdBgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        BgraToYuv444p(bgra + begin * bgraStride, width, end - begin, bgraStride, y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride);
+    });
+}
+
+static void BgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::BgraToYuv444pV2)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BgraToYuv444pV2, Avx512bw::A)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::DA)
-        Avx2::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
+        .Add(Avx2::Enable, Avx2::BgraToYuv444pV2, Avx2::A)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::BgraToYuv444pV2, Sse41::A)
+#endif
+        .Add(Base::BgraToYuv444pV2);
+    dispatch.Get(width)(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+}
+
+SIMD_API void SimdBgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+    if (yuvType == SimdYuvBt601)
+        SimdBgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
     else
+    {
+        ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+        {
+            BgraToYuv444pV2(bgra + begin * bgraStride, width, end - begin, bgraStride, y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, yuvType);
+        });
+    }
+}
+
+static void BgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, 
+    uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::BgraToYuva420p)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::BgraToYuva420p)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::BgraToYuva420p, Avx2::DA)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::DA)
-        Ssse3::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::BgraToYuva420p, Ssse3::DA)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::DA)
-        Sse2::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
-    else
+        .Add(Sse2::Enable, Sse2::BgraToYuva420p, Sse2::DA)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
-    else
+        .Add(Neon::Enable, Neon::BgraToYuva420p, Neon::DA)
 #endif
-        Base::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
+        .Add(Base::BgraToYuva420p);
+    dispatch.Get(width)(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
+}
+
+SIMD_API void SimdBgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, 
+    uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride)
+{
+    ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+    {
+        BgraToYuva420p(bgra + begin * bgraStride, bgraStride, width, end - begin, y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, a + begin * aStride, aStride);
+    });
 }
 
 SIMD_API void SimdBgrToBayer(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::BgrToBayer)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BgrToBayer)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
-    else
+        .Add(Ssse3::Enable, Ssse3::BgrToBayer, Ssse3::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
-    else
+        .Add(Vmx::Enable, Vmx::BgrToBayer, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
-    else
+        .Add(Neon::Enable, Neon::BgrToBayer, Neon::A)
 #endif
-        Base::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
+        .Add(Base::BgrToBayer);
+    dispatch.Get(width)(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
 }
 
-SIMD_API void SimdBgrToBgra(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *bgra, size_t bgraStride, uint8_t alpha)
+static void BgrToBgra(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *bgra, size_t bgraStride, uint8_t alpha)
 {
+    typedef void(*SimdBgrToBgraPtr) (const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *bgra, size_t bgraStride, uint8_t alpha);
+    static const auto dispatch = Dispatch<SimdBgrToBgraPtr>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BgrToBgra)
 #endif
 #if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
-    else
+        .Add(Avx2::Enable, Avx2::BgrToBgra, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
-    else
+        .Add(Ssse3::Enable, Ssse3::BgrToBgra, Ssse3::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
-    else
+        .Add(Vmx::Enable, Vmx::BgrToBgra, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
-    else
+        .Add(Neon::Enable, Neon::BgrToBgra, Neon::A)
 #endif
-        Base::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
+        .Add(Base::BgrToBgra);
+    dispatch.Get(width)(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
 }
 
-SIMD_API void SimdBgr48pToBgra32(const uint8_t * blue, size_t blueStride, size_t width, size_t height,
+SIMD_API void SimdBgrToBgra(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *bgra, size_t bgraStride, uint8_t alpha)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        BgrToBgra(bgr + begin * bgrStride, width, end - begin, bgrStride, bgra + begin * bgraStride, bgraStride, alpha);
+    });
+}
+
+static void Bgr48pToBgra32(const uint8_t * blue, size_t blueStride, size_t width, size_t height,
     const uint8_t * green, size_t greenStride, const uint8_t * red, size_t redStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::Bgr48pToBgra32)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Bgr48pToBgra32)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::HA)
-        Avx2::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
-    else
+        .Add(Avx2::Enable, Avx2::Bgr48pToBgra32, Avx2::HA)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::HA)
-        Sse2::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
-    else
+        .Add(Sse2::Enable, Sse2::Bgr48pToBgra32, Sse2::HA)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::HA)
-        Vmx::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
-    else
+        .Add(Vmx::Enable, Vmx::Bgr48pToBgra32, Vmx::HA)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
-    else
+        .Add(Neon::Enable, Neon::Bgr48pToBgra32, Neon::A)
 #endif
-        Base::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
+        .Add(Base::Bgr48pToBgra32);
+    dispatch.Get(width)(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
 }
 
-SIMD_API void SimdBgrToGray(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *gray, size_t grayStride)
+SIMD_API void SimdBgr48pToBgra32(const uint8_t * blue, size_t blueStride, size_t width, size_t height,
+    const uint8_t * green, size_t greenStride, const uint8_t * red, size_t redStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        Bgr48pToBgra32(blue + begin * blueStride, blueStride, width, end - begin, green + begin * greenStride, greenStride, red + begin * redStride, redStride, bgra + begin * bgraStride, bgraStride, alpha);
+    });
+}
+
+static void BgrToGray(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *gray, size_t grayStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::BgrToGray)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BgrToGray)
 #endif
 #if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
+        .Add(Avx2::Enable, Avx2::BgrToGray, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::BgrToGray, Ssse3::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
+        .Add(Sse2::Enable, Sse2::BgrToGray, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
+        .Add(Vmx::Enable, Vmx::BgrToGray, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
+        .Add(Neon::Enable, Neon::BgrToGray, Neon::A)
 #endif
-        Base::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
+        .Add(Base::BgrToGray);
+    dispatch.Get(width)(bgr, width, height, bgrStride, gray, grayStride);
 }
 
-SIMD_API void SimdBgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride)
+SIMD_API void SimdBgrToGray(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *gray, size_t grayStride)
 {
-    Base::BgrToHsl(bgr, width, height, bgrStride, hsl, hslStride);
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        BgrToGray(bgr + begin * bgrStride, width, end - begin, bgrStride, gray + begin * grayStride, grayStride);
+    });
 }
 
-SIMD_API void SimdBgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
+static void BgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::BgrToHsl)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::BgrToHsl)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::BgrToHsl, Avx2::F)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::BgrToHsl, Sse41::F)
+#endif
+        .Add(Base::BgrToHsl);
+    dispatch.Get(width)(bgr, width, height, bgrStride, hsl, hslStride);
+}
+
+SIMD_API void SimdBgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride)
 {
-    Base::BgrToHsv(bgr, width, height, bgrStride, hsv, hsvStride);
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        BgrToHsl(bgr + begin * bgrStride, width, end - begin, bgrStride, hsl + begin * hslStride, hslStride);
+    });
 }
 
-SIMD_API void SimdBgrToRgb(const uint8_t *bgr, size_t bgrStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+static void BgrToHsl32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * hsl, size_t hslStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::BgrToHsl32f)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgrToRgb(bgr, bgrStride, width, height, rgb, rgbStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BgrToHsl32f)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::BgrToRgb(bgr, bgrStride, width, height, rgb, rgbStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::BgrToRgb(bgr, bgrStride, width, height, rgb, rgbStride);
-    else
+        .Add(Avx2::Enable, Avx2::BgrToHsl32f, Avx2::F)
 #endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgrToRgb(bgr, bgrStride, width, height, rgb, rgbStride);
-    else
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::BgrToHsl32f, Sse41::F)
 #endif
-        Base::BgrToRgb(bgr, bgrStride, width, height, rgb, rgbStride);
+        .Add(Base::BgrToHsl32f);
+    dispatch.Get(width)(bgr, width, height, bgrStride, hsl, hslStride);
 }
 
-SIMD_API void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+SIMD_API void SimdBgrToHsl32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * hsl, size_t hslStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        BgrToHsl32f(bgr + begin * bgrStride, width, end - begin, bgrStride, (float*)((uint8_t*)hsl + begin * hslStride), hslStride);
+    });
+}
+
+static void BgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::BgrToHsv)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BgrToHsv)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::DA)
-        Ssse3::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
+        .Add(Avx2::Enable, Avx2::BgrToHsv, Avx2::F)
 #endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::BgrToHsv, Sse41::F)
 #endif
-        Base::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        .Add(Base::BgrToHsv);
+    dispatch.Get(width)(bgr, width, height, bgrStride, hsv, hsvStride);
 }
 
-SIMD_API void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+SIMD_API void SimdBgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        BgrToHsv(bgr + begin * bgrStride, width, end - begin, bgrStride, hsv + begin * hsvStride, hsvStride);
+    });
+}
+
+static void BgrToHsv32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * hsv, size_t hsvStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::BgrToHsv32f)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BgrToHsv32f)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::DA)
-        Ssse3::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
+        .Add(Avx2::Enable, Avx2::BgrToHsv32f, Avx2::F)
 #endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::BgrToHsv32f, Sse41::F)
 #endif
-        Base::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        .Add(Base::BgrToHsv32f);
+    dispatch.Get(width)(bgr, width, height, bgrStride, hsv, hsvStride);
 }
 
-SIMD_API void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+SIMD_API void SimdBgrToHsv32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * hsv, size_t hsvStride)
 {
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        BgrToHsv32f(bgr + begin * bgrStride, width, end - begin, bgrStride, (float*)((uint8_t*)hsv + begin * hsvStride), hsvStride);
+    });
+}
+
+static void BgrToLab(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::BgrToLab)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::BgrToLab)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
+        .Add(Avx2::Enable, Avx2::BgrToLab, Avx2::F)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::BgrToLab, Sse41::F)
+#endif
+        .Add(Base::BgrToLab);
+    dispatch.Get(width)(bgr, width, height, bgrStride, lab, labStride);
+}
+
+SIMD_API void SimdBgrToLab(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        BgrToLab(bgr + begin * bgrStride, width, end - begin, bgrStride, lab + begin * labStride, labStride);
+    });
+}
+
+static void BgrToLab32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * lab, size_t labStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::BgrToLab32f)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::BgrToLab32f)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::BgrToLab32f, Avx2::F)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::BgrToLab32f, Sse41::F)
+#endif
+        .Add(Base::BgrToLab32f);
+    dispatch.Get(width)(bgr, width, height, bgrStride, lab, labStride);
+}
+
+SIMD_API void SimdBgrToLab32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * lab, size_t labStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        BgrToLab32f(bgr + begin * bgrStride, width, end - begin, bgrStride, (float*)((uint8_t*)lab + begin * labStride), labStride);
+    });
+}
+
+static void BgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::BgrToNv12)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::BgrToNv12, Avx512bw::DA)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::BgrToNv12, Avx2::DA)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::BgrToNv12, Sse41::DA)
+#endif
+        .Add(Base::BgrToNv12);
+    dispatch.Get(width)(bgr, width, height, bgrStride, y, yStride, uv, uvStride, yuvType);
+}
+
+SIMD_API void SimdBgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+{
+    ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+    {
+        BgrToNv12(bgr + begin * bgrStride, width, end - begin, bgrStride, y + begin * yStride, yStride, uv + begin / 2 * uvStride, uvStride, yuvType);
+    });
+}
+
+static void BgrToRgb(const uint8_t *bgr, size_t bgrStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::BgrToRgb)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::BgrToRgb)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::BgrToRgb, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::BgrToRgb, Ssse3::A)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::BgrToRgb, Neon::A)
+#endif
+        .Add(Base::BgrToRgb);
+    dispatch.Get(width)(bgr, bgrStride, width, height, rgb, rgbStride);
+}
+
+SIMD_API void SimdBgrToRgb(const uint8_t *bgr, size_t bgrStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        BgrToRgb(bgr + begin * bgrStride, bgrStride, width, end - begin, rgb + begin * rgbStride, rgbStride);
+    });
+}
+
+static void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::BgrToYuv420p)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::BgrToYuv420p)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::BgrToYuv420p, Avx2::DA)
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+        .Add(Ssse3::Enable, Ssse3::BgrToYuv420p, Ssse3::DA)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        .Add(Vmx::Enable, Vmx::BgrToYuv420p, Vmx::DA)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::BgrToYuv420p, Neon::DA)
+#endif
+        .Add(Base::BgrToYuv420p);
+    dispatch.Get(width)(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+}
+
+SIMD_API void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+    ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+    {
+        BgrToYuv420p(bgr + begin * bgrStride, width, end - begin, bgrStride, y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride);
+    });
+}
+
+static void BgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::BgrToYuv420pV2)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::BgrToYuv420pV2, Avx512bw::DA)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::BgrToYuv420pV2, Avx2::DA)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::BgrToYuv420pV2, Sse41::DA)
+#endif
+        .Add(Base::BgrToYuv420pV2);
+    dispatch.Get(width)(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+}
+
+SIMD_API void SimdBgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+    if (yuvType == SimdYuvBt601)
+        SimdBgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
     else
+    {
+        ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+        {
+            BgrToYuv420pV2(bgr + begin * bgrStride, width, end - begin, bgrStride, y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, yuvType);
+        });
+    }
+}
+
+static void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::BgrToYuv422p)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::BgrToYuv422p)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::BgrToYuv422p, Avx2::DA)
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+        .Add(Ssse3::Enable, Ssse3::BgrToYuv422p, Ssse3::DA)
+#endif
+#ifdef SIMD_VMX_ENABLE
+        .Add(Vmx::Enable, Vmx::BgrToYuv422p, Vmx::DA)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        .Add(Neon::Enable, Neon::BgrToYuv422p, Neon::DA)
+#endif
+        .Add(Base::BgrToYuv422p);
+    dispatch.Get(width)(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+}
+
+SIMD_API void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        BgrToYuv422p(bgr + begin * bgrStride, width, end - begin, bgrStride, y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride);
+    });
+}
+
+static void BgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::BgrToYuv422pV2)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::BgrToYuv422pV2, Avx512bw::DA)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::BgrToYuv422pV2, Avx2::DA)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::BgrToYuv422pV2, Sse41::DA)
+#endif
+        .Add(Base::BgrToYuv422pV2);
+    dispatch.Get(width)(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+}
+
+SIMD_API void SimdBgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+    if (yuvType == SimdYuvBt601)
+        SimdBgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
     else
+    {
+        ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+        {
+            BgrToYuv422pV2(bgr + begin * bgrStride, width, end - begin, bgrStride, y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, yuvType);
+        });
+    }
+}
+
+static void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::BgrToYuv444p)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::BgrToYuv444p)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::BgrToYuv444p, Avx2::A)
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+        .Add(Ssse3::Enable, Ssse3::BgrToYuv444p, Ssse3::A)
+#endif
+#ifdef SIMD_VMX_ENABLE
+        .Add(Vmx::Enable, Vmx::BgrToYuv444p, Vmx::A)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::BgrToYuv444p, Neon::A)
+#endif
+        .Add(Base::BgrToYuv444p);
+    dispatch.Get(width)(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+}
+
+SIMD_API void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        BgrToYuv444p(bgr + begin * bgrStride, width, end - begin, bgrStride, y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride);
+    });
+}
+
+static void BgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::BgrToYuv444pV2)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::BgrToYuv444pV2, Avx512bw::A)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::BgrToYuv444pV2, Avx2::A)
 #endif
-        Base::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::BgrToYuv444pV2, Sse41::A)
+#endif
+        .Add(Base::BgrToYuv444pV2);
+    dispatch.Get(width)(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+}
+
+SIMD_API void SimdBgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+    if (yuvType == SimdYuvBt601)
+        SimdBgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+    else
+    {
+        ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+        {
+            BgrToYuv444pV2(bgr + begin * bgrStride, width, end - begin, bgrStride, y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, yuvType);
+        });
+    }
 }
 
 SIMD_API void SimdBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                   uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::Binarization)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Binarization)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
-    else
+        .Add(Avx2::Enable, Avx2::Binarization, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
-    else
+        .Add(Sse2::Enable, Sse2::Binarization, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
-    else
+        .Add(Vmx::Enable, Vmx::Binarization, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
-    else
+        .Add(Neon::Enable, Neon::Binarization, Neon::A)
 #endif
-        Base::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
+        .Add(Base::Binarization);
+    dispatch.Get(width)(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
 }
 
 SIMD_API void SimdAveragingBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                            uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative,
                            uint8_t * dst, size_t dstStride, SimdCompareType compareType)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::AveragingBinarization)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::AveragingBinarization)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
-    else
+        .Add(Avx2::Enable, Avx2::AveragingBinarization, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
-    else
+        .Add(Sse2::Enable, Sse2::AveragingBinarization, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
-    else
+        .Add(Vmx::Enable, Vmx::AveragingBinarization, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
-    else
+        .Add(Neon::Enable, Neon::AveragingBinarization, Neon::A)
 #endif
-        Base::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
+        .Add(Base::AveragingBinarization);
+    dispatch.Get(width)(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
 }
 
 SIMD_API void SimdAveragingBinarizationV2(const uint8_t* src, size_t srcStride, size_t width, size_t height,
@@ -1439,189 +1788,165 @@ SIMD_API void SimdAveragingBinarizationV2(const uint8_t* src, size_t srcStride,
         Base::AveragingBinarizationV2(src, srcStride, width, height, neighborhood, shift, positive, negative, dst, dstStride);
 }
 
+SIMD_API void * SimdColorMatrixInit(const float * matrix, const uint8_t * gamma, SimdPixelFormatType format, SimdBool precise)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::ColorMatrixInit)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::ColorMatrixInit)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::ColorMatrixInit)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::ColorMatrixInit)
+#endif
+        .Add(Base::ColorMatrixInit);
+    return dispatch.Get()(matrix, gamma, format, precise);
+}
+
+SIMD_API void SimdColorMatrixRun(const void * colorMatrix, const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        ((ColorMatrix*)colorMatrix)->Run(src + begin * srcStride, srcStride, width, end - begin, dst + begin * dstStride, dstStride);
+    });
+}
+
 SIMD_API void SimdConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height,
                                    uint8_t value, SimdCompareType compareType, uint32_t * count)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::ConditionalCount8u)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ConditionalCount8u(src, stride, width, height, value, compareType, count);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::ConditionalCount8u)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::ConditionalCount8u(src, stride, width, height, value, compareType, count);
-    else
+        .Add(Avx2::Enable, Avx2::ConditionalCount8u, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::ConditionalCount8u(src, stride, width, height, value, compareType, count);
-    else
+        .Add(Sse2::Enable, Sse2::ConditionalCount8u, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::ConditionalCount8u(src, stride, width, height, value, compareType, count);
-    else
+        .Add(Vmx::Enable, Vmx::ConditionalCount8u, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::ConditionalCount8u(src, stride, width, height, value, compareType, count);
-    else
+        .Add(Neon::Enable, Neon::ConditionalCount8u, Neon::A)
 #endif
-        Base::ConditionalCount8u(src, stride, width, height, value, compareType, count);
+        .Add(Base::ConditionalCount8u);
+    dispatch.Get(width)(src, stride, width, height, value, compareType, count);
 }
 
 SIMD_API void SimdConditionalCount16i(const uint8_t * src, size_t stride, size_t width, size_t height,
                                      int16_t value, SimdCompareType compareType, uint32_t * count)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::ConditionalCount16i)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ConditionalCount16i(src, stride, width, height, value, compareType, count);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::ConditionalCount16i)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::HA)
-        Avx2::ConditionalCount16i(src, stride, width, height, value, compareType, count);
-    else
+        .Add(Avx2::Enable, Avx2::ConditionalCount16i, Avx2::HA)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::HA)
-        Sse2::ConditionalCount16i(src, stride, width, height, value, compareType, count);
-    else
+        .Add(Sse2::Enable, Sse2::ConditionalCount16i, Sse2::HA)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::HA)
-        Vmx::ConditionalCount16i(src, stride, width, height, value, compareType, count);
-    else
+        .Add(Vmx::Enable, Vmx::ConditionalCount16i, Vmx::HA)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::ConditionalCount16i(src, stride, width, height, value, compareType, count);
-    else
+        .Add(Neon::Enable, Neon::ConditionalCount16i, Neon::HA)
 #endif
-        Base::ConditionalCount16i(src, stride, width, height, value, compareType, count);
+        .Add(Base::ConditionalCount16i);
+    dispatch.Get(width)(src, stride, width, height, value, compareType, count);
 }
 
 SIMD_API void SimdConditionalSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                  const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::ConditionalSum)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::ConditionalSum)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
+        .Add(Avx2::Enable, Avx2::ConditionalSum, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
+        .Add(Sse2::Enable, Sse2::ConditionalSum, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
+        .Add(Vmx::Enable, Vmx::ConditionalSum, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
+        .Add(Neon::Enable, Neon::ConditionalSum, Neon::A)
 #endif
-        Base::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+        .Add(Base::ConditionalSum);
+    dispatch.Get(width)(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
 }
 
 SIMD_API void SimdConditionalSquareSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                        const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::ConditionalSquareSum)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::ConditionalSquareSum)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
+        .Add(Avx2::Enable, Avx2::ConditionalSquareSum, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
+        .Add(Sse2::Enable, Sse2::ConditionalSquareSum, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
+        .Add(Vmx::Enable, Vmx::ConditionalSquareSum, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
+        .Add(Neon::Enable, Neon::ConditionalSquareSum, Neon::A)
 #endif
-        Base::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+        .Add(Base::ConditionalSquareSum);
+    dispatch.Get(width)(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
 }
 
 SIMD_API void SimdConditionalSquareGradientSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                        const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::ConditionalSquareGradientSum)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::ConditionalSquareGradientSum)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
+        .Add(Avx2::Enable, Avx2::ConditionalSquareGradientSum, Avx2::A + 2)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 2)
-        Sse2::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
+        .Add(Sse2::Enable, Sse2::ConditionalSquareGradientSum, Sse2::A + 2)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A + 2)
-        Vmx::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
+        .Add(Vmx::Enable, Vmx::ConditionalSquareGradientSum, Vmx::A + 2)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
+        .Add(Neon::Enable, Neon::ConditionalSquareGradientSum, Neon::A + 2)
 #endif
-        Base::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+        .Add(Base::ConditionalSquareGradientSum);
+    dispatch.Get(width)(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
 }
 
 SIMD_API void SimdConditionalFill(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold, SimdCompareType compareType, uint8_t value, uint8_t * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::ConditionalFill)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::ConditionalFill)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::ConditionalFill, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::ConditionalFill, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if (Vmx::Enable && width >= Vmx::A)
-        Vmx::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::ConditionalFill, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::ConditionalFill, Neon::A)
 #endif
-        Base::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
+        .Add(Base::ConditionalFill);
+    dispatch.Get(width)(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
 }
 
 SIMD_API void SimdCopy(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, uint8_t * dst, size_t dstStride)
@@ -1635,87 +1960,94 @@ SIMD_API void SimdCopyFrame(const uint8_t * src, size_t srcStride, size_t width,
     Base::CopyFrame(src, srcStride, width, height, pixelSize, frameLeft, frameTop, frameRight, frameBottom, dst, dstStride);
 }
 
-SIMD_API void SimdDeinterleaveUv(const uint8_t * uv, size_t uvStride, size_t width, size_t height,
-                    uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+static void DeinterleaveUv(const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+              uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::DeinterleaveUv)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::DeinterleaveUv)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
-    else
+        .Add(Avx2::Enable, Avx2::DeinterleaveUv, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
-    else
+        .Add(Sse2::Enable, Sse2::DeinterleaveUv, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
-    else
+        .Add(Vmx::Enable, Vmx::DeinterleaveUv, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
-    else
+        .Add(Neon::Enable, Neon::DeinterleaveUv, Neon::A)
 #endif
-        Base::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
+        .Add(Base::DeinterleaveUv);
+    dispatch.Get(width)(uv, uvStride, width, height, u, uStride, v, vStride);
 }
 
-SIMD_API void SimdDeinterleaveBgr(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height,
+SIMD_API void SimdDeinterleaveUv(const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+                    uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        DeinterleaveUv(uv + begin * uvStride, uvStride, width, end - begin, u + begin * uStride, uStride, v + begin * vStride, vStride);
+    });
+}
+
+static void DeinterleaveBgr(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height,
     uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::DeinterleaveBgr)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::DeinterleaveBgr)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
-    else
+        .Add(Avx2::Enable, Avx2::DeinterleaveBgr, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::DeinterleaveBgr, Ssse3::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
-    else
+        .Add(Neon::Enable, Neon::DeinterleaveBgr, Neon::A)
 #endif
-        Base::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
+        .Add(Base::DeinterleaveBgr);
+    dispatch.Get(width)(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
 }
 
-SIMD_API void SimdDeinterleaveBgra(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height,
+SIMD_API void SimdDeinterleaveBgr(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height,
+    uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        DeinterleaveBgr(bgr + begin * bgrStride, bgrStride, width, end - begin, b + begin * bStride, bStride, g + begin * gStride, gStride, r + begin * rStride, rStride);
+    });
+}
+
+static void DeinterleaveBgra(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height,
     uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride, uint8_t * a, size_t aStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::DeinterleaveBgra)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::DeinterleaveBgra)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
-    else
+        .Add(Avx2::Enable, Avx2::DeinterleaveBgra, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::DeinterleaveBgra, Ssse3::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
-    else
+        .Add(Neon::Enable, Neon::DeinterleaveBgra, Neon::A)
 #endif
-        Base::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
+        .Add(Base::DeinterleaveBgra);
+    dispatch.Get(width)(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
+}
+
+SIMD_API void SimdDeinterleaveBgra(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height,
+    uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride, uint8_t * a, size_t aStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        DeinterleaveBgra(bgra + begin * bgraStride, bgraStride, width, end - begin, b + begin * bStride, bStride, g + begin * gStride, gStride, r + begin * rStride, rStride, a + begin * aStride, aStride);
+    });
 }
 
 SIMD_API void * SimdDetectionLoadStringXml(char * xml)
@@ -1748,317 +2080,241 @@ SIMD_API void SimdDetectionHaarDetect32fp(const void * hid, const uint8_t * mask
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
     size_t width = right - left;
+    static const auto dispatch = Dispatch<decltype(&Base::DetectionHaarDetect32fp)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::DetectionHaarDetect32fp)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::DetectionHaarDetect32fp, Avx2::A)
 #endif
 #ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Sse41::Enable, Sse41::DetectionHaarDetect32fp, Sse41::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::DetectionHaarDetect32fp, Neon::A)
 #endif
-        Base::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        .Add(Base::DetectionHaarDetect32fp);
+    dispatch.Get(width)(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
 SIMD_API void SimdDetectionHaarDetect32fi(const void * hid, const uint8_t * mask, size_t maskStride,
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
     size_t width = right - left;
+    static const auto dispatch = Dispatch<decltype(&Base::DetectionHaarDetect32fi)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::DetectionHaarDetect32fi)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::DetectionHaarDetect32fi, Avx2::A)
 #endif
 #ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Sse41::Enable, Sse41::DetectionHaarDetect32fi, Sse41::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::DetectionHaarDetect32fi, Neon::A)
 #endif
-        Base::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        .Add(Base::DetectionHaarDetect32fi);
+    dispatch.Get(width)(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
 SIMD_API void SimdDetectionLbpDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride,
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
     size_t width = right - left;
+    static const auto dispatch = Dispatch<decltype(&Base::DetectionLbpDetect32fp)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::DetectionLbpDetect32fp)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::DetectionLbpDetect32fp, Avx2::A)
 #endif
 #ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Sse41::Enable, Sse41::DetectionLbpDetect32fp, Sse41::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::DetectionLbpDetect32fp, Neon::A)
 #endif
-        Base::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        .Add(Base::DetectionLbpDetect32fp);
+    dispatch.Get(width)(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
 SIMD_API void SimdDetectionLbpDetect32fi(const void * hid, const uint8_t * mask, size_t maskStride,
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
     size_t width = right - left;
+    static const auto dispatch = Dispatch<decltype(&Base::DetectionLbpDetect32fi)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::DetectionLbpDetect32fi)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::DetectionLbpDetect32fi, Avx2::A)
 #endif
 #ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Sse41::Enable, Sse41::DetectionLbpDetect32fi, Sse41::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::DetectionLbpDetect32fi, Neon::A)
 #endif
-        Base::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        .Add(Base::DetectionLbpDetect32fi);
+    dispatch.Get(width)(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
 SIMD_API void SimdDetectionLbpDetect16ip(const void * hid, const uint8_t * mask, size_t maskStride,
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
     size_t width = right - left;
+    static const auto dispatch = Dispatch<decltype(&Base::DetectionLbpDetect16ip)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::DetectionLbpDetect16ip)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::DetectionLbpDetect16ip, Avx2::A)
 #endif
 #ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Sse41::Enable, Sse41::DetectionLbpDetect16ip, Sse41::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::DetectionLbpDetect16ip, Neon::A)
 #endif
-        Base::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        .Add(Base::DetectionLbpDetect16ip);
+    dispatch.Get(width)(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
 SIMD_API void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride,
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
     size_t width = right - left;
+    static const auto dispatch = Dispatch<decltype(&Base::DetectionLbpDetect16ii)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::DetectionLbpDetect16ii)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::DetectionLbpDetect16ii, Avx2::A)
 #endif
 #ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Sse41::Enable, Sse41::DetectionLbpDetect16ii, Sse41::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::DetectionLbpDetect16ii, Neon::A)
 #endif
-        Base::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        .Add(Base::DetectionLbpDetect16ii);
+    dispatch.Get(width)(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
 SIMD_API void SimdEdgeBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                  uint8_t * background, size_t backgroundStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::EdgeBackgroundGrowRangeSlow)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::EdgeBackgroundGrowRangeSlow)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
-    else
+        .Add(Avx2::Enable, Avx2::EdgeBackgroundGrowRangeSlow, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
-    else
+        .Add(Sse2::Enable, Sse2::EdgeBackgroundGrowRangeSlow, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
-    else
+        .Add(Vmx::Enable, Vmx::EdgeBackgroundGrowRangeSlow, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
-    else
+        .Add(Neon::Enable, Neon::EdgeBackgroundGrowRangeSlow, Neon::A)
 #endif
-        Base::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
+        .Add(Base::EdgeBackgroundGrowRangeSlow);
+    dispatch.Get(width)(value, valueStride, width, height, background, backgroundStride);
 }
 
 SIMD_API void SimdEdgeBackgroundGrowRangeFast(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                  uint8_t * background, size_t backgroundStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::EdgeBackgroundGrowRangeFast)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::EdgeBackgroundGrowRangeFast)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
-    else
+        .Add(Avx2::Enable, Avx2::EdgeBackgroundGrowRangeFast, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
-    else
+        .Add(Sse2::Enable, Sse2::EdgeBackgroundGrowRangeFast, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
-    else
+        .Add(Vmx::Enable, Vmx::EdgeBackgroundGrowRangeFast, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
-    else
+        .Add(Neon::Enable, Neon::EdgeBackgroundGrowRangeFast, Neon::A)
 #endif
-        Base::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
+        .Add(Base::EdgeBackgroundGrowRangeFast);
+    dispatch.Get(width)(value, valueStride, width, height, background, backgroundStride);
 }
 
 SIMD_API void SimdEdgeBackgroundIncrementCount(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                   const uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t * backgroundCount, size_t backgroundCountStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::EdgeBackgroundIncrementCount)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::EdgeBackgroundIncrementCount)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
-    else
+        .Add(Avx2::Enable, Avx2::EdgeBackgroundIncrementCount, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
-    else
+        .Add(Sse2::Enable, Sse2::EdgeBackgroundIncrementCount, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
-    else
+        .Add(Vmx::Enable, Vmx::EdgeBackgroundIncrementCount, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
-    else
+        .Add(Neon::Enable, Neon::EdgeBackgroundIncrementCount, Neon::A)
 #endif
-        Base::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
+        .Add(Base::EdgeBackgroundIncrementCount);
+    dispatch.Get(width)(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
 }
 
 SIMD_API void SimdEdgeBackgroundAdjustRange(uint8_t * backgroundCount, size_t backgroundCountStride, size_t width, size_t height,
                                uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t threshold)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::EdgeBackgroundAdjustRange)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::EdgeBackgroundAdjustRange)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
-    else
+        .Add(Avx2::Enable, Avx2::EdgeBackgroundAdjustRange, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
-    else
+        .Add(Sse2::Enable, Sse2::EdgeBackgroundAdjustRange, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
-    else
+        .Add(Vmx::Enable, Vmx::EdgeBackgroundAdjustRange, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
-    else
+        .Add(Neon::Enable, Neon::EdgeBackgroundAdjustRange, Neon::A)
 #endif
-        Base::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
+        .Add(Base::EdgeBackgroundAdjustRange);
+    dispatch.Get(width)(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
 }
 
 SIMD_API void SimdEdgeBackgroundAdjustRangeMasked(uint8_t * backgroundCount, size_t backgroundCountStride, size_t width, size_t height,
                                uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t threshold, const uint8_t * mask, size_t maskStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::EdgeBackgroundAdjustRangeMasked)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::EdgeBackgroundAdjustRangeMasked)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
-    else
+        .Add(Avx2::Enable, Avx2::EdgeBackgroundAdjustRangeMasked, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
-    else
+        .Add(Sse2::Enable, Sse2::EdgeBackgroundAdjustRangeMasked, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
-    else
+        .Add(Vmx::Enable, Vmx::EdgeBackgroundAdjustRangeMasked, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
-    else
+        .Add(Neon::Enable, Neon::EdgeBackgroundAdjustRangeMasked, Neon::A)
 #endif
-        Base::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
+        .Add(Base::EdgeBackgroundAdjustRangeMasked);
+    dispatch.Get(width)(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
 }
 
 SIMD_API void SimdEdgeBackgroundShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height,
@@ -2070,32 +2326,24 @@ SIMD_API void SimdEdgeBackgroundShiftRange(const uint8_t * value, size_t valueSt
 SIMD_API void SimdEdgeBackgroundShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                               uint8_t * background, size_t backgroundStride, const uint8_t * mask, size_t maskStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::EdgeBackgroundShiftRangeMasked)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::EdgeBackgroundShiftRangeMasked)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
-    else
+        .Add(Avx2::Enable, Avx2::EdgeBackgroundShiftRangeMasked, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
-    else
+        .Add(Sse2::Enable, Sse2::EdgeBackgroundShiftRangeMasked, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
-    else
+        .Add(Vmx::Enable, Vmx::EdgeBackgroundShiftRangeMasked, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
-    else
+        .Add(Neon::Enable, Neon::EdgeBackgroundShiftRangeMasked, Neon::A)
 #endif
-        Base::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
+        .Add(Base::EdgeBackgroundShiftRangeMasked);
+    dispatch.Get(width)(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
 }
 
 SIMD_API void SimdFill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value)
@@ -2111,297 +2359,298 @@ SIMD_API void SimdFillFrame(uint8_t * dst, size_t stride, size_t width, size_t h
 
 SIMD_API void SimdFillBgr(uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::FillBgr)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::FillBgr(dst, stride, width, height, blue, green, red);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::FillBgr)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::FillBgr(dst, stride, width, height, blue, green, red);
-    else
+        .Add(Avx2::Enable, Avx2::FillBgr, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::FillBgr(dst, stride, width, height, blue, green, red);
-    else
+        .Add(Sse2::Enable, Sse2::FillBgr, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::FillBgr(dst, stride, width, height, blue, green, red);
-    else
+        .Add(Vmx::Enable, Vmx::FillBgr, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::FillBgr(dst, stride, width, height, blue, green, red);
-    else
+        .Add(Neon::Enable, Neon::FillBgr, Neon::A)
 #endif
-        Base::FillBgr(dst, stride, width, height, blue, green, red);
+        .Add(Base::FillBgr);
+    dispatch.Get(width)(dst, stride, width, height, blue, green, red);
 }
 
 SIMD_API void SimdFillBgra(uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red, uint8_t alpha)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::FillBgra)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::FillBgra(dst, stride, width, height, blue, green, red, alpha);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::FillBgra)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::F)
-        Avx2::FillBgra(dst, stride, width, height, blue, green, red, alpha);
-    else
+        .Add(Avx2::Enable, Avx2::FillBgra, Avx2::F)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::F)
-        Sse2::FillBgra(dst, stride, width, height, blue, green, red, alpha);
-    else
+        .Add(Sse2::Enable, Sse2::FillBgra, Sse2::F)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::F)
-        Vmx::FillBgra(dst, stride, width, height, blue, green, red, alpha);
-    else
+        .Add(Vmx::Enable, Vmx::FillBgra, Vmx::F)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::FillBgra(dst, stride, width, height, blue, green, red, alpha);
-    else
+        .Add(Neon::Enable, Neon::FillBgra, Neon::F)
 #endif
-        Base::FillBgra(dst, stride, width, height, blue, green, red, alpha);
+        .Add(Base::FillBgra);
+    dispatch.Get(width)(dst, stride, width, height, blue, green, red, alpha);
 }
 
 SIMD_API void SimdFillPixel(uint8_t * dst, size_t stride, size_t width, size_t height, const uint8_t * pixel, size_t pixelSize)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::FillPixel)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::FillPixel(dst, stride, width, height, pixel, pixelSize);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::FillPixel)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::FillPixel(dst, stride, width, height, pixel, pixelSize);
-    else
+        .Add(Avx2::Enable, Avx2::FillPixel, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::FillPixel(dst, stride, width, height, pixel, pixelSize);
-    else
+        .Add(Sse2::Enable, Sse2::FillPixel, Sse2::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::FillPixel(dst, stride, width, height, pixel, pixelSize);
-    else
+        .Add(Neon::Enable, Neon::FillPixel, Neon::A)
 #endif
-        Base::FillPixel(dst, stride, width, height, pixel, pixelSize);
+        .Add(Base::FillPixel);
+    dispatch.Get(width)(dst, stride, width, height, pixel, pixelSize);
 }
 
 SIMD_API void SimdFill32f(float * dst, size_t size, const float * value)
 {
     typedef void(*SimdFill32fPtr) (float * dst, size_t size, const float * value);
-    const static SimdFill32fPtr simdFill32f = SIMD_FUNC4(Fill32f, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdFill32f(dst, size, value);
+    static const auto dispatch = Dispatch<SimdFill32fPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::Fill32f)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::Fill32f)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::Fill32f)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::Fill32f)
+#endif
+        .Add(Base::Fill32f);
+    dispatch.Get()(dst, size, value);
 }
 
 SIMD_API void SimdFloat32ToFloat16(const float * src, size_t size, uint16_t * dst)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::Float32ToFloat16)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Float32ToFloat16(src, size, dst);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Float32ToFloat16)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::F)
-        Avx2::Float32ToFloat16(src, size, dst);
-    else
+        .Add(Avx2::Enable, Avx2::Float32ToFloat16, Avx2::F)
 #endif
 #if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
-    if (Neon::Enable && size >= Neon::F)
-        Neon::Float32ToFloat16(src, size, dst);
-    else
+        .Add(Neon::Enable, Neon::Float32ToFloat16, Neon::F)
 #endif
-        Base::Float32ToFloat16(src, size, dst);
+        .Add(Base::Float32ToFloat16);
+    dispatch.Get(size)(src, size, dst);
 }
 
 SIMD_API void SimdFloat16ToFloat32(const uint16_t * src, size_t size, float * dst)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::Float16ToFloat32)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Float16ToFloat32(src, size, dst);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Float16ToFloat32)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::F)
-        Avx2::Float16ToFloat32(src, size, dst);
-    else
+        .Add(Avx2::Enable, Avx2::Float16ToFloat32, Avx2::F)
 #endif
 #if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
-    if (Neon::Enable && size >= Neon::F)
-        Neon::Float16ToFloat32(src, size, dst);
-    else
+        .Add(Neon::Enable, Neon::Float16ToFloat32, Neon::F)
 #endif
-        Base::Float16ToFloat32(src, size, dst);
+        .Add(Base::Float16ToFloat32);
+    dispatch.Get(size)(src, size, dst);
 }
 
 SIMD_API void SimdSquaredDifferenceSum16f(const uint16_t * a, const uint16_t * b, size_t size, float * sum)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::SquaredDifferenceSum16f)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::SquaredDifferenceSum16f(a, b, size, sum);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::SquaredDifferenceSum16f)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::F)
-        Avx2::SquaredDifferenceSum16f(a, b, size, sum);
-    else
+        .Add(Avx2::Enable, Avx2::SquaredDifferenceSum16f, Avx2::F)
 #endif
 #if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
-    if (Neon::Enable && size >= Neon::F)
-        Neon::SquaredDifferenceSum16f(a, b, size, sum);
-    else
+        .Add(Neon::Enable, Neon::SquaredDifferenceSum16f, Neon::F)
 #endif
-        Base::SquaredDifferenceSum16f(a, b, size, sum);
+        .Add(Base::SquaredDifferenceSum16f);
+    dispatch.Get(size)(a, b, size, sum);
 }
 
 SIMD_API void SimdCosineDistance16f(const uint16_t * a, const uint16_t * b, size_t size, float * distance)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::CosineDistance16f)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::CosineDistance16f(a, b, size, distance);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::CosineDistance16f)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::F)
-        Avx2::CosineDistance16f(a, b, size, distance);
-    else
+        .Add(Avx2::Enable, Avx2::CosineDistance16f, Avx2::F)
 #endif
 #if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
-    if (Neon::Enable && size >= Neon::F)
-        Neon::CosineDistance16f(a, b, size, distance);
-    else
+        .Add(Neon::Enable, Neon::CosineDistance16f, Neon::F)
 #endif
-        Base::CosineDistance16f(a, b, size, distance);
+        .Add(Base::CosineDistance16f);
+    dispatch.Get(size)(a, b, size, distance);
 }
 
 SIMD_API void SimdCosineDistancesMxNa16f(size_t M, size_t N, size_t K, const uint16_t * const * A, const uint16_t * const * B, float * distances)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::CosineDistancesMxNa16f)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && K >= Avx512bw::F)
-        Avx512bw::CosineDistancesMxNa16f(M, N, K, A, B, distances);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::CosineDistancesMxNa16f, Avx512bw::F)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && K >= Avx2::F)
-        Avx2::CosineDistancesMxNa16f(M, N, K, A, B, distances);
-    else
+        .Add(Avx2::Enable, Avx2::CosineDistancesMxNa16f, Avx2::F)
 #endif
 #if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
-    if (Neon::Enable && K >= Neon::F)
-        Neon::CosineDistancesMxNa16f(M, N, K, A, B, distances);
-    else
+        .Add(Neon::Enable, Neon::CosineDistancesMxNa16f, Neon::F)
 #endif
-        Base::CosineDistancesMxNa16f(M, N, K, A, B, distances);
+        .Add(Base::CosineDistancesMxNa16f);
+    dispatch.Get(K)(M, N, K, A, B, distances);
 }
 
 SIMD_API void SimdFloat32ToUint8(const float * src, size_t size, const float * lower, const float * upper, uint8_t * dst)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::Float32ToUint8)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Float32ToUint8(src, size, lower, upper, dst);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Float32ToUint8)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::A)
-        Avx2::Float32ToUint8(src, size, lower, upper, dst);
-    else
+        .Add(Avx2::Enable, Avx2::Float32ToUint8, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && size >= Sse2::A)
-        Sse2::Float32ToUint8(src, size, lower, upper, dst);
-    else
+        .Add(Sse2::Enable, Sse2::Float32ToUint8, Sse2::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && size >= Neon::A)
-        Neon::Float32ToUint8(src, size, lower, upper, dst);
-    else
+        .Add(Neon::Enable, Neon::Float32ToUint8, Neon::A)
 #endif
-        Base::Float32ToUint8(src, size, lower, upper, dst);
+        .Add(Base::Float32ToUint8);
+    dispatch.Get(size)(src, size, lower, upper, dst);
 }
 
 SIMD_API void SimdUint8ToFloat32(const uint8_t * src, size_t size, const float * lower, const float * upper, float * dst)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::Uint8ToFloat32)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Uint8ToFloat32(src, size, lower, upper, dst);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Uint8ToFloat32)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::HA)
-        Avx2::Uint8ToFloat32(src, size, lower, upper, dst);
-    else
+        .Add(Avx2::Enable, Avx2::Uint8ToFloat32, Avx2::HA)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && size >= Sse2::A)
-        Sse2::Uint8ToFloat32(src, size, lower, upper, dst);
-    else
+        .Add(Sse2::Enable, Sse2::Uint8ToFloat32, Sse2::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && size >= Neon::A)
-        Neon::Uint8ToFloat32(src, size, lower, upper, dst);
-    else
+        .Add(Neon::Enable, Neon::Uint8ToFloat32, Neon::A)
+#endif
+        .Add(Base::Uint8ToFloat32);
+    dispatch.Get(size)(src, size, lower, upper, dst);
+}
+
+SIMD_API void SimdUint16ToFloat32(const uint16_t * src, size_t size, int bits, const float * lower, const float * upper, float * dst)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Uint16ToFloat32)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::Uint16ToFloat32)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::Uint16ToFloat32, Avx2::HA)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::Uint16ToFloat32, Sse2::HA)
 #endif
-        Base::Uint8ToFloat32(src, size, lower, upper, dst);
+        .Add(Base::Uint16ToFloat32);
+    dispatch.Get(size)(src, size, bits, lower, upper, dst);
 }
 
 SIMD_API void SimdCosineDistance32f(const float * a, const float * b, size_t size, float * distance)
 {
     typedef void(*SimdCosineDistance32fPtr) (const float * a, const float * b, size_t size, float * distance);
-    const static SimdCosineDistance32fPtr simdCosineDistance32f = SIMD_FUNC5(CosineDistance32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdCosineDistance32f(a, b, size, distance);
+    static const auto dispatch = Dispatch<SimdCosineDistance32fPtr>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::CosineDistance32f)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::CosineDistance32f)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::CosineDistance32f)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::CosineDistance32f)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::CosineDistance32f)
+#endif
+        .Add(Base::CosineDistance32f);
+    dispatch.Get()(a, b, size, distance);
 }
 
-SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-                     size_t channelCount, uint8_t * dst, size_t dstStride)
+static void GaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+               size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    typedef void(*SimdGaussianBlur3x3Ptr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
+    static const auto dispatch = Dispatch<SimdGaussianBlur3x3Ptr>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
-        Avx512bw::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::GaussianBlur3x3, Avx512bw::A)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
-        Avx2::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::GaussianBlur3x3, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && (width - 1)*channelCount >= Ssse3::A)
-        Ssse3::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::GaussianBlur3x3, Ssse3::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
-        Sse2::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::GaussianBlur3x3, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
-        Vmx::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::GaussianBlur3x3, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
-        Neon::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::GaussianBlur3x3, Neon::A)
 #endif
-        Base::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+        .Add(Base::GaussianBlur3x3);
+    dispatch.Get((width - 1)*channelCount)(src, srcStride, width, height, channelCount, dst, dstStride);
+}
+
+SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                     size_t channelCount, uint8_t * dst, size_t dstStride)
+{
+    ParallelRows(width, height, 1, dst, dstStride, width * channelCount, [=](size_t begin, size_t end, uint8_t * dst)
+    {
+        GaussianBlur3x3(src + begin * srcStride, srcStride, width, end - begin, channelCount, dst, dstStride);
+    });
 }
 
 SIMD_API void* SimdGaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon)
 {
     typedef void* (*SimdGaussianBlurInitPtr) (size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
-    const static SimdGaussianBlurInitPtr simdGaussianBlurInit = SIMD_FUNC4(GaussianBlurInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
-
-    return simdGaussianBlurInit(width, height, channels, sigma, epsilon);
+    static const auto dispatch = Dispatch<SimdGaussianBlurInitPtr>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::GaussianBlurInit)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::GaussianBlurInit)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::GaussianBlurInit)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::GaussianBlurInit)
+#endif
+        .Add(Base::GaussianBlurInit);
+    return dispatch.Get()(width, height, channels, sigma, epsilon);
 }
 
 SIMD_API void SimdGaussianBlurRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
@@ -2413,76 +2662,106 @@ typedef void(*SimdGemm32fPtr) (size_t M, size_t N, size_t K, const float * alpha
 
 SIMD_API void SimdGemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
 {
-    const static SimdGemm32fPtr simdGemm32fNN = SIMD_FUNC5(Gemm32fNN, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdGemm32fNN(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+    static const auto dispatch = Dispatch<SimdGemm32fPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::Gemm32fNN)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::Gemm32fNN)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::Gemm32fNN)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::Gemm32fNN)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::Gemm32fNN)
+#endif
+        .Add(Base::Gemm32fNN);
+    dispatch.Get()(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
 SIMD_API void SimdGemm32fNT(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
 {
-    const static SimdGemm32fPtr simdGemm32fNT = SIMD_FUNC5(Gemm32fNT, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE3_FUNC, SIMD_NEON_FUNC);
-
-    simdGemm32fNT(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+    static const auto dispatch = Dispatch<SimdGemm32fPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::Gemm32fNT)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::Gemm32fNT)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::Gemm32fNT)
+#endif
+#ifdef SIMD_SSE3_ENABLE
+        .Add(Sse3::Enable, Sse3::Gemm32fNT)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::Gemm32fNT)
+#endif
+        .Add(Base::Gemm32fNT);
+    dispatch.Get()(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
-SIMD_API void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride)
+static void GrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::GrayToBgr)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::GrayToBgr)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
-    else
+        .Add(Avx2::Enable, Avx2::GrayToBgr, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::GrayToBgr, Ssse3::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
-    else
+        .Add(Vmx::Enable, Vmx::GrayToBgr, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
-    else
+        .Add(Neon::Enable, Neon::GrayToBgr, Neon::A)
 #endif
-        Base::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
+        .Add(Base::GrayToBgr);
+    dispatch.Get(width)(gray, width, height, grayStride, bgr, bgrStride);
 }
 
-SIMD_API void SimdGrayToBgra(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+SIMD_API void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        GrayToBgr(gray + begin * grayStride, width, end - begin, grayStride, bgr + begin * bgrStride, bgrStride);
+    });
+}
+
+static void GrayToBgra(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::GrayToBgra)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::GrayToBgra)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
-    else
+        .Add(Avx2::Enable, Avx2::GrayToBgra, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
-    else
+        .Add(Sse2::Enable, Sse2::GrayToBgra, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
-    else
+        .Add(Vmx::Enable, Vmx::GrayToBgra, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
-    else
+        .Add(Neon::Enable, Neon::GrayToBgra, Neon::A)
 #endif
-        Base::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
+        .Add(Base::GrayToBgra);
+    dispatch.Get(width)(gray, width, height, grayStride, bgra, bgraStride, alpha);
+}
+
+SIMD_API void SimdGrayToBgra(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        GrayToBgra(gray + begin * grayStride, width, end - begin, grayStride, bgra + begin * bgraStride, bgraStride, alpha);
+    });
 }
 
 SIMD_API void SimdAbsSecondDerivativeHistogram(const uint8_t *src, size_t width, size_t height, size_t stride, size_t step, size_t indent, uint32_t * histogram)
@@ -2523,58 +2802,44 @@ SIMD_API void SimdHistogram(const uint8_t *src, size_t width, size_t height, siz
 SIMD_API void SimdHistogramMasked(const uint8_t *src, size_t srcStride, size_t width, size_t height, 
                                   const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * histogram)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::HistogramMasked)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::HistogramMasked)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
-    else
+        .Add(Avx2::Enable, Avx2::HistogramMasked, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
-    else
+        .Add(Sse2::Enable, Sse2::HistogramMasked, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
-    else
+        .Add(Vmx::Enable, Vmx::HistogramMasked, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
-    else
+        .Add(Neon::Enable, Neon::HistogramMasked, Neon::A)
 #endif
-        Base::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
+        .Add(Base::HistogramMasked);
+    dispatch.Get(width)(src, srcStride, width, height, mask, maskStride, index, histogram);
 }
 
 SIMD_API void SimdHistogramConditional(const uint8_t * src, size_t srcStride, size_t width, size_t height,
     const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint32_t * histogram)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::HistogramConditional)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::HistogramConditional)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
-    else
+        .Add(Avx2::Enable, Avx2::HistogramConditional, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
-    else
+        .Add(Sse2::Enable, Sse2::HistogramConditional, Sse2::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
-    else
+        .Add(Neon::Enable, Neon::HistogramConditional, Neon::A)
 #endif
-        Base::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
+        .Add(Base::HistogramConditional);
+    dispatch.Get(width)(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
 }
 
 SIMD_API void SimdNormalizedColors(const uint32_t * histogram, uint8_t * colors)
@@ -2584,83 +2849,67 @@ SIMD_API void SimdNormalizedColors(const uint32_t * histogram, uint8_t * colors)
 
 SIMD_API void SimdChangeColors(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * colors, uint8_t * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::ChangeColors)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::HA)
-        Avx512bw::ChangeColors(src, srcStride, width, height, colors, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::ChangeColors, Avx512bw::HA)
 #endif
-        Base::ChangeColors(src, srcStride, width, height, colors, dst, dstStride);
+        .Add(Base::ChangeColors);
+    dispatch.Get(width)(src, srcStride, width, height, colors, dst, dstStride);
 }
 
 SIMD_API void SimdNormalizeHistogram(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::NormalizeHistogram)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::HA)
-        Avx512bw::NormalizeHistogram(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::NormalizeHistogram, Avx512bw::HA)
 #endif
-        Base::NormalizeHistogram(src, srcStride, width, height, dst, dstStride);
+        .Add(Base::NormalizeHistogram);
+    dispatch.Get(width)(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdHogDirectionHistograms(const uint8_t * src, size_t stride, size_t width, size_t height, 
                                          size_t cellX, size_t cellY, size_t quantization, float * histograms)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::HogDirectionHistograms)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::HA + 2)
-        Avx512bw::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::HogDirectionHistograms, Avx512bw::HA + 2)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
-    else
+        .Add(Avx2::Enable, Avx2::HogDirectionHistograms, Avx2::A + 2)
 #endif
 #ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A + 2)
-        Sse41::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
-    else
+        .Add(Sse41::Enable, Sse41::HogDirectionHistograms, Sse41::A + 2)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 2)
-        Sse2::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
-    else
+        .Add(Sse2::Enable, Sse2::HogDirectionHistograms, Sse2::A + 2)
 #endif
 #ifdef SIMD_VSX_ENABLE
-    if(Vsx::Enable && width >= Vsx::A + 2)
-        Vsx::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
-    else
+        .Add(Vsx::Enable, Vsx::HogDirectionHistograms, Vsx::A + 2)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
-    else
+        .Add(Neon::Enable, Neon::HogDirectionHistograms, Neon::A + 2)
 #endif
-        Base::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
+        .Add(Base::HogDirectionHistograms);
+    dispatch.Get(width)(src, stride, width, height, cellX, cellY, quantization, histograms);
 }
 
 SIMD_API void SimdHogExtractFeatures(const uint8_t * src, size_t stride, size_t width, size_t height, float * features)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::HogExtractFeatures)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::HA + 2)
-        Avx512bw::HogExtractFeatures(src, stride, width, height, features);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::HogExtractFeatures, Avx512bw::HA + 2)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::HA + 2)
-        Avx2::HogExtractFeatures(src, stride, width, height, features);
-    else
+        .Add(Avx2::Enable, Avx2::HogExtractFeatures, Avx2::HA + 2)
 #endif
 #ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A + 2)
-        Sse41::HogExtractFeatures(src, stride, width, height, features);
-    else
+        .Add(Sse41::Enable, Sse41::HogExtractFeatures, Sse41::A + 2)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::HogExtractFeatures(src, stride, width, height, features);
-    else
+        .Add(Neon::Enable, Neon::HogExtractFeatures, Neon::A + 2)
 #endif
-        Base::HogExtractFeatures(src, stride, width, height, features);
+        .Add(Base::HogExtractFeatures);
+    dispatch.Get(width)(src, stride, width, height, features);
 }
 
 SIMD_API void SimdHogDeinterleave(const float * src, size_t srcStride, size_t width, size_t height, size_t count, float ** dst, size_t dstStride)
@@ -2716,120 +2965,87 @@ SIMD_API void SimdHogFilterSeparable(const float * src, size_t srcStride, size_t
 
 SIMD_API void SimdHogLiteExtractFeatures(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t cell, float * features, size_t featuresStride)
 {
-#if defined(SIMD_AVX2_ENABLE) || defined(SIMD_SSE41_ENABLE) || defined(SIMD_NEON_ENABLE)
-    size_t size = (width / cell - 1)*cell;
-#endif
+    static const auto dispatch = Dispatch<decltype(&Base::HogLiteExtractFeatures)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::HogLiteExtractFeatures(src, srcStride, width, height, cell, features, featuresStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::HogLiteExtractFeatures)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::A)
-        Avx2::HogLiteExtractFeatures(src, srcStride, width, height, cell, features, featuresStride);
-    else
+        .Add(Avx2::Enable, Avx2::HogLiteExtractFeatures, Avx2::A)
 #endif
 #ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && size >= Sse41::A)
-        Sse41::HogLiteExtractFeatures(src, srcStride, width, height, cell, features, featuresStride);
-    else
+        .Add(Sse41::Enable, Sse41::HogLiteExtractFeatures, Sse41::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && size >= Neon::A)
-        Neon::HogLiteExtractFeatures(src, srcStride, width, height, cell, features, featuresStride);
-    else
+        .Add(Neon::Enable, Neon::HogLiteExtractFeatures, Neon::A)
 #endif
-        Base::HogLiteExtractFeatures(src, srcStride, width, height, cell, features, featuresStride);
+        .Add(Base::HogLiteExtractFeatures);
+    dispatch.Get((width / cell - 1)*cell)(src, srcStride, width, height, cell, features, featuresStride);
 }
 
 SIMD_API void SimdHogLiteFilterFeatures(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, const float * filter, size_t filterWidth, size_t filterHeight, const uint32_t * mask, size_t maskStride, float * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::HogLiteFilterFeatures)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::HogLiteFilterFeatures)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable)
-        Avx2::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::HogLiteFilterFeatures)
 #endif
 #ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable)
-        Avx::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
-    else
+        .Add(Avx::Enable, Avx::HogLiteFilterFeatures)
 #endif
 #ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable)
-        Sse41::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
-    else
+        .Add(Sse41::Enable, Sse41::HogLiteFilterFeatures)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable)
-        Neon::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::HogLiteFilterFeatures)
 #endif
-        Base::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
+        .Add(Base::HogLiteFilterFeatures);
+    dispatch.Get()(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
 }
 
 SIMD_API void SimdHogLiteResizeFeatures(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, float * dst, size_t dstStride, size_t dstWidth, size_t dstHeight)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::HogLiteResizeFeatures)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::HogLiteResizeFeatures)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable)
-        Avx2::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
-    else
+        .Add(Avx2::Enable, Avx2::HogLiteResizeFeatures)
 #endif
 #ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable)
-        Avx::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
-    else
+        .Add(Avx::Enable, Avx::HogLiteResizeFeatures)
 #endif
 #ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable)
-        Sse41::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
-    else
+        .Add(Sse41::Enable, Sse41::HogLiteResizeFeatures)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable)
-        Neon::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
-    else
+        .Add(Neon::Enable, Neon::HogLiteResizeFeatures)
 #endif
-        Base::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
+        .Add(Base::HogLiteResizeFeatures);
+    dispatch.Get()(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
 }
 
 SIMD_API void SimdHogLiteCompressFeatures(const float * src, size_t srcStride, size_t width, size_t height, const float * pca, float * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::HogLiteCompressFeatures)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::HogLiteCompressFeatures)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable)
-        Avx2::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::HogLiteCompressFeatures)
 #endif
 #ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable)
-        Avx::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
-    else
+        .Add(Avx::Enable, Avx::HogLiteCompressFeatures)
 #endif
 #ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable)
-        Sse41::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
-    else
+        .Add(Sse41::Enable, Sse41::HogLiteCompressFeatures)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable)
-        Neon::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::HogLiteCompressFeatures)
 #endif
-        Base::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
+        .Add(Base::HogLiteCompressFeatures);
+    dispatch.Get()(src, srcStride, width, height, pca, dst, dstStride);
 }
 
 SIMD_API void SimdHogLiteFilterSeparable(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, const float * hFilter, size_t hSize, const float * vFilter, size_t vSize, float * dst, size_t dstStride, int add)
@@ -2865,1044 +3081,1264 @@ SIMD_API void SimdHogLiteFilterSeparable(const float * src, size_t srcStride, si
 SIMD_API void SimdHogLiteFindMax7x7(const float * a, size_t aStride, const float * b, size_t bStride, size_t height, float * value, size_t * col, size_t * row)
 {
     typedef void(*SimdHogLiteFindMax7x7Ptr) (const float * a, size_t aStride, const float * b, size_t bStride, size_t height, float * value, size_t * col, size_t * row);
-    const static SimdHogLiteFindMax7x7Ptr simdHogLiteFindMax7x7 = SIMD_FUNC3(HogLiteFindMax7x7, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
-
-    simdHogLiteFindMax7x7(a, aStride, b, bStride, height, value, col, row);
+    static const auto dispatch = Dispatch<SimdHogLiteFindMax7x7Ptr>()
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::HogLiteFindMax7x7)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::HogLiteFindMax7x7)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::HogLiteFindMax7x7)
+#endif
+        .Add(Base::HogLiteFindMax7x7);
+    dispatch.Get()(a, aStride, b, bStride, height, value, col, row);
 }
 
 SIMD_API void SimdHogLiteCreateMask(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const float * threshold, size_t scale, size_t size, uint32_t * dst, size_t dstStride)
 {
     typedef void(*SimdHogLiteCreateMaskPtr) (const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const float * threshold, size_t scale, size_t size, uint32_t * dst, size_t dstStride);
-    const static SimdHogLiteCreateMaskPtr simdHogLiteCreateMask = SIMD_FUNC4(HogLiteCreateMask, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    static const auto dispatch = Dispatch<SimdHogLiteCreateMaskPtr>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::HogLiteCreateMask)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::HogLiteCreateMask)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::HogLiteCreateMask)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::HogLiteCreateMask)
+#endif
+        .Add(Base::HogLiteCreateMask);
+    dispatch.Get()(src, srcStride, srcWidth, srcHeight, threshold, scale, size, dst, dstStride);
+}
 
-    simdHogLiteCreateMask(src, srcStride, srcWidth, srcHeight, threshold, scale, size, dst, dstStride);
+static void HslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::HslToBgr)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::HslToBgr)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::HslToBgr, Avx2::F)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::HslToBgr, Sse41::F)
+#endif
+        .Add(Base::HslToBgr);
+    dispatch.Get(width)(hsl, width, height, hslStride, bgr, bgrStride);
 }
 
-SIMD_API void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdHslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride)
 {
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        HslToBgr(hsl + begin * hslStride, width, end - begin, hslStride, bgr + begin * bgrStride, bgrStride);
+    });
+}
+
+static void HsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::HsvToBgr)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Int16ToGray(src, width, height, srcStride, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::HsvToBgr)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::Int16ToGray(src, width, height, srcStride, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::HsvToBgr, Avx2::F)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::HsvToBgr, Sse41::F)
+#endif
+        .Add(Base::HsvToBgr);
+    dispatch.Get(width)(hsv, width, height, hsvStride, bgr, bgrStride);
+}
+
+SIMD_API void SimdHsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        HsvToBgr(hsv + begin * hsvStride, width, end - begin, hsvStride, bgr + begin * bgrStride, bgrStride);
+    });
+}
+
+static void Int16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Int16ToGray)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::Int16ToGray)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::Int16ToGray, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::Int16ToGray(src, width, height, srcStride, dst, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::Int16ToGray, Sse2::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::Int16ToGray(src, width, height, srcStride, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::Int16ToGray, Neon::HA)
+#endif
+        .Add(Base::Int16ToGray);
+    dispatch.Get(width)(src, width, height, srcStride, dst, dstStride);
+}
+
+SIMD_API void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        Int16ToGray(src + begin * srcStride, width, end - begin, srcStride, dst + begin * dstStride, dstStride);
+    });
+}
+
+static void Uint16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, int shift, uint8_t * dst, size_t dstStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Uint16ToGray)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::Uint16ToGray)
 #endif
-        Base::Int16ToGray(src, width, height, srcStride, dst, dstStride);
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::Uint16ToGray, Avx2::A)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::Uint16ToGray, Sse2::A)
+#endif
+        .Add(Base::Uint16ToGray);
+    dispatch.Get(width)(src, width, height, srcStride, shift, dst, dstStride);
+}
+
+SIMD_API void SimdUint16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, int shift, uint8_t * dst, size_t dstStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        Uint16ToGray(src + begin * srcStride, width, end - begin, srcStride, shift, dst + begin * dstStride, dstStride);
+    });
 }
 
 SIMD_API void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                       uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
                       SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::Integral)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Integral)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable)
-        Avx2::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
-    else
+        .Add(Avx2::Enable, Avx2::Integral)
 #endif
-        Base::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+        .Add(Base::Integral);
+    dispatch.Get()(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
 }
 
 SIMD_API void SimdInterferenceIncrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t increment, int16_t saturation)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::InterferenceIncrement)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::InterferenceIncrement)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::HA)
-        Avx2::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
-    else
+        .Add(Avx2::Enable, Avx2::InterferenceIncrement, Avx2::HA)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::HA)
-        Sse2::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
-    else
+        .Add(Sse2::Enable, Sse2::InterferenceIncrement, Sse2::HA)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::HA)
-        Vmx::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
-    else
+        .Add(Vmx::Enable, Vmx::InterferenceIncrement, Vmx::HA)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
-    else
+        .Add(Neon::Enable, Neon::InterferenceIncrement, Neon::HA)
 #endif
-        Base::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
+        .Add(Base::InterferenceIncrement);
+    dispatch.Get(width)(statistic, stride, width, height, increment, saturation);
 }
 
 SIMD_API void SimdInterferenceIncrementMasked(uint8_t * statistic, size_t statisticStride, size_t width, size_t height, 
                                               uint8_t increment, int16_t saturation, const uint8_t * mask, size_t maskStride, uint8_t index)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::InterferenceIncrementMasked)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::InterferenceIncrementMasked)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
-    else
+        .Add(Avx2::Enable, Avx2::InterferenceIncrementMasked, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
-    else
+        .Add(Sse2::Enable, Sse2::InterferenceIncrementMasked, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
-    else
+        .Add(Vmx::Enable, Vmx::InterferenceIncrementMasked, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
-    else
+        .Add(Neon::Enable, Neon::InterferenceIncrementMasked, Neon::A)
 #endif
-        Base::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
+        .Add(Base::InterferenceIncrementMasked);
+    dispatch.Get(width)(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
 }
 
 SIMD_API void SimdInterferenceDecrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t decrement, int16_t saturation)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::InterferenceDecrement)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::InterferenceDecrement)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::HA)
-        Avx2::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
-    else
+        .Add(Avx2::Enable, Avx2::InterferenceDecrement, Avx2::HA)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::HA)
-        Sse2::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
-    else
+        .Add(Sse2::Enable, Sse2::InterferenceDecrement, Sse2::HA)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::HA)
-        Vmx::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
-    else
+        .Add(Vmx::Enable, Vmx::InterferenceDecrement, Vmx::HA)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
-    else
+        .Add(Neon::Enable, Neon::InterferenceDecrement, Neon::HA)
 #endif
-        Base::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
+        .Add(Base::InterferenceDecrement);
+    dispatch.Get(width)(statistic, stride, width, height, decrement, saturation);
 }
 
 SIMD_API void SimdInterferenceDecrementMasked(uint8_t * statistic, size_t statisticStride, size_t width, size_t height, 
                                               uint8_t decrement, int16_t saturation, const uint8_t * mask, size_t maskStride, uint8_t index)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::InterferenceDecrementMasked)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::InterferenceDecrementMasked)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
-    else
+        .Add(Avx2::Enable, Avx2::InterferenceDecrementMasked, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
-    else
+        .Add(Sse2::Enable, Sse2::InterferenceDecrementMasked, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
-    else
+        .Add(Vmx::Enable, Vmx::InterferenceDecrementMasked, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
-    else
+        .Add(Neon::Enable, Neon::InterferenceDecrementMasked, Neon::A)
 #endif
-        Base::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
+        .Add(Base::InterferenceDecrementMasked);
+    dispatch.Get(width)(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
 }
 
-SIMD_API void SimdInterleaveUv(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * uv, size_t uvStride)
+static void InterleaveUv(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * uv, size_t uvStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::InterleaveUv)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::InterleaveUv)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
-    else
+        .Add(Avx2::Enable, Avx2::InterleaveUv, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
-    else
+        .Add(Sse2::Enable, Sse2::InterleaveUv, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if (Vmx::Enable && width >= Vmx::A)
-        Vmx::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
-    else
+        .Add(Vmx::Enable, Vmx::InterleaveUv, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
-    else
+        .Add(Neon::Enable, Neon::InterleaveUv, Neon::A)
 #endif
-        Base::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
+        .Add(Base::InterleaveUv);
+    dispatch.Get(width)(u, uStride, v, vStride, width, height, uv, uvStride);
 }
 
-SIMD_API void SimdInterleaveBgr(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride,
+SIMD_API void SimdInterleaveUv(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * uv, size_t uvStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        InterleaveUv(u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, uv + begin * uvStride, uvStride);
+    });
+}
+
+static void InterleaveBgr(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride,
     size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::InterleaveBgr)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::InterleaveBgr)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
-    else
+        .Add(Avx2::Enable, Avx2::InterleaveBgr, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::InterleaveBgr, Ssse3::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
-    else
+        .Add(Neon::Enable, Neon::InterleaveBgr, Neon::A)
 #endif
-        Base::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
+        .Add(Base::InterleaveBgr);
+    dispatch.Get(width)(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
 }
 
-SIMD_API void SimdInterleaveBgra(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride, const uint8_t * a, size_t aStride,
+SIMD_API void SimdInterleaveBgr(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride,
+    size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        InterleaveBgr(b + begin * bStride, bStride, g + begin * gStride, gStride, r + begin * rStride, rStride, width, end - begin, bgr + begin * bgrStride, bgrStride);
+    });
+}
+
+static void InterleaveBgra(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride, const uint8_t * a, size_t aStride,
     size_t width, size_t height, uint8_t * bgra, size_t bgraStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::InterleaveBgra)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::InterleaveBgra)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
-    else
+        .Add(Avx2::Enable, Avx2::InterleaveBgra, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::InterleaveBgra, Ssse3::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
-    else
+        .Add(Neon::Enable, Neon::InterleaveBgra, Neon::A)
 #endif
-        Base::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
+        .Add(Base::InterleaveBgra);
+    dispatch.Get(width)(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
 }
 
-SIMD_API void SimdLaplace(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdInterleaveBgra(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride, const uint8_t * a, size_t aStride,
+    size_t width, size_t height, uint8_t * bgra, size_t bgraStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        InterleaveBgra(b + begin * bStride, bStride, g + begin * gStride, gStride, r + begin * rStride, rStride, a + begin * aStride, aStride, width, end - begin, bgra + begin * bgraStride, bgraStride);
+    });
+}
+
+static void LabToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::LabToBgr)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::Laplace(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::LabToBgr)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::Laplace(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::LabToBgr, Avx2::F)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::LabToBgr, Sse41::F)
+#endif
+        .Add(Base::LabToBgr);
+    dispatch.Get(width)(lab, width, height, labStride, bgr, bgrStride);
+}
+
+SIMD_API void SimdLabToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        LabToBgr(lab + begin * labStride, width, end - begin, labStride, bgr + begin * bgrStride, bgrStride);
+    });
+}
+
+static void Laplace(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Laplace)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::Laplace, Avx512bw::A + 1)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::Laplace, Avx2::A + 1)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::Laplace(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::Laplace, Ssse3::A + 1)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width > Sse2::A)
-        Sse2::Laplace(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::Laplace, Sse2::A + 1)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::Laplace(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::Laplace, Vmx::A + 1)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::Laplace(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::Laplace, Neon::A + 1)
 #endif
-        Base::Laplace(src, srcStride, width, height, dst, dstStride);
+        .Add(Base::Laplace);
+    dispatch.Get(width)(src, srcStride, width, height, dst, dstStride);
 }
 
-SIMD_API void SimdLaplaceAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdLaplace(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+{
+    ParallelRows(width, height, 1, dst, dstStride, width * 2, [=](size_t begin, size_t end, uint8_t * dst)
+    {
+        Laplace(src + begin * srcStride, srcStride, width, end - begin, dst, dstStride);
+    });
+}
+
+static void LaplaceAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::LaplaceAbs)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::LaplaceAbs, Avx512bw::A + 1)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::LaplaceAbs, Avx2::A + 1)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::LaplaceAbs, Ssse3::A + 1)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::LaplaceAbs, Vmx::A + 1)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::LaplaceAbs, Neon::A + 1)
 #endif
-        Base::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
+        .Add(Base::LaplaceAbs);
+    dispatch.Get(width)(src, srcStride, width, height, dst, dstStride);
+}
+
+SIMD_API void SimdLaplaceAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+{
+    ParallelRows(width, height, 1, dst, dstStride, width * 2, [=](size_t begin, size_t end, uint8_t * dst)
+    {
+        LaplaceAbs(src + begin * srcStride, srcStride, width, end - begin, dst, dstStride);
+    });
 }
 
 SIMD_API void SimdLaplaceAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::LaplaceAbsSum)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::LaplaceAbsSum(src, stride, width, height, sum);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::LaplaceAbsSum, Avx512bw::A + 1)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::LaplaceAbsSum(src, stride, width, height, sum);
-    else
+        .Add(Avx2::Enable, Avx2::LaplaceAbsSum, Avx2::A + 1)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::LaplaceAbsSum(src, stride, width, height, sum);
-    else
+        .Add(Ssse3::Enable, Ssse3::LaplaceAbsSum, Ssse3::A + 1)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::LaplaceAbsSum(src, stride, width, height, sum);
-    else
+        .Add(Vmx::Enable, Vmx::LaplaceAbsSum, Vmx::A + 1)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::LaplaceAbsSum(src, stride, width, height, sum);
-    else
+        .Add(Neon::Enable, Neon::LaplaceAbsSum, Neon::A + 1)
 #endif
-        Base::LaplaceAbsSum(src, stride, width, height, sum);
+        .Add(Base::LaplaceAbsSum);
+    dispatch.Get(width)(src, stride, width, height, sum);
 }
 
 SIMD_API void SimdLbpEstimate(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::LbpEstimate)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::A + 2)
-        Avx512bw::LbpEstimate(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::LbpEstimate, Avx512bw::A + 2)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::LbpEstimate(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::LbpEstimate, Avx2::A + 2)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 2)
-        Sse2::LbpEstimate(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::LbpEstimate, Sse2::A + 2)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A + 2)
-        Vmx::LbpEstimate(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::LbpEstimate, Vmx::A + 2)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::LbpEstimate(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::LbpEstimate, Neon::A + 2)
+#endif
+        .Add(Base::LbpEstimate);
+    dispatch.Get(width)(src, srcStride, width, height, dst, dstStride);
+}
+
+SIMD_API void * SimdLut3dInit(const float * table, size_t size, SimdPixelFormatType format, SimdLut3dInterpolationType interpolation)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Lut3dInit)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::Lut3dInit)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::Lut3dInit)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::Lut3dInit)
 #endif
-        Base::LbpEstimate(src, srcStride, width, height, dst, dstStride);
+        .Add(Base::Lut3dInit);
+    return dispatch.Get()(table, size, format, interpolation);
+}
+
+SIMD_API void SimdLut3dRun(const void * lut3d, const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        ((Lut3d*)lut3d)->Run(src + begin * srcStride, srcStride, width, end - begin, dst + begin * dstStride, dstStride);
+    });
 }
 
 SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::MeanFilter3x3)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
-        Avx512bw::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::MeanFilter3x3, Avx512bw::A)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
-        Avx2::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::MeanFilter3x3, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && (width - 1)*channelCount >= Ssse3::A)
-        Ssse3::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::MeanFilter3x3, Ssse3::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
-        Sse2::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::MeanFilter3x3, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if (Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
-        Vmx::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::MeanFilter3x3, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
-        Neon::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::MeanFilter3x3, Neon::A)
 #endif
-        Base::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+        .Add(Base::MeanFilter3x3);
+    dispatch.Get((width - 1)*channelCount)(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
-SIMD_API void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+static void MedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::MedianFilterRhomb3x3)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
-        Avx512bw::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::MedianFilterRhomb3x3, Avx512bw::A)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
-        Avx2::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::MedianFilterRhomb3x3, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
-        Sse2::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::MedianFilterRhomb3x3, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
-        Vmx::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::MedianFilterRhomb3x3, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
-        Neon::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::MedianFilterRhomb3x3, Neon::A)
 #endif
-        Base::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+        .Add(Base::MedianFilterRhomb3x3);
+    dispatch.Get((width - 1)*channelCount)(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
-SIMD_API void SimdMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+{
+    ParallelRows(width, height, 1, dst, dstStride, width * channelCount, [=](size_t begin, size_t end, uint8_t * dst)
+    {
+        MedianFilterRhomb3x3(src + begin * srcStride, srcStride, width, end - begin, channelCount, dst, dstStride);
+    });
+}
+
+static void MedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::MedianFilterRhomb5x5)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && (width - 2)*channelCount >= Avx512bw::A)
-        Avx512bw::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::MedianFilterRhomb5x5, Avx512bw::A)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 2)*channelCount >= Avx2::A)
-        Avx2::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::MedianFilterRhomb5x5, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 2)*channelCount >= Sse2::A)
-        Sse2::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::MedianFilterRhomb5x5, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 2)*channelCount >= Vmx::A)
-        Vmx::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::MedianFilterRhomb5x5, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && (width - 2)*channelCount >= Neon::A)
-        Neon::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::MedianFilterRhomb5x5, Neon::A)
 #endif
-        Base::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+        .Add(Base::MedianFilterRhomb5x5);
+    dispatch.Get((width - 2)*channelCount)(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
-SIMD_API void SimdMedianFilterSquare3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    ParallelRows(width, height, 2, dst, dstStride, width * channelCount, [=](size_t begin, size_t end, uint8_t * dst)
+    {
+        MedianFilterRhomb5x5(src + begin * srcStride, srcStride, width, end - begin, channelCount, dst, dstStride);
+    });
+}
+
+static void MedianFilterSquare3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::MedianFilterSquare3x3)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
-        Avx512bw::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::MedianFilterSquare3x3, Avx512bw::A)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
-        Avx2::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::MedianFilterSquare3x3, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
-        Sse2::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::MedianFilterSquare3x3, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
-        Vmx::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::MedianFilterSquare3x3, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
-        Neon::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::MedianFilterSquare3x3, Neon::A)
 #endif
-        Base::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+        .Add(Base::MedianFilterSquare3x3);
+    dispatch.Get((width - 1)*channelCount)(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
-SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdMedianFilterSquare3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+{
+    ParallelRows(width, height, 1, dst, dstStride, width * channelCount, [=](size_t begin, size_t end, uint8_t * dst)
+    {
+        MedianFilterSquare3x3(src + begin * srcStride, srcStride, width, end - begin, channelCount, dst, dstStride);
+    });
+}
+
+static void MedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::MedianFilterSquare5x5)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && (width - 2)*channelCount >= Avx512bw::A)
-        Avx512bw::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::MedianFilterSquare5x5, Avx512bw::A)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 2)*channelCount >= Avx2::A)
-        Avx2::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::MedianFilterSquare5x5, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 2)*channelCount >= Sse2::A)
-        Sse2::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::MedianFilterSquare5x5, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 2)*channelCount >= Vmx::A)
-        Vmx::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::MedianFilterSquare5x5, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && (width - 2)*channelCount >= Neon::A)
-        Neon::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::MedianFilterSquare5x5, Neon::A)
 #endif
-        Base::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+        .Add(Base::MedianFilterSquare5x5);
+    dispatch.Get((width - 2)*channelCount)(src, srcStride, width, height, channelCount, dst, dstStride);
+}
+
+SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+{
+    ParallelRows(width, height, 2, dst, dstStride, width * channelCount, [=](size_t begin, size_t end, uint8_t * dst)
+    {
+        MedianFilterSquare5x5(src + begin * srcStride, srcStride, width, end - begin, channelCount, dst, dstStride);
+    });
 }
 
 SIMD_API void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::NeuralConvert)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512f::F)
-        Avx512bw::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::NeuralConvert, Avx512f::F)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx::F)
-        Avx2::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
-    else
+        .Add(Avx2::Enable, Avx2::NeuralConvert, Avx::F)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
-    else
+        .Add(Sse2::Enable, Sse2::NeuralConvert, Sse2::A)
 #endif
 #ifdef SIMD_VSX_ENABLE
-    if (Vsx::Enable && width >= Vsx::A)
-        Vsx::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
-    else
+        .Add(Vsx::Enable, Vsx::NeuralConvert, Vsx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
-    else
+        .Add(Neon::Enable, Neon::NeuralConvert, Neon::A)
 #endif
-        Base::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
+        .Add(Base::NeuralConvert);
+    dispatch.Get(width)(src, srcStride, width, height, dst, dstStride, inversion);
 }
 
 SIMD_API void SimdNeuralProductSum(const float * a, const float * b, size_t size, float * sum)
 {
     typedef void(*SimdNeuralProductSumPtr) (const float * a, const float * b, size_t size, float * sum);
-    const static SimdNeuralProductSumPtr simdNeuralProductSum = SIMD_FUNC6(NeuralProductSum, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
-
-    simdNeuralProductSum(a, b, size, sum);
+    static const auto dispatch = Dispatch<SimdNeuralProductSumPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::NeuralProductSum)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::NeuralProductSum)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::NeuralProductSum)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::NeuralProductSum)
+#endif
+#ifdef SIMD_VSX_ENABLE
+        .Add(Vsx::Enable, Vsx::NeuralProductSum)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::NeuralProductSum)
+#endif
+        .Add(Base::NeuralProductSum);
+    dispatch.Get()(a, b, size, sum);
 }
 
 SIMD_API void SimdNeuralAddVectorMultipliedByValue(const float * src, size_t size, const float * value, float * dst)
 {
     typedef void(*SimdNeuralAddVectorMultipliedByValuePtr) (const float * src, size_t size, const float * value, float * dst);
-    const static SimdNeuralAddVectorMultipliedByValuePtr simdNeuralAddVectorMultipliedByValue = SIMD_FUNC5(NeuralAddVectorMultipliedByValue, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdNeuralAddVectorMultipliedByValue(src, size, value, dst);
+    static const auto dispatch = Dispatch<SimdNeuralAddVectorMultipliedByValuePtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::NeuralAddVectorMultipliedByValue)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::NeuralAddVectorMultipliedByValue)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::NeuralAddVectorMultipliedByValue)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::NeuralAddVectorMultipliedByValue)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::NeuralAddVectorMultipliedByValue)
+#endif
+        .Add(Base::NeuralAddVectorMultipliedByValue);
+    dispatch.Get()(src, size, value, dst);
 }
 
 SIMD_API void SimdNeuralAddVector(const float * src, size_t size, float * dst)
 {
     typedef void(*SimdNeuralAddVectorPtr) (const float * src, size_t size, float * dst);
-    const static SimdNeuralAddVectorPtr simdNeuralAddVector = SIMD_FUNC4(NeuralAddVector, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdNeuralAddVector(src, size, dst);
+    static const auto dispatch = Dispatch<SimdNeuralAddVectorPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::NeuralAddVector)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::NeuralAddVector)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::NeuralAddVector)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::NeuralAddVector)
+#endif
+        .Add(Base::NeuralAddVector);
+    dispatch.Get()(src, size, dst);
 }
 
 SIMD_API void SimdNeuralAddValue(const float * value, float * dst, size_t size)
 {
     typedef void(*SimdNeuralAddValuePtr) (const float * value, float * dst, size_t size);
-    const static SimdNeuralAddValuePtr simdNeuralAddValue = SIMD_FUNC4(NeuralAddValue, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdNeuralAddValue(value, dst, size);
+    static const auto dispatch = Dispatch<SimdNeuralAddValuePtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::NeuralAddValue)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::NeuralAddValue)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::NeuralAddValue)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::NeuralAddValue)
+#endif
+        .Add(Base::NeuralAddValue);
+    dispatch.Get()(value, dst, size);
 }
 
 SIMD_API void SimdNeuralRoughSigmoid(const float * src, size_t size, const float * slope, float * dst)
 {
     typedef void(*SimdNeuralRoughSigmoidPtr) (const float * src, size_t size, const float * slope, float * dst);
-    const static SimdNeuralRoughSigmoidPtr simdNeuralRoughSigmoid = SIMD_FUNC5(NeuralRoughSigmoid, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
-
-    simdNeuralRoughSigmoid(src, size, slope, dst);
+    static const auto dispatch = Dispatch<SimdNeuralRoughSigmoidPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::NeuralRoughSigmoid)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::NeuralRoughSigmoid)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::NeuralRoughSigmoid)
+#endif
+#ifdef SIMD_VSX_ENABLE
+        .Add(Vsx::Enable, Vsx::NeuralRoughSigmoid)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::NeuralRoughSigmoid)
+#endif
+        .Add(Base::NeuralRoughSigmoid);
+    dispatch.Get()(src, size, slope, dst);
 }
 
 SIMD_API void SimdNeuralRoughSigmoid2(const float * src, size_t size, const float * slope, float * dst)
 {
     typedef void(*SimdNeuralRoughSigmoid2Ptr) (const float * src, size_t size, const float * slope, float * dst);
-    const static SimdNeuralRoughSigmoid2Ptr simdNeuralRoughSigmoid2 = SIMD_FUNC5(NeuralRoughSigmoid2, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdNeuralRoughSigmoid2(src, size, slope, dst);
+    static const auto dispatch = Dispatch<SimdNeuralRoughSigmoid2Ptr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::NeuralRoughSigmoid2)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::NeuralRoughSigmoid2)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::NeuralRoughSigmoid2)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::NeuralRoughSigmoid2)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::NeuralRoughSigmoid2)
+#endif
+        .Add(Base::NeuralRoughSigmoid2);
+    dispatch.Get()(src, size, slope, dst);
 }
 
 SIMD_API void SimdNeuralDerivativeSigmoid(const float * src, size_t size, const float * slope, float * dst)
 {
     typedef void(*SimdNeuralDerivativeSigmoidPtr) (const float * src, size_t size, const float * slope, float * dst);
-    const static SimdNeuralDerivativeSigmoidPtr simdNeuralDerivativeSigmoid = SIMD_FUNC4(NeuralDerivativeSigmoid, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdNeuralDerivativeSigmoid(src, size, slope, dst);
+    static const auto dispatch = Dispatch<SimdNeuralDerivativeSigmoidPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::NeuralDerivativeSigmoid)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::NeuralDerivativeSigmoid)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::NeuralDerivativeSigmoid)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::NeuralDerivativeSigmoid)
+#endif
+        .Add(Base::NeuralDerivativeSigmoid);
+    dispatch.Get()(src, size, slope, dst);
 }
 
 SIMD_API void SimdNeuralRoughTanh(const float * src, size_t size, const float * slope, float * dst)
 {
     typedef void(*SimdNeuralRoughTanhPtr) (const float * src, size_t size, const float * slope, float * dst);
-    const static SimdNeuralRoughTanhPtr simdNeuralRoughTanh = SIMD_FUNC4(NeuralRoughTanh, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdNeuralRoughTanh(src, size, slope, dst);
+    static const auto dispatch = Dispatch<SimdNeuralRoughTanhPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::NeuralRoughTanh)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::NeuralRoughTanh)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::NeuralRoughTanh)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::NeuralRoughTanh)
+#endif
+        .Add(Base::NeuralRoughTanh);
+    dispatch.Get()(src, size, slope, dst);
 }
 
 SIMD_API void SimdNeuralDerivativeTanh(const float * src, size_t size, const float * slope, float * dst)
 {
     typedef void(*SimdNeuralDerivativeTanhPtr) (const float * src, size_t size, const float * slope, float * dst);
-    const static SimdNeuralDerivativeTanhPtr simdNeuralDerivativeTanh = SIMD_FUNC4(NeuralDerivativeTanh, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdNeuralDerivativeTanh(src, size, slope, dst);
+    static const auto dispatch = Dispatch<SimdNeuralDerivativeTanhPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::NeuralDerivativeTanh)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::NeuralDerivativeTanh)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::NeuralDerivativeTanh)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::NeuralDerivativeTanh)
+#endif
+        .Add(Base::NeuralDerivativeTanh);
+    dispatch.Get()(src, size, slope, dst);
 }
 
 SIMD_API void SimdNeuralDerivativeRelu(const float * src, size_t size, const float * slope, float * dst)
 {
     typedef void(*SimdNeuralDerivativeReluPtr) (const float * src, size_t size, const float * slope, float * dst);
-    const static SimdNeuralDerivativeReluPtr simdNeuralDerivativeRelu = SIMD_FUNC4(NeuralDerivativeRelu, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdNeuralDerivativeRelu(src, size, slope, dst);
+    static const auto dispatch = Dispatch<SimdNeuralDerivativeReluPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::NeuralDerivativeRelu)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::NeuralDerivativeRelu)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::NeuralDerivativeRelu)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::NeuralDerivativeRelu)
+#endif
+        .Add(Base::NeuralDerivativeRelu);
+    dispatch.Get()(src, size, slope, dst);
 }
 
 SIMD_API void SimdNeuralPow(const float * src, size_t size, const float * exponent, float * dst)
 {
     typedef void(*SimdNeuralPowPtr) (const float * src, size_t size, const float * exponent, float * dst);
-    const static SimdNeuralPowPtr simdNeuralPow = SIMD_FUNC4(NeuralPow, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
-
-    simdNeuralPow(src, size, exponent, dst);
+    static const auto dispatch = Dispatch<SimdNeuralPowPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::NeuralPow)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::NeuralPow)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::NeuralPow)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::NeuralPow)
+#endif
+        .Add(Base::NeuralPow);
+    dispatch.Get()(src, size, exponent, dst);
 }
 
 SIMD_API void SimdNeuralUpdateWeights(const float * x, size_t size, const float * a, const float * b, float * d, float * w)
 {
     typedef void(*SimdNeuralUpdateWeightsPtr) (const float * x, size_t size, const float * a, const float * b, float * d, float * w);
-    const static SimdNeuralUpdateWeightsPtr simdNeuralUpdateWeights = SIMD_FUNC4(NeuralUpdateWeights, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdNeuralUpdateWeights(x, size, a, b, d, w);
+    static const auto dispatch = Dispatch<SimdNeuralUpdateWeightsPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::NeuralUpdateWeights)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::NeuralUpdateWeights)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::NeuralUpdateWeights)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::NeuralUpdateWeights)
+#endif
+        .Add(Base::NeuralUpdateWeights);
+    dispatch.Get()(x, size, a, b, d, w);
 }
 
 SIMD_API void SimdNeuralAdaptiveGradientUpdate(const float * delta, size_t size, size_t batch, const float * alpha, const float * epsilon, float * gradient, float * weight)
 {
     typedef void(*SimdNeuralAdaptiveGradientUpdatePtr) (const float * delta, size_t size, size_t batch, const float * alpha, const float * epsilon, float * gradient, float * weight);
-    const static SimdNeuralAdaptiveGradientUpdatePtr simdNeuralAdaptiveGradientUpdate = SIMD_FUNC4(NeuralAdaptiveGradientUpdate, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdNeuralAdaptiveGradientUpdate(delta, size, batch, alpha, epsilon, gradient, weight);
+    static const auto dispatch = Dispatch<SimdNeuralAdaptiveGradientUpdatePtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::NeuralAdaptiveGradientUpdate)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::NeuralAdaptiveGradientUpdate)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::NeuralAdaptiveGradientUpdate)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::NeuralAdaptiveGradientUpdate)
+#endif
+        .Add(Base::NeuralAdaptiveGradientUpdate);
+    dispatch.Get()(delta, size, batch, alpha, epsilon, gradient, weight);
 }
 
 SIMD_API void SimdNeuralAddConvolution2x2Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::NeuralAddConvolution2x2Forward)>()
 #ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable && width >= Avx512f::F)
-        Avx512f::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
+        .Add(Avx512f::Enable, Avx512f::NeuralAddConvolution2x2Forward, Avx512f::F)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::NeuralAddConvolution2x2Forward, Avx2::F)
 #endif
 #ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
+        .Add(Avx::Enable, Avx::NeuralAddConvolution2x2Forward, Avx::F)
 #endif
 #ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
+        .Add(Sse::Enable, Sse::NeuralAddConvolution2x2Forward, Sse::F)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::NeuralAddConvolution2x2Forward, Neon::F)
 #endif
-        Base::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
+        .Add(Base::NeuralAddConvolution2x2Forward);
+    dispatch.Get(width)(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralAddConvolution3x3Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::NeuralAddConvolution3x3Forward)>()
 #ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable && width >= Avx512f::F)
-        Avx512f::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
+        .Add(Avx512f::Enable, Avx512f::NeuralAddConvolution3x3Forward, Avx512f::F)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::NeuralAddConvolution3x3Forward, Avx2::F)
 #endif
 #ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
+        .Add(Avx::Enable, Avx::NeuralAddConvolution3x3Forward, Avx::F)
 #endif
 #ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
+        .Add(Sse::Enable, Sse::NeuralAddConvolution3x3Forward, Sse::F)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::NeuralAddConvolution3x3Forward, Neon::F)
 #endif
-        Base::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
+        .Add(Base::NeuralAddConvolution3x3Forward);
+    dispatch.Get(width)(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralAddConvolution4x4Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::NeuralAddConvolution4x4Forward)>()
 #ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable && width >= Avx512f::F)
-        Avx512f::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
+        .Add(Avx512f::Enable, Avx512f::NeuralAddConvolution4x4Forward, Avx512f::F)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::NeuralAddConvolution4x4Forward, Avx2::F)
 #endif
 #ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
+        .Add(Avx::Enable, Avx::NeuralAddConvolution4x4Forward, Avx::F)
 #endif
 #ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
+        .Add(Sse::Enable, Sse::NeuralAddConvolution4x4Forward, Sse::F)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::NeuralAddConvolution4x4Forward, Neon::F)
 #endif
-        Base::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
+        .Add(Base::NeuralAddConvolution4x4Forward);
+    dispatch.Get(width)(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralAddConvolution5x5Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::NeuralAddConvolution5x5Forward)>()
 #ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable && width >= Avx512f::F)
-        Avx512f::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
+        .Add(Avx512f::Enable, Avx512f::NeuralAddConvolution5x5Forward, Avx512f::F)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::NeuralAddConvolution5x5Forward, Avx2::F)
 #endif
 #ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
+        .Add(Avx::Enable, Avx::NeuralAddConvolution5x5Forward, Avx::F)
 #endif
 #ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
+        .Add(Sse::Enable, Sse::NeuralAddConvolution5x5Forward, Sse::F)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::NeuralAddConvolution5x5Forward, Neon::F)
 #endif
-        Base::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
+        .Add(Base::NeuralAddConvolution5x5Forward);
+    dispatch.Get(width)(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralAddConvolution2x2Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
     typedef void(*SimdNeuralAddConvolution2x2BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
-    const static SimdNeuralAddConvolution2x2BackwardPtr simdNeuralAddConvolution2x2Backward = SIMD_FUNC5(NeuralAddConvolution2x2Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdNeuralAddConvolution2x2Backward(src, srcStride, width, height, weights, dst, dstStride);
+    static const auto dispatch = Dispatch<SimdNeuralAddConvolution2x2BackwardPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::NeuralAddConvolution2x2Backward)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::NeuralAddConvolution2x2Backward)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::NeuralAddConvolution2x2Backward)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::NeuralAddConvolution2x2Backward)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::NeuralAddConvolution2x2Backward)
+#endif
+        .Add(Base::NeuralAddConvolution2x2Backward);
+    dispatch.Get()(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralAddConvolution3x3Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
     typedef void(*SimdNeuralAddConvolution3x3BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
-    const static SimdNeuralAddConvolution3x3BackwardPtr simdNeuralAddConvolution3x3Backward = SIMD_FUNC5(NeuralAddConvolution3x3Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdNeuralAddConvolution3x3Backward(src, srcStride, width, height, weights, dst, dstStride);
+    static const auto dispatch = Dispatch<SimdNeuralAddConvolution3x3BackwardPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::NeuralAddConvolution3x3Backward)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::NeuralAddConvolution3x3Backward)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::NeuralAddConvolution3x3Backward)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::NeuralAddConvolution3x3Backward)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::NeuralAddConvolution3x3Backward)
+#endif
+        .Add(Base::NeuralAddConvolution3x3Backward);
+    dispatch.Get()(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralAddConvolution4x4Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
     typedef void(*SimdNeuralAddConvolution4x4BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
-    const static SimdNeuralAddConvolution4x4BackwardPtr simdNeuralAddConvolution4x4Backward = SIMD_FUNC5(NeuralAddConvolution4x4Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdNeuralAddConvolution4x4Backward(src, srcStride, width, height, weights, dst, dstStride);
+    static const auto dispatch = Dispatch<SimdNeuralAddConvolution4x4BackwardPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::NeuralAddConvolution4x4Backward)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::NeuralAddConvolution4x4Backward)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::NeuralAddConvolution4x4Backward)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::NeuralAddConvolution4x4Backward)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::NeuralAddConvolution4x4Backward)
+#endif
+        .Add(Base::NeuralAddConvolution4x4Backward);
+    dispatch.Get()(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralAddConvolution5x5Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
     typedef void(*SimdNeuralAddConvolution5x5BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
-    const static SimdNeuralAddConvolution5x5BackwardPtr simdNeuralAddConvolution5x5Backward = SIMD_FUNC5(NeuralAddConvolution5x5Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdNeuralAddConvolution5x5Backward(src, srcStride, width, height, weights, dst, dstStride);
+    static const auto dispatch = Dispatch<SimdNeuralAddConvolution5x5BackwardPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::NeuralAddConvolution5x5Backward)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::NeuralAddConvolution5x5Backward)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::NeuralAddConvolution5x5Backward)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::NeuralAddConvolution5x5Backward)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::NeuralAddConvolution5x5Backward)
+#endif
+        .Add(Base::NeuralAddConvolution5x5Backward);
+    dispatch.Get()(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralAddConvolution2x2Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::NeuralAddConvolution2x2Sum)>()
 #ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable && width >= Avx512f::F)
-        Avx512f::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Avx512f::Enable, Avx512f::NeuralAddConvolution2x2Sum, Avx512f::F)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Avx2::Enable, Avx2::NeuralAddConvolution2x2Sum, Avx2::F)
 #endif
 #ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Avx::Enable, Avx::NeuralAddConvolution2x2Sum, Avx::F)
 #endif
 #ifdef SIMD_SSE3_ENABLE
-    if (Sse3::Enable && width >= Sse3::F)
-        Sse3::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Sse3::Enable, Sse3::NeuralAddConvolution2x2Sum, Sse3::F)
 #endif
 #ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Sse::Enable, Sse::NeuralAddConvolution2x2Sum, Sse::F)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Neon::Enable, Neon::NeuralAddConvolution2x2Sum, Neon::F)
 #endif
-        Base::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
+        .Add(Base::NeuralAddConvolution2x2Sum);
+    dispatch.Get(width)(src, srcStride, dst, dstStride, width, height, sums);
 }
 
 SIMD_API void SimdNeuralAddConvolution3x3Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::NeuralAddConvolution3x3Sum)>()
 #ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable && width >= Avx512f::F)
-        Avx512f::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Avx512f::Enable, Avx512f::NeuralAddConvolution3x3Sum, Avx512f::F)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Avx2::Enable, Avx2::NeuralAddConvolution3x3Sum, Avx2::F)
 #endif
 #ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Avx::Enable, Avx::NeuralAddConvolution3x3Sum, Avx::F)
 #endif
 #ifdef SIMD_SSE3_ENABLE
-    if (Sse3::Enable && width >= Sse3::F)
-        Sse3::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Sse3::Enable, Sse3::NeuralAddConvolution3x3Sum, Sse3::F)
 #endif
 #ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Sse::Enable, Sse::NeuralAddConvolution3x3Sum, Sse::F)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Neon::Enable, Neon::NeuralAddConvolution3x3Sum, Neon::F)
 #endif
-        Base::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
+        .Add(Base::NeuralAddConvolution3x3Sum);
+    dispatch.Get(width)(src, srcStride, dst, dstStride, width, height, sums);
 }
 
 SIMD_API void SimdNeuralAddConvolution4x4Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::NeuralAddConvolution4x4Sum)>()
 #ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable && width >= Avx512f::F)
-        Avx512f::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Avx512f::Enable, Avx512f::NeuralAddConvolution4x4Sum, Avx512f::F)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Avx2::Enable, Avx2::NeuralAddConvolution4x4Sum, Avx2::F)
 #endif
 #ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Avx::Enable, Avx::NeuralAddConvolution4x4Sum, Avx::F)
 #endif
 #ifdef SIMD_SSE3_ENABLE
-    if (Sse3::Enable && width >= Sse3::F)
-        Sse3::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Sse3::Enable, Sse3::NeuralAddConvolution4x4Sum, Sse3::F)
 #endif
 #ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Sse::Enable, Sse::NeuralAddConvolution4x4Sum, Sse::F)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Neon::Enable, Neon::NeuralAddConvolution4x4Sum, Neon::F)
 #endif
-        Base::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
+        .Add(Base::NeuralAddConvolution4x4Sum);
+    dispatch.Get(width)(src, srcStride, dst, dstStride, width, height, sums);
 }
 
 SIMD_API void SimdNeuralAddConvolution5x5Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::NeuralAddConvolution5x5Sum)>()
 #ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable && width >= Avx512f::F)
-        Avx512f::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Avx512f::Enable, Avx512f::NeuralAddConvolution5x5Sum, Avx512f::F)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Avx2::Enable, Avx2::NeuralAddConvolution5x5Sum, Avx2::F)
 #endif
 #ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Avx::Enable, Avx::NeuralAddConvolution5x5Sum, Avx::F)
 #endif
 #ifdef SIMD_SSE3_ENABLE
-    if (Sse3::Enable && width >= Sse3::F)
-        Sse3::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Sse3::Enable, Sse3::NeuralAddConvolution5x5Sum, Sse3::F)
 #endif
 #ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Sse::Enable, Sse::NeuralAddConvolution5x5Sum, Sse::F)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
+        .Add(Neon::Enable, Neon::NeuralAddConvolution5x5Sum, Neon::F)
 #endif
-        Base::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
+        .Add(Base::NeuralAddConvolution5x5Sum);
+    dispatch.Get(width)(src, srcStride, dst, dstStride, width, height, sums);
 }
 
 SIMD_API void SimdNeuralPooling1x1Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::NeuralPooling1x1Max3x3)>()
 #ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable && width > Avx512f::F)
-        Avx512f::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx512f::Enable, Avx512f::NeuralPooling1x1Max3x3, Avx512f::F + 1)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width > Avx2::F)
-        Avx2::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::NeuralPooling1x1Max3x3, Avx2::F + 1)
 #endif
 #ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width > Sse::F)
-        Sse::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Sse::Enable, Sse::NeuralPooling1x1Max3x3, Sse::F + 1)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::F)
-        Neon::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::NeuralPooling1x1Max3x3, Neon::F + 1)
 #endif
-        Base::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
+        .Add(Base::NeuralPooling1x1Max3x3);
+    dispatch.Get(width)(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralPooling2x2Max2x2(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::NeuralPooling2x2Max2x2)>()
 #ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable && width >= Avx512f::DF)
-        Avx512f::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx512f::Enable, Avx512f::NeuralPooling2x2Max2x2, Avx512f::DF)
 #endif
 #ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::DF)
-        Avx::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx::Enable, Avx::NeuralPooling2x2Max2x2, Avx::DF)
 #endif
 #ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::DF)
-        Sse::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Sse::Enable, Sse::NeuralPooling2x2Max2x2, Sse::DF)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DF)
-        Neon::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::NeuralPooling2x2Max2x2, Neon::DF)
 #endif
-        Base::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
+        .Add(Base::NeuralPooling2x2Max2x2);
+    dispatch.Get(width)(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralPooling2x2Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::NeuralPooling2x2Max3x3)>()
 #ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable && width > Avx512f::DF)
-        Avx512f::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx512f::Enable, Avx512f::NeuralPooling2x2Max3x3, Avx512f::DF + 1)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width > Avx2::DF)
-        Avx2::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::NeuralPooling2x2Max3x3, Avx2::DF + 1)
 #endif
 #ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width > Sse::DF)
-        Sse::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Sse::Enable, Sse::NeuralPooling2x2Max3x3, Sse::DF + 1)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::DF)
-        Neon::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::NeuralPooling2x2Max3x3, Neon::DF + 1)
 #endif
-        Base::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
+        .Add(Base::NeuralPooling2x2Max3x3);
+    dispatch.Get(width)(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, 
@@ -3912,457 +4348,513 @@ SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, s
     typedef void(*SimdNeuralConvolutionForwardPtr) (const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, 
         const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, 
         void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
-    const static SimdNeuralConvolutionForwardPtr simdNeuralConvolutionForward = SIMD_FUNC5(NeuralConvolutionForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE3_FUNC, SIMD_NEON_FUNC);
-
-    simdNeuralConvolutionForward(src, srcWidth, srcHeight, srcDepth, weight, kernelX, kernelY, padX, padY, strideX, strideY, dilationX, dilationY, buffer, size, dst, dstWidth, dstHeight, dstDepth, add);
+    static const auto dispatch = Dispatch<SimdNeuralConvolutionForwardPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::NeuralConvolutionForward)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::NeuralConvolutionForward)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::NeuralConvolutionForward)
+#endif
+#ifdef SIMD_SSE3_ENABLE
+        .Add(Sse3::Enable, Sse3::NeuralConvolutionForward)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::NeuralConvolutionForward)
+#endif
+        .Add(Base::NeuralConvolutionForward);
+    dispatch.Get()(src, srcWidth, srcHeight, srcDepth, weight, kernelX, kernelY, padX, padY, strideX, strideY, dilationX, dilationY, buffer, size, dst, dstWidth, dstHeight, dstDepth, add);
 }
 
-SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
-               size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type)
+static void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+    uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::Nv12ToBgra)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Nv12ToBgra, Avx512bw::A)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width*channelCount >= Avx2::A)
-        Avx2::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
-    else
+        .Add(Avx2::Enable, Avx2::Nv12ToBgra, Avx2::A)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::Nv12ToBgra, Sse41::A)
+#endif
+        .Add(Base::Nv12ToBgra);
+    dispatch.Get(width)(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+    uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+    {
+        Nv12ToBgra(y + begin * yStride, yStride, uv + begin / 2 * uvStride, uvStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha, yuvType);
+    });
+}
+
+static void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+    uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Nv12ToBgr)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::Nv12ToBgr, Avx512bw::A)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::Nv12ToBgr, Avx2::A)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::Nv12ToBgr, Sse41::A)
+#endif
+        .Add(Base::Nv12ToBgr);
+    dispatch.Get(width)(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+    uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+    {
+        Nv12ToBgr(y + begin * yStride, yStride, uv + begin / 2 * uvStride, uvStride, width, end - begin, bgr + begin * bgrStride, bgrStride, yuvType);
+    });
+}
+
+static void Nv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+    uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Nv12ToRgb)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::Nv12ToRgb, Avx512bw::A)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::Nv12ToRgb, Avx2::A)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::Nv12ToRgb, Sse41::A)
+#endif
+        .Add(Base::Nv12ToRgb);
+    dispatch.Get(width)(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+}
+
+SIMD_API void SimdNv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+    uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+    {
+        Nv12ToRgb(y + begin * yStride, yStride, uv + begin / 2 * uvStride, uvStride, width, end - begin, rgb + begin * rgbStride, rgbStride, yuvType);
+    });
+}
+
+static void Nv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height,
+    uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Nv21ToBgra)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::Nv21ToBgra, Avx512bw::A)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::Nv21ToBgra, Avx2::A)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::Nv21ToBgra, Sse41::A)
+#endif
+        .Add(Base::Nv21ToBgra);
+    dispatch.Get(width)(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdNv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height,
+    uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+    {
+        Nv21ToBgra(y + begin * yStride, yStride, vu + begin / 2 * vuStride, vuStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha, yuvType);
+    });
+}
+
+static void Nv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height,
+    uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Nv21ToBgr)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::Nv21ToBgr, Avx512bw::A)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::Nv21ToBgr, Avx2::A)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::Nv21ToBgr, Sse41::A)
+#endif
+        .Add(Base::Nv21ToBgr);
+    dispatch.Get(width)(y, yStride, vu, vuStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdNv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height,
+    uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+    {
+        Nv21ToBgr(y + begin * yStride, yStride, vu + begin / 2 * vuStride, vuStride, width, end - begin, bgr + begin * bgrStride, bgrStride, yuvType);
+    });
+}
+
+static void Nv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height,
+    uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Nv21ToRgb)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::Nv21ToRgb, Avx512bw::A)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::Nv21ToRgb, Avx2::A)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::Nv21ToRgb, Sse41::A)
+#endif
+        .Add(Base::Nv21ToRgb);
+    dispatch.Get(width)(y, yStride, vu, vuStride, width, height, rgb, rgbStride, yuvType);
+}
+
+SIMD_API void SimdNv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height,
+    uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+    {
+        Nv21ToRgb(y + begin * yStride, yStride, vu + begin / 2 * vuStride, vuStride, width, end - begin, rgb + begin * rgbStride, rgbStride, yuvType);
+    });
+}
+
+SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
+               size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::OperationBinary8u)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::OperationBinary8u)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::OperationBinary8u, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width*channelCount >= Sse2::A)
-        Sse2::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
-    else
+        .Add(Sse2::Enable, Sse2::OperationBinary8u, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width*channelCount >= Vmx::A)
-        Vmx::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
-    else
+        .Add(Vmx::Enable, Vmx::OperationBinary8u, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width*channelCount >= Neon::A)
-        Neon::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
-    else
+        .Add(Neon::Enable, Neon::OperationBinary8u, Neon::A)
 #endif
-        Base::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+        .Add(Base::OperationBinary8u);
+    dispatch.Get(width*channelCount)(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
 }
 
 SIMD_API void SimdOperationBinary16i(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
                                     size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdOperationBinary16iType type)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::OperationBinary16i)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::OperationBinary16i)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::HA)
-        Avx2::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
-    else
+        .Add(Avx2::Enable, Avx2::OperationBinary16i, Avx2::HA)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::HA)
-        Sse2::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
-    else
+        .Add(Sse2::Enable, Sse2::OperationBinary16i, Sse2::HA)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::HA)
-        Vmx::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
-    else
+        .Add(Vmx::Enable, Vmx::OperationBinary16i, Vmx::HA)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
-    else
+        .Add(Neon::Enable, Neon::OperationBinary16i, Neon::HA)
 #endif
-        Base::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+        .Add(Base::OperationBinary16i);
+    dispatch.Get(width)(a, aStride, b, bStride, width, height, dst, dstStride, type);
 }
 
 SIMD_API void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal, uint8_t * dst, size_t stride, size_t width, size_t height)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::VectorProduct)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::VectorProduct(vertical, horizontal, dst, stride, width, height);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::VectorProduct)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::VectorProduct(vertical, horizontal, dst, stride, width, height);
-    else
+        .Add(Avx2::Enable, Avx2::VectorProduct, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::VectorProduct(vertical, horizontal, dst, stride, width, height);
-    else
+        .Add(Sse2::Enable, Sse2::VectorProduct, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::VectorProduct(vertical, horizontal, dst, stride, width, height);
-    else
+        .Add(Vmx::Enable, Vmx::VectorProduct, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::VectorProduct(vertical, horizontal, dst, stride, width, height);
-    else
+        .Add(Neon::Enable, Neon::VectorProduct, Neon::A)
 #endif
-        Base::VectorProduct(vertical, horizontal, dst, stride, width, height);
+        .Add(Base::VectorProduct);
+    dispatch.Get(width)(vertical, horizontal, dst, stride, width, height);
 }
 
 SIMD_API void SimdReduceColor2x2(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
     uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::ReduceColor2x2)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::ReduceColor2x2)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && srcWidth >= Avx2::DA)
-        Avx2::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
+        .Add(Avx2::Enable, Avx2::ReduceColor2x2, Avx2::DA)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && srcWidth >= Ssse3::DA)
-        Ssse3::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
+        .Add(Ssse3::Enable, Ssse3::ReduceColor2x2, Ssse3::DA)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && srcWidth >= Sse2::DA)
-        Sse2::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
+        .Add(Sse2::Enable, Sse2::ReduceColor2x2, Sse2::DA)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && srcWidth >= Neon::DA)
-        Neon::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
+        .Add(Neon::Enable, Neon::ReduceColor2x2, Neon::DA)
 #endif
-        Base::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+        .Add(Base::ReduceColor2x2);
+    dispatch.Get(srcWidth)(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
 }
 
 SIMD_API void SimdReduceGray2x2(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
                    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::ReduceGray2x2)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::ReduceGray2x2)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && srcWidth >= Avx2::DA)
-        Avx2::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::ReduceGray2x2, Avx2::DA)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && srcWidth >= Ssse3::DA)
-        Ssse3::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::ReduceGray2x2, Ssse3::DA)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && srcWidth >= Sse2::DA)
-        Sse2::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::ReduceGray2x2, Sse2::DA)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && srcWidth >= Vmx::DA)
-        Vmx::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::ReduceGray2x2, Vmx::DA)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && srcWidth >= Neon::DA)
-        Neon::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
+        .Add(Neon::Enable, Neon::ReduceGray2x2, Neon::DA)
 #endif
-        Base::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+        .Add(Base::ReduceGray2x2);
+    dispatch.Get(srcWidth)(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
 }
 
 SIMD_API void SimdReduceGray3x3(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
                    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::ReduceGray3x3)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && srcWidth >= Avx512bw::DA)
-        Avx512bw::ReduceGray3x3(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::ReduceGray3x3, Avx512bw::DA)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && srcWidth >= Avx2::DA)
-        Avx2::ReduceGray3x3(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
+        .Add(Avx2::Enable, Avx2::ReduceGray3x3, Avx2::DA)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && srcWidth >= Sse2::A)
-        Sse2::ReduceGray3x3(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
+        .Add(Sse2::Enable, Sse2::ReduceGray3x3, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && srcWidth >= Vmx::DA)
-        Vmx::ReduceGray3x3(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
+        .Add(Vmx::Enable, Vmx::ReduceGray3x3, Vmx::DA)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && srcWidth >= Neon::DA)
-        Neon::ReduceGray3x3(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
+        .Add(Neon::Enable, Neon::ReduceGray3x3, Neon::DA)
 #endif
-        Base::ReduceGray3x3(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
+        .Add(Base::ReduceGray3x3);
+    dispatch.Get(srcWidth)(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
 }
 
 SIMD_API void SimdReduceGray4x4(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
                    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::ReduceGray4x4)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && srcWidth > Avx512bw::DA)
-        Avx512bw::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::ReduceGray4x4, Avx512bw::DA + 1)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && srcWidth > Avx2::DA)
-        Avx2::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::ReduceGray4x4, Avx2::DA + 1)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && srcWidth > Ssse3::A)
-        Ssse3::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::ReduceGray4x4, Ssse3::A + 1)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && srcWidth > Sse2::A)
-        Sse2::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::ReduceGray4x4, Sse2::A + 1)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && srcWidth > Vmx::DA)
-        Vmx::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::ReduceGray4x4, Vmx::DA + 1)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && srcWidth > Neon::DA)
-        Neon::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
+        .Add(Neon::Enable, Neon::ReduceGray4x4, Neon::DA + 1)
 #endif
-        Base::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+        .Add(Base::ReduceGray4x4);
+    dispatch.Get(srcWidth)(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
 }
 
 SIMD_API void SimdReduceGray5x5(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
                    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::ReduceGray5x5)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && srcWidth >= Avx512bw::DA)
-        Avx512bw::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::ReduceGray5x5, Avx512bw::DA)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && srcWidth >= Avx2::DA)
-        Avx2::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
+        .Add(Avx2::Enable, Avx2::ReduceGray5x5, Avx2::DA)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && srcWidth >= Sse2::A)
-        Sse2::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
+        .Add(Sse2::Enable, Sse2::ReduceGray5x5, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && srcWidth >= Vmx::DA)
-        Vmx::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
+        .Add(Vmx::Enable, Vmx::ReduceGray5x5, Vmx::DA)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && srcWidth >= Neon::DA)
-        Neon::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
+        .Add(Neon::Enable, Neon::ReduceGray5x5, Neon::DA)
 #endif
-        Base::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
+        .Add(Base::ReduceGray5x5);
+    dispatch.Get(srcWidth)(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
 }
 
 SIMD_API void SimdReorder16bit(const uint8_t * src, size_t size, uint8_t * dst)
 {
+    typedef void(*SimdReorder16bitPtr) (const uint8_t * src, size_t size, uint8_t * dst);
+    static const auto dispatch = Dispatch<SimdReorder16bitPtr>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Reorder16bit(src, size, dst);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Reorder16bit)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && size >= Avx2::A)
-        Avx2::Reorder16bit(src, size, dst);
-    else
+        .Add(Avx2::Enable, Avx2::Reorder16bit, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && size >= Ssse3::A)
-        Ssse3::Reorder16bit(src, size, dst);
-    else
+        .Add(Ssse3::Enable, Ssse3::Reorder16bit, Ssse3::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && size >= Sse2::A)
-        Sse2::Reorder16bit(src, size, dst);
-    else
+        .Add(Sse2::Enable, Sse2::Reorder16bit, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && size >= Vmx::A)
-        Vmx::Reorder16bit(src, size, dst);
-    else
+        .Add(Vmx::Enable, Vmx::Reorder16bit, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && size >= Neon::A)
-        Neon::Reorder16bit(src, size, dst);
-    else
+        .Add(Neon::Enable, Neon::Reorder16bit, Neon::A)
 #endif
-        Base::Reorder16bit(src, size, dst);
+        .Add(Base::Reorder16bit);
+    dispatch.Get(size)(src, size, dst);
 }
 
 SIMD_API void SimdReorder32bit(const uint8_t * src, size_t size, uint8_t * dst)
 {
+    typedef void(*SimdReorder32bitPtr) (const uint8_t * src, size_t size, uint8_t * dst);
+    static const auto dispatch = Dispatch<SimdReorder32bitPtr>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Reorder32bit(src, size, dst);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Reorder32bit)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && size >= Avx2::A)
-        Avx2::Reorder32bit(src, size, dst);
-    else
+        .Add(Avx2::Enable, Avx2::Reorder32bit, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && size >= Ssse3::A)
-        Ssse3::Reorder32bit(src, size, dst);
-    else
+        .Add(Ssse3::Enable, Ssse3::Reorder32bit, Ssse3::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && size >= Sse2::A)
-        Sse2::Reorder32bit(src, size, dst);
-    else
+        .Add(Sse2::Enable, Sse2::Reorder32bit, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && size >= Vmx::A)
-        Vmx::Reorder32bit(src, size, dst);
-    else
+        .Add(Vmx::Enable, Vmx::Reorder32bit, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && size >= Neon::A)
-        Neon::Reorder32bit(src, size, dst);
-    else
+        .Add(Neon::Enable, Neon::Reorder32bit, Neon::A)
 #endif
-        Base::Reorder32bit(src, size, dst);
+        .Add(Base::Reorder32bit);
+    dispatch.Get(size)(src, size, dst);
 }
 
 SIMD_API void SimdReorder64bit(const uint8_t * src, size_t size, uint8_t * dst)
 {
+    typedef void(*SimdReorder64bitPtr) (const uint8_t * src, size_t size, uint8_t * dst);
+    static const auto dispatch = Dispatch<SimdReorder64bitPtr>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Reorder64bit(src, size, dst);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Reorder64bit)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && size >= Avx2::A)
-        Avx2::Reorder64bit(src, size, dst);
-    else
+        .Add(Avx2::Enable, Avx2::Reorder64bit, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && size >= Ssse3::A)
-        Ssse3::Reorder64bit(src, size, dst);
-    else
+        .Add(Ssse3::Enable, Ssse3::Reorder64bit, Ssse3::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && size >= Sse2::A)
-        Sse2::Reorder64bit(src, size, dst);
-    else
+        .Add(Sse2::Enable, Sse2::Reorder64bit, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && size >= Vmx::A)
-        Vmx::Reorder64bit(src, size, dst);
-    else
+        .Add(Vmx::Enable, Vmx::Reorder64bit, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && size >= Neon::A)
-        Neon::Reorder64bit(src, size, dst);
-    else
+        .Add(Neon::Enable, Neon::Reorder64bit, Neon::A)
 #endif
-        Base::Reorder64bit(src, size, dst);
+        .Add(Base::Reorder64bit);
+    dispatch.Get(size)(src, size, dst);
 }
 
 SIMD_API void SimdResizeBilinear(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
     uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
 {
+    typedef void(*SimdResizeBilinearPtr) (const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+        uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount, size_t yBeg, size_t yEnd);
+    static const auto dispatch = Dispatch<SimdResizeBilinearPtr>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && dstWidth >= Avx512bw::A)
-        Avx512bw::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::ResizeBilinear, Avx512bw::A)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && dstWidth >= Avx2::A)
-        Avx2::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
+        .Add(Avx2::Enable, Avx2::ResizeBilinear, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && dstWidth >= Ssse3::A)
-        Ssse3::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
+        .Add(Ssse3::Enable, Ssse3::ResizeBilinear, Ssse3::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && dstWidth >= Sse2::A)
-        Sse2::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
+        .Add(Sse2::Enable, Sse2::ResizeBilinear, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && dstWidth >= Vmx::A)
-        Vmx::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
+        .Add(Vmx::Enable, Vmx::ResizeBilinear, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && dstWidth >= Neon::A)
-        Neon::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
+        .Add(Neon::Enable, Neon::ResizeBilinear, Neon::A)
 #endif
-        Base::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+        .Add(Base::ResizeBilinear);
+    SimdResizeBilinearPtr resizeBilinear = dispatch.Get(dstWidth);
+    ParallelRows(dstWidth * channelCount, dstHeight, 1, [=](size_t begin, size_t end)
+    {
+        resizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount, begin, end);
+    });
 }
 
 SIMD_API void * SimdResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::ResizerInit)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        return Avx512bw::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::ResizerInit)
 #endif
 #ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable)
-        return Avx512f::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
-    else
+        .Add(Avx512f::Enable, Avx512f::ResizerInit)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable)
-        return Avx2::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
-    else
+        .Add(Avx2::Enable, Avx2::ResizerInit)
 #endif
 #ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable)
-        return Avx::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
-    else
+        .Add(Avx::Enable, Avx::ResizerInit)
 #endif
 #ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable)
-        return Sse41::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
-    else
+        .Add(Sse41::Enable, Sse41::ResizerInit)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable)
-        return Ssse3::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
-    else
+        .Add(Ssse3::Enable, Ssse3::ResizerInit)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable)
-        return Sse2::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
-    else
+        .Add(Sse2::Enable, Sse2::ResizerInit)
 #endif
 #ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable)
-        return Sse::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
-    else
+        .Add(Sse::Enable, Sse::ResizerInit)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable)
-        return Neon::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
-    else
+        .Add(Neon::Enable, Neon::ResizerInit)
 #endif
-        return Base::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
+        .Add(Base::ResizerInit);
+    return dispatch.Get()(srcX, srcY, dstX, dstY, channels, type, method);
 }
 
 SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
@@ -4370,152 +4862,131 @@ SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t s
     ((Resizer*)resizer)->Run(src, srcStride, dst, dstStride);
 }
 
-SIMD_API void SimdRgbToBgra(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
+SIMD_API size_t SimdResizerRunRows(const void * resizer, const uint8_t * src, size_t srcStride, size_t srcRowBeg, size_t srcRowEnd, uint8_t * dst, size_t dstStride)
+{
+    return ((Resizer*)resizer)->RunRows(src, srcStride, srcRowBeg, srcRowEnd, dst, dstStride);
+}
+
+static void RgbToBgra(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::RgbToBgra)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::RgbToBgra(rgb, width, height, rgbStride, bgra, bgraStride, alpha);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::RgbToBgra)
 #endif
 #if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::RgbToBgra(rgb, width, height, rgbStride, bgra, bgraStride, alpha);
-    else
+        .Add(Avx2::Enable, Avx2::RgbToBgra, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::RgbToBgra(rgb, width, height, rgbStride, bgra, bgraStride, alpha);
-    else
+        .Add(Ssse3::Enable, Ssse3::RgbToBgra, Ssse3::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::RgbToBgra(rgb, width, height, rgbStride, bgra, bgraStride, alpha);
-    else
+        .Add(Neon::Enable, Neon::RgbToBgra, Neon::A)
 #endif
-        Base::RgbToBgra(rgb, width, height, rgbStride, bgra, bgraStride, alpha);
+        .Add(Base::RgbToBgra);
+    dispatch.Get(width)(rgb, width, height, rgbStride, bgra, bgraStride, alpha);
 }
 
-SIMD_API void SimdRgbToGray(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* gray, size_t grayStride)
+SIMD_API void SimdRgbToBgra(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        RgbToBgra(rgb + begin * rgbStride, width, end - begin, rgbStride, bgra + begin * bgraStride, bgraStride, alpha);
+    });
+}
+
+static void RgbToGray(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* gray, size_t grayStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::RgbToGray)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::RgbToGray(rgb, width, height, rgbStride, gray, grayStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::RgbToGray)
 #endif
 #if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::RgbToGray(rgb, width, height, rgbStride, gray, grayStride);
-    else
+        .Add(Avx2::Enable, Avx2::RgbToGray, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::RgbToGray(rgb, width, height, rgbStride, gray, grayStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::RgbToGray, Ssse3::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::RgbToGray(rgb, width, height, rgbStride, gray, grayStride);
-    else
+        .Add(Neon::Enable, Neon::RgbToGray, Neon::A)
 #endif
-        Base::RgbToGray(rgb, width, height, rgbStride, gray, grayStride);
+        .Add(Base::RgbToGray);
+    dispatch.Get(width)(rgb, width, height, rgbStride, gray, grayStride);
+}
+
+SIMD_API void SimdRgbToGray(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* gray, size_t grayStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        RgbToGray(rgb + begin * rgbStride, width, end - begin, rgbStride, gray + begin * grayStride, grayStride);
+    });
 }
 
 SIMD_API void SimdSegmentationChangeIndex(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t oldIndex, uint8_t newIndex)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::SegmentationChangeIndex)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::SegmentationChangeIndex(mask, stride, width, height, oldIndex, newIndex);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::SegmentationChangeIndex)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::SegmentationChangeIndex(mask, stride, width, height, oldIndex, newIndex);
-    else
+        .Add(Avx2::Enable, Avx2::SegmentationChangeIndex, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::SegmentationChangeIndex(mask, stride, width, height, oldIndex, newIndex);
-    else
+        .Add(Sse2::Enable, Sse2::SegmentationChangeIndex, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::SegmentationChangeIndex(mask, stride, width, height, oldIndex, newIndex);
-    else
+        .Add(Vmx::Enable, Vmx::SegmentationChangeIndex, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::SegmentationChangeIndex(mask, stride, width, height, oldIndex, newIndex);
-    else
+        .Add(Neon::Enable, Neon::SegmentationChangeIndex, Neon::A)
 #endif
-        Base::SegmentationChangeIndex(mask, stride, width, height, oldIndex, newIndex);
+        .Add(Base::SegmentationChangeIndex);
+    dispatch.Get(width)(mask, stride, width, height, oldIndex, newIndex);
 }
 
 SIMD_API void SimdSegmentationFillSingleHoles(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::SegmentationFillSingleHoles)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::SegmentationFillSingleHoles(mask, stride, width, height, index);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::SegmentationFillSingleHoles)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A + 2)
-        Avx2::SegmentationFillSingleHoles(mask, stride, width, height, index);
-    else
+        .Add(Avx2::Enable, Avx2::SegmentationFillSingleHoles, Avx2::A + 2 + 1)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width > Sse2::A + 2)
-        Sse2::SegmentationFillSingleHoles(mask, stride, width, height, index);
-    else
+        .Add(Sse2::Enable, Sse2::SegmentationFillSingleHoles, Sse2::A + 2 + 1)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A + 2)
-        Vmx::SegmentationFillSingleHoles(mask, stride, width, height, index);
-    else
+        .Add(Vmx::Enable, Vmx::SegmentationFillSingleHoles, Vmx::A + 2 + 1)
 #endif
 #ifdef SIMD_NEON_ENABLE
-        if (Neon::Enable && width > Neon::A + 2)
-            Neon::SegmentationFillSingleHoles(mask, stride, width, height, index);
-        else
+        .Add(Neon::Enable, Neon::SegmentationFillSingleHoles, Neon::A + 2 + 1)
 #endif
-        Base::SegmentationFillSingleHoles(mask, stride, width, height, index);
+        .Add(Base::SegmentationFillSingleHoles);
+    dispatch.Get(width)(mask, stride, width, height, index);
 }
 
 SIMD_API void SimdSegmentationPropagate2x2(const uint8_t * parent, size_t parentStride, size_t width, size_t height, 
                                            uint8_t * child, size_t childStride, const uint8_t * difference, size_t differenceStride, 
                                            uint8_t currentIndex, uint8_t invalidIndex, uint8_t emptyIndex, uint8_t differenceThreshold)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::SegmentationPropagate2x2)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::SegmentationPropagate2x2(parent, parentStride, width, height, child, childStride,
-        difference, differenceStride, currentIndex, invalidIndex, emptyIndex, differenceThreshold);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::SegmentationPropagate2x2)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 1)
-        Avx2::SegmentationPropagate2x2(parent, parentStride, width, height, child, childStride,
-        difference, differenceStride, currentIndex, invalidIndex, emptyIndex, differenceThreshold);
-    else
+        .Add(Avx2::Enable, Avx2::SegmentationPropagate2x2, Avx2::A + 1)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 1)
-        Sse2::SegmentationPropagate2x2(parent, parentStride, width, height, child, childStride,
-        difference, differenceStride, currentIndex, invalidIndex, emptyIndex, differenceThreshold);
-    else
+        .Add(Sse2::Enable, Sse2::SegmentationPropagate2x2, Sse2::A + 1)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A + 1)
-        Vmx::SegmentationPropagate2x2(parent, parentStride, width, height, child, childStride,
-        difference, differenceStride, currentIndex, invalidIndex, emptyIndex, differenceThreshold);
-    else
+        .Add(Vmx::Enable, Vmx::SegmentationPropagate2x2, Vmx::A + 1)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 1)
-        Neon::SegmentationPropagate2x2(parent, parentStride, width, height, child, childStride,
-            difference, differenceStride, currentIndex, invalidIndex, emptyIndex, differenceThreshold);
-    else
+        .Add(Neon::Enable, Neon::SegmentationPropagate2x2, Neon::A + 1)
 #endif
-        Base::SegmentationPropagate2x2(parent, parentStride, width, height, child, childStride,
-        difference, differenceStride, currentIndex, invalidIndex, emptyIndex, differenceThreshold);
+        .Add(Base::SegmentationPropagate2x2);
+    dispatch.Get(width)(parent, parentStride, width, height, child, childStride, difference, differenceStride, currentIndex, invalidIndex, emptyIndex, differenceThreshold);
 }
 
 SIMD_API void SimdSegmentationShrinkRegion(const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index,
@@ -4553,438 +5024,391 @@ SIMD_API void SimdShiftBilinear(const uint8_t * src, size_t srcStride, size_t wi
     const uint8_t * bkg, size_t bkgStride, const double * shiftX, const double * shiftY,
     size_t cropLeft, size_t cropTop, size_t cropRight, size_t cropBottom, uint8_t * dst, size_t dstStride)
 {
+    typedef void(*SimdShiftBilinearPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, const uint8_t * bkg, size_t bkgStride, const double * shiftX, const double * shiftY, size_t cropLeft, size_t cropTop, size_t cropRight, size_t cropBottom, uint8_t * dst, size_t dstStride);
+    static const auto dispatch = Dispatch<SimdShiftBilinearPtr>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ShiftBilinear(src, srcStride, width, height, channelCount, bkg, bkgStride,
-        shiftX, shiftY, cropLeft, cropTop, cropRight, cropBottom, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::ShiftBilinear)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable)
-        Avx2::ShiftBilinear(src, srcStride, width, height, channelCount, bkg, bkgStride,
-        shiftX, shiftY, cropLeft, cropTop, cropRight, cropBottom, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::ShiftBilinear)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable)
-        Sse2::ShiftBilinear(src, srcStride, width, height, channelCount, bkg, bkgStride,
-        shiftX, shiftY, cropLeft, cropTop, cropRight, cropBottom, dst, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::ShiftBilinear)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable)
-        Vmx::ShiftBilinear(src, srcStride, width, height, channelCount, bkg, bkgStride,
-        shiftX, shiftY, cropLeft, cropTop, cropRight, cropBottom, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::ShiftBilinear)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable)
-        Neon::ShiftBilinear(src, srcStride, width, height, channelCount, bkg, bkgStride,
-        shiftX, shiftY, cropLeft, cropTop, cropRight, cropBottom, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::ShiftBilinear)
 #endif
-        Base::ShiftBilinear(src, srcStride, width, height, channelCount, bkg, bkgStride,
-        shiftX, shiftY, cropLeft, cropTop, cropRight, cropBottom, dst, dstStride);
+        .Add(Base::ShiftBilinear);
+    dispatch.Get()(src, srcStride, width, height, channelCount, bkg, bkgStride, shiftX, shiftY, cropLeft, cropTop, cropRight, cropBottom, dst, dstStride);
 }
 
-SIMD_API void SimdSobelDx(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+static void SobelDx(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::SobelDx)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::SobelDx(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::SobelDx, Avx512bw::A + 1)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::SobelDx(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::SobelDx, Avx2::A + 1)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::SobelDx(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::SobelDx, Ssse3::A + 1)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width > Sse2::A)
-        Sse2::SobelDx(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::SobelDx, Sse2::A + 1)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::SobelDx(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::SobelDx, Vmx::A + 1)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::SobelDx(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::SobelDx, Neon::A + 1)
 #endif
-        Base::SobelDx(src, srcStride, width, height, dst, dstStride);
+        .Add(Base::SobelDx);
+    dispatch.Get(width)(src, srcStride, width, height, dst, dstStride);
 }
 
-SIMD_API void SimdSobelDxAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdSobelDx(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+{
+    ParallelRows(width, height, 1, dst, dstStride, width * 2, [=](size_t begin, size_t end, uint8_t * dst)
+    {
+        SobelDx(src + begin * srcStride, srcStride, width, end - begin, dst, dstStride);
+    });
+}
+
+static void SobelDxAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::SobelDxAbs)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::SobelDxAbs, Avx512bw::A + 1)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::SobelDxAbs, Avx2::A + 1)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::SobelDxAbs, Ssse3::A + 1)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::SobelDxAbs, Vmx::A + 1)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::SobelDxAbs, Neon::A + 1)
 #endif
-        Base::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
+        .Add(Base::SobelDxAbs);
+    dispatch.Get(width)(src, srcStride, width, height, dst, dstStride);
+}
+
+SIMD_API void SimdSobelDxAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+{
+    ParallelRows(width, height, 1, dst, dstStride, width * 2, [=](size_t begin, size_t end, uint8_t * dst)
+    {
+        SobelDxAbs(src + begin * srcStride, srcStride, width, end - begin, dst, dstStride);
+    });
 }
 
 SIMD_API void SimdSobelDxAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::SobelDxAbsSum)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::SobelDxAbsSum(src, stride, width, height, sum);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::SobelDxAbsSum, Avx512bw::A + 1)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::SobelDxAbsSum(src, stride, width, height, sum);
-    else
+        .Add(Avx2::Enable, Avx2::SobelDxAbsSum, Avx2::A + 1)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::SobelDxAbsSum(src, stride, width, height, sum);
-    else
+        .Add(Ssse3::Enable, Ssse3::SobelDxAbsSum, Ssse3::A + 1)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::SobelDxAbsSum(src, stride, width, height, sum);
-    else
+        .Add(Vmx::Enable, Vmx::SobelDxAbsSum, Vmx::A + 1)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::SobelDxAbsSum(src, stride, width, height, sum);
-    else
+        .Add(Neon::Enable, Neon::SobelDxAbsSum, Neon::A + 1)
 #endif
-        Base::SobelDxAbsSum(src, stride, width, height, sum);
+        .Add(Base::SobelDxAbsSum);
+    dispatch.Get(width)(src, stride, width, height, sum);
 }
 
-SIMD_API void SimdSobelDy(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+static void SobelDy(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::SobelDy)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::SobelDy(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::SobelDy, Avx512bw::A + 1)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::SobelDy(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::SobelDy, Avx2::A + 1)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::SobelDy(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::SobelDy, Ssse3::A + 1)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width > Sse2::A)
-        Sse2::SobelDy(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::SobelDy, Sse2::A + 1)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::SobelDy(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::SobelDy, Vmx::A + 1)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::SobelDy(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::SobelDy, Neon::A + 1)
 #endif
-        Base::SobelDy(src, srcStride, width, height, dst, dstStride);
+        .Add(Base::SobelDy);
+    dispatch.Get(width)(src, srcStride, width, height, dst, dstStride);
 }
 
-SIMD_API void SimdSobelDyAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdSobelDy(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+{
+    ParallelRows(width, height, 1, dst, dstStride, width * 2, [=](size_t begin, size_t end, uint8_t * dst)
+    {
+        SobelDy(src + begin * srcStride, srcStride, width, end - begin, dst, dstStride);
+    });
+}
+
+static void SobelDyAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::SobelDyAbs)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::SobelDyAbs, Avx512bw::A + 1)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::SobelDyAbs, Avx2::A + 1)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::SobelDyAbs, Ssse3::A + 1)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::SobelDyAbs, Vmx::A + 1)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::SobelDyAbs, Neon::A + 1)
 #endif
-        Base::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
+        .Add(Base::SobelDyAbs);
+    dispatch.Get(width)(src, srcStride, width, height, dst, dstStride);
+}
+
+SIMD_API void SimdSobelDyAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+{
+    ParallelRows(width, height, 1, dst, dstStride, width * 2, [=](size_t begin, size_t end, uint8_t * dst)
+    {
+        SobelDyAbs(src + begin * srcStride, srcStride, width, end - begin, dst, dstStride);
+    });
 }
 
 SIMD_API void SimdSobelDyAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::SobelDyAbsSum)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::SobelDyAbsSum(src, stride, width, height, sum);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::SobelDyAbsSum, Avx512bw::A + 1)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::SobelDyAbsSum(src, stride, width, height, sum);
-    else
+        .Add(Avx2::Enable, Avx2::SobelDyAbsSum, Avx2::A + 1)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::SobelDyAbsSum(src, stride, width, height, sum);
-    else
+        .Add(Ssse3::Enable, Ssse3::SobelDyAbsSum, Ssse3::A + 1)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::SobelDyAbsSum(src, stride, width, height, sum);
-    else
+        .Add(Vmx::Enable, Vmx::SobelDyAbsSum, Vmx::A + 1)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::SobelDyAbsSum(src, stride, width, height, sum);
-    else
+        .Add(Neon::Enable, Neon::SobelDyAbsSum, Neon::A + 1)
 #endif
-        Base::SobelDyAbsSum(src, stride, width, height, sum);
+        .Add(Base::SobelDyAbsSum);
+    dispatch.Get(width)(src, stride, width, height, sum);
 }
 
-SIMD_API void SimdContourMetrics(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+static void ContourMetrics(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::ContourMetrics)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::ContourMetrics(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::ContourMetrics, Avx512bw::A + 1)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::ContourMetrics(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::ContourMetrics, Avx2::A + 1)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::ContourMetrics(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::ContourMetrics, Ssse3::A + 1)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::ContourMetrics(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::ContourMetrics, Vmx::A + 1)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::ContourMetrics(src, srcStride, width, height, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::ContourMetrics, Neon::A + 1)
 #endif
-        Base::ContourMetrics(src, srcStride, width, height, dst, dstStride);
+        .Add(Base::ContourMetrics);
+    dispatch.Get(width)(src, srcStride, width, height, dst, dstStride);
+}
+
+SIMD_API void SimdContourMetrics(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+{
+    ParallelRows(width, height, 1, dst, dstStride, width * 2, [=](size_t begin, size_t end, uint8_t * dst)
+    {
+        ContourMetrics(src + begin * srcStride, srcStride, width, end - begin, dst, dstStride);
+    });
 }
 
 SIMD_API void SimdContourMetricsMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                        const uint8_t * mask, size_t maskStride, uint8_t indexMin, uint8_t * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::ContourMetricsMasked)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::ContourMetricsMasked(src, srcStride, width, height, mask, maskStride, indexMin, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::ContourMetricsMasked, Avx512bw::A + 1)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::ContourMetricsMasked(src, srcStride, width, height, mask, maskStride, indexMin, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::ContourMetricsMasked, Avx2::A + 1)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::ContourMetricsMasked(src, srcStride, width, height, mask, maskStride, indexMin, dst, dstStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::ContourMetricsMasked, Ssse3::A + 1)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::ContourMetricsMasked(src, srcStride, width, height, mask, maskStride, indexMin, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::ContourMetricsMasked, Vmx::A + 1)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::ContourMetricsMasked(src, srcStride, width, height, mask, maskStride, indexMin, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::ContourMetricsMasked, Neon::A + 1)
 #endif
-        Base::ContourMetricsMasked(src, srcStride, width, height, mask, maskStride, indexMin, dst, dstStride);
+        .Add(Base::ContourMetricsMasked);
+    dispatch.Get(width)(src, srcStride, width, height, mask, maskStride, indexMin, dst, dstStride);
 }
 
 SIMD_API void SimdContourAnchors(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t step, int16_t threshold, uint8_t * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::ContourAnchors)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::ContourAnchors(src, srcStride, width, height, step, threshold, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::ContourAnchors, Avx512bw::A + 1)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::ContourAnchors(src, srcStride, width, height, step, threshold, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::ContourAnchors, Avx2::A + 1)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width > Sse2::A)
-        Sse2::ContourAnchors(src, srcStride, width, height, step, threshold, dst, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::ContourAnchors, Sse2::A + 1)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::ContourAnchors(src, srcStride, width, height, step, threshold, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::ContourAnchors, Vmx::A + 1)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::ContourAnchors(src, srcStride, width, height, step, threshold, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::ContourAnchors, Neon::A + 1)
 #endif
-        Base::ContourAnchors(src, srcStride, width, height, step, threshold, dst, dstStride);
+        .Add(Base::ContourAnchors);
+    dispatch.Get(width)(src, srcStride, width, height, step, threshold, dst, dstStride);
 }
 
 SIMD_API void SimdSquaredDifferenceSum(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
                           size_t width, size_t height, uint64_t * sum)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::SquaredDifferenceSum)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::SquaredDifferenceSum)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
+        .Add(Avx2::Enable, Avx2::SquaredDifferenceSum, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
+        .Add(Ssse3::Enable, Ssse3::SquaredDifferenceSum, Ssse3::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
+        .Add(Sse2::Enable, Sse2::SquaredDifferenceSum, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
+        .Add(Vmx::Enable, Vmx::SquaredDifferenceSum, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
+        .Add(Neon::Enable, Neon::SquaredDifferenceSum, Neon::A)
 #endif
-        Base::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
+        .Add(Base::SquaredDifferenceSum);
+    dispatch.Get(width)(a, aStride, b, bStride, width, height, sum);
 }
 
 SIMD_API void SimdSquaredDifferenceSumMasked(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
                           const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::SquaredDifferenceSumMasked)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::SquaredDifferenceSumMasked)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
+        .Add(Avx2::Enable, Avx2::SquaredDifferenceSumMasked, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
+        .Add(Ssse3::Enable, Ssse3::SquaredDifferenceSumMasked, Ssse3::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
+        .Add(Sse2::Enable, Sse2::SquaredDifferenceSumMasked, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
+        .Add(Vmx::Enable, Vmx::SquaredDifferenceSumMasked, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
+        .Add(Neon::Enable, Neon::SquaredDifferenceSumMasked, Neon::A)
 #endif
-        Base::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
+        .Add(Base::SquaredDifferenceSumMasked);
+    dispatch.Get(width)(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
 }
 
 SIMD_API void SimdSquaredDifferenceSum32f(const float * a, const float * b, size_t size, float * sum)
 {
     typedef void (* SimdSquaredDifferenceSum32fPtr) (const float * a, const float * b, size_t size, float * sum);
-    const static SimdSquaredDifferenceSum32fPtr simdSquaredDifferenceSum32f = SIMD_FUNC5(SquaredDifferenceSum32f, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
-
-    simdSquaredDifferenceSum32f(a, b, size, sum);
+    static const auto dispatch = Dispatch<SimdSquaredDifferenceSum32fPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SquaredDifferenceSum32f)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SquaredDifferenceSum32f)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::SquaredDifferenceSum32f)
+#endif
+#ifdef SIMD_VSX_ENABLE
+        .Add(Vsx::Enable, Vsx::SquaredDifferenceSum32f)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SquaredDifferenceSum32f)
+#endif
+        .Add(Base::SquaredDifferenceSum32f);
+    dispatch.Get()(a, b, size, sum);
 }
 
 SIMD_API void SimdSquaredDifferenceKahanSum32f(const float * a, const float * b, size_t size, float * sum)
 {
     typedef void (* SimdSquaredDifferenceKahanSum32fPtr) (const float * a, const float * b, size_t size, float * sum);
-    const static SimdSquaredDifferenceKahanSum32fPtr simdSquaredDifferenceKahanSum32f = SIMD_FUNC5(SquaredDifferenceKahanSum32f, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
-
-    simdSquaredDifferenceKahanSum32f(a, b, size, sum);
+    static const auto dispatch = Dispatch<SimdSquaredDifferenceKahanSum32fPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SquaredDifferenceKahanSum32f)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SquaredDifferenceKahanSum32f)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::SquaredDifferenceKahanSum32f)
+#endif
+#ifdef SIMD_VSX_ENABLE
+        .Add(Vsx::Enable, Vsx::SquaredDifferenceKahanSum32f)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SquaredDifferenceKahanSum32f)
+#endif
+        .Add(Base::SquaredDifferenceKahanSum32f);
+    dispatch.Get()(a, b, size, sum);
 }
 
 SIMD_API void SimdGetStatistic(const uint8_t * src, size_t stride, size_t width, size_t height,
                   uint8_t * min, uint8_t * max, uint8_t * average)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::GetStatistic)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::GetStatistic(src, stride, width, height, min, max, average);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::GetStatistic)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GetStatistic(src, stride, width, height, min, max, average);
-    else
+        .Add(Avx2::Enable, Avx2::GetStatistic, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GetStatistic(src, stride, width, height, min, max, average);
-    else
+        .Add(Sse2::Enable, Sse2::GetStatistic, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GetStatistic(src, stride, width, height, min, max, average);
-    else
+        .Add(Vmx::Enable, Vmx::GetStatistic, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::GetStatistic(src, stride, width, height, min, max, average);
-    else
+        .Add(Neon::Enable, Neon::GetStatistic, Neon::A)
 #endif
-        Base::GetStatistic(src, stride, width, height, min, max, average);
+        .Add(Base::GetStatistic);
+    dispatch.Get(width)(src, stride, width, height, min, max, average);
 }
 
 SIMD_API void SimdGetMoments(const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index,
@@ -5022,331 +5446,259 @@ SIMD_API void SimdGetMoments(const uint8_t * mask, size_t stride, size_t width,
 SIMD_API void SimdGetObjectMoments(const uint8_t* src, size_t srcStride, size_t width, size_t height, const uint8_t* mask, size_t maskStride, uint8_t index,
     uint64_t* n, uint64_t* s, uint64_t* sx, uint64_t* sy, uint64_t* sxx, uint64_t* sxy, uint64_t* syy)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::GetObjectMoments)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::GetObjectMoments(src, srcStride, width, height, mask, maskStride, index, n, s, sx, sy, sxx, sxy, syy);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::GetObjectMoments)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::GetObjectMoments(src, srcStride, width, height, mask, maskStride, index, n, s, sx, sy, sxx, sxy, syy);
-    else
+        .Add(Avx2::Enable, Avx2::GetObjectMoments, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::GetObjectMoments(src, srcStride, width, height, mask, maskStride, index, n, s, sx, sy, sxx, sxy, syy);
-    else
+        .Add(Sse2::Enable, Sse2::GetObjectMoments, Sse2::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::GetObjectMoments(src, srcStride, width, height, mask, maskStride, index, n, s, sx, sy, sxx, sxy, syy);
-    else
+        .Add(Neon::Enable, Neon::GetObjectMoments, Neon::A)
 #endif
-        Base::GetObjectMoments(src, srcStride, width, height, mask, maskStride, index, n, s, sx, sy, sxx, sxy, syy);
+        .Add(Base::GetObjectMoments);
+    dispatch.Get(width)(src, srcStride, width, height, mask, maskStride, index, n, s, sx, sy, sxx, sxy, syy);
 }
 
 SIMD_API void SimdGetRowSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::GetRowSums)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::GetRowSums(src, stride, width, height, sums);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::GetRowSums)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GetRowSums(src, stride, width, height, sums);
-    else
+        .Add(Avx2::Enable, Avx2::GetRowSums, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GetRowSums(src, stride, width, height, sums);
-    else
+        .Add(Sse2::Enable, Sse2::GetRowSums, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GetRowSums(src, stride, width, height, sums);
-    else
+        .Add(Vmx::Enable, Vmx::GetRowSums, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::GetRowSums(src, stride, width, height, sums);
-    else
+        .Add(Neon::Enable, Neon::GetRowSums, Neon::A)
 #endif
-        Base::GetRowSums(src, stride, width, height, sums);
+        .Add(Base::GetRowSums);
+    dispatch.Get(width)(src, stride, width, height, sums);
 }
 
 SIMD_API void SimdGetColSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::GetColSums)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::GetColSums(src, stride, width, height, sums);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::GetColSums)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GetColSums(src, stride, width, height, sums);
-    else
+        .Add(Avx2::Enable, Avx2::GetColSums, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GetColSums(src, stride, width, height, sums);
-    else
+        .Add(Sse2::Enable, Sse2::GetColSums, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GetColSums(src, stride, width, height, sums);
-    else
+        .Add(Vmx::Enable, Vmx::GetColSums, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::GetColSums(src, stride, width, height, sums);
-    else
+        .Add(Neon::Enable, Neon::GetColSums, Neon::A)
 #endif
-        Base::GetColSums(src, stride, width, height, sums);
+        .Add(Base::GetColSums);
+    dispatch.Get(width)(src, stride, width, height, sums);
 }
 
 SIMD_API void SimdGetAbsDyRowSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::GetAbsDyRowSums)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::GetAbsDyRowSums(src, stride, width, height, sums);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::GetAbsDyRowSums)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GetAbsDyRowSums(src, stride, width, height, sums);
-    else
+        .Add(Avx2::Enable, Avx2::GetAbsDyRowSums, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GetAbsDyRowSums(src, stride, width, height, sums);
-    else
+        .Add(Sse2::Enable, Sse2::GetAbsDyRowSums, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GetAbsDyRowSums(src, stride, width, height, sums);
-    else
+        .Add(Vmx::Enable, Vmx::GetAbsDyRowSums, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::GetAbsDyRowSums(src, stride, width, height, sums);
-    else
+        .Add(Neon::Enable, Neon::GetAbsDyRowSums, Neon::A)
 #endif
-        Base::GetAbsDyRowSums(src, stride, width, height, sums);
+        .Add(Base::GetAbsDyRowSums);
+    dispatch.Get(width)(src, stride, width, height, sums);
 }
 
 SIMD_API void SimdGetAbsDxColSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::GetAbsDxColSums)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::GetAbsDxColSums(src, stride, width, height, sums);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::GetAbsDxColSums)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GetAbsDxColSums(src, stride, width, height, sums);
-    else
+        .Add(Avx2::Enable, Avx2::GetAbsDxColSums, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GetAbsDxColSums(src, stride, width, height, sums);
-    else
+        .Add(Sse2::Enable, Sse2::GetAbsDxColSums, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GetAbsDxColSums(src, stride, width, height, sums);
-    else
+        .Add(Vmx::Enable, Vmx::GetAbsDxColSums, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::GetAbsDxColSums(src, stride, width, height, sums);
-    else
+        .Add(Neon::Enable, Neon::GetAbsDxColSums, Neon::A)
 #endif
-        Base::GetAbsDxColSums(src, stride, width, height, sums);
+        .Add(Base::GetAbsDxColSums);
+    dispatch.Get(width)(src, stride, width, height, sums);
 }
 
 SIMD_API void SimdValueSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::ValueSum)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ValueSum(src, stride, width, height, sum);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::ValueSum)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::ValueSum(src, stride, width, height, sum);
-    else
+        .Add(Avx2::Enable, Avx2::ValueSum, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::ValueSum(src, stride, width, height, sum);
-    else
+        .Add(Sse2::Enable, Sse2::ValueSum, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::ValueSum(src, stride, width, height, sum);
-    else
+        .Add(Vmx::Enable, Vmx::ValueSum, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::ValueSum(src, stride, width, height, sum);
-    else
+        .Add(Neon::Enable, Neon::ValueSum, Neon::A)
 #endif
-        Base::ValueSum(src, stride, width, height, sum);
+        .Add(Base::ValueSum);
+    dispatch.Get(width)(src, stride, width, height, sum);
 }
 
 SIMD_API void SimdSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::SquareSum)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::SquareSum(src, stride, width, height, sum);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::SquareSum)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::SquareSum(src, stride, width, height, sum);
-    else
+        .Add(Avx2::Enable, Avx2::SquareSum, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::SquareSum(src, stride, width, height, sum);
-    else
+        .Add(Sse2::Enable, Sse2::SquareSum, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::SquareSum(src, stride, width, height, sum);
-    else
+        .Add(Vmx::Enable, Vmx::SquareSum, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::SquareSum(src, stride, width, height, sum);
-    else
+        .Add(Neon::Enable, Neon::SquareSum, Neon::A)
 #endif
-        Base::SquareSum(src, stride, width, height, sum);
+        .Add(Base::SquareSum);
+    dispatch.Get(width)(src, stride, width, height, sum);
 }
 
 SIMD_API void SimdValueSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * valueSum, uint64_t * squareSum)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::ValueSquareSum)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ValueSquareSum(src, stride, width, height, valueSum, squareSum);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::ValueSquareSum)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::ValueSquareSum(src, stride, width, height, valueSum, squareSum);
-    else
+        .Add(Avx2::Enable, Avx2::ValueSquareSum, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::ValueSquareSum(src, stride, width, height, valueSum, squareSum);
-    else
+        .Add(Sse2::Enable, Sse2::ValueSquareSum, Sse2::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::ValueSquareSum(src, stride, width, height, valueSum, squareSum);
-    else
+        .Add(Neon::Enable, Neon::ValueSquareSum, Neon::A)
 #endif
-        Base::ValueSquareSum(src, stride, width, height, valueSum, squareSum);
+        .Add(Base::ValueSquareSum);
+    dispatch.Get(width)(src, stride, width, height, valueSum, squareSum);
 }
 
 SIMD_API void SimdCorrelationSum(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint64_t * sum)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::CorrelationSum)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::CorrelationSum(a, aStride, b, bStride, width, height, sum);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::CorrelationSum)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::CorrelationSum(a, aStride, b, bStride, width, height, sum);
-    else
+        .Add(Avx2::Enable, Avx2::CorrelationSum, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::CorrelationSum(a, aStride, b, bStride, width, height, sum);
-    else
+        .Add(Sse2::Enable, Sse2::CorrelationSum, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::CorrelationSum(a, aStride, b, bStride, width, height, sum);
-    else
+        .Add(Vmx::Enable, Vmx::CorrelationSum, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::CorrelationSum(a, aStride, b, bStride, width, height, sum);
-    else
+        .Add(Neon::Enable, Neon::CorrelationSum, Neon::A)
 #endif
-        Base::CorrelationSum(a, aStride, b, bStride, width, height, sum);
+        .Add(Base::CorrelationSum);
+    dispatch.Get(width)(a, aStride, b, bStride, width, height, sum);
 }
 
 SIMD_API void SimdStretchGray2x2(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
                     uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::StretchGray2x2)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::StretchGray2x2)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && srcWidth >= Avx2::A)
-        Avx2::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::StretchGray2x2, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && srcWidth >= Sse2::A)
-        Sse2::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::StretchGray2x2, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && srcWidth >= Vmx::A)
-        Vmx::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::StretchGray2x2, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && srcWidth >= Neon::A)
-        Neon::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
+        .Add(Neon::Enable, Neon::StretchGray2x2, Neon::A)
 #endif
-        Base::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+        .Add(Base::StretchGray2x2);
+    dispatch.Get(srcWidth)(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
 }
 
 SIMD_API void SimdSvmSumLinear(const float * x, const float * svs, const float * weights, size_t length, size_t count, float * sum)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::SvmSumLinear)>()
 #ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable)
-        Avx512f::SvmSumLinear(x, svs, weights, length, count, sum);
-    else
+        .Add(Avx512f::Enable, Avx512f::SvmSumLinear)
 #endif
 #ifdef SIMD_AVX_ENABLE
-    if(Avx::Enable)
-        Avx::SvmSumLinear(x, svs, weights, length, count, sum);
-    else
+        .Add(Avx::Enable, Avx::SvmSumLinear)
 #endif
 #ifdef SIMD_SSE_ENABLE
-    if(Sse::Enable)
-        Sse::SvmSumLinear(x, svs, weights, length, count, sum);
-    else
+        .Add(Sse::Enable, Sse::SvmSumLinear)
 #endif
 #ifdef SIMD_VSX_ENABLE
-    if(Vsx::Enable)
-        Vsx::SvmSumLinear(x, svs, weights, length, count, sum);
-    else
+        .Add(Vsx::Enable, Vsx::SvmSumLinear)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable)
-        Neon::SvmSumLinear(x, svs, weights, length, count, sum);
-    else
+        .Add(Neon::Enable, Neon::SvmSumLinear)
 #endif
-        Base::SvmSumLinear(x, svs, weights, length, count, sum);
+        .Add(Base::SvmSumLinear);
+    dispatch.Get()(x, svs, weights, length, count, sum);
 }
 
 SIMD_API void SimdSynetAddBias(const float * bias, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format)
 {
     typedef void(*SimdSynetAddBiasPtr) (const float * bias, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
-    const static SimdSynetAddBiasPtr simdSynetAddBias = SIMD_FUNC4(SynetAddBias, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetAddBias(bias, channels, spatial, dst, format);
+    static const auto dispatch = Dispatch<SimdSynetAddBiasPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetAddBias)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetAddBias)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::SynetAddBias)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetAddBias)
+#endif
+        .Add(Base::SynetAddBias);
+    dispatch.Get()(bias, channels, spatial, dst, format);
 }
 
 SIMD_API void SimdSynetAdd8i(const uint8_t* aData, const float* aScale, const float* aShift, const uint8_t* bData, const float* bScale, const float* bShift,
@@ -5354,33 +5706,81 @@ SIMD_API void SimdSynetAdd8i(const uint8_t* aData, const float* aScale, const fl
 {
     typedef void(*SimdSynetAdd8iPtr) (const uint8_t* aData, const float* aScale, const float* aShift, const uint8_t* bData, const float* bScale, const float* bShift,
         uint8_t* cData, const float* cScale, const float* cShift, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetAdd8iPtr simdSynetAdd8i = SIMD_FUNC3(SynetAdd8i, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
-
-    simdSynetAdd8i(aData, aScale, aShift, bData, bScale, bShift, cData, cScale, cShift, batch, channels, spatial, format, compatibility);
+    static const auto dispatch = Dispatch<SimdSynetAdd8iPtr>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::SynetAdd8i)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetAdd8i)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::SynetAdd8i)
+#endif
+        .Add(Base::SynetAdd8i);
+    dispatch.Get()(aData, aScale, aShift, bData, bScale, bShift, cData, cScale, cShift, batch, channels, spatial, format, compatibility);
 }
 
 SIMD_API void SimdSynetConvert32fTo8u(const float* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, uint8_t* dst, SimdSynetCompatibilityType compatibility)
 {
     typedef void(*SimdSynetConvert32fTo8uPtr) (const float* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, uint8_t* dst, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetConvert32fTo8uPtr simdSynetConvert32fTo8u = SIMD_FUNC4(SynetConvert32fTo8u, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetConvert32fTo8u(src, batch, channels, height, width, format, scale, shift, dst, compatibility);
+    static const auto dispatch = Dispatch<SimdSynetConvert32fTo8uPtr>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::SynetConvert32fTo8u)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetConvert32fTo8u)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::SynetConvert32fTo8u)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetConvert32fTo8u)
+#endif
+        .Add(Base::SynetConvert32fTo8u);
+    dispatch.Get()(src, batch, channels, height, width, format, scale, shift, dst, compatibility);
 }
 
 SIMD_API void SimdSynetConvert8uTo32f(const uint8_t* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, float* dst, SimdSynetCompatibilityType compatibility)
 {
     typedef void(*SimdSynetConvert8uTo32fPtr) (const uint8_t* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, float* dst, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetConvert8uTo32fPtr simdSynetConvert8uTo32f = SIMD_FUNC3(SynetConvert8uTo32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);//, SIMD_NEON_FUNC);
-
-    simdSynetConvert8uTo32f(src, batch, channels, height, width, format, scale, shift, dst, compatibility);
+    static const auto dispatch = Dispatch<SimdSynetConvert8uTo32fPtr>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::SynetConvert8uTo32f)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetConvert8uTo32f)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::SynetConvert8uTo32f)
+#endif
+        .Add(Base::SynetConvert8uTo32f);
+    dispatch.Get()(src, batch, channels, height, width, format, scale, shift, dst, compatibility);
 }
 
 SIMD_API void * SimdSynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * params, SimdGemm32fNNPtr gemm)
 {
     typedef void* (*SimdSynetConvolution32fInitPtr) (size_t batch, const SimdConvolutionParameters * params, SimdGemm32fNNPtr gemm);
-    const static SimdSynetConvolution32fInitPtr simdSynetConvolution32fInit = SIMD_FUNC6(SynetConvolution32fInit, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE3_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
-
-    return simdSynetConvolution32fInit(batch, params, gemm);
+    static const auto dispatch = Dispatch<SimdSynetConvolution32fInitPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetConvolution32fInit)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetConvolution32fInit)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetConvolution32fInit)
+#endif
+#ifdef SIMD_SSE3_ENABLE
+        .Add(Sse3::Enable, Sse3::SynetConvolution32fInit)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::SynetConvolution32fInit)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetConvolution32fInit)
+#endif
+        .Add(Base::SynetConvolution32fInit);
+    return dispatch.Get()(batch, params, gemm);
 }
 
 SIMD_API size_t SimdSynetConvolution32fExternalBufferSize(const void * context)
@@ -5410,12 +5810,57 @@ SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src,
     c->Forward(src, buf, dst);
 }
 
+SIMD_API size_t SimdRuntimeCacheExport(char * data, size_t size)
+{
+    String cache = Base::RuntimeCache::Global().Export();
+    if (data && size > cache.size())
+        memcpy(data, cache.c_str(), cache.size() + 1);
+    return cache.size() + 1;
+}
+
+SIMD_API SimdBool SimdRuntimeCacheImport(const char * data)
+{
+    if (data == NULL)
+        return SimdFalse;
+    return Base::RuntimeCache::Global().Import(data) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API SimdBool SimdRuntimeCacheSave(const char * path)
+{
+    return Base::RuntimeCache::Global().Save(path) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API SimdBool SimdRuntimeCacheLoad(const char * path)
+{
+    return Base::RuntimeCache::Global().Load(path) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API void SimdRuntimeCacheClear()
+{
+    Base::RuntimeCache::Global().Clear();
+}
+
 SIMD_API void* SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility)
 {
     typedef void* (*SimdSynetConvolution8iInitPtr) (size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetConvolution8iInitPtr simdSynetConvolution8iInit = SIMD_FUNC5(SynetConvolution8iInit, SIMD_AVX512VNNI_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
-    
-    return simdSynetConvolution8iInit(batch, conv, compatibility);
+    static const auto dispatch = Dispatch<SimdSynetConvolution8iInitPtr>()
+#ifdef SIMD_AVX512VNNI_ENABLE
+        .Add(Avx512vnni::Enable, Avx512vnni::SynetConvolution8iInit)
+#endif
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::SynetConvolution8iInit)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetConvolution8iInit)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::SynetConvolution8iInit)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetConvolution8iInit)
+#endif
+        .Add(Base::SynetConvolution8iInit);
+    return dispatch.Get()(batch, conv, compatibility);
 }
 
 SIMD_API size_t SimdSynetConvolution8iExternalBufferSize(const void* context)
@@ -5448,9 +5893,24 @@ SIMD_API void SimdSynetConvolution8iForward(void* context, const uint8_t* src, u
 SIMD_API void * SimdSynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * params, SimdGemm32fNNPtr gemm)
 {
     typedef void* (*SimdSynetDeconvolution32fInitPtr) (size_t batch, const SimdConvolutionParameters * params, SimdGemm32fNNPtr gemm);
-    const static SimdSynetDeconvolution32fInitPtr simdSynetDeconvolution32fInit = SIMD_FUNC5(SynetDeconvolution32fInit, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
-    
-    return simdSynetDeconvolution32fInit(batch, params, gemm);
+    static const auto dispatch = Dispatch<SimdSynetDeconvolution32fInitPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetDeconvolution32fInit)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetDeconvolution32fInit)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetDeconvolution32fInit)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::SynetDeconvolution32fInit)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetDeconvolution32fInit)
+#endif
+        .Add(Base::SynetDeconvolution32fInit);
+    return dispatch.Get()(batch, params, gemm);
 }
 
 SIMD_API size_t SimdSynetDeconvolution32fExternalBufferSize(const void * context)
@@ -5483,113 +5943,287 @@ SIMD_API void SimdSynetDeconvolution32fForward(void * context, const float * src
 SIMD_API void SimdSynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst)
 {
     typedef void(*SimdSynetEltwiseLayerForwardPtr) (float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
-    const static SimdSynetEltwiseLayerForwardPtr simdSynetEltwiseLayerForward = SIMD_FUNC5(SynetEltwiseLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetEltwiseLayerForward(src, weight, count, size, type, dst);
-}
-
-SIMD_API void SimdSynetElu32f(const float * src, size_t size, const float * alpha, float * dst)
-{
-    typedef void(*SimdSynetElu32fPtr) (const float * src, size_t size, const float * alpha, float * dst);
-    const static SimdSynetElu32fPtr simdSynetElu32f = SIMD_FUNC4(SynetElu32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    static const auto dispatch = Dispatch<SimdSynetEltwiseLayerForwardPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetEltwiseLayerForward)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetEltwiseLayerForward)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetEltwiseLayerForward)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::SynetEltwiseLayerForward)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetEltwiseLayerForward)
+#endif
+        .Add(Base::SynetEltwiseLayerForward);
+    dispatch.Get()(src, weight, count, size, type, dst);
+}
 
-    simdSynetElu32f(src, size, alpha, dst);
+SIMD_API void SimdSynetElu32f(const float * src, size_t size, const float * alpha, float * dst)
+{
+    typedef void(*SimdSynetElu32fPtr) (const float * src, size_t size, const float * alpha, float * dst);
+    static const auto dispatch = Dispatch<SimdSynetElu32fPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetElu32f)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetElu32f)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::SynetElu32f)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetElu32f)
+#endif
+        .Add(Base::SynetElu32f);
+    dispatch.Get()(src, size, alpha, dst);
 }
 
 SIMD_API void SimdSynetFusedLayerForward0(const float * src, const float * bias, const float * scale, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format)
 {
     typedef void(*SimdSynetFusedLayerForward0Ptr) (const float * src, const float * bias, const float * scale, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
-    const static SimdSynetFusedLayerForward0Ptr simdSynetFusedLayerForward0 = SIMD_FUNC4(SynetFusedLayerForward0, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetFusedLayerForward0(src, bias, scale, channels, spatial, dst, format);
+    static const auto dispatch = Dispatch<SimdSynetFusedLayerForward0Ptr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetFusedLayerForward0)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetFusedLayerForward0)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::SynetFusedLayerForward0)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetFusedLayerForward0)
+#endif
+        .Add(Base::SynetFusedLayerForward0);
+    dispatch.Get()(src, bias, scale, channels, spatial, dst, format);
 }
 
 SIMD_API void SimdSynetFusedLayerForward1(const float * src, const float * bias0, const float * scale1, const float * bias1, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format)
 {
     typedef void(*SimdSynetFusedLayerForward1Ptr) (const float * src, const float * bias0, const float * scale1, const float * bias1, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
-    const static SimdSynetFusedLayerForward1Ptr simdSynetFusedLayerForward1 = SIMD_FUNC4(SynetFusedLayerForward1, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetFusedLayerForward1(src, bias0, scale1, bias1, channels, spatial, dst, format);
+    static const auto dispatch = Dispatch<SimdSynetFusedLayerForward1Ptr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetFusedLayerForward1)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetFusedLayerForward1)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::SynetFusedLayerForward1)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetFusedLayerForward1)
+#endif
+        .Add(Base::SynetFusedLayerForward1);
+    dispatch.Get()(src, bias0, scale1, bias1, channels, spatial, dst, format);
 }
 
 SIMD_API void SimdSynetFusedLayerForward2(const float * src, const float * scale, const float * bias, size_t channels, size_t spatial, const float * slope, float * dst, SimdTensorFormatType format)
 {
     typedef void(*SimdSynetFusedLayerForward2Ptr) (const float * src, const float * scale, const float * bias, size_t channels, size_t spatial, const float * slope, float * dst, SimdTensorFormatType format);
-    const static SimdSynetFusedLayerForward2Ptr simdSynetFusedLayerForward2 = SIMD_FUNC4(SynetFusedLayerForward2, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetFusedLayerForward2(src, scale, bias, channels, spatial, slope, dst, format);
+    static const auto dispatch = Dispatch<SimdSynetFusedLayerForward2Ptr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetFusedLayerForward2)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetFusedLayerForward2)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::SynetFusedLayerForward2)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetFusedLayerForward2)
+#endif
+        .Add(Base::SynetFusedLayerForward2);
+    dispatch.Get()(src, scale, bias, channels, spatial, slope, dst, format);
 }
 
 SIMD_API void SimdSynetFusedLayerForward3(const float * src, const float * bias, const float * scale, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format)
 {
     typedef void(*SimdSynetFusedLayerForward3Ptr) (const float * src, const float * bias, const float * scale, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
-    const static SimdSynetFusedLayerForward3Ptr simdSynetFusedLayerForward3 = SIMD_FUNC4(SynetFusedLayerForward3, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetFusedLayerForward3(src, bias, scale, channels, spatial, dst, format);
+    static const auto dispatch = Dispatch<SimdSynetFusedLayerForward3Ptr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetFusedLayerForward3)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetFusedLayerForward3)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::SynetFusedLayerForward3)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetFusedLayerForward3)
+#endif
+        .Add(Base::SynetFusedLayerForward3);
+    dispatch.Get()(src, bias, scale, channels, spatial, dst, format);
 }
 
 SIMD_API void SimdSynetFusedLayerForward4(const float * src, const float * bias0, const float * scale1, const float * bias1, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format)
 {
     typedef void(*SimdSynetFusedLayerForward4Ptr) (const float * src, const float * bias0, const float * scale1, const float * bias1, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
-    const static SimdSynetFusedLayerForward4Ptr simdSynetFusedLayerForward4 = SIMD_FUNC4(SynetFusedLayerForward4, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetFusedLayerForward4(src, bias0, scale1, bias1, channels, spatial, dst, format);
+    static const auto dispatch = Dispatch<SimdSynetFusedLayerForward4Ptr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetFusedLayerForward4)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetFusedLayerForward4)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::SynetFusedLayerForward4)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetFusedLayerForward4)
+#endif
+        .Add(Base::SynetFusedLayerForward4);
+    dispatch.Get()(src, bias0, scale1, bias1, channels, spatial, dst, format);
 }
 
 SIMD_API void SimdSynetFusedLayerForward8(const float * src0, const float * src1, const float * src2, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format)
 {
     typedef void(*SimdSynetFusedLayerForward8Ptr) (const float * src0, const float * src1, const float * src2, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
-    const static SimdSynetFusedLayerForward8Ptr simdSynetFusedLayerForward8 = SIMD_FUNC4(SynetFusedLayerForward8, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetFusedLayerForward8(src0, src1, src2, channels, spatial, dst, format);
+    static const auto dispatch = Dispatch<SimdSynetFusedLayerForward8Ptr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetFusedLayerForward8)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetFusedLayerForward8)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::SynetFusedLayerForward8)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetFusedLayerForward8)
+#endif
+        .Add(Base::SynetFusedLayerForward8);
+    dispatch.Get()(src0, src1, src2, channels, spatial, dst, format);
 }
 
 SIMD_API void SimdSynetFusedLayerForward9(const float * src0, const float * src1, const float * scale, const float * bias, size_t channels0, size_t channels1, size_t spatial, float * dst0, float * dst1, SimdTensorFormatType format)
 {
     typedef void(*SimdSynetFusedLayerForward9Ptr) (const float * src0, const float * src1, const float * scale, const float * bias, size_t channels0, size_t channels1, size_t spatial, float * dst0, float * dst1, SimdTensorFormatType format);
-    const static SimdSynetFusedLayerForward9Ptr simdSynetFusedLayerForward9 = SIMD_FUNC4(SynetFusedLayerForward9, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetFusedLayerForward9(src0, src1, scale, bias, channels0, channels1, spatial, dst0, dst1, format);
+    static const auto dispatch = Dispatch<SimdSynetFusedLayerForward9Ptr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetFusedLayerForward9)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetFusedLayerForward9)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::SynetFusedLayerForward9)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetFusedLayerForward9)
+#endif
+        .Add(Base::SynetFusedLayerForward9);
+    dispatch.Get()(src0, src1, scale, bias, channels0, channels1, spatial, dst0, dst1, format);
 }
 
 SIMD_API void SimdSynetHswish32f(const float * src, size_t size, const float * shift, const float * scale, float * dst)
 {
     typedef void(*SimdSynetHswish32fPtr) (const float * src, size_t size, const float * shift, const float * scale, float * dst);
-    const static SimdSynetHswish32fPtr simdSynetHswish32f = SIMD_FUNC4(SynetHswish32f, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetHswish32f(src, size, shift, scale, dst);
+    static const auto dispatch = Dispatch<SimdSynetHswish32fPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetHswish32f)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetHswish32f)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::SynetHswish32f)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetHswish32f)
+#endif
+        .Add(Base::SynetHswish32f);
+    dispatch.Get()(src, size, shift, scale, dst);
 }
 
 SIMD_API void SimdSynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst)
 {
     typedef void(*SimdSynetInnerProductLayerForwardPtr) (const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
-    const static SimdSynetInnerProductLayerForwardPtr simdSynetInnerProductLayerForward = SIMD_FUNC5(SynetInnerProductLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetInnerProductLayerForward(src, weight, bias, count, size, dst);
+    static const auto dispatch = Dispatch<SimdSynetInnerProductLayerForwardPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetInnerProductLayerForward)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetInnerProductLayerForward)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetInnerProductLayerForward)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::SynetInnerProductLayerForward)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetInnerProductLayerForward)
+#endif
+        .Add(Base::SynetInnerProductLayerForward);
+    dispatch.Get()(src, weight, bias, count, size, dst);
 }
 
 SIMD_API void SimdSynetInnerProduct8i(size_t M, size_t N, size_t K, const uint8_t* src, const int8_t* weight, int32_t* dst, SimdSynetCompatibilityType compatibility)
 {
     typedef void(*SimdSynetInnerProduct8iPtr) (size_t M, size_t N, size_t K, const uint8_t* src, const int8_t* weight, int32_t* dst, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetInnerProduct8iPtr simdSynetInnerProduct8i = SIMD_FUNC3(SynetInnerProduct8i, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
-
-    simdSynetInnerProduct8i(M, N, K, src, weight, dst, compatibility);
+    static const auto dispatch = Dispatch<SimdSynetInnerProduct8iPtr>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::SynetInnerProduct8i)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetInnerProduct8i)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::SynetInnerProduct8i)
+#endif
+        .Add(Base::SynetInnerProduct8i);
+    dispatch.Get()(M, N, K, src, weight, dst, compatibility);
 }
 
 SIMD_API void SimdSynetLrnLayerCrossChannels(const float * src, size_t half, size_t channels, size_t spatial, const float * k, float * dst, SimdTensorFormatType format)
 {
     typedef void(*SimdSynetLrnLayerCrossChannelsPtr) (const float * src, size_t half, size_t channels, size_t spatial, const float * k, float * dst, SimdTensorFormatType format);
-    const static SimdSynetLrnLayerCrossChannelsPtr simdSynetLrnLayerCrossChannels = SIMD_FUNC4(SynetLrnLayerCrossChannels, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetLrnLayerCrossChannels(src, half, channels, spatial, k, dst, format);
+    static const auto dispatch = Dispatch<SimdSynetLrnLayerCrossChannelsPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetLrnLayerCrossChannels)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetLrnLayerCrossChannels)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::SynetLrnLayerCrossChannels)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetLrnLayerCrossChannels)
+#endif
+        .Add(Base::SynetLrnLayerCrossChannels);
+    dispatch.Get()(src, half, channels, spatial, k, dst, format);
 }
 
 SIMD_API void * SimdSynetMergedConvolution32fInit(size_t batch, const SimdConvolutionParameters * convs, size_t count, SimdBool add)
 {
     typedef void* (*SimdSynetMergedConvolution32fInitPtr) (size_t batch, const SimdConvolutionParameters * convs, size_t count, SimdBool add);
-    const static SimdSynetMergedConvolution32fInitPtr simdSynetMergedConvolution32fInit = SIMD_FUNC5(SynetMergedConvolution32fInit, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
-
-    return simdSynetMergedConvolution32fInit(batch, convs, count, add);
+    static const auto dispatch = Dispatch<SimdSynetMergedConvolution32fInitPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetMergedConvolution32fInit)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetMergedConvolution32fInit)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetMergedConvolution32fInit)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::SynetMergedConvolution32fInit)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetMergedConvolution32fInit)
+#endif
+        .Add(Base::SynetMergedConvolution32fInit);
+    return dispatch.Get()(batch, convs, count, add);
 }
 
 SIMD_API size_t SimdSynetMergedConvolution32fExternalBufferSize(const void * context)
@@ -5622,9 +6256,21 @@ SIMD_API void SimdSynetMergedConvolution32fForward(void * context, const float *
 SIMD_API void* SimdSynetMergedConvolution8iInit(size_t batch, const SimdConvolutionParameters* convs, size_t count, SimdSynetCompatibilityType compatibility)
 {
     typedef void* (*SimdSynetMergedConvolution8iInitPtr) (size_t batch, const SimdConvolutionParameters* convs, size_t count, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetMergedConvolution8iInitPtr simdSynetMergedConvolution8iInit = SIMD_FUNC4(SynetMergedConvolution8iInit, SIMD_AVX512VNNI_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
-
-    return simdSynetMergedConvolution8iInit(batch, convs, count, compatibility);
+    static const auto dispatch = Dispatch<SimdSynetMergedConvolution8iInitPtr>()
+#ifdef SIMD_AVX512VNNI_ENABLE
+        .Add(Avx512vnni::Enable, Avx512vnni::SynetMergedConvolution8iInit)
+#endif
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::SynetMergedConvolution8iInit)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetMergedConvolution8iInit)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::SynetMergedConvolution8iInit)
+#endif
+        .Add(Base::SynetMergedConvolution8iInit);
+    return dispatch.Get()(batch, convs, count, compatibility);
 }
 
 SIMD_API size_t SimdSynetMergedConvolution8iExternalBufferSize(const void* context)
@@ -5654,12 +6300,55 @@ SIMD_API void SimdSynetMergedConvolution8iForward(void* context, const uint8_t*
     c->Forward(src, buf, dst);
 }
 
+SIMD_API void * SimdSynetWorkspaceInit()
+{
+    return new Base::SynetWorkspace();
+}
+
+SIMD_API size_t SimdSynetWorkspaceAdd(void * workspace, const void * context, SimdSynetLayerType type)
+{
+    size_t size = 0;
+    switch (type)
+    {
+    case SimdSynetLayerConvolution32f: size = ((SynetConvolution32f*)context)->ExternalBufferSize() * sizeof(float); break;
+    case SimdSynetLayerConvolution8i: size = ((SynetConvolution8i*)context)->ExternalBufferSize(); break;
+    case SimdSynetLayerDeconvolution32f: size = ((SynetDeconvolution32f*)context)->ExternalBufferSize() * sizeof(float); break;
+    case SimdSynetLayerMergedConvolution32f: size = ((SynetMergedConvolution32f*)context)->ExternalBufferSize() * sizeof(float); break;
+    case SimdSynetLayerMergedConvolution8i: size = ((SynetMergedConvolution8i*)context)->ExternalBufferSize(); break;
+    default: 
+        return SIZE_MAX;
+    }
+    return ((Base::SynetWorkspace*)workspace)->Add(size);
+}
+
+SIMD_API size_t SimdSynetWorkspaceSize(const void * workspace)
+{
+    return ((const Base::SynetWorkspace*)workspace)->Size();
+}
+
+SIMD_API void * SimdSynetWorkspaceBuffer(void * workspace)
+{
+    return ((Base::SynetWorkspace*)workspace)->Buffer();
+}
+
 SIMD_API void SimdSynetMish32f(const float* src, size_t size, const float* threshold, float* dst)
 {
     typedef void(*SimdSynetMish32fPtr) (const float* src, size_t size, const float* threshold, float* dst);
-    const static SimdSynetMish32fPtr simdSynetMish32f = SIMD_FUNC4(SynetMish32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetMish32f(src, size, threshold, dst);
+    static const auto dispatch = Dispatch<SimdSynetMish32fPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetMish32f)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetMish32f)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::SynetMish32f)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetMish32f)
+#endif
+        .Add(Base::SynetMish32f);
+    dispatch.Get()(src, size, threshold, dst);
 }
 
 void SimdSynetPoolingForwardAverage(const float* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
@@ -5667,9 +6356,21 @@ void SimdSynetPoolingForwardAverage(const float* src, size_t srcC, size_t srcH,
 {
     typedef void(*SimdSynetPoolingForwardAveragePtr) (const float* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
         size_t strideY, size_t strideX, size_t padY, size_t padX, float* dst, size_t dstH, size_t dstW, SimdBool exludePad, SimdTensorFormatType format);
-    const static SimdSynetPoolingForwardAveragePtr simdSynetPoolingForwardAverage = SIMD_FUNC4(SynetPoolingForwardAverage, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetPoolingForwardAverage(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dst, dstH, dstW, excludePad, format);
+    static const auto dispatch = Dispatch<SimdSynetPoolingForwardAveragePtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetPoolingForwardAverage)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetPoolingForwardAverage)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::SynetPoolingForwardAverage)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetPoolingForwardAverage)
+#endif
+        .Add(Base::SynetPoolingForwardAverage);
+    dispatch.Get()(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dst, dstH, dstW, excludePad, format);
 }
 
 SIMD_API void SimdSynetPoolingForwardMax32f(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
@@ -5677,9 +6378,24 @@ SIMD_API void SimdSynetPoolingForwardMax32f(const float * src, size_t srcC, size
 {
     typedef void(*SimdSynetPoolingForwardMax32fPtr) (const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
         size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
-    const static SimdSynetPoolingForwardMax32fPtr simdSynetPoolingForwardMax32f = SIMD_FUNC5(SynetPoolingForwardMax32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetPoolingForwardMax32f(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dst, dstH, dstW, format);
+    static const auto dispatch = Dispatch<SimdSynetPoolingForwardMax32fPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetPoolingForwardMax32f)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetPoolingForwardMax32f)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetPoolingForwardMax32f)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::SynetPoolingForwardMax32f)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetPoolingForwardMax32f)
+#endif
+        .Add(Base::SynetPoolingForwardMax32f);
+    dispatch.Get()(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dst, dstH, dstW, format);
 }
 
 SIMD_API void SimdSynetPoolingForwardMax8u(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
@@ -5687,69 +6403,165 @@ SIMD_API void SimdSynetPoolingForwardMax8u(const uint8_t* src, size_t srcC, size
 {
     typedef void(*SimdSynetPoolingForwardMax8uPtr) (const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
         size_t strideY, size_t strideX, size_t padY, size_t padX, uint8_t* dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
-    const static SimdSynetPoolingForwardMax8uPtr simdSynetPoolingForwardMax8u = SIMD_FUNC4(SynetPoolingForwardMax8u, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetPoolingForwardMax8u(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dst, dstH, dstW, format);
+    static const auto dispatch = Dispatch<SimdSynetPoolingForwardMax8uPtr>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::SynetPoolingForwardMax8u)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetPoolingForwardMax8u)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::SynetPoolingForwardMax8u)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetPoolingForwardMax8u)
+#endif
+        .Add(Base::SynetPoolingForwardMax8u);
+    dispatch.Get()(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dst, dstH, dstW, format);
 }
 
 SIMD_API void SimdSynetPreluLayerForward(const float * src, const float * slope, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format)
 {
     typedef void(*SimdSynetPreluLayerForwardPtr) (const float * src, const float * slope, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
-    const static SimdSynetPreluLayerForwardPtr simdSynetPreluLayerForward = SIMD_FUNC4(SynetPreluLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetPreluLayerForward(src, slope, channels, spatial, dst, format);
+    static const auto dispatch = Dispatch<SimdSynetPreluLayerForwardPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetPreluLayerForward)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetPreluLayerForward)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::SynetPreluLayerForward)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetPreluLayerForward)
+#endif
+        .Add(Base::SynetPreluLayerForward);
+    dispatch.Get()(src, slope, channels, spatial, dst, format);
 }
 
 SIMD_API void SimdSynetRelu32f(const float* src, size_t size, const float* slope, float* dst)
 {
     typedef void(*SimdSynetRelu32fPtr) (const float* src, size_t size, const float* slope, float* dst);
-    const static SimdSynetRelu32fPtr simdSynetRelu32f = SIMD_FUNC4(SynetRelu32f, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetRelu32f(src, size, slope, dst);
+    static const auto dispatch = Dispatch<SimdSynetRelu32fPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetRelu32f)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetRelu32f)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::SynetRelu32f)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetRelu32f)
+#endif
+        .Add(Base::SynetRelu32f);
+    dispatch.Get()(src, size, slope, dst);
 }
 
 SIMD_API void SimdSynetReorderImage(size_t batch, size_t channels, size_t spatial, const float* src, SimdTensorFormatType srcFormat, float* dst, SimdTensorFormatType dstFormat)
 {
     typedef void(*SimdSynetReorderImagePtr) (size_t batch, size_t channels, size_t spatial, const float* src, SimdTensorFormatType srcFormat, float* dst, SimdTensorFormatType dstFormat);
-    const static SimdSynetReorderImagePtr simdSynetReorderImage = SIMD_FUNC4(SynetReorderImage, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetReorderImage(batch, channels, spatial, src, srcFormat, dst, dstFormat);
+    static const auto dispatch = Dispatch<SimdSynetReorderImagePtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetReorderImage)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetReorderImage)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::SynetReorderImage)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetReorderImage)
+#endif
+        .Add(Base::SynetReorderImage);
+    dispatch.Get()(batch, channels, spatial, src, srcFormat, dst, dstFormat);
 }
 
 SIMD_API void SimdSynetReorderFilter(size_t output, size_t input, size_t kernel, const float* src, SimdTensorFormatType srcFormat, float* dst, SimdTensorFormatType dstFormat)
 {
     typedef void(*SimdSynetReorderFilterPtr) (size_t output, size_t input, size_t kernel, const float* src, SimdTensorFormatType srcFormat, float* dst, SimdTensorFormatType dstFormat);
-    const static SimdSynetReorderFilterPtr simdSynetReorderFilter = SIMD_FUNC4(SynetReorderFilter, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetReorderFilter(output, input, kernel, src, srcFormat, dst, dstFormat);
+    static const auto dispatch = Dispatch<SimdSynetReorderFilterPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetReorderFilter)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetReorderFilter)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::SynetReorderFilter)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetReorderFilter)
+#endif
+        .Add(Base::SynetReorderFilter);
+    dispatch.Get()(output, input, kernel, src, srcFormat, dst, dstFormat);
 }
 
 SIMD_API void SimdSynetRestrictRange32f(const float * src, size_t size, const float * lower, const float * upper, float * dst)
 {
     typedef void(*SimdSynetRestrictRange32fPtr) (const float * src, size_t size, const float * lower, const float * upper, float * dst);
-    const static SimdSynetRestrictRange32fPtr simdSynetRestrictRange32f = SIMD_FUNC4(SynetRestrictRange32f, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetRestrictRange32f(src, size, lower, upper, dst);
+    static const auto dispatch = Dispatch<SimdSynetRestrictRange32fPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetRestrictRange32f)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetRestrictRange32f)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::SynetRestrictRange32f)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetRestrictRange32f)
+#endif
+        .Add(Base::SynetRestrictRange32f);
+    dispatch.Get()(src, size, lower, upper, dst);
 }
 
 SIMD_API void SimdSynetScaleLayerForward(const float* src, const float* scale, const float* bias, size_t channels, size_t height, size_t width, float* dst, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility)
 {
     typedef void(*SimdSynetScaleLayerForwardPtr) (const float* src, const float* scale, const float* bias, size_t channels, size_t height, size_t width, float* dst, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetScaleLayerForwardPtr simdSynetScaleLayerForward = SIMD_FUNC5(SynetScaleLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetScaleLayerForward(src, scale, bias, channels, height, width, dst, format, compatibility);
+    static const auto dispatch = Dispatch<SimdSynetScaleLayerForwardPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetScaleLayerForward)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetScaleLayerForward)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetScaleLayerForward)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::SynetScaleLayerForward)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetScaleLayerForward)
+#endif
+        .Add(Base::SynetScaleLayerForward);
+    dispatch.Get()(src, scale, bias, channels, height, width, dst, format, compatibility);
 }
 
 SIMD_API void* SimdSynetScale8iInit(size_t batch, size_t channels, size_t spatial, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility)
 {
     typedef void* (*SimdSynetScale8iInitPtr) (size_t batch, size_t channels, size_t spatial, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetScale8iInitPtr simdSynetScale8iInit = SIMD_FUNC3(SynetScale8iInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
-
-    return simdSynetScale8iInit(batch, channels, spatial, srcType, dstType, format, compatibility);
-}
-
-SIMD_API size_t SimdSynetScale8iInternalBufferSize(const void* context)
-{
+    static const auto dispatch = Dispatch<SimdSynetScale8iInitPtr>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::SynetScale8iInit)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetScale8iInit)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::SynetScale8iInit)
+#endif
+        .Add(Base::SynetScale8iInit);
+    return dispatch.Get()(batch, channels, spatial, srcType, dstType, format, compatibility);
+}
+
+SIMD_API size_t SimdSynetScale8iInternalBufferSize(const void* context)
+{
     return ((Base::SynetScale8i*)context)->InternalBufferSize();
 }
 
@@ -5763,62 +6575,155 @@ SIMD_API void SimdSynetScale8iForward(void* context, const uint8_t* src, uint8_t
     ((Base::SynetScale8i*)context)->Forward(src, dst);
 }
 
+static Base::SynetSetInputRowsPtr SynetSetInputRows(size_t width)
+{
+    static const auto dispatch = Dispatch<Base::SynetSetInputRowsPtr>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::SynetSetInputRows, Avx512bw::A)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetSetInputRows, Avx2::A)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::SynetSetInputRows, Sse41::A)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetSetInputRows, Neon::A)
+#endif
+        .Add(Base::SynetSetInputRows);
+    return dispatch.Get(width);
+}
+
 SIMD_API void SimdSynetSetInput(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
     const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat)
 {
+    SynetSetInputRows(width)(src, width, height, stride, srcFormat, lower, upper, dst, width * height, channels, dstFormat);
+}
+
+SIMD_API void * SimdSynetSetInputInit(size_t srcWidth, size_t srcHeight, SimdPixelFormatType srcFormat, size_t dstWidth, size_t dstHeight,
+    const float * lower, const float * upper, size_t channels, SimdTensorFormatType dstFormat, SimdResizeMethodType method, SimdBool letterbox, uint8_t padding)
+{
+    return Base::SynetSetInputInit(srcWidth, srcHeight, srcFormat, dstWidth, dstHeight, lower, upper, channels, dstFormat, method, letterbox, padding,
+        SimdResizerInit, SynetSetInputRows(dstWidth));
+}
+
+SIMD_API void SimdSynetSetInputRun(const void * context, const uint8_t * src, size_t srcStride, float * dst)
+{
+    ((Base::SynetSetInputContext*)context)->Run(src, srcStride, dst);
+}
+
+SIMD_API size_t SimdSynetSetInputRunRows(const void * context, const uint8_t * src, size_t srcStride, size_t srcRowBeg, size_t srcRowEnd, float * dst)
+{
+    return ((Base::SynetSetInputContext*)context)->RunRows(src, srcStride, srcRowBeg, srcRowEnd, dst);
+}
+
+SIMD_API void SimdSynetSetInputBatch(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+    const float * rois, size_t count, size_t dstWidth, size_t dstHeight, const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat)
+{
+    typedef void(*SimdSynetSetInputBatchPtr) (const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+        const float * rois, size_t count, size_t dstWidth, size_t dstHeight, const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat);
+    static const auto dispatch = Dispatch<SimdSynetSetInputBatchPtr>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::A)
-        Avx512bw::SynetSetInput(src, width, height, stride, srcFormat, lower, upper, dst, channels, dstFormat);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::SynetSetInputBatch)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::SynetSetInput(src, width, height, stride, srcFormat, lower, upper, dst, channels, dstFormat);
-    else
+        .Add(Avx2::Enable, Avx2::SynetSetInputBatch)
 #endif
 #ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::SynetSetInput(src, width, height, stride, srcFormat, lower, upper, dst, channels, dstFormat);
-    else
+        .Add(Sse41::Enable, Sse41::SynetSetInputBatch)
 #endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::SynetSetInput(src, width, height, stride, srcFormat, lower, upper, dst, channels, dstFormat);
+        .Add(Base::SynetSetInputBatch);
+    auto synetSetInputBatch = dispatch.Get();
+    size_t threads = Base::GetThreadNumber(), size = dstWidth * dstHeight * channels;
+    if (count < 2 || threads < 2 || count * size < Base::GetParallelThreshold())
+        synetSetInputBatch(src, width, height, stride, srcFormat, rois, count, dstWidth, dstHeight, lower, upper, dst, channels, dstFormat);
     else
-#endif
-        Base::SynetSetInput(src, width, height, stride, srcFormat, lower, upper, dst, channels, dstFormat);
+    {
+        Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+        {
+            synetSetInputBatch(src, width, height, stride, srcFormat, rois + 4 * begin, end - begin, dstWidth, dstHeight, lower, upper, dst + size * begin, channels, dstFormat);
+        }, threads);
+    }
 }
 
 SIMD_API void SimdSynetShuffleLayerForward(const float* src0, const float* src1, size_t channels0, size_t channels1, size_t spatial, float* dst0, float* dst1, SimdTensorFormatType format, int type)
 {
     typedef void(*SimdSynetShuffleLayerForwardPtr) (const float* src0, const float* src1, size_t channels0, size_t channels1, size_t spatial, float* dst0, float* dst1, SimdTensorFormatType format, int type);
-    const static SimdSynetShuffleLayerForwardPtr simdSynetShuffleLayerForward = SIMD_FUNC4(SynetShuffleLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetShuffleLayerForward(src0, src1, channels0, channels1, spatial, dst0, dst1, format, type);
+    static const auto dispatch = Dispatch<SimdSynetShuffleLayerForwardPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetShuffleLayerForward)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::SynetShuffleLayerForward)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::SynetShuffleLayerForward)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetShuffleLayerForward)
+#endif
+        .Add(Base::SynetShuffleLayerForward);
+    dispatch.Get()(src0, src1, channels0, channels1, spatial, dst0, dst1, format, type);
 }
 
 SIMD_API void SimdSynetSigmoid32f(const float* src, size_t size, const float* slope, float* dst)
 {
     typedef void(*SimdSynetSigmoid32fPtr) (const float* src, size_t size, const float* slope, float* dst);
-    const static SimdSynetSigmoid32fPtr simdSynetSigmoid32f = SIMD_FUNC4(SynetSigmoid32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetSigmoid32f(src, size, slope, dst);
+    static const auto dispatch = Dispatch<SimdSynetSigmoid32fPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetSigmoid32f)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetSigmoid32f)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::SynetSigmoid32f)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetSigmoid32f)
+#endif
+        .Add(Base::SynetSigmoid32f);
+    dispatch.Get()(src, size, slope, dst);
 }
 
 SIMD_API void SimdSynetSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst)
 {
     typedef void(*SimdSynetSoftmaxLayerForwardPtr) (const float * src, size_t outer, size_t count, size_t inner, float * dst);
-    const static SimdSynetSoftmaxLayerForwardPtr simdSynetSoftmaxLayerForward = SIMD_FUNC4(SynetSoftmaxLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetSoftmaxLayerForward(src, outer, count, inner, dst);
+    static const auto dispatch = Dispatch<SimdSynetSoftmaxLayerForwardPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetSoftmaxLayerForward)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetSoftmaxLayerForward)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::SynetSoftmaxLayerForward)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetSoftmaxLayerForward)
+#endif
+        .Add(Base::SynetSoftmaxLayerForward);
+    dispatch.Get()(src, outer, count, inner, dst);
 }
 
 SIMD_API void SimdSynetSoftplus32f(const float* src, size_t size, const float* beta, const float* threshold, float* dst)
 {
     typedef void(*SimdSynetSoftplus32fPtr) (const float* src, size_t size, const float* beta, const float* threshold, float* dst);
-    const static SimdSynetSoftplus32fPtr simdSynetSoftplus32f = SIMD_FUNC4(SynetSoftplus32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetSoftplus32f(src, size, beta, threshold, dst);
+    static const auto dispatch = Dispatch<SimdSynetSoftplus32fPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetSoftplus32f)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetSoftplus32f)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::SynetSoftplus32f)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetSoftplus32f)
+#endif
+        .Add(Base::SynetSoftplus32f);
+    dispatch.Get()(src, size, beta, threshold, dst);
 }
 
 SIMD_API SimdTensorFormatType SimdSynetSpecifyTensorFormat(SimdTensorFormatType format)
@@ -5829,9 +6734,21 @@ SIMD_API SimdTensorFormatType SimdSynetSpecifyTensorFormat(SimdTensorFormatType
 SIMD_API void SimdSynetTanh32f(const float* src, size_t size, const float* slope, float* dst)
 {
     typedef void(*SimdSynetTanh32fPtr) (const float* src, size_t size, const float* slope, float* dst);
-    const static SimdSynetTanh32fPtr simdSynetTanh32f = SIMD_FUNC4(SynetTanh32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetTanh32f(src, size, slope, dst);
+    static const auto dispatch = Dispatch<SimdSynetTanh32fPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetTanh32f)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetTanh32f)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::SynetTanh32f)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetTanh32f)
+#endif
+        .Add(Base::SynetTanh32f);
+    dispatch.Get()(src, size, slope, dst);
 }
 
 
@@ -5843,153 +6760,150 @@ SIMD_API size_t SimdSynetTensorAlignment(SimdTensorFormatType format)
 SIMD_API void SimdSynetUnaryOperation32fLayerForward(const float* src, size_t size, SimdSynetUnaryOperation32fType type, float* dst)
 {
     typedef void(*SimdSynetUnaryOperation32fLayerForwardPtr) (const float* src, size_t size, SimdSynetUnaryOperation32fType type, float* dst);
-    const static SimdSynetUnaryOperation32fLayerForwardPtr simdSynetUnaryOperation32fLayerForward = SIMD_FUNC4(SynetUnaryOperation32fLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetUnaryOperation32fLayerForward(src, size, type, dst);
+    static const auto dispatch = Dispatch<SimdSynetUnaryOperation32fLayerForwardPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::SynetUnaryOperation32fLayerForward)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::SynetUnaryOperation32fLayerForward)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::SynetUnaryOperation32fLayerForward)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::SynetUnaryOperation32fLayerForward)
+#endif
+        .Add(Base::SynetUnaryOperation32fLayerForward);
+    dispatch.Get()(src, size, type, dst);
 }
 
 SIMD_API void SimdTextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                      uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::TextureBoostedSaturatedGradient)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::TextureBoostedSaturatedGradient)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
-    else
+        .Add(Avx2::Enable, Avx2::TextureBoostedSaturatedGradient, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::TextureBoostedSaturatedGradient, Ssse3::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
-    else
+        .Add(Sse2::Enable, Sse2::TextureBoostedSaturatedGradient, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
-    else
+        .Add(Vmx::Enable, Vmx::TextureBoostedSaturatedGradient, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
-    else
+        .Add(Neon::Enable, Neon::TextureBoostedSaturatedGradient, Neon::A)
 #endif
-        Base::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
+        .Add(Base::TextureBoostedSaturatedGradient);
+    dispatch.Get(width)(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
 }
 
 SIMD_API void SimdTextureBoostedUv(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                       uint8_t boost, uint8_t * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::TextureBoostedUv)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::TextureBoostedUv)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::TextureBoostedUv, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::TextureBoostedUv, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::TextureBoostedUv, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::TextureBoostedUv, Neon::A)
 #endif
-        Base::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
+        .Add(Base::TextureBoostedUv);
+    dispatch.Get(width)(src, srcStride, width, height, boost, dst, dstStride);
 }
 
 SIMD_API void SimdTextureGetDifferenceSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                              const uint8_t * lo, size_t loStride, const uint8_t * hi, size_t hiStride, int64_t * sum)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::TextureGetDifferenceSum)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::TextureGetDifferenceSum)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
-    else
+        .Add(Avx2::Enable, Avx2::TextureGetDifferenceSum, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
-    else
+        .Add(Sse2::Enable, Sse2::TextureGetDifferenceSum, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
-    else
+        .Add(Vmx::Enable, Vmx::TextureGetDifferenceSum, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
-    else
+        .Add(Neon::Enable, Neon::TextureGetDifferenceSum, Neon::A)
 #endif
-        Base::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
+        .Add(Base::TextureGetDifferenceSum);
+    dispatch.Get(width)(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
 }
 
 SIMD_API void SimdTexturePerformCompensation(const uint8_t * src, size_t srcStride, size_t width, size_t height,
     int32_t shift, uint8_t * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::TexturePerformCompensation)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::TexturePerformCompensation)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
-    else
+        .Add(Avx2::Enable, Avx2::TexturePerformCompensation, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
-    else
+        .Add(Sse2::Enable, Sse2::TexturePerformCompensation, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if (Vmx::Enable && width >= Vmx::A)
-        Vmx::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
-    else
+        .Add(Vmx::Enable, Vmx::TexturePerformCompensation, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::TexturePerformCompensation, Neon::A)
 #endif
-        Base::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
+        .Add(Base::TexturePerformCompensation);
+    dispatch.Get(width)(src, srcStride, width, height, shift, dst, dstStride);
 }
 
 SIMD_API void SimdTransformImage(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, SimdTransformType transform, uint8_t * dst, size_t dstStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::TransformImage)>()
 #ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::TransformImage(src, srcStride, width, height, pixelSize, transform, dst, dstStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::TransformImage, Ssse3::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::TransformImage(src, srcStride, width, height, pixelSize, transform, dst, dstStride);
-    else
+        .Add(Neon::Enable, Neon::TransformImage, Neon::HA)
+#endif
+        .Add(Base::TransformImage);
+    dispatch.Get(width)(src, srcStride, width, height, pixelSize, transform, dst, dstStride);
+}
+
+SIMD_API void * SimdWarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::WarpAffineInit)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::WarpAffineInit)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::WarpAffineInit)
 #endif
-        Base::TransformImage(src, srcStride, width, height, pixelSize, transform, dst, dstStride);
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::WarpAffineInit)
+#endif
+        .Add(Base::WarpAffineInit);
+    return dispatch.Get()(srcW, srcH, srcS, dstW, dstH, dstS, channels, mat, flags, border);
+}
+
+SIMD_API void SimdWarpAffineRun(const void * context, const uint8_t * src, uint8_t * dst)
+{
+    ((WarpAffine*)context)->Run(src, dst);
 }
 
 typedef void(*SimdWinogradSetFilterPtr) (const float * src, size_t size, float * dst, SimdBool trans);
@@ -5998,368 +6912,815 @@ typedef void(*SimdWinogradSetOutputPtr) (const float * src, size_t srcStride, fl
 
 SIMD_API void SimdWinogradKernel1x3Block1x4SetFilter(const float* src, size_t size, float* dst, SimdBool trans)
 {
-    const static SimdWinogradSetFilterPtr simdWinogradKernel1x3Block1x4SetFilter = SIMD_FUNC4(WinogradKernel1x3Block1x4SetFilter, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdWinogradKernel1x3Block1x4SetFilter(src, size, dst, trans);
+    static const auto dispatch = Dispatch<SimdWinogradSetFilterPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::WinogradKernel1x3Block1x4SetFilter)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::WinogradKernel1x3Block1x4SetFilter)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::WinogradKernel1x3Block1x4SetFilter)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::WinogradKernel1x3Block1x4SetFilter)
+#endif
+        .Add(Base::WinogradKernel1x3Block1x4SetFilter);
+    dispatch.Get()(src, size, dst, trans);
 }
 
 SIMD_API void SimdWinogradKernel1x3Block1x4SetInput(const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth,
     size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans)
 {
-    const static SimdWinogradSetInputPtr simdWinogradKernel1x3Block1x4SetInput = SIMD_FUNC4(WinogradKernel1x3Block1x4SetInput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdWinogradKernel1x3Block1x4SetInput(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
+    static const auto dispatch = Dispatch<SimdWinogradSetInputPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::WinogradKernel1x3Block1x4SetInput)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::WinogradKernel1x3Block1x4SetInput)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::WinogradKernel1x3Block1x4SetInput)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::WinogradKernel1x3Block1x4SetInput)
+#endif
+        .Add(Base::WinogradKernel1x3Block1x4SetInput);
+    dispatch.Get()(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
 }
 
 SIMD_API void SimdWinogradKernel1x3Block1x4SetOutput(const float* src, size_t srcStride, float* dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
 {
-    const static SimdWinogradSetOutputPtr simdWinogradKernel1x3Block1x4SetOutput = SIMD_FUNC4(WinogradKernel1x3Block1x4SetOutput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdWinogradKernel1x3Block1x4SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
+    static const auto dispatch = Dispatch<SimdWinogradSetOutputPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::WinogradKernel1x3Block1x4SetOutput)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::WinogradKernel1x3Block1x4SetOutput)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::WinogradKernel1x3Block1x4SetOutput)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::WinogradKernel1x3Block1x4SetOutput)
+#endif
+        .Add(Base::WinogradKernel1x3Block1x4SetOutput);
+    dispatch.Get()(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
 }
 
 SIMD_API void SimdWinogradKernel1x5Block1x4SetFilter(const float* src, size_t size, float* dst, SimdBool trans)
 {
-    const static SimdWinogradSetFilterPtr simdWinogradKernel1x5Block1x4SetFilter = SIMD_FUNC4(WinogradKernel1x5Block1x4SetFilter, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdWinogradKernel1x5Block1x4SetFilter(src, size, dst, trans);
+    static const auto dispatch = Dispatch<SimdWinogradSetFilterPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::WinogradKernel1x5Block1x4SetFilter)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::WinogradKernel1x5Block1x4SetFilter)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::WinogradKernel1x5Block1x4SetFilter)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::WinogradKernel1x5Block1x4SetFilter)
+#endif
+        .Add(Base::WinogradKernel1x5Block1x4SetFilter);
+    dispatch.Get()(src, size, dst, trans);
 }
 
 SIMD_API void SimdWinogradKernel1x5Block1x4SetInput(const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth,
     size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans)
 {
-    const static SimdWinogradSetInputPtr simdWinogradKernel1x5Block1x4SetInput = SIMD_FUNC4(WinogradKernel1x5Block1x4SetInput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdWinogradKernel1x5Block1x4SetInput(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
+    static const auto dispatch = Dispatch<SimdWinogradSetInputPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::WinogradKernel1x5Block1x4SetInput)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::WinogradKernel1x5Block1x4SetInput)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::WinogradKernel1x5Block1x4SetInput)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::WinogradKernel1x5Block1x4SetInput)
+#endif
+        .Add(Base::WinogradKernel1x5Block1x4SetInput);
+    dispatch.Get()(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
 }
 
 SIMD_API void SimdWinogradKernel1x5Block1x4SetOutput(const float* src, size_t srcStride, float* dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
 {
-    const static SimdWinogradSetOutputPtr simdWinogradKernel1x5Block1x4SetOutput = SIMD_FUNC4(WinogradKernel1x5Block1x4SetOutput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdWinogradKernel1x5Block1x4SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
+    static const auto dispatch = Dispatch<SimdWinogradSetOutputPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::WinogradKernel1x5Block1x4SetOutput)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::WinogradKernel1x5Block1x4SetOutput)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::WinogradKernel1x5Block1x4SetOutput)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::WinogradKernel1x5Block1x4SetOutput)
+#endif
+        .Add(Base::WinogradKernel1x5Block1x4SetOutput);
+    dispatch.Get()(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
 }
 
 SIMD_API void SimdWinogradKernel2x2Block2x2SetFilter(const float* src, size_t size, float* dst, SimdBool trans)
 {
-    const static SimdWinogradSetFilterPtr simdWinogradKernel2x2Block2x2SetFilter = SIMD_FUNC4(WinogradKernel2x2Block2x2SetFilter, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdWinogradKernel2x2Block2x2SetFilter(src, size, dst, trans);
+    static const auto dispatch = Dispatch<SimdWinogradSetFilterPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::WinogradKernel2x2Block2x2SetFilter)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::WinogradKernel2x2Block2x2SetFilter)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::WinogradKernel2x2Block2x2SetFilter)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::WinogradKernel2x2Block2x2SetFilter)
+#endif
+        .Add(Base::WinogradKernel2x2Block2x2SetFilter);
+    dispatch.Get()(src, size, dst, trans);
 }
 
 SIMD_API void SimdWinogradKernel2x2Block2x2SetInput(const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth,
     size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans)
 {
-    const static SimdWinogradSetInputPtr simdWinogradKernel2x2Block2x2SetInput = SIMD_FUNC4(WinogradKernel2x2Block2x2SetInput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdWinogradKernel2x2Block2x2SetInput(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
+    static const auto dispatch = Dispatch<SimdWinogradSetInputPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::WinogradKernel2x2Block2x2SetInput)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::WinogradKernel2x2Block2x2SetInput)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::WinogradKernel2x2Block2x2SetInput)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::WinogradKernel2x2Block2x2SetInput)
+#endif
+        .Add(Base::WinogradKernel2x2Block2x2SetInput);
+    dispatch.Get()(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
 }
 
 SIMD_API void SimdWinogradKernel2x2Block2x2SetOutput(const float* src, size_t srcStride, float* dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
 {
-    const static SimdWinogradSetOutputPtr simdWinogradKernel2x2Block2x2SetOutput = SIMD_FUNC4(WinogradKernel2x2Block2x2SetOutput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdWinogradKernel2x2Block2x2SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
+    static const auto dispatch = Dispatch<SimdWinogradSetOutputPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::WinogradKernel2x2Block2x2SetOutput)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::WinogradKernel2x2Block2x2SetOutput)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::WinogradKernel2x2Block2x2SetOutput)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::WinogradKernel2x2Block2x2SetOutput)
+#endif
+        .Add(Base::WinogradKernel2x2Block2x2SetOutput);
+    dispatch.Get()(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
 }
 
 SIMD_API void SimdWinogradKernel2x2Block4x4SetFilter(const float* src, size_t size, float* dst, SimdBool trans)
 {
-    const static SimdWinogradSetFilterPtr simdWinogradKernel2x2Block4x4SetFilter = SIMD_FUNC4(WinogradKernel2x2Block4x4SetFilter, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdWinogradKernel2x2Block4x4SetFilter(src, size, dst, trans);
+    static const auto dispatch = Dispatch<SimdWinogradSetFilterPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::WinogradKernel2x2Block4x4SetFilter)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::WinogradKernel2x2Block4x4SetFilter)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::WinogradKernel2x2Block4x4SetFilter)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::WinogradKernel2x2Block4x4SetFilter)
+#endif
+        .Add(Base::WinogradKernel2x2Block4x4SetFilter);
+    dispatch.Get()(src, size, dst, trans);
 }
 
 SIMD_API void SimdWinogradKernel2x2Block4x4SetInput(const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth,
     size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans)
 {
-    const static SimdWinogradSetInputPtr simdWinogradKernel2x2Block4x4SetInput = SIMD_FUNC4(WinogradKernel2x2Block4x4SetInput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdWinogradKernel2x2Block4x4SetInput(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
+    static const auto dispatch = Dispatch<SimdWinogradSetInputPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::WinogradKernel2x2Block4x4SetInput)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::WinogradKernel2x2Block4x4SetInput)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::WinogradKernel2x2Block4x4SetInput)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::WinogradKernel2x2Block4x4SetInput)
+#endif
+        .Add(Base::WinogradKernel2x2Block4x4SetInput);
+    dispatch.Get()(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
 }
 
 SIMD_API void SimdWinogradKernel2x2Block4x4SetOutput(const float* src, size_t srcStride, float* dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
 {
-    const static SimdWinogradSetOutputPtr simdWinogradKernel2x2Block4x4SetOutput = SIMD_FUNC4(WinogradKernel2x2Block4x4SetOutput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdWinogradKernel2x2Block4x4SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
+    static const auto dispatch = Dispatch<SimdWinogradSetOutputPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::WinogradKernel2x2Block4x4SetOutput)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::WinogradKernel2x2Block4x4SetOutput)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::WinogradKernel2x2Block4x4SetOutput)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::WinogradKernel2x2Block4x4SetOutput)
+#endif
+        .Add(Base::WinogradKernel2x2Block4x4SetOutput);
+    dispatch.Get()(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
 }
 
 SIMD_API void SimdWinogradKernel3x3Block2x2SetFilter(const float * src, size_t size, float * dst, SimdBool trans)
 {
-    const static SimdWinogradSetFilterPtr simdWinogradKernel3x3Block2x2SetFilter = SIMD_FUNC4(WinogradKernel3x3Block2x2SetFilter, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdWinogradKernel3x3Block2x2SetFilter(src, size, dst, trans);
-}
-
-SIMD_API void SimdWinogradKernel3x3Block2x2SetInput(const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth,
-    size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans)
-{
-    const static SimdWinogradSetInputPtr simdWinogradKernel3x3Block2x2SetInput = SIMD_FUNC4(WinogradKernel3x3Block2x2SetInput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdWinogradKernel3x3Block2x2SetInput(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
+    static const auto dispatch = Dispatch<SimdWinogradSetFilterPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::WinogradKernel3x3Block2x2SetFilter)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::WinogradKernel3x3Block2x2SetFilter)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::WinogradKernel3x3Block2x2SetFilter)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::WinogradKernel3x3Block2x2SetFilter)
+#endif
+        .Add(Base::WinogradKernel3x3Block2x2SetFilter);
+    dispatch.Get()(src, size, dst, trans);
 }
 
-SIMD_API void SimdWinogradKernel3x3Block2x2SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
+SIMD_API void SimdWinogradKernel3x3Block2x2SetInput(const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth,
+    size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans)
 {
-    const static SimdWinogradSetOutputPtr simdWinogradKernel3x3Block2x2SetOutput = SIMD_FUNC4(WinogradKernel3x3Block2x2SetOutput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+    static const auto dispatch = Dispatch<SimdWinogradSetInputPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::WinogradKernel3x3Block2x2SetInput)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::WinogradKernel3x3Block2x2SetInput)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::WinogradKernel3x3Block2x2SetInput)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::WinogradKernel3x3Block2x2SetInput)
+#endif
+        .Add(Base::WinogradKernel3x3Block2x2SetInput);
+    dispatch.Get()(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
+}
 
-    simdWinogradKernel3x3Block2x2SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
+SIMD_API void SimdWinogradKernel3x3Block2x2SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
+{
+    static const auto dispatch = Dispatch<SimdWinogradSetOutputPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::WinogradKernel3x3Block2x2SetOutput)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::WinogradKernel3x3Block2x2SetOutput)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::WinogradKernel3x3Block2x2SetOutput)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::WinogradKernel3x3Block2x2SetOutput)
+#endif
+        .Add(Base::WinogradKernel3x3Block2x2SetOutput);
+    dispatch.Get()(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
 }
 
 SIMD_API void SimdWinogradKernel3x3Block3x3SetFilter(const float * src, size_t size, float * dst, SimdBool trans)
 {
-    const static SimdWinogradSetFilterPtr simdWinogradKernel3x3Block3x3SetFilter = SIMD_FUNC4(WinogradKernel3x3Block3x3SetFilter, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdWinogradKernel3x3Block3x3SetFilter(src, size, dst, trans);
+    static const auto dispatch = Dispatch<SimdWinogradSetFilterPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::WinogradKernel3x3Block3x3SetFilter)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::WinogradKernel3x3Block3x3SetFilter)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::WinogradKernel3x3Block3x3SetFilter)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::WinogradKernel3x3Block3x3SetFilter)
+#endif
+        .Add(Base::WinogradKernel3x3Block3x3SetFilter);
+    dispatch.Get()(src, size, dst, trans);
 }
 
 SIMD_API void SimdWinogradKernel3x3Block3x3SetInput(const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth,
     size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans)
 {
-    const static SimdWinogradSetInputPtr simdWinogradKernel3x3Block3x3SetInput = SIMD_FUNC4(WinogradKernel3x3Block3x3SetInput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC); 
-
-    simdWinogradKernel3x3Block3x3SetInput(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
+    static const auto dispatch = Dispatch<SimdWinogradSetInputPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::WinogradKernel3x3Block3x3SetInput)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::WinogradKernel3x3Block3x3SetInput)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::WinogradKernel3x3Block3x3SetInput)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::WinogradKernel3x3Block3x3SetInput)
+#endif
+        .Add(Base::WinogradKernel3x3Block3x3SetInput);
+    dispatch.Get()(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
 }
 
 SIMD_API void SimdWinogradKernel3x3Block3x3SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
 {
-    const static SimdWinogradSetOutputPtr simdWinogradKernel3x3Block3x3SetOutput = SIMD_FUNC4(WinogradKernel3x3Block3x3SetOutput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdWinogradKernel3x3Block3x3SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
+    static const auto dispatch = Dispatch<SimdWinogradSetOutputPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::WinogradKernel3x3Block3x3SetOutput)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::WinogradKernel3x3Block3x3SetOutput)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::WinogradKernel3x3Block3x3SetOutput)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::WinogradKernel3x3Block3x3SetOutput)
+#endif
+        .Add(Base::WinogradKernel3x3Block3x3SetOutput);
+    dispatch.Get()(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
 }
 
 SIMD_API void SimdWinogradKernel3x3Block4x4SetFilter(const float * src, size_t size, float * dst, SimdBool trans)
 {
-    const static SimdWinogradSetFilterPtr simdWinogradKernel3x3Block4x4SetFilter = SIMD_FUNC4(WinogradKernel3x3Block4x4SetFilter, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdWinogradKernel3x3Block4x4SetFilter(src, size, dst, trans);
+    static const auto dispatch = Dispatch<SimdWinogradSetFilterPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::WinogradKernel3x3Block4x4SetFilter)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::WinogradKernel3x3Block4x4SetFilter)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::WinogradKernel3x3Block4x4SetFilter)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::WinogradKernel3x3Block4x4SetFilter)
+#endif
+        .Add(Base::WinogradKernel3x3Block4x4SetFilter);
+    dispatch.Get()(src, size, dst, trans);
 }
 
 SIMD_API void SimdWinogradKernel3x3Block4x4SetInput(const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth,
     size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans)
 {
-    const static SimdWinogradSetInputPtr simdWinogradKernel3x3Block4x4SetInput = SIMD_FUNC4(WinogradKernel3x3Block4x4SetInput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-    simdWinogradKernel3x3Block4x4SetInput(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
+    static const auto dispatch = Dispatch<SimdWinogradSetInputPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::WinogradKernel3x3Block4x4SetInput)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::WinogradKernel3x3Block4x4SetInput)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::WinogradKernel3x3Block4x4SetInput)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::WinogradKernel3x3Block4x4SetInput)
+#endif
+        .Add(Base::WinogradKernel3x3Block4x4SetInput);
+    dispatch.Get()(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
 }
 
 SIMD_API void SimdWinogradKernel3x3Block4x4SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
 {
-    const static SimdWinogradSetOutputPtr simdWinogradKernel3x3Block4x4SetOutput = SIMD_FUNC4(WinogradKernel3x3Block4x4SetOutput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+    static const auto dispatch = Dispatch<SimdWinogradSetOutputPtr>()
+#ifdef SIMD_AVX512F_ENABLE
+        .Add(Avx512f::Enable, Avx512f::WinogradKernel3x3Block4x4SetOutput)
+#endif
+#ifdef SIMD_AVX_ENABLE
+        .Add(Avx::Enable, Avx::WinogradKernel3x3Block4x4SetOutput)
+#endif
+#ifdef SIMD_SSE_ENABLE
+        .Add(Sse::Enable, Sse::WinogradKernel3x3Block4x4SetOutput)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::WinogradKernel3x3Block4x4SetOutput)
+#endif
+        .Add(Base::WinogradKernel3x3Block4x4SetOutput);
+    dispatch.Get()(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
+}
 
-    simdWinogradKernel3x3Block4x4SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
+static void Yuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Yuva420pToBgra)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::Yuva420pToBgra)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::Yuva420pToBgra, Avx2::DA)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::Yuva420pToBgra, Sse2::DA)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::Yuva420pToBgra, Neon::DA)
+#endif
+        .Add(Base::Yuva420pToBgra);
+    dispatch.Get(width)(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
 }
 
 SIMD_API void SimdYuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
     const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride)
 {
+    ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+    {
+        Yuva420pToBgra(y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, a + begin * aStride, aStride, width, end - begin, bgra + begin * bgraStride, bgraStride);
+    });
+}
+
+static void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+           size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Yuv420pToBgr)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuva420pToBgra(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Yuv420pToBgr)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuva420pToBgra(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
-    else
+        .Add(Avx2::Enable, Avx2::Yuv420pToBgr, Avx2::DA)
 #endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::DA)
-        Sse2::Yuva420pToBgra(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
-    else
+#ifdef SIMD_SSSE3_ENABLE
+        .Add(Ssse3::Enable, Ssse3::Yuv420pToBgr, Ssse3::DA)
+#endif
+#ifdef SIMD_VMX_ENABLE
+        .Add(Vmx::Enable, Vmx::Yuv420pToBgr, Vmx::DA)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuva420pToBgra(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
-    else
+        .Add(Neon::Enable, Neon::Yuv420pToBgr, Neon::DA)
 #endif
-        Base::Yuva420pToBgra(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
+        .Add(Base::Yuv420pToBgr);
+    dispatch.Get(width)(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
 }
 
 SIMD_API void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
+    ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+    {
+        Yuv420pToBgr(y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, width, end - begin, bgr + begin * bgrStride, bgrStride);
+    });
+}
+
+static void Yuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Yuv420pToBgrV2)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Yuv420pToBgrV2, Avx512bw::A)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        .Add(Avx2::Enable, Avx2::Yuv420pToBgrV2, Avx2::A)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::Yuv420pToBgrV2, Sse41::A)
+#endif
+        .Add(Base::Yuv420pToBgrV2);
+    dispatch.Get(width)(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdYuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    if (yuvType == SimdYuvBt601)
+        SimdYuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
     else
+    {
+        ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+        {
+            Yuv420pToBgrV2(y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, width, end - begin, bgr + begin * bgrStride, bgrStride, yuvType);
+        });
+    }
+}
+
+static void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+           size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Yuv422pToBgr)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::Yuv422pToBgr)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::Yuv422pToBgr, Avx2::DA)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::DA)
-        Ssse3::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::Yuv422pToBgr, Ssse3::DA)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
+        .Add(Vmx::Enable, Vmx::Yuv422pToBgr, Vmx::DA)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
+        .Add(Neon::Enable, Neon::Yuv422pToBgr, Neon::DA)
 #endif
-        Base::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        .Add(Base::Yuv422pToBgr);
+    dispatch.Get(width)(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
 }
 
 SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        Yuv422pToBgr(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, bgr + begin * bgrStride, bgrStride);
+    });
+}
+
+static void Yuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Yuv422pToBgrV2)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Yuv422pToBgrV2, Avx512bw::A)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        .Add(Avx2::Enable, Avx2::Yuv422pToBgrV2, Avx2::A)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::Yuv422pToBgrV2, Sse41::A)
+#endif
+        .Add(Base::Yuv422pToBgrV2);
+    dispatch.Get(width)(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdYuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    if (yuvType == SimdYuvBt601)
+        SimdYuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
     else
+    {
+        ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+        {
+            Yuv422pToBgrV2(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, bgr + begin * bgrStride, bgrStride, yuvType);
+        });
+    }
+}
+
+static void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                         size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Yuv444pToBgr)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::Yuv444pToBgr)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::Yuv444pToBgr, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::DA)
-        Ssse3::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::Yuv444pToBgr, Ssse3::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
+        .Add(Vmx::Enable, Vmx::Yuv444pToBgr, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
+        .Add(Neon::Enable, Neon::Yuv444pToBgr, Neon::A)
 #endif
-        Base::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        .Add(Base::Yuv444pToBgr);
+    dispatch.Get(width)(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
 }
 
 SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        Yuv444pToBgr(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, bgr + begin * bgrStride, bgrStride);
+    });
+}
+
+static void Yuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Yuv444pToBgrV2)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Yuv444pToBgrV2, Avx512bw::A)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
+        .Add(Avx2::Enable, Avx2::Yuv444pToBgrV2, Avx2::A)
 #endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::Yuv444pToBgrV2, Sse41::A)
+#endif
+        .Add(Base::Yuv444pToBgrV2);
+    dispatch.Get(width)(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdYuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    if (yuvType == SimdYuvBt601)
+        SimdYuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
     else
+    {
+        ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+        {
+            Yuv444pToBgrV2(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, bgr + begin * bgrStride, bgrStride, yuvType);
+        });
+    }
+}
+
+static void Yuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Yuv420pToBgra)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::Yuv420pToBgra)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::Yuv420pToBgra, Avx2::DA)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::Yuv420pToBgra, Sse2::DA)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
+        .Add(Vmx::Enable, Vmx::Yuv420pToBgra, Vmx::DA)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
+        .Add(Neon::Enable, Neon::Yuv420pToBgra, Neon::DA)
 #endif
-        Base::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        .Add(Base::Yuv420pToBgra);
+    dispatch.Get(width)(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 }
 
 SIMD_API void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                   size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
+    ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+    {
+        Yuv420pToBgra(y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha);
+    });
+}
+
+static void Yuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Yuv420pToBgraV2)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Yuv420pToBgraV2, Avx512bw::A)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        .Add(Avx2::Enable, Avx2::Yuv420pToBgraV2, Avx2::A)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::Yuv420pToBgraV2, Sse41::A)
+#endif
+        .Add(Base::Yuv420pToBgraV2);
+    dispatch.Get(width)(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdYuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    if (yuvType == SimdYuvBt601)
+        SimdYuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
     else
+    {
+        ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+        {
+            Yuv420pToBgraV2(y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha, yuvType);
+        });
+    }
+}
+
+static void Yuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                          size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Yuv422pToBgra)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::Yuv422pToBgra)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::Yuv422pToBgra, Avx2::DA)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::DA)
-        Sse2::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
+        .Add(Sse2::Enable, Sse2::Yuv422pToBgra, Sse2::DA)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
+        .Add(Vmx::Enable, Vmx::Yuv422pToBgra, Vmx::DA)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
+        .Add(Neon::Enable, Neon::Yuv422pToBgra, Neon::DA)
 #endif
-        Base::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        .Add(Base::Yuv422pToBgra);
+    dispatch.Get(width)(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 }
 
 SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                 size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        Yuv422pToBgra(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha);
+    });
+}
+
+static void Yuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Yuv422pToBgraV2)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Yuv422pToBgraV2, Avx512bw::A)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        .Add(Avx2::Enable, Avx2::Yuv422pToBgraV2, Avx2::A)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::Yuv422pToBgraV2, Sse41::A)
+#endif
+        .Add(Base::Yuv422pToBgraV2);
+    dispatch.Get(width)(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdYuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    if (yuvType == SimdYuvBt601)
+        SimdYuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
     else
+    {
+        ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+        {
+            Yuv422pToBgraV2(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha, yuvType);
+        });
+    }
+}
+
+static void Yuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Yuv444pToBgra)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::Yuv444pToBgra)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::Yuv444pToBgra, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::DA)
-        Sse2::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
+        .Add(Sse2::Enable, Sse2::Yuv444pToBgra, Sse2::A)
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
+        .Add(Vmx::Enable, Vmx::Yuv444pToBgra, Vmx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
+        .Add(Neon::Enable, Neon::Yuv444pToBgra, Neon::A)
 #endif
-        Base::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        .Add(Base::Yuv444pToBgra);
+    dispatch.Get(width)(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 }
 
 SIMD_API void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                   size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        Yuv444pToBgra(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha);
+    });
+}
+
+static void Yuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Yuv444pToBgraV2)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Yuv444pToBgraV2, Avx512bw::A)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
+        .Add(Avx2::Enable, Avx2::Yuv444pToBgraV2, Avx2::A)
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::Yuv444pToBgraV2, Sse41::A)
 #endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        .Add(Base::Yuv444pToBgraV2);
+    dispatch.Get(width)(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdYuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    if (yuvType == SimdYuvBt601)
+        SimdYuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
     else
-#endif
-        Base::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    {
+        ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+        {
+            Yuv444pToBgraV2(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha, yuvType);
+        });
+    }
 }
 
 SIMD_API void SimdYuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
@@ -6377,142 +7738,590 @@ SIMD_API void SimdYuv444pToHsv(const uint8_t * y, size_t yStride, const uint8_t
 SIMD_API void SimdYuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * hue, size_t hueStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::Yuv420pToHue)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv420pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Yuv420pToHue)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv420pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
+        .Add(Avx2::Enable, Avx2::Yuv420pToHue, Avx2::DA)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::DA)
-        Sse2::Yuv420pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
+        .Add(Sse2::Enable, Sse2::Yuv420pToHue, Sse2::DA)
 #endif
 #ifdef SIMD_VSX_ENABLE
-    if(Vsx::Enable && width >= Vsx::DA)
-        Vsx::Yuv420pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
+        .Add(Vsx::Enable, Vsx::Yuv420pToHue, Vsx::DA)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuv420pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
+        .Add(Neon::Enable, Neon::Yuv420pToHue, Neon::DA)
 #endif
-        Base::Yuv420pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+        .Add(Base::Yuv420pToHue);
+    dispatch.Get(width)(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
 }
 
 SIMD_API void SimdYuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * hue, size_t hueStride)
 {
+    static const auto dispatch = Dispatch<decltype(&Base::Yuv444pToHue)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv444pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Yuv444pToHue)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::Yuv444pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
+        .Add(Avx2::Enable, Avx2::Yuv444pToHue, Avx2::A)
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::Yuv444pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
+        .Add(Sse2::Enable, Sse2::Yuv444pToHue, Sse2::A)
 #endif
 #ifdef SIMD_VSX_ENABLE
-    if(Vsx::Enable && width >= Vsx::A)
-        Vsx::Yuv444pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
+        .Add(Vsx::Enable, Vsx::Yuv444pToHue, Vsx::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::Yuv444pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
+        .Add(Neon::Enable, Neon::Yuv444pToHue, Neon::A)
+#endif
+        .Add(Base::Yuv444pToHue);
+    dispatch.Get(width)(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+}
+
+static void Yuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+    size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Yuv420pToRgb)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::Yuv420pToRgb)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::Yuv420pToRgb, Avx2::DA)
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+        .Add(Ssse3::Enable, Ssse3::Yuv420pToRgb, Ssse3::DA)
+#endif
+#ifdef SIMD_NEON_ENABLE
+        .Add(Neon::Enable, Neon::Yuv420pToRgb, Neon::DA)
 #endif
-        Base::Yuv444pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+        .Add(Base::Yuv420pToRgb);
+    dispatch.Get(width)(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
 }
 
 SIMD_API void SimdYuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
     size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
 {
+    ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+    {
+        Yuv420pToRgb(y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, width, end - begin, rgb + begin * rgbStride, rgbStride);
+    });
+}
+
+static void Yuv420pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Yuv420pToRgbV2)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv420pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Yuv420pToRgbV2, Avx512bw::A)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv420pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+        .Add(Avx2::Enable, Avx2::Yuv420pToRgbV2, Avx2::A)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::Yuv420pToRgbV2, Sse41::A)
+#endif
+        .Add(Base::Yuv420pToRgbV2);
+    dispatch.Get(width)(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+}
+
+SIMD_API void SimdYuv420pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    if (yuvType == SimdYuvBt601)
+        SimdYuv420pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
     else
+    {
+        ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+        {
+            Yuv420pToRgbV2(y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, width, end - begin, rgb + begin * rgbStride, rgbStride, yuvType);
+        });
+    }
+}
+
+static void Yuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+    size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Yuv422pToRgb)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::Yuv422pToRgb)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::Yuv422pToRgb, Avx2::DA)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::DA)
-        Ssse3::Yuv420pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::Yuv422pToRgb, Ssse3::DA)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuv420pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
-    else
+        .Add(Neon::Enable, Neon::Yuv422pToRgb, Neon::DA)
 #endif
-        Base::Yuv420pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+        .Add(Base::Yuv422pToRgb);
+    dispatch.Get(width)(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
 }
 
 SIMD_API void SimdYuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
     size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
 {
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        Yuv422pToRgb(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, rgb + begin * rgbStride, rgbStride);
+    });
+}
+
+static void Yuv422pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Yuv422pToRgbV2)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv422pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Yuv422pToRgbV2, Avx512bw::A)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv422pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+        .Add(Avx2::Enable, Avx2::Yuv422pToRgbV2, Avx2::A)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::Yuv422pToRgbV2, Sse41::A)
+#endif
+        .Add(Base::Yuv422pToRgbV2);
+    dispatch.Get(width)(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+}
+
+SIMD_API void SimdYuv422pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    if (yuvType == SimdYuvBt601)
+        SimdYuv422pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
     else
+    {
+        ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+        {
+            Yuv422pToRgbV2(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, rgb + begin * rgbStride, rgbStride, yuvType);
+        });
+    }
+}
+
+static void Yuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+    size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Yuv444pToRgb)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::Yuv444pToRgb)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::Yuv444pToRgb, Avx2::A)
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::DA)
-        Ssse3::Yuv422pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
-    else
+        .Add(Ssse3::Enable, Ssse3::Yuv444pToRgb, Ssse3::A)
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuv422pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
-    else
+        .Add(Neon::Enable, Neon::Yuv444pToRgb, Neon::A)
 #endif
-        Base::Yuv422pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+        .Add(Base::Yuv444pToRgb);
+    dispatch.Get(width)(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
 }
 
 SIMD_API void SimdYuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
     size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
 {
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        Yuv444pToRgb(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, rgb + begin * rgbStride, rgbStride);
+    });
+}
+
+static void Yuv444pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Yuv444pToRgbV2)>()
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv444pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
-    else
+        .Add(Avx512bw::Enable, Avx512bw::Yuv444pToRgbV2, Avx512bw::A)
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::Yuv444pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
-    else
+        .Add(Avx2::Enable, Avx2::Yuv444pToRgbV2, Avx2::A)
 #endif
-#ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::Yuv444pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
-    else
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::Yuv444pToRgbV2, Sse41::A)
 #endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::Yuv444pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+        .Add(Base::Yuv444pToRgbV2);
+    dispatch.Get(width)(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+}
+
+SIMD_API void SimdYuv444pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    if (yuvType == SimdYuvBt601)
+        SimdYuv444pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
     else
+    {
+        ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+        {
+            Yuv444pToRgbV2(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, rgb + begin * rgbStride, rgbStride, yuvType);
+        });
+    }
+}
+
+static void YuyvToBgra(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+    uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::YuyvToBgra)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::YuyvToBgra, Avx512bw::A)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::YuyvToBgra, Avx2::A)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::YuyvToBgra, Sse41::A)
+#endif
+        .Add(Base::YuyvToBgra);
+    dispatch.Get(width)(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdYuyvToBgra(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+    uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        YuyvToBgra(yuyv + begin * yuyvStride, yuyvStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha, yuvType);
+    });
+}
+
+static void YuyvToBgr(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+    uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::YuyvToBgr)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::YuyvToBgr, Avx512bw::A)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::YuyvToBgr, Avx2::A)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::YuyvToBgr, Sse41::A)
+#endif
+        .Add(Base::YuyvToBgr);
+    dispatch.Get(width)(yuyv, yuyvStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdYuyvToBgr(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+    uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        YuyvToBgr(yuyv + begin * yuyvStride, yuyvStride, width, end - begin, bgr + begin * bgrStride, bgrStride, yuvType);
+    });
+}
+
+static void YuyvToRgb(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+    uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::YuyvToRgb)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::YuyvToRgb, Avx512bw::A)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::YuyvToRgb, Avx2::A)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::YuyvToRgb, Sse41::A)
+#endif
+        .Add(Base::YuyvToRgb);
+    dispatch.Get(width)(yuyv, yuyvStride, width, height, rgb, rgbStride, yuvType);
+}
+
+SIMD_API void SimdYuyvToRgb(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+    uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        YuyvToRgb(yuyv + begin * yuyvStride, yuyvStride, width, end - begin, rgb + begin * rgbStride, rgbStride, yuvType);
+    });
+}
+
+static void UyvyToBgra(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+    uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::UyvyToBgra)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::UyvyToBgra, Avx512bw::A)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::UyvyToBgra, Avx2::A)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::UyvyToBgra, Sse41::A)
+#endif
+        .Add(Base::UyvyToBgra);
+    dispatch.Get(width)(uyvy, uyvyStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdUyvyToBgra(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+    uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        UyvyToBgra(uyvy + begin * uyvyStride, uyvyStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha, yuvType);
+    });
+}
+
+static void UyvyToBgr(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+    uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::UyvyToBgr)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::UyvyToBgr, Avx512bw::A)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::UyvyToBgr, Avx2::A)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::UyvyToBgr, Sse41::A)
+#endif
+        .Add(Base::UyvyToBgr);
+    dispatch.Get(width)(uyvy, uyvyStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdUyvyToBgr(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+    uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        UyvyToBgr(uyvy + begin * uyvyStride, uyvyStride, width, end - begin, bgr + begin * bgrStride, bgrStride, yuvType);
+    });
+}
+
+static void UyvyToRgb(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+    uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::UyvyToRgb)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::UyvyToRgb, Avx512bw::A)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::UyvyToRgb, Avx2::A)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::UyvyToRgb, Sse41::A)
+#endif
+        .Add(Base::UyvyToRgb);
+    dispatch.Get(width)(uyvy, uyvyStride, width, height, rgb, rgbStride, yuvType);
+}
+
+SIMD_API void SimdUyvyToRgb(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+    uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        UyvyToRgb(uyvy + begin * uyvyStride, uyvyStride, width, end - begin, rgb + begin * rgbStride, rgbStride, yuvType);
+    });
+}
+
+static void YuyvToGray(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * gray, size_t grayStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::YuyvToGray)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::YuyvToGray, Avx512bw::A)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::YuyvToGray, Avx2::A)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::YuyvToGray, Sse2::A)
+#endif
+        .Add(Base::YuyvToGray);
+    dispatch.Get(width)(yuyv, yuyvStride, width, height, gray, grayStride);
+}
+
+SIMD_API void SimdYuyvToGray(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * gray, size_t grayStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        YuyvToGray(yuyv + begin * yuyvStride, yuyvStride, width, end - begin, gray + begin * grayStride, grayStride);
+    });
+}
+
+static void YuyvToNv12(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+    uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::YuyvToNv12)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::YuyvToNv12, Avx512bw::A)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::YuyvToNv12, Avx2::A)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::YuyvToNv12, Sse2::A)
+#endif
+        .Add(Base::YuyvToNv12);
+    dispatch.Get(width)(yuyv, yuyvStride, width, height, y, yStride, uv, uvStride);
+}
+
+SIMD_API void SimdYuyvToNv12(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+    uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+{
+    ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+    {
+        YuyvToNv12(yuyv + begin * yuyvStride, yuyvStride, width, end - begin, y + begin * yStride, yStride, uv + begin / 2 * uvStride, uvStride);
+    });
+}
+
+static void YuyvToYuv420p(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+    uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::YuyvToYuv420p)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::YuyvToYuv420p, Avx512bw::DA)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::YuyvToYuv420p, Avx2::DA)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::YuyvToYuv420p, Sse2::DA)
+#endif
+        .Add(Base::YuyvToYuv420p);
+    dispatch.Get(width)(yuyv, yuyvStride, width, height, y, yStride, u, uStride, v, vStride);
+}
+
+SIMD_API void SimdYuyvToYuv420p(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+    uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+    ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+    {
+        YuyvToYuv420p(yuyv + begin * yuyvStride, yuyvStride, width, end - begin, y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride);
+    });
+}
+
+static void UyvyToGray(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * gray, size_t grayStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::UyvyToGray)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::UyvyToGray, Avx512bw::A)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::UyvyToGray, Avx2::A)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::UyvyToGray, Sse2::A)
 #endif
-        Base::Yuv444pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+        .Add(Base::UyvyToGray);
+    dispatch.Get(width)(uyvy, uyvyStride, width, height, gray, grayStride);
 }
 
+SIMD_API void SimdUyvyToGray(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * gray, size_t grayStride)
+{
+    ParallelRows(width, height, 1, [=](size_t begin, size_t end)
+    {
+        UyvyToGray(uyvy + begin * uyvyStride, uyvyStride, width, end - begin, gray + begin * grayStride, grayStride);
+    });
+}
 
+static void UyvyToNv12(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+    uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::UyvyToNv12)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::UyvyToNv12, Avx512bw::A)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::UyvyToNv12, Avx2::A)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::UyvyToNv12, Sse2::A)
+#endif
+        .Add(Base::UyvyToNv12);
+    dispatch.Get(width)(uyvy, uyvyStride, width, height, y, yStride, uv, uvStride);
+}
+
+SIMD_API void SimdUyvyToNv12(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+    uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+{
+    ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+    {
+        UyvyToNv12(uyvy + begin * uyvyStride, uyvyStride, width, end - begin, y + begin * yStride, yStride, uv + begin / 2 * uvStride, uvStride);
+    });
+}
+
+static void UyvyToYuv420p(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+    uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::UyvyToYuv420p)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::UyvyToYuv420p, Avx512bw::DA)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::UyvyToYuv420p, Avx2::DA)
+#endif
+#ifdef SIMD_SSE2_ENABLE
+        .Add(Sse2::Enable, Sse2::UyvyToYuv420p, Sse2::DA)
+#endif
+        .Add(Base::UyvyToYuv420p);
+    dispatch.Get(width)(uyvy, uyvyStride, width, height, y, yStride, u, uStride, v, vStride);
+}
 
+SIMD_API void SimdUyvyToYuv420p(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+    uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+    ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+    {
+        UyvyToYuv420p(uyvy + begin * uyvyStride, uyvyStride, width, end - begin, y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride);
+    });
+}
+
+
+
+
+static void Yuv420p16ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::Yuv420p16ToBgra)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::Yuv420p16ToBgra, Avx512bw::A)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::Yuv420p16ToBgra, Avx2::A)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::Yuv420p16ToBgra, Sse41::A)
+#endif
+        .Add(Base::Yuv420p16ToBgra);
+    dispatch.Get(width)(y, yStride, u, uStride, v, vStride, width, height, shift, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdYuv420p16ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+    {
+        Yuv420p16ToBgra(y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, 
+            width, end - begin, shift, bgra + begin * bgraStride, bgraStride, alpha, yuvType);
+    });
+}
+
+static void P016ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+    int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    static const auto dispatch = Dispatch<decltype(&Base::P016ToBgra)>()
+#ifdef SIMD_AVX512BW_ENABLE
+        .Add(Avx512bw::Enable, Avx512bw::P016ToBgra, Avx512bw::A)
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        .Add(Avx2::Enable, Avx2::P016ToBgra, Avx2::A)
+#endif
+#ifdef SIMD_SSE41_ENABLE
+        .Add(Sse41::Enable, Sse41::P016ToBgra, Sse41::A)
+#endif
+        .Add(Base::P016ToBgra);
+    dispatch.Get(width)(y, yStride, uv, uvStride, width, height, shift, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdP016ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+    int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    ParallelRows(width, height, 2, [=](size_t begin, size_t end)
+    {
+        P016ToBgra(y + begin * yStride, yStride, uv + begin / 2 * uvStride, uvStride, width, end - begin, 
+            shift, bgra + begin * bgraStride, bgraStride, alpha, yuvType);
+    });
+}
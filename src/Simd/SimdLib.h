@@ -187,8 +187,60 @@ typedef enum
     SimdCpuInfoVmx, /*!< Availability of VMX or Altivec (PowerPC). */
     SimdCpuInfoVsx, /*!< Availability of VSX (PowerPC). */
     SimdCpuInfoNeon, /*!< Availability of NEON (ARM). */
+    SimdCpuInfoIsa, /*!< The highest level of SIMD instructions (see ::SimdIsaType) which is used by the library. */
 } SimdCpuInfoType;
 
+/*! @ingroup c_types
+    Describes levels of SIMD instructions which can be used by %Simd Library (see functions ::SimdSetMaxIsa and ::SimdGetMaxIsa).
+    Levels are ordered only within one architecture (x86: Sse2 < Sse41 < Avx2 < Avx512bw < Avx512vnni, PowerPC: Vmx < Vsx, ARM: Neon). 
+    A level of other architecture doesn't restrict instructions of the current one, ::SimdIsaBase restricts all of them.
+    \note Numeric values don't follow the order of levels: new values are appended to keep binary compatibility.
+*/
+typedef enum
+{
+    SimdIsaBase = 0, /*!< Scalar code only. */
+    SimdIsaSse41 = 1, /*!< Up to SSE4.2 (x86). */
+    SimdIsaAvx2 = 2, /*!< Up to AVX2 (x86). */
+    SimdIsaAvx512bw = 3, /*!< Up to AVX-512BW (x86). */
+    SimdIsaAvx512vnni = 4, /*!< Up to AVX-512VNNI (x86). There are no restrictions of x86 instructions. */
+    SimdIsaVmx = 5, /*!< VMX or Altivec (PowerPC). */
+    SimdIsaVsx = 6, /*!< Up to VSX (PowerPC). */
+    SimdIsaNeon = 7, /*!< NEON (ARM). */
+    SimdIsaSse2 = 8, /*!< Up to SSSE3 (x86). */
+} SimdIsaType;
+
+/*! @ingroup c_types
+    Describes formats of internal performance statistics report (see function ::SimdPerformanceStatisticExport).
+*/
+typedef enum
+{
+    SimdPerformanceStatisticText, /*!< Human readable text (the same as ::SimdPerformanceStatistic returns). */
+    SimdPerformanceStatisticJson, /*!< JSON array of objects (one object per measured function). */
+    SimdPerformanceStatisticCsv, /*!< CSV table with header (one row per measured function). */
+} SimdPerformanceStatisticFormatType;
+
+/*! @ingroup c_types
+    Describes types of tracing events (see ::SimdTraceCallbackPtr).
+*/
+typedef enum
+{
+    SimdTraceEventBegin, /*!< Beginning of instrumented region. */
+    SimdTraceEventEnd, /*!< End of instrumented region. */
+} SimdTraceEventType;
+
+/*! @ingroup c_types
+    Describes flags of memory allocation (see functions ::SimdAllocateWithFlags and ::SimdSetAllocateFlags).
+*/
+typedef enum
+{
+    /*! Plain aligned allocation. */
+    SimdAllocateDefault = 0,
+    /*! Blocks not less than 2 MB are aligned to 2 MB and are marked to be backed by transparent huge pages (Linux only, madvise(MADV_HUGEPAGE)). It is ignored if it is not supported. */
+    SimdAllocateHugePages = 1,
+    /*! Allocated memory is touched by calling thread, so its pages are placed on NUMA node of this thread (first-touch policy). */
+    SimdAllocateNumaLocal = 2,
+} SimdAllocateFlags;
+
 /*! @ingroup c_types
     Describes types and flags to get information about classifier cascade with using function ::SimdDetectionInfo.
     \note This type is used for implementation of Simd::Detection.
@@ -282,6 +334,14 @@ typedef enum
     SimdPixelFormatHsl24,
     /*! A 24-bit (3 8-bit channels) RGB (Red, Green, Blue) pixel format. */
     SimdPixelFormatRgb24,
+    /*! A 16-bit packed YUV 4:2:2 pixel format (bytes Y0 U Y1 V for each pair of pixels). */
+    SimdPixelFormatYuyv16,
+    /*! A 16-bit packed YUV 4:2:2 pixel format (bytes U Y0 V Y1 for each pair of pixels). */
+    SimdPixelFormatUyvy16,
+    /*! A 32-bit (2 16-bit channels) interleaved UV pixel format (chroma plane of P010/P016 image). */
+    SimdPixelFormatUv32,
+    /*! A 24-bit (3 8-bit channels) CIE L*a*b* (Lightness, a, b) pixel format. L is scaled to [0, 255], a and b are shifted by 128. */
+    SimdPixelFormatLab24,
 } SimdPixelFormatType;
 
 /*! @ingroup c_types
@@ -304,6 +364,8 @@ typedef enum
     SimdResizeChannelByte,
     /*! 32-bit float channel type.  */
     SimdResizeChannelFloat,
+    /*! 16-bit unsigned integer channel type.  */
+    SimdResizeChannelShort,
 } SimdResizeChannelType;
 
 /*! @ingroup resizing
@@ -319,8 +381,27 @@ typedef enum
     SimdResizeMethodArea,
     /*! InferenceEngine::Extension::Cpu::Interp compatible method. */
     SimdResizeMethodInferenceEngineInterp,
+    /*! Bicubic method (4x4 neighborhood, a = -0.75, OpenCV cv::INTER_CUBIC compatible). */
+    SimdResizeMethodBicubic,
+    /*! Bicubic method with antialiasing at downscaling (a = -0.5, PIL Image.BICUBIC compatible). */
+    SimdResizeMethodBicubicPil,
+    /*! Lanczos method (3 lobes) with antialiasing at downscaling (PIL Image.LANCZOS compatible). */
+    SimdResizeMethodLanczos,
+    /*! Nearest neighbor method (OpenCV cv::INTER_NEAREST compatible). It supports all channel types and any number of channels. */
+    SimdResizeMethodNearest,
 } SimdResizeMethodType;
 
+/*! @ingroup other_conversion
+    Describes interpolation methods used in 3D color lookup table (see function ::SimdLut3dInit).
+*/
+typedef enum
+{
+    /*! Trilinear interpolation between 8 nearest nodes of the table. */
+    SimdLut3dInterpolationTrilinear,
+    /*! Tetrahedral interpolation between 4 nodes of the table. */
+    SimdLut3dInterpolationTetrahedral,
+} SimdLut3dInterpolationType;
+
 /*! @ingroup synet
     Describes Synet compatibility flags. This type used in functions ::SimdSynetScaleLayerForward, ::SimdSynetConvert32fTo8u, 
     ::SimdSynetConvolution8iInit, and ::SimdSynetMergedConvolution8iInit.
@@ -372,6 +453,18 @@ typedef enum
     SimdSynetUnaryOperation32fZero,
 } SimdSynetUnaryOperation32fType;
 
+/*! @ingroup synet
+    Describes type of Synet layer context which is added to workspace with using of function ::SimdSynetWorkspaceAdd.
+*/
+typedef enum
+{
+    SimdSynetLayerConvolution32f, /*!< FP32 convolution (see ::SimdSynetConvolution32fInit). */
+    SimdSynetLayerConvolution8i, /*!< INT8 convolution (see ::SimdSynetConvolution8iInit). */
+    SimdSynetLayerDeconvolution32f, /*!< FP32 deconvolution (see ::SimdSynetDeconvolution32fInit). */
+    SimdSynetLayerMergedConvolution32f, /*!< FP32 merged convolution (see ::SimdSynetMergedConvolution32fInit). */
+    SimdSynetLayerMergedConvolution8i, /*!< INT8 merged convolution (see ::SimdSynetMergedConvolution8iInit). */
+} SimdSynetLayerType;
+
 /*! @ingroup synet
     Describes <a href="http://github.com/ermig1979/Synet">Synet Framework</a> 4D-tensor format type.
 */
@@ -419,6 +512,57 @@ typedef enum
     SimdTransformTransposeRotate270, /*!< Image transposed and rotated 270 degrees counterclockwise. It is equal to vertical mirroring of image. The output image has the same size as input image.*/
 } SimdTransformType;
 
+/*! @ingroup transform
+    Describes flags of affine warping (see functions ::SimdWarpAffineInit and ::SimdWarpAffineRun). 
+    The flags are combination of channel type, interpolation method and border mode.
+*/
+typedef enum
+{
+    /*! 8-bit unsigned integer channel type. */
+    SimdWarpAffineChannelByte = 0,
+    /*! 32-bit float channel type. */
+    SimdWarpAffineChannelFloat = 1,
+    /*! A mask to select channel type. */
+    SimdWarpAffineChannelMask = 1,
+    /*! Nearest neighbor interpolation. */
+    SimdWarpAffineInterpNearest = 0,
+    /*! Bilinear interpolation. */
+    SimdWarpAffineInterpBilinear = 2,
+    /*! A mask to select interpolation method. */
+    SimdWarpAffineInterpMask = 2,
+    /*! Points outside of the input image are filled by constant border value. */
+    SimdWarpAffineBorderConstant = 0,
+    /*! Points outside of the input image are replaced by the nearest edge pixels. */
+    SimdWarpAffineBorderReplicate = 4,
+    /*! A mask to select border mode. */
+    SimdWarpAffineBorderMask = 4,
+} SimdWarpAffineFlags;
+
+/*! @ingroup yuv_conversion
+    Describes YUV format type (colour matrix and range of values). It is used in YUV <-> BGR(A) conversion functions with suffix V2 (for example ::SimdYuv420pToBgraV2 and ::SimdBgraToYuv420pV2).
+*/
+typedef enum
+{
+    SimdYuvBt601, /*!< ITU-R BT.601 colour matrix, limited range (Y in [16..235], U and V in [16..240]). It is used by all YUV conversion functions without suffix V2. */
+    SimdYuvBt709, /*!< ITU-R BT.709 colour matrix (HD video), limited range (Y in [16..235], U and V in [16..240]). */
+    SimdYuvBt601Full, /*!< ITU-R BT.601 colour matrix, full range (Y, U and V in [0..255]). It is used in JPEG (JFIF). */
+    SimdYuvBt709Full, /*!< ITU-R BT.709 colour matrix, full range (Y, U and V in [0..255]). */
+} SimdYuvType;
+
+/*! @ingroup info
+    \brief Callback function type "SimdTraceCallbackPtr";
+
+    The function is called at beginning and at end of every instrumented region of %Simd Library (see ::SimdSetTraceCallback).
+    It is called in the thread which executes the region, so it has to be thread safe.
+
+    \param [in] userData - a pointer to user data passed to ::SimdSetTraceCallback.
+    \param [in] type - a type of the event (see ::SimdTraceEventType).
+    \param [in] name - a name of the region. The pointer is valid only during the call. The same name is passed to begin and end events.
+    \param [in] thread - an index of the thread which executes the region (0, 1, 2, ... in order of the first event in the thread).
+    \param [in] size - an amount of work of the region (number of floating point operations for Synet functions and GEMM, otherwise number of pixels). It is 0 if unknown or for end events.
+*/
+typedef void(*SimdTraceCallbackPtr)(void * userData, SimdTraceEventType type, const char * name, size_t thread, int64_t size);
+
 /*! @ingroup synet
     \brief Callback function type "SimdGemm32fNNPtr";
 
@@ -598,6 +742,7 @@ extern "C"
             std::cout << "PowerPC-Altivec: " << (SimdCpuInfo(SimdCpuInfoVmx) ? "Yes" : "No") << std::endl;
             std::cout << "PowerPC-VSX: " << (SimdCpuInfo(SimdCpuInfoVsx) ? "Yes" : "No") << std::endl;
             std::cout << "ARM-NEON: " << (SimdCpuInfo(SimdCpuInfoNeon) ? "Yes" : "No") << std::endl;
+            std::cout << "Used ISA level: " << SimdCpuInfo(SimdCpuInfoIsa) << std::endl;
             return 0;
         }
         \endverbatim
@@ -607,6 +752,33 @@ extern "C"
     */
     SIMD_API size_t SimdCpuInfo(SimdCpuInfoType type);
 
+    /*! @ingroup info
+
+        \fn SimdIsaType SimdGetMaxIsa();
+
+        \short Gets maximal level of SIMD instructions which can be used by %Simd Library.
+
+        \return current maximal level of SIMD instructions (see ::SimdIsaType). The default value is ::SimdIsaAvx512vnni (no restrictions).
+    */
+    SIMD_API SimdIsaType SimdGetMaxIsa();
+
+    /*! @ingroup info
+
+        \fn void SimdSetMaxIsa(SimdIsaType isa);
+
+        \short Restricts level of SIMD instructions which can be used by %Simd Library.
+
+        It can be used to avoid of CPU frequency throttling caused by AVX-512 instructions or to compare performance of different instruction sets on the same machine.
+        Function ::SimdCpuInfo reports availability of instructions sets and used level (::SimdCpuInfoIsa) with taking into account this restriction.
+
+        \note This restriction is applied to every following call of library functions (the function can be called from any thread, concurrently with other library functions). Objects (image resizers, neural network layers) which were created before keep their implementation.
+            Also instruction sets can be restricted at program start with environment variable SIMD_MAX_ISA (its value is one of "Base", "Vmx", "Vsx", "Neon", "Sse2", "Sse41", "Avx2", "Avx512bw", "Avx512vnni").
+            This function can't enable instruction sets which were disabled by the environment variable.
+
+        \param [in] isa - a maximal level of SIMD instructions (see ::SimdIsaType).
+    */
+    SIMD_API void SimdSetMaxIsa(SimdIsaType isa);
+
     /*! @ingroup info
 
         \fn const char *SimdPerformanceStatistic();
@@ -619,6 +791,106 @@ extern "C"
     */
     SIMD_API const char * SimdPerformanceStatistic();
 
+    /*! @ingroup info
+
+        \fn const char * SimdPerformanceStatisticExport(SimdPerformanceStatisticFormatType format);
+
+        \short Exports internal performance statistics of %Simd Library in given format.
+
+        Every measured function is described by its name, number of calls, total, average, minimal and maximal time, 
+        percentiles (p50, p90, p99) of time of single call, performance (GFlops) and memory throughput (GB/s).
+        The percentiles are estimated with using of logarithmic histogram of call duration (relative error is less than 13%).
+
+        \note %Simd Library have to be build with defined SIMD_PERFORMANCE_STATISTIC macro.
+
+        \param [in] format - a format of output report (see ::SimdPerformanceStatisticFormatType).
+        \return string with internal performance statistics of %Simd Library. The string is valid until next call of this function.
+    */
+    SIMD_API const char * SimdPerformanceStatisticExport(SimdPerformanceStatisticFormatType format);
+
+    /*! @ingroup info
+
+        \fn void SimdPerformanceStatisticReset();
+
+        \short Resets internal performance statistics of %Simd Library. 
+
+        It allows to measure performance of separate stages of a program (for example to exclude warm-up).
+        It can be called while other threads call library functions: every counter is cleared by its own thread at the next finished measurement
+        (a measurement which is in progress at the moment of reset is added to the new statistics).
+
+        \note %Simd Library have to be build with defined SIMD_PERFORMANCE_STATISTIC macro.
+    */
+    SIMD_API void SimdPerformanceStatisticReset();
+
+    /*! @ingroup info
+
+        \fn void SimdSetTraceCallback(SimdTraceCallbackPtr callback, void * userData);
+
+        \short Sets callback function to trace instrumented regions of %Simd Library.
+
+        The instrumented regions are Synet convolutions (functions ::SimdSynetConvolution32fForward, ::SimdSynetMergedConvolution32fForward and so on), 
+        GEMM kernels and C++ wrappers (for example Simd::Detection::Detect) in which macro SIMD_CHECK_PERFORMANCE is not redefined by user.
+        If the callback is not set then tracing has negligible cost (one check of global variable per region).
+
+        \note The callback and user data are published together, so it is safe to change them while functions of %Simd Library are executed in other threads.
+            An instrumented region of the library which has already begun reports its end to the callback and user data it began with, so the user data has to stay valid until such regions are finished.
+
+        \param [in] callback - a pointer to callback function (see ::SimdTraceCallbackPtr). NULL disables tracing.
+        \param [in] userData - a pointer to user data which is passed to the callback.
+    */
+    SIMD_API void SimdSetTraceCallback(SimdTraceCallbackPtr callback, void * userData);
+
+    /*! @ingroup info
+
+        \fn SimdBool SimdTraceEnabled();
+
+        \short Checks if tracing callback is set (see ::SimdSetTraceCallback).
+
+        \return ::SimdTrue if tracing callback is set.
+    */
+    SIMD_API SimdBool SimdTraceEnabled();
+
+    /*! @ingroup info
+
+        \fn void SimdTraceEvent(SimdTraceEventType type, const char * name, int64_t size);
+
+        \short Passes tracing event of user's region to the tracing callback (see ::SimdSetTraceCallback).
+
+        It allows to show user's regions together with regions of %Simd Library. It does nothing if tracing callback is not set.
+        There is a C++ wrapper Simd::TraceScope.
+
+        \param [in] type - a type of the event (see ::SimdTraceEventType).
+        \param [in] name - a name of the region.
+        \param [in] size - an amount of work of the region (can be 0).
+    */
+    SIMD_API void SimdTraceEvent(SimdTraceEventType type, const char * name, int64_t size);
+
+    /*! @ingroup info
+
+        \fn SimdBool SimdChromeTraceStart(const char * path);
+
+        \short Starts recording of instrumented regions of %Simd Library in Chrome trace format.
+
+        It sets internal tracing callback (see ::SimdSetTraceCallback) which collects events in memory. 
+        The events are written to the file by function ::SimdChromeTraceStop. The file can be opened in chrome://tracing or https://ui.perfetto.dev.
+
+        \param [in] path - a path to output JSON file.
+        \return result of the operation (::SimdFalse if the file can't be created).
+    */
+    SIMD_API SimdBool SimdChromeTraceStart(const char * path);
+
+    /*! @ingroup info
+
+        \fn SimdBool SimdChromeTraceStop();
+
+        \short Stops recording of instrumented regions started by ::SimdChromeTraceStart and writes them to the file.
+
+        It also resets tracing callback (see ::SimdSetTraceCallback).
+
+        \return result of the operation (::SimdFalse if the recording was not started or writing is failed).
+    */
+    SIMD_API SimdBool SimdChromeTraceStop();
+
     /*! @ingroup memory
 
         \fn void * SimdAllocate(size_t size, size_t align);
@@ -634,6 +906,44 @@ extern "C"
     */
     SIMD_API void * SimdAllocate(size_t size, size_t align);
 
+    /*! @ingroup memory
+
+        \fn void * SimdAllocateWithFlags(size_t size, size_t align, int flags);
+
+        \short Allocates aligned memory block with using of given allocation flags.
+
+        \note The memory allocated by this function is must be deleted by function ::SimdFree.
+
+        \param [in] size - a size of memory block.
+        \param [in] align - a required alignment of memory block.
+        \param [in] flags - a combination of flags of memory allocation (see ::SimdAllocateFlags). Global flags (see ::SimdSetAllocateFlags) are ignored.
+
+        \return a pointer to allocated memory.
+    */
+    SIMD_API void * SimdAllocateWithFlags(size_t size, size_t align, int flags);
+
+    /*! @ingroup memory
+
+        \fn int SimdGetAllocateFlags();
+
+        \short Gets global flags of memory allocation.
+
+        \return current global flags of memory allocation (see ::SimdAllocateFlags). By default it is equal to ::SimdAllocateDefault.
+    */
+    SIMD_API int SimdGetAllocateFlags();
+
+    /*! @ingroup memory
+
+        \fn void SimdSetAllocateFlags(int flags);
+
+        \short Sets global flags of memory allocation.
+
+        \note These flags are used by function ::SimdAllocate and by all internal allocations of %Simd Library (including image and tensor buffers).
+
+        \param [in] flags - a combination of flags of memory allocation (see ::SimdAllocateFlags).
+    */
+    SIMD_API void SimdSetAllocateFlags(int flags);
+
     /*! @ingroup memory
 
         \fn void SimdFree(void * ptr);
@@ -697,10 +1007,37 @@ extern "C"
 
         \short Sets number of threads used by Simd Library to parallelize some algorithms.
 
+        \note Worker threads are created once and are kept in a persistent thread pool, so parallel algorithms do not pay for thread creation on every call.
+            Decreasing of thread number stops extra workers. The pool is not destroyed at program exit, so call SimdSetThreadNumber(1) 
+            to stop all workers before unloading of the library (if it is used as a shared library).
+
         \param [in] threadNumber - a number of threads.
     */
     SIMD_API void SimdSetThreadNumber(size_t threadNumber);
 
+    /*! @ingroup thread
+
+        \fn size_t SimdGetParallelThreshold();
+
+        \short Gets minimal image size (in pixels) starting from which image processing functions split their work between threads.
+
+        \return current threshold.
+    */
+    SIMD_API size_t SimdGetParallelThreshold();
+
+    /*! @ingroup thread
+
+        \fn void SimdSetParallelThreshold(size_t threshold);
+
+        \short Sets minimal image size (in pixels) starting from which image processing functions split their work between threads.
+
+        Images of this size or larger are split into horizontal bands which are processed in parallel 
+        (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber). Default value is 262144 (512x512).
+
+        \param [in] threshold - a minimal image size (width*height) for row-parallel processing.
+    */
+    SIMD_API void SimdSetParallelThreshold(size_t threshold);
+
     /*! @ingroup cpu_flags
 
         \fn SimdBool SimdGetFastMode();
@@ -1419,6 +1756,30 @@ extern "C"
     */
     SIMD_API void SimdBgraToGray(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * gray, size_t grayStride);
 
+    /*! @ingroup bgra_conversion
+
+        \fn void SimdBgraToNv12(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
+
+        \short Converts 32-bit BGRA image to NV12 image (Y plane and interleaved UV plane) with given YUV format type.
+
+        The input BGRA and output Y images must have the same width and height.
+        The output UV image must have half size relative to Y component (its row contains interleaved U and V values).
+        It is a single pass conversion without intermediate U and V planes.
+
+        \note This function has a C++ wrapper Simd::BgraToNv12(const View<A>& bgra, View<A>& y, View<A>& uv, SimdYuvType yuvType).
+
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] uv - a pointer to pixels data of output 16-bit image with interleaved UV color plane.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] yuvType - a type of output YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdBgraToNv12(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
+
     /*! @ingroup bgra_conversion
 
         \fn void SimdBgraToRgb(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * rgb, size_t rgbStride);
@@ -1462,6 +1823,29 @@ extern "C"
     */
     SIMD_API void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+    /*! @ingroup bgra_conversion
+
+        \fn void SimdBgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Converts 32-bit BGRA image to YUV420P with given YUV format type.
+
+        The input BGRA and output Y images must have the same width and height.
+        The output U and V images must have the same width and height (half size relative to Y component).
+
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of output YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdBgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
     /*! @ingroup bgra_conversion
 
         \fn void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
@@ -1486,6 +1870,29 @@ extern "C"
     */
     SIMD_API void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+    /*! @ingroup bgra_conversion
+
+        \fn void SimdBgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Converts 32-bit BGRA image to YUV422P with given YUV format type.
+
+        The input BGRA and output Y images must have the same width and height.
+        The output U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of output YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdBgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
     /*! @ingroup bgra_conversion
 
         \fn void SimdBgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
@@ -1509,6 +1916,29 @@ extern "C"
     */
     SIMD_API void SimdBgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+    /*! @ingroup bgra_conversion
+
+        \fn void SimdBgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Converts 32-bit BGRA image to YUV444P with given YUV format type.
+
+        The input BGRA and output Y images must have the same width and height.
+        The output Y, U and V images must have the same width and height.
+
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of output YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdBgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
     /*! @ingroup bgra_conversion
 
         \fn void SimdBgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride);
@@ -1639,6 +2069,24 @@ extern "C"
     */
     SIMD_API void SimdBgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride);
 
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToHsl32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * hsl, size_t hslStride);
+
+        \short Converts 24-bit BGR image to HSL(Hue, Saturation, Lightness) image with 32-bit float channels.
+
+        All images must have the same width and height. Output pixel consists of three interleaved 32-bit float values.
+        Hue is in range [0, 360), saturation and lightness are in range [0, 1].
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] hsl - a pointer to pixels data of output HSL(Hue, Saturation, Lightness) image.
+        \param [in] hslStride - a row size (in bytes) of the hsl image.
+    */
+    SIMD_API void SimdBgrToHsl32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * hsl, size_t hslStride);
+
     /*! @ingroup bgr_conversion
 
         \fn void SimdBgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride);
@@ -1660,62 +2108,165 @@ extern "C"
 
     /*! @ingroup bgr_conversion
 
-        \fn void SimdBgrToRgb(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
-
-        \short Converts 24-bit BGR image to 24-bit RGB image (also it performs backward conversion).
+        \fn void SimdBgrToHsv32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * hsv, size_t hsvStride);
 
-        All images must have the same width and height.
+        \short Converts 24-bit BGR image to HSV(Hue, Saturation, Value) image with 32-bit float channels.
 
-        \note This function has a C++ wrapper Simd::BgrToRgb(const View<A> & bgr, View<A> & rgb).
+        All images must have the same width and height. Output pixel consists of three interleaved 32-bit float values.
+        Hue is in range [0, 360), saturation and value are in range [0, 1].
 
         \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
-        \param [in] bgrStride - a row size of the bgr image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
-        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] hsv - a pointer to pixels data of output HSV(Hue, Saturation, Value) image.
+        \param [in] hsvStride - a row size (in bytes) of the hsv image.
     */
-    SIMD_API void SimdBgrToRgb(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
+    SIMD_API void SimdBgrToHsv32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * hsv, size_t hsvStride);
 
     /*! @ingroup bgr_conversion
 
-        \fn void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+        \fn void SimdBgrToLab(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride);
 
-        \short Converts 24-bit BGR image to YUV420P.
+        \short Converts 24-bit BGR image to 24-bit CIE Lab image.
 
-        The input BGR and output Y images must have the same width and height.
-        The input U and V images must have the same width and height (half size relative to Y component).
+        All images must have the same width and height.
+        Conversion uses sRGB gamma and D65 white point. Output L is scaled to [0, 255], a and b are shifted by 128.
 
-        \note This function has a C++ wrapper Simd::BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v).
+        \note This function has a C++ wrapper Simd::BgrToLab(const View<A>& bgr, View<A>& lab).
 
         \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] bgrStride - a row size of the BGR image.
-        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
-        \param [in] yStride - a row size of the y image.
-        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
-        \param [in] uStride - a row size of the u image.
-        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
-        \param [in] vStride - a row size of the v image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] lab - a pointer to pixels data of output 24-bit Lab image.
+        \param [in] labStride - a row size of the lab image.
     */
-    SIMD_API void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+    SIMD_API void SimdBgrToLab(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride);
 
     /*! @ingroup bgr_conversion
 
-        \fn void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
-
-        \short Converts 24-bit BGR image to YUV422P.
+        \fn void SimdBgrToLab32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * lab, size_t labStride);
 
-        The input BGR and output Y images must have the same width and height.
-        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+        \short Converts 24-bit BGR image to CIE Lab image with 32-bit float channels.
 
-        \note This function has a C++ wrapper Simd::BgrToYuv422p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v).
+        All images must have the same width and height. Output pixel consists of three interleaved 32-bit float values.
+        Conversion uses sRGB gamma and D65 white point. Output L is in range [0, 100], a and b are not scaled and not shifted.
 
         \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] bgrStride - a row size of the BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] lab - a pointer to pixels data of output CIE Lab image.
+        \param [in] labStride - a row size (in bytes) of the lab image.
+    */
+    SIMD_API void SimdBgrToLab32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * lab, size_t labStride);
+
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
+
+        \short Converts 24-bit BGR image to NV12 image (Y plane and interleaved UV plane) with given YUV format type.
+
+        The input BGR and output Y images must have the same width and height.
+        The output UV image must have half size relative to Y component (its row contains interleaved U and V values).
+        It is a single pass conversion without intermediate U and V planes.
+
+        \note This function has a C++ wrapper Simd::BgrToNv12(const View<A>& bgr, View<A>& y, View<A>& uv, SimdYuvType yuvType).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] uv - a pointer to pixels data of output 16-bit image with interleaved UV color plane.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] yuvType - a type of output YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdBgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
+
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToRgb(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
+
+        \short Converts 24-bit BGR image to 24-bit RGB image (also it performs backward conversion).
+
+        All images must have the same width and height.
+
+        \note This function has a C++ wrapper Simd::BgrToRgb(const View<A> & bgr, View<A> & rgb).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+    */
+    SIMD_API void SimdBgrToRgb(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
+
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+        \short Converts 24-bit BGR image to YUV420P.
+
+        The input BGR and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function has a C++ wrapper Simd::BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the BGR image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+    */
+    SIMD_API void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Converts 24-bit BGR image to YUV420P with given YUV format type.
+
+        The input BGR and output Y images must have the same width and height.
+        The output U and V images must have the same width and height (half size relative to Y component).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of output YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdBgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+        \short Converts 24-bit BGR image to YUV422P.
+
+        The input BGR and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function has a C++ wrapper Simd::BgrToYuv422p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the BGR image.
         \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
         \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
@@ -1725,6 +2276,29 @@ extern "C"
     */
     SIMD_API void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Converts 24-bit BGR image to YUV422P with given YUV format type.
+
+        The input BGR and output Y images must have the same width and height.
+        The output U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of output YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdBgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
     /*! @ingroup bgr_conversion
 
         \fn void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
@@ -1748,6 +2322,29 @@ extern "C"
     */
     SIMD_API void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Converts 24-bit BGR image to YUV444P with given YUV format type.
+
+        The input BGR and output Y images must have the same width and height.
+        The output Y, U and V images must have the same width and height.
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of output YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdBgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
     /*! @ingroup binarization
 
         \fn void SimdBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType);
@@ -2830,6 +3427,26 @@ extern "C"
     */
     SIMD_API void SimdUint8ToFloat32(const uint8_t * src, size_t size, const float * lower, const float * upper, float * dst);
 
+    /*! @ingroup other_conversion
+
+        \fn void SimdUint16ToFloat32(const uint16_t * src, size_t size, int bits, const float * lower, const float * upper, float * dst);
+
+        \short Converts numbers in the array from 16-bit unsigned integer to 32-bit float format.
+
+        For every element:
+        \verbatim
+        dst[i] = src[i]*(upper - lower)/(2^bits - 1) + lower;
+        \endverbatim
+
+        \param [in] src - a pointer to the input array with 16-bit unsigned integer numbers (for example 10, 12 or 16-bit image samples).
+        \param [in] size - a size of input and output array.
+        \param [in] bits - a bit depth of input numbers (from 1 to 16).
+        \param [in] lower - a pointer to lower bound of the output array.
+        \param [in] upper - a pointer to upper bound of the output array.
+        \param [out] dst - a pointer to the output array with 32-bit float point numbers.
+    */
+    SIMD_API void SimdUint16ToFloat32(const uint16_t * src, size_t size, int bits, const float * lower, const float * upper, float * dst);
+
     /*! @ingroup correlation
 
         \fn void SimdCosineDistance32f(const float * a, const float * b, size_t size, float * distance);
@@ -3472,6 +4089,46 @@ extern "C"
     */
     SIMD_API void SimdHogLiteCreateMask(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const float * threshold, size_t scale, size_t size, uint32_t * dst, size_t dstStride);
 
+    /*! @ingroup other_conversion
+
+        \fn void SimdHslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride);
+
+        \short Converts 24-bit HSL(Hue, Saturation, Lightness) image to 24-bit BGR image.
+
+        All images must have the same width and height.
+        It is the inverse of ::SimdBgrToHsl.
+
+        \note This function has a C++ wrapper Simd::HslToBgr(const View<A>& hsl, View<A>& bgr).
+
+        \param [in] hsl - a pointer to pixels data of input 24-bit HSL image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] hslStride - a row size of the hsl image.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+    */
+    SIMD_API void SimdHslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride);
+
+    /*! @ingroup other_conversion
+
+        \fn void SimdHsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride);
+
+        \short Converts 24-bit HSV(Hue, Saturation, Value) image to 24-bit BGR image.
+
+        All images must have the same width and height.
+        It is the inverse of ::SimdBgrToHsv.
+
+        \note This function has a C++ wrapper Simd::HsvToBgr(const View<A>& hsv, View<A>& bgr).
+
+        \param [in] hsv - a pointer to pixels data of input 24-bit HSV image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] hsvStride - a row size of the hsv image.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+    */
+    SIMD_API void SimdHsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride);
+
     /*! @ingroup other_conversion
 
         \fn void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride);
@@ -3496,6 +4153,31 @@ extern "C"
     */
     SIMD_API void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup other_conversion
+
+        \fn void SimdUint16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, int shift, uint8_t * dst, size_t dstStride);
+
+        \short Converts 16-bit unsigned integer image (for example 10, 12 or 16-bit samples) to 8-bit gray image with shift and saturation.
+
+        All images must have the same width and height.
+
+        For every point:
+        \verbatim
+        dst[i] = Min(src[i] >> shift, 255);
+        \endverbatim
+
+        \note This function has a C++ wrapper Simd::Uint16ToGray(const View<A> & src, View<A> & dst, int shift).
+
+        \param [in] src - a pointer to pixels data of input 16-bit unsigned integer image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] srcStride - a row size of the 16-bit unsigned integer image.
+        \param [in] shift - a right shift of input values (for example 2 for 10-bit samples or 8 for MSB-aligned P010 samples).
+        \param [out] dst - a pointer to pixels data of input 8-bit gray image.
+        \param [out] dstStride - a row size of the gray image.
+    */
+    SIMD_API void SimdUint16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, int shift, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup integral
 
         \fn void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride, SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat);
@@ -3707,6 +4389,26 @@ extern "C"
     SIMD_API void SimdInterleaveBgra(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride, const uint8_t * a, size_t aStride,
         size_t width, size_t height, uint8_t * bgra, size_t bgraStride);
 
+    /*! @ingroup other_conversion
+
+        \fn void SimdLabToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride);
+
+        \short Converts 24-bit CIE Lab image to 24-bit BGR image.
+
+        All images must have the same width and height.
+        It is the inverse of ::SimdBgrToLab (sRGB gamma, D65 white point, L scaled to [0, 255], a and b shifted by 128).
+
+        \note This function has a C++ wrapper Simd::LabToBgr(const View<A>& lab, View<A>& bgr).
+
+        \param [in] lab - a pointer to pixels data of input 24-bit Lab image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] labStride - a row size of the lab image.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+    */
+    SIMD_API void SimdLabToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride);
+
     /*! @ingroup laplace_filter
 
         \fn void SimdLaplace(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
@@ -3806,6 +4508,96 @@ extern "C"
     */
     SIMD_API void SimdLbpEstimate(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup other_conversion
+
+        \fn void * SimdColorMatrixInit(const float * matrix, const uint8_t * gamma, SimdPixelFormatType format, SimdBool precise);
+
+        \short Creates context of color matrix transformation (color correction matrix, white balance, offset and optional gamma correction).
+
+        Algorithm description:
+        \verbatim
+        for(c = 0; c < 3; ++c)
+            dst[c] = gamma[c][RestrictRange(m[c][0]*src[0] + m[c][1]*src[1] + m[c][2]*src[2] + m[c][3], 0, 255)];
+        \endverbatim
+        where src[0], src[1], src[2] are blue, green and red channels of input pixel, m is 3x4 matrix. Alpha channel of BGRA-32 image is copied.
+
+        \param [in] matrix - a pointer to 3x4 matrix (12 float values in row-major order). Rows produce blue, green and red output channels.
+            The first three columns are weights of blue, green and red input channels, the last column is an offset (in 8-bit units).
+        \param [in] gamma - a pointer to optional gamma tables (3 tables of 256 unsigned 8-bit values for blue, green and red channels). Can be NULL.
+        \param [in] format - a pixel format of input and output images. It can be ::SimdPixelFormatBgr24 or ::SimdPixelFormatBgra32.
+        \param [in] precise - a flag of calculation precision. If it is ::SimdFalse then 16-bit fixed-point arithmetic is used 
+            (weights are quantized with 12-bit precision and must be in range (-8, 8)), else 32-bit float arithmetic is used.
+        \return a pointer to color matrix context. On error it returns NULL.
+                This pointer is used in function ::SimdColorMatrixRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdColorMatrixInit(const float * matrix, const uint8_t * gamma, SimdPixelFormatType format, SimdBool precise);
+
+    /*! @ingroup other_conversion
+
+        \fn void SimdColorMatrixRun(const void * colorMatrix, const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+        \short Applies color matrix transformation to BGR-24 or BGRA-32 image.
+
+        Input and output images must have the same width, height and format. The image is processed by rows in several threads
+        (see ::SimdSetThreadNumber). Input and output images can be the same (in-place processing).
+
+        \note This function has a C++ wrapper Simd::ColorMatrixRun(const void * colorMatrix, const View<A>& src, View<A>& dst).
+
+        \param [in] colorMatrix - a color matrix context. It must be created by function ::SimdColorMatrixInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of input image.
+        \param [in] srcStride - a row size (in bytes) of input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] dst - a pointer to pixels data of output image.
+        \param [in] dstStride - a row size (in bytes) of output image.
+    */
+    SIMD_API void SimdColorMatrixRun(const void * colorMatrix, const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup other_conversion
+
+        \fn void * SimdLut3dInit(const float * table, size_t size, SimdPixelFormatType format, SimdLut3dInterpolationType interpolation);
+
+        \short Creates 3D color lookup table context.
+
+        The table has .cube file layout: it contains size*size*size nodes, each node is RGB triplet of float values in range [0, 1] 
+        (values outside of this range are clamped). Red index changes fastest, then green, then blue:
+        \verbatim
+        node(r, g, b) = table + ((b * size + g) * size + r) * 3;
+        \endverbatim
+        The context keeps own copy of the table (quantized to 10 bits per channel).
+
+        \param [in] table - a pointer to table nodes (size*size*size RGB triplets of 32-bit float values).
+        \param [in] size - a size of the table along every axis. It must be in range [2, 256] (typical values are 17, 33 and 65).
+        \param [in] format - a pixel format of input and output images. It can be ::SimdPixelFormatBgr24 or ::SimdPixelFormatBgra32 (alpha channel is copied).
+        \param [in] interpolation - an interpolation method (see ::SimdLut3dInterpolationType).
+        \return a pointer to 3D color lookup table context. On error it returns NULL.
+                This pointer is used in function ::SimdLut3dRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdLut3dInit(const float * table, size_t size, SimdPixelFormatType format, SimdLut3dInterpolationType interpolation);
+
+    /*! @ingroup other_conversion
+
+        \fn void SimdLut3dRun(const void * lut3d, const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+        \short Applies 3D color lookup table to BGR-24 or BGRA-32 image.
+
+        Input and output images must have the same width, height and format. The image is processed by rows in several threads 
+        (see ::SimdSetThreadNumber). Input and output images can be the same (in-place processing).
+
+        \note This function has a C++ wrapper Simd::Lut3dRun(const void * lut3d, const View<A>& src, View<A>& dst).
+
+        \param [in] lut3d - a 3D color lookup table context. It must be created by function ::SimdLut3dInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of input image.
+        \param [in] srcStride - a row size (in bytes) of input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] dst - a pointer to pixels data of output image.
+        \param [in] dstStride - a row size (in bytes) of output image.
+    */
+    SIMD_API void SimdLut3dRun(const void * lut3d, const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup other_filter
 
         \fn void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
@@ -4562,17 +5354,169 @@ extern "C"
     */
     SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
 
-    /*! @ingroup operation
+    /*! @ingroup yuv_conversion
 
-        \fn void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
+        \fn void SimdNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
 
-        \short Performs given operation between two images.
+        \short Converts NV12 image (Y plane and interleaved UV plane) with given YUV format type to 32-bit BGRA image.
 
-        All images must have the same width, height and format (8-bit gray, 16-bit UV (UV plane of NV12 pixel format), 24-bit BGR or 32-bit BGRA).
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half size relative to Y component (its row contains interleaved U and V values).
+        It is a single pass conversion without intermediate U and V planes.
 
-        \note This function has a C++ wrappers: Simd::OperationBinary8u(const View<A>& a, const View<A>& b, View<A>& dst, SimdOperationBinary8uType type).
+        \note This function has a C++ wrapper Simd::Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601).
 
-        \param [in] a - a pointer to pixels data of the first input image.
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color plane.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+        uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts NV12 image (Y plane and interleaved UV plane) with given YUV format type to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image must have half size relative to Y component (its row contains interleaved U and V values).
+        It is a single pass conversion without intermediate U and V planes.
+
+        \note This function has a C++ wrapper Simd::Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color plane.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+        uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts NV12 image (Y plane and interleaved UV plane) with given YUV format type to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input UV image must have half size relative to Y component (its row contains interleaved U and V values).
+        It is a single pass conversion without intermediate U and V planes.
+
+        \note This function has a C++ wrapper Simd::Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color plane.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+        uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts NV21 image (Y plane and interleaved VU plane) with given YUV format type to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input VU image must have half size relative to Y component (its row contains interleaved V and U values).
+        It is a single pass conversion without intermediate U and V planes.
+
+        \note This function has a C++ wrapper Simd::Nv21ToBgra(const View<A>& y, const View<A>& vu, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] vu - a pointer to pixels data of input 16-bit image with interleaved VU color plane.
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height,
+        uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts NV21 image (Y plane and interleaved VU plane) with given YUV format type to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input VU image must have half size relative to Y component (its row contains interleaved V and U values).
+        It is a single pass conversion without intermediate U and V planes.
+
+        \note This function has a C++ wrapper Simd::Nv21ToBgr(const View<A>& y, const View<A>& vu, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] vu - a pointer to pixels data of input 16-bit image with interleaved VU color plane.
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height,
+        uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts NV21 image (Y plane and interleaved VU plane) with given YUV format type to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input VU image must have half size relative to Y component (its row contains interleaved V and U values).
+        It is a single pass conversion without intermediate U and V planes.
+
+        \note This function has a C++ wrapper Simd::Nv21ToRgb(const View<A>& y, const View<A>& vu, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] vu - a pointer to pixels data of input 16-bit image with interleaved VU color plane.
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height,
+        uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+    /*! @ingroup operation
+
+        \fn void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
+
+        \short Performs given operation between two images.
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV (UV plane of NV12 pixel format), 24-bit BGR or 32-bit BGRA).
+
+        \note This function has a C++ wrappers: Simd::OperationBinary8u(const View<A>& a, const View<A>& b, View<A>& dst, SimdOperationBinary8uType type).
+
+        \param [in] a - a pointer to pixels data of the first input image.
         \param [in] aStride - a row size of the first image.
         \param [in] b - a pointer to pixels data of the second input image.
         \param [in] bStride - a row size of the second image.
@@ -4856,6 +5800,7 @@ extern "C"
         \short Performs resizing of input image with using bilinear interpolation.
 
         All images must have the same format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+        Large images are processed by horizontal bands of output image in parallel (see ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
 
         \note This function has a C++ wrappers: Simd::ResizeBilinear(const View<A>& src, View<A>& dst).
 
@@ -4884,7 +5829,8 @@ extern "C"
         \param [in] dstY - a height of the output image.
         \param [in] channels - a channel number of input and output image.
         \param [in] type - a type of input and output image channel.
-        \param [in] method - a method used in order to resize image.
+        \param [in] method - a method used in order to resize image. 
+            Methods ::SimdResizeMethodBicubic, ::SimdResizeMethodBicubicPil and ::SimdResizeMethodLanczos support only ::SimdResizeChannelByte and ::SimdResizeChannelFloat channel types.
         \return a pointer to resize context. On error it returns NULL. 
                 This pointer is used in functions ::SimdResizerRun. 
                 It must be released with using of function ::SimdRelease.
@@ -4897,6 +5843,9 @@ extern "C"
 
         \short Performs image resizing.
 
+        \note Bilinear and area resizing of ::SimdResizeChannelByte, ::SimdResizeChannelFloat and ::SimdResizeChannelShort images 
+            support multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] resizer - a resize context. It must be created by function ::SimdResizerInit and released by function ::SimdRelease.
         \param [in] src - a pointer to pixels data of the original input image.
         \param [in] srcStride - a row size (in bytes) of the input image.
@@ -4905,6 +5854,32 @@ extern "C"
     */
     SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup resizing
+
+        \fn size_t SimdResizerRunRows(const void * resizer, const uint8_t * src, size_t srcStride, size_t srcRowBeg, size_t srcRowEnd, uint8_t * dst, size_t dstStride);
+
+        \short Performs image resizing by horizontal strips of the input image (for example during image capture).
+
+        The function produces all rows of the output image which depend only on input rows with index less than srcRowEnd 
+        and have not been produced by previous call (which received input rows up to srcRowBeg). 
+        The input image must be filled in consecutive strips: [0, r1), [r1, r2), ..., [rN, srcY). 
+        All previously received input rows must stay valid in memory.
+        Bilinear and area resizing of ::SimdResizeChannelByte, ::SimdResizeChannelFloat and ::SimdResizeChannelShort images 
+        really process the image by strips (other methods process the whole image when the last strip is received).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] resizer - a resize context. It must be created by function ::SimdResizerInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image (to its first row).
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [in] srcRowBeg - a begin of the received strip of the input image (it must be equal to srcRowEnd of previous call or 0).
+        \param [in] srcRowEnd - an end of the received strip of the input image.
+        \param [out] dst - a pointer to pixels data of the resized output image (to its first row).
+        \param [in] dstStride - a row size (in bytes) of the output image.
+        \return a number of ready rows of the output image (all output rows with lesser index are ready).
+    */
+    SIMD_API size_t SimdResizerRunRows(const void * resizer, const uint8_t * src, size_t srcStride, size_t srcRowBeg, size_t srcRowEnd, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup rgb_conversion
 
         \fn void SimdRgbToBgra(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
@@ -5898,6 +6873,69 @@ extern "C"
     */
     SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src, float * buf, float * dst);
 
+    /*! @ingroup synet_convolution_fp32
+
+        \fn size_t SimdRuntimeCacheExport(char * data, size_t size);
+
+        \short Exports cache of runtime tuning of FP32 convolution and deconvolution algorithms.
+
+        Some FP32 convolution and deconvolution algorithms measure several GEMM kernels at first calls of forward propagation and select the fastest one.
+        The results are stored in process-wide cache, keyed by CPU model, problem shape (M, N, K), number of threads (see ::SimdSetThreadNumber) and set of candidate kernels (they depend on used SIMD instructions).
+        This cache can be exported and imported (see ::SimdRuntimeCacheImport) in order to skip tuning after restart of the application.
+
+        \param [out] data - a pointer to output buffer for the cache in text format (zero-terminated string). Can be NULL.
+        \param [in] size - a size of output buffer.
+        \return required size of output buffer (including terminating zero). The cache is written only if the output buffer is large enough.
+    */
+    SIMD_API size_t SimdRuntimeCacheExport(char * data, size_t size);
+
+    /*! @ingroup synet_convolution_fp32
+
+        \fn SimdBool SimdRuntimeCacheImport(const char * data);
+
+        \short Imports cache of runtime tuning of FP32 convolution and deconvolution algorithms.
+
+        Imported entries are added to current cache. Entries for other CPU models are kept but are not used.
+
+        \note The cache can also be loaded at program start from file given by environment variable SIMD_RUNTIME_CACHE.
+
+        \param [in] data - a cache in text format (zero-terminated string) created by function ::SimdRuntimeCacheExport.
+        \return result of the operation (SimdFalse if the data is NULL or has wrong format).
+    */
+    SIMD_API SimdBool SimdRuntimeCacheImport(const char * data);
+
+    /*! @ingroup synet_convolution_fp32
+
+        \fn SimdBool SimdRuntimeCacheSave(const char * path);
+
+        \short Saves cache of runtime tuning of FP32 convolution and deconvolution algorithms to file (see ::SimdRuntimeCacheExport).
+
+        \param [in] path - a path to output file.
+        \return result of the operation.
+    */
+    SIMD_API SimdBool SimdRuntimeCacheSave(const char * path);
+
+    /*! @ingroup synet_convolution_fp32
+
+        \fn SimdBool SimdRuntimeCacheLoad(const char * path);
+
+        \short Loads cache of runtime tuning of FP32 convolution and deconvolution algorithms from file (see ::SimdRuntimeCacheImport).
+
+        It is used to pre-warm the cache before creation of the algorithms.
+
+        \param [in] path - a path to input file.
+        \return result of the operation.
+    */
+    SIMD_API SimdBool SimdRuntimeCacheLoad(const char * path);
+
+    /*! @ingroup synet_convolution_fp32
+
+        \fn void SimdRuntimeCacheClear();
+
+        \short Clears cache of runtime tuning of FP32 convolution and deconvolution algorithms.
+    */
+    SIMD_API void SimdRuntimeCacheClear();
+
     /*! @ingroup synet_convolution_int8
 
         \fn void * SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
@@ -6607,6 +7645,73 @@ extern "C"
     */
     SIMD_API void SimdSynetMergedConvolution8iForward(void* context, const uint8_t* src, uint8_t* buf, uint8_t* dst);
 
+    /*! @ingroup synet_workspace
+
+        \fn void * SimdSynetWorkspaceInit();
+
+        \short Initilizes workspace: a temporary buffer which is shared between Synet layers.
+
+        Every layer (convolution, deconvolution, merged convolution) which is called with NULL external buffer allocates its own internal temporary buffer.
+        A network with many layers keeps many such buffers. The workspace allows to use one buffer which is enough for all added layers:
+
+        \verbatim
+        void * workspace = SimdSynetWorkspaceInit();
+        for (size_t i = 0; i < count; ++i)
+            SimdSynetWorkspaceAdd(workspace, layers[i], types[i]);
+        ...
+        SimdSynetConvolution32fForward(layers[0], src, (float*)SimdSynetWorkspaceBuffer(workspace), dst);
+        \endverbatim
+
+        \note The workspace buffer can be used only by one thread at the same time. 
+            The layers which share the workspace must run one after another: forward propagation of two layers must never overlap.
+
+        \return a pointer to workspace context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdSynetWorkspaceInit();
+
+    /*! @ingroup synet_workspace
+
+        \fn size_t SimdSynetWorkspaceAdd(void * workspace, const void * context, SimdSynetLayerType type);
+
+        \short Adds Synet layer to workspace. 
+
+        The size of workspace becomes equal to maximal size of external buffer of all added layers.
+
+        \param [in, out] workspace - a workspace context. It must be created by function ::SimdSynetWorkspaceInit and released by function ::SimdRelease.
+        \param [in] context - a context of Synet layer (for example it can be created by function ::SimdSynetConvolution32fInit).
+        \param [in] type - a type of Synet layer context (see ::SimdSynetLayerType).
+        \return size (in bytes) of external buffer required for the added layer. 
+            If the type of layer is unknown it returns SIZE_MAX and the layer is not added (it must not use the workspace buffer).
+    */
+    SIMD_API size_t SimdSynetWorkspaceAdd(void * workspace, const void * context, SimdSynetLayerType type);
+
+    /*! @ingroup synet_workspace
+
+        \fn size_t SimdSynetWorkspaceSize(const void * workspace);
+
+        \short Gets size (in bytes) of workspace buffer (maximal size of external buffer of all added layers).
+
+        \param [in] workspace - a workspace context. It must be created by function ::SimdSynetWorkspaceInit and released by function ::SimdRelease.
+        \return size (in bytes) of workspace buffer.
+    */
+    SIMD_API size_t SimdSynetWorkspaceSize(const void * workspace);
+
+    /*! @ingroup synet_workspace
+
+        \fn void * SimdSynetWorkspaceBuffer(void * workspace);
+
+        \short Gets pointer to workspace buffer.
+
+        The buffer is allocated (or reallocated if new layers were added) at first call of this function. 
+        It is aligned by ::SimdAlignment and can be passed to Forward function of every added layer (for example ::SimdSynetConvolution32fForward).
+
+        \note A reallocation invalidates all pointers returned by previous calls of this function: call it again after adding of new layers.
+
+        \param [in, out] workspace - a workspace context. It must be created by function ::SimdSynetWorkspaceInit and released by function ::SimdRelease.
+        \return a pointer to workspace buffer. It is NULL if the size of workspace is 0.
+    */
+    SIMD_API void * SimdSynetWorkspaceBuffer(void * workspace);
+
     /*! @ingroup synet_activation
 
         \fn void SimdSynetMish32f(const float* src, size_t size, const float* threshold, float* dst);
@@ -6923,6 +8028,108 @@ extern "C"
     SIMD_API void SimdSynetSetInput(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat, 
         const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat);
 
+    /*! @ingroup synet_conversion
+
+        \fn void SimdSynetSetInputBatch(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat, const float * rois, size_t count, size_t dstWidth, size_t dstHeight, const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat);
+
+        \short Crops and resizes several regions of image to the batch input of neural network of <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        Every region of interest is resized with using bilinear interpolation (with sub-pixel precision of region bounds) to the size dstWidth x dstHeight, 
+        then it is converted and normalized as in function ::SimdSynetSetInput and is written to the corresponding item of output batch tensor.
+        Conversion to gray uses float coefficients (0.114*B + 0.587*G + 0.299*R) and is applied after interpolation.
+        Regions are processed in parallel (see ::SimdSetThreadNumber).
+        Interpolation tables are reused for consecutive regions of the same size and sub-pixel offset.
+
+        \note This function has a C++ wrappers: Simd::SynetSetInputBatch(const View<A> & src, const float * rois, size_t count, size_t width, size_t height, const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType format).
+
+        \param [in] src - a pointer to pixels data of input image.
+        \param [in] width - a width of input image. It must be at least 2.
+        \param [in] height - a height of input image. It must be at least 2.
+        \param [in] stride - a row size of input image.
+        \param [in] srcFormat - a pixel format of input image. There are supported following pixel formats: ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24.
+        \param [in] rois - a pointer to the array of regions of interest. Every region is given by 4 float values: left, top, right and bottom bounds (in pixels).
+            A region with swapped bounds (right < left or bottom < top) is normalised, i.e. it is processed as the region with ordered bounds.
+            Regions may lie partially outside of the image: border pixels are repeated. Its size must be equal to 4*count.
+        \param [in] count - a number of regions of interest (the batch size of output tensor).
+        \param [in] dstWidth - a width of output image tensor.
+        \param [in] dstHeight - a height of output image tensor.
+        \param [in] lower - a pointer to the array with lower bound of values of the output tensor. The size of the array have to correspond number of channels in the output image tensor.
+        \param [in] upper - a pointer to the array with upper bound of values of the output tensor. The size of the array have to correspond number of channels in the output image tensor.
+        \param [out] dst - a pointer to the output 32-bit float batch tensor. Its size must be equal to count*channels*dstHeight*dstWidth.
+        \param [in] channels - a number of channels in the output image tensor. It can be 1 or 3.
+        \param [in] dstFormat - a format of output image tensor. There are supported following tensor formats: ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc.
+    */
+    SIMD_API void SimdSynetSetInputBatch(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+        const float * rois, size_t count, size_t dstWidth, size_t dstHeight, const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat);
+
+    /*! @ingroup synet_conversion
+
+        \fn void * SimdSynetSetInputInit(size_t srcWidth, size_t srcHeight, SimdPixelFormatType srcFormat, size_t dstWidth, size_t dstHeight, const float * lower, const float * upper, size_t channels, SimdTensorFormatType dstFormat, SimdResizeMethodType method, SimdBool letterbox, uint8_t padding);
+
+        \short Creates context of conversion of image (or its region) to the input of neural network of <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        The context holds the resizer and the intermediate buffer, so repeated calls of ::SimdSynetSetInputRun for images of the same size do not allocate memory.
+        The image is resized to the size dstWidth x dstHeight (or, in letterbox mode, to the largest size with the same aspect ratio placed in the center 
+        of the output tensor, the rest of the tensor is padded), then it is converted and normalized as in function ::SimdSynetSetInput.
+
+        \note This function has a C++ wrapper: Simd::SynetSetInput(const Frame<A> & src, const Rectangle<ptrdiff_t> & roi, size_t width, size_t height, const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType format, bool letterbox, uint8_t padding, SimdYuvType yuvType, SimdResizeMethodType method).
+
+        \param [in] srcWidth - a width of input image.
+        \param [in] srcHeight - a height of input image.
+        \param [in] srcFormat - a pixel format of input image. There are supported following pixel formats: ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24.
+        \param [in] dstWidth - a width of output image tensor.
+        \param [in] dstHeight - a height of output image tensor.
+        \param [in] lower - a pointer to the array with lower bound of values of the output tensor. The size of the array have to correspond number of channels in the output image tensor.
+        \param [in] upper - a pointer to the array with upper bound of values of the output tensor. The size of the array have to correspond number of channels in the output image tensor.
+        \param [in] channels - a number of channels in the output image tensor. It can be 1 or 3.
+        \param [in] dstFormat - a format of output image tensor. There are supported following tensor formats: ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc.
+        \param [in] method - a method of resizing.
+        \param [in] letterbox - a flag to keep aspect ratio of the input image.
+        \param [in] padding - a value (in range [0, 255], before normalization) of padding pixels in letterbox mode.
+        \return a pointer to the context. On error (unsupported format or method, zero size) it returns NULL.
+            This pointer is used in functions ::SimdSynetSetInputRun and ::SimdSynetSetInputRunRows. It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdSynetSetInputInit(size_t srcWidth, size_t srcHeight, SimdPixelFormatType srcFormat, size_t dstWidth, size_t dstHeight,
+        const float * lower, const float * upper, size_t channels, SimdTensorFormatType dstFormat, SimdResizeMethodType method, SimdBool letterbox, uint8_t padding);
+
+    /*! @ingroup synet_conversion
+
+        \fn void SimdSynetSetInputRun(const void * context, const uint8_t * src, size_t srcStride, float * dst);
+
+        \short Converts image to the input of neural network of <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \note The context uses internal buffer, so it must not be used from several threads at the same time.
+
+        \param [in] context - a context created by function ::SimdSynetSetInputInit.
+        \param [in] src - a pointer to pixels data of input image. Its size and format must correspond to the parameters of the context.
+        \param [in] srcStride - a row size (in bytes) of input image.
+        \param [out] dst - a pointer to the output 32-bit float image tensor. Its size must be equal to channels*dstHeight*dstWidth.
+    */
+    SIMD_API void SimdSynetSetInputRun(const void * context, const uint8_t * src, size_t srcStride, float * dst);
+
+    /*! @ingroup synet_conversion
+
+        \fn size_t SimdSynetSetInputRunRows(const void * context, const uint8_t * src, size_t srcStride, size_t srcRowBeg, size_t srcRowEnd, float * dst);
+
+        \short Converts image to the input of neural network of <a href="http://github.com/ermig1979/Synet">Synet Framework</a> by horizontal strips of the input image.
+
+        Each call resizes the rows of the output image which became ready after receiving of input rows [srcRowBeg, srcRowEnd) (see ::SimdResizerRunRows) 
+        and converts and normalizes them into the output tensor at once, so the image (for example, converted from YUV by strips) is processed in a single pass.
+        The input image must be filled in consecutive strips: [0, r1), [r1, r2), ..., [rN, srcHeight). All previously received input rows must stay valid in memory.
+        Function ::SimdSynetSetInputRun is equal to the sequence of calls of this function for the whole image.
+
+        \note The context uses internal buffer, so it must not be used from several threads at the same time.
+
+        \param [in] context - a context created by function ::SimdSynetSetInputInit.
+        \param [in] src - a pointer to pixels data of input image (to its first row). Its size and format must correspond to the parameters of the context.
+        \param [in] srcStride - a row size (in bytes) of input image.
+        \param [in] srcRowBeg - a begin of the received strip of the input image (it must be equal to srcRowEnd of previous call or 0).
+        \param [in] srcRowEnd - an end of the received strip of the input image.
+        \param [out] dst - a pointer to the output 32-bit float image tensor. Its size must be equal to channels*dstHeight*dstWidth.
+        \return a number of ready rows of the output tensor (all output rows with lesser index are ready).
+    */
+    SIMD_API size_t SimdSynetSetInputRunRows(const void * context, const uint8_t * src, size_t srcStride, size_t srcRowBeg, size_t srcRowEnd, float * dst);
+
     /*! @ingroup synet
 
         \fn void SimdSynetShuffleLayerForward(const float * src0, const float * src1, size_t channels0, size_t channels1, size_t spatial, float * dst0, float * dst1, SimdTensorFormatType format, int type);
@@ -7203,6 +8410,55 @@ extern "C"
     */
     SIMD_API void SimdTransformImage(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, SimdTransformType transform, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup transform
+
+        \fn void * SimdWarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border);
+
+        \short Creates context of affine warping of image.
+
+        Algorithm description:
+        \verbatim
+        for(y = 0; y < dstH; ++y)
+            for(x = 0; x < dstW; ++x)
+            {
+                sx = inv[0]*x + inv[1]*y + inv[2];
+                sy = inv[3]*x + inv[4]*y + inv[5];
+                dst[x, y] = Interpolate(src, sx, sy, border);
+            }
+        \endverbatim
+        where inv is inverse matrix to mat. Source coordinates are calculated in fixed-point arithmetic (with 10-bit fractional part).
+
+        \param [in] srcW - a width of the input image.
+        \param [in] srcH - a height of the input image.
+        \param [in] srcS - a row size (in bytes) of the input image.
+        \param [in] dstW - a width of the output image.
+        \param [in] dstH - a height of the output image.
+        \param [in] dstS - a row size (in bytes) of the output image.
+        \param [in] channels - a channel number of input and output image. It can be 1, 2, 3, 4.
+        \param [in] mat - a pointer to 2x3 matrix of affine transformation (6 values in row-major order) which maps points of the input image to points of the output image.
+        \param [in] flags - a flags of affine warping (channel type, interpolation method and border mode). See ::SimdWarpAffineFlags.
+        \param [in] border - a pointer to pixel value (channels values of given channel type) of constant border. Can be NULL (zero border).
+        \return a pointer to affine warping context. On error (wrong parameters or degenerate matrix) it returns NULL.
+                This pointer is used in function ::SimdWarpAffineRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdWarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border);
+
+    /*! @ingroup transform
+
+        \fn void SimdWarpAffineRun(const void * context, const uint8_t * src, uint8_t * dst);
+
+        \short Performs affine warping of image.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+            It has a C++ wrapper Simd::WarpAffine(const View<A>& src, const float* mat, View<A>& dst, SimdWarpAffineFlags flags, const uint8_t* border).
+
+        \param [in] context - a warp affine context. It must be created by function ::SimdWarpAffineInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [out] dst - a pointer to pixels data of the output image.
+    */
+    SIMD_API void SimdWarpAffineRun(const void * context, const uint8_t * src, uint8_t * dst);
+
     /*! @ingroup synet_winograd
 
         \fn void SimdWinogradKernel1x3Block1x4SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
@@ -7649,14 +8905,12 @@ extern "C"
 
     /*! @ingroup yuv_conversion
 
-        \fn void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+        \fn void SimdYuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
 
-        \short Converts YUV422P image to 24-bit BGR image.
+        \short Converts YUV420P image with given YUV format type to 24-bit BGR image.
 
         The input Y and output BGR images must have the same width and height.
-        The input U and V images must have the same width and height (their width is equal to half width of Y component).
-
-        \note This function has a C++ wrappers: Simd::Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr);
+        The input U and V images must have the same width and height (half size relative to Y component).
 
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
@@ -7668,19 +8922,69 @@ extern "C"
         \param [in] height - an image height.
         \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
         \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
     */
-    SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
-        size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+    SIMD_API void SimdYuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
 
     /*! @ingroup yuv_conversion
 
-        \fn void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+        \fn void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
-        \short Converts YUV444P image to 24-bit BGR image.
+        \short Converts YUV422P image to 24-bit BGR image.
 
-        The input Y, U, V and output BGR images must have the same width and height.
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \note This function has a C++ wrappers: Simd::Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr);
+        \note This function has a C++ wrappers: Simd::Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr);
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+    */
+    SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts YUV422P image with given YUV format type to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+
+        \short Converts YUV444P image to 24-bit BGR image.
+
+        The input Y, U, V and output BGR images must have the same width and height.
+
+        \note This function has a C++ wrappers: Simd::Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr);
 
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
@@ -7696,6 +9000,30 @@ extern "C"
     SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts YUV444P image with given YUV format type to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input Y, U and V images must have the same width and height.
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
@@ -7722,6 +9050,31 @@ extern "C"
     SIMD_API void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts YUV420P image with given YUV format type to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
@@ -7748,6 +9101,31 @@ extern "C"
     SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts YUV422P image with given YUV format type to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
@@ -7773,6 +9151,31 @@ extern "C"
     SIMD_API void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts YUV444P image with given YUV format type to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input Y, U and V images must have the same width and height.
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * hsl, size_t hslStride);
@@ -7895,6 +9298,30 @@ extern "C"
     SIMD_API void SimdYuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
         size_t width, size_t height, uint8_t* rgb, size_t rgbStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts YUV420P image with given YUV format type to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv420pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv422pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
@@ -7920,6 +9347,30 @@ extern "C"
     SIMD_API void SimdYuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
         size_t width, size_t height, uint8_t* rgb, size_t rgbStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv422pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts YUV422P image with given YUV format type to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv422pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv444pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
@@ -7944,6 +9395,352 @@ extern "C"
     SIMD_API void SimdYuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
         size_t width, size_t height, uint8_t* rgb, size_t rgbStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv444pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts YUV444P image with given YUV format type to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input Y, U and V images must have the same width and height.
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv444pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuyvToBgra(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts YUYV image (packed YUV 4:2:2) with given YUV format type to 32-bit BGRA image.
+
+        The input YUYV and output BGRA images must have the same width and height. The width must be even.
+
+        \note This function has a C++ wrapper Simd::YuyvToBgra(const View<A>& yuyv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] yuyv - a pointer to pixels data of input 16-bit YUYV image (packed YUV 4:2:2, bytes Y0 U Y1 V for each pair of pixels).
+        \param [in] yuyvStride - a row size of the yuyv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuyvToBgra(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+        uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuyvToBgr(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts YUYV image (packed YUV 4:2:2) with given YUV format type to 24-bit BGR image.
+
+        The input YUYV and output BGR images must have the same width and height. The width must be even.
+
+        \note This function has a C++ wrapper Simd::YuyvToBgr(const View<A>& yuyv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] yuyv - a pointer to pixels data of input 16-bit YUYV image (packed YUV 4:2:2, bytes Y0 U Y1 V for each pair of pixels).
+        \param [in] yuyvStride - a row size of the yuyv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuyvToBgr(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+        uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuyvToRgb(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts YUYV image (packed YUV 4:2:2) with given YUV format type to 24-bit RGB image.
+
+        The input YUYV and output RGB images must have the same width and height. The width must be even.
+
+        \note This function has a C++ wrapper Simd::YuyvToRgb(const View<A>& yuyv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] yuyv - a pointer to pixels data of input 16-bit YUYV image (packed YUV 4:2:2, bytes Y0 U Y1 V for each pair of pixels).
+        \param [in] yuyvStride - a row size of the yuyv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuyvToRgb(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+        uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+    /*! @ingroup other_conversion
+
+        \fn void SimdYuyvToGray(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * gray, size_t grayStride);
+
+        \short Extracts Y (luma) channel of YUYV image (packed YUV 4:2:2) into 8-bit gray image.
+
+        The input YUYV and output gray images must have the same width and height.
+
+        \note This function has a C++ wrapper Simd::YuyvToGray(const View<A>& yuyv, View<A>& gray).
+
+        \param [in] yuyv - a pointer to pixels data of input 16-bit YUYV image (packed YUV 4:2:2, bytes Y0 U Y1 V for each pair of pixels).
+        \param [in] yuyvStride - a row size of the yuyv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] gray - a pointer to pixels data of output 8-bit gray image.
+        \param [in] grayStride - a row size of the gray image.
+    */
+    SIMD_API void SimdYuyvToGray(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * gray, size_t grayStride);
+
+    /*! @ingroup other_conversion
+
+        \fn void SimdYuyvToNv12(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride);
+
+        \short Converts YUYV image (packed YUV 4:2:2) to NV12 image (Y plane and interleaved UV plane).
+
+        The input YUYV and output Y images must have the same width and height. The width and height must be even.
+        The output UV image must have half size relative to Y component (its row contains interleaved U and V values).
+        U and V values are averaged over each pair of rows.
+
+        \note This function has a C++ wrapper Simd::YuyvToNv12(const View<A>& yuyv, View<A>& y, View<A>& uv).
+
+        \param [in] yuyv - a pointer to pixels data of input 16-bit YUYV image (packed YUV 4:2:2, bytes Y0 U Y1 V for each pair of pixels).
+        \param [in] yuyvStride - a row size of the yuyv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] uv - a pointer to pixels data of output 16-bit image with interleaved UV color plane.
+        \param [in] uvStride - a row size of the uv image.
+    */
+    SIMD_API void SimdYuyvToNv12(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+        uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride);
+
+    /*! @ingroup other_conversion
+
+        \fn void SimdYuyvToYuv420p(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+        \short Converts YUYV image (packed YUV 4:2:2) to YUV420P image.
+
+        The input YUYV and output Y images must have the same width and height. The width and height must be even.
+        The output U and V images must have the same width and height (half size relative to Y component).
+        U and V values are averaged over each pair of rows.
+
+        \note This function has a C++ wrapper Simd::YuyvToYuv420p(const View<A>& yuyv, View<A>& y, View<A>& u, View<A>& v).
+
+        \param [in] yuyv - a pointer to pixels data of input 16-bit YUYV image (packed YUV 4:2:2, bytes Y0 U Y1 V for each pair of pixels).
+        \param [in] yuyvStride - a row size of the yuyv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+    */
+    SIMD_API void SimdYuyvToYuv420p(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+        uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdUyvyToBgra(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts UYVY image (packed YUV 4:2:2) with given YUV format type to 32-bit BGRA image.
+
+        The input UYVY and output BGRA images must have the same width and height. The width must be even.
+
+        \note This function has a C++ wrapper Simd::UyvyToBgra(const View<A>& uyvy, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] uyvy - a pointer to pixels data of input 16-bit UYVY image (packed YUV 4:2:2, bytes U Y0 V Y1 for each pair of pixels).
+        \param [in] uyvyStride - a row size of the uyvy image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdUyvyToBgra(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+        uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdUyvyToBgr(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts UYVY image (packed YUV 4:2:2) with given YUV format type to 24-bit BGR image.
+
+        The input UYVY and output BGR images must have the same width and height. The width must be even.
+
+        \note This function has a C++ wrapper Simd::UyvyToBgr(const View<A>& uyvy, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] uyvy - a pointer to pixels data of input 16-bit UYVY image (packed YUV 4:2:2, bytes U Y0 V Y1 for each pair of pixels).
+        \param [in] uyvyStride - a row size of the uyvy image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdUyvyToBgr(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+        uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdUyvyToRgb(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts UYVY image (packed YUV 4:2:2) with given YUV format type to 24-bit RGB image.
+
+        The input UYVY and output RGB images must have the same width and height. The width must be even.
+
+        \note This function has a C++ wrapper Simd::UyvyToRgb(const View<A>& uyvy, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] uyvy - a pointer to pixels data of input 16-bit UYVY image (packed YUV 4:2:2, bytes U Y0 V Y1 for each pair of pixels).
+        \param [in] uyvyStride - a row size of the uyvy image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdUyvyToRgb(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+        uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+    /*! @ingroup other_conversion
+
+        \fn void SimdUyvyToGray(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * gray, size_t grayStride);
+
+        \short Extracts Y (luma) channel of UYVY image (packed YUV 4:2:2) into 8-bit gray image.
+
+        The input UYVY and output gray images must have the same width and height.
+
+        \note This function has a C++ wrapper Simd::UyvyToGray(const View<A>& uyvy, View<A>& gray).
+
+        \param [in] uyvy - a pointer to pixels data of input 16-bit UYVY image (packed YUV 4:2:2, bytes U Y0 V Y1 for each pair of pixels).
+        \param [in] uyvyStride - a row size of the uyvy image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] gray - a pointer to pixels data of output 8-bit gray image.
+        \param [in] grayStride - a row size of the gray image.
+    */
+    SIMD_API void SimdUyvyToGray(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * gray, size_t grayStride);
+
+    /*! @ingroup other_conversion
+
+        \fn void SimdUyvyToNv12(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride);
+
+        \short Converts UYVY image (packed YUV 4:2:2) to NV12 image (Y plane and interleaved UV plane).
+
+        The input UYVY and output Y images must have the same width and height. The width and height must be even.
+        The output UV image must have half size relative to Y component (its row contains interleaved U and V values).
+        U and V values are averaged over each pair of rows.
+
+        \note This function has a C++ wrapper Simd::UyvyToNv12(const View<A>& uyvy, View<A>& y, View<A>& uv).
+
+        \param [in] uyvy - a pointer to pixels data of input 16-bit UYVY image (packed YUV 4:2:2, bytes U Y0 V Y1 for each pair of pixels).
+        \param [in] uyvyStride - a row size of the uyvy image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] uv - a pointer to pixels data of output 16-bit image with interleaved UV color plane.
+        \param [in] uvStride - a row size of the uv image.
+    */
+    SIMD_API void SimdUyvyToNv12(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+        uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride);
+
+    /*! @ingroup other_conversion
+
+        \fn void SimdUyvyToYuv420p(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+        \short Converts UYVY image (packed YUV 4:2:2) to YUV420P image.
+
+        The input UYVY and output Y images must have the same width and height. The width and height must be even.
+        The output U and V images must have the same width and height (half size relative to Y component).
+        U and V values are averaged over each pair of rows.
+
+        \note This function has a C++ wrapper Simd::UyvyToYuv420p(const View<A>& uyvy, View<A>& y, View<A>& u, View<A>& v).
+
+        \param [in] uyvy - a pointer to pixels data of input 16-bit UYVY image (packed YUV 4:2:2, bytes U Y0 V Y1 for each pair of pixels).
+        \param [in] uyvyStride - a row size of the uyvy image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+    */
+    SIMD_API void SimdUyvyToYuv420p(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+        uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420p16ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts high bit depth YUV420P image (10, 12 or 16-bit samples stored in 16-bit words) to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+        Input samples are reduced to 8 bits with using of right shift and saturation before conversion.
+
+        \note This function has a C++ wrapper Simd::Yuv420p16ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, int shift, uint8_t alpha, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 16-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 16-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] shift - a right shift of input samples (for example 2 for 10-bit LSB-aligned samples or 8 for MSB-aligned samples).
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv420p16ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdP016ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts P010/P016 image (NV12 layout with 16-bit samples) to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half size relative to Y component.
+        Input samples are reduced to 8 bits with using of right shift and saturation before conversion.
+
+        \note This function has a C++ wrapper Simd::P016ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, int shift, uint8_t alpha, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 32-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] shift - a right shift of input samples (8 for P010 and P016 which have MSB-aligned samples).
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdP016ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+        int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -70,6 +70,45 @@ namespace Simd
         os << std::endl;
     }
 
+    /*! @ingroup info
+
+        \short The TraceScope class passes begin and end events of user's region to the tracing callback (see ::SimdSetTraceCallback).
+
+        The begin event is passed in constructor, the end event is passed in destructor. It does nothing if tracing callback is not set.
+        It is used by default in macro SIMD_CHECK_PERFORMANCE in C++ wrappers (Simd::Detection, Simd::Motion, Simd::Neural).
+
+        \note This class is a C++ wrapper for function ::SimdTraceEvent.
+    */
+    class TraceScope
+    {
+        const char * _name;
+        bool _enabled;
+
+    public:
+        /*!
+            Creates a new TraceScope object and passes begin event of the region.
+
+            \param [in] name - a name of the region. It has to be valid until destruction of the object.
+            \param [in] size - an amount of work of the region (can be 0).
+        */
+        SIMD_INLINE TraceScope(const char * name, int64_t size = 0)
+            : _name(name)
+            , _enabled(SimdTraceEnabled() == SimdTrue)
+        {
+            if (_enabled)
+                SimdTraceEvent(SimdTraceEventBegin, _name, size);
+        }
+
+        /*!
+            Passes end event of the region and destroys the TraceScope object.
+        */
+        SIMD_INLINE ~TraceScope()
+        {
+            if (_enabled)
+                SimdTraceEvent(SimdTraceEventEnd, _name, 0);
+        }
+    };
+
     /*! @ingroup correlation
 
         \fn void AbsDifference(const View<A> & a, const View<A> & b, View<A> & c)
@@ -750,6 +789,31 @@ namespace Simd
         SimdBgraToGray(bgra.data, bgra.width, bgra.height, bgra.stride, gray.data, gray.stride);
     }
 
+    /*! @ingroup bgra_conversion
+
+        \fn void BgraToNv12(const View<A>& bgra, View<A>& y, View<A>& uv, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts 32-bit BGRA image to NV12 image (Y plane and interleaved UV plane).
+
+        The input BGRA and output Y images must have the same width and height.
+        The output UV image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdBgraToNv12.
+
+        \param [in] bgra - an input 32-bit BGRA image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] uv - an output 16-bit image with interleaved UV color plane.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void BgraToNv12(const View<A>& bgra, View<A>& y, View<A>& uv, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && uv.format == View<A>::Uv16);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdBgraToNv12(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, uv.data, uv.stride, yuvType);
+    }
+
     /*! @ingroup bgra_conversion
 
         \fn void BgraToRgb(const View<A>& bgra, View<A>& rgb)
@@ -772,77 +836,80 @@ namespace Simd
 
     /*! @ingroup bgra_conversion
 
-        \fn void BgraToYuv420p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
+        \fn void BgraToYuv420p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts 32-bit BGRA image to YUV420P.
 
         The input BGRA and output Y images must have the same width and height.
         The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function is a C++ wrapper for function ::SimdBgraToYuv420p.
+        \note This function is a C++ wrapper for functions ::SimdBgraToYuv420p and ::SimdBgraToYuv420pV2.
 
         \param [in] bgra - an input 32-bit BGRA image.
         \param [out] y - an output 8-bit image with Y color plane.
         \param [out] u - an output 8-bit image with U color plane.
         \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
     */
-    template<template<class> class A> SIMD_INLINE void BgraToYuv420p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
+    template<template<class> class A> SIMD_INLINE void BgraToYuv420p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
         assert(y.width == bgra.width && y.height == bgra.height);
         assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
 
-        SimdBgraToYuv420p(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+        SimdBgraToYuv420pV2(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
     }
 
     /*! @ingroup bgra_conversion
 
-        \fn void BgraToYuv422p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
+        \fn void BgraToYuv422p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts 32-bit BGRA image to YUV422P.
 
         The input BGRA and output Y images must have the same width and height.
         The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \note This function is a C++ wrapper for function ::SimdBgraToYuv422p.
+        \note This function is a C++ wrapper for functions ::SimdBgraToYuv422p and ::SimdBgraToYuv422pV2.
 
         \param [in] bgra - an input 32-bit BGRA image.
         \param [out] y - an output 8-bit image with Y color plane.
         \param [out] u - an output 8-bit image with U color plane.
         \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
     */
-    template<template<class> class A> SIMD_INLINE void BgraToYuv422p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
+    template<template<class> class A> SIMD_INLINE void BgraToYuv422p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
         assert(y.width == bgra.width && y.height == bgra.height);
         assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
 
-        SimdBgraToYuv422p(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+        SimdBgraToYuv422pV2(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
     }
 
     /*! @ingroup bgra_conversion
 
-        \fn void BgraToYuv444p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
+        \fn void BgraToYuv444p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts 32-bit BGRA image to YUV444P.
 
         The input BGRA and output Y, U and V images must have the same width and height.
 
-        \note This function is a C++ wrapper for function ::SimdBgraToYuv444p.
+        \note This function is a C++ wrapper for functions ::SimdBgraToYuv444p and ::SimdBgraToYuv444pV2.
 
         \param [in] bgra - an input 32-bit BGRA image.
         \param [out] y - an output 8-bit image with Y color plane.
         \param [out] u - an output 8-bit image with U color plane.
         \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
     */
-    template<template<class> class A> SIMD_INLINE void BgraToYuv444p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
+    template<template<class> class A> SIMD_INLINE void BgraToYuv444p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(EqualSize(bgra, y) && Compatible(y, u, v));
         assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
 
-        SimdBgraToYuv444p(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+        SimdBgraToYuv444pV2(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
     }
 
     /*! @ingroup bgra_conversion
@@ -997,6 +1064,52 @@ namespace Simd
         SimdBgrToHsv(bgr.data, bgr.width, bgr.height, bgr.stride, hsv.data, hsv.stride);
     }
 
+    /*! @ingroup bgr_conversion
+
+        \fn void BgrToLab(const View<A> & bgr, View<A> & lab)
+
+        \short Converts 24-bit BGR image to 24-bit CIE Lab image.
+
+        All images must have the same width and height.
+        Conversion uses sRGB gamma and D65 white point. Output L is scaled to [0, 255], a and b are shifted by 128.
+
+        \note This function is a C++ wrapper for function ::SimdBgrToLab.
+
+        \param [in] bgr - an input 24-bit BGR image.
+        \param [out] lab - an output 24-bit Lab image.
+    */
+    template<template<class> class A> SIMD_INLINE void BgrToLab(const View<A> & bgr, View<A> & lab)
+    {
+        assert(EqualSize(bgr, lab) && bgr.format == View<A>::Bgr24 && lab.format == View<A>::Lab24);
+
+        SimdBgrToLab(bgr.data, bgr.width, bgr.height, bgr.stride, lab.data, lab.stride);
+    }
+
+    /*! @ingroup bgr_conversion
+
+        \fn void BgrToNv12(const View<A>& bgr, View<A>& y, View<A>& uv, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts 24-bit BGR image to NV12 image (Y plane and interleaved UV plane).
+
+        The input BGR and output Y images must have the same width and height.
+        The output UV image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdBgrToNv12.
+
+        \param [in] bgr - an input 24-bit BGR image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] uv - an output 16-bit image with interleaved UV color plane.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void BgrToNv12(const View<A>& bgr, View<A>& y, View<A>& uv, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && uv.format == View<A>::Uv16);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdBgrToNv12(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, uv.data, uv.stride, yuvType);
+    }
+
     /*! @ingroup bgr_conversion
 
         \fn void BgrToRgb(const View<A> & bgr, View<A> & rgb)
@@ -1019,77 +1132,80 @@ namespace Simd
 
     /*! @ingroup bgr_conversion
 
-        \fn void BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+        \fn void BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts 24-bit BGR image to YUV420P.
 
         The input BGR and output Y images must have the same width and height.
         The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function is a C++ wrapper for function ::SimdBgrToYuv420p.
+        \note This function is a C++ wrapper for functions ::SimdBgrToYuv420p and ::SimdBgrToYuv420pV2.
 
         \param [in] bgr - an input 24-bit BGR image.
         \param [out] y - an output 8-bit image with Y color plane.
         \param [out] u - an output 8-bit image with U color plane.
         \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
     */
-    template<template<class> class A> SIMD_INLINE void BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+    template<template<class> class A> SIMD_INLINE void BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
         assert(y.width == bgr.width && y.height == bgr.height);
         assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
 
-        SimdBgrToYuv420p(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+        SimdBgrToYuv420pV2(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
     }
 
     /*! @ingroup bgr_conversion
 
-        \fn void BgrToYuv422p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+        \fn void BgrToYuv422p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts 24-bit BGR image to YUV422P.
 
         The input BGR and output Y images must have the same width and height.
         The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \note This function is a C++ wrapper for function ::SimdBgrToYuv422p.
+        \note This function is a C++ wrapper for functions ::SimdBgrToYuv422p and ::SimdBgrToYuv422pV2.
 
         \param [in] bgr - an input 24-bit BGR image.
         \param [out] y - an output 8-bit image with Y color plane.
         \param [out] u - an output 8-bit image with U color plane.
         \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
     */
-    template<template<class> class A> SIMD_INLINE void BgrToYuv422p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+    template<template<class> class A> SIMD_INLINE void BgrToYuv422p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
         assert(y.width == bgr.width && y.height == bgr.height);
         assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
 
-        SimdBgrToYuv422p(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+        SimdBgrToYuv422pV2(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
     }
 
     /*! @ingroup bgr_conversion
 
-        \fn void BgrToYuv444p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+        \fn void BgrToYuv444p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts 24-bit BGR image to YUV444P.
 
         The input BGR and output Y, U and V images must have the same width and height.
 
-        \note This function is a C++ wrapper for function ::SimdBgrToYuv444p.
+        \note This function is a C++ wrapper for functions ::SimdBgrToYuv444p and ::SimdBgrToYuv444pV2.
 
         \param [in] bgr - an input 24-bit BGR image.
         \param [out] y - an output 8-bit image with Y color plane.
         \param [out] u - an output 8-bit image with U color plane.
         \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
     */
-    template<template<class> class A> SIMD_INLINE void BgrToYuv444p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+    template<template<class> class A> SIMD_INLINE void BgrToYuv444p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(EqualSize(bgr, y) && Compatible(y, u, v));
         assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
 
-        SimdBgrToYuv444p(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+        SimdBgrToYuv444pV2(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
     }
 
     /*! @ingroup binarization
@@ -1209,6 +1325,27 @@ namespace Simd
         SimdAveragingBinarizationV2(src.data, src.stride, src.width, src.height, neighborhood, shift, positive, negative, dst.data, dst.stride);
     }
 
+    /*! @ingroup other_conversion
+
+        \fn void ColorMatrixRun(const void * colorMatrix, const View<A>& src, View<A>& dst)
+
+        \short Applies color matrix transformation to BGR-24 or BGRA-32 image.
+
+        All images must have the same width, height and format. Input and output images can be the same.
+
+        \note This function is a C++ wrapper for function ::SimdColorMatrixRun.
+
+        \param [in] colorMatrix - a color matrix context. It must be created by function ::SimdColorMatrixInit with the same pixel format.
+        \param [in] src - an input BGR-24 or BGRA-32 image.
+        \param [out] dst - an output image.
+    */
+    template<template<class> class A> SIMD_INLINE void ColorMatrixRun(const void * colorMatrix, const View<A>& src, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && (src.format == View<A>::Bgr24 || src.format == View<A>::Bgra32));
+
+        SimdColorMatrixRun(colorMatrix, src.data, src.stride, src.width, src.height, dst.data, dst.stride);
+    }
+
     /*! @ingroup conditional
 
         \fn void ConditionalCount8u(const View<A> & src, uint8_t value, SimdCompareType compareType, uint32_t & count)
@@ -2080,6 +2217,46 @@ namespace Simd
         SimdHogLiteExtractFeatures(src.data, src.stride, src.width, src.height, cell, features, featuresStride);
     }
 
+    /*! @ingroup other_conversion
+
+        \fn void HslToBgr(const View<A> & hsl, View<A> & bgr)
+
+        \short Converts 24-bit HSL(Hue, Saturation, Lightness) image to 24-bit BGR image.
+
+        All images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdHslToBgr.
+
+        \param [in] hsl - an input 24-bit HSL image.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void HslToBgr(const View<A> & hsl, View<A> & bgr)
+    {
+        assert(EqualSize(hsl, bgr) && hsl.format == View<A>::Hsl24 && bgr.format == View<A>::Bgr24);
+
+        SimdHslToBgr(hsl.data, hsl.width, hsl.height, hsl.stride, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup other_conversion
+
+        \fn void HsvToBgr(const View<A> & hsv, View<A> & bgr)
+
+        \short Converts 24-bit HSV(Hue, Saturation, Value) image to 24-bit BGR image.
+
+        All images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdHsvToBgr.
+
+        \param [in] hsv - an input 24-bit HSV image.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void HsvToBgr(const View<A> & hsv, View<A> & bgr)
+    {
+        assert(EqualSize(hsv, bgr) && hsv.format == View<A>::Hsv24 && bgr.format == View<A>::Bgr24);
+
+        SimdHsvToBgr(hsv.data, hsv.width, hsv.height, hsv.stride, bgr.data, bgr.stride);
+    }
+
     /*! @ingroup other_conversion
 
         \fn void Int16ToGray(const View<A> & src, View<A> & dst)
@@ -2105,6 +2282,33 @@ namespace Simd
         SimdInt16ToGray(src.data, src.width, src.height, src.stride, dst.data, dst.stride);
     }
 
+    /*! @ingroup other_conversion
+
+        \fn void Uint16ToGray(const View<A> & src, View<A> & dst, int shift = 8)
+
+        \short Converts 16-bit unsigned integer image to 8-bit image with shift and saturation.
+
+        All images must have the same width and height. 
+        Supported pairs of formats: Int16 (as 16-bit unsigned) to Gray8 and Uv32 to Uv16.
+
+        For every point:
+        \verbatim
+        dst[i] = Min(src[i] >> shift, 255);
+        \endverbatim
+
+        \note This function is a C++ wrapper for function ::SimdUint16ToGray.
+
+        \param [in] src - an input 16-bit unsigned integer image.
+        \param [out] dst - an output 8-bit image.
+        \param [in] shift - a right shift of input values. It is equal to 8 by default (MSB-aligned samples).
+    */
+    template<template<class> class A> SIMD_INLINE void Uint16ToGray(const View<A> & src, View<A> & dst, int shift = 8)
+    {
+        assert(EqualSize(src, dst) && ((src.format == View<A>::Int16 && dst.format == View<A>::Gray8) || (src.format == View<A>::Uv32 && dst.format == View<A>::Uv16)));
+
+        SimdUint16ToGray(src.data, src.width * src.ChannelCount(), src.height, src.stride, shift, dst.data, dst.stride);
+    }
+
     /*! @ingroup integral
 
         \fn void Integral(const View<A>& src, View<A>& sum)
@@ -2356,6 +2560,26 @@ namespace Simd
         SimdInterleaveBgra(b.data, b.stride, g.data, g.stride, r.data, r.stride, a.data, a.stride, bgra.width, bgra.height, bgra.data, bgra.stride);
     }
 
+    /*! @ingroup other_conversion
+
+        \fn void LabToBgr(const View<A> & lab, View<A> & bgr)
+
+        \short Converts 24-bit CIE Lab image to 24-bit BGR image.
+
+        All images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdLabToBgr.
+
+        \param [in] lab - an input 24-bit Lab image.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void LabToBgr(const View<A> & lab, View<A> & bgr)
+    {
+        assert(EqualSize(lab, bgr) && lab.format == View<A>::Lab24 && bgr.format == View<A>::Bgr24);
+
+        SimdLabToBgr(lab.data, lab.width, lab.height, lab.stride, bgr.data, bgr.stride);
+    }
+
     /*! @ingroup laplace_filter
 
         \fn void Laplace(const View<A>& src, View<A>& dst)
@@ -2478,6 +2702,27 @@ namespace Simd
         SimdFree(buffer);
     }
 
+    /*! @ingroup other_conversion
+
+        \fn void Lut3dRun(const void * lut3d, const View<A>& src, View<A>& dst)
+
+        \short Applies 3D color lookup table to BGR-24 or BGRA-32 image.
+
+        All images must have the same width, height and format. Input and output images can be the same.
+
+        \note This function is a C++ wrapper for function ::SimdLut3dRun.
+
+        \param [in] lut3d - a 3D color lookup table context. It must be created by function ::SimdLut3dInit with the same pixel format.
+        \param [in] src - an input BGR-24 or BGRA-32 image.
+        \param [out] dst - an output image.
+    */
+    template<template<class> class A> SIMD_INLINE void Lut3dRun(const void * lut3d, const View<A>& src, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && (src.format == View<A>::Bgr24 || src.format == View<A>::Bgra32));
+
+        SimdLut3dRun(lut3d, src.data, src.stride, src.width, src.height, dst.data, dst.stride);
+    }
+
     /*! @ingroup other_filter
 
         \fn void MeanFilter3x3(const View<A>& src, View<A>& dst)
@@ -2612,6 +2857,158 @@ namespace Simd
         SimdNeuralConvert(src.data, src.stride, src.width, src.height, dst, stride, inversion ? 1 : 0);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image (Y plane and interleaved UV plane) to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgra.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color plane.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && uv.format == View<A>::Uv16);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdNv12ToBgra(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image (Y plane and interleaved UV plane) to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgr.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color plane.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && uv.format == View<A>::Uv16);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdNv12ToBgr(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image (Y plane and interleaved UV plane) to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input UV image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToRgb.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color plane.
+        \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && uv.format == View<A>::Uv16);
+        assert(y.width == rgb.width && y.height == rgb.height);
+        assert(y.format == View<A>::Gray8 && rgb.format == View<A>::Rgb24);
+
+        SimdNv12ToRgb(y.data, y.stride, uv.data, uv.stride, y.width, y.height, rgb.data, rgb.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv21ToBgra(const View<A>& y, const View<A>& vu, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV21 image (Y plane and interleaved VU plane) to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input VU image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv21ToBgra.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] vu - an input 16-bit image with interleaved VU color plane.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv21ToBgra(const View<A>& y, const View<A>& vu, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height && vu.format == View<A>::Uv16);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdNv21ToBgra(y.data, y.stride, vu.data, vu.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv21ToBgr(const View<A>& y, const View<A>& vu, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV21 image (Y plane and interleaved VU plane) to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input VU image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv21ToBgr.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] vu - an input 16-bit image with interleaved VU color plane.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv21ToBgr(const View<A>& y, const View<A>& vu, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height && vu.format == View<A>::Uv16);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdNv21ToBgr(y.data, y.stride, vu.data, vu.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv21ToRgb(const View<A>& y, const View<A>& vu, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV21 image (Y plane and interleaved VU plane) to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input VU image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv21ToRgb.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] vu - an input 16-bit image with interleaved VU color plane.
+        \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv21ToRgb(const View<A>& y, const View<A>& vu, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height && vu.format == View<A>::Uv16);
+        assert(y.width == rgb.width && y.height == rgb.height);
+        assert(y.format == View<A>::Gray8 && rgb.format == View<A>::Rgb24);
+
+        SimdNv21ToRgb(y.data, y.stride, vu.data, vu.stride, y.width, y.height, rgb.data, rgb.stride, yuvType);
+    }
+
     /*! @ingroup operation
 
         \fn void OperationBinary8u(const View<A>& a, const View<A>& b, View<A>& dst, SimdOperationBinary8uType type)
@@ -2968,7 +3365,7 @@ namespace Simd
     */
     template<template<class> class A> SIMD_INLINE void Resize(const View<A> & src, View<A> & dst, ::SimdResizeMethodType method = ::SimdResizeMethodBilinear)
     {
-        assert(src.format == dst.format && (src.format == View<A>::Float || src.ChannelSize() == 1));
+        assert(src.format == dst.format && (src.format == View<A>::Float || src.ChannelSize() == 1 || src.ChannelSize() == 2));
 
         if (EqualSize(src, dst))
         {
@@ -2976,7 +3373,8 @@ namespace Simd
         }
         else
         {
-            SimdResizeChannelType type = src.format == View<A>::Float ? SimdResizeChannelFloat : SimdResizeChannelByte;
+            SimdResizeChannelType type = src.format == View<A>::Float ? SimdResizeChannelFloat : 
+                (src.ChannelSize() == 2 ? SimdResizeChannelShort : SimdResizeChannelByte);
             void * resizer = SimdResizerInit(src.width, src.height, dst.width, dst.height, src.ChannelCount(), type, method);
             if (resizer)
             {
@@ -3793,6 +4191,34 @@ namespace Simd
         SimdSynetSetInput(src.data, src.width, src.height, src.stride, (SimdPixelFormatType)src.format, lower, upper, dst, channels, format);
     }
 
+    /*! @ingroup synet_conversion
+
+        \fn void SynetSetInputBatch(const View<A> & src, const float * rois, size_t count, size_t width, size_t height, const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType format)
+
+        \short Crops and resizes several regions of image to the batch input of neural network of <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \note This function is a C++ wrapper for function ::SimdSynetSetInputBatch.
+
+        \param [in] src - an input image. There are supported following image formats: View<A>::Gray8, View<A>::Bgr24, View<A>::Bgra32, View<A>::Rgb24.
+        \param [in] rois - a pointer to the array of regions of interest (left, top, right and bottom bounds for every region). Its size must be equal to 4*count.
+        \param [in] count - a number of regions of interest (the batch size of output tensor).
+        \param [in] width - a width of output image tensor.
+        \param [in] height - a height of output image tensor.
+        \param [in] lower - a pointer to the array with lower bound of values of the output tensor. The size of the array have to correspond number of channels in the output image tensor.
+        \param [in] upper - a pointer to the array with upper bound of values of the output tensor. The size of the array have to correspond number of channels in the output image tensor.
+        \param [out] dst - a pointer to the output 32-bit float batch tensor.
+        \param [in] channels - a number of channels in the output image tensor. It can be 1 or 3.
+        \param [in] format - a format of output image tensor. There are supported following tensor formats: ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc.
+    */
+    template<template<class> class A> SIMD_INLINE void SynetSetInputBatch(const View<A> & src, const float * rois, size_t count, size_t width, size_t height, 
+        const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType format)
+    {
+        assert(src.format == View<A>::Gray8 || src.format == View<A>::Bgr24 || src.format == View<A>::Bgra32 || src.format == View<A>::Rgb24);
+        assert(format == SimdTensorFormatNchw || format == SimdTensorFormatNhwc);
+
+        SimdSynetSetInputBatch(src.data, src.width, src.height, src.stride, (SimdPixelFormatType)src.format, rois, count, width, height, lower, upper, dst, channels, format);
+    }
+
     /*! @ingroup texture_estimation
 
         \fn void TextureBoostedSaturatedGradient(const View<A>& src, uint8_t saturation, uint8_t boost, View<A>& dx, View<A>& dy)
@@ -3957,6 +4383,38 @@ namespace Simd
         SimdTransformImage(src.data, src.stride, src.width, src.height, src.PixelSize(), transform, dst.data, dst.stride);
     }
 
+    /*! @ingroup transform
+
+        \fn void WarpAffine(const View<A>& src, const float* mat, View<A>& dst, SimdWarpAffineFlags flags = SimdWarpAffineInterpBilinear, const uint8_t* border = NULL)
+
+        \short Performs affine warping of image.
+
+        Input and output images must have the same format. Channel type and number of channels are defined by image format 
+            (::SimdWarpAffineChannelFloat is used for View::Float format).
+
+        \note This function is a C++ wrapper for functions ::SimdWarpAffineInit and ::SimdWarpAffineRun.
+
+        \param [in] src - an input image.
+        \param [in] mat - a pointer to 2x3 matrix of affine transformation which maps points of the input image to points of the output image.
+        \param [out] dst - an output image.
+        \param [in] flags - an interpolation method and border mode. By default it is bilinear interpolation with constant border.
+        \param [in] border - a pointer to pixel value of constant border. Can be NULL (zero border).
+    */
+    template<template<class> class A> SIMD_INLINE void WarpAffine(const View<A>& src, const float* mat, View<A>& dst, SimdWarpAffineFlags flags = SimdWarpAffineInterpBilinear, const uint8_t* border = NULL)
+    {
+        assert(src.format == dst.format && src.format != View<A>::None);
+
+        bool isFloat = src.format == View<A>::Float;
+        size_t channels = isFloat ? 1 : src.PixelSize();
+        flags = (SimdWarpAffineFlags)((flags & ~SimdWarpAffineChannelMask) | (isFloat ? SimdWarpAffineChannelFloat : SimdWarpAffineChannelByte));
+        void* context = SimdWarpAffineInit(src.width, src.height, src.stride, dst.width, dst.height, dst.stride, channels, mat, flags, border);
+        if (context)
+        {
+            SimdWarpAffineRun(context, src.data, dst.data);
+            SimdRelease(context);
+        }
+    }
+
     /*! @ingroup yuv_conversion
 
         \fn void Yuva420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, const View<A>& a, View<A>& bgra)
@@ -3986,153 +4444,159 @@ namespace Simd
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv420pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+        \fn void Yuv420pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts YUV420P image to 24-bit BGR image.
 
         The input Y and output BGR images must have the same width and height.
         The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function is a C++ wrapper for function ::SimdYuv420pToBgr.
+        \note This function is a C++ wrapper for functions ::SimdYuv420pToBgr and ::SimdYuv420pToBgrV2.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
         \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
     */
-    template<template<class> class A> SIMD_INLINE void Yuv420pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+    template<template<class> class A> SIMD_INLINE void Yuv420pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
         assert(y.width == bgr.width && y.height == bgr.height);
         assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
 
-        SimdYuv420pToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride);
+        SimdYuv420pToBgrV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
     }
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+        \fn void Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts YUV422P image to 24-bit BGR image.
 
         The input Y and output BGR images must have the same width and height.
         The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \note This function is a C++ wrapper for function ::SimdYuv422pToBgr.
+        \note This function is a C++ wrapper for functions ::SimdYuv422pToBgr and ::SimdYuv422pToBgrV2.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
         \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
     */
-    template<template<class> class A> SIMD_INLINE void Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+    template<template<class> class A> SIMD_INLINE void Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
         assert(y.width == bgr.width && y.height == bgr.height);
         assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
 
-        SimdYuv422pToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride);
+        SimdYuv422pToBgrV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
     }
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+        \fn void Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts YUV444P image to 24-bit BGR image.
 
         The input Y, U, V and output BGR images must have the same width and height.
 
-        \note This function is a C++ wrapper for function ::SimdYuv444pToBgr.
+        \note This function is a C++ wrapper for functions ::SimdYuv444pToBgr and ::SimdYuv444pToBgrV2.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
         \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
     */
-    template<template<class> class A> SIMD_INLINE void Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+    template<template<class> class A> SIMD_INLINE void Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(Compatible(y, u, v) && EqualSize(y, bgr) && y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
 
-        SimdYuv444pToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride);
+        SimdYuv444pToBgrV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
     }
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
+        \fn void Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts YUV420P image to 32-bit BGRA image.
 
         The input Y and output BGRA images must have the same width and height.
         The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function is a C++ wrapper for function ::SimdYuv420pToBgra.
+        \note This function is a C++ wrapper for functions ::SimdYuv420pToBgra and ::SimdYuv420pToBgraV2.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
         \param [out] bgra - an output 32-bit BGRA image.
         \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
     */
-    template<template<class> class A> SIMD_INLINE void Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
+    template<template<class> class A> SIMD_INLINE void Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
         assert(y.width == bgra.width && y.height == bgra.height);
         assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
 
-        SimdYuv420pToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
+        SimdYuv420pToBgraV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
     }
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv422pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
+        \fn void Yuv422pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts YUV422P image to 32-bit BGRA image.
 
         The input Y and output BGRA images must have the same width and height.
         The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \note This function is a C++ wrapper for function ::SimdYuv422pToBgra.
+        \note This function is a C++ wrapper for functions ::SimdYuv422pToBgra and ::SimdYuv422pToBgraV2.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
         \param [out] bgra - an output 32-bit BGRA image.
         \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
     */
-    template<template<class> class A> SIMD_INLINE void Yuv422pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
+    template<template<class> class A> SIMD_INLINE void Yuv422pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
         assert(y.width == bgra.width && y.height == bgra.height);
         assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
 
-        SimdYuv422pToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
+        SimdYuv422pToBgraV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
     }
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv444pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
+        \fn void Yuv444pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts YUV444P image to 32-bit BGRA image.
 
         The input Y, U, V and output BGRA images must have the same width and height.
 
-        \note This function is a C++ wrapper for function ::SimdYuv444pToBgra.
+        \note This function is a C++ wrapper for functions ::SimdYuv444pToBgra and ::SimdYuv444pToBgraV2.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
         \param [out] bgra - an output 32-bit BGRA image.
         \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
     */
-    template<template<class> class A> SIMD_INLINE void Yuv444pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
+    template<template<class> class A> SIMD_INLINE void Yuv444pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(Compatible(y, u, v) && EqualSize(y, bgra) && y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
 
-        SimdYuv444pToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
+        SimdYuv444pToBgraV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
     }
 
     /*! @ingroup yuv_conversion
@@ -4228,76 +4692,394 @@ namespace Simd
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv420pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb)
+        \fn void Yuv420pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts YUV420P image to 24-bit RGB image.
 
         The input Y and output RGB images must have the same width and height.
         The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function is a C++ wrapper for function ::SimdYuv420pToRgb.
+        \note This function is a C++ wrapper for functions ::SimdYuv420pToRgb and ::SimdYuv420pToRgbV2.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
         \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
     */
-    template<template<class> class A> SIMD_INLINE void Yuv420pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb)
+    template<template<class> class A> SIMD_INLINE void Yuv420pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
         assert(y.width == rgb.width && y.height == rgb.height);
         assert(y.format == View<A>::Gray8 && rgb.format == View<A>::Rgb24);
 
-        SimdYuv420pToRgb(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgb.data, rgb.stride);
+        SimdYuv420pToRgbV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgb.data, rgb.stride, yuvType);
     }
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv422pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb)
+        \fn void Yuv422pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts YUV422P image to 24-bit RGB image.
 
         The input Y and output RGB images must have the same width and height.
         The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \note This function is a C++ wrapper for function ::SimdYuv422pToRgb.
+        \note This function is a C++ wrapper for functions ::SimdYuv422pToRgb and ::SimdYuv422pToRgbV2.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
         \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
     */
-    template<template<class> class A> SIMD_INLINE void Yuv422pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb)
+    template<template<class> class A> SIMD_INLINE void Yuv422pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
         assert(y.width == rgb.width && y.height == rgb.height);
         assert(y.format == View<A>::Gray8 && rgb.format == View<A>::Rgb24);
 
-        SimdYuv422pToRgb(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgb.data, rgb.stride);
+        SimdYuv422pToRgbV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgb.data, rgb.stride, yuvType);
     }
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv444pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb)
+        \fn void Yuv444pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts YUV444P image to 24-bit RGB image.
 
         The input Y, U, V and output RGB images must have the same width and height.
 
-        \note This function is a C++ wrapper for function ::SimdYuv444pToRgb.
+        \note This function is a C++ wrapper for functions ::SimdYuv444pToRgb and ::SimdYuv444pToRgbV2.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
         \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
     */
-    template<template<class> class A> SIMD_INLINE void Yuv444pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb)
+    template<template<class> class A> SIMD_INLINE void Yuv444pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(Compatible(y, u, v) && EqualSize(y, rgb) && y.format == View<A>::Gray8 && rgb.format == View<A>::Rgb24);
 
-        SimdYuv444pToRgb(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgb.data, rgb.stride);
+        SimdYuv444pToRgbV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgb.data, rgb.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void YuyvToBgra(const View<A>& yuyv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts YUYV image (packed YUV 4:2:2) to 32-bit BGRA image.
+
+        The input YUYV and output BGRA images must have the same width and height. The width must be even.
+
+        \note This function is a C++ wrapper for function ::SimdYuyvToBgra.
+
+        \param [in] yuyv - an input 16-bit YUYV image.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void YuyvToBgra(const View<A>& yuyv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(EqualSize(yuyv, bgra) && yuyv.format == View<A>::Yuyv16 && bgra.format == View<A>::Bgra32);
+
+        SimdYuyvToBgra(yuyv.data, yuyv.stride, yuyv.width, yuyv.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void YuyvToBgr(const View<A>& yuyv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts YUYV image (packed YUV 4:2:2) to 24-bit BGR image.
+
+        The input YUYV and output BGR images must have the same width and height. The width must be even.
+
+        \note This function is a C++ wrapper for function ::SimdYuyvToBgr.
+
+        \param [in] yuyv - an input 16-bit YUYV image.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void YuyvToBgr(const View<A>& yuyv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(EqualSize(yuyv, bgr) && yuyv.format == View<A>::Yuyv16 && bgr.format == View<A>::Bgr24);
+
+        SimdYuyvToBgr(yuyv.data, yuyv.stride, yuyv.width, yuyv.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void YuyvToRgb(const View<A>& yuyv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts YUYV image (packed YUV 4:2:2) to 24-bit RGB image.
+
+        The input YUYV and output RGB images must have the same width and height. The width must be even.
+
+        \note This function is a C++ wrapper for function ::SimdYuyvToRgb.
+
+        \param [in] yuyv - an input 16-bit YUYV image.
+        \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void YuyvToRgb(const View<A>& yuyv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(EqualSize(yuyv, rgb) && yuyv.format == View<A>::Yuyv16 && rgb.format == View<A>::Rgb24);
+
+        SimdYuyvToRgb(yuyv.data, yuyv.stride, yuyv.width, yuyv.height, rgb.data, rgb.stride, yuvType);
+    }
+
+    /*! @ingroup other_conversion
+
+        \fn void YuyvToGray(const View<A>& yuyv, View<A>& gray)
+
+        \short Extracts Y (luma) channel of YUYV image (packed YUV 4:2:2) into 8-bit gray image.
+
+        The input YUYV and output gray images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdYuyvToGray.
+
+        \param [in] yuyv - an input 16-bit YUYV image.
+        \param [out] gray - an output 8-bit gray image.
+    */
+    template<template<class> class A> SIMD_INLINE void YuyvToGray(const View<A>& yuyv, View<A>& gray)
+    {
+        assert(EqualSize(yuyv, gray) && yuyv.format == View<A>::Yuyv16 && gray.format == View<A>::Gray8);
+
+        SimdYuyvToGray(yuyv.data, yuyv.stride, yuyv.width, yuyv.height, gray.data, gray.stride);
+    }
+
+    /*! @ingroup other_conversion
+
+        \fn void YuyvToNv12(const View<A>& yuyv, View<A>& y, View<A>& uv)
+
+        \short Converts YUYV image (packed YUV 4:2:2) to NV12 image (Y plane and interleaved UV plane).
+
+        The input YUYV and output Y images must have the same width and height. The width and height must be even.
+        The output UV image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdYuyvToNv12.
+
+        \param [in] yuyv - an input 16-bit YUYV image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] uv - an output 16-bit image with interleaved UV color plane.
+    */
+    template<template<class> class A> SIMD_INLINE void YuyvToNv12(const View<A>& yuyv, View<A>& y, View<A>& uv)
+    {
+        assert(EqualSize(yuyv, y) && yuyv.format == View<A>::Yuyv16 && y.format == View<A>::Gray8);
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && uv.format == View<A>::Uv16);
+
+        SimdYuyvToNv12(yuyv.data, yuyv.stride, yuyv.width, yuyv.height, y.data, y.stride, uv.data, uv.stride);
+    }
+
+    /*! @ingroup other_conversion
+
+        \fn void YuyvToYuv420p(const View<A>& yuyv, View<A>& y, View<A>& u, View<A>& v)
+
+        \short Converts YUYV image (packed YUV 4:2:2) to YUV420P image.
+
+        The input YUYV and output Y images must have the same width and height. The width and height must be even.
+        The output U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuyvToYuv420p.
+
+        \param [in] yuyv - an input 16-bit YUYV image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+    */
+    template<template<class> class A> SIMD_INLINE void YuyvToYuv420p(const View<A>& yuyv, View<A>& y, View<A>& u, View<A>& v)
+    {
+        assert(EqualSize(yuyv, y) && yuyv.format == View<A>::Yuyv16 && y.format == View<A>::Gray8);
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && Compatible(u, v) && u.format == View<A>::Gray8);
+
+        SimdYuyvToYuv420p(yuyv.data, yuyv.stride, yuyv.width, yuyv.height, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void UyvyToBgra(const View<A>& uyvy, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts UYVY image (packed YUV 4:2:2) to 32-bit BGRA image.
+
+        The input UYVY and output BGRA images must have the same width and height. The width must be even.
+
+        \note This function is a C++ wrapper for function ::SimdUyvyToBgra.
+
+        \param [in] uyvy - an input 16-bit UYVY image.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void UyvyToBgra(const View<A>& uyvy, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(EqualSize(uyvy, bgra) && uyvy.format == View<A>::Uyvy16 && bgra.format == View<A>::Bgra32);
+
+        SimdUyvyToBgra(uyvy.data, uyvy.stride, uyvy.width, uyvy.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void UyvyToBgr(const View<A>& uyvy, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts UYVY image (packed YUV 4:2:2) to 24-bit BGR image.
+
+        The input UYVY and output BGR images must have the same width and height. The width must be even.
+
+        \note This function is a C++ wrapper for function ::SimdUyvyToBgr.
+
+        \param [in] uyvy - an input 16-bit UYVY image.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void UyvyToBgr(const View<A>& uyvy, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(EqualSize(uyvy, bgr) && uyvy.format == View<A>::Uyvy16 && bgr.format == View<A>::Bgr24);
+
+        SimdUyvyToBgr(uyvy.data, uyvy.stride, uyvy.width, uyvy.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void UyvyToRgb(const View<A>& uyvy, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts UYVY image (packed YUV 4:2:2) to 24-bit RGB image.
+
+        The input UYVY and output RGB images must have the same width and height. The width must be even.
+
+        \note This function is a C++ wrapper for function ::SimdUyvyToRgb.
+
+        \param [in] uyvy - an input 16-bit UYVY image.
+        \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void UyvyToRgb(const View<A>& uyvy, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(EqualSize(uyvy, rgb) && uyvy.format == View<A>::Uyvy16 && rgb.format == View<A>::Rgb24);
+
+        SimdUyvyToRgb(uyvy.data, uyvy.stride, uyvy.width, uyvy.height, rgb.data, rgb.stride, yuvType);
+    }
+
+    /*! @ingroup other_conversion
+
+        \fn void UyvyToGray(const View<A>& uyvy, View<A>& gray)
+
+        \short Extracts Y (luma) channel of UYVY image (packed YUV 4:2:2) into 8-bit gray image.
+
+        The input UYVY and output gray images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdUyvyToGray.
+
+        \param [in] uyvy - an input 16-bit UYVY image.
+        \param [out] gray - an output 8-bit gray image.
+    */
+    template<template<class> class A> SIMD_INLINE void UyvyToGray(const View<A>& uyvy, View<A>& gray)
+    {
+        assert(EqualSize(uyvy, gray) && uyvy.format == View<A>::Uyvy16 && gray.format == View<A>::Gray8);
+
+        SimdUyvyToGray(uyvy.data, uyvy.stride, uyvy.width, uyvy.height, gray.data, gray.stride);
+    }
+
+    /*! @ingroup other_conversion
+
+        \fn void UyvyToNv12(const View<A>& uyvy, View<A>& y, View<A>& uv)
+
+        \short Converts UYVY image (packed YUV 4:2:2) to NV12 image (Y plane and interleaved UV plane).
+
+        The input UYVY and output Y images must have the same width and height. The width and height must be even.
+        The output UV image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdUyvyToNv12.
+
+        \param [in] uyvy - an input 16-bit UYVY image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] uv - an output 16-bit image with interleaved UV color plane.
+    */
+    template<template<class> class A> SIMD_INLINE void UyvyToNv12(const View<A>& uyvy, View<A>& y, View<A>& uv)
+    {
+        assert(EqualSize(uyvy, y) && uyvy.format == View<A>::Uyvy16 && y.format == View<A>::Gray8);
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && uv.format == View<A>::Uv16);
+
+        SimdUyvyToNv12(uyvy.data, uyvy.stride, uyvy.width, uyvy.height, y.data, y.stride, uv.data, uv.stride);
+    }
+
+    /*! @ingroup other_conversion
+
+        \fn void UyvyToYuv420p(const View<A>& uyvy, View<A>& y, View<A>& u, View<A>& v)
+
+        \short Converts UYVY image (packed YUV 4:2:2) to YUV420P image.
+
+        The input UYVY and output Y images must have the same width and height. The width and height must be even.
+        The output U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdUyvyToYuv420p.
+
+        \param [in] uyvy - an input 16-bit UYVY image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+    */
+    template<template<class> class A> SIMD_INLINE void UyvyToYuv420p(const View<A>& uyvy, View<A>& y, View<A>& u, View<A>& v)
+    {
+        assert(EqualSize(uyvy, y) && uyvy.format == View<A>::Uyvy16 && y.format == View<A>::Gray8);
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && Compatible(u, v) && u.format == View<A>::Gray8);
+
+        SimdUyvyToYuv420p(uyvy.data, uyvy.stride, uyvy.width, uyvy.height, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420p16ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, int shift = 8, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts 16-bit YUV420P image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv420p16ToBgra.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] u - an input 16-bit image with U color plane.
+        \param [in] v - an input 16-bit image with V color plane.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] shift - a right shift which reduces input samples to 8 bits. It is equal to 8 by default (MSB-aligned samples).
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420p16ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, int shift = 8, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == View<A>::Int16);
+        assert(Compatible(u, v) && u.format == View<A>::Int16 && EqualSize(y, bgra) && bgra.format == View<A>::Bgra32);
+
+        SimdYuv420p16ToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, shift, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void P016ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, int shift = 8, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts P010/P016 image (16-bit NV12) to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdP016ToBgra.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] uv - an input 32-bit image with interleaved UV color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] shift - a right shift which reduces input samples to 8 bits. It is equal to 8 by default (MSB-aligned samples).
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of YUV image (see descriptions of ::SimdYuvType). By default it is ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void P016ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, int shift = 8, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.format == View<A>::Int16 && uv.format == View<A>::Uv32);
+        assert(EqualSize(y, bgra) && bgra.format == View<A>::Bgra32);
+
+        SimdP016ToBgra(y.data, y.stride, uv.data, uv.stride, y.width, y.height, shift, bgra.data, bgra.stride, alpha, yuvType);
     }
 
     /*! @ingroup universal_conversion
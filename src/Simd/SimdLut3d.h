@@ -0,0 +1,205 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdLut3d_h__
+#define __SimdLut3d_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    struct Lut3dParam
+    {
+        size_t size;
+        SimdPixelFormatType format;
+        SimdLut3dInterpolationType interpolation;
+
+        Lut3dParam(size_t s, SimdPixelFormatType f, SimdLut3dInterpolationType i);
+        bool Valid() const;
+    };
+
+    class Lut3d : Deletable
+    {
+    public:
+        Lut3d(const Lut3dParam& param);
+
+        virtual void Run(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride) = 0;
+
+    protected:
+        Lut3dParam _param;
+    };
+
+    namespace Base
+    {
+        const int LUT3D_BITS = 10;
+        const int LUT3D_MASK = (1 << LUT3D_BITS) - 1;
+        const float LUT3D_RANGE = 1020.0f;
+        const float LUT3D_SCALE = 255.0f / LUT3D_RANGE;
+
+        SIMD_INLINE void Lut3dIndex(int value, float scale, int last, int& index, float& frac)
+        {
+            float x = float(value) * scale;
+            index = Min(int(x), last);
+            frac = x - float(index);
+        }
+
+        SIMD_INLINE float Lut3dValue(uint32_t node, int shift)
+        {
+            return float((node >> shift) & LUT3D_MASK);
+        }
+
+        SIMD_INLINE float Lut3dLerp(float a, float b, float f)
+        {
+            return a + (b - a) * f;
+        }
+
+        SIMD_INLINE uint8_t Lut3dOutput(float value)
+        {
+            return uint8_t(int(value * LUT3D_SCALE + 0.5f));
+        }
+
+        SIMD_INLINE void Lut3dTrilinear(const uint32_t* table, size_t size, float scale, const uint8_t* src, uint8_t* dst)
+        {
+            int ib, ig, ir, last = int(size) - 2;
+            float fb, fg, fr;
+            Lut3dIndex(src[0], scale, last, ib, fb);
+            Lut3dIndex(src[1], scale, last, ig, fg);
+            Lut3dIndex(src[2], scale, last, ir, fr);
+            size_t s1 = size, s2 = size * size;
+            const uint32_t* t = table + ir + ig * s1 + ib * s2;
+            for (int c = 0, shift = 0; c < 3; ++c, shift += LUT3D_BITS)
+            {
+                float v00 = Lut3dLerp(Lut3dValue(t[0], shift), Lut3dValue(t[1], shift), fr);
+                float v10 = Lut3dLerp(Lut3dValue(t[s1], shift), Lut3dValue(t[s1 + 1], shift), fr);
+                float v01 = Lut3dLerp(Lut3dValue(t[s2], shift), Lut3dValue(t[s2 + 1], shift), fr);
+                float v11 = Lut3dLerp(Lut3dValue(t[s2 + s1], shift), Lut3dValue(t[s2 + s1 + 1], shift), fr);
+                dst[c] = Lut3dOutput(Lut3dLerp(Lut3dLerp(v00, v10, fg), Lut3dLerp(v01, v11, fg), fb));
+            }
+        }
+
+        SIMD_INLINE void Lut3dSort(float& fa, size_t& oa, float& fb, size_t& ob)
+        {
+            if (fa < fb)
+            {
+                Swap(fa, fb);
+                Swap(oa, ob);
+            }
+        }
+
+        SIMD_INLINE void Lut3dTetrahedral(const uint32_t* table, size_t size, float scale, const uint8_t* src, uint8_t* dst)
+        {
+            int ib, ig, ir, last = int(size) - 2;
+            float f0, f1, f2;
+            Lut3dIndex(src[2], scale, last, ir, f0);
+            Lut3dIndex(src[1], scale, last, ig, f1);
+            Lut3dIndex(src[0], scale, last, ib, f2);
+            size_t o0 = 1, o1 = size, o2 = size * size;
+            Lut3dSort(f0, o0, f1, o1);
+            Lut3dSort(f1, o1, f2, o2);
+            Lut3dSort(f0, o0, f1, o1);
+            const uint32_t* t = table + ir + ig * size + ib * size * size;
+            uint32_t c0 = t[0], c1 = t[o0], c2 = t[o0 + o1], c3 = t[1 + size + size * size];
+            float w0 = 1.0f - f0, w1 = f0 - f1, w2 = f1 - f2, w3 = f2;
+            for (int c = 0, shift = 0; c < 3; ++c, shift += LUT3D_BITS)
+                dst[c] = Lut3dOutput(Lut3dValue(c0, shift) * w0 + Lut3dValue(c1, shift) * w1 + Lut3dValue(c2, shift) * w2 + Lut3dValue(c3, shift) * w3);
+        }
+
+        template<SimdLut3dInterpolationType interpolation> SIMD_INLINE void Lut3dPixel(const uint32_t* table, size_t size, float scale, const uint8_t* src, uint8_t* dst)
+        {
+            if (interpolation == SimdLut3dInterpolationTrilinear)
+                Lut3dTrilinear(table, size, scale, src, dst);
+            else
+                Lut3dTetrahedral(table, size, scale, src, dst);
+        }
+
+        template<size_t channels, SimdLut3dInterpolationType interpolation> SIMD_INLINE void Lut3dTail(const uint32_t* table, size_t size, const uint8_t* src, size_t begin, size_t end, uint8_t* dst)
+        {
+            float scale = float(size - 1) / 255.0f;
+            for (size_t col = begin, offset = begin * channels; col < end; col += 1, offset += channels)
+            {
+                if (channels == 4)
+                    dst[offset + 3] = src[offset + 3];
+                Lut3dPixel<interpolation>(table, size, scale, src + offset, dst + offset);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        typedef void (*Lut3dRowPtr)(const uint32_t* table, size_t size, const uint8_t* src, size_t width, uint8_t* dst);
+
+        class Lut3dDefault : public Simd::Lut3d
+        {
+        public:
+            Lut3dDefault(const Lut3dParam& param, const float* table);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride);
+
+        protected:
+            Array32u _table;
+            Lut3dRowPtr _row;
+        };
+
+        void* Lut3dInit(const float* table, size_t size, SimdPixelFormatType format, SimdLut3dInterpolationType interpolation);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class Lut3dDefault : public Base::Lut3dDefault
+        {
+        public:
+            Lut3dDefault(const Lut3dParam& param, const float* table);
+        };
+
+        void* Lut3dInit(const float* table, size_t size, SimdPixelFormatType format, SimdLut3dInterpolationType interpolation);
+    }
+#endif //SIMD_SSE41_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class Lut3dDefault : public Sse41::Lut3dDefault
+        {
+        public:
+            Lut3dDefault(const Lut3dParam& param, const float* table);
+        };
+
+        void* Lut3dInit(const float* table, size_t size, SimdPixelFormatType format, SimdLut3dInterpolationType interpolation);
+    }
+#endif //SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class Lut3dDefault : public Avx2::Lut3dDefault
+        {
+        public:
+            Lut3dDefault(const Lut3dParam& param, const float* table);
+        };
+
+        void* Lut3dInit(const float* table, size_t size, SimdPixelFormatType format, SimdLut3dInterpolationType interpolation);
+    }
+#endif //SIMD_AVX512BW_ENABLE
+}
+#endif//__SimdLut3d_h__
@@ -32,6 +32,10 @@
 #include <iostream>
 #endif
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
 namespace Simd
 {
     SIMD_INLINE size_t DivHi(size_t value, size_t divider)
@@ -86,10 +90,25 @@ namespace Simd
         return ptr == AlignLo(ptr, align);
     }
 
-    SIMD_INLINE void * Allocate(size_t size, size_t align = SIMD_ALIGN)
+    namespace Base
+    {
+        int GetAllocateFlags();
+
+        void SetAllocateFlags(int flags);
+    }
+
+    const size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+    const size_t NUMA_PAGE_SIZE = 4 * 1024;
+
+    SIMD_INLINE void * Allocate(size_t size, size_t align, int flags)
     {
 #ifdef SIMD_NO_MANS_LAND
         size += 2 * SIMD_NO_MANS_LAND;
+#endif
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        bool huge = (flags & SimdAllocateHugePages) && size >= HUGE_PAGE_SIZE;
+        if (huge)
+            align = Max(align, HUGE_PAGE_SIZE);
 #endif
         void * ptr = NULL;
 #if defined(_MSC_VER) 
@@ -112,6 +131,15 @@ namespace Simd
 #ifdef SIMD_ALLOCATE_ASSERT
         assert(ptr);
 #endif
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        if (ptr && huge)
+            ::madvise(ptr, AlignLo(size, HUGE_PAGE_SIZE), MADV_HUGEPAGE);
+#endif
+        if (ptr && (flags & SimdAllocateNumaLocal))
+        {
+            for (size_t offset = 0; offset < size; offset += NUMA_PAGE_SIZE)
+                ((volatile char*)ptr)[offset] = 0;
+        }
 #ifdef SIMD_NO_MANS_LAND
         if (ptr)
             ptr = (char*)ptr + SIMD_NO_MANS_LAND;
@@ -119,6 +147,11 @@ namespace Simd
         return ptr;
     }
 
+    SIMD_INLINE void * Allocate(size_t size, size_t align = SIMD_ALIGN)
+    {
+        return Allocate(size, align, Base::GetAllocateFlags());
+    }
+
     template<class T> T* Allocate(uint8_t*& buffer, size_t size, size_t align = SIMD_ALIGN)
     {
         T* ptr = (T*)buffer;
@@ -35,7 +35,7 @@
 #include <sstream>
 
 #ifndef SIMD_CHECK_PERFORMANCE
-#define SIMD_CHECK_PERFORMANCE()
+#define SIMD_CHECK_PERFORMANCE() Simd::TraceScope simdTraceScope(__FUNCTION__)
 #endif
 
 namespace Simd
@@ -580,7 +580,7 @@ namespace Simd
             /*!
                 Processes next frame. You have to successively process all frame of a movie with using of this function.
 
-                \param [in] input - a current input frame.
+                \param [in] input - a current input frame. It can have any format supported by Simd::Convert (including packed YUYV and UYVY frames of USB cameras).
                 \param [out] metadata - a metadata (sets of detected objects and generated events). It is a result of processing of current frame.
                 \param [out] output - a pointer to output frame with debug annotation. Can be NULL.
                 \return a result of the operation.
@@ -52,7 +52,8 @@ namespace Simd
 
         bool GetEnable()
         {
-            return SupportedByCPU();
+            static const bool enable = SupportedByCPU();
+            return enable;
         }
     }
 #endif
@@ -246,7 +246,7 @@ namespace Simd
 
         template <size_t channelCount> void ResizeBilinear(
             const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t yBeg, size_t yEnd)
         {
             assert(dstWidth >= A);
 
@@ -268,7 +268,8 @@ namespace Simd
 
             uint16x8_t a[2];
 
-            for (size_t yDst = 0; yDst < dstHeight; yDst++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t yDst = yBeg; yDst < yEnd; yDst++, dst += dstStride)
             {
                 a[0] = vdupq_n_u16(Base::FRACTION_RANGE - buffer.ay[yDst]);
                 a[1] = vdupq_n_u16(buffer.ay[yDst]);
@@ -326,7 +327,7 @@ namespace Simd
 
         void ResizeBilinearGray(
             const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t yBeg, size_t yEnd)
         {
             assert(dstWidth >= A);
 
@@ -346,7 +347,8 @@ namespace Simd
 
             uint16x8_t a[2];
 
-            for (size_t yDst = 0; yDst < dstHeight; yDst++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t yDst = yBeg; yDst < yEnd; yDst++, dst += dstStride)
             {
                 a[0] = vdupq_n_u16(Base::FRACTION_RANGE - buffer.ay[yDst]);
                 a[1] = vdupq_n_u16(buffer.ay[yDst]);
@@ -385,29 +387,36 @@ namespace Simd
 
         void ResizeBilinear(
             const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount, size_t yBeg, size_t yEnd)
         {
             switch (channelCount)
             {
             case 1:
                 if (srcWidth >= A && srcWidth < 4 * dstWidth)
-                    ResizeBilinearGray(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                    ResizeBilinearGray(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, yBeg, yEnd);
                 else
-                    ResizeBilinear<1>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                    ResizeBilinear<1>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, yBeg, yEnd);
                 break;
             case 2:
-                ResizeBilinear<2>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                ResizeBilinear<2>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, yBeg, yEnd);
                 break;
             case 3:
-                ResizeBilinear<3>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                ResizeBilinear<3>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, yBeg, yEnd);
                 break;
             case 4:
-                ResizeBilinear<4>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                ResizeBilinear<4>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, yBeg, yEnd);
                 break;
             default:
-                Base::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+                Base::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount, yBeg, yEnd);
             }
         }
+
+        void ResizeBilinear(
+            const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+        {
+            ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount, 0, dstHeight);
+        }
     }
 #endif
 }
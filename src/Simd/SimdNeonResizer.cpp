@@ -124,8 +124,7 @@ namespace Simd
                 }
             }
             size_t size = AlignHi(_param.dstW, _param.align)*_param.channels * 2;
-            _bx[0].Resize(size, false, _param.align);
-            _bx[1].Resize(size, false, _param.align);
+            _bufSize = size + _param.align; // the last gray block stores a whole vector past the row end
 }
 
         template <size_t N> void ResizerByteBilinearInterpolateX(const uint8_t * alpha, uint8_t * buffer);
@@ -197,7 +196,7 @@ namespace Simd
             Store<false>(dst, PackU16(lo, hi));
         }
 
-        template<size_t N> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
         {
             struct One { uint8_t val[N * 1]; };
             struct Two { uint8_t val[N * 2]; };
@@ -207,12 +206,13 @@ namespace Simd
             const size_t step = A * N;
             ptrdiff_t previous = -2;
             uint16x8_t a[2];
-            uint8_t * bx[2] = { _bx[0].data, _bx[1].data };
+            uint8_t * bx[2] = { buf, buf + _bufSize };
             const uint8_t * ax = _ax.data;
             const int32_t * ix = _ix.data;
             size_t dstW = _param.dstW;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t yDst = yBeg; yDst < yEnd; yDst++, dst += dstStride)
             {
                 a[0] = vdupq_n_u16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = vdupq_n_u16(int16_t(_ay[yDst]));
@@ -280,7 +280,7 @@ namespace Simd
 
 //#define MERGE_LOADING_AND_INTERPOLATION
 
-        void ResizerByteBilinear::RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteBilinear::RunG(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
         {
             size_t bufW = AlignHi(_param.dstW, A) * 2;
             size_t size = 2 * _param.dstW;
@@ -288,11 +288,12 @@ namespace Simd
             size_t blocks = _blocks;
             ptrdiff_t previous = -2;
             uint16x8_t a[2];
-            uint8_t * bx[2] = { _bx[0].data, _bx[1].data };
+            uint8_t * bx[2] = { buf, buf + _bufSize };
             const uint8_t * ax = _ax.data;
             const Idx * ixg = _ixg.data;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t yDst = yBeg; yDst < yEnd; yDst++, dst += dstStride)
             {
                 a[0] = vdupq_n_u16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = vdupq_n_u16(int16_t(_ay[yDst]));
@@ -336,22 +337,21 @@ namespace Simd
             }
         }
 
-        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteBilinear::RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
         {
             assert(_param.dstW >= A);
 
-            EstimateParams();
             switch (_param.channels)
             {
             case 1:
                 if (_blocks)
-                    RunG(src, srcStride, dst, dstStride);
+                    RunG(src, srcStride, yBeg, yEnd, dst, dstStride, buf);
                 else
-                    Run<1>(src, srcStride, dst, dstStride);
+                    Run<1>(src, srcStride, yBeg, yEnd, dst, dstStride, buf);
                 break;
-            case 2: Run<2>(src, srcStride, dst, dstStride); break;
-            case 3: Run<3>(src, srcStride, dst, dstStride); break;
-            case 4: Run<4>(src, srcStride, dst, dstStride); break;
+            case 2: Run<2>(src, srcStride, yBeg, yEnd, dst, dstStride, buf); break;
+            case 3: Run<3>(src, srcStride, yBeg, yEnd, dst, dstStride, buf); break;
+            case 4: Run<4>(src, srcStride, yBeg, yEnd, dst, dstStride, buf); break;
             default:
                 assert(0);
             }
@@ -361,7 +361,6 @@ namespace Simd
         ResizerByteArea::ResizerByteArea(const ResParam & param)
             : Base::ResizerByteArea(param)
         {
-            _by.Resize(AlignHi(_param.srcW*_param.channels, _param.align), false, _param.align);
         }
 
         template<UpdateType update> SIMD_INLINE void ResizerByteAreaRowUpdate(const uint8_t * src0, size_t size, int32_t a0, int32_t * dst)
@@ -462,14 +461,16 @@ namespace Simd
             ResizerByteAreaResult34<3>(src, count, curr, zero, next, dst);
         }
 
-        template<size_t N> void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, int32_t * by)
         {
             size_t dstW = _param.dstW, rowSize = _param.srcW*N, rowRest = dstStride - dstW * N;
             const int32_t * iy = _iy.data, *ix = _ix.data, *ay = _ay.data, *ax = _ax.data;
             int32_t ay0 = ay[0], ax0 = ax[0];
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
+            src += iy[yBeg] * srcStride;
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += rowRest)
             {
-                int32_t * buf = _by.data;
+                int32_t * buf = by;
                 size_t yn = iy[dy + 1] - iy[dy];
                 ResizerByteAreaRowSum(src, srcStride, yn, rowSize, ay[dy], ay0, ay[dy + 1], buf), src += yn * srcStride;
                 for (size_t dx = 0; dx < dstW; dx++, dst += N)
@@ -480,14 +481,19 @@ namespace Simd
             }
         }
 
-        void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        size_t ResizerByteArea::BufferSize() const
+        {
+            return AlignHi(_param.srcW * _param.channels, _param.align) * sizeof(int32_t);
+        }
+
+        void ResizerByteArea::RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
         {
             switch (_param.channels)
             {
-            case 1: Run<1>(src, srcStride, dst, dstStride); return;
-            case 2: Run<2>(src, srcStride, dst, dstStride); return;
-            case 3: Run<3>(src, srcStride, dst, dstStride); return;
-            case 4: Run<4>(src, srcStride, dst, dstStride); return;
+            case 1: Run<1>(src, srcStride, yBeg, yEnd, dst, dstStride, (int32_t*)buf); return;
+            case 2: Run<2>(src, srcStride, yBeg, yEnd, dst, dstStride, (int32_t*)buf); return;
+            case 3: Run<3>(src, srcStride, yBeg, yEnd, dst, dstStride, (int32_t*)buf); return;
+            case 4: Run<4>(src, srcStride, yBeg, yEnd, dst, dstStride, (int32_t*)buf); return;
             default:
                 assert(0);
             }
@@ -500,14 +506,15 @@ namespace Simd
         {
         }
 
-        void ResizerFloatBilinear::Run(const float * src, size_t srcStride, float * dst, size_t dstStride) 
+        void ResizerFloatBilinear::Run(const float * src, size_t srcStride, size_t yBeg, size_t yEnd, float * dst, size_t dstStride, float * buf) 
         {
             size_t cn = _param.channels;
             size_t rs = _param.dstW * cn;
-            float * pbx[2] = { _bx[0].data, _bx[1].data };
+            float * pbx[2] = { buf, buf + AlignHi(rs, _param.align / sizeof(float)) };
             int32_t prev = -2;
             size_t rsa = AlignLo(rs, F);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -287,9 +287,9 @@ namespace Simd
             SynetSetInput1Gray8(rgb.val[0], scale[2], shift[2], dst + 2 * channel);
         }
 
-        template<SimdPixelFormatType format, size_t step> void SynetSetInputNchw3(const uint8_t * src, size_t width, size_t height, size_t stride, const float * scale, const float * shift, float * dst)
+        template<SimdPixelFormatType format, size_t step> void SynetSetInputNchw3(const uint8_t * src, size_t width, size_t height, size_t stride, const float * scale, const float * shift, float * dst, size_t channel)
         {
-            size_t aligned = AlignLo(width, A), channel = width * height;
+            size_t aligned = AlignLo(width, A);
             float32x4_t _scale[3], _shift[3];
             for (size_t i = 0; i < 3; ++i)
             {
@@ -440,8 +440,8 @@ namespace Simd
             }
         }
 
-        void SynetSetInput(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
-            const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat)
+        void SynetSetInputRows(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+            const float * lower, const float * upper, float * dst, size_t plane, size_t channels, SimdTensorFormatType dstFormat)
         {
             assert(width >= A);
 
@@ -466,10 +466,10 @@ namespace Simd
                 case SimdTensorFormatNchw:
                     switch (srcFormat)
                     {
-                    case SimdPixelFormatGray8: SynetSetInputNchw3<SimdPixelFormatGray8, 1>(src, width, height, stride, scale, lower, dst); return;
-                    case SimdPixelFormatBgr24: SynetSetInputNchw3<SimdPixelFormatBgr24, 3>(src, width, height, stride, scale, lower, dst); return;
-                    case SimdPixelFormatBgra32: SynetSetInputNchw3<SimdPixelFormatBgra32, 4>(src, width, height, stride, scale, lower, dst); return;
-                    case SimdPixelFormatRgb24: SynetSetInputNchw3<SimdPixelFormatRgb24, 3>(src, width, height, stride, scale, lower, dst); return;
+                    case SimdPixelFormatGray8: SynetSetInputNchw3<SimdPixelFormatGray8, 1>(src, width, height, stride, scale, lower, dst, plane); return;
+                    case SimdPixelFormatBgr24: SynetSetInputNchw3<SimdPixelFormatBgr24, 3>(src, width, height, stride, scale, lower, dst, plane); return;
+                    case SimdPixelFormatBgra32: SynetSetInputNchw3<SimdPixelFormatBgra32, 4>(src, width, height, stride, scale, lower, dst, plane); return;
+                    case SimdPixelFormatRgb24: SynetSetInputNchw3<SimdPixelFormatRgb24, 3>(src, width, height, stride, scale, lower, dst, plane); return;
                     default: assert(0);
                     }
                     break;
@@ -480,7 +480,7 @@ namespace Simd
                     case SimdPixelFormatBgr24: SynetSetInputNhwc3<SimdPixelFormatBgr24, 3>(src, width, height, stride, scale, lower, dst); return;
                     case SimdPixelFormatBgra32: SynetSetInputNhwc3<SimdPixelFormatBgra32, 4>(src, width, height, stride, scale, lower, dst); return;
                     case SimdPixelFormatRgb24: SynetSetInputNhwc3<SimdPixelFormatRgb24, 3>(src, width, height, stride, scale, lower, dst); return;
-                    default: return Base::SynetSetInput(src, width, height, stride, srcFormat, lower, upper, dst, channels, dstFormat); assert(0);
+                    default: return Base::SynetSetInputRows(src, width, height, stride, srcFormat, lower, upper, dst, plane, channels, dstFormat); assert(0);
                     }
                     break;
                 default: assert(0);
@@ -489,6 +489,12 @@ namespace Simd
             }
         }
 
+        void SynetSetInput(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+            const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat)
+        {
+            SynetSetInputRows(src, width, height, stride, srcFormat, lower, upper, dst, width * height, channels, dstFormat);
+        }
+
         //---------------------------------------------------------------------
 
         template<bool align> void SynetReorderImage_Chw_Hwc(size_t channels, size_t spatial, const float* src, float* dst)
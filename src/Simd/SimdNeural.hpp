@@ -34,7 +34,7 @@
 #include <iterator>
 
 #ifndef SIMD_CHECK_PERFORMANCE
-#define SIMD_CHECK_PERFORMANCE()
+#define SIMD_CHECK_PERFORMANCE() Simd::TraceScope simdTraceScope(__FUNCTION__)
 #endif
 
 //#define SIMD_CHECK_OVERFLOW
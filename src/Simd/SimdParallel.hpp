@@ -1,7 +1,7 @@
 /*
 * Simd Library (http://ermig1979.github.io/Simd).
 *
-* Copyright (c) 2011-2020 Yermalayeu Ihar.
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
 *
 * Permission is hereby granted, free of charge, to any person obtaining a copy
 * of this software and associated documentation files (the "Software"), to deal
@@ -28,10 +28,189 @@
 #include <thread>
 #ifndef SIMD_FUTURE_DISABLE
 #include <future>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <algorithm>
 #endif
 
 namespace Simd
 {
+#ifndef SIMD_FUTURE_DISABLE
+    /*
+    * Persistent workers with a shared queue of jobs. Every call of Run() puts its job into the queue, so concurrent 
+    * callers share the same workers. The caller runs the first part of its job and then helps with the remaining ones, 
+    * so the job is finished even if all workers are busy with other jobs.
+    */
+    class ThreadPool
+    {
+    public:
+        typedef std::function<void(size_t)> Task;
+
+        static ThreadPool & Global()
+        {
+            // The pool is never destroyed: joining of workers from a static destructor can deadlock 
+            // at unloading of shared library. Use Resize(0) to stop workers explicitly.
+            static ThreadPool * pool = new ThreadPool();
+            return *pool;
+        }
+
+        ThreadPool()
+            : _queued(0)
+            , _stop(false)
+        {
+        }
+
+        ~ThreadPool()
+        {
+            std::lock_guard<std::mutex> control(_control);
+            Stop();
+        }
+
+        size_t Size() const
+        {
+            std::lock_guard<std::mutex> control(_control);
+            return _workers.size();
+        }
+
+        void Resize(size_t size)
+        {
+            std::lock_guard<std::mutex> control(_control);
+            if (size < _workers.size())
+                Stop();
+            Reserve(size);
+        }
+
+        void Run(size_t number, const Task & task)
+        {
+            if (number < 2)
+            {
+                task(0);
+                return;
+            }
+            {
+                // Resize() may hold the lock while it joins workers which run tasks calling Run().
+                std::unique_lock<std::mutex> control(_control, std::try_to_lock);
+                if (control.owns_lock())
+                    Reserve(number - 1);
+            }
+            Job job(task, number);
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _jobs.push_back(&job);
+                _queued.store(_jobs.size(), std::memory_order_release);
+            }
+            _wakeup.notify_all();
+            Execute(job, 0);
+            for (;;)
+            {
+                size_t index;
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    if (job.next == job.number)
+                        break;
+                    index = Claim(job);
+                }
+                Execute(job, index);
+            }
+            for (size_t spin = 0; spin < SPIN_COUNT && job.done.load(std::memory_order_acquire) < number; ++spin)
+                std::this_thread::yield();
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _finish.wait(lock, [&job, number] { return job.done.load(std::memory_order_acquire) >= number; });
+            }
+        }
+
+    private:
+        static const size_t SPIN_COUNT = 4096;
+
+        struct Job
+        {
+            const Task * task;
+            size_t number, next;
+            std::atomic<size_t> done;
+
+            Job(const Task & t, size_t n) : task(&t), number(n), next(1), done(0) {}
+        };
+
+        std::vector<std::thread> _workers;
+        mutable std::mutex _control;
+        std::mutex _mutex;
+        std::condition_variable _wakeup, _finish;
+        std::vector<Job*> _jobs;
+        std::atomic<size_t> _queued;
+        bool _stop;
+
+        ThreadPool(const ThreadPool &);
+        ThreadPool & operator = (const ThreadPool &);
+
+        void Stop()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stop = true;
+            }
+            _wakeup.notify_all();
+            for (size_t i = 0; i < _workers.size(); ++i)
+                _workers[i].join();
+            _workers.clear();
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = false;
+        }
+
+        void Reserve(size_t size)
+        {
+            while (_workers.size() < size)
+                _workers.push_back(std::thread(&ThreadPool::Work, this));
+        }
+
+        // Must be called under _mutex for a job with unclaimed parts. The job leaves the queue with its last part.
+        size_t Claim(Job & job)
+        {
+            size_t index = job.next++;
+            if (job.next == job.number)
+            {
+                _jobs.erase(std::find(_jobs.begin(), _jobs.end(), &job));
+                _queued.store(_jobs.size(), std::memory_order_release);
+            }
+            return index;
+        }
+
+        void Execute(Job & job, size_t index)
+        {
+            size_t number = job.number;
+            (*job.task)(index);
+            // The caller may return (and destroy the job) as soon as the last part is counted.
+            if (job.done.fetch_add(1, std::memory_order_acq_rel) + 1 == number)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _finish.notify_all();
+            }
+        }
+
+        void Work()
+        {
+            for (;;)
+            {
+                for (size_t spin = 0; spin < SPIN_COUNT && _queued.load(std::memory_order_acquire) == 0; ++spin)
+                    std::this_thread::yield();
+                Job * job;
+                size_t index;
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _wakeup.wait(lock, [this] { return _stop || !_jobs.empty(); });
+                    if (_stop)
+                        return;
+                    job = _jobs.front();
+                    index = Claim(*job);
+                }
+                Execute(*job, index);
+            }
+        }
+    };
+#endif
+
     template<class Function> inline void Parallel(size_t begin, size_t end, const Function & function, size_t threadNumber, size_t blockAlign = 1)
     {
 #ifdef SIMD_FUTURE_DISABLE
@@ -42,22 +221,21 @@ namespace Simd
             function(0, begin, end);
         else
         {
-            std::vector<std::future<void>> futures;
-
             size_t blockSize = (end - begin + threadNumber - 1) / threadNumber;
             blockSize = (blockSize + blockAlign - 1) / blockAlign * blockAlign;
-            size_t blockBegin = begin;
-            size_t blockEnd = blockBegin + blockSize;
-
-            for (size_t thread = 0; thread < threadNumber && blockBegin < end; ++thread)
+            size_t blockNumber = (end - begin + blockSize - 1) / blockSize;
+            if (blockNumber < 2)
             {
-                futures.push_back(std::move(std::async(std::launch::async, [blockBegin, blockEnd, thread, &function] { function(thread, blockBegin, blockEnd); })));
-                blockBegin += blockSize;
-                blockEnd = std::min(blockBegin + blockSize, end);
+                function(0, begin, end);
+                return;
             }
 
-            for (size_t i = 0; i < futures.size(); ++i)
-                futures[i].wait();
+            ThreadPool::Task task = [begin, end, blockSize, &function](size_t thread)
+            {
+                size_t blockBegin = begin + thread * blockSize;
+                function(thread, blockBegin, std::min(blockBegin + blockSize, end));
+            };
+            ThreadPool::Global().Run(blockNumber, task);
         }
 #endif
     }
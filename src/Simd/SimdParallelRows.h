@@ -0,0 +1,101 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdParallelRows_h__
+#define __SimdParallelRows_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+    const size_t PARALLEL_ROWS_MIN_BAND = 8;
+
+    SIMD_INLINE size_t ParallelRowsBands(size_t width, size_t height, size_t minBand)
+    {
+        size_t threads = Base::GetThreadNumber();
+        if (threads < 2 || width * height < Base::GetParallelThreshold())
+            return 1;
+        return Min(threads, height / Max(minBand, PARALLEL_ROWS_MIN_BAND));
+    }
+
+    SIMD_INLINE size_t ParallelRowsBound(size_t height, size_t bands, size_t band, size_t align)
+    {
+        return band == bands ? height : AlignLoAny(height * band / bands, align);
+    }
+
+    /*
+    * Splits an image into horizontal bands and processes them in parallel.
+    * rows(begin, end) processes rows [begin, end); band bounds are multiples of 'align' (e.g. 2 for 4:2:0 chroma).
+    */
+    template<class Rows> void ParallelRows(size_t width, size_t height, size_t align, Rows rows)
+    {
+        size_t bands = ParallelRowsBands(width, height, 2 * align);
+        if (bands < 2)
+            rows(0, height);
+        else
+        {
+            Parallel(0, bands, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t band = begin; band < end; ++band)
+                    rows(ParallelRowsBound(height, bands, band, align), ParallelRowsBound(height, bands, band + 1, align));
+            }, bands);
+        }
+    }
+
+    /*
+    * Parallel processing of neighbourhood filters with vertical radius 'halo'.
+    * rows(begin, end, dst) filters source rows [begin, end) (rows outside are treated as image border) to dst.
+    * Rows near inner band bounds are then recomputed from a window of 4*halo source rows.
+    */
+    template<class Rows> void ParallelRows(size_t width, size_t height, size_t halo, uint8_t * dst, size_t dstStride, size_t dstRowSize, Rows rows)
+    {
+        size_t bands = ParallelRowsBands(width, height, 4 * halo);
+        if (bands < 2)
+            rows(0, height, dst);
+        else
+        {
+            Parallel(0, bands, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t band = begin; band < end; ++band)
+                {
+                    size_t rowBeg = ParallelRowsBound(height, bands, band, 1);
+                    size_t rowEnd = ParallelRowsBound(height, bands, band + 1, 1);
+                    rows(rowBeg, rowEnd, dst + rowBeg * dstStride);
+                }
+            }, bands);
+            Array8u buf(4 * halo * dstStride);
+            for (size_t band = 1; band < bands; ++band)
+            {
+                size_t bound = ParallelRowsBound(height, bands, band, 1);
+                size_t winBeg = bound - 2 * halo, winEnd = Min(bound + 2 * halo, height);
+                rows(winBeg, winEnd, buf.data);
+                for (size_t row = bound - halo; row < bound + halo; ++row)
+                    memcpy(dst + row * dstStride, buf.data + (row - winBeg) * dstStride, dstRowSize);
+            }
+        }
+    }
+}
+
+#endif//__SimdParallelRows_h__
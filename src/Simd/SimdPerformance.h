@@ -25,6 +25,7 @@
 #define __SimdPerformance_h__
 
 #include "Simd/SimdDefs.h"
+#include "Simd/SimdTrace.h"
 
 #include <string>
 #include <sstream>
@@ -41,8 +42,6 @@ namespace Simd
     }
 }
 
-#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
-
 #include "Simd/SimdTime.h"
 
 #include <limits>
@@ -53,6 +52,8 @@ namespace Simd
 #include <thread>
 #include <mutex>
 #include <algorithm>
+#include <atomic>
+#include <cmath>
 
 namespace Simd
 {
@@ -60,13 +61,18 @@ namespace Simd
     {
         class PerformanceMeasurer
         {
+            static const size_t HISTOGRAM_SIZE = 256;
+
             String	_name;
             int64_t _start, _current, _total, _min, _max;
-            int64_t _count, _flop;
+            int64_t _count, _flop, _bytes, _generation;
             bool _entered, _paused;
+            int64_t _histogram[HISTOGRAM_SIZE];
+
+            static std::atomic<int64_t> s_generation;
 
         public:
-            PerformanceMeasurer(const String& name = "Unknown", int64_t flop = 0);
+            PerformanceMeasurer(const String& name = "Unknown", int64_t flop = 0, int64_t bytes = 0);
 
             PerformanceMeasurer(const PerformanceMeasurer& pm);
 
@@ -74,13 +80,29 @@ namespace Simd
 
             void Leave(bool pause = false);
 
+            void Add(int64_t duration);
+
             String Statistic() const;
 
+            String Json() const;
+
+            String Csv() const;
+
+            static String CsvHeader();
+
             void Combine(const PerformanceMeasurer& other);
 
+            void Reset();
+
+            static void ResetAll();
+
+            bool Actual() const;
+
         private:
             double Average() const;
             double GFlops() const;
+            double GBps() const;
+            double Percentile(double p) const;
         };
 
         class PerformanceMeasurerHolder
@@ -143,14 +165,14 @@ namespace Simd
             {
             }
 
-            SIMD_INLINE PerformanceMeasurer * Get(const String & name, int64_t flop = 0)
+            SIMD_INLINE PerformanceMeasurer * Get(const String & name, int64_t flop = 0, int64_t bytes = 0)
             {
                 FunctionMap & thread = ThisThread();
                 PerformanceMeasurer * pm = NULL;
                 FunctionMap::iterator it = thread.find(name);
                 if (it == thread.end())
                 {
-                    pm = new PerformanceMeasurer(name, flop);
+                    pm = new PerformanceMeasurer(name, flop, bytes);
                     thread[name].reset(pm);
                 }
                 else
@@ -158,40 +180,51 @@ namespace Simd
                 return pm;
             }
 
-            SIMD_INLINE PerformanceMeasurer * Get(const String func, const String & desc, int64_t flop = 0)
+            SIMD_INLINE PerformanceMeasurer * Get(const String func, const String & desc, int64_t flop = 0, int64_t bytes = 0)
             {
-                return Get(func + "{ " + desc + " }", flop);
+                return Get(func + "{ " + desc + " }", flop, bytes);
             }
 
             const char* PerformanceStatistic();
+
+            const char* PerformanceStatistic(SimdPerformanceStatisticFormatType format);
+
+            void Reset();
+
+        private:
+            FunctionMap Combined() const;
         };
     }
 }
-#define SIMD_PERF_FUNCF(flop) Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, (long long)(flop)))
+
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+#define SIMD_PERF_FUNCF(flop) SIMD_TRACE_FUNCF(flop); Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, (long long)(flop)))
 #define SIMD_PERF_FUNC() SIMD_PERF_FUNCF(0)
-#define SIMD_PERF_BEGF(desc, flop) Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, desc, (long long)(flop)))
+#define SIMD_PERF_BEGF(desc, flop) SIMD_TRACE_BEGF(desc, flop); Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, desc, (long long)(flop)))
 #define SIMD_PERF_BEG(desc) SIMD_PERF_BEGF(desc, 0)
-#define SIMD_PERF_IFF(cond, desc, flop) Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)((cond) ? Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, desc, (long long)(flop)) : NULL)
+#define SIMD_PERF_BEGFB(desc, flop, bytes) SIMD_TRACE_BEGF(desc, flop); Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, desc, (long long)(flop), (long long)(bytes)))
+#define SIMD_PERF_IFF(cond, desc, flop) SIMD_TRACE_IFF(cond, desc, flop); Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)((cond) ? Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, desc, (long long)(flop)) : NULL)
 #define SIMD_PERF_IF(cond, desc) SIMD_PERF_IFF(cond, desc, 0)
 #define SIMD_PERF_END(desc) Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, desc)->Leave();
 #define SIMD_PERF_INITF(name, desc, flop) Simd::Base::PerformanceMeasurerHolder name(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, desc, (long long)(flop)), false);
 #define SIMD_PERF_INIT(name, desc)  SIMD_PERF_INITF(name, desc, 0);
 #define SIMD_PERF_START(name) name.Enter(); 
 #define SIMD_PERF_PAUSE(name) name.Leave(true);
-#define SIMD_PERF_EXT(ext) Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)((ext)->Perf(SIMD_FUNCTION)) 
+#define SIMD_PERF_EXT(ext) SIMD_TRACE_EXT(ext); Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)((ext)->Perf(SIMD_FUNCTION)) 
 #else//SIMD_PERFORMANCE_STATISTIC
-#define SIMD_PERF_FUNCF(flop)
-#define SIMD_PERF_FUNC()
-#define SIMD_PERF_BEGF(desc, flop)
-#define SIMD_PERF_BEG(desc)
-#define SIMD_PERF_IFF(cond, desc, flop)
-#define SIMD_PERF_IF(cond, desc)
+#define SIMD_PERF_FUNCF(flop) SIMD_TRACE_FUNCF(flop)
+#define SIMD_PERF_FUNC() SIMD_TRACE_FUNCF(0)
+#define SIMD_PERF_BEGF(desc, flop) SIMD_TRACE_BEGF(desc, flop)
+#define SIMD_PERF_BEG(desc) SIMD_TRACE_BEGF(desc, 0)
+#define SIMD_PERF_BEGFB(desc, flop, bytes) SIMD_TRACE_BEGF(desc, flop)
+#define SIMD_PERF_IFF(cond, desc, flop) SIMD_TRACE_IFF(cond, desc, flop)
+#define SIMD_PERF_IF(cond, desc) SIMD_TRACE_IFF(cond, desc, 0)
 #define SIMD_PERF_END(desc)
 #define SIMD_PERF_INITF(name, desc, flop)
 #define SIMD_PERF_INIT(name, desc)
 #define SIMD_PERF_START(name)
 #define SIMD_PERF_PAUSE(name)
-#define SIMD_PERF_EXT(ext)
+#define SIMD_PERF_EXT(ext) SIMD_TRACE_EXT(ext)
 #endif//SIMD_PERFORMANCE_STATISTIC 
 
 #endif//__SimdPerformance_h__
@@ -57,11 +57,39 @@ namespace Simd
             return type == SimdResizeChannelByte && method == SimdResizeMethodArea;
         }
 
+        bool IsShortArea() const
+        {
+            return type == SimdResizeChannelShort && method == SimdResizeMethodArea;
+        }
+
+        bool IsFloatArea() const
+        {
+            return type == SimdResizeChannelFloat && method == SimdResizeMethodArea;
+        }
+
         bool IsFloatBilinear() const
         {
             return type == SimdResizeChannelFloat && 
                 (method == SimdResizeMethodBilinear || method == SimdResizeMethodCaffeInterp || method == SimdResizeMethodInferenceEngineInterp);
         }
+
+        bool IsShortBilinear() const
+        {
+            return type == SimdResizeChannelShort && 
+                (method == SimdResizeMethodBilinear || method == SimdResizeMethodCaffeInterp || method == SimdResizeMethodInferenceEngineInterp);
+        }
+
+        bool IsFilter() const
+        {
+            return (type == SimdResizeChannelByte || type == SimdResizeChannelFloat) &&
+                (method == SimdResizeMethodBicubic || method == SimdResizeMethodBicubicPil || method == SimdResizeMethodLanczos);
+        }
+
+        bool IsNearest() const
+        {
+            return method == SimdResizeMethodNearest &&
+                (type == SimdResizeChannelByte || type == SimdResizeChannelShort || type == SimdResizeChannelFloat);
+        }
     };
 
     class Resizer : Deletable
@@ -74,8 +102,36 @@ namespace Simd
 
         virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) = 0;
 
+        virtual size_t RunRows(const uint8_t * src, size_t srcStride, size_t srcRowBeg, size_t srcRowEnd, uint8_t * dst, size_t dstStride)
+        {
+            if (srcRowEnd < _param.srcH)
+                return 0;
+            Run(src, srcStride, dst, dstStride);
+            return _param.dstH;
+        }
+
     protected:
         ResParam _param;
+        Array8u _buffer;
+
+        virtual size_t SrcRows(size_t dy) const
+        {
+            return _param.srcH;
+        }
+
+        // Size in bytes of row buffers of one band. A band gets them in 'buf': a serial run reuses _buffer, parallel bands allocate their own.
+        virtual size_t BufferSize() const
+        {
+            return 0;
+        }
+
+        virtual void RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
+        {
+            assert(0);
+        }
+
+        void RunBands(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride);
+        size_t RunStrip(const uint8_t * src, size_t srcStride, size_t srcRowBeg, size_t srcRowEnd, uint8_t * dst, size_t dstStride);
     };
 
     namespace Base
@@ -83,13 +139,19 @@ namespace Simd
         class ResizerByteBilinear : public Resizer
         {
         protected:
-            Array32i _ax, _ix, _ay, _iy, _bx[2];
+            Array32i _ax, _ix, _ay, _iy;
+            size_t _bufSize;
 
             void EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t * indices, int32_t * alphas);
+            virtual void EstimateParams();
+            virtual size_t SrcRows(size_t dy) const;
+            virtual size_t BufferSize() const;
+            virtual void RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
         public:
             ResizerByteBilinear(const ResParam & param);
 
             virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual size_t RunRows(const uint8_t * src, size_t srcStride, size_t srcRowBeg, size_t srcRowEnd, uint8_t * dst, size_t dstStride);
         };
 
         const int32_t AREA_SHIFT = 22;
@@ -101,29 +163,168 @@ namespace Simd
         protected:
             Array32i _ax, _ix, _ay, _iy;
 
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride);
+            virtual size_t SrcRows(size_t dy) const;
+            virtual void RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
         public:
             ResizerByteArea(const ResParam & param);
 
             void EstimateParams(size_t srcSize, size_t dstSize, size_t range, int32_t * alpha, int32_t * index);
 
             virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual size_t RunRows(const uint8_t * src, size_t srcStride, size_t srcRowBeg, size_t srcRowEnd, uint8_t * dst, size_t dstStride);
         };
 
         class ResizerFloatBilinear : public Resizer
         {
         protected:
             Array32i _ix, _iy;
-            Array32f _ax, _ay, _bx[2];
+            Array32f _ax, _ay;
 
             void EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t * indices, float * alphas);
 
-            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+            virtual size_t SrcRows(size_t dy) const;
+            virtual size_t BufferSize() const;
+            virtual void RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
+            virtual void Run(const float * src, size_t srcStride, size_t yBeg, size_t yEnd, float * dst, size_t dstStride, float * buf);
 
         public:
             ResizerFloatBilinear(const ResParam & param);
 
             virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual size_t RunRows(const uint8_t * src, size_t srcStride, size_t srcRowBeg, size_t srcRowEnd, uint8_t * dst, size_t dstStride);
+        };
+
+        class ResizerShortBilinear : public ResizerFloatBilinear
+        {
+        protected:
+            virtual void RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
+            virtual void Run(const uint16_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint16_t * dst, size_t dstStride, float * buf);
+
+        public:
+            ResizerShortBilinear(const ResParam & param);
+        };
+
+        template<class T> SIMD_INLINE void ResizerFilterStore(float value, T * dst);
+
+        template<> SIMD_INLINE void ResizerFilterStore<uint8_t>(float value, uint8_t * dst)
+        {
+            *dst = (uint8_t)int(Simd::RestrictRange(value, 0.0f, 255.0f) + 0.5f);
+        }
+
+        template<> SIMD_INLINE void ResizerFilterStore<float>(float value, float * dst)
+        {
+            *dst = value;
+        }
+
+        template<> SIMD_INLINE void ResizerFilterStore<uint16_t>(float value, uint16_t * dst)
+        {
+            *dst = (uint16_t)int(Simd::RestrictRange(value, 0.0f, 65535.0f) + 0.5f);
+        }
+
+        template<class T> void ResizerFilterVertical(const uint8_t * src, size_t srcStride, size_t width, const float * weight, size_t kernel, float * dst)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                float sum = float(((const T*)src)[x]) * weight[0];
+                for (size_t k = 1; k < kernel; ++k)
+                    sum += float(((const T*)(src + k * srcStride))[x]) * weight[k];
+                dst[x] = sum;
+            }
+        }
+
+        template<class T> void ResizerFilterHorizontal(const float * src, const int32_t * index, const float * weight, size_t kernel, size_t channels, size_t width, uint8_t * dst)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                const float * s = src + index[x];
+                float sum = s[0] * weight[x];
+                for (size_t k = 1; k < kernel; ++k)
+                    sum += s[k * channels] * weight[k * width + x];
+                ResizerFilterStore<T>(sum, (T*)dst + x);
+            }
+        }
+
+        class ResizerFilter : public Resizer
+        {
+        public:
+            ResizerFilter(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        protected:
+            typedef void(*VerticalPtr)(const uint8_t * src, size_t srcStride, size_t width, const float * weight, size_t kernel, float * dst);
+            typedef void(*HorizontalPtr)(const float * src, const int32_t * index, const float * weight, size_t kernel, size_t channels, size_t width, uint8_t * dst);
+
+            size_t _kx, _ky;
+            Array32i _ix, _iy;
+            Array32f _ax, _ay;
+            VerticalPtr _vertical;
+            HorizontalPtr _horizontal;
+
+            void EstimateWeights(size_t srcSize, size_t dstSize, size_t & kernel, Array32i & index, Array32f & weight);
+        };
+
+        class ResizerNearest : public Resizer
+        {
+        public:
+            ResizerNearest(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        protected:
+            size_t _pixelSize;
+            Array32i _ix, _iy;
+
+            void EstimateIndex(size_t srcSize, size_t dstSize, size_t pixelSize, int32_t * indices);
+            bool EstimateBlocks(size_t window, size_t granule, size_t loads, size_t & pixels, Array32i & offsets, Array32i & indices) const;
+
+            virtual void RunRow(const uint8_t * src, uint8_t * dst);
+        };
+
+        template<class T, size_t F> void ResizerAreaHorizontal(const float * src, const int32_t * index, const float * weight, size_t kernel, size_t channels, size_t width, uint8_t * dst)
+        {
+            const float norm = 1.0f / float(F);
+            for (size_t x = 0; x < width; x += channels, src += F * channels)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    float sum = src[c];
+                    for (size_t k = 1; k < F; ++k)
+                        sum += src[k * channels + c];
+                    ResizerFilterStore<T>(sum * norm, (T*)dst + x + c);
+                }
+            }
+        }
+
+        class ResizerFloatArea : public Resizer
+        {
+        public:
+            typedef void(*VerticalPtr)(const uint8_t * src, size_t srcStride, size_t width, const float * weight, size_t kernel, float * dst);
+            typedef void(*HorizontalPtr)(const float * src, const int32_t * index, const float * weight, size_t kernel, size_t channels, size_t width, uint8_t * dst);
+
+            ResizerFloatArea(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual size_t RunRows(const uint8_t * src, size_t srcStride, size_t srcRowBeg, size_t srcRowEnd, uint8_t * dst, size_t dstStride);
+
+        protected:
+            size_t _kx, _ky, _fx;
+            Array32i _ix, _iy;
+            Array32f _ax, _ay;
+            VerticalPtr _vertical;
+            HorizontalPtr _horizontal;
+
+            void EstimateWeights(size_t srcSize, size_t dstSize, size_t & kernel, Array32i & index, Array32f & weight);
+            virtual size_t SrcRows(size_t dy) const;
+            virtual size_t BufferSize() const;
+            virtual void RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
+        };
+
+        class ResizerShortArea : public ResizerFloatArea
+        {
+        public:
+            ResizerShortArea(const ResParam & param);
         };
 
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
@@ -134,7 +335,7 @@ namespace Simd
     {
         class ResizerFloatBilinear : public Base::ResizerFloatBilinear
         {
-            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+            virtual void Run(const float * src, size_t srcStride, size_t yBeg, size_t yEnd, float * dst, size_t dstStride, float * buf);
         public:
             ResizerFloatBilinear(const ResParam & param);
         };
@@ -150,26 +351,22 @@ namespace Simd
         {
         protected:
             Array16i _ax;
-            Array8u _bx[2];
 
             void EstimateParams();
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
+            virtual void RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
         public:
             ResizerByteBilinear(const ResParam & param);
-
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
         };
 
         class ResizerByteArea : public Base::ResizerByteArea
         {
         protected:
-            Array32i _by;
-
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual size_t BufferSize() const;
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, int32_t * by);
+            virtual void RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
         public:
             ResizerByteArea(const ResParam & param);
-
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
         };
 
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
@@ -193,12 +390,11 @@ namespace Simd
 
             size_t BlockCountMax(size_t align);
             void EstimateParams();
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
-            void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
+            void RunG(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
+            virtual void RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
         public:
             ResizerByteBilinear(const ResParam & param);
-
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
         };
 
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
@@ -211,11 +407,48 @@ namespace Simd
         class ResizerByteArea : public Sse2::ResizerByteArea
         {
         protected:
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, int32_t * by);
+            virtual void RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
         public:
             ResizerByteArea(const ResParam & param);
+        };
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        class ResizerShortBilinear : public Base::ResizerShortBilinear
+        {
+            virtual void Run(const uint16_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint16_t * dst, size_t dstStride, float * buf);
+        public:
+            ResizerShortBilinear(const ResParam & param);
+        };
+
+        class ResizerFilter : public Base::ResizerFilter
+        {
+        public:
+            ResizerFilter(const ResParam & param);
+        };
+
+        class ResizerNearest : public Base::ResizerNearest
+        {
+        public:
+            ResizerNearest(const ResParam & param);
+
+        protected:
+            size_t _loads, _pixels;
+            Array32i _offsets;
+            Array8u _shuffle;
+
+            virtual void RunRow(const uint8_t * src, uint8_t * dst);
+        };
+
+        class ResizerFloatArea : public Base::ResizerFloatArea
+        {
+        public:
+            ResizerFloatArea(const ResParam & param);
+        };
+
+        class ResizerShortArea : public Base::ResizerShortArea
+        {
+        public:
+            ResizerShortArea(const ResParam & param);
         };
 
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
@@ -227,7 +460,7 @@ namespace Simd
     {
         class ResizerFloatBilinear : public Base::ResizerFloatBilinear
         {
-            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+            virtual void Run(const float * src, size_t srcStride, size_t yBeg, size_t yEnd, float * dst, size_t dstStride, float * buf);
         public:
             ResizerFloatBilinear(const ResParam & param);
         };
@@ -258,31 +491,66 @@ namespace Simd
             Array<Idx> _ixg;
 
             void EstimateParams();
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
-            void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
+            void RunG(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
+            virtual void RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
         public:
             ResizerByteBilinear(const ResParam & param);
-
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
         };
 
         class ResizerByteArea : public Sse41::ResizerByteArea
         {
         protected:
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, int32_t * by);
+            virtual void RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
         public:
             ResizerByteArea(const ResParam & param);
-
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
         };
 
         class ResizerFloatBilinear : public Base::ResizerFloatBilinear
         {
-            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+            virtual void Run(const float * src, size_t srcStride, size_t yBeg, size_t yEnd, float * dst, size_t dstStride, float * buf);
         public:
             ResizerFloatBilinear(const ResParam & param);
         };
 
+        class ResizerShortBilinear : public Base::ResizerShortBilinear
+        {
+            virtual void Run(const uint16_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint16_t * dst, size_t dstStride, float * buf);
+        public:
+            ResizerShortBilinear(const ResParam & param);
+        };
+
+        class ResizerFilter : public Sse41::ResizerFilter
+        {
+        public:
+            ResizerFilter(const ResParam & param);
+        };
+
+        class ResizerNearest : public Sse41::ResizerNearest
+        {
+        public:
+            ResizerNearest(const ResParam & param);
+
+        protected:
+            bool _avx2;
+            Array32i _permute;
+
+            virtual void RunRow(const uint8_t * src, uint8_t * dst);
+        };
+
+        class ResizerFloatArea : public Sse41::ResizerFloatArea
+        {
+        public:
+            ResizerFloatArea(const ResParam & param);
+        };
+
+        class ResizerShortArea : public Sse41::ResizerShortArea
+        {
+        public:
+            ResizerShortArea(const ResParam & param);
+        };
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_AVX2_ENABLE 
@@ -292,7 +560,7 @@ namespace Simd
     {
         class ResizerFloatBilinear : public Base::ResizerFloatBilinear
         {
-            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+            virtual void Run(const float * src, size_t srcStride, size_t yBeg, size_t yEnd, float * dst, size_t dstStride, float * buf);
         public:
             ResizerFloatBilinear(const ResParam & param);
         };
@@ -307,22 +575,49 @@ namespace Simd
         class ResizerByteBilinear : public Avx2::ResizerByteBilinear
         {
         protected:
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
-            void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
+            void RunG(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
+            virtual void RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
         public:
             ResizerByteBilinear(const ResParam & param);
-
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
         };
 
         class ResizerByteArea : public Avx2::ResizerByteArea
         {
         protected:
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, int32_t * by);
+            virtual void RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
         public:
             ResizerByteArea(const ResParam & param);
+        };
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        class ResizerFilter : public Avx2::ResizerFilter
+        {
+        public:
+            ResizerFilter(const ResParam & param);
+        };
+
+        class ResizerNearest : public Avx2::ResizerNearest
+        {
+        public:
+            ResizerNearest(const ResParam & param);
+
+        protected:
+            bool _avx512bw;
+
+            virtual void RunRow(const uint8_t * src, uint8_t * dst);
+        };
+
+        class ResizerFloatArea : public Avx2::ResizerFloatArea
+        {
+        public:
+            ResizerFloatArea(const ResParam & param);
+        };
+
+        class ResizerShortArea : public Avx2::ResizerShortArea
+        {
+        public:
+            ResizerShortArea(const ResParam & param);
         };
 
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
@@ -335,7 +630,7 @@ namespace Simd
         class ResizerByteBilinear : public Base::ResizerByteBilinear
         {
         protected:
-            Array8u _ax, _bx[2];
+            Array8u _ax;
             size_t _blocks;
             struct Idx
             {
@@ -346,29 +641,26 @@ namespace Simd
 
             size_t BlockCountMax(size_t align);
             void EstimateParams();
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
-            void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
+            void RunG(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
+            virtual void RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
         public:
             ResizerByteBilinear(const ResParam & param);
-
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
         };
 
         class ResizerByteArea : public Base::ResizerByteArea
         {
         protected:
-            Array32i _by;
-
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual size_t BufferSize() const;
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, int32_t * by);
+            virtual void RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf);
         public:
             ResizerByteArea(const ResParam & param);
-
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
         };
 
         class ResizerFloatBilinear : public Base::ResizerFloatBilinear
         {
-            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+            virtual void Run(const float * src, size_t srcStride, size_t yBeg, size_t yEnd, float * dst, size_t dstStride, float * buf);
         public:
             ResizerFloatBilinear(const ResParam & param);
         };
@@ -31,8 +31,10 @@
 #include <limits>
 #include <algorithm>
 #include <string>
-#ifdef SIMD_RUNTIME_STATISTIC
 #include <sstream>
+#include <map>
+#include <mutex>
+#ifdef SIMD_RUNTIME_STATISTIC
 #include <iostream>
 #include <iomanip>
 #endif
@@ -41,6 +43,37 @@ namespace Simd
 {
     typedef ::std::string String;
 
+    namespace Base
+    {
+        /*
+        * Process-wide cache of Simd::Runtime tuning results: the name of the fastest candidate for given CPU model, 
+        * problem shape, number of threads and set of candidates. It can be exported and imported in text format (one entry per line).
+        */
+        class RuntimeCache
+        {
+        public:
+            static RuntimeCache & Global();
+
+            bool Find(const String & key, String & best) const;
+            void Add(const String & key, const String & best);
+            void Clear();
+
+            String Export() const;
+            bool Import(const String & data);
+
+            bool Save(const String & path) const;
+            bool Load(const String & path);
+
+        private:
+            RuntimeCache();
+
+            typedef std::map<String, String> Map;
+            mutable std::mutex _mutex;
+            Map _map;
+            String _cpu;
+        };
+    }
+
     template <class Func, class Args> struct Runtime
     {
         SIMD_INLINE Runtime()
@@ -71,11 +104,13 @@ namespace Simd
             _candidates.clear();
             _candidates.push_back(Candidate(func));
             _best = &_candidates[0].func;
+            _key.clear();
         }
 
         SIMD_INLINE void Init(const std::vector<Func> & funcs)
         {
             assert(funcs.size() >= 1);
+            _key.clear();
             _candidates.clear();
             for (size_t i = 0; i < funcs.size(); ++i)
                 _candidates.push_back(Candidate(funcs[i]));
@@ -140,11 +175,22 @@ namespace Simd
 
         Func * _best;
         Candidates _candidates;
-        String _info;
+        String _info, _key;
 
         SIMD_INLINE void Test(const Args & args)
         {
             assert(_candidates.size());
+            if (_key.empty())
+            {
+                _key = Key(args);
+                Candidate * cached = Cached();
+                if (cached)
+                {
+                    _best = &cached->func;
+                    _best->Run(args);
+                    return;
+                }
+            }
             Candidate * current = Current();
             if (current)
             {
@@ -159,10 +205,31 @@ namespace Simd
             else
             {
                 _best = &Best()->func;
+                Base::RuntimeCache::Global().Add(_key, _best->Name());
                 _best->Run(args);
             }
         }
 
+        SIMD_INLINE String Key(const Args & args) const
+        {
+            String key = _candidates[0].func.Info(args) + "|" + ToStr(Base::GetThreadNumber()) + "|";
+            for (size_t i = 0; i < _candidates.size(); ++i)
+                key += (i ? "," : "") + _candidates[i].func.Name();
+            return key;
+        }
+
+        SIMD_INLINE Candidate * Cached()
+        {
+            String best;
+            if (Base::RuntimeCache::Global().Find(_key, best))
+            {
+                for (size_t i = 0; i < _candidates.size(); ++i)
+                    if (_candidates[i].func.Name() == best)
+                        return &_candidates[i];
+            }
+            return NULL;
+        }
+
         SIMD_INLINE Candidate * Current()
         {
             size_t min = TEST_COUNT;
@@ -222,14 +289,12 @@ namespace Simd
             _func(args.M, args.N, args.K, args.alpha, args.A, args.lda, args.B, args.ldb, args.beta, args.C, args.ldc);
         }
 
-#ifdef SIMD_RUNTIME_STATISTIC
         SIMD_INLINE String Info(const GemmArgs & args) const
         {
             std::stringstream ss;
             ss << "Gemm [" << args.M << ", " << args.N << ", " << args.K << "]";
             return ss.str();
         }
-#endif
 
     private:
         Func _func;
@@ -280,14 +345,12 @@ namespace Simd
             _run(args.M, args.N, args.K, args.A, args.pB, args.C, _type, _type != GemmKernelAny);
         }
 
-#ifdef SIMD_RUNTIME_STATISTIC
         SIMD_INLINE String Info(const GemmCbArgs & args) const
         {
             std::stringstream ss;
             ss << "GemmCb [" << args.M << ", " << args.N << ", " << args.K << "]";
             return ss.str();
         }
-#endif 
         
         SIMD_INLINE GemmKernelType Type() const { return _type; }
 
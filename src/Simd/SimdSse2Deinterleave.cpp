@@ -82,6 +82,135 @@ namespace Simd
             else
                 DeinterleaveUv<false>(uv, uvStride, width, height, u, uStride, v, vStride);
         }
+
+        //---------------------------------------------------------------------
+
+        template<bool uyvy> SIMD_INLINE __m128i PackedYuvToY(__m128i src0, __m128i src1)
+        {
+            if (uyvy)
+                return _mm_packus_epi16(_mm_srli_epi16(src0, 8), _mm_srli_epi16(src1, 8));
+            else
+                return _mm_packus_epi16(_mm_and_si128(src0, K16_00FF), _mm_and_si128(src1, K16_00FF));
+        }
+
+        template<bool uyvy> SIMD_INLINE __m128i PackedYuvToUv(__m128i src0, __m128i src1)
+        {
+            return PackedYuvToY<!uyvy>(src0, src1);
+        }
+
+        template<bool uyvy> void PackedYuvToGray(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * gray, size_t grayStride)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    _mm_storeu_si128((__m128i*)(gray + col), PackedYuvToY<uyvy>(
+                        _mm_loadu_si128((__m128i*)(src + 2 * col) + 0), _mm_loadu_si128((__m128i*)(src + 2 * col) + 1)));
+                if (widthA != width)
+                    _mm_storeu_si128((__m128i*)(gray + tail), PackedYuvToY<uyvy>(
+                        _mm_loadu_si128((__m128i*)(src + 2 * tail) + 0), _mm_loadu_si128((__m128i*)(src + 2 * tail) + 1)));
+                src += srcStride;
+                gray += grayStride;
+            }
+        }
+
+        void YuyvToGray(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * gray, size_t grayStride)
+        {
+            PackedYuvToGray<false>(yuyv, yuyvStride, width, height, gray, grayStride);
+        }
+
+        void UyvyToGray(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * gray, size_t grayStride)
+        {
+            PackedYuvToGray<true>(uyvy, uyvyStride, width, height, gray, grayStride);
+        }
+
+        template<bool uyvy> SIMD_INLINE void PackedYuvToNv12(const uint8_t * src0, const uint8_t * src1, uint8_t * y0, uint8_t * y1, uint8_t * uv)
+        {
+            __m128i s00 = _mm_loadu_si128((__m128i*)src0 + 0), s01 = _mm_loadu_si128((__m128i*)src0 + 1);
+            __m128i s10 = _mm_loadu_si128((__m128i*)src1 + 0), s11 = _mm_loadu_si128((__m128i*)src1 + 1);
+            _mm_storeu_si128((__m128i*)y0, PackedYuvToY<uyvy>(s00, s01));
+            _mm_storeu_si128((__m128i*)y1, PackedYuvToY<uyvy>(s10, s11));
+            _mm_storeu_si128((__m128i*)uv, PackedYuvToUv<uyvy>(_mm_avg_epu8(s00, s10), _mm_avg_epu8(s01, s11)));
+        }
+
+        template<bool uyvy> void PackedYuvToNv12(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A));
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    PackedYuvToNv12<uyvy>(src + 2 * col, src + srcStride + 2 * col, y + col, y + yStride + col, uv + col);
+                if (widthA != width)
+                    PackedYuvToNv12<uyvy>(src + 2 * tail, src + srcStride + 2 * tail, y + tail, y + yStride + tail, uv + tail);
+                src += 2 * srcStride;
+                y += 2 * yStride;
+                uv += uvStride;
+            }
+        }
+
+        void YuyvToNv12(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+        {
+            PackedYuvToNv12<false>(yuyv, yuyvStride, width, height, y, yStride, uv, uvStride);
+        }
+
+        void UyvyToNv12(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+        {
+            PackedYuvToNv12<true>(uyvy, uyvyStride, width, height, y, yStride, uv, uvStride);
+        }
+
+        template<bool uyvy> SIMD_INLINE void PackedYuvToYuv420p(const uint8_t * src0, const uint8_t * src1, uint8_t * y0, uint8_t * y1, uint8_t * u, uint8_t * v)
+        {
+            __m128i s00 = _mm_loadu_si128((__m128i*)src0 + 0), s01 = _mm_loadu_si128((__m128i*)src0 + 1);
+            __m128i s02 = _mm_loadu_si128((__m128i*)src0 + 2), s03 = _mm_loadu_si128((__m128i*)src0 + 3);
+            __m128i s10 = _mm_loadu_si128((__m128i*)src1 + 0), s11 = _mm_loadu_si128((__m128i*)src1 + 1);
+            __m128i s12 = _mm_loadu_si128((__m128i*)src1 + 2), s13 = _mm_loadu_si128((__m128i*)src1 + 3);
+            _mm_storeu_si128((__m128i*)y0 + 0, PackedYuvToY<uyvy>(s00, s01));
+            _mm_storeu_si128((__m128i*)y0 + 1, PackedYuvToY<uyvy>(s02, s03));
+            _mm_storeu_si128((__m128i*)y1 + 0, PackedYuvToY<uyvy>(s10, s11));
+            _mm_storeu_si128((__m128i*)y1 + 1, PackedYuvToY<uyvy>(s12, s13));
+            __m128i uv0 = PackedYuvToUv<uyvy>(_mm_avg_epu8(s00, s10), _mm_avg_epu8(s01, s11));
+            __m128i uv1 = PackedYuvToUv<uyvy>(_mm_avg_epu8(s02, s12), _mm_avg_epu8(s03, s13));
+            _mm_storeu_si128((__m128i*)u, PackedYuvToY<false>(uv0, uv1));
+            _mm_storeu_si128((__m128i*)v, PackedYuvToY<true>(uv0, uv1));
+        }
+
+        template<bool uyvy> void PackedYuvToYuv420p(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA));
+
+            size_t widthDA = AlignLo(width, DA), tail = width - DA;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < widthDA; col += DA)
+                    PackedYuvToYuv420p<uyvy>(src + 2 * col, src + srcStride + 2 * col, y + col, y + yStride + col, u + col / 2, v + col / 2);
+                if (widthDA != width)
+                    PackedYuvToYuv420p<uyvy>(src + 2 * tail, src + srcStride + 2 * tail, y + tail, y + yStride + tail, u + tail / 2, v + tail / 2);
+                src += 2 * srcStride;
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+            }
+        }
+
+        void YuyvToYuv420p(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            PackedYuvToYuv420p<false>(yuyv, yuyvStride, width, height, y, yStride, u, uStride, v, vStride);
+        }
+
+        void UyvyToYuv420p(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            PackedYuvToYuv420p<true>(uyvy, uyvyStride, width, height, y, yStride, u, uStride, v, vStride);
+        }
     }
 #endif// SIMD_SSE2_ENABLE
 }
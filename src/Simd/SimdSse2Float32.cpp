@@ -107,6 +107,37 @@ namespace Simd
             else
                 Uint8ToFloat32<false>(src, size, lower, upper, dst);
         }
+
+        template <bool align> SIMD_INLINE void Uint16ToFloat32(const uint16_t * src, const __m128 & lower, const __m128 & boost, float * dst)
+        {
+            __m128i _src = Load<align>((__m128i*)src);
+            Sse::Store<align>(dst + 0, Uint8ToFloat32(UnpackU16<0>(_src), lower, boost));
+            Sse::Store<align>(dst + F, Uint8ToFloat32(UnpackU16<1>(_src), lower, boost));
+        }
+
+        template <bool align> void Uint16ToFloat32(const uint16_t * src, size_t size, int bits, const float * lower, const float * upper, float * dst)
+        {
+            assert(size >= HA);
+            if (align)
+                assert(Aligned(src) && Aligned(dst));
+
+            __m128 _lower = _mm_set1_ps(lower[0]);
+            __m128 boost = _mm_set1_ps((upper[0] - lower[0]) / float((1 << bits) - 1));
+
+            size_t alignedSize = AlignLo(size, HA);
+            for (size_t i = 0; i < alignedSize; i += HA)
+                Uint16ToFloat32<align>(src + i, _lower, boost, dst + i);
+            if (alignedSize != size)
+                Uint16ToFloat32<false>(src + size - HA, _lower, boost, dst + size - HA);
+        }
+
+        void Uint16ToFloat32(const uint16_t * src, size_t size, int bits, const float * lower, const float * upper, float * dst)
+        {
+            if (Aligned(src) && Aligned(dst))
+                Uint16ToFloat32<true>(src, size, bits, lower, upper, dst);
+            else
+                Uint16ToFloat32<false>(src, size, bits, lower, upper, dst);
+        }
     }
 #endif// SIMD_SSE2_ENABLE
 }
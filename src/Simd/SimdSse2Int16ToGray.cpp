@@ -61,6 +61,46 @@ namespace Simd
             else
                 Int16ToGray<false>((const int16_t *)src, width, height, srcStride / sizeof(int16_t), dst, dstStride);
         }
+
+        SIMD_INLINE __m128i Uint16ToGray(__m128i value, __m128i shift)
+        {
+            value = _mm_srl_epi16(value, shift);
+            return _mm_sub_epi16(value, _mm_subs_epu16(value, K16_00FF));
+        }
+
+        template <bool align> SIMD_INLINE void Uint16ToGray(const uint16_t * src, __m128i shift, uint8_t * dst)
+        {
+            __m128i lo = Uint16ToGray(Load<align>((__m128i*)src + 0), shift);
+            __m128i hi = Uint16ToGray(Load<align>((__m128i*)src + 1), shift);
+            Store<align>((__m128i*)dst, _mm_packus_epi16(lo, hi));
+        }
+
+        template <bool align> void Uint16ToGray(const uint16_t * src, size_t width, size_t height, size_t srcStride, int shift, uint8_t * dst, size_t dstStride)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(src) && Aligned(srcStride, HA) && Aligned(dst) && Aligned(dstStride));
+
+            __m128i _shift = _mm_cvtsi32_si128(shift);
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    Uint16ToGray<align>(src + col, _shift, dst + col);
+                if (alignedWidth != width)
+                    Uint16ToGray<false>(src + width - A, _shift, dst + width - A);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        void Uint16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, int shift, uint8_t * dst, size_t dstStride)
+        {
+            if (Aligned(src) && Aligned(srcStride) && Aligned(dst) && Aligned(dstStride))
+                Uint16ToGray<true>((const uint16_t *)src, width, height, srcStride / sizeof(uint16_t), shift, dst, dstStride);
+            else
+                Uint16ToGray<false>((const uint16_t *)src, width, height, srcStride / sizeof(uint16_t), shift, dst, dstStride);
+        }
     }
 #endif// SIMD_SSE2_ENABLE
 }
@@ -64,8 +64,7 @@ namespace Simd
                 _ax.data[2 * dx + 0] = (int16_t)(Base::FRACTION_RANGE - _ax.data[2 * dx + 1]);
             }
             size_t size = AlignHi(_param.dstW, A)*_param.channels * 2;
-            _bx[0].Resize(size);
-            _bx[1].Resize(size);
+            _bufSize = size;
         }
 
         template <size_t N> void ResizerByteBilinearInterpolateX(const __m128i * alpha, __m128i * buffer);
@@ -114,7 +113,7 @@ namespace Simd
             Store<false>((__m128i*)dst, _mm_packus_epi16(lo, hi));
         }
 
-        template<size_t N> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
         {
             assert(_param.dstW >= A);
 
@@ -129,9 +128,10 @@ namespace Simd
 
             ptrdiff_t previous = -2;
             __m128i a[2];
-            uint8_t * pbx[2] = { _bx[0].data, _bx[1].data };
+            uint8_t * pbx[2] = { buf, buf + _bufSize };
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t yDst = yBeg; yDst < yEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm_set1_epi16(int16_t(_ay[yDst]));
@@ -167,13 +167,12 @@ namespace Simd
             }
         }
 
-        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteBilinear::RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
         {
-            EstimateParams();
             switch (_param.channels)
             {
-            case 1: Run<1>(src, srcStride, dst, dstStride); break;
-            case 2: Run<2>(src, srcStride, dst, dstStride); break;
+            case 1: Run<1>(src, srcStride, yBeg, yEnd, dst, dstStride, buf); break;
+            case 2: Run<2>(src, srcStride, yBeg, yEnd, dst, dstStride, buf); break;
             default:
                 assert(0);
             }        
@@ -184,7 +183,6 @@ namespace Simd
         ResizerByteArea::ResizerByteArea(const ResParam & param)
             : Base::ResizerByteArea(param)
         {
-            _by.Resize(AlignHi(_param.srcW*_param.channels, _param.align), false, _param.align);
         }
 
         template<UpdateType update> SIMD_INLINE void ResizerByteAreaRowUpdate(const uint8_t * src0, size_t size, int32_t a, int32_t * dst)
@@ -261,14 +259,16 @@ namespace Simd
             ResizerByteAreaRes<N>(sum, dst);
         }
 
-        template<size_t N> void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, int32_t * by)
         {
             size_t dstW = _param.dstW, rowSize = _param.srcW*N, rowRest = dstStride - dstW*N;
             const int32_t * iy = _iy.data, * ix = _ix.data, * ay = _ay.data, * ax = _ax.data;
             int32_t ay0 = ay[0], ax0 = ax[0];
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
+            src += iy[yBeg] * srcStride;
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += rowRest)
             {
-                int32_t * buf = _by.data;
+                int32_t * buf = by;
                 size_t yn = iy[dy + 1] - iy[dy];
                 ResizerByteAreaRowSum(src, srcStride, yn, rowSize, ay[dy], ay0, ay[dy + 1], buf), src += yn * srcStride;
                 for (size_t dx = 0; dx < dstW; dx++, dst += N)
@@ -279,14 +279,19 @@ namespace Simd
             }
         }
 
-        void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        size_t ResizerByteArea::BufferSize() const
+        {
+            return AlignHi(_param.srcW * _param.channels, _param.align) * sizeof(int32_t);
+        }
+
+        void ResizerByteArea::RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
         {
             switch (_param.channels)
             {
-            case 1: Run<1>(src, srcStride, dst, dstStride); return;
-            case 2: Run<2>(src, srcStride, dst, dstStride); return;
-            case 3: Run<3>(src, srcStride, dst, dstStride); return;
-            case 4: Run<4>(src, srcStride, dst, dstStride); return;
+            case 1: Run<1>(src, srcStride, yBeg, yEnd, dst, dstStride, (int32_t*)buf); return;
+            case 2: Run<2>(src, srcStride, yBeg, yEnd, dst, dstStride, (int32_t*)buf); return;
+            case 3: Run<3>(src, srcStride, yBeg, yEnd, dst, dstStride, (int32_t*)buf); return;
+            case 4: Run<4>(src, srcStride, yBeg, yEnd, dst, dstStride, (int32_t*)buf); return;
             default:
                 assert(0);
             }
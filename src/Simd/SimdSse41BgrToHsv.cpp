@@ -0,0 +1,191 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdColorSpace.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        /* Exact truncating division by 255 for values in [0, 2^20): the half offset keeps multiples of 255 from rounding down. */
+        SIMD_INLINE __m128i DivideBy255(__m128i value)
+        {
+            return _mm_cvttps_epi32(_mm_mul_ps(_mm_add_ps(_mm_cvtepi32_ps(value), _mm_set1_ps(0.5f)), _mm_set1_ps(1.0f / 255.0f)));
+        }
+
+        SIMD_INLINE __m128i HueDividend(__m128i blue, __m128i green, __m128i red, __m128i max, __m128i range)
+        {
+            __m128i range2 = _mm_add_epi32(range, range), range4 = _mm_add_epi32(range2, range2);
+            __m128i dividend = _mm_add_epi32(_mm_sub_epi32(red, green), range4);
+            dividend = _mm_blendv_epi8(dividend, _mm_add_epi32(_mm_sub_epi32(blue, red), range2), _mm_cmpeq_epi32(green, max));
+            return _mm_blendv_epi8(dividend, _mm_add_epi32(_mm_sub_epi32(green, blue), _mm_add_epi32(range4, range2)), _mm_cmpeq_epi32(red, max));
+        }
+
+        SIMD_INLINE __m128i BgrToHue(__m128i blue, __m128i green, __m128i red, __m128i max, __m128i range)
+        {
+            __m128i dividend = HueDividend(blue, green, red, max, range);
+            __m128 hue = _mm_div_ps(_mm_mul_ps(_mm_set1_ps(Base::KF_255_DIV_6), _mm_cvtepi32_ps(dividend)), _mm_cvtepi32_ps(range));
+            return _mm_andnot_si128(_mm_cmpeq_epi32(range, K_ZERO), _mm_cvttps_epi32(hue));
+        }
+
+        SIMD_INLINE void BgrToHsv(const uint8_t * bgr, uint8_t * hsv)
+        {
+            __m128i blue, green, red;
+            LoadBgr32i(bgr, blue, green, red);
+            __m128i max = _mm_max_epi32(blue, _mm_max_epi32(green, red));
+            __m128i range = _mm_sub_epi32(max, _mm_min_epi32(blue, _mm_min_epi32(green, red)));
+            __m128i hue = BgrToHue(blue, green, red, max, range);
+            __m128 saturation = _mm_div_ps(_mm_cvtepi32_ps(_mm_sub_epi32(_mm_slli_epi32(range, 8), range)), _mm_cvtepi32_ps(max));
+            StoreBgr32i(hsv, hue, _mm_andnot_si128(_mm_cmpeq_epi32(max, K_ZERO), _mm_cvttps_epi32(saturation)), max);
+        }
+
+        void BgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
+        {
+            ColorSpace<BgrToHsv>(bgr, width, height, bgrStride, hsv, hsvStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void BgrToHsl(const uint8_t * bgr, uint8_t * hsl)
+        {
+            __m128i blue, green, red;
+            LoadBgr32i(bgr, blue, green, red);
+            __m128i max = _mm_max_epi32(blue, _mm_max_epi32(green, red));
+            __m128i min = _mm_min_epi32(blue, _mm_min_epi32(green, red));
+            __m128i range = _mm_sub_epi32(max, min), sum = _mm_add_epi32(max, min);
+            __m128i hue = BgrToHue(blue, green, red, max, range);
+            __m128i divisor = _mm_min_epi32(sum, _mm_sub_epi32(_mm_set1_epi32(510), sum));
+            __m128 saturation = _mm_div_ps(_mm_cvtepi32_ps(_mm_sub_epi32(_mm_slli_epi32(range, 8), range)), _mm_cvtepi32_ps(divisor));
+            StoreBgr32i(hsl, hue, _mm_andnot_si128(_mm_cmpeq_epi32(divisor, K_ZERO), _mm_cvttps_epi32(saturation)), _mm_srli_epi32(sum, 1));
+        }
+
+        void BgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride)
+        {
+            ColorSpace<BgrToHsl>(bgr, width, height, bgrStride, hsl, hslStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m128 BgrToHue32f(__m128i blue, __m128i green, __m128i red, __m128i max, __m128i range)
+        {
+            __m128i dividend = HueDividend(blue, green, red, max, range);
+            __m128 hue = _mm_div_ps(_mm_mul_ps(_mm_set1_ps(60.0f), _mm_cvtepi32_ps(dividend)), _mm_cvtepi32_ps(range));
+            hue = _mm_sub_ps(hue, _mm_and_ps(_mm_cmpge_ps(hue, _mm_set1_ps(360.0f)), _mm_set1_ps(360.0f)));
+            return _mm_andnot_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(range, K_ZERO)), hue);
+        }
+
+        SIMD_INLINE void BgrToHsv32f(const uint8_t * bgr, float * hsv)
+        {
+            __m128i blue, green, red;
+            LoadBgr32i(bgr, blue, green, red);
+            __m128i max = _mm_max_epi32(blue, _mm_max_epi32(green, red));
+            __m128i range = _mm_sub_epi32(max, _mm_min_epi32(blue, _mm_min_epi32(green, red)));
+            __m128 hue = BgrToHue32f(blue, green, red, max, range);
+            __m128 _max = _mm_cvtepi32_ps(max);
+            __m128 saturation = _mm_andnot_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(max, K_ZERO)), _mm_div_ps(_mm_cvtepi32_ps(range), _max));
+            StoreBgr32f(hsv, hue, saturation, _mm_mul_ps(_max, _mm_set1_ps(1.0f / 255.0f)));
+        }
+
+        void BgrToHsv32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * hsv, size_t hsvStride)
+        {
+            ColorSpace32f<BgrToHsv32f>(bgr, width, height, bgrStride, hsv, hsvStride);
+        }
+
+        SIMD_INLINE void BgrToHsl32f(const uint8_t * bgr, float * hsl)
+        {
+            __m128i blue, green, red;
+            LoadBgr32i(bgr, blue, green, red);
+            __m128i max = _mm_max_epi32(blue, _mm_max_epi32(green, red));
+            __m128i min = _mm_min_epi32(blue, _mm_min_epi32(green, red));
+            __m128i range = _mm_sub_epi32(max, min), sum = _mm_add_epi32(max, min);
+            __m128 hue = BgrToHue32f(blue, green, red, max, range);
+            __m128i divisor = _mm_min_epi32(sum, _mm_sub_epi32(_mm_set1_epi32(510), sum));
+            __m128 saturation = _mm_andnot_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(divisor, K_ZERO)), _mm_div_ps(_mm_cvtepi32_ps(range), _mm_cvtepi32_ps(divisor)));
+            StoreBgr32f(hsl, hue, saturation, _mm_mul_ps(_mm_cvtepi32_ps(sum), _mm_set1_ps(1.0f / 510.0f)));
+        }
+
+        void BgrToHsl32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * hsl, size_t hslStride)
+        {
+            ColorSpace32f<BgrToHsl32f>(bgr, width, height, bgrStride, hsl, hslStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void HueToBgr(__m128i hue, __m128i min, __m128i max, uint8_t * bgr)
+        {
+            __m128i hue6 = _mm_add_epi32(_mm_slli_epi32(hue, 2), _mm_slli_epi32(hue, 1));
+            __m128i sector = DivideBy255(hue6);
+            __m128i delta = DivideBy255(_mm_mullo_epi32(_mm_sub_epi32(max, min), _mm_sub_epi32(hue6, _mm_sub_epi32(_mm_slli_epi32(sector, 8), sector))));
+            __m128i up = _mm_add_epi32(min, delta), down = _mm_sub_epi32(max, delta);
+            __m128i s1 = _mm_cmpeq_epi32(sector, _mm_set1_epi32(1));
+            __m128i s2 = _mm_cmpeq_epi32(sector, _mm_set1_epi32(2));
+            __m128i s3 = _mm_cmpeq_epi32(sector, _mm_set1_epi32(3));
+            __m128i s4 = _mm_cmpeq_epi32(sector, _mm_set1_epi32(4));
+            __m128i s5 = _mm_cmpeq_epi32(sector, _mm_set1_epi32(5));
+            __m128i blue = _mm_blendv_epi8(min, up, s2);
+            blue = _mm_blendv_epi8(blue, max, _mm_or_si128(s3, s4));
+            blue = _mm_blendv_epi8(blue, down, s5);
+            __m128i green = _mm_blendv_epi8(up, max, _mm_or_si128(s1, s2));
+            green = _mm_blendv_epi8(green, down, s3);
+            green = _mm_blendv_epi8(green, min, _mm_or_si128(s4, s5));
+            __m128i red = _mm_blendv_epi8(max, down, s1);
+            red = _mm_blendv_epi8(red, min, _mm_or_si128(s2, s3));
+            red = _mm_blendv_epi8(red, up, s4);
+            StoreBgr32i(bgr, blue, green, red);
+        }
+
+        SIMD_INLINE void HsvToBgr(const uint8_t * hsv, uint8_t * bgr)
+        {
+            __m128i hue, saturation, value;
+            LoadBgr32i(hsv, hue, saturation, value);
+            __m128i min = DivideBy255(_mm_mullo_epi32(_mm_sub_epi32(K32_000000FF, saturation), value));
+            HueToBgr(hue, min, value, bgr);
+        }
+
+        void HsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride)
+        {
+            ColorSpace<HsvToBgr>(hsv, width, height, hsvStride, bgr, bgrStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void HslToBgr(const uint8_t * hsl, uint8_t * bgr)
+        {
+            __m128i hue, saturation, lightness;
+            LoadBgr32i(hsl, hue, saturation, lightness);
+            __m128i dark = DivideBy255(_mm_mullo_epi32(lightness, _mm_add_epi32(K32_000000FF, saturation)));
+            __m128i light = DivideBy255(_mm_add_epi32(_mm_mullo_epi32(_mm_sub_epi32(K32_000000FF, lightness), saturation),
+                _mm_sub_epi32(_mm_slli_epi32(lightness, 8), lightness)));
+            __m128i max = _mm_blendv_epi8(dark, light, _mm_cmpgt_epi32(lightness, _mm_set1_epi32(128)));
+            __m128i min = DivideBy255(_mm_mullo_epi32(_mm_sub_epi32(K32_000000FF, saturation), max));
+            HueToBgr(hue, min, max, bgr);
+        }
+
+        void HslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride)
+        {
+            ColorSpace<HslToBgr>(hsl, width, height, hslStride, bgr, bgrStride);
+        }
+    }
+#endif//SIMD_SSE41_ENABLE
+}
@@ -0,0 +1,148 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdColorSpace.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        /*
+        * SSE4.1 has no gather instruction. Measured on 4096x4096 image: evaluation of gamma and cube root with Sse2::Pow
+        * is 2.7 times slower than table lookups, and Newton iterations for cube root are 10% slower. So gamma is read
+        * directly by source bytes and both nodes of cube root interpolation are read by one 64-bit load per lane.
+        */
+        SIMD_INLINE __m128 LoadGamma(const uint8_t * bgr)
+        {
+            const float * gamma = Base::LAB_TABLES.gamma;
+            return _mm_setr_ps(gamma[bgr[0]], gamma[bgr[3]], gamma[bgr[6]], gamma[bgr[9]]);
+        }
+
+        SIMD_INLINE __m128i Gather(const int32_t * table, __m128i index)
+        {
+            return _mm_setr_epi32(table[_mm_extract_epi32(index, 0)], table[_mm_extract_epi32(index, 1)],
+                table[_mm_extract_epi32(index, 2)], table[_mm_extract_epi32(index, 3)]);
+        }
+
+        SIMD_INLINE __m128i RestrictRange8u(__m128i value)
+        {
+            return _mm_min_epi32(_mm_max_epi32(value, K_ZERO), K32_000000FF);
+        }
+
+        SIMD_INLINE __m128 LabCbrt(__m128 value)
+        {
+            __m128 t = _mm_mul_ps(_mm_max_ps(_mm_setzero_ps(), _mm_min_ps(_mm_set1_ps(1.0f), value)), _mm_set1_ps((float)Base::LAB_CBRT_TABLE_SIZE));
+            __m128i i = _mm_min_epi32(_mm_cvttps_epi32(t), _mm_set1_epi32(Base::LAB_CBRT_TABLE_SIZE - 1));
+            __m128 f = _mm_sub_ps(t, _mm_cvtepi32_ps(i));
+            const float * cbrt = Base::LAB_TABLES.cbrt;
+            __m128 c01 = _mm_castpd_ps(_mm_loadh_pd(_mm_load_sd((double*)(cbrt + _mm_cvtsi128_si32(i))), (double*)(cbrt + _mm_extract_epi32(i, 1))));
+            __m128 c23 = _mm_castpd_ps(_mm_loadh_pd(_mm_load_sd((double*)(cbrt + _mm_extract_epi32(i, 2))), (double*)(cbrt + _mm_extract_epi32(i, 3))));
+            __m128 c0 = _mm_shuffle_ps(c01, c23, 0x88);
+            __m128 c1 = _mm_shuffle_ps(c01, c23, 0xDD);
+            return _mm_add_ps(c0, _mm_mul_ps(_mm_sub_ps(c1, c0), f));
+        }
+
+        SIMD_INLINE __m128 Dot(__m128 r, __m128 g, __m128 b, float kr, float kg, float kb)
+        {
+            return _mm_add_ps(_mm_add_ps(_mm_mul_ps(r, _mm_set1_ps(kr)), _mm_mul_ps(g, _mm_set1_ps(kg))), _mm_mul_ps(b, _mm_set1_ps(kb)));
+        }
+
+        SIMD_INLINE void LabF(__m128 b, __m128 g, __m128 r, __m128 & fx, __m128 & fy, __m128 & fz)
+        {
+            fx = LabCbrt(Dot(r, g, b, Base::LAB_XR, Base::LAB_XG, Base::LAB_XB));
+            fy = LabCbrt(Dot(r, g, b, Base::LAB_YR, Base::LAB_YG, Base::LAB_YB));
+            fz = LabCbrt(Dot(r, g, b, Base::LAB_ZR, Base::LAB_ZG, Base::LAB_ZB));
+        }
+
+        SIMD_INLINE void BgrToLab(const uint8_t * bgr, uint8_t * lab)
+        {
+            __m128 b = LoadGamma(bgr + 0);
+            __m128 g = LoadGamma(bgr + 1);
+            __m128 r = LoadGamma(bgr + 2);
+            __m128 fx, fy, fz;
+            LabF(b, g, r, fx, fy, fz);
+            __m128i l = _mm_cvtps_epi32(_mm_sub_ps(_mm_mul_ps(fy, _mm_set1_ps(Base::LAB_L_SCALE)), _mm_set1_ps(Base::LAB_L_SHIFT)));
+            __m128i a = _mm_cvtps_epi32(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(fx, fy), _mm_set1_ps(Base::LAB_A_SCALE)), _mm_set1_ps(Base::LAB_AB_SHIFT)));
+            __m128i _b = _mm_cvtps_epi32(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(fy, fz), _mm_set1_ps(Base::LAB_B_SCALE)), _mm_set1_ps(Base::LAB_AB_SHIFT)));
+            StoreBgr32i(lab, RestrictRange8u(l), RestrictRange8u(a), RestrictRange8u(_b));
+        }
+
+        void BgrToLab(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride)
+        {
+            ColorSpace<BgrToLab>(bgr, width, height, bgrStride, lab, labStride);
+        }
+
+        SIMD_INLINE void BgrToLab32f(const uint8_t * bgr, float * lab)
+        {
+            __m128 fx, fy, fz;
+            LabF(LoadGamma(bgr + 0), LoadGamma(bgr + 1), LoadGamma(bgr + 2), fx, fy, fz);
+            __m128 l = _mm_sub_ps(_mm_mul_ps(fy, _mm_set1_ps(Base::LAB_L_SCALE_32F)), _mm_set1_ps(Base::LAB_L_SHIFT_32F));
+            __m128 a = _mm_mul_ps(_mm_sub_ps(fx, fy), _mm_set1_ps(Base::LAB_A_SCALE));
+            __m128 _b = _mm_mul_ps(_mm_sub_ps(fy, fz), _mm_set1_ps(Base::LAB_B_SCALE));
+            StoreBgr32f(lab, l, a, _b);
+        }
+
+        void BgrToLab32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, float * lab, size_t labStride)
+        {
+            ColorSpace32f<BgrToLab32f>(bgr, width, height, bgrStride, lab, labStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m128 LabInvF(__m128 f)
+        {
+            __m128 cube = _mm_mul_ps(_mm_mul_ps(f, f), f);
+            __m128 linear = _mm_mul_ps(_mm_sub_ps(f, _mm_set1_ps(Base::LAB_F_SHIFT)), _mm_set1_ps(Base::LAB_F_LINEAR));
+            return _mm_blendv_ps(linear, cube, _mm_cmpgt_ps(f, _mm_set1_ps(Base::LAB_F_THRESHOLD)));
+        }
+
+        SIMD_INLINE __m128i LabToSrgb(__m128 value)
+        {
+            __m128 index = _mm_mul_ps(_mm_max_ps(_mm_setzero_ps(), _mm_min_ps(_mm_set1_ps(1.0f), value)), _mm_set1_ps((float)Base::LAB_SRGB_TABLE_SIZE));
+            return Gather(Base::LAB_TABLES.srgb, _mm_cvtps_epi32(index));
+        }
+
+        SIMD_INLINE void LabToBgr(const uint8_t * lab, uint8_t * bgr)
+        {
+            __m128i l, a, b;
+            LoadBgr32i(lab, l, a, b);
+            __m128 fy = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(l), _mm_set1_ps(Base::LAB_INV_L_SCALE)), _mm_set1_ps(Base::LAB_F_SHIFT));
+            __m128 fx = _mm_add_ps(fy, _mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(a, _mm_set1_epi32(128))), _mm_set1_ps(Base::LAB_INV_A_SCALE)));
+            __m128 fz = _mm_sub_ps(fy, _mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(b, _mm_set1_epi32(128))), _mm_set1_ps(Base::LAB_INV_B_SCALE)));
+            __m128 x = _mm_mul_ps(LabInvF(fx), _mm_set1_ps(Base::LAB_WHITE_X));
+            __m128 y = LabInvF(fy);
+            __m128 z = _mm_mul_ps(LabInvF(fz), _mm_set1_ps(Base::LAB_WHITE_Z));
+            __m128i blue = LabToSrgb(Dot(x, y, z, Base::LAB_BX, Base::LAB_BY, Base::LAB_BZ));
+            __m128i green = LabToSrgb(Dot(x, y, z, Base::LAB_GX, Base::LAB_GY, Base::LAB_GZ));
+            __m128i red = LabToSrgb(Dot(x, y, z, Base::LAB_RX, Base::LAB_RY, Base::LAB_RZ));
+            StoreBgr32i(bgr, blue, green, red);
+        }
+
+        void LabToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride)
+        {
+            ColorSpace<LabToBgr>(lab, width, height, labStride, bgr, bgrStride);
+        }
+    }
+#endif//SIMD_SSE41_ENABLE
+}
@@ -0,0 +1,214 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdColorSpace.h"
+#include "Simd/SimdLut3d.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        SIMD_INLINE __m128i Gather(const uint32_t * table, __m128i index)
+        {
+            return _mm_setr_epi32(table[_mm_extract_epi32(index, 0)], table[_mm_extract_epi32(index, 1)],
+                table[_mm_extract_epi32(index, 2)], table[_mm_extract_epi32(index, 3)]);
+        }
+
+        struct Lut3dConst
+        {
+            __m128i size, size2, last, mask;
+            __m128 scale, output, half;
+
+            SIMD_INLINE Lut3dConst(size_t s)
+            {
+                size = _mm_set1_epi32((int)s);
+                size2 = _mm_set1_epi32((int)(s * s));
+                last = _mm_set1_epi32((int)s - 2);
+                mask = _mm_set1_epi32(Base::LUT3D_MASK);
+                scale = _mm_set1_ps(float(s - 1) / 255.0f);
+                output = _mm_set1_ps(Base::LUT3D_SCALE);
+                half = _mm_set1_ps(0.5f);
+            }
+        };
+
+        SIMD_INLINE void Lut3dIndex(__m128i value, const Lut3dConst & k, __m128i & index, __m128 & frac)
+        {
+            __m128 x = _mm_mul_ps(_mm_cvtepi32_ps(value), k.scale);
+            index = _mm_min_epi32(_mm_cvttps_epi32(x), k.last);
+            frac = _mm_sub_ps(x, _mm_cvtepi32_ps(index));
+        }
+
+        SIMD_INLINE void Lut3dValue(__m128i node, const Lut3dConst & k, __m128 * value)
+        {
+            value[0] = _mm_cvtepi32_ps(_mm_and_si128(node, k.mask));
+            value[1] = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(node, Base::LUT3D_BITS), k.mask));
+            value[2] = _mm_cvtepi32_ps(_mm_srli_epi32(node, 2 * Base::LUT3D_BITS));
+        }
+
+        SIMD_INLINE void Lut3dLerp(const __m128 * a, const __m128 * b, __m128 f, __m128 * dst)
+        {
+            for (int c = 0; c < 3; ++c)
+                dst[c] = _mm_add_ps(a[c], _mm_mul_ps(_mm_sub_ps(b[c], a[c]), f));
+        }
+
+        SIMD_INLINE void Lut3dLerp(const uint32_t * table, __m128i i0, __m128i i1, __m128 f, const Lut3dConst & k, __m128 * dst)
+        {
+            __m128 v0[3], v1[3];
+            Lut3dValue(Gather(table, i0), k, v0);
+            Lut3dValue(Gather(table, i1), k, v1);
+            Lut3dLerp(v0, v1, f, dst);
+        }
+
+        SIMD_INLINE __m128i Lut3dOutput(__m128 value, const Lut3dConst & k)
+        {
+            return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(value, k.output), k.half));
+        }
+
+        SIMD_INLINE void Lut3dTrilinear(const uint32_t * table, const Lut3dConst & k, __m128i & b, __m128i & g, __m128i & r)
+        {
+            __m128i ib, ig, ir;
+            __m128 fb, fg, fr;
+            Lut3dIndex(b, k, ib, fb);
+            Lut3dIndex(g, k, ig, fg);
+            Lut3dIndex(r, k, ir, fr);
+            __m128i i00 = _mm_add_epi32(ir, _mm_add_epi32(_mm_mullo_epi32(ig, k.size), _mm_mullo_epi32(ib, k.size2)));
+            __m128i i10 = _mm_add_epi32(i00, k.size);
+            __m128i i01 = _mm_add_epi32(i00, k.size2);
+            __m128i i11 = _mm_add_epi32(i10, k.size2);
+            __m128 v00[3], v10[3], v01[3], v11[3], v0[3], v1[3], v[3];
+            Lut3dLerp(table, i00, _mm_add_epi32(i00, K32_00000001), fr, k, v00);
+            Lut3dLerp(table, i10, _mm_add_epi32(i10, K32_00000001), fr, k, v10);
+            Lut3dLerp(table, i01, _mm_add_epi32(i01, K32_00000001), fr, k, v01);
+            Lut3dLerp(table, i11, _mm_add_epi32(i11, K32_00000001), fr, k, v11);
+            Lut3dLerp(v00, v10, fg, v0);
+            Lut3dLerp(v01, v11, fg, v1);
+            Lut3dLerp(v0, v1, fb, v);
+            b = Lut3dOutput(v[0], k);
+            g = Lut3dOutput(v[1], k);
+            r = Lut3dOutput(v[2], k);
+        }
+
+        SIMD_INLINE void Lut3dSort(__m128 & fa, __m128i & oa, __m128 & fb, __m128i & ob)
+        {
+            __m128 mask = _mm_cmplt_ps(fa, fb);
+            __m128 f = fa;
+            fa = _mm_blendv_ps(fa, fb, mask);
+            fb = _mm_blendv_ps(fb, f, mask);
+            __m128i o = oa;
+            oa = _mm_blendv_epi8(oa, ob, _mm_castps_si128(mask));
+            ob = _mm_blendv_epi8(ob, o, _mm_castps_si128(mask));
+        }
+
+        SIMD_INLINE void Lut3dTetrahedral(const uint32_t * table, const Lut3dConst & k, __m128i & b, __m128i & g, __m128i & r)
+        {
+            __m128i ib, ig, ir;
+            __m128 f0, f1, f2;
+            Lut3dIndex(r, k, ir, f0);
+            Lut3dIndex(g, k, ig, f1);
+            Lut3dIndex(b, k, ib, f2);
+            __m128i o0 = K32_00000001, o1 = k.size, o2 = k.size2;
+            Lut3dSort(f0, o0, f1, o1);
+            Lut3dSort(f1, o1, f2, o2);
+            Lut3dSort(f0, o0, f1, o1);
+            __m128i i0 = _mm_add_epi32(ir, _mm_add_epi32(_mm_mullo_epi32(ig, k.size), _mm_mullo_epi32(ib, k.size2)));
+            __m128i i1 = _mm_add_epi32(i0, o0);
+            __m128i i2 = _mm_add_epi32(i1, o1);
+            __m128i i3 = _mm_add_epi32(i0, _mm_add_epi32(K32_00000001, _mm_add_epi32(k.size, k.size2)));
+            __m128 c0[3], c1[3], c2[3], c3[3];
+            Lut3dValue(Gather(table, i0), k, c0);
+            Lut3dValue(Gather(table, i1), k, c1);
+            Lut3dValue(Gather(table, i2), k, c2);
+            Lut3dValue(Gather(table, i3), k, c3);
+            __m128 w0 = _mm_sub_ps(_mm_set1_ps(1.0f), f0), w1 = _mm_sub_ps(f0, f1), w2 = _mm_sub_ps(f1, f2), w3 = f2;
+            __m128 v[3];
+            for (int c = 0; c < 3; ++c)
+                v[c] = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(c0[c], w0), _mm_mul_ps(c1[c], w1)), _mm_mul_ps(c2[c], w2)), _mm_mul_ps(c3[c], w3));
+            b = Lut3dOutput(v[0], k);
+            g = Lut3dOutput(v[1], k);
+            r = Lut3dOutput(v[2], k);
+        }
+
+        template<SimdLut3dInterpolationType interpolation> SIMD_INLINE void Lut3dPixels(const uint32_t * table, const Lut3dConst & k, __m128i & b, __m128i & g, __m128i & r)
+        {
+            if (interpolation == SimdLut3dInterpolationTrilinear)
+                Lut3dTrilinear(table, k, b, g, r);
+            else
+                Lut3dTetrahedral(table, k, b, g, r);
+        }
+
+        template<size_t channels, SimdLut3dInterpolationType interpolation> void Lut3dRow(const uint32_t * table, size_t size, const uint8_t * src, size_t width, uint8_t * dst)
+        {
+            Lut3dConst k(size);
+            size_t widthF = AlignLo(width, F);
+            __m128i alpha = _mm_set1_epi32(0xFF000000);
+            for (size_t col = 0; col < widthF; col += F)
+            {
+                __m128i b, g, r;
+                if (channels == 3)
+                {
+                    LoadBgr32i(src + col * 3, b, g, r);
+                    Lut3dPixels<interpolation>(table, k, b, g, r);
+                    StoreBgr32i(dst + col * 3, b, g, r);
+                }
+                else
+                {
+                    __m128i bgra = _mm_loadu_si128((__m128i*)(src + col * 4));
+                    b = _mm_and_si128(bgra, K32_000000FF);
+                    g = _mm_and_si128(_mm_srli_epi32(bgra, 8), K32_000000FF);
+                    r = _mm_and_si128(_mm_srli_epi32(bgra, 16), K32_000000FF);
+                    Lut3dPixels<interpolation>(table, k, b, g, r);
+                    bgra = _mm_or_si128(_mm_and_si128(bgra, alpha), _mm_or_si128(b, _mm_slli_epi32(g, 8)));
+                    _mm_storeu_si128((__m128i*)(dst + col * 4), _mm_or_si128(bgra, _mm_slli_epi32(r, 16)));
+                }
+            }
+            Base::Lut3dTail<channels, interpolation>(table, size, src, widthF, width, dst);
+        }
+
+        template<SimdLut3dInterpolationType interpolation> Base::Lut3dRowPtr GetLut3dRow(SimdPixelFormatType format)
+        {
+            return format == SimdPixelFormatBgr24 ? Lut3dRow<3, interpolation> : Lut3dRow<4, interpolation>;
+        }
+
+        Lut3dDefault::Lut3dDefault(const Lut3dParam& param, const float* table)
+            : Base::Lut3dDefault(param, table)
+        {
+            if (_param.interpolation == SimdLut3dInterpolationTrilinear)
+                _row = GetLut3dRow<SimdLut3dInterpolationTrilinear>(_param.format);
+            else
+                _row = GetLut3dRow<SimdLut3dInterpolationTetrahedral>(_param.format);
+        }
+
+        //---------------------------------------------------------------------
+
+        void* Lut3dInit(const float* table, size_t size, SimdPixelFormatType format, SimdLut3dInterpolationType interpolation)
+        {
+            Lut3dParam param(size, format, interpolation);
+            if (table == NULL || !param.Valid())
+                return NULL;
+            return new Lut3dDefault(param, table);
+        }
+    }
+#endif// SIMD_SSE41_ENABLE
+}
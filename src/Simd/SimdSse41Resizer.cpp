@@ -164,14 +164,16 @@ namespace Simd
             ResizerByteAreaResult34<3>(src, count, curr, zero, next, dst);
         }
 
-        template<size_t N> void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, int32_t * by)
         {
             size_t dstW = _param.dstW, rowSize = _param.srcW*N, rowRest = dstStride - dstW*N;
             const int32_t * iy = _iy.data, * ix = _ix.data, * ay = _ay.data, * ax = _ax.data;
             int32_t ay0 = ay[0], ax0 = ax[0];
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
+            src += iy[yBeg] * srcStride;
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += rowRest)
             {
-                int32_t * buf = _by.data;
+                int32_t * buf = by;
                 size_t yn = iy[dy + 1] - iy[dy];
                 ResizerByteAreaRowSum(src, srcStride, yn, rowSize, ay[dy], ay0, ay[dy + 1], buf), src += yn * srcStride;
                 for (size_t dx = 0; dx < dstW; dx++, dst += N)
@@ -182,14 +184,14 @@ namespace Simd
             }
         }
 
-        void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteArea::RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
         {
             switch (_param.channels)
             {
-            case 1: Run<1>(src, srcStride, dst, dstStride); return;
-            case 2: Run<2>(src, srcStride, dst, dstStride); return;
-            case 3: Run<3>(src, srcStride, dst, dstStride); return;
-            case 4: Run<4>(src, srcStride, dst, dstStride); return;
+            case 1: Run<1>(src, srcStride, yBeg, yEnd, dst, dstStride, (int32_t*)buf); return;
+            case 2: Run<2>(src, srcStride, yBeg, yEnd, dst, dstStride, (int32_t*)buf); return;
+            case 3: Run<3>(src, srcStride, yBeg, yEnd, dst, dstStride, (int32_t*)buf); return;
+            case 4: Run<4>(src, srcStride, yBeg, yEnd, dst, dstStride, (int32_t*)buf); return;
             default:
                 assert(0);
             }
@@ -197,11 +199,82 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        ResizerShortBilinear::ResizerShortBilinear(const ResParam & param)
+            : Base::ResizerShortBilinear(param)
+        {
+        }
+
+        SIMD_INLINE __m128i ResizerShortBilinearRow(const float * pb0, const float * pb1, __m128 fy0, __m128 fy1)
+        {
+            __m128 m0 = _mm_add_ps(_mm_mul_ps(_mm_load_ps(pb0 + 0), fy0), _mm_mul_ps(_mm_load_ps(pb1 + 0), fy1));
+            __m128 m1 = _mm_add_ps(_mm_mul_ps(_mm_load_ps(pb0 + F), fy0), _mm_mul_ps(_mm_load_ps(pb1 + F), fy1));
+            return _mm_packus_epi32(_mm_cvtps_epi32(m0), _mm_cvtps_epi32(m1));
+        }
+
+        void ResizerShortBilinear::Run(const uint16_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint16_t * dst, size_t dstStride, float * buf)
+        {
+            size_t cn = _param.channels;
+            size_t rs = _param.dstW * cn;
+            float * pbx[2] = { buf, buf + AlignHi(rs, _param.align / sizeof(float)) };
+            int32_t prev = -2;
+            size_t rsh = AlignLo(rs, HA);
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
+            {
+                float fy1 = _ay[dy];
+                float fy0 = 1.0f - fy1;
+                int32_t sy = _iy[dy];
+                int32_t k = 0;
+
+                if (sy == prev)
+                    k = 2;
+                else if (sy == prev + 1)
+                {
+                    Swap(pbx[0], pbx[1]);
+                    k = 1;
+                }
+
+                prev = sy;
+
+                for (; k < 2; k++)
+                {
+                    float * pb = pbx[k];
+                    const uint16_t * ps = src + (sy + k)*srcStride;
+                    for (size_t dx = 0; dx < rs; dx++)
+                    {
+                        int32_t sx = _ix[dx];
+                        float fx = _ax[dx];
+                        pb[dx] = ps[sx] * (1.0f - fx) + ps[sx + cn] * fx;
+                    }
+                }
+
+                size_t dx = 0;
+                __m128 _fy0 = _mm_set1_ps(fy0);
+                __m128 _fy1 = _mm_set1_ps(fy1);
+                for (; dx < rsh; dx += HA)
+                    _mm_storeu_si128((__m128i*)(dst + dx), ResizerShortBilinearRow(pbx[0] + dx, pbx[1] + dx, _fy0, _fy1));
+                for (; dx < rs; dx++)
+                    dst[dx] = (uint16_t)Round(pbx[0][dx] * fy0 + pbx[1][dx] * fy1);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m128i));
             if (param.IsByteArea())
                 return new ResizerByteArea(param);
+            else if (param.IsShortBilinear())
+                return new ResizerShortBilinear(param);
+            else if (param.IsFilter())
+                return new ResizerFilter(param);
+            else if (param.IsNearest())
+                return new ResizerNearest(param);
+            else if (param.IsShortArea())
+                return new ResizerShortArea(param);
+            else if (param.IsFloatArea())
+                return new ResizerFloatArea(param);
             else
                 return Ssse3::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
         }
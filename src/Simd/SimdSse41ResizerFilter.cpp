@@ -0,0 +1,227 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        template<class T> SIMD_INLINE __m128 ResizerFilterLoad(const T * src);
+
+        template<> SIMD_INLINE __m128 ResizerFilterLoad<uint8_t>(const uint8_t * src)
+        {
+            return _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(int32_t*)src)));
+        }
+
+        template<> SIMD_INLINE __m128 ResizerFilterLoad<float>(const float * src)
+        {
+            return _mm_loadu_ps(src);
+        }
+
+        template<class T> SIMD_INLINE void ResizerFilterStore(__m128 value, T * dst);
+
+        template<> SIMD_INLINE void ResizerFilterStore<uint8_t>(__m128 value, uint8_t * dst)
+        {
+            value = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(255.0f));
+            __m128i _value = _mm_cvttps_epi32(_mm_add_ps(value, _mm_set1_ps(0.5f)));
+            *(int32_t*)dst = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packs_epi32(_value, K_ZERO), K_ZERO));
+        }
+
+        template<> SIMD_INLINE void ResizerFilterStore<float>(__m128 value, float * dst)
+        {
+            _mm_storeu_ps(dst, value);
+        }
+
+        template<class T> SIMD_INLINE void ResizerFilterVerticalBlock(const uint8_t * src, size_t srcStride, size_t x, const float * weight, size_t kernel, float * dst)
+        {
+            __m128 sum = _mm_mul_ps(ResizerFilterLoad((const T*)src + x), _mm_set1_ps(weight[0]));
+            for (size_t k = 1; k < kernel; ++k)
+                sum = _mm_add_ps(sum, _mm_mul_ps(ResizerFilterLoad((const T*)(src + k * srcStride) + x), _mm_set1_ps(weight[k])));
+            _mm_storeu_ps(dst + x, sum);
+        }
+
+        template<class T> void ResizerFilterVertical(const uint8_t * src, size_t srcStride, size_t width, const float * weight, size_t kernel, float * dst)
+        {
+            if (width < F)
+            {
+                Base::ResizerFilterVertical<T>(src, srcStride, width, weight, kernel, dst);
+                return;
+            }
+            size_t widthF = AlignLo(width, F);
+            for (size_t x = 0; x < widthF; x += F)
+                ResizerFilterVerticalBlock<T>(src, srcStride, x, weight, kernel, dst);
+            if (widthF < width)
+                ResizerFilterVerticalBlock<T>(src, srcStride, width - F, weight, kernel, dst);
+        }
+
+        template<int part> SIMD_INLINE __m128 ResizerFilterTaps(__m128 s0, __m128 s1, __m128 s2, __m128 s3);
+
+        template<> SIMD_INLINE __m128 ResizerFilterTaps<0>(__m128 s0, __m128 s1, __m128 s2, __m128 s3)
+        {
+            return _mm_unpacklo_ps(_mm_unpacklo_ps(s0, s2), _mm_unpacklo_ps(s1, s3));
+        }
+
+        template<> SIMD_INLINE __m128 ResizerFilterTaps<1>(__m128 s0, __m128 s1, __m128 s2, __m128 s3)
+        {
+            return _mm_unpackhi_ps(_mm_unpacklo_ps(s0, s2), _mm_unpacklo_ps(s1, s3));
+        }
+
+        template<> SIMD_INLINE __m128 ResizerFilterTaps<2>(__m128 s0, __m128 s1, __m128 s2, __m128 s3)
+        {
+            return _mm_unpacklo_ps(_mm_unpackhi_ps(s0, s2), _mm_unpackhi_ps(s1, s3));
+        }
+
+        template<> SIMD_INLINE __m128 ResizerFilterTaps<3>(__m128 s0, __m128 s1, __m128 s2, __m128 s3)
+        {
+            return _mm_unpackhi_ps(_mm_unpackhi_ps(s0, s2), _mm_unpackhi_ps(s1, s3));
+        }
+
+        template<int part> SIMD_INLINE void ResizerFilterTaps(__m128 s0, __m128 s1, __m128 s2, __m128 s3, const float * weight, __m128 & sum)
+        {
+            sum = _mm_add_ps(sum, _mm_mul_ps(ResizerFilterTaps<part>(s0, s1, s2, s3), _mm_loadu_ps(weight)));
+        }
+
+        // One channel: taps of every output are contiguous, so 4 taps of 4 outputs are loaded and transposed (kernel >= 4).
+        // The last taps are loaded from (kernel - 4), so nothing is read after the last tap of the output.
+        template<class T> SIMD_INLINE void ResizerFilterHorizontal1Block(const float * src, const int32_t * index, const float * weight, size_t kernel, size_t width, size_t x, T * dst)
+        {
+            const float * src0 = src + index[x + 0], * src1 = src + index[x + 1], * src2 = src + index[x + 2], * src3 = src + index[x + 3];
+            size_t kernel4 = AlignLo(kernel, 4), k = 0;
+            __m128 sum = _mm_setzero_ps();
+            for (; k < kernel4; k += 4)
+            {
+                __m128 s0 = _mm_loadu_ps(src0 + k), s1 = _mm_loadu_ps(src1 + k), s2 = _mm_loadu_ps(src2 + k), s3 = _mm_loadu_ps(src3 + k);
+                ResizerFilterTaps<0>(s0, s1, s2, s3, weight + (k + 0) * width + x, sum);
+                ResizerFilterTaps<1>(s0, s1, s2, s3, weight + (k + 1) * width + x, sum);
+                ResizerFilterTaps<2>(s0, s1, s2, s3, weight + (k + 2) * width + x, sum);
+                ResizerFilterTaps<3>(s0, s1, s2, s3, weight + (k + 3) * width + x, sum);
+            }
+            if (kernel4 < kernel)
+            {
+                k = kernel - 4;
+                __m128 s0 = _mm_loadu_ps(src0 + k), s1 = _mm_loadu_ps(src1 + k), s2 = _mm_loadu_ps(src2 + k), s3 = _mm_loadu_ps(src3 + k);
+                if (kernel - kernel4 > 2)
+                    ResizerFilterTaps<1>(s0, s1, s2, s3, weight + (k + 1) * width + x, sum);
+                if (kernel - kernel4 > 1)
+                    ResizerFilterTaps<2>(s0, s1, s2, s3, weight + (k + 2) * width + x, sum);
+                ResizerFilterTaps<3>(s0, s1, s2, s3, weight + (k + 3) * width + x, sum);
+            }
+            ResizerFilterStore<T>(sum, dst + x);
+        }
+
+        template<class T> void ResizerFilterHorizontal1(const float * src, const int32_t * index, const float * weight, size_t kernel, size_t width, T * dst)
+        {
+            size_t widthF = AlignLo(width, F);
+            for (size_t x = 0; x < widthF; x += F)
+                ResizerFilterHorizontal1Block<T>(src, index, weight, kernel, width, x, dst);
+            if (widthF < width)
+                ResizerFilterHorizontal1Block<T>(src, index, weight, kernel, width, width - F, dst);
+        }
+
+        // Four channels: every tap is one contiguous pixel.
+        template<class T> void ResizerFilterHorizontal4(const float * src, const int32_t * index, const float * weight, size_t kernel, size_t width, T * dst)
+        {
+            for (size_t x = 0; x < width; x += 4)
+            {
+                const float * ps = src + index[x];
+                __m128 sum = _mm_mul_ps(_mm_loadu_ps(ps), _mm_set1_ps(weight[x]));
+                for (size_t k = 1; k < kernel; ++k)
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(ps + k * 4), _mm_set1_ps(weight[k * width + x])));
+                ResizerFilterStore<T>(sum, dst + x);
+            }
+        }
+
+        template<class T> SIMD_INLINE void ResizerFilterStore3(__m128 value, T * dst);
+
+        template<> SIMD_INLINE void ResizerFilterStore3<uint8_t>(__m128 value, uint8_t * dst)
+        {
+            value = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(255.0f));
+            __m128i _value = _mm_cvttps_epi32(_mm_add_ps(value, _mm_set1_ps(0.5f)));
+            int32_t bgr = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packs_epi32(_value, K_ZERO), K_ZERO));
+            *(uint16_t*)dst = uint16_t(bgr);
+            dst[2] = uint8_t(bgr >> 16);
+        }
+
+        template<> SIMD_INLINE void ResizerFilterStore3<float>(__m128 value, float * dst)
+        {
+            _mm_storel_pi((__m64*)dst, value);
+            _mm_store_ss(dst + 2, _mm_movehl_ps(value, value));
+        }
+
+        // Three channels: every tap is loaded as 4 values which end at the last channel of the pixel, 
+        // so nothing is read after the row. Pixels which start at the row begin are processed by scalar code.
+        template<class T> void ResizerFilterHorizontal3(const float * src, const int32_t * index, const float * weight, size_t kernel, size_t width, T * dst)
+        {
+            for (size_t x = 0; x < width; x += 3)
+            {
+                if (index[x] == 0)
+                {
+                    for (size_t c = 0; c < 3; ++c)
+                    {
+                        float sum = src[c] * weight[x + c];
+                        for (size_t k = 1; k < kernel; ++k)
+                            sum += src[k * 3 + c] * weight[k * width + x + c];
+                        Base::ResizerFilterStore<T>(sum, dst + x + c);
+                    }
+                    continue;
+                }
+                const float * ps = src + index[x] - 1;
+                __m128 sum = _mm_mul_ps(_mm_loadu_ps(ps), _mm_set1_ps(weight[x]));
+                for (size_t k = 1; k < kernel; ++k)
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(ps + k * 3), _mm_set1_ps(weight[k * width + x])));
+                ResizerFilterStore3<T>(_mm_castsi128_ps(_mm_srli_si128(_mm_castps_si128(sum), 4)), dst + x);
+            }
+        }
+
+        template<class T> void ResizerFilterHorizontal(const float * src, const int32_t * index, const float * weight, size_t kernel, size_t channels, size_t width, uint8_t * dst)
+        {
+            if (channels == 1 && kernel >= 4 && width >= F)
+                ResizerFilterHorizontal1<T>(src, index, weight, kernel, width, (T*)dst);
+            else if (channels == 3)
+                ResizerFilterHorizontal3<T>(src, index, weight, kernel, width, (T*)dst);
+            else if (channels == 4)
+                ResizerFilterHorizontal4<T>(src, index, weight, kernel, width, (T*)dst);
+            else
+                Base::ResizerFilterHorizontal<T>(src, index, weight, kernel, channels, width, dst);
+        }
+
+        ResizerFilter::ResizerFilter(const ResParam & param)
+            : Base::ResizerFilter(param)
+        {
+            if (_param.type == SimdResizeChannelByte)
+            {
+                _vertical = ResizerFilterVertical<uint8_t>;
+                _horizontal = ResizerFilterHorizontal<uint8_t>;
+            }
+            else
+            {
+                _vertical = ResizerFilterVertical<float>;
+                _horizontal = ResizerFilterHorizontal<float>;
+            }
+        }
+    }
+#endif //SIMD_SSE41_ENABLE
+}
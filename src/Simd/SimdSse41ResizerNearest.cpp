@@ -0,0 +1,86 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        ResizerNearest::ResizerNearest(const ResParam & param)
+            : Base::ResizerNearest(param)
+            , _loads(0)
+        {
+            Array32i indices;
+            for (size_t loads = 1; loads <= 2 && _loads == 0; ++loads)
+            {
+                if (EstimateBlocks(A, 1, loads, _pixels, _offsets, indices))
+                {
+                    _loads = loads;
+                    _shuffle.Resize(indices.size * loads);
+                    for (size_t b = 0, blocks = _offsets.size / 2; b < blocks; ++b)
+                    {
+                        for (size_t i = 0; i < A; ++i)
+                        {
+                            int32_t idx = indices[b * A + i];
+                            for (size_t l = 0; l < loads; ++l)
+                                _shuffle[(b * loads + l) * A + i] = idx >= int32_t(l * A) && idx < int32_t(l * A + A) ? uint8_t(idx - l * A) : 0x80;
+                        }
+                    }
+                }
+            }
+        }
+
+        template<size_t loads> SIMD_INLINE __m128i ResizerNearestShuffle(const uint8_t * src, const uint8_t * shuffle)
+        {
+            __m128i value = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src), _mm_loadu_si128((__m128i*)shuffle));
+            if (loads > 1)
+                value = _mm_or_si128(value, _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src + 1), _mm_loadu_si128((__m128i*)shuffle + 1)));
+            return value;
+        }
+
+        template<size_t loads> void ResizerNearestRow(const uint8_t * src, const int32_t * offsets, const uint8_t * shuffle, size_t blocks, size_t tail, uint8_t * dst)
+        {
+            size_t b = 0, last = blocks - 1;
+            for (; b < last; ++b, offsets += 2, shuffle += loads * A)
+                _mm_storeu_si128((__m128i*)(dst + offsets[0]), ResizerNearestShuffle<loads>(src + offsets[1], shuffle));
+            uint8_t SIMD_ALIGNED(16) buffer[A];
+            _mm_storeu_si128((__m128i*)buffer, ResizerNearestShuffle<loads>(src + offsets[1], shuffle));
+            memcpy(dst + offsets[0], buffer, tail);
+        }
+
+        void ResizerNearest::RunRow(const uint8_t * src, uint8_t * dst)
+        {
+            size_t blocks = _offsets.size / 2, tail = _pixels * _pixelSize;
+            if (_loads == 1)
+                ResizerNearestRow<1>(src, _offsets.data, _shuffle.data, blocks, tail, dst);
+            else if (_loads == 2)
+                ResizerNearestRow<2>(src, _offsets.data, _shuffle.data, blocks, tail, dst);
+            else
+                Base::ResizerNearest::RunRow(src, dst);
+        }
+    }
+#endif //SIMD_SSE41_ENABLE
+}
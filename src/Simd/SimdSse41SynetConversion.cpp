@@ -267,9 +267,9 @@ namespace Simd
             SynetSetInput1Gray8(BgrToBlue(_rgb), scale[2], shift[2], dst + 2 * channel);
         }
 
-        template<SimdPixelFormatType format, size_t step> void SynetSetInputNchw3(const uint8_t * src, size_t width, size_t height, size_t stride, const float * scale, const float * shift, float * dst)
+        template<SimdPixelFormatType format, size_t step> void SynetSetInputNchw3(const uint8_t * src, size_t width, size_t height, size_t stride, const float * scale, const float * shift, float * dst, size_t channel)
         {
-            size_t aligned = AlignLo(width, A), channel = width * height;
+            size_t aligned = AlignLo(width, A);
             __m128 _scale[3], _shift[3];
             for (size_t i = 0; i < 3; ++i)
             {
@@ -403,8 +403,8 @@ namespace Simd
             }
         }
 
-        void SynetSetInput(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
-            const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat)
+        void SynetSetInputRows(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+            const float * lower, const float * upper, float * dst, size_t plane, size_t channels, SimdTensorFormatType dstFormat)
         {
             assert(width >= A);
 
@@ -429,10 +429,10 @@ namespace Simd
                 case SimdTensorFormatNchw:
                     switch (srcFormat)
                     {
-                    case SimdPixelFormatGray8: SynetSetInputNchw3<SimdPixelFormatGray8, 1>(src, width, height, stride, scale, lower, dst); return;
-                    case SimdPixelFormatBgr24: SynetSetInputNchw3<SimdPixelFormatBgr24, 3>(src, width, height, stride, scale, lower, dst); return;
-                    case SimdPixelFormatBgra32: SynetSetInputNchw3<SimdPixelFormatBgra32, 4>(src, width, height, stride, scale, lower, dst); return;
-                    case SimdPixelFormatRgb24: SynetSetInputNchw3<SimdPixelFormatRgb24, 3>(src, width, height, stride, scale, lower, dst); return;
+                    case SimdPixelFormatGray8: SynetSetInputNchw3<SimdPixelFormatGray8, 1>(src, width, height, stride, scale, lower, dst, plane); return;
+                    case SimdPixelFormatBgr24: SynetSetInputNchw3<SimdPixelFormatBgr24, 3>(src, width, height, stride, scale, lower, dst, plane); return;
+                    case SimdPixelFormatBgra32: SynetSetInputNchw3<SimdPixelFormatBgra32, 4>(src, width, height, stride, scale, lower, dst, plane); return;
+                    case SimdPixelFormatRgb24: SynetSetInputNchw3<SimdPixelFormatRgb24, 3>(src, width, height, stride, scale, lower, dst, plane); return;
                     default: assert(0);
                     }
                     break;
@@ -451,6 +451,35 @@ namespace Simd
             default: assert(0);
             }
         }
+
+        void SynetSetInput(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+            const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat)
+        {
+            SynetSetInputRows(src, width, height, stride, srcFormat, lower, upper, dst, width * height, channels, dstFormat);
+        }
+
+        //---------------------------------------------------------------------
+
+        void SynetSetInputBatchVertical(const uint8_t * src0, const uint8_t * src1, size_t size, float weight, float * dst)
+        {
+            size_t size4 = AlignLo(size, 4), i = 0;
+            __m128 _weight = _mm_set1_ps(weight);
+            for (; i < size4; i += 4)
+            {
+                __m128 s0 = _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(int32_t*)(src0 + i))));
+                __m128 s1 = _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(int32_t*)(src1 + i))));
+                _mm_storeu_ps(dst + i, _mm_add_ps(s0, _mm_mul_ps(_mm_sub_ps(s1, s0), _weight)));
+            }
+            for (; i < size; ++i)
+                dst[i] = float(src0[i]) + float(src1[i] - src0[i]) * weight;
+        }
+
+        void SynetSetInputBatch(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+            const float * rois, size_t count, size_t dstWidth, size_t dstHeight, const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat)
+        {
+            Base::SynetSetInputBatch(src, width, height, stride, srcFormat, rois, count, dstWidth, dstHeight, lower, upper, dst, channels, dstFormat,
+                SynetSetInputBatchVertical, Base::SynetSetInputBatchHorizontal);
+        }
     }
 #endif//SIMD_SSE41_ENABLE
 }
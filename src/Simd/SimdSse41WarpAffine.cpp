@@ -0,0 +1,182 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdWarpAffine.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        template<bool constant> SIMD_INLINE void WarpAffineNearestIndex(const int32_t* ax, const int32_t* ay, __m128i bx, __m128i by, __m128i w, __m128i h, __m128i s, __m128i ps, int32_t* index)
+        {
+            __m128i x = _mm_srai_epi32(_mm_add_epi32(_mm_loadu_si128((__m128i*)ax), bx), Base::WARP_AFFINE_BITS);
+            __m128i y = _mm_srai_epi32(_mm_add_epi32(_mm_loadu_si128((__m128i*)ay), by), Base::WARP_AFFINE_BITS);
+            if (constant)
+            {
+                __m128i inside = _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi32(x, K_INV_ZERO), _mm_cmplt_epi32(x, w)),
+                    _mm_and_si128(_mm_cmpgt_epi32(y, K_INV_ZERO), _mm_cmplt_epi32(y, h)));
+                __m128i offset = _mm_add_epi32(_mm_mullo_epi32(y, s), _mm_mullo_epi32(x, ps));
+                _mm_storeu_si128((__m128i*)index, _mm_blendv_epi8(K_INV_ZERO, offset, inside));
+            }
+            else
+            {
+                x = _mm_min_epi32(_mm_max_epi32(x, K_ZERO), w);
+                y = _mm_min_epi32(_mm_max_epi32(y, K_ZERO), h);
+                _mm_storeu_si128((__m128i*)index, _mm_add_epi32(_mm_mullo_epi32(y, s), _mm_mullo_epi32(x, ps)));
+            }
+        }
+
+        template<bool constant> void WarpAffineNearestIndex(const WarpAffParam& p, const int32_t* ax, const int32_t* ay, int32_t bx, int32_t by, int32_t* index)
+        {
+            __m128i _bx = _mm_set1_epi32(bx + Base::WARP_AFFINE_ROUND);
+            __m128i _by = _mm_set1_epi32(by + Base::WARP_AFFINE_ROUND);
+            __m128i w = _mm_set1_epi32(constant ? (int)p.srcW : (int)p.srcW - 1);
+            __m128i h = _mm_set1_epi32(constant ? (int)p.srcH : (int)p.srcH - 1);
+            __m128i s = _mm_set1_epi32((int)p.srcS);
+            __m128i ps = _mm_set1_epi32((int)p.PixelSize());
+            size_t width = p.dstW, widthF = AlignLo(width, F);
+            for (size_t x = 0; x < widthF; x += F)
+                WarpAffineNearestIndex<constant>(ax + x, ay + x, _bx, _by, w, h, s, ps, index + x);
+            if (widthF < width)
+                WarpAffineNearestIndex<constant>(ax + width - F, ay + width - F, _bx, _by, w, h, s, ps, index + width - F);
+        }
+
+        WarpAffineNearest::WarpAffineNearest(const WarpAffParam& param)
+            : Base::WarpAffineNearest(param)
+        {
+        }
+
+        void WarpAffineNearest::EstimateIndex(int32_t bx, int32_t by, int32_t* index)
+        {
+            if (_param.dstW < F)
+                Base::WarpAffineNearest::EstimateIndex(bx, by, index);
+            else if (_param.IsConstant())
+                WarpAffineNearestIndex<true>(_param, _ax.data, _ay.data, bx, by, index);
+            else
+                WarpAffineNearestIndex<false>(_param, _ax.data, _ay.data, bx, by, index);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void WarpAffineBilinearIndex(const int32_t* ax, const int32_t* ay, __m128i bx, __m128i by, __m128i w, __m128i h, __m128i s, __m128i ps, int32_t* index, int32_t* xs, int32_t* ys)
+        {
+            __m128i fx = _mm_add_epi32(_mm_loadu_si128((__m128i*)ax), bx);
+            __m128i fy = _mm_add_epi32(_mm_loadu_si128((__m128i*)ay), by);
+            _mm_storeu_si128((__m128i*)xs, fx);
+            _mm_storeu_si128((__m128i*)ys, fy);
+            __m128i x = _mm_srai_epi32(fx, Base::WARP_AFFINE_BITS);
+            __m128i y = _mm_srai_epi32(fy, Base::WARP_AFFINE_BITS);
+            __m128i inside = _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi32(x, K_INV_ZERO), _mm_cmplt_epi32(x, w)),
+                _mm_and_si128(_mm_cmpgt_epi32(y, K_INV_ZERO), _mm_cmplt_epi32(y, h)));
+            __m128i offset = _mm_add_epi32(_mm_mullo_epi32(y, s), _mm_mullo_epi32(x, ps));
+            _mm_storeu_si128((__m128i*)index, _mm_blendv_epi8(K_INV_ZERO, offset, inside));
+        }
+
+        SIMD_INLINE void WarpAffineBilinearByte4(const uint8_t* p0, size_t srcS, int32_t fx, int32_t fy, uint8_t* dst)
+        {
+            static const __m128i SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, -1, -1, -1, -1, -1, -1, -1, -1);
+            __m128i kx = _mm_set1_epi32((fx << 16) | (Base::WARP_AFFINE_RANGE - fx));
+            __m128i s0 = _mm_cvtepu8_epi16(_mm_shuffle_epi8(_mm_loadl_epi64((__m128i*)p0), SHUFFLE));
+            __m128i s1 = _mm_cvtepu8_epi16(_mm_shuffle_epi8(_mm_loadl_epi64((__m128i*)(p0 + srcS)), SHUFFLE));
+            __m128i top = _mm_mullo_epi32(_mm_madd_epi16(s0, kx), _mm_set1_epi32(Base::WARP_AFFINE_RANGE - fy));
+            __m128i bot = _mm_mullo_epi32(_mm_madd_epi16(s1, kx), _mm_set1_epi32(fy));
+            __m128i sum = _mm_add_epi32(_mm_add_epi32(top, bot), _mm_set1_epi32(Base::WARP_AFFINE_BILINEAR_ROUND));
+            __m128i res = _mm_srli_epi32(sum, 2 * Base::WARP_AFFINE_BITS);
+            *(int32_t*)dst = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packs_epi32(res, K_ZERO), K_ZERO));
+        }
+
+        SIMD_INLINE void WarpAffineBilinearFloat4(const uint8_t* p0, size_t srcS, int32_t fx, int32_t fy, uint8_t* dst)
+        {
+            const float* p00 = (const float*)p0, * p10 = (const float*)(p0 + srcS);
+            float fx1 = float(fx) * (1.0f / Base::WARP_AFFINE_RANGE), fy1 = float(fy) * (1.0f / Base::WARP_AFFINE_RANGE);
+            __m128 kx0 = _mm_set1_ps(1.0f - fx1), kx1 = _mm_set1_ps(fx1);
+            __m128 top = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(p00 + 0), kx0), _mm_mul_ps(_mm_loadu_ps(p00 + 4), kx1));
+            __m128 bot = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(p10 + 0), kx0), _mm_mul_ps(_mm_loadu_ps(p10 + 4), kx1));
+            _mm_storeu_ps((float*)dst, _mm_add_ps(_mm_mul_ps(top, _mm_set1_ps(1.0f - fy1)), _mm_mul_ps(bot, _mm_set1_ps(fy1))));
+        }
+
+        template<class T> void WarpAffineBilinearRow4(const WarpAffParam& p, const uint8_t* src, const int32_t* index, const int32_t* xs, const int32_t* ys, uint8_t* dst)
+        {
+            for (size_t dx = 0; dx < p.dstW; ++dx, dst += 4 * sizeof(T))
+            {
+                if (index[dx] < 0)
+                    Base::WarpAffineBilinearPixel<T, 4>(p, src, index[dx], xs[dx], ys[dx], dst);
+                else if (sizeof(T) == 1)
+                    WarpAffineBilinearByte4(src + index[dx], p.srcS, xs[dx] & Base::WARP_AFFINE_MASK, ys[dx] & Base::WARP_AFFINE_MASK, dst);
+                else
+                    WarpAffineBilinearFloat4(src + index[dx], p.srcS, xs[dx] & Base::WARP_AFFINE_MASK, ys[dx] & Base::WARP_AFFINE_MASK, dst);
+            }
+        }
+
+        WarpAffineBilinear::WarpAffineBilinear(const WarpAffParam& param)
+            : Base::WarpAffineBilinear(param)
+        {
+        }
+
+        void WarpAffineBilinear::EstimateIndex(int32_t bx, int32_t by, int32_t* index, int32_t* xs, int32_t* ys)
+        {
+            size_t width = _param.dstW, widthF = AlignLo(width, F);
+            if (width < F)
+            {
+                Base::WarpAffineBilinear::EstimateIndex(bx, by, index, xs, ys);
+                return;
+            }
+            __m128i _bx = _mm_set1_epi32(bx), _by = _mm_set1_epi32(by);
+            __m128i w = _mm_set1_epi32((int)_param.srcW - 1), h = _mm_set1_epi32((int)_param.srcH - 1);
+            __m128i s = _mm_set1_epi32((int)_param.srcS), ps = _mm_set1_epi32((int)_param.PixelSize());
+            for (size_t x = 0; x < widthF; x += F)
+                WarpAffineBilinearIndex(_ax.data + x, _ay.data + x, _bx, _by, w, h, s, ps, index + x, xs + x, ys + x);
+            if (widthF < width)
+            {
+                size_t x = width - F;
+                WarpAffineBilinearIndex(_ax.data + x, _ay.data + x, _bx, _by, w, h, s, ps, index + x, xs + x, ys + x);
+            }
+        }
+
+        void WarpAffineBilinear::RunRow(const uint8_t* src, const int32_t* index, const int32_t* xs, const int32_t* ys, uint8_t* dst)
+        {
+            if (_param.channels == 4 && _param.IsByte())
+                WarpAffineBilinearRow4<uint8_t>(_param, src, index, xs, ys, dst);
+            else if (_param.channels == 4)
+                WarpAffineBilinearRow4<float>(_param, src, index, xs, ys, dst);
+            else
+                Base::WarpAffineBilinear::RunRow(src, index, xs, ys, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            WarpAffParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, mat, flags, border, A);
+            if (mat == NULL || !param.Valid())
+                return NULL;
+            if (param.IsNearest())
+                return new WarpAffineNearest(param);
+            else
+                return new WarpAffineBilinear(param);
+        }
+    }
+#endif// SIMD_SSE41_ENABLE
+}
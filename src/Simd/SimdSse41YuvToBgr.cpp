@@ -0,0 +1,435 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdYuvToBgr.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        template<int sx> SIMD_INLINE __m128i LoadUv(const uint8_t * uv);
+
+        template<> SIMD_INLINE __m128i LoadUv<0>(const uint8_t * uv)
+        {
+            return _mm_loadu_si128((__m128i*)uv);
+        }
+
+        template<> SIMD_INLINE __m128i LoadUv<1>(const uint8_t * uv)
+        {
+            __m128i _uv = _mm_loadl_epi64((__m128i*)uv);
+            return _mm_unpacklo_epi8(_uv, _uv);
+        }
+
+        template<size_t N, bool rgb> SIMD_INLINE void StoreAny(__m128i b, __m128i g, __m128i r, __m128i a, uint8_t * dst);
+
+        template<> SIMD_INLINE void StoreAny<4, false>(__m128i b, __m128i g, __m128i r, __m128i a, uint8_t * dst)
+        {
+            __m128i bgLo = _mm_unpacklo_epi8(b, g), bgHi = _mm_unpackhi_epi8(b, g);
+            __m128i raLo = _mm_unpacklo_epi8(r, a), raHi = _mm_unpackhi_epi8(r, a);
+            _mm_storeu_si128((__m128i*)dst + 0, _mm_unpacklo_epi16(bgLo, raLo));
+            _mm_storeu_si128((__m128i*)dst + 1, _mm_unpackhi_epi16(bgLo, raLo));
+            _mm_storeu_si128((__m128i*)dst + 2, _mm_unpacklo_epi16(bgHi, raHi));
+            _mm_storeu_si128((__m128i*)dst + 3, _mm_unpackhi_epi16(bgHi, raHi));
+        }
+
+        template<> SIMD_INLINE void StoreAny<3, false>(__m128i b, __m128i g, __m128i r, __m128i a, uint8_t * dst)
+        {
+            _mm_storeu_si128((__m128i*)dst + 0, InterleaveBgr<0>(b, g, r));
+            _mm_storeu_si128((__m128i*)dst + 1, InterleaveBgr<1>(b, g, r));
+            _mm_storeu_si128((__m128i*)dst + 2, InterleaveBgr<2>(b, g, r));
+        }
+
+        template<> SIMD_INLINE void StoreAny<3, true>(__m128i b, __m128i g, __m128i r, __m128i a, uint8_t * dst)
+        {
+            _mm_storeu_si128((__m128i*)dst + 0, InterleaveBgr<0>(r, g, b));
+            _mm_storeu_si128((__m128i*)dst + 1, InterleaveBgr<1>(r, g, b));
+            _mm_storeu_si128((__m128i*)dst + 2, InterleaveBgr<2>(r, g, b));
+        }
+
+        template<class T, size_t N, bool rgb, int sx> SIMD_INLINE void YuvToAny(const uint8_t * y, const uint8_t * u, const uint8_t * v, __m128i a, uint8_t * dst)
+        {
+            __m128i b, g, r;
+            YuvToBgr<T>(_mm_loadu_si128((__m128i*)y), LoadUv<sx>(u), LoadUv<sx>(v), b, g, r);
+            StoreAny<N, rgb>(b, g, r, a, dst);
+        }
+
+        template<class T, size_t N, bool rgb, int sx, int sy> void YuvToAnyV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride,
+            const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % (1 << sx) == 0) && (height % (1 << sy) == 0) && (width >= A));
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            __m128i _alpha = _mm_set1_epi8(alpha);
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint8_t * u0 = u + (row >> sy) * uStride;
+                const uint8_t * v0 = v + (row >> sy) * vStride;
+                for (size_t col = 0; col < widthA; col += A)
+                    YuvToAny<T, N, rgb, sx>(y + col, u0 + (col >> sx), v0 + (col >> sx), _alpha, dst + col * N);
+                if (widthA != width)
+                    YuvToAny<T, N, rgb, sx>(y + tail, u0 + (tail >> sx), v0 + (tail >> sx), _alpha, dst + tail * N);
+                y += yStride;
+                dst += dstStride;
+            }
+        }
+
+        template<size_t N, bool rgb, int sx, int sy> void YuvToAnyV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride,
+            const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: YuvToAnyV2<Base::Bt601, N, rgb, sx, sy>(y, yStride, u, uStride, v, vStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: YuvToAnyV2<Base::Bt709, N, rgb, sx, sy>(y, yStride, u, uStride, v, vStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt601Full: YuvToAnyV2<Base::Bt601Full, N, rgb, sx, sy>(y, yStride, u, uStride, v, vStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709Full: YuvToAnyV2<Base::Bt709Full, N, rgb, sx, sy>(y, yStride, u, uStride, v, vStride, width, height, dst, dstStride, alpha); break;
+            default: assert(0);
+            }
+        }
+
+        void Yuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<4, false, 1, 1>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Yuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<4, false, 1, 0>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Yuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<4, false, 0, 0>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Yuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<3, false, 1, 1>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, 0, yuvType);
+        }
+
+        void Yuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<3, false, 1, 0>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, 0, yuvType);
+        }
+
+        void Yuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<3, false, 0, 0>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, 0, yuvType);
+        }
+
+        void Yuv420pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<3, true, 1, 1>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, 0, yuvType);
+        }
+
+        void Yuv422pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<3, true, 1, 0>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, 0, yuvType);
+        }
+
+        void Yuv444pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            YuvToAnyV2<3, true, 0, 0>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, 0, yuvType);
+        }
+
+        //---------------------------------------------------------------------
+
+        const __m128i K8_SHUFFLE_UV_TO_U = SIMD_MM_SETR_EPI8(0x0, 0x0, 0x2, 0x2, 0x4, 0x4, 0x6, 0x6, 0x8, 0x8, 0xA, 0xA, 0xC, 0xC, 0xE, 0xE);
+        const __m128i K8_SHUFFLE_UV_TO_V = SIMD_MM_SETR_EPI8(0x1, 0x1, 0x3, 0x3, 0x5, 0x5, 0x7, 0x7, 0x9, 0x9, 0xB, 0xB, 0xD, 0xD, 0xF, 0xF);
+
+        template<class T, size_t N, bool rgb, bool nv21> SIMD_INLINE void NvToAny(const uint8_t * y, const uint8_t * uv, __m128i a, uint8_t * dst)
+        {
+            __m128i _uv = _mm_loadu_si128((__m128i*)uv), b, g, r;
+            __m128i u = _mm_shuffle_epi8(_uv, nv21 ? K8_SHUFFLE_UV_TO_V : K8_SHUFFLE_UV_TO_U);
+            __m128i v = _mm_shuffle_epi8(_uv, nv21 ? K8_SHUFFLE_UV_TO_U : K8_SHUFFLE_UV_TO_V);
+            YuvToBgr<T>(_mm_loadu_si128((__m128i*)y), u, v, b, g, r);
+            StoreAny<N, rgb>(b, g, r, a, dst);
+        }
+
+        template<class T, size_t N, bool rgb, bool nv21> void NvToAny(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A));
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            __m128i _alpha = _mm_set1_epi8(alpha);
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint8_t * uv0 = uv + (row >> 1) * uvStride;
+                for (size_t col = 0; col < widthA; col += A)
+                    NvToAny<T, N, rgb, nv21>(y + col, uv0 + col, _alpha, dst + col * N);
+                if (widthA != width)
+                    NvToAny<T, N, rgb, nv21>(y + tail, uv0 + tail, _alpha, dst + tail * N);
+                y += yStride;
+                dst += dstStride;
+            }
+        }
+
+        template<size_t N, bool rgb, bool nv21> void NvToAny(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: NvToAny<Base::Bt601, N, rgb, nv21>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: NvToAny<Base::Bt709, N, rgb, nv21>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt601Full: NvToAny<Base::Bt601Full, N, rgb, nv21>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709Full: NvToAny<Base::Bt709Full, N, rgb, nv21>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            default: assert(0);
+            }
+        }
+
+        void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            NvToAny<4, false, false>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            NvToAny<3, false, false>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, 0, yuvType);
+        }
+
+        void Nv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            NvToAny<3, true, false>(y, yStride, uv, uvStride, width, height, rgb, rgbStride, 0, yuvType);
+        }
+
+        void Nv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            NvToAny<4, false, true>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height,
+            uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            NvToAny<3, false, true>(y, yStride, vu, vuStride, width, height, bgr, bgrStride, 0, yuvType);
+        }
+
+        void Nv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height,
+            uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            NvToAny<3, true, true>(y, yStride, vu, vuStride, width, height, rgb, rgbStride, 0, yuvType);
+        }
+
+        //---------------------------------------------------------------------
+
+        const __m128i K8_SHUFFLE_YUYV_TO_YU = SIMD_MM_SETR_EPI8(0x0, 0x2, 0x4, 0x6, 0x8, 0xA, 0xC, 0xE, 0x1, 0x1, 0x5, 0x5, 0x9, 0x9, 0xD, 0xD);
+        const __m128i K8_SHUFFLE_YUYV_TO_V = SIMD_MM_SETR_EPI8(0x3, 0x3, 0x7, 0x7, 0xB, 0xB, 0xF, 0xF, -1, -1, -1, -1, -1, -1, -1, -1);
+        const __m128i K8_SHUFFLE_UYVY_TO_YU = SIMD_MM_SETR_EPI8(0x1, 0x3, 0x5, 0x7, 0x9, 0xB, 0xD, 0xF, 0x0, 0x0, 0x4, 0x4, 0x8, 0x8, 0xC, 0xC);
+        const __m128i K8_SHUFFLE_UYVY_TO_V = SIMD_MM_SETR_EPI8(0x2, 0x2, 0x6, 0x6, 0xA, 0xA, 0xE, 0xE, -1, -1, -1, -1, -1, -1, -1, -1);
+
+        template<class T, size_t N, bool rgb, bool uyvy> SIMD_INLINE void PackedYuvToAny(const uint8_t * src, __m128i a, uint8_t * dst)
+        {
+            __m128i src0 = _mm_loadu_si128((__m128i*)src + 0), src1 = _mm_loadu_si128((__m128i*)src + 1), b, g, r;
+            __m128i yu0 = _mm_shuffle_epi8(src0, uyvy ? K8_SHUFFLE_UYVY_TO_YU : K8_SHUFFLE_YUYV_TO_YU);
+            __m128i yu1 = _mm_shuffle_epi8(src1, uyvy ? K8_SHUFFLE_UYVY_TO_YU : K8_SHUFFLE_YUYV_TO_YU);
+            __m128i v0 = _mm_shuffle_epi8(src0, uyvy ? K8_SHUFFLE_UYVY_TO_V : K8_SHUFFLE_YUYV_TO_V);
+            __m128i v1 = _mm_shuffle_epi8(src1, uyvy ? K8_SHUFFLE_UYVY_TO_V : K8_SHUFFLE_YUYV_TO_V);
+            YuvToBgr<T>(_mm_unpacklo_epi64(yu0, yu1), _mm_unpackhi_epi64(yu0, yu1), _mm_unpacklo_epi64(v0, v1), b, g, r);
+            StoreAny<N, rgb>(b, g, r, a, dst);
+        }
+
+        template<class T, size_t N, bool rgb, bool uyvy> void PackedYuvToAny(const uint8_t * src, size_t srcStride,
+            size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (width >= A));
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            __m128i _alpha = _mm_set1_epi8(alpha);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    PackedYuvToAny<T, N, rgb, uyvy>(src + col * 2, _alpha, dst + col * N);
+                if (widthA != width)
+                    PackedYuvToAny<T, N, rgb, uyvy>(src + tail * 2, _alpha, dst + tail * N);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        template<size_t N, bool rgb, bool uyvy> void PackedYuvToAny(const uint8_t * src, size_t srcStride,
+            size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: PackedYuvToAny<Base::Bt601, N, rgb, uyvy>(src, srcStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: PackedYuvToAny<Base::Bt709, N, rgb, uyvy>(src, srcStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt601Full: PackedYuvToAny<Base::Bt601Full, N, rgb, uyvy>(src, srcStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709Full: PackedYuvToAny<Base::Bt709Full, N, rgb, uyvy>(src, srcStride, width, height, dst, dstStride, alpha); break;
+            default: assert(0);
+            }
+        }
+        void YuyvToBgra(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            PackedYuvToAny<4, false, false>(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void YuyvToBgr(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            PackedYuvToAny<3, false, false>(yuyv, yuyvStride, width, height, bgr, bgrStride, 0, yuvType);
+        }
+
+        void YuyvToRgb(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            PackedYuvToAny<3, true, false>(yuyv, yuyvStride, width, height, rgb, rgbStride, 0, yuvType);
+        }
+
+        void UyvyToBgra(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            PackedYuvToAny<4, false, true>(uyvy, uyvyStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void UyvyToBgr(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+            uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            PackedYuvToAny<3, false, true>(uyvy, uyvyStride, width, height, bgr, bgrStride, 0, yuvType);
+        }
+
+        void UyvyToRgb(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height,
+            uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            PackedYuvToAny<3, true, true>(uyvy, uyvyStride, width, height, rgb, rgbStride, 0, yuvType);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m128i Uint16ToUint8(const uint16_t * src, __m128i shift)
+        {
+            __m128i lo = _mm_min_epu16(_mm_srl_epi16(_mm_loadu_si128((__m128i*)src + 0), shift), K16_00FF);
+            __m128i hi = _mm_min_epu16(_mm_srl_epi16(_mm_loadu_si128((__m128i*)src + 1), shift), K16_00FF);
+            return _mm_packus_epi16(lo, hi);
+        }
+
+        SIMD_INLINE __m128i Uint16ToUint8x2(const uint16_t * src, __m128i shift)
+        {
+            __m128i val = _mm_min_epu16(_mm_srl_epi16(_mm_loadu_si128((__m128i*)src), shift), K16_00FF);
+            val = _mm_packus_epi16(val, val);
+            return _mm_unpacklo_epi8(val, val);
+        }
+
+        template<class T> SIMD_INLINE void Yuv420p16ToBgra(const uint16_t * y, const uint16_t * u, const uint16_t * v, __m128i shift, __m128i a, uint8_t * dst)
+        {
+            __m128i b, g, r;
+            YuvToBgr<T>(Uint16ToUint8(y, shift), Uint16ToUint8x2(u, shift), Uint16ToUint8x2(v, shift), b, g, r);
+            StoreAny<4, false>(b, g, r, a, dst);
+        }
+
+        template<class T> void Yuv420p16ToBgra(const uint16_t * y, size_t yStride, const uint16_t * u, size_t uStride, const uint16_t * v, size_t vStride,
+            size_t width, size_t height, int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A));
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            __m128i _alpha = _mm_set1_epi8(alpha), _shift = _mm_cvtsi32_si128(shift);
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint16_t * u0 = u + (row >> 1) * uStride;
+                const uint16_t * v0 = v + (row >> 1) * vStride;
+                for (size_t col = 0; col < widthA; col += A)
+                    Yuv420p16ToBgra<T>(y + col, u0 + col / 2, v0 + col / 2, _shift, _alpha, bgra + col * 4);
+                if (widthA != width)
+                    Yuv420p16ToBgra<T>(y + tail, u0 + tail / 2, v0 + tail / 2, _shift, _alpha, bgra + tail * 4);
+                y += yStride;
+                bgra += bgraStride;
+            }
+        }
+
+        void Yuv420p16ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            const uint16_t * y16 = (const uint16_t*)y, * u16 = (const uint16_t*)u, * v16 = (const uint16_t*)v;
+            yStride /= sizeof(uint16_t), uStride /= sizeof(uint16_t), vStride /= sizeof(uint16_t);
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420p16ToBgra<Base::Bt601>(y16, yStride, u16, uStride, v16, vStride, width, height, shift, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Yuv420p16ToBgra<Base::Bt709>(y16, yStride, u16, uStride, v16, vStride, width, height, shift, bgra, bgraStride, alpha); break;
+            case SimdYuvBt601Full: Yuv420p16ToBgra<Base::Bt601Full>(y16, yStride, u16, uStride, v16, vStride, width, height, shift, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709Full: Yuv420p16ToBgra<Base::Bt709Full>(y16, yStride, u16, uStride, v16, vStride, width, height, shift, bgra, bgraStride, alpha); break;
+            default: assert(0);
+            }
+        }
+
+        template<class T> SIMD_INLINE void P016ToBgra(const uint16_t * y, const uint16_t * uv, __m128i shift, __m128i a, uint8_t * dst)
+        {
+            __m128i _uv = Uint16ToUint8(uv, shift), b, g, r;
+            __m128i u = _mm_shuffle_epi8(_uv, K8_SHUFFLE_UV_TO_U);
+            __m128i v = _mm_shuffle_epi8(_uv, K8_SHUFFLE_UV_TO_V);
+            YuvToBgr<T>(Uint16ToUint8(y, shift), u, v, b, g, r);
+            StoreAny<4, false>(b, g, r, a, dst);
+        }
+
+        template<class T> void P016ToBgra(const uint16_t * y, size_t yStride, const uint16_t * uv, size_t uvStride,
+            size_t width, size_t height, int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A));
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            __m128i _alpha = _mm_set1_epi8(alpha), _shift = _mm_cvtsi32_si128(shift);
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint16_t * uv0 = uv + (row >> 1) * uvStride;
+                for (size_t col = 0; col < widthA; col += A)
+                    P016ToBgra<T>(y + col, uv0 + col, _shift, _alpha, bgra + col * 4);
+                if (widthA != width)
+                    P016ToBgra<T>(y + tail, uv0 + tail, _shift, _alpha, bgra + tail * 4);
+                y += yStride;
+                bgra += bgraStride;
+            }
+        }
+
+        void P016ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            const uint16_t * y16 = (const uint16_t*)y, * uv16 = (const uint16_t*)uv;
+            yStride /= sizeof(uint16_t), uvStride /= sizeof(uint16_t);
+            switch (yuvType)
+            {
+            case SimdYuvBt601: P016ToBgra<Base::Bt601>(y16, yStride, uv16, uvStride, width, height, shift, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: P016ToBgra<Base::Bt709>(y16, yStride, uv16, uvStride, width, height, shift, bgra, bgraStride, alpha); break;
+            case SimdYuvBt601Full: P016ToBgra<Base::Bt601Full>(y16, yStride, uv16, uvStride, width, height, shift, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709Full: P016ToBgra<Base::Bt709Full>(y16, yStride, uv16, uvStride, width, height, shift, bgra, bgraStride, alpha); break;
+            default: assert(0);
+            }
+        }
+    }
+#endif// SIMD_SSE41_ENABLE
+}
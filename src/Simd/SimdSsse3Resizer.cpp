@@ -123,8 +123,7 @@ namespace Simd
                 }
             }
             size_t size = AlignHi(_param.dstW, _param.align)*_param.channels * 2;
-            _bx[0].Resize(size, false, _param.align);
-            _bx[1].Resize(size, false, _param.align);
+            _bufSize = size + _param.align; // the last gray block stores a whole vector past the row end
         }
 
         template <size_t N> void ResizerByteBilinearInterpolateX(const __m128i * alpha, __m128i * buffer);
@@ -205,7 +204,7 @@ namespace Simd
             Store<false>((__m128i*)dst, _mm_packus_epi16(lo, hi));
         }
 
-        template<size_t N> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
         {
             struct One { uint8_t val[N * 1]; };
             struct Two { uint8_t val[N * 2]; };
@@ -215,12 +214,13 @@ namespace Simd
             const size_t step = A * N;
             ptrdiff_t previous = -2;
             __m128i a[2];
-            uint8_t * bx[2] = { _bx[0].data, _bx[1].data };
+            uint8_t * bx[2] = { buf, buf + _bufSize };
             const uint8_t * ax = _ax.data;
             const int32_t * ix = _ix.data;
             size_t dstW = _param.dstW;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t yDst = yBeg; yDst < yEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm_set1_epi16(int16_t(_ay[yDst]));
@@ -265,7 +265,7 @@ namespace Simd
             _mm_storeu_si128((__m128i*)(dst + index.dst), _mm_maddubs_epi16(_mm_shuffle_epi8(_src, _shuffle), _alpha));
         }
 
-        void ResizerByteBilinear::RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteBilinear::RunG(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
         {
             size_t bufW = AlignHi(_param.dstW, A) * 2;
             size_t size = 2 * _param.dstW;
@@ -273,11 +273,12 @@ namespace Simd
             size_t blocks = _blocks;
             ptrdiff_t previous = -2;
             __m128i a[2];
-            uint8_t * bx[2] = { _bx[0].data, _bx[1].data };
+            uint8_t * bx[2] = { buf, buf + _bufSize };
             const uint8_t * ax = _ax.data;
             const Idx * ixg = _ixg.data;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t yDst = yBeg; yDst < yEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm_set1_epi16(int16_t(_ay[yDst]));
@@ -310,22 +311,21 @@ namespace Simd
             }
         }
 
-        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteBilinear::RunBand(const uint8_t * src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride, uint8_t * buf)
         {
             assert(_param.dstW >= A);
 
-            EstimateParams();
             switch (_param.channels)
             {
             case 1: 
                 if(_blocks)
-                    RunG(src, srcStride, dst, dstStride);
+                    RunG(src, srcStride, yBeg, yEnd, dst, dstStride, buf);
                 else
-                    Run<1>(src, srcStride, dst, dstStride); 
+                    Run<1>(src, srcStride, yBeg, yEnd, dst, dstStride, buf); 
                 break;
-            case 2: Run<2>(src, srcStride, dst, dstStride); break;
-            case 3: Run<3>(src, srcStride, dst, dstStride); break;
-            case 4: Run<4>(src, srcStride, dst, dstStride); break;
+            case 2: Run<2>(src, srcStride, yBeg, yEnd, dst, dstStride, buf); break;
+            case 3: Run<3>(src, srcStride, yBeg, yEnd, dst, dstStride, buf); break;
+            case 4: Run<4>(src, srcStride, yBeg, yEnd, dst, dstStride, buf); break;
             default:
                 assert(0);
             }        
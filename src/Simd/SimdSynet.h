@@ -25,9 +25,12 @@
 #define __SimdSynet_h__
 
 #include "Simd/SimdMath.h"
+#include "Simd/SimdArray.h"
 
 namespace Simd
 {
+    class Resizer;
+
     namespace Base
     {
         const int U8_PRECISE_MIN = 0;
@@ -262,6 +265,52 @@ namespace Simd
         {
             return int32_t(value) | (int32_t(value) << 8) | (int32_t(value) << 16) | (int32_t(value) << 24);
         }
+
+        //---------------------------------------------------------------------
+
+        typedef void(*SynetSetInputBatchVerticalPtr)(const uint8_t * src0, const uint8_t * src1, size_t size, float weight, float * dst);
+        typedef void(*SynetSetInputBatchHorizontalPtr)(const float * src, const int32_t * offset, const float * weight, size_t width, size_t step, float coef, float shift, float * dst, bool accumulate);
+
+        void SynetSetInputBatchHorizontal(const float * src, const int32_t * offset, const float * weight, size_t width, size_t step, float coef, float shift, float * dst, bool accumulate);
+
+        void SynetSetInputBatch(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+            const float * rois, size_t count, size_t dstWidth, size_t dstHeight, const float * lower, const float * upper, float * dst,
+            size_t channels, SimdTensorFormatType dstFormat, SynetSetInputBatchVerticalPtr vertical, SynetSetInputBatchHorizontalPtr horizontal);
+
+        //---------------------------------------------------------------------
+
+        typedef void(*SynetSetInputPtr)(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+            const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat);
+        typedef void(*SynetSetInputRowsPtr)(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
+            const float * lower, const float * upper, float * dst, size_t plane, size_t channels, SimdTensorFormatType dstFormat);
+        typedef void*(*ResizerInitPtr)(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        class SynetSetInputContext : public Deletable
+        {
+        public:
+            SynetSetInputContext(Resizer * resizer, SynetSetInputRowsPtr setInput, size_t srcHeight, size_t width, size_t height, SimdPixelFormatType format, size_t pixelSize,
+                size_t left, size_t top, size_t innerHeight, const float * lower, const float * upper, size_t channels, SimdTensorFormatType dstFormat, uint8_t padding);
+            virtual ~SynetSetInputContext();
+
+            void Run(const uint8_t * src, size_t srcStride, float * dst);
+
+            size_t RunRows(const uint8_t * src, size_t srcStride, size_t srcRowBeg, size_t srcRowEnd, float * dst);
+
+        private:
+            Resizer * _resizer;
+            SynetSetInputRowsPtr _setInput;
+            size_t _srcHeight, _srcStep, _width, _height, _stride, _offset, _top, _innerHeight, _ready, _channels;
+            SimdPixelFormatType _format;
+            SimdTensorFormatType _dstFormat;
+            float _lower[3], _upper[3];
+            Array8u _buffer;
+
+            void SetRows(size_t yBeg, size_t yEnd, float * dst);
+        };
+
+        void * SynetSetInputInit(size_t srcWidth, size_t srcHeight, SimdPixelFormatType srcFormat, size_t dstWidth, size_t dstHeight,
+            const float * lower, const float * upper, size_t channels, SimdTensorFormatType dstFormat, SimdResizeMethodType method, SimdBool letterbox, uint8_t padding,
+            ResizerInitPtr resizerInit, SynetSetInputRowsPtr setInput);
     }
 
 #ifdef SIMD_SSE_ENABLE
@@ -422,14 +422,12 @@ namespace Simd
                     Forward(args.src, args.p, alg, args.weight, args.bias, args.params, args.dst);
                 }
 
-#ifdef SIMD_RUNTIME_STATISTIC
                 SIMD_INLINE String Info(const RunArgs& args) const
                 {
                     std::stringstream ss;
                     ss << "NhwcDirect [" << args.p.Info() << "]";
                     return ss.str();
                 }
-#endif
 
                 AlgParam alg;
             private:
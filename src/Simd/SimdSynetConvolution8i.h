@@ -115,7 +115,6 @@ namespace Simd
             return (padX + srcW - (kernelX - 1) * dilationX - 1) / strideX + 1;
         }
 
-#ifdef SIMD_PERFORMANCE_STATISTIC
         String Info() const
         {
             std::stringstream ss;
@@ -130,7 +129,6 @@ namespace Simd
         {
             return batch* kernelY* kernelX* srcC* dstH* dstW* dstC / group * 2;
         }
-#endif
     };
 
     struct CvtParam
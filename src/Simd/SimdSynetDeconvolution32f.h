@@ -87,7 +87,6 @@ namespace Simd
             return IsKernel(1) && IsDilation(1) && IsStride(1) && IsPad(0);
         }
 
-#ifdef SIMD_PERFORMANCE_STATISTIC
         String Info() const
         {
             std::stringstream ss;
@@ -101,7 +100,6 @@ namespace Simd
         {
             return batch * kernelY * kernelX * srcC * srcH * srcW * dstC / group * 2;
         }
-#endif
     };
 
     class SynetDeconvolution32f : public Deletable
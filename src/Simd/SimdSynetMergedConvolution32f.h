@@ -116,7 +116,6 @@ namespace Simd
             return conv[index].padY == value && conv[index].padX == value && conv[index].padH == value && conv[index].padW == value;
         }
 
-#ifdef SIMD_PERFORMANCE_STATISTIC
         String Info() const
         {
             std::stringstream ss;
@@ -138,7 +137,6 @@ namespace Simd
                 flop += Flop(i);
             return flop;
         }
-#endif
     };
 
     class SynetMergedConvolution32f : public Deletable
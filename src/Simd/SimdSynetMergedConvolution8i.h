@@ -102,7 +102,6 @@ namespace Simd
             return true;
         }
 
-#ifdef SIMD_PERFORMANCE_STATISTIC
         String Info() const
         {
             std::stringstream ss;
@@ -120,7 +119,6 @@ namespace Simd
                 flop += conv[i].Flop();
             return flop;
         }
-#endif
     };
 
     class SynetMergedConvolution8i : public Deletable
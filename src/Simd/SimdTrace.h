@@ -0,0 +1,106 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdTrace_h__
+#define __SimdTrace_h__
+
+#include "Simd/SimdDefs.h"
+
+#include <string>
+#include <atomic>
+
+namespace Simd
+{
+    namespace Base
+    {
+        struct TraceSink
+        {
+            SimdTraceCallbackPtr callback;
+            void * userData;
+        };
+
+        extern std::atomic<const TraceSink*> g_traceSink;
+
+        SIMD_INLINE bool TraceEnabled()
+        {
+            return g_traceSink.load(std::memory_order_relaxed) != NULL;
+        }
+
+        void SetTraceCallback(SimdTraceCallbackPtr callback, void * userData);
+
+        size_t TraceThread();
+
+        void TraceEvent(SimdTraceEventType type, const char * name, int64_t size);
+
+        bool ChromeTraceStart(const char * path);
+
+        bool ChromeTraceStop();
+
+        class TraceRegion
+        {
+            std::string _name;
+            const TraceSink * _sink;
+            size_t _thread;
+
+        public:
+            TraceRegion(const std::string & name, int64_t size)
+                : _name(name)
+                , _sink(g_traceSink.load())
+                , _thread(TraceThread())
+            {
+                if (_sink)
+                    _sink->callback(_sink->userData, SimdTraceEventBegin, _name.c_str(), _thread, size);
+            }
+
+            ~TraceRegion()
+            {
+                if (_sink)
+                    _sink->callback(_sink->userData, SimdTraceEventEnd, _name.c_str(), _thread, 0);
+            }
+        };
+
+        class TraceHolder
+        {
+            TraceRegion * _region;
+
+        public:
+            SIMD_INLINE TraceHolder(TraceRegion * region)
+                : _region(region)
+            {
+            }
+
+            SIMD_INLINE ~TraceHolder()
+            {
+                if (_region)
+                    delete _region;
+            }
+        };
+    }
+}
+
+#define SIMD_TRACE_FUNCF(flop) Simd::Base::TraceHolder SIMD_CAT(__trh, __LINE__)(Simd::Base::TraceEnabled() ? new Simd::Base::TraceRegion(SIMD_FUNCTION, (long long)(flop)) : NULL)
+#define SIMD_TRACE_BEGF(desc, flop) Simd::Base::TraceHolder SIMD_CAT(__trh, __LINE__)(Simd::Base::TraceEnabled() ? new Simd::Base::TraceRegion(std::string(SIMD_FUNCTION) + "{ " + (desc) + " }", (long long)(flop)) : NULL)
+#define SIMD_TRACE_IFF(cond, desc, flop) Simd::Base::TraceHolder SIMD_CAT(__trh, __LINE__)((cond) && Simd::Base::TraceEnabled() ? new Simd::Base::TraceRegion(std::string(SIMD_FUNCTION) + "{ " + (desc) + " }", (long long)(flop)) : NULL)
+#define SIMD_TRACE_EXT(ext) Simd::Base::TraceHolder SIMD_CAT(__trh, __LINE__)(Simd::Base::TraceEnabled() ? new Simd::Base::TraceRegion(std::string(SIMD_FUNCTION) + "{ " + (ext)->Param().Info() + " " + (ext)->Info() + " }", (ext)->Param().Flop()) : NULL)
+
+#endif//__SimdTrace_h__
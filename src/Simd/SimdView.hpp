@@ -109,6 +109,14 @@ namespace Simd
             Hsl24,
             /*! A 24-bit (3 8-bit channels) RGB (Red, Green, Blue) pixel format. */
             Rgb24,
+            /*! A 16-bit packed YUV 4:2:2 pixel format (bytes Y0 U Y1 V for each pair of pixels). */
+            Yuyv16,
+            /*! A 16-bit packed YUV 4:2:2 pixel format (bytes U Y0 V Y1 for each pair of pixels). */
+            Uyvy16,
+            /*! A 32-bit (2 16-bit channels) interleaved UV pixel format (chroma plane of P010/P016 image). */
+            Uv32,
+            /*! A 24-bit (3 8-bit channels) CIE L*a*b* (Lightness, a, b) pixel format. */
+            Lab24,
         };
 
         /*!
@@ -1045,6 +1053,10 @@ namespace Simd
         case Hsv24:     return 3;
         case Hsl24:     return 3;
         case Rgb24:     return 3;
+        case Yuyv16:    return 2;
+        case Uyvy16:    return 2;
+        case Uv32:      return 4;
+        case Lab24:     return 3;
         default: assert(0); return 0;
         }
     }
@@ -1075,6 +1087,10 @@ namespace Simd
         case Hsv24:     return 1;
         case Hsl24:     return 1;
         case Rgb24:     return 1;
+        case Yuyv16:    return 1;
+        case Uyvy16:    return 1;
+        case Uv32:      return 2;
+        case Lab24:     return 1;
         default: assert(0); return 0;
         }
     }
@@ -1105,6 +1121,10 @@ namespace Simd
         case Hsv24:     return 3;
         case Hsl24:     return 3;
         case Rgb24:     return 3;
+        case Yuyv16:    return 2;
+        case Uyvy16:    return 2;
+        case Uv32:      return 2;
+        case Lab24:     return 3;
         default: assert(0); return 0;
         }
     }
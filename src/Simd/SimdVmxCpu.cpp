@@ -41,7 +41,8 @@ namespace Simd
 
         bool GetEnable()
         {
-            return SupportedByCPU();
+            static const bool enable = SupportedByCPU();
+            return enable;
         }
     }
 #endif// SIMD_VMX_ENABLE
@@ -0,0 +1,271 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdWarpAffine_h__
+#define __SimdWarpAffine_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    struct WarpAffParam
+    {
+        size_t srcW, srcH, srcS, dstW, dstH, dstS, channels;
+        float mat[6];
+        SimdWarpAffineFlags flags;
+        uint8_t border[16];
+        size_t align;
+
+        WarpAffParam(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border, size_t align);
+
+        bool Valid() const;
+
+        bool IsByte() const
+        {
+            return (flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelByte;
+        }
+
+        bool IsNearest() const
+        {
+            return (flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpNearest;
+        }
+
+        bool IsConstant() const
+        {
+            return (flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant;
+        }
+
+        size_t PixelSize() const
+        {
+            return channels * (IsByte() ? 1 : 4);
+        }
+    };
+
+    class WarpAffine : Deletable
+    {
+    public:
+        WarpAffine(const WarpAffParam& param);
+
+        void Run(const uint8_t* src, uint8_t* dst);
+
+    protected:
+        WarpAffParam _param;
+        float _inv[6];
+        Array32i _ax, _ay;
+
+        virtual void RunRows(const uint8_t* src, size_t yBeg, size_t yEnd, uint8_t* dst) = 0;
+    };
+
+    namespace Base
+    {
+        const int WARP_AFFINE_BITS = 10;
+        const int WARP_AFFINE_RANGE = 1 << WARP_AFFINE_BITS;
+        const int WARP_AFFINE_MASK = WARP_AFFINE_RANGE - 1;
+        const int WARP_AFFINE_ROUND = 1 << (WARP_AFFINE_BITS - 1);
+        const int WARP_AFFINE_BILINEAR_ROUND = 1 << (2 * WARP_AFFINE_BITS - 1);
+
+        SIMD_INLINE bool WarpAffineInvert(const float* mat, float* inv)
+        {
+            double det = double(mat[0]) * mat[4] - double(mat[1]) * mat[3];
+            if (::fabs(det) < 1.0e-9)
+                return false;
+            double k = 1.0 / det;
+            inv[0] = float(mat[4] * k);
+            inv[1] = float(-mat[1] * k);
+            inv[2] = float((double(mat[1]) * mat[5] - double(mat[4]) * mat[2]) * k);
+            inv[3] = float(-mat[3] * k);
+            inv[4] = float(mat[0] * k);
+            inv[5] = float((double(mat[3]) * mat[2] - double(mat[0]) * mat[5]) * k);
+            return true;
+        }
+
+        SIMD_INLINE int32_t WarpAffineFixed(double value)
+        {
+            return Simd::Round(value * WARP_AFFINE_RANGE);
+        }
+
+        template<size_t N> SIMD_INLINE void WarpAffineNearestRow(const uint8_t* src, const uint8_t* border, const int32_t* index, size_t begin, size_t end, uint8_t* dst)
+        {
+            for (size_t dx = begin; dx < end; dx++)
+                memcpy(dst + dx * N, index[dx] >= 0 ? src + index[dx] : border, N);
+        }
+
+        template<size_t N> SIMD_INLINE void WarpAffineBilinearInterp(const uint8_t* p00, const uint8_t* p01, const uint8_t* p10, const uint8_t* p11, int32_t fx, int32_t fy, uint8_t* dst)
+        {
+            int32_t fx0 = WARP_AFFINE_RANGE - fx, fy0 = WARP_AFFINE_RANGE - fy;
+            for (size_t c = 0; c < N; ++c)
+            {
+                int32_t top = p00[c] * fx0 + p01[c] * fx;
+                int32_t bot = p10[c] * fx0 + p11[c] * fx;
+                dst[c] = uint8_t((top * fy0 + bot * fy + WARP_AFFINE_BILINEAR_ROUND) >> (2 * WARP_AFFINE_BITS));
+            }
+        }
+
+        template<size_t N> SIMD_INLINE void WarpAffineBilinearInterp(const float* p00, const float* p01, const float* p10, const float* p11, int32_t fx, int32_t fy, float* dst)
+        {
+            float fx1 = float(fx) * (1.0f / WARP_AFFINE_RANGE), fx0 = 1.0f - fx1;
+            float fy1 = float(fy) * (1.0f / WARP_AFFINE_RANGE), fy0 = 1.0f - fy1;
+            for (size_t c = 0; c < N; ++c)
+                dst[c] = (p00[c] * fx0 + p01[c] * fx1) * fy0 + (p10[c] * fx0 + p11[c] * fx1) * fy1;
+        }
+
+        template<class T, size_t N> SIMD_INLINE void WarpAffineBilinearPixel(const WarpAffParam& p, const uint8_t* src, int32_t index, int32_t x, int32_t y, uint8_t* dst)
+        {
+            const uint8_t* ps[4];
+            if (index >= 0)
+            {
+                ps[0] = src + index;
+                ps[1] = ps[0] + N * sizeof(T);
+                ps[2] = ps[0] + p.srcS;
+                ps[3] = ps[2] + N * sizeof(T);
+            }
+            else
+            {
+                int32_t x0 = x >> WARP_AFFINE_BITS, y0 = y >> WARP_AFFINE_BITS, w = (int32_t)p.srcW, h = (int32_t)p.srcH;
+                for (int32_t i = 0; i < 4; ++i)
+                {
+                    int32_t sx = x0 + (i & 1), sy = y0 + (i >> 1);
+                    if (p.IsConstant())
+                        ps[i] = (sx >= 0 && sx < w && sy >= 0 && sy < h) ? src + sy * p.srcS + sx * N * sizeof(T) : p.border;
+                    else
+                        ps[i] = src + Simd::RestrictRange(sy, 0, h - 1) * p.srcS + Simd::RestrictRange(sx, 0, w - 1) * N * sizeof(T);
+                }
+            }
+            WarpAffineBilinearInterp<N>((const T*)ps[0], (const T*)ps[1], (const T*)ps[2], (const T*)ps[3], x & WARP_AFFINE_MASK, y & WARP_AFFINE_MASK, (T*)dst);
+        }
+
+        template<class T, size_t N> SIMD_INLINE void WarpAffineBilinearRow(const WarpAffParam& p, const uint8_t* src, const int32_t* index, const int32_t* xs, const int32_t* ys, size_t begin, size_t end, uint8_t* dst)
+        {
+            for (size_t dx = begin; dx < end; dx++)
+                WarpAffineBilinearPixel<T, N>(p, src, index[dx], xs[dx], ys[dx], dst + dx * N * sizeof(T));
+        }
+
+        //---------------------------------------------------------------------
+
+        class WarpAffineNearest : public Simd::WarpAffine
+        {
+        public:
+            WarpAffineNearest(const WarpAffParam& param);
+
+        protected:
+            virtual void RunRows(const uint8_t* src, size_t yBeg, size_t yEnd, uint8_t* dst);
+            virtual void EstimateIndex(int32_t bx, int32_t by, int32_t* index);
+            virtual void RunRow(const uint8_t* src, const int32_t* index, uint8_t* dst);
+        };
+
+        class WarpAffineBilinear : public Simd::WarpAffine
+        {
+        public:
+            WarpAffineBilinear(const WarpAffParam& param);
+
+        protected:
+            virtual void RunRows(const uint8_t* src, size_t yBeg, size_t yEnd, uint8_t* dst);
+            virtual void EstimateIndex(int32_t bx, int32_t by, int32_t* index, int32_t* xs, int32_t* ys);
+            virtual void RunRow(const uint8_t* src, const int32_t* index, const int32_t* xs, const int32_t* ys, uint8_t* dst);
+        };
+
+        void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class WarpAffineNearest : public Base::WarpAffineNearest
+        {
+        public:
+            WarpAffineNearest(const WarpAffParam& param);
+
+        protected:
+            virtual void EstimateIndex(int32_t bx, int32_t by, int32_t* index);
+        };
+
+        class WarpAffineBilinear : public Base::WarpAffineBilinear
+        {
+        public:
+            WarpAffineBilinear(const WarpAffParam& param);
+
+        protected:
+            virtual void EstimateIndex(int32_t bx, int32_t by, int32_t* index, int32_t* xs, int32_t* ys);
+            virtual void RunRow(const uint8_t* src, const int32_t* index, const int32_t* xs, const int32_t* ys, uint8_t* dst);
+        };
+
+        void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+    }
+#endif //SIMD_SSE41_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class WarpAffineNearest : public Sse41::WarpAffineNearest
+        {
+        public:
+            WarpAffineNearest(const WarpAffParam& param);
+
+        protected:
+            virtual void EstimateIndex(int32_t bx, int32_t by, int32_t* index);
+            virtual void RunRow(const uint8_t* src, const int32_t* index, uint8_t* dst);
+        };
+
+        class WarpAffineBilinear : public Sse41::WarpAffineBilinear
+        {
+        public:
+            WarpAffineBilinear(const WarpAffParam& param);
+
+        protected:
+            virtual void EstimateIndex(int32_t bx, int32_t by, int32_t* index, int32_t* xs, int32_t* ys);
+            virtual void RunRow(const uint8_t* src, const int32_t* index, const int32_t* xs, const int32_t* ys, uint8_t* dst);
+        };
+
+        void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+    }
+#endif //SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class WarpAffineNearest : public Avx2::WarpAffineNearest
+        {
+        public:
+            WarpAffineNearest(const WarpAffParam& param);
+
+        protected:
+            virtual void EstimateIndex(int32_t bx, int32_t by, int32_t* index);
+            virtual void RunRow(const uint8_t* src, const int32_t* index, uint8_t* dst);
+        };
+
+        class WarpAffineBilinear : public Avx2::WarpAffineBilinear
+        {
+        public:
+            WarpAffineBilinear(const WarpAffParam& param);
+
+        protected:
+            virtual void EstimateIndex(int32_t bx, int32_t by, int32_t* index, int32_t* xs, int32_t* ys);
+            virtual void RunRow(const uint8_t* src, const int32_t* index, const int32_t* xs, const int32_t* ys, uint8_t* dst);
+        };
+
+        void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+    }
+#endif //SIMD_AVX512BW_ENABLE
+}
+#endif//__SimdWarpAffine_h__
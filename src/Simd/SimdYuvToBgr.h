@@ -0,0 +1,433 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdYuvToBgr_h__
+#define __SimdYuvToBgr_h__
+
+#include "Simd/SimdConst.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdSet.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        /*
+        * Fixed point coefficients of YUV <-> BGR conversion for every SimdYuvType.
+        * BT.601 coefficients are the same as in SimdConst.h (legacy functions and V2 functions give identical results).
+        */
+        struct Bt601
+        {
+            static const int Y_ADJUST = 16;
+            static const int UV_ADJUST = 128;
+
+            static const int Y_TO_RGB_WEIGHT = int(1.164 * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int U_TO_BLUE_WEIGHT = int(2.018 * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int U_TO_GREEN_WEIGHT = -int(0.391 * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int V_TO_GREEN_WEIGHT = -int(0.813 * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int V_TO_RED_WEIGHT = int(1.596 * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+
+            static const int BLUE_TO_Y_WEIGHT = int(0.098 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_Y_WEIGHT = int(0.504 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_Y_WEIGHT = int(0.257 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_U_WEIGHT = int(0.439 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_U_WEIGHT = -int(0.291 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_U_WEIGHT = -int(0.148 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_V_WEIGHT = -int(0.071 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_V_WEIGHT = -int(0.368 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_V_WEIGHT = int(0.439 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+        };
+
+        struct Bt709
+        {
+            static const int Y_ADJUST = 16;
+            static const int UV_ADJUST = 128;
+
+            static const int Y_TO_RGB_WEIGHT = int(1.1644 * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int U_TO_BLUE_WEIGHT = int(2.1124 * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int U_TO_GREEN_WEIGHT = -int(0.2132 * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int V_TO_GREEN_WEIGHT = -int(0.5329 * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int V_TO_RED_WEIGHT = int(1.7927 * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+
+            static const int BLUE_TO_Y_WEIGHT = int(0.0620 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_Y_WEIGHT = int(0.6142 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_Y_WEIGHT = int(0.1826 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_U_WEIGHT = int(0.4392 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_U_WEIGHT = -int(0.3386 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_U_WEIGHT = -int(0.1006 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_V_WEIGHT = -int(0.0403 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_V_WEIGHT = -int(0.3989 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_V_WEIGHT = int(0.4392 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+        };
+
+        struct Bt601Full
+        {
+            static const int Y_ADJUST = 0;
+            static const int UV_ADJUST = 128;
+
+            static const int Y_TO_RGB_WEIGHT = int(1.0000 * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int U_TO_BLUE_WEIGHT = int(1.7720 * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int U_TO_GREEN_WEIGHT = -int(0.3441 * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int V_TO_GREEN_WEIGHT = -int(0.7141 * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int V_TO_RED_WEIGHT = int(1.4020 * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+
+            static const int BLUE_TO_Y_WEIGHT = int(0.1140 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_Y_WEIGHT = int(0.5870 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_Y_WEIGHT = int(0.2990 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_U_WEIGHT = int(0.5000 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_U_WEIGHT = -int(0.3313 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_U_WEIGHT = -int(0.1687 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_V_WEIGHT = -int(0.0813 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_V_WEIGHT = -int(0.4187 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_V_WEIGHT = int(0.5000 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+        };
+
+        struct Bt709Full
+        {
+            static const int Y_ADJUST = 0;
+            static const int UV_ADJUST = 128;
+
+            static const int Y_TO_RGB_WEIGHT = int(1.0000 * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int U_TO_BLUE_WEIGHT = int(1.8556 * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int U_TO_GREEN_WEIGHT = -int(0.1873 * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int V_TO_GREEN_WEIGHT = -int(0.4681 * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int V_TO_RED_WEIGHT = int(1.5748 * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+
+            static const int BLUE_TO_Y_WEIGHT = int(0.0722 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_Y_WEIGHT = int(0.7152 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_Y_WEIGHT = int(0.2126 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_U_WEIGHT = int(0.5000 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_U_WEIGHT = -int(0.3854 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_U_WEIGHT = -int(0.1146 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_V_WEIGHT = -int(0.0458 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_V_WEIGHT = -int(0.4542 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_V_WEIGHT = int(0.5000 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+        };
+
+        template<class T> SIMD_INLINE int YuvToBlue(int y, int u)
+        {
+            return RestrictRange((T::Y_TO_RGB_WEIGHT * (y - T::Y_ADJUST) + T::U_TO_BLUE_WEIGHT * (u - T::UV_ADJUST) +
+                YUV_TO_BGR_ROUND_TERM) >> YUV_TO_BGR_AVERAGING_SHIFT);
+        }
+
+        template<class T> SIMD_INLINE int YuvToGreen(int y, int u, int v)
+        {
+            return RestrictRange((T::Y_TO_RGB_WEIGHT * (y - T::Y_ADJUST) + T::U_TO_GREEN_WEIGHT * (u - T::UV_ADJUST) +
+                T::V_TO_GREEN_WEIGHT * (v - T::UV_ADJUST) + YUV_TO_BGR_ROUND_TERM) >> YUV_TO_BGR_AVERAGING_SHIFT);
+        }
+
+        template<class T> SIMD_INLINE int YuvToRed(int y, int v)
+        {
+            return RestrictRange((T::Y_TO_RGB_WEIGHT * (y - T::Y_ADJUST) + T::V_TO_RED_WEIGHT * (v - T::UV_ADJUST) +
+                YUV_TO_BGR_ROUND_TERM) >> YUV_TO_BGR_AVERAGING_SHIFT);
+        }
+
+        template<class T> SIMD_INLINE void YuvToBgr(int y, int u, int v, uint8_t * bgr)
+        {
+            bgr[0] = YuvToBlue<T>(y, u);
+            bgr[1] = YuvToGreen<T>(y, u, v);
+            bgr[2] = YuvToRed<T>(y, v);
+        }
+
+        template<class T> SIMD_INLINE void YuvToBgra(int y, int u, int v, int alpha, uint8_t * bgra)
+        {
+            bgra[0] = YuvToBlue<T>(y, u);
+            bgra[1] = YuvToGreen<T>(y, u, v);
+            bgra[2] = YuvToRed<T>(y, v);
+            bgra[3] = alpha;
+        }
+
+        template<class T> SIMD_INLINE void YuvToRgb(int y, int u, int v, uint8_t * rgb)
+        {
+            rgb[0] = YuvToRed<T>(y, v);
+            rgb[1] = YuvToGreen<T>(y, u, v);
+            rgb[2] = YuvToBlue<T>(y, u);
+        }
+
+        template<class T> SIMD_INLINE int BgrToY(int blue, int green, int red)
+        {
+            return RestrictRange(((T::BLUE_TO_Y_WEIGHT * blue + T::GREEN_TO_Y_WEIGHT * green + T::RED_TO_Y_WEIGHT * red +
+                BGR_TO_YUV_ROUND_TERM) >> BGR_TO_YUV_AVERAGING_SHIFT) + T::Y_ADJUST);
+        }
+
+        template<class T> SIMD_INLINE int BgrToU(int blue, int green, int red)
+        {
+            return RestrictRange(((T::BLUE_TO_U_WEIGHT * blue + T::GREEN_TO_U_WEIGHT * green + T::RED_TO_U_WEIGHT * red +
+                BGR_TO_YUV_ROUND_TERM) >> BGR_TO_YUV_AVERAGING_SHIFT) + T::UV_ADJUST);
+        }
+
+        template<class T> SIMD_INLINE int BgrToV(int blue, int green, int red)
+        {
+            return RestrictRange(((T::BLUE_TO_V_WEIGHT * blue + T::GREEN_TO_V_WEIGHT * green + T::RED_TO_V_WEIGHT * red +
+                BGR_TO_YUV_ROUND_TERM) >> BGR_TO_YUV_AVERAGING_SHIFT) + T::UV_ADJUST);
+        }
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        template<class T> SIMD_INLINE __m128i YuvToBgr32(__m128i y_1, __m128i uv, __m128i uvWeight)
+        {
+            const __m128i yWeight = SetInt16(T::Y_TO_RGB_WEIGHT, Base::YUV_TO_BGR_ROUND_TERM);
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(y_1, yWeight), _mm_madd_epi16(uv, uvWeight)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+        }
+
+        template<class T> SIMD_INLINE void YuvToBgr16(__m128i y16, __m128i u16, __m128i v16, __m128i & b16, __m128i & g16, __m128i & r16)
+        {
+            const __m128i ub = SetInt16(T::U_TO_BLUE_WEIGHT, 0);
+            const __m128i ugvg = SetInt16(T::U_TO_GREEN_WEIGHT, T::V_TO_GREEN_WEIGHT);
+            const __m128i vr = SetInt16(0, T::V_TO_RED_WEIGHT);
+            y16 = _mm_sub_epi16(y16, _mm_set1_epi16(T::Y_ADJUST));
+            u16 = _mm_sub_epi16(u16, _mm_set1_epi16(T::UV_ADJUST));
+            v16 = _mm_sub_epi16(v16, _mm_set1_epi16(T::UV_ADJUST));
+            __m128i y_1[2] = { _mm_unpacklo_epi16(y16, K16_0001), _mm_unpackhi_epi16(y16, K16_0001) };
+            __m128i uv[2] = { _mm_unpacklo_epi16(u16, v16), _mm_unpackhi_epi16(u16, v16) };
+            b16 = _mm_packs_epi32(YuvToBgr32<T>(y_1[0], uv[0], ub), YuvToBgr32<T>(y_1[1], uv[1], ub));
+            g16 = _mm_packs_epi32(YuvToBgr32<T>(y_1[0], uv[0], ugvg), YuvToBgr32<T>(y_1[1], uv[1], ugvg));
+            r16 = _mm_packs_epi32(YuvToBgr32<T>(y_1[0], uv[0], vr), YuvToBgr32<T>(y_1[1], uv[1], vr));
+        }
+
+        template<class T> SIMD_INLINE void YuvToBgr(__m128i y8, __m128i u8, __m128i v8, __m128i & b8, __m128i & g8, __m128i & r8)
+        {
+            __m128i b16[2], g16[2], r16[2];
+            YuvToBgr16<T>(_mm_unpacklo_epi8(y8, K_ZERO), _mm_unpacklo_epi8(u8, K_ZERO), _mm_unpacklo_epi8(v8, K_ZERO), b16[0], g16[0], r16[0]);
+            YuvToBgr16<T>(_mm_unpackhi_epi8(y8, K_ZERO), _mm_unpackhi_epi8(u8, K_ZERO), _mm_unpackhi_epi8(v8, K_ZERO), b16[1], g16[1], r16[1]);
+            b8 = _mm_packus_epi16(b16[0], b16[1]);
+            g8 = _mm_packus_epi16(g16[0], g16[1]);
+            r8 = _mm_packus_epi16(r16[0], r16[1]);
+        }
+
+        SIMD_INLINE __m128i BgrToYuv16(__m128i b16, __m128i g16, __m128i r16, __m128i brWeight, __m128i gWeight, __m128i adjust)
+        {
+            __m128i lo = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(b16, r16), brWeight), _mm_madd_epi16(_mm_unpacklo_epi16(g16, K16_0001), gWeight));
+            __m128i hi = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(b16, r16), brWeight), _mm_madd_epi16(_mm_unpackhi_epi16(g16, K16_0001), gWeight));
+            return _mm_add_epi16(_mm_packs_epi32(_mm_srai_epi32(lo, Base::BGR_TO_YUV_AVERAGING_SHIFT), _mm_srai_epi32(hi, Base::BGR_TO_YUV_AVERAGING_SHIFT)), adjust);
+        }
+
+        template<class T> SIMD_INLINE __m128i BgrToY16(__m128i b16, __m128i g16, __m128i r16)
+        {
+            return BgrToYuv16(b16, g16, r16, SetInt16(T::BLUE_TO_Y_WEIGHT, T::RED_TO_Y_WEIGHT),
+                SetInt16(T::GREEN_TO_Y_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM), _mm_set1_epi16(T::Y_ADJUST));
+        }
+
+        template<class T> SIMD_INLINE __m128i BgrToU16(__m128i b16, __m128i g16, __m128i r16)
+        {
+            return BgrToYuv16(b16, g16, r16, SetInt16(T::BLUE_TO_U_WEIGHT, T::RED_TO_U_WEIGHT),
+                SetInt16(T::GREEN_TO_U_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM), _mm_set1_epi16(T::UV_ADJUST));
+        }
+
+        template<class T> SIMD_INLINE __m128i BgrToV16(__m128i b16, __m128i g16, __m128i r16)
+        {
+            return BgrToYuv16(b16, g16, r16, SetInt16(T::BLUE_TO_V_WEIGHT, T::RED_TO_V_WEIGHT),
+                SetInt16(T::GREEN_TO_V_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM), _mm_set1_epi16(T::UV_ADJUST));
+        }
+
+        template<class T> SIMD_INLINE __m128i BgrToY8(__m128i b8, __m128i g8, __m128i r8)
+        {
+            return _mm_packus_epi16(
+                BgrToY16<T>(_mm_unpacklo_epi8(b8, K_ZERO), _mm_unpacklo_epi8(g8, K_ZERO), _mm_unpacklo_epi8(r8, K_ZERO)),
+                BgrToY16<T>(_mm_unpackhi_epi8(b8, K_ZERO), _mm_unpackhi_epi8(g8, K_ZERO), _mm_unpackhi_epi8(r8, K_ZERO)));
+        }
+
+        template<class T> SIMD_INLINE __m128i BgrToU8(__m128i b8, __m128i g8, __m128i r8)
+        {
+            return _mm_packus_epi16(
+                BgrToU16<T>(_mm_unpacklo_epi8(b8, K_ZERO), _mm_unpacklo_epi8(g8, K_ZERO), _mm_unpacklo_epi8(r8, K_ZERO)),
+                BgrToU16<T>(_mm_unpackhi_epi8(b8, K_ZERO), _mm_unpackhi_epi8(g8, K_ZERO), _mm_unpackhi_epi8(r8, K_ZERO)));
+        }
+
+        template<class T> SIMD_INLINE __m128i BgrToV8(__m128i b8, __m128i g8, __m128i r8)
+        {
+            return _mm_packus_epi16(
+                BgrToV16<T>(_mm_unpacklo_epi8(b8, K_ZERO), _mm_unpacklo_epi8(g8, K_ZERO), _mm_unpacklo_epi8(r8, K_ZERO)),
+                BgrToV16<T>(_mm_unpackhi_epi8(b8, K_ZERO), _mm_unpackhi_epi8(g8, K_ZERO), _mm_unpackhi_epi8(r8, K_ZERO)));
+        }
+    }
+#endif// SIMD_SSE41_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        template<class T> SIMD_INLINE __m256i YuvToBgr32(__m256i y_1, __m256i uv, __m256i uvWeight)
+        {
+            const __m256i yWeight = SetInt16(T::Y_TO_RGB_WEIGHT, Base::YUV_TO_BGR_ROUND_TERM);
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(y_1, yWeight), _mm256_madd_epi16(uv, uvWeight)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+        }
+
+        template<class T> SIMD_INLINE void YuvToBgr16(__m256i y16, __m256i u16, __m256i v16, __m256i & b16, __m256i & g16, __m256i & r16)
+        {
+            const __m256i ub = SetInt16(T::U_TO_BLUE_WEIGHT, 0);
+            const __m256i ugvg = SetInt16(T::U_TO_GREEN_WEIGHT, T::V_TO_GREEN_WEIGHT);
+            const __m256i vr = SetInt16(0, T::V_TO_RED_WEIGHT);
+            y16 = _mm256_sub_epi16(y16, _mm256_set1_epi16(T::Y_ADJUST));
+            u16 = _mm256_sub_epi16(u16, _mm256_set1_epi16(T::UV_ADJUST));
+            v16 = _mm256_sub_epi16(v16, _mm256_set1_epi16(T::UV_ADJUST));
+            __m256i y_1[2] = { _mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpackhi_epi16(y16, K16_0001) };
+            __m256i uv[2] = { _mm256_unpacklo_epi16(u16, v16), _mm256_unpackhi_epi16(u16, v16) };
+            b16 = _mm256_packs_epi32(YuvToBgr32<T>(y_1[0], uv[0], ub), YuvToBgr32<T>(y_1[1], uv[1], ub));
+            g16 = _mm256_packs_epi32(YuvToBgr32<T>(y_1[0], uv[0], ugvg), YuvToBgr32<T>(y_1[1], uv[1], ugvg));
+            r16 = _mm256_packs_epi32(YuvToBgr32<T>(y_1[0], uv[0], vr), YuvToBgr32<T>(y_1[1], uv[1], vr));
+        }
+
+        template<class T> SIMD_INLINE void YuvToBgr(__m256i y8, __m256i u8, __m256i v8, __m256i & b8, __m256i & g8, __m256i & r8)
+        {
+            __m256i b16[2], g16[2], r16[2];
+            YuvToBgr16<T>(_mm256_unpacklo_epi8(y8, K_ZERO), _mm256_unpacklo_epi8(u8, K_ZERO), _mm256_unpacklo_epi8(v8, K_ZERO), b16[0], g16[0], r16[0]);
+            YuvToBgr16<T>(_mm256_unpackhi_epi8(y8, K_ZERO), _mm256_unpackhi_epi8(u8, K_ZERO), _mm256_unpackhi_epi8(v8, K_ZERO), b16[1], g16[1], r16[1]);
+            b8 = _mm256_packus_epi16(b16[0], b16[1]);
+            g8 = _mm256_packus_epi16(g16[0], g16[1]);
+            r8 = _mm256_packus_epi16(r16[0], r16[1]);
+        }
+
+        SIMD_INLINE __m256i BgrToYuv16(__m256i b16, __m256i g16, __m256i r16, __m256i brWeight, __m256i gWeight, __m256i adjust)
+        {
+            __m256i lo = _mm256_add_epi32(_mm256_madd_epi16(_mm256_unpacklo_epi16(b16, r16), brWeight), _mm256_madd_epi16(_mm256_unpacklo_epi16(g16, K16_0001), gWeight));
+            __m256i hi = _mm256_add_epi32(_mm256_madd_epi16(_mm256_unpackhi_epi16(b16, r16), brWeight), _mm256_madd_epi16(_mm256_unpackhi_epi16(g16, K16_0001), gWeight));
+            return _mm256_add_epi16(_mm256_packs_epi32(_mm256_srai_epi32(lo, Base::BGR_TO_YUV_AVERAGING_SHIFT), _mm256_srai_epi32(hi, Base::BGR_TO_YUV_AVERAGING_SHIFT)), adjust);
+        }
+
+        template<class T> SIMD_INLINE __m256i BgrToY16(__m256i b16, __m256i g16, __m256i r16)
+        {
+            return BgrToYuv16(b16, g16, r16, SetInt16(T::BLUE_TO_Y_WEIGHT, T::RED_TO_Y_WEIGHT),
+                SetInt16(T::GREEN_TO_Y_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM), _mm256_set1_epi16(T::Y_ADJUST));
+        }
+
+        template<class T> SIMD_INLINE __m256i BgrToU16(__m256i b16, __m256i g16, __m256i r16)
+        {
+            return BgrToYuv16(b16, g16, r16, SetInt16(T::BLUE_TO_U_WEIGHT, T::RED_TO_U_WEIGHT),
+                SetInt16(T::GREEN_TO_U_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM), _mm256_set1_epi16(T::UV_ADJUST));
+        }
+
+        template<class T> SIMD_INLINE __m256i BgrToV16(__m256i b16, __m256i g16, __m256i r16)
+        {
+            return BgrToYuv16(b16, g16, r16, SetInt16(T::BLUE_TO_V_WEIGHT, T::RED_TO_V_WEIGHT),
+                SetInt16(T::GREEN_TO_V_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM), _mm256_set1_epi16(T::UV_ADJUST));
+        }
+
+        template<class T> SIMD_INLINE __m256i BgrToY8(__m256i b8, __m256i g8, __m256i r8)
+        {
+            return _mm256_packus_epi16(
+                BgrToY16<T>(_mm256_unpacklo_epi8(b8, K_ZERO), _mm256_unpacklo_epi8(g8, K_ZERO), _mm256_unpacklo_epi8(r8, K_ZERO)),
+                BgrToY16<T>(_mm256_unpackhi_epi8(b8, K_ZERO), _mm256_unpackhi_epi8(g8, K_ZERO), _mm256_unpackhi_epi8(r8, K_ZERO)));
+        }
+
+        template<class T> SIMD_INLINE __m256i BgrToU8(__m256i b8, __m256i g8, __m256i r8)
+        {
+            return _mm256_packus_epi16(
+                BgrToU16<T>(_mm256_unpacklo_epi8(b8, K_ZERO), _mm256_unpacklo_epi8(g8, K_ZERO), _mm256_unpacklo_epi8(r8, K_ZERO)),
+                BgrToU16<T>(_mm256_unpackhi_epi8(b8, K_ZERO), _mm256_unpackhi_epi8(g8, K_ZERO), _mm256_unpackhi_epi8(r8, K_ZERO)));
+        }
+
+        template<class T> SIMD_INLINE __m256i BgrToV8(__m256i b8, __m256i g8, __m256i r8)
+        {
+            return _mm256_packus_epi16(
+                BgrToV16<T>(_mm256_unpacklo_epi8(b8, K_ZERO), _mm256_unpacklo_epi8(g8, K_ZERO), _mm256_unpacklo_epi8(r8, K_ZERO)),
+                BgrToV16<T>(_mm256_unpackhi_epi8(b8, K_ZERO), _mm256_unpackhi_epi8(g8, K_ZERO), _mm256_unpackhi_epi8(r8, K_ZERO)));
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        template<class T> SIMD_INLINE __m512i YuvToBgr32(__m512i y_1, __m512i uv, __m512i uvWeight)
+        {
+            const __m512i yWeight = SetInt16(T::Y_TO_RGB_WEIGHT, Base::YUV_TO_BGR_ROUND_TERM);
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y_1, yWeight), _mm512_madd_epi16(uv, uvWeight)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+        }
+
+        template<class T> SIMD_INLINE void YuvToBgr16(__m512i y16, __m512i u16, __m512i v16, __m512i & b16, __m512i & g16, __m512i & r16)
+        {
+            const __m512i ub = SetInt16(T::U_TO_BLUE_WEIGHT, 0);
+            const __m512i ugvg = SetInt16(T::U_TO_GREEN_WEIGHT, T::V_TO_GREEN_WEIGHT);
+            const __m512i vr = SetInt16(0, T::V_TO_RED_WEIGHT);
+            y16 = _mm512_sub_epi16(y16, _mm512_set1_epi16(T::Y_ADJUST));
+            u16 = _mm512_sub_epi16(u16, _mm512_set1_epi16(T::UV_ADJUST));
+            v16 = _mm512_sub_epi16(v16, _mm512_set1_epi16(T::UV_ADJUST));
+            __m512i y_1[2] = { _mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpackhi_epi16(y16, K16_0001) };
+            __m512i uv[2] = { _mm512_unpacklo_epi16(u16, v16), _mm512_unpackhi_epi16(u16, v16) };
+            b16 = _mm512_packs_epi32(YuvToBgr32<T>(y_1[0], uv[0], ub), YuvToBgr32<T>(y_1[1], uv[1], ub));
+            g16 = _mm512_packs_epi32(YuvToBgr32<T>(y_1[0], uv[0], ugvg), YuvToBgr32<T>(y_1[1], uv[1], ugvg));
+            r16 = _mm512_packs_epi32(YuvToBgr32<T>(y_1[0], uv[0], vr), YuvToBgr32<T>(y_1[1], uv[1], vr));
+        }
+
+        template<class T> SIMD_INLINE void YuvToBgr(__m512i y8, __m512i u8, __m512i v8, __m512i & b8, __m512i & g8, __m512i & r8)
+        {
+            __m512i b16[2], g16[2], r16[2];
+            YuvToBgr16<T>(_mm512_unpacklo_epi8(y8, K_ZERO), _mm512_unpacklo_epi8(u8, K_ZERO), _mm512_unpacklo_epi8(v8, K_ZERO), b16[0], g16[0], r16[0]);
+            YuvToBgr16<T>(_mm512_unpackhi_epi8(y8, K_ZERO), _mm512_unpackhi_epi8(u8, K_ZERO), _mm512_unpackhi_epi8(v8, K_ZERO), b16[1], g16[1], r16[1]);
+            b8 = _mm512_packus_epi16(b16[0], b16[1]);
+            g8 = _mm512_packus_epi16(g16[0], g16[1]);
+            r8 = _mm512_packus_epi16(r16[0], r16[1]);
+        }
+
+        SIMD_INLINE __m512i BgrToYuv16(__m512i b16, __m512i g16, __m512i r16, __m512i brWeight, __m512i gWeight, __m512i adjust)
+        {
+            __m512i lo = _mm512_add_epi32(_mm512_madd_epi16(_mm512_unpacklo_epi16(b16, r16), brWeight), _mm512_madd_epi16(_mm512_unpacklo_epi16(g16, K16_0001), gWeight));
+            __m512i hi = _mm512_add_epi32(_mm512_madd_epi16(_mm512_unpackhi_epi16(b16, r16), brWeight), _mm512_madd_epi16(_mm512_unpackhi_epi16(g16, K16_0001), gWeight));
+            return _mm512_add_epi16(_mm512_packs_epi32(_mm512_srai_epi32(lo, Base::BGR_TO_YUV_AVERAGING_SHIFT), _mm512_srai_epi32(hi, Base::BGR_TO_YUV_AVERAGING_SHIFT)), adjust);
+        }
+
+        template<class T> SIMD_INLINE __m512i BgrToY16(__m512i b16, __m512i g16, __m512i r16)
+        {
+            return BgrToYuv16(b16, g16, r16, SetInt16(T::BLUE_TO_Y_WEIGHT, T::RED_TO_Y_WEIGHT),
+                SetInt16(T::GREEN_TO_Y_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM), _mm512_set1_epi16(T::Y_ADJUST));
+        }
+
+        template<class T> SIMD_INLINE __m512i BgrToU16(__m512i b16, __m512i g16, __m512i r16)
+        {
+            return BgrToYuv16(b16, g16, r16, SetInt16(T::BLUE_TO_U_WEIGHT, T::RED_TO_U_WEIGHT),
+                SetInt16(T::GREEN_TO_U_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM), _mm512_set1_epi16(T::UV_ADJUST));
+        }
+
+        template<class T> SIMD_INLINE __m512i BgrToV16(__m512i b16, __m512i g16, __m512i r16)
+        {
+            return BgrToYuv16(b16, g16, r16, SetInt16(T::BLUE_TO_V_WEIGHT, T::RED_TO_V_WEIGHT),
+                SetInt16(T::GREEN_TO_V_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM), _mm512_set1_epi16(T::UV_ADJUST));
+        }
+
+        template<class T> SIMD_INLINE __m512i BgrToY8(__m512i b8, __m512i g8, __m512i r8)
+        {
+            return _mm512_packus_epi16(
+                BgrToY16<T>(_mm512_unpacklo_epi8(b8, K_ZERO), _mm512_unpacklo_epi8(g8, K_ZERO), _mm512_unpacklo_epi8(r8, K_ZERO)),
+                BgrToY16<T>(_mm512_unpackhi_epi8(b8, K_ZERO), _mm512_unpackhi_epi8(g8, K_ZERO), _mm512_unpackhi_epi8(r8, K_ZERO)));
+        }
+
+        template<class T> SIMD_INLINE __m512i BgrToU8(__m512i b8, __m512i g8, __m512i r8)
+        {
+            return _mm512_packus_epi16(
+                BgrToU16<T>(_mm512_unpacklo_epi8(b8, K_ZERO), _mm512_unpacklo_epi8(g8, K_ZERO), _mm512_unpacklo_epi8(r8, K_ZERO)),
+                BgrToU16<T>(_mm512_unpackhi_epi8(b8, K_ZERO), _mm512_unpackhi_epi8(g8, K_ZERO), _mm512_unpackhi_epi8(r8, K_ZERO)));
+        }
+
+        template<class T> SIMD_INLINE __m512i BgrToV8(__m512i b8, __m512i g8, __m512i r8)
+        {
+            return _mm512_packus_epi16(
+                BgrToV16<T>(_mm512_unpacklo_epi8(b8, K_ZERO), _mm512_unpacklo_epi8(g8, K_ZERO), _mm512_unpacklo_epi8(r8, K_ZERO)),
+                BgrToV16<T>(_mm512_unpackhi_epi8(b8, K_ZERO), _mm512_unpackhi_epi8(g8, K_ZERO), _mm512_unpackhi_epi8(r8, K_ZERO)));
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
+
+#endif//__SimdYuvToBgr_h__
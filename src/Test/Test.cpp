@@ -98,10 +98,18 @@ namespace Test
     TEST_ADD_GROUP_A00(BgraToRgb);
     TEST_ADD_GROUP_AD0(BgrToGray);
     TEST_ADD_GROUP_AD0(BgrToHsl);
+    TEST_ADD_GROUP_A00(BgrToHsl32f);
     TEST_ADD_GROUP_AD0(BgrToHsv);
+    TEST_ADD_GROUP_A00(BgrToHsv32f);
+    TEST_ADD_GROUP_A00(BgrToLab);
+    TEST_ADD_GROUP_A00(BgrToLab32f);
     TEST_ADD_GROUP_A00(BgrToRgb);
     TEST_ADD_GROUP_AD0(GrayToBgr);
+    TEST_ADD_GROUP_A00(HslToBgr);
+    TEST_ADD_GROUP_A00(HsvToBgr);
     TEST_ADD_GROUP_AD0(Int16ToGray);
+    TEST_ADD_GROUP_A00(LabToBgr);
+    TEST_ADD_GROUP_A00(Uint16ToGray);
     TEST_ADD_GROUP_A00(RgbToGray);
 
     TEST_ADD_GROUP_AD0(BgraToBayer);
@@ -117,6 +125,14 @@ namespace Test
     TEST_ADD_GROUP_AD0(BgrToYuv420p);
     TEST_ADD_GROUP_AD0(BgrToYuv422p);
     TEST_ADD_GROUP_AD0(BgrToYuv444p);
+    TEST_ADD_GROUP_A00(BgraToYuv420pV2);
+    TEST_ADD_GROUP_A00(BgraToYuv422pV2);
+    TEST_ADD_GROUP_A00(BgraToYuv444pV2);
+    TEST_ADD_GROUP_A00(BgrToYuv420pV2);
+    TEST_ADD_GROUP_A00(BgrToYuv422pV2);
+    TEST_ADD_GROUP_A00(BgrToYuv444pV2);
+    TEST_ADD_GROUP_A00(BgraToNv12);
+    TEST_ADD_GROUP_A00(BgrToNv12);
     TEST_ADD_GROUP_A00(BgraToYuva420p);
 
     TEST_ADD_GROUP_AD0(BackgroundGrowRangeSlow);
@@ -203,6 +219,7 @@ namespace Test
 
     TEST_ADD_GROUP_AD0(Float32ToUint8);
     TEST_ADD_GROUP_AD0(Uint8ToFloat32);
+    TEST_ADD_GROUP_A00(Uint16ToFloat32);
 
     TEST_ADD_GROUP_A00(Gemm32fNN);
     TEST_ADD_GROUP_A00(Gemm32fNT);
@@ -230,6 +247,8 @@ namespace Test
     TEST_ADD_GROUP_AD0(HistogramConditional);
     TEST_ADD_GROUP_AD0(AbsSecondDerivativeHistogram);
     TEST_ADD_GROUP_AD0(ChangeColors);
+    TEST_ADD_GROUP_A00(Lut3d);
+    TEST_ADD_GROUP_A00(ColorMatrix);
 
     TEST_ADD_GROUP_AD0(HogDirectionHistograms);
     TEST_ADD_GROUP_AD0(HogExtractFeatures);
@@ -296,6 +315,15 @@ namespace Test
     TEST_ADD_GROUP_AD0(OperationBinary16i);
     TEST_ADD_GROUP_AD0(VectorProduct);
 
+    TEST_ADD_GROUP_A00(Parallel);
+    TEST_ADD_GROUP_A00(Dispatch);
+    TEST_ADD_GROUP_A00(MaxIsa);
+    TEST_ADD_GROUP_A00(RuntimeCache);
+    TEST_ADD_GROUP_A00(Trace);
+    TEST_ADD_GROUP_A00(PerformanceStatistic);
+    TEST_ADD_GROUP_A00(SynetWorkspace);
+    TEST_ADD_GROUP_A00(Allocate);
+
     TEST_ADD_GROUP_AD0(ReduceColor2x2);
     TEST_ADD_GROUP_AD0(ReduceGray2x2);
     TEST_ADD_GROUP_AD0(ReduceGray3x3);
@@ -308,6 +336,7 @@ namespace Test
 
     TEST_ADD_GROUP_ADS(ResizeBilinear);
     TEST_ADD_GROUP_A00(Resizer);
+    TEST_ADD_GROUP_A00(ResizerRunRows);
 
     TEST_ADD_GROUP_AD0(SegmentationShrinkRegion);
     TEST_ADD_GROUP_AD0(SegmentationFillSingleHoles);
@@ -360,6 +389,7 @@ namespace Test
     TEST_ADD_GROUP_A00(SynetConvert32fTo8u);
     TEST_ADD_GROUP_A00(SynetConvert8uTo32f);
     TEST_ADD_GROUP_A00(SynetSetInput);
+    TEST_ADD_GROUP_A00(SynetSetInputBatch);
     TEST_ADD_GROUP_A00(SynetReorderImage);
     TEST_ADD_GROUP_A00(SynetReorderFilter);
 
@@ -395,6 +425,8 @@ namespace Test
 
     TEST_ADD_GROUP_A00(TransformImage);
 
+    TEST_ADD_GROUP_A00(WarpAffine);
+
     TEST_ADD_GROUP_A00(WinogradKernel1x3Block1x4SetFilter);
     TEST_ADD_GROUP_A00(WinogradKernel1x3Block1x4SetInput);
     TEST_ADD_GROUP_A00(WinogradKernel1x3Block1x4SetOutput);
@@ -428,6 +460,9 @@ namespace Test
     TEST_ADD_GROUP_AD0(Yuv444pToBgr);
     TEST_ADD_GROUP_AD0(Yuv422pToBgr);
     TEST_ADD_GROUP_AD0(Yuv420pToBgr);
+    TEST_ADD_GROUP_A00(Yuv444pToBgrV2);
+    TEST_ADD_GROUP_A00(Yuv422pToBgrV2);
+    TEST_ADD_GROUP_A00(Yuv420pToBgrV2);
     TEST_ADD_GROUP_AD0(Yuv444pToHsl);
     TEST_ADD_GROUP_AD0(Yuv444pToHsv);
     TEST_ADD_GROUP_AD0(Yuv444pToHue);
@@ -435,11 +470,42 @@ namespace Test
     TEST_ADD_GROUP_A00(Yuv444pToRgb);
     TEST_ADD_GROUP_A00(Yuv422pToRgb);
     TEST_ADD_GROUP_A00(Yuv420pToRgb);
+    TEST_ADD_GROUP_A00(Yuv444pToRgbV2);
+    TEST_ADD_GROUP_A00(Yuv422pToRgbV2);
+    TEST_ADD_GROUP_A00(Yuv420pToRgbV2);
 
     TEST_ADD_GROUP_A00(Yuva420pToBgra);
     TEST_ADD_GROUP_AD0(Yuv444pToBgra);
     TEST_ADD_GROUP_AD0(Yuv422pToBgra);
     TEST_ADD_GROUP_AD0(Yuv420pToBgra);
+    TEST_ADD_GROUP_A00(Yuv444pToBgraV2);
+    TEST_ADD_GROUP_A00(Yuv422pToBgraV2);
+    TEST_ADD_GROUP_A00(Yuv420pToBgraV2);
+
+    TEST_ADD_GROUP_A00(Nv12ToBgra);
+    TEST_ADD_GROUP_A00(Nv12ToBgr);
+    TEST_ADD_GROUP_A00(Nv12ToRgb);
+    TEST_ADD_GROUP_A00(Nv21ToBgra);
+    TEST_ADD_GROUP_A00(Nv21ToBgr);
+    TEST_ADD_GROUP_A00(Nv21ToRgb);
+    TEST_ADD_GROUP_A00(YuyvToBgra);
+    TEST_ADD_GROUP_A00(YuyvToBgr);
+    TEST_ADD_GROUP_A00(YuyvToRgb);
+    TEST_ADD_GROUP_A00(YuyvToGray);
+    TEST_ADD_GROUP_A00(YuyvToNv12);
+    TEST_ADD_GROUP_A00(YuyvToYuv420p);
+    TEST_ADD_GROUP_A00(UyvyToBgra);
+    TEST_ADD_GROUP_A00(UyvyToBgr);
+    TEST_ADD_GROUP_A00(UyvyToRgb);
+    TEST_ADD_GROUP_A00(UyvyToGray);
+    TEST_ADD_GROUP_A00(UyvyToNv12);
+    TEST_ADD_GROUP_A00(UyvyToYuv420p);
+
+    TEST_ADD_GROUP_A00(Yuv420p16ToBgra);
+    TEST_ADD_GROUP_A00(P016ToBgra);
+
+    TEST_ADD_GROUP_A00(FrameConvert);
+    TEST_ADD_GROUP_A00(FrameSynetSetInput);
 
     class Task
     {
@@ -512,17 +578,23 @@ namespace Test
 
         Strings include, exclude;
 
-        String text, html;
+        String text, html, json, baseline;
+
+        double threshold;
 
         size_t testThreads, workThreads;
 
+        SimdIsaType maxIsa;
+
         bool printAlign;
 
         Options(int argc, char* argv[])
             : mode(Auto)
             , help(false)
+            , threshold(0.1)
             , testThreads(0)
             , workThreads(1)
+            , maxIsa(SimdIsaAvx512vnni)
             , printAlign(false)
         {
             for (int i = 1; i < argc; ++i)
@@ -568,6 +640,26 @@ namespace Test
                 {
                     html = arg.substr(4, arg.size() - 4);
                 }
+                else if (arg.find("-oj=") == 0)
+                {
+                    json = arg.substr(4, arg.size() - 4);
+                }
+                else if (arg.find("-bl=") == 0)
+                {
+                    baseline = arg.substr(4, arg.size() - 4);
+                }
+                else if (arg.find("-rt=") == 0)
+                {
+                    threshold = FromString<double>(arg.substr(4, arg.size() - 4)) * 0.01;
+                }
+                else if (arg.find("-bb=") == 0)
+                {
+                    BENCHMARK_BATCHES = FromString<int>(arg.substr(4, arg.size() - 4));
+                }
+                else if (arg.find("-bw=") == 0)
+                {
+                    BENCHMARK_WARMUP = FromString<int>(arg.substr(4, arg.size() - 4));
+                }
                 else if (arg.find("-r=") == 0)
                 {
                     ROOT_PATH = arg.substr(3, arg.size() - 3);
@@ -600,6 +692,19 @@ namespace Test
                 {
                     workThreads = FromString<size_t>(arg.substr(4, arg.size() - 4));
                 }
+                else if (arg.find("-mi=") == 0)
+                {
+                    String name = arg.substr(4, arg.size() - 4);
+                    int isa = SimdIsaBase;
+                    while (isa <= SimdIsaSse2 && ToString((SimdIsaType)isa) != name)
+                        isa++;
+                    if (isa > SimdIsaSse2)
+                    {
+                        TEST_LOG_SS(Error, "Unknown instruction set level: '" << arg << "'!" << std::endl);
+                        exit(1);
+                    }
+                    maxIsa = (SimdIsaType)isa;
+                }
                 else if (arg.find("-mt=") == 0)
                 {
                     MINIMAL_TEST_EXECUTION_TIME = FromString<int>(arg.substr(4, arg.size() - 4))*0.001;
@@ -684,6 +789,19 @@ namespace Test
         TEST_LOG_SS(Info, Test::PerformanceMeasurerStorage::s_storage.TextReport(options.printAlign, false) << SimdPerformanceStatistic());
         if (!options.html.empty())
             Test::PerformanceMeasurerStorage::s_storage.HtmlReport(options.html, options.printAlign);
+        if (!options.json.empty() && !Test::PerformanceMeasurerStorage::s_storage.JsonReport(options.json))
+            TEST_LOG_SS(Error, "Can't write performance report to '" << options.json << "'!");
+        if (!options.baseline.empty())
+        {
+            size_t regressions = 0;
+            if (!Test::PerformanceMeasurerStorage::s_storage.CompareWithBaseline(options.baseline, options.threshold, regressions))
+                return 1;
+            if (regressions)
+            {
+                TEST_LOG_SS(Error, "PERFORMANCE REGRESSIONS ARE FOUND!" << std::endl);
+                return 1;
+            }
+        }
 #endif
         return 0;
     }
@@ -761,9 +879,20 @@ namespace Test
         std::cout << "    -s=sample.avi a video source (Simd::Motion test)." << std::endl << std::endl;
         std::cout << "    -o=output.avi an annotated video output (Simd::Motion test)." << std::endl << std::endl;
         std::cout << "    -wt=1         a thread number used to parallelize algorithms." << std::endl << std::endl;
+        std::cout << "    -mi=Avx2      a maximal instruction set level used by the library" << std::endl;
+        std::cout << "                  (Base, Vmx, Vsx, Neon, Sse2, Sse41, Avx2, Avx512bw, Avx512vnni)." << std::endl << std::endl;
         std::cout << "    -fe=Abs       an exclude filter to exclude some tests." << std::endl << std::endl;
         std::cout << "    -mt=100       a minimal test execution time (in milliseconds)." << std::endl << std::endl;
         std::cout << "    -lc=1         to litter CPU cache between test runs." << std::endl << std::endl;
+        std::cout << "    -bb=10        a benchmark mode: a number of batches with fixed number of" << std::endl;
+        std::cout << "                  iterations in every performance test. Report contains" << std::endl;
+        std::cout << "                  median time and its 95% confidence interval." << std::endl << std::endl;
+        std::cout << "    -bw=3         a number of warm-up iterations in benchmark mode." << std::endl << std::endl;
+        std::cout << "    -oj=perf.json a file name with performance report (in JSON format)." << std::endl << std::endl;
+        std::cout << "    -bl=base.json a performance baseline (JSON report of previous run)." << std::endl;
+        std::cout << "                  Test fails if some function is slower than in the baseline." << std::endl << std::endl;
+        std::cout << "    -rt=10        a regression threshold (in percents) for comparison" << std::endl;
+        std::cout << "                  with performance baseline." << std::endl << std::endl;
         return 0;
     }
 
@@ -782,6 +911,8 @@ namespace Test
 #endif
     double MINIMAL_TEST_EXECUTION_TIME = 0.1;
     int LITTER_CPU_CACHE = 0;
+    int BENCHMARK_BATCHES = 0;
+    int BENCHMARK_WARMUP = 3;
 
     void CheckCpp();
 }
@@ -819,6 +950,7 @@ int main(int argc, char* argv[])
     }
 
     ::SimdSetThreadNumber(options.workThreads);
+    ::SimdSetMaxIsa(options.maxIsa);
 
     switch (options.mode)
     {
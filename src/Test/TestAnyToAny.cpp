@@ -68,7 +68,7 @@ namespace Test
 
 #define FUNC_N(func) FuncN(func, #func)
 
-    template<class Func> bool AnyToAnyAutoTest(int width, int height, View::Format srcType, View::Format dstType, const Func & f1, const Func & f2)
+    template<class Func> bool AnyToAnyAutoTest(int width, int height, View::Format srcType, View::Format dstType, const Func & f1, const Func & f2, int differenceMax = 0)
     {
         bool result = true;
 
@@ -85,17 +85,68 @@ namespace Test
 
         TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2));
 
-        result = result && Compare(dst1, dst2, 0, true, 64);
+        result = result && Compare(dst1, dst2, differenceMax, true, 64);
 
         return result;
     }
 
-    template<class Func> bool AnyToAnyAutoTest(View::Format srcType, View::Format dstType, const Func & f1, const Func & f2)
+    template<class Func> bool AnyToAnyAutoTest(View::Format srcType, View::Format dstType, const Func & f1, const Func & f2, int differenceMax = 0)
     {
         bool result = true;
 
-        result = result && AnyToAnyAutoTest(W, H, srcType, dstType, f1, f2);
-        result = result && AnyToAnyAutoTest(W + O, H - O, srcType, dstType, f1, f2);
+        result = result && AnyToAnyAutoTest(W, H, srcType, dstType, f1, f2, differenceMax);
+        result = result && AnyToAnyAutoTest(W + O, H - O, srcType, dstType, f1, f2, differenceMax);
+
+        return result;
+    }
+
+    namespace
+    {
+        struct Func32f
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t width, size_t height, size_t srcStride, float * dst, size_t dstStride);
+            FuncPtr func;
+            String description;
+
+            Func32f(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.width, src.height, src.stride, (float*)dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_32F(func) Func32f(func, #func)
+
+    bool AnyTo32fAutoTest(int width, int height, View::Format srcType, const Func32f & f1, const Func32f & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "].");
+
+        View src(width, height, srcType, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View dst1(width * View::ChannelCount(srcType), height, View::Float, NULL, TEST_ALIGN(width));
+        View dst2(width * View::ChannelCount(srcType), height, View::Float, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool AnyTo32fAutoTest(View::Format srcType, const Func32f & f1, const Func32f & f2)
+    {
+        bool result = true;
+
+        result = result && AnyTo32fAutoTest(W, H, srcType, f1, f2);
+        result = result && AnyTo32fAutoTest(W + O, H - O, srcType, f1, f2);
 
         return result;
     }
@@ -105,6 +156,10 @@ namespace Test
         bool result = true;
 
         result = result && AnyToAnyAutoTest(View::Bgra32, View::Bgr24, FUNC_O(Simd::Base::BgraToBgr), FUNC_O(SimdBgraToBgr));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToAnyAutoTest(View::Bgra32, View::Bgr24, FUNC_O(Simd::Base::BgraToBgr), TEST_MT_FUNC(FuncO, SimdBgraToBgr));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable && W >= Simd::Ssse3::A)
@@ -139,6 +194,10 @@ namespace Test
         bool result = true;
 
         result = result && AnyToAnyAutoTest(View::Bgra32, View::Gray8, FUNC_O(Simd::Base::BgraToGray), FUNC_O(SimdBgraToGray));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToAnyAutoTest(View::Bgra32, View::Gray8, FUNC_O(Simd::Base::BgraToGray), TEST_MT_FUNC(FuncO, SimdBgraToGray));
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable && W >= Simd::Sse2::A)
@@ -173,6 +232,10 @@ namespace Test
         bool result = true;
 
         result = result && AnyToAnyAutoTest(View::Bgra32, View::Bgr24, FUNC_O(Simd::Base::BgraToRgb), FUNC_O(SimdBgraToRgb));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToAnyAutoTest(View::Bgra32, View::Bgr24, FUNC_O(Simd::Base::BgraToRgb), TEST_MT_FUNC(FuncO, SimdBgraToRgb));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable && W >= Simd::Ssse3::A)
@@ -202,6 +265,10 @@ namespace Test
         bool result = true;
 
         result = result && AnyToAnyAutoTest(View::Bgr24, View::Gray8, FUNC_O(Simd::Base::BgrToGray), FUNC_O(SimdBgrToGray));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Gray8, FUNC_O(Simd::Base::BgrToGray), TEST_MT_FUNC(FuncO, SimdBgrToGray));
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable && W >= Simd::Sse2::A)
@@ -241,6 +308,25 @@ namespace Test
         bool result = true;
 
         result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC_O(Simd::Base::BgrToHsl), FUNC_O(SimdBgrToHsl));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC_O(Simd::Base::BgrToHsl), TEST_MT_FUNC(FuncO, SimdBgrToHsl));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::F)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC_O(Simd::Sse41::BgrToHsl), FUNC_O(SimdBgrToHsl));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::F)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC_O(Simd::Avx2::BgrToHsl), FUNC_O(SimdBgrToHsl));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC_O(Simd::Avx512bw::BgrToHsl), FUNC_O(SimdBgrToHsl));
+#endif 
 
         return result;
     }
@@ -250,6 +336,137 @@ namespace Test
         bool result = true;
 
         result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsv24, FUNC_O(Simd::Base::BgrToHsv), FUNC_O(SimdBgrToHsv));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsv24, FUNC_O(Simd::Base::BgrToHsv), TEST_MT_FUNC(FuncO, SimdBgrToHsv));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::F)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsv24, FUNC_O(Simd::Sse41::BgrToHsv), FUNC_O(SimdBgrToHsv));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::F)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsv24, FUNC_O(Simd::Avx2::BgrToHsv), FUNC_O(SimdBgrToHsv));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsv24, FUNC_O(Simd::Avx512bw::BgrToHsv), FUNC_O(SimdBgrToHsv));
+#endif 
+
+        return result;
+    }
+
+    bool BgrToLabAutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToAnyAutoTest(View::Bgr24, View::Lab24, FUNC_O(Simd::Base::BgrToLab), FUNC_O(SimdBgrToLab), 1);
+        {
+            MultithreadedScope scope;
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Lab24, FUNC_O(Simd::Base::BgrToLab), TEST_MT_FUNC(FuncO, SimdBgrToLab), 1);
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::F)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Lab24, FUNC_O(Simd::Sse41::BgrToLab), FUNC_O(SimdBgrToLab), 1);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::F)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Lab24, FUNC_O(Simd::Avx2::BgrToLab), FUNC_O(SimdBgrToLab), 1);
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Lab24, FUNC_O(Simd::Avx512bw::BgrToLab), FUNC_O(SimdBgrToLab), 1);
+#endif 
+
+        return result;
+    }
+
+    bool BgrToHsl32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyTo32fAutoTest(View::Bgr24, FUNC_32F(Simd::Base::BgrToHsl32f), FUNC_32F(SimdBgrToHsl32f));
+        {
+            MultithreadedScope scope;
+            result = result && AnyTo32fAutoTest(View::Bgr24, FUNC_32F(Simd::Base::BgrToHsl32f), TEST_MT_FUNC(Func32f, SimdBgrToHsl32f));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::F)
+            result = result && AnyTo32fAutoTest(View::Bgr24, FUNC_32F(Simd::Sse41::BgrToHsl32f), FUNC_32F(SimdBgrToHsl32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::F)
+            result = result && AnyTo32fAutoTest(View::Bgr24, FUNC_32F(Simd::Avx2::BgrToHsl32f), FUNC_32F(SimdBgrToHsl32f));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyTo32fAutoTest(View::Bgr24, FUNC_32F(Simd::Avx512bw::BgrToHsl32f), FUNC_32F(SimdBgrToHsl32f));
+#endif 
+
+        return result;
+    }
+
+    bool BgrToHsv32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyTo32fAutoTest(View::Bgr24, FUNC_32F(Simd::Base::BgrToHsv32f), FUNC_32F(SimdBgrToHsv32f));
+        {
+            MultithreadedScope scope;
+            result = result && AnyTo32fAutoTest(View::Bgr24, FUNC_32F(Simd::Base::BgrToHsv32f), TEST_MT_FUNC(Func32f, SimdBgrToHsv32f));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::F)
+            result = result && AnyTo32fAutoTest(View::Bgr24, FUNC_32F(Simd::Sse41::BgrToHsv32f), FUNC_32F(SimdBgrToHsv32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::F)
+            result = result && AnyTo32fAutoTest(View::Bgr24, FUNC_32F(Simd::Avx2::BgrToHsv32f), FUNC_32F(SimdBgrToHsv32f));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyTo32fAutoTest(View::Bgr24, FUNC_32F(Simd::Avx512bw::BgrToHsv32f), FUNC_32F(SimdBgrToHsv32f));
+#endif 
+
+        return result;
+    }
+
+    bool BgrToLab32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyTo32fAutoTest(View::Bgr24, FUNC_32F(Simd::Base::BgrToLab32f), FUNC_32F(SimdBgrToLab32f));
+        {
+            MultithreadedScope scope;
+            result = result && AnyTo32fAutoTest(View::Bgr24, FUNC_32F(Simd::Base::BgrToLab32f), TEST_MT_FUNC(Func32f, SimdBgrToLab32f));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::F)
+            result = result && AnyTo32fAutoTest(View::Bgr24, FUNC_32F(Simd::Sse41::BgrToLab32f), FUNC_32F(SimdBgrToLab32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::F)
+            result = result && AnyTo32fAutoTest(View::Bgr24, FUNC_32F(Simd::Avx2::BgrToLab32f), FUNC_32F(SimdBgrToLab32f));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyTo32fAutoTest(View::Bgr24, FUNC_32F(Simd::Avx512bw::BgrToLab32f), FUNC_32F(SimdBgrToLab32f));
+#endif 
 
         return result;
     }
@@ -259,6 +476,10 @@ namespace Test
         bool result = true;
 
         result = result && AnyToAnyAutoTest(View::Bgr24, View::Rgb24, FUNC_N(Simd::Base::BgrToRgb), FUNC_N(SimdBgrToRgb));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Rgb24, FUNC_N(Simd::Base::BgrToRgb), TEST_MT_FUNC(FuncN, SimdBgrToRgb));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable && W >= Simd::Ssse3::A)
@@ -288,6 +509,10 @@ namespace Test
         bool result = true;
 
         result = result && AnyToAnyAutoTest(View::Gray8, View::Bgr24, FUNC_O(Simd::Base::GrayToBgr), FUNC_O(SimdGrayToBgr));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToAnyAutoTest(View::Gray8, View::Bgr24, FUNC_O(Simd::Base::GrayToBgr), TEST_MT_FUNC(FuncO, SimdGrayToBgr));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable && W >= Simd::Ssse3::A)
@@ -317,11 +542,71 @@ namespace Test
         return result;
     }
 
+    bool HslToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToAnyAutoTest(View::Hsl24, View::Bgr24, FUNC_O(Simd::Base::HslToBgr), FUNC_O(SimdHslToBgr));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToAnyAutoTest(View::Hsl24, View::Bgr24, FUNC_O(Simd::Base::HslToBgr), TEST_MT_FUNC(FuncO, SimdHslToBgr));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::F)
+            result = result && AnyToAnyAutoTest(View::Hsl24, View::Bgr24, FUNC_O(Simd::Sse41::HslToBgr), FUNC_O(SimdHslToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::F)
+            result = result && AnyToAnyAutoTest(View::Hsl24, View::Bgr24, FUNC_O(Simd::Avx2::HslToBgr), FUNC_O(SimdHslToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToAnyAutoTest(View::Hsl24, View::Bgr24, FUNC_O(Simd::Avx512bw::HslToBgr), FUNC_O(SimdHslToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool HsvToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToAnyAutoTest(View::Hsv24, View::Bgr24, FUNC_O(Simd::Base::HsvToBgr), FUNC_O(SimdHsvToBgr));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToAnyAutoTest(View::Hsv24, View::Bgr24, FUNC_O(Simd::Base::HsvToBgr), TEST_MT_FUNC(FuncO, SimdHsvToBgr));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::F)
+            result = result && AnyToAnyAutoTest(View::Hsv24, View::Bgr24, FUNC_O(Simd::Sse41::HsvToBgr), FUNC_O(SimdHsvToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::F)
+            result = result && AnyToAnyAutoTest(View::Hsv24, View::Bgr24, FUNC_O(Simd::Avx2::HsvToBgr), FUNC_O(SimdHsvToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToAnyAutoTest(View::Hsv24, View::Bgr24, FUNC_O(Simd::Avx512bw::HsvToBgr), FUNC_O(SimdHsvToBgr));
+#endif 
+
+        return result;
+    }
+
     bool Int16ToGrayAutoTest()
     {
         bool result = true;
 
         result = result && AnyToAnyAutoTest(View::Int16, View::Gray8, FUNC_O(Simd::Base::Int16ToGray), FUNC_O(SimdInt16ToGray));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToAnyAutoTest(View::Int16, View::Gray8, FUNC_O(Simd::Base::Int16ToGray), TEST_MT_FUNC(FuncO, SimdInt16ToGray));
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable && W >= Simd::Sse2::A)
@@ -346,11 +631,123 @@ namespace Test
         return result;
     }
 
+    bool LabToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToAnyAutoTest(View::Lab24, View::Bgr24, FUNC_O(Simd::Base::LabToBgr), FUNC_O(SimdLabToBgr), 1);
+        {
+            MultithreadedScope scope;
+            result = result && AnyToAnyAutoTest(View::Lab24, View::Bgr24, FUNC_O(Simd::Base::LabToBgr), TEST_MT_FUNC(FuncO, SimdLabToBgr), 1);
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::F)
+            result = result && AnyToAnyAutoTest(View::Lab24, View::Bgr24, FUNC_O(Simd::Sse41::LabToBgr), FUNC_O(SimdLabToBgr), 1);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::F)
+            result = result && AnyToAnyAutoTest(View::Lab24, View::Bgr24, FUNC_O(Simd::Avx2::LabToBgr), FUNC_O(SimdLabToBgr), 1);
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToAnyAutoTest(View::Lab24, View::Bgr24, FUNC_O(Simd::Avx512bw::LabToBgr), FUNC_O(SimdLabToBgr), 1);
+#endif 
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncU
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t width, size_t height, size_t srcStride, int shift, uint8_t * dst, size_t dstStride);
+            FuncPtr func;
+            String description;
+
+            FuncU(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, View & dst, int shift) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.width, src.height, src.stride, shift, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_U(func) FuncU(func, #func)
+
+    bool Uint16ToGrayAutoTest(int width, int height, int shift, const FuncU & f1, const FuncU & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "] and shift " << shift << ".");
+
+        View src(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View dst1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, shift));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, shift));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool Uint16ToGrayAutoTest(const FuncU & f1, const FuncU & f2)
+    {
+        bool result = true;
+
+        result = result && Uint16ToGrayAutoTest(W, H, 8, f1, f2);
+        result = result && Uint16ToGrayAutoTest(W + O, H - O, 2, f1, f2);
+        result = result && Uint16ToGrayAutoTest(W - O, H + O, 0, f1, f2);
+
+        return result;
+    }
+
+    bool Uint16ToGrayAutoTest()
+    {
+        bool result = true;
+
+        result = result && Uint16ToGrayAutoTest(FUNC_U(Simd::Base::Uint16ToGray), FUNC_U(SimdUint16ToGray));
+        {
+            MultithreadedScope scope;
+            result = result && Uint16ToGrayAutoTest(FUNC_U(Simd::Base::Uint16ToGray), TEST_MT_FUNC(FuncU, SimdUint16ToGray));
+        }
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::A)
+            result = result && Uint16ToGrayAutoTest(FUNC_U(Simd::Sse2::Uint16ToGray), FUNC_U(SimdUint16ToGray));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && Uint16ToGrayAutoTest(FUNC_U(Simd::Avx2::Uint16ToGray), FUNC_U(SimdUint16ToGray));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Uint16ToGrayAutoTest(FUNC_U(Simd::Avx512bw::Uint16ToGray), FUNC_U(SimdUint16ToGray));
+#endif 
+
+        return result;
+    }
+
     bool RgbToGrayAutoTest()
     {
         bool result = true;
 
         result = result && AnyToAnyAutoTest(View::Rgb24, View::Gray8, FUNC_O(Simd::Base::RgbToGray), FUNC_O(SimdRgbToGray));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToAnyAutoTest(View::Rgb24, View::Gray8, FUNC_O(Simd::Base::RgbToGray), TEST_MT_FUNC(FuncO, SimdRgbToGray));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable && W >= Simd::Ssse3::A)
@@ -85,6 +85,10 @@ namespace Test
         bool result = true;
 
         result = result && AnyToBgraAutoTest(View::Bgr24, FUNC(Simd::Base::BgrToBgra), FUNC(SimdBgrToBgra));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToBgraAutoTest(View::Bgr24, FUNC(Simd::Base::BgrToBgra), TEST_MT_FUNC(Func, SimdBgrToBgra));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable && W >= Simd::Ssse3::A)
@@ -119,6 +123,10 @@ namespace Test
         bool result = true;
 
         result = result && AnyToBgraAutoTest(View::Gray8, FUNC(Simd::Base::GrayToBgra), FUNC(SimdGrayToBgra));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToBgraAutoTest(View::Gray8, FUNC(Simd::Base::GrayToBgra), TEST_MT_FUNC(Func, SimdGrayToBgra));
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable && W >= Simd::Sse2::A)
@@ -153,6 +161,10 @@ namespace Test
         bool result = true;
 
         result = result && AnyToBgraAutoTest(View::Rgb24, FUNC(Simd::Base::RgbToBgra), FUNC(SimdRgbToBgra));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToBgraAutoTest(View::Rgb24, FUNC(Simd::Base::RgbToBgra), TEST_MT_FUNC(Func, SimdRgbToBgra));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable && W >= Simd::Ssse3::A)
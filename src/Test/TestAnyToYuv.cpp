@@ -95,6 +95,10 @@ namespace Test
         bool result = true;
 
         result = result && AnyToYuvAutoTest(View::Bgra32, 2, 2, FUNC_YUV(Simd::Base::BgraToYuv420p), FUNC_YUV(SimdBgraToYuv420p));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToYuvAutoTest(View::Bgra32, 2, 2, FUNC_YUV(Simd::Base::BgraToYuv420p), TEST_MT_FUNC(FuncYuv, SimdBgraToYuv420p));
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
@@ -134,6 +138,10 @@ namespace Test
         bool result = true;
 
         result = result && AnyToYuvAutoTest(View::Bgra32, 2, 1, FUNC_YUV(Simd::Base::BgraToYuv422p), FUNC_YUV(SimdBgraToYuv422p));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToYuvAutoTest(View::Bgra32, 2, 1, FUNC_YUV(Simd::Base::BgraToYuv422p), TEST_MT_FUNC(FuncYuv, SimdBgraToYuv422p));
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
@@ -173,6 +181,10 @@ namespace Test
         bool result = true;
 
         result = result && AnyToYuvAutoTest(View::Bgra32, 1, 1, FUNC_YUV(Simd::Base::BgraToYuv444p), FUNC_YUV(SimdBgraToYuv444p));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToYuvAutoTest(View::Bgra32, 1, 1, FUNC_YUV(Simd::Base::BgraToYuv444p), TEST_MT_FUNC(FuncYuv, SimdBgraToYuv444p));
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable && W >= Simd::Sse2::A)
@@ -207,6 +219,10 @@ namespace Test
         bool result = true;
 
         result = result && AnyToYuvAutoTest(View::Bgr24, 2, 2, FUNC_YUV(Simd::Base::BgrToYuv420p), FUNC_YUV(SimdBgrToYuv420p));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToYuvAutoTest(View::Bgr24, 2, 2, FUNC_YUV(Simd::Base::BgrToYuv420p), TEST_MT_FUNC(FuncYuv, SimdBgrToYuv420p));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
@@ -241,6 +257,10 @@ namespace Test
         bool result = true;
 
         result = result && AnyToYuvAutoTest(View::Bgr24, 2, 1, FUNC_YUV(Simd::Base::BgrToYuv422p), FUNC_YUV(SimdBgrToYuv422p));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToYuvAutoTest(View::Bgr24, 2, 1, FUNC_YUV(Simd::Base::BgrToYuv422p), TEST_MT_FUNC(FuncYuv, SimdBgrToYuv422p));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
@@ -275,6 +295,10 @@ namespace Test
         bool result = true;
 
         result = result && AnyToYuvAutoTest(View::Bgr24, 1, 1, FUNC_YUV(Simd::Base::BgrToYuv444p), FUNC_YUV(SimdBgrToYuv444p));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToYuvAutoTest(View::Bgr24, 1, 1, FUNC_YUV(Simd::Base::BgrToYuv444p), TEST_MT_FUNC(FuncYuv, SimdBgrToYuv444p));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable && W >= Simd::Ssse3::A)
@@ -374,6 +398,10 @@ namespace Test
         bool result = true;
 
         result = result && BgraToYuvaAutoTest(FUNC_YUVA(Simd::Base::BgraToYuva420p), FUNC_YUVA(SimdBgraToYuva420p));
+        {
+            MultithreadedScope scope;
+            result = result && BgraToYuvaAutoTest(FUNC_YUVA(Simd::Base::BgraToYuva420p), TEST_MT_FUNC(FuncYuva, SimdBgraToYuva420p));
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
@@ -403,6 +431,249 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncYuvV2
+        {
+            typedef void(*FuncPtr)(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+                uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+            SimdYuvType yuvType;
+
+            FuncYuvV2(const FuncPtr & f, const String & d, SimdYuvType t = SimdYuvBt601) : func(f), description(d), yuvType(t) {}
+
+            void Update(SimdYuvType t)
+            {
+                yuvType = t;
+                description = description + "[" + ToString(t) + "]";
+            }
+
+            void Call(const View & bgr, View & y, View & u, View & v) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
+            }
+        };
+    }
+
+#define FUNC_YUV_V2(function) FuncYuvV2(function, #function)
+
+    bool AnyToYuvV2AutoTest(int width, int height, View::Format srcType, int dx, int dy, FuncYuvV2 f1, FuncYuvV2 f2, SimdYuvType yuvType)
+    {
+        bool result = true;
+
+        f1.Update(yuvType);
+        f2.Update(yuvType);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        const int uvWidth = width / dx;
+        const int uvHeight = height / dy;
+
+        View src(width, height, srcType, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View y1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View u1(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+        View v1(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+
+        View y2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View u2(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+        View v2(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, y1, u1, v1));
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, y2, u2, v2));
+
+        result = result && Compare(y1, y2, 0, true, 64, 0, "y");
+        result = result && Compare(u1, u2, 0, true, 64, 0, "u");
+        result = result && Compare(v1, v2, 0, true, 64, 0, "v");
+
+        return result;
+    }
+
+    bool AnyToYuvV2AutoTest(View::Format srcType, int dx, int dy, const FuncYuvV2 & f1, const FuncYuvV2 & f2)
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt709Full; ++type)
+        {
+            result = result && AnyToYuvV2AutoTest(W, H, srcType, dx, dy, f1, f2, (SimdYuvType)type);
+            result = result && AnyToYuvV2AutoTest(W + O*dx, H - O*dy, srcType, dx, dy, f1, f2, (SimdYuvType)type);
+        }
+
+        return result;
+    }
+
+    bool BgraToYuv420pV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 2, FUNC_YUV_V2(Simd::Base::BgraToYuv420pV2), FUNC_YUV_V2(SimdBgraToYuv420pV2));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 2, FUNC_YUV_V2(Simd::Base::BgraToYuv420pV2), TEST_MT_FUNC(FuncYuvV2, SimdBgraToYuv420pV2));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 2, FUNC_YUV_V2(Simd::Sse41::BgraToYuv420pV2), FUNC_YUV_V2(SimdBgraToYuv420pV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 2, FUNC_YUV_V2(Simd::Avx2::BgraToYuv420pV2), FUNC_YUV_V2(SimdBgraToYuv420pV2));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 2, FUNC_YUV_V2(Simd::Avx512bw::BgraToYuv420pV2), FUNC_YUV_V2(SimdBgraToYuv420pV2));
+#endif
+
+        return result;
+    }
+
+    bool BgraToYuv422pV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 1, FUNC_YUV_V2(Simd::Base::BgraToYuv422pV2), FUNC_YUV_V2(SimdBgraToYuv422pV2));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 1, FUNC_YUV_V2(Simd::Base::BgraToYuv422pV2), TEST_MT_FUNC(FuncYuvV2, SimdBgraToYuv422pV2));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 1, FUNC_YUV_V2(Simd::Sse41::BgraToYuv422pV2), FUNC_YUV_V2(SimdBgraToYuv422pV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 1, FUNC_YUV_V2(Simd::Avx2::BgraToYuv422pV2), FUNC_YUV_V2(SimdBgraToYuv422pV2));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 1, FUNC_YUV_V2(Simd::Avx512bw::BgraToYuv422pV2), FUNC_YUV_V2(SimdBgraToYuv422pV2));
+#endif
+
+        return result;
+    }
+
+    bool BgraToYuv444pV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvV2AutoTest(View::Bgra32, 1, 1, FUNC_YUV_V2(Simd::Base::BgraToYuv444pV2), FUNC_YUV_V2(SimdBgraToYuv444pV2));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 1, 1, FUNC_YUV_V2(Simd::Base::BgraToYuv444pV2), TEST_MT_FUNC(FuncYuvV2, SimdBgraToYuv444pV2));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 1, 1, FUNC_YUV_V2(Simd::Sse41::BgraToYuv444pV2), FUNC_YUV_V2(SimdBgraToYuv444pV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 1, 1, FUNC_YUV_V2(Simd::Avx2::BgraToYuv444pV2), FUNC_YUV_V2(SimdBgraToYuv444pV2));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 1, 1, FUNC_YUV_V2(Simd::Avx512bw::BgraToYuv444pV2), FUNC_YUV_V2(SimdBgraToYuv444pV2));
+#endif
+
+        return result;
+    }
+
+    bool BgrToYuv420pV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvV2AutoTest(View::Bgr24, 2, 2, FUNC_YUV_V2(Simd::Base::BgrToYuv420pV2), FUNC_YUV_V2(SimdBgrToYuv420pV2));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 2, 2, FUNC_YUV_V2(Simd::Base::BgrToYuv420pV2), TEST_MT_FUNC(FuncYuvV2, SimdBgrToYuv420pV2));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 2, 2, FUNC_YUV_V2(Simd::Sse41::BgrToYuv420pV2), FUNC_YUV_V2(SimdBgrToYuv420pV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 2, 2, FUNC_YUV_V2(Simd::Avx2::BgrToYuv420pV2), FUNC_YUV_V2(SimdBgrToYuv420pV2));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 2, 2, FUNC_YUV_V2(Simd::Avx512bw::BgrToYuv420pV2), FUNC_YUV_V2(SimdBgrToYuv420pV2));
+#endif
+
+        return result;
+    }
+
+    bool BgrToYuv422pV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvV2AutoTest(View::Bgr24, 2, 1, FUNC_YUV_V2(Simd::Base::BgrToYuv422pV2), FUNC_YUV_V2(SimdBgrToYuv422pV2));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 2, 1, FUNC_YUV_V2(Simd::Base::BgrToYuv422pV2), TEST_MT_FUNC(FuncYuvV2, SimdBgrToYuv422pV2));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 2, 1, FUNC_YUV_V2(Simd::Sse41::BgrToYuv422pV2), FUNC_YUV_V2(SimdBgrToYuv422pV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 2, 1, FUNC_YUV_V2(Simd::Avx2::BgrToYuv422pV2), FUNC_YUV_V2(SimdBgrToYuv422pV2));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 2, 1, FUNC_YUV_V2(Simd::Avx512bw::BgrToYuv422pV2), FUNC_YUV_V2(SimdBgrToYuv422pV2));
+#endif
+
+        return result;
+    }
+
+    bool BgrToYuv444pV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvV2AutoTest(View::Bgr24, 1, 1, FUNC_YUV_V2(Simd::Base::BgrToYuv444pV2), FUNC_YUV_V2(SimdBgrToYuv444pV2));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 1, 1, FUNC_YUV_V2(Simd::Base::BgrToYuv444pV2), TEST_MT_FUNC(FuncYuvV2, SimdBgrToYuv444pV2));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 1, 1, FUNC_YUV_V2(Simd::Sse41::BgrToYuv444pV2), FUNC_YUV_V2(SimdBgrToYuv444pV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 1, 1, FUNC_YUV_V2(Simd::Avx2::BgrToYuv444pV2), FUNC_YUV_V2(SimdBgrToYuv444pV2));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 1, 1, FUNC_YUV_V2(Simd::Avx512bw::BgrToYuv444pV2), FUNC_YUV_V2(SimdBgrToYuv444pV2));
+#endif
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool AnyToYuvDataTest(bool create, int width, int height, View::Format srcType, int dx, int dy, const FuncYuv & f)
@@ -90,6 +90,10 @@ namespace Test
         bool result = true;
 
         result = result && Bgr48pToBgra32AutoTest(FUNC(Simd::Base::Bgr48pToBgra32), FUNC(SimdBgr48pToBgra32));
+        {
+            MultithreadedScope scope;
+            result = result && Bgr48pToBgra32AutoTest(FUNC(Simd::Base::Bgr48pToBgra32), TEST_MT_FUNC(Func, SimdBgr48pToBgra32));
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable && W >= Simd::Sse2::HA)
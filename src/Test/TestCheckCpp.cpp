@@ -59,6 +59,7 @@ namespace Test
         std::cout << "PowerPC-Altivec: " << (SimdCpuInfo(SimdCpuInfoVmx) ? "Yes" : "No") << std::endl;
         std::cout << "PowerPC-VSX: " << (SimdCpuInfo(SimdCpuInfoVsx) ? "Yes" : "No") << std::endl;
         std::cout << "ARM-NEON: " << (SimdCpuInfo(SimdCpuInfoNeon) ? "Yes" : "No") << std::endl;
+        std::cout << "Used ISA level: " << SimdCpuInfo(SimdCpuInfoIsa) << std::endl;
         std::cout << std::endl;
     }
 
@@ -0,0 +1,151 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+
+#include "Simd/SimdColorMatrix.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncCM
+        {
+            typedef void* (*FuncPtr)(const float* matrix, const uint8_t* gamma, SimdPixelFormatType format, SimdBool precise);
+
+            FuncPtr func;
+            String description;
+
+            FuncCM(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(View::Format format, SimdBool precise, bool gamma)
+            {
+                std::stringstream ss;
+                ss << description << "[" << ToString(format) << "-" << (precise ? "32f" : "16i") << (gamma ? "-g" : "") << "]";
+                description = ss.str();
+            }
+
+            void Call(const float* matrix, const uint8_t* gamma, SimdBool precise, const View& src, View& dst) const
+            {
+                void* colorMatrix = func(matrix, gamma, (SimdPixelFormatType)src.format, precise);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdColorMatrixRun(colorMatrix, src.data, src.stride, src.width, src.height, dst.data, dst.stride);
+                }
+                SimdRelease(colorMatrix);
+            }
+        };
+    }
+
+#define FUNC_CM(function) FuncCM(function, #function)
+
+    bool ColorMatrixAutoTest(size_t width, size_t height, View::Format format, SimdBool precise, bool gamma, FuncCM f1, FuncCM f2)
+    {
+        bool result = true;
+
+        f1.Update(format, precise, gamma);
+        f2.Update(format, precise, gamma);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        const float matrix[12] = {
+            1.62f, -0.41f, -0.21f, 4.0f,
+            -0.27f, 1.53f, -0.26f, -3.5f,
+            -0.08f, -0.57f, 1.65f, 0.0f };
+        uint8_t table[3 * 256];
+        int tableStepMax = 1;
+        for (int c = 0; c < 3; ++c)
+        {
+            for (int i = 0; i < 256; ++i)
+            {
+                table[c * 256 + i] = (uint8_t)Simd::Round(::pow(double(i) / 255.0, 1.0 / (2.0 + 0.2 * c)) * 255.0);
+                if (i)
+                    tableStepMax = Simd::Max(tableStepMax, table[c * 256 + i] - table[c * 256 + i - 1]);
+            }
+        }
+
+        View src(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View dst1(width, height, format, NULL, TEST_ALIGN(width));
+        View dst2(width, height, format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(matrix, gamma ? table : NULL, precise, src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(matrix, gamma ? table : NULL, precise, src, dst2));
+
+        // In float mode rounding may differ by 1 (FMA), the gamma table can amplify this difference up to its maximal step.
+        result = result && Compare(dst1, dst2, precise ? (gamma ? tableStepMax : 1) : 0, true, 64);
+
+        View dst3(width, height, format, NULL, TEST_ALIGN(width));
+        Simd::Copy(src, dst3);
+        f2.Call(matrix, gamma ? table : NULL, precise, dst3, dst3);
+
+        result = result && Compare(dst2, dst3, 0, true, 64, 0, "in-place");
+
+        return result;
+    }
+
+    bool ColorMatrixAutoTest(const FuncCM& f1, const FuncCM& f2)
+    {
+        bool result = true;
+
+        View::Format formats[2] = { View::Bgr24, View::Bgra32 };
+        for (int f = 0; f < 2; ++f)
+        {
+            for (int precise = 0; precise < 2; ++precise)
+            {
+                result = result && ColorMatrixAutoTest(W, H, formats[f], (SimdBool)precise, false, f1, f2);
+                result = result && ColorMatrixAutoTest(W, H, formats[f], (SimdBool)precise, true, f1, f2);
+                result = result && ColorMatrixAutoTest(W + O, H - O, formats[f], (SimdBool)precise, true, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool ColorMatrixAutoTest()
+    {
+        bool result = true;
+
+        result = result && ColorMatrixAutoTest(FUNC_CM(Simd::Base::ColorMatrixInit), FUNC_CM(SimdColorMatrixInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && ColorMatrixAutoTest(FUNC_CM(Simd::Sse41::ColorMatrixInit), FUNC_CM(SimdColorMatrixInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && ColorMatrixAutoTest(FUNC_CM(Simd::Avx2::ColorMatrixInit), FUNC_CM(SimdColorMatrixInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && ColorMatrixAutoTest(FUNC_CM(Simd::Avx512bw::ColorMatrixInit), FUNC_CM(SimdColorMatrixInit));
+#endif 
+
+        return result;
+    }
+}
@@ -116,6 +116,9 @@ namespace Test
 
     extern int LITTER_CPU_CACHE;
 
+    extern int BENCHMARK_BATCHES;
+    extern int BENCHMARK_WARMUP;
+
     enum DifferenceType
     {
         DifferenceAbsolute,
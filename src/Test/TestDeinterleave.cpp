@@ -89,6 +89,10 @@ namespace Test
         bool result = true;
 
         result = result && DeinterleaveUvAutoTest(FUNC2(Simd::Base::DeinterleaveUv), FUNC2(SimdDeinterleaveUv));
+        {
+            MultithreadedScope scope;
+            result = result && DeinterleaveUvAutoTest(FUNC2(Simd::Base::DeinterleaveUv), TEST_MT_FUNC(Func2, SimdDeinterleaveUv));
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable && W >= Simd::Sse2::A)
@@ -183,6 +187,10 @@ namespace Test
         bool result = true;
 
         result = result && DeinterleaveBgrAutoTest(FUNC3(Simd::Base::DeinterleaveBgr), FUNC3(SimdDeinterleaveBgr));
+        {
+            MultithreadedScope scope;
+            result = result && DeinterleaveBgrAutoTest(FUNC3(Simd::Base::DeinterleaveBgr), TEST_MT_FUNC(Func3, SimdDeinterleaveBgr));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable && W >= Simd::Ssse3::A)
@@ -275,6 +283,10 @@ namespace Test
         bool result = true;
 
         result = result && DeinterleaveBgraAutoTest(FUNC4(Simd::Base::DeinterleaveBgra), FUNC4(SimdDeinterleaveBgra));
+        {
+            MultithreadedScope scope;
+            result = result && DeinterleaveBgraAutoTest(FUNC4(Simd::Base::DeinterleaveBgra), TEST_MT_FUNC(Func4, SimdDeinterleaveBgra));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable && W >= Simd::Ssse3::A)
@@ -0,0 +1,180 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+
+namespace Test
+{
+    namespace
+    {
+        const size_t DISPATCH_CALLS = 1000;
+
+        struct FuncO
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride);
+            FuncPtr func;
+            String description;
+            size_t calls;
+
+            FuncO(const FuncPtr & f, const String & d, size_t c = DISPATCH_CALLS) : func(f), description(d), calls(c) {}
+
+            void Update(size_t width, size_t height)
+            {
+                std::stringstream ss;
+                ss << description << "[" << width << "x" << height << "x" << calls << "]";
+                description = ss.str();
+            }
+
+            void Call(const View & src, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                for (size_t i = 0; i < calls; ++i)
+                    func(src.data, src.width, src.height, src.stride, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_O(func) FuncO(func, #func)
+
+    bool DispatchAutoTest(size_t width, size_t height, View::Format srcType, View::Format dstType, FuncO f1, FuncO f2)
+    {
+        bool result = true;
+
+        f1.Update(width, height);
+        f2.Update(width, height);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << ".");
+
+        View src(width, height, srcType, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View dst1(width, height, dstType, NULL, TEST_ALIGN(width));
+        View dst2(width, height, dstType, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool DispatchAutoTest(size_t size, View::Format srcType, View::Format dstType, const FuncO & f1, const FuncO & f2)
+    {
+        bool result = true;
+
+        result = result && DispatchAutoTest(size, size, srcType, dstType, f1, f2);
+
+        return result;
+    }
+
+    bool DispatchAutoTest(size_t size)
+    {
+        bool result = true;
+
+        result = result && DispatchAutoTest(size, View::Bgra32, View::Gray8, FUNC_O(Simd::Base::BgraToGray), FUNC_O(SimdBgraToGray));
+        result = result && DispatchAutoTest(size, View::Bgr24, View::Gray8, FUNC_O(Simd::Base::BgrToGray), FUNC_O(SimdBgrToGray));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && size >= Simd::Sse2::A)
+            result = result && DispatchAutoTest(size, View::Bgra32, View::Gray8, FUNC_O(Simd::Sse2::BgraToGray), FUNC_O(SimdBgraToGray));
+#endif 
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && size >= Simd::Ssse3::A)
+            result = result && DispatchAutoTest(size, View::Bgr24, View::Gray8, FUNC_O(Simd::Ssse3::BgrToGray), FUNC_O(SimdBgrToGray));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && size >= Simd::Avx2::A)
+        {
+            result = result && DispatchAutoTest(size, View::Bgra32, View::Gray8, FUNC_O(Simd::Avx2::BgraToGray), FUNC_O(SimdBgraToGray));
+            result = result && DispatchAutoTest(size, View::Bgr24, View::Gray8, FUNC_O(Simd::Avx2::BgrToGray), FUNC_O(SimdBgrToGray));
+        }
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+        {
+            result = result && DispatchAutoTest(size, View::Bgra32, View::Gray8, FUNC_O(Simd::Avx512bw::BgraToGray), FUNC_O(SimdBgraToGray));
+            result = result && DispatchAutoTest(size, View::Bgr24, View::Gray8, FUNC_O(Simd::Avx512bw::BgrToGray), FUNC_O(SimdBgrToGray));
+        }
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && size >= Simd::Neon::A)
+        {
+            result = result && DispatchAutoTest(size, View::Bgra32, View::Gray8, FUNC_O(Simd::Neon::BgraToGray), FUNC_O(SimdBgraToGray));
+            result = result && DispatchAutoTest(size, View::Bgr24, View::Gray8, FUNC_O(Simd::Neon::BgrToGray), FUNC_O(SimdBgrToGray));
+        }
+#endif 
+
+        return result;
+    }
+
+    bool DispatchAutoTest()
+    {
+        bool result = true;
+
+        result = result && DispatchAutoTest(16);
+        result = result && DispatchAutoTest(32);
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    bool MaxIsaAutoTest()
+    {
+        bool result = true;
+
+        MaxIsaScope scope;
+        SimdIsaType maxIsa = scope.MaxIsa(), top = (SimdIsaType)SimdCpuInfo(SimdCpuInfoIsa);
+        for (int isa = SimdIsaBase; isa <= SimdIsaSse2 && result; ++isa)
+        {
+            if (!Simd::Base::IsaAllowed((SimdIsaType)isa, maxIsa))
+                continue;
+            SimdSetMaxIsa((SimdIsaType)isa);
+            SimdIsaType used = (SimdIsaType)SimdCpuInfo(SimdCpuInfoIsa);
+            if (!Simd::Base::IsaAllowed(used, (SimdIsaType)isa))
+            {
+                TEST_LOG_SS(Error, "Used instruction set level " << ToString(used) << " exceeds " << ToString((SimdIsaType)isa) << "!");
+                result = false;
+            }
+            else if (isa != SimdIsaBase && Simd::Base::GetIsaFamily((SimdIsaType)isa) != Simd::Base::GetIsaFamily(top) && used != top)
+            {
+                TEST_LOG_SS(Error, "Instruction set level " << ToString((SimdIsaType)isa) << " of other architecture restricts " << ToString(top) << "!");
+                result = false;
+            }
+            else if (used == isa)
+            {
+                result = result && DispatchAutoTest(W, H, View::Bgra32, View::Gray8, FuncO(Simd::Base::BgraToGray, "Simd::Base::BgraToGray", 1),
+                    FuncO(SimdBgraToGray, "SimdBgraToGray-" + ToString(used), 1));
+            }
+        }
+
+        return result;
+    }
+}
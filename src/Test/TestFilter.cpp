@@ -134,6 +134,10 @@ namespace Test
         bool result = true;
 
         result = result && ColorFilterAutoTest(FUNC_C(Simd::Base::MedianFilterRhomb3x3), FUNC_C(SimdMedianFilterRhomb3x3));
+        {
+            MultithreadedScope scope;
+            result = result && ColorFilterAutoTest(FUNC_C(Simd::Base::MedianFilterRhomb3x3), TEST_MT_FUNC(FuncC, SimdMedianFilterRhomb3x3));
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable && W - 1 >= Simd::Sse2::A)
@@ -168,6 +172,10 @@ namespace Test
         bool result = true;
 
         result = result && ColorFilterAutoTest(FUNC_C(Simd::Base::MedianFilterRhomb5x5), FUNC_C(SimdMedianFilterRhomb5x5));
+        {
+            MultithreadedScope scope;
+            result = result && ColorFilterAutoTest(FUNC_C(Simd::Base::MedianFilterRhomb5x5), TEST_MT_FUNC(FuncC, SimdMedianFilterRhomb5x5));
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable && W - 2 >= Simd::Sse2::A)
@@ -202,6 +210,10 @@ namespace Test
         bool result = true;
 
         result = result && ColorFilterAutoTest(FUNC_C(Simd::Base::MedianFilterSquare3x3), FUNC_C(SimdMedianFilterSquare3x3));
+        {
+            MultithreadedScope scope;
+            result = result && ColorFilterAutoTest(FUNC_C(Simd::Base::MedianFilterSquare3x3), TEST_MT_FUNC(FuncC, SimdMedianFilterSquare3x3));
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable && W - 1 >= Simd::Sse2::A)
@@ -236,6 +248,10 @@ namespace Test
         bool result = true;
 
         result = result && ColorFilterAutoTest(FUNC_C(Simd::Base::MedianFilterSquare5x5), FUNC_C(SimdMedianFilterSquare5x5));
+        {
+            MultithreadedScope scope;
+            result = result && ColorFilterAutoTest(FUNC_C(Simd::Base::MedianFilterSquare5x5), TEST_MT_FUNC(FuncC, SimdMedianFilterSquare5x5));
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable && W - 2 >= Simd::Sse2::A)
@@ -270,6 +286,10 @@ namespace Test
         bool result = true;
 
         result = result && ColorFilterAutoTest(FUNC_C(Simd::Base::GaussianBlur3x3), FUNC_C(SimdGaussianBlur3x3));
+        {
+            MultithreadedScope scope;
+            result = result && ColorFilterAutoTest(FUNC_C(Simd::Base::GaussianBlur3x3), TEST_MT_FUNC(FuncC, SimdGaussianBlur3x3));
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable && W - 1 >= Simd::Sse2::A)
@@ -364,6 +384,10 @@ namespace Test
         bool result = true;
 
         result = result && GrayFilterAutoTest(View::Gray8, FUNC_G(Simd::Base::AbsGradientSaturatedSum), FUNC_G(SimdAbsGradientSaturatedSum));
+        {
+            MultithreadedScope scope;
+            result = result && GrayFilterAutoTest(View::Gray8, FUNC_G(Simd::Base::AbsGradientSaturatedSum), TEST_MT_FUNC(FuncG, SimdAbsGradientSaturatedSum));
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable && W - 1 >= Simd::Sse2::A)
@@ -446,6 +470,10 @@ namespace Test
         bool result = true;
 
         result = result && GrayFilterAutoTest(View::Int16, FUNC_G(Simd::Base::SobelDx), FUNC_G(SimdSobelDx));
+        {
+            MultithreadedScope scope;
+            result = result && GrayFilterAutoTest(View::Int16, FUNC_G(Simd::Base::SobelDx), TEST_MT_FUNC(FuncG, SimdSobelDx));
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable && W - 1 >= Simd::Sse2::A)
@@ -485,6 +513,10 @@ namespace Test
         bool result = true;
 
         result = result && GrayFilterAutoTest(View::Int16, FUNC_G(Simd::Base::SobelDxAbs), FUNC_G(SimdSobelDxAbs));
+        {
+            MultithreadedScope scope;
+            result = result && GrayFilterAutoTest(View::Int16, FUNC_G(Simd::Base::SobelDxAbs), TEST_MT_FUNC(FuncG, SimdSobelDxAbs));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable && W - 1 >= Simd::Ssse3::A)
@@ -519,6 +551,10 @@ namespace Test
         bool result = true;
 
         result = result && GrayFilterAutoTest(View::Int16, FUNC_G(Simd::Base::SobelDy), FUNC_G(SimdSobelDy));
+        {
+            MultithreadedScope scope;
+            result = result && GrayFilterAutoTest(View::Int16, FUNC_G(Simd::Base::SobelDy), TEST_MT_FUNC(FuncG, SimdSobelDy));
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable && W - 1 >= Simd::Sse2::A)
@@ -558,6 +594,10 @@ namespace Test
         bool result = true;
 
         result = result && GrayFilterAutoTest(View::Int16, FUNC_G(Simd::Base::SobelDyAbs), FUNC_G(SimdSobelDyAbs));
+        {
+            MultithreadedScope scope;
+            result = result && GrayFilterAutoTest(View::Int16, FUNC_G(Simd::Base::SobelDyAbs), TEST_MT_FUNC(FuncG, SimdSobelDyAbs));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable && W - 1 >= Simd::Ssse3::A)
@@ -592,6 +632,10 @@ namespace Test
         bool result = true;
 
         result = result && GrayFilterAutoTest(View::Int16, FUNC_G(Simd::Base::ContourMetrics), FUNC_G(SimdContourMetrics));
+        {
+            MultithreadedScope scope;
+            result = result && GrayFilterAutoTest(View::Int16, FUNC_G(Simd::Base::ContourMetrics), TEST_MT_FUNC(FuncG, SimdContourMetrics));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable && W - 1 >= Simd::Ssse3::A)
@@ -626,6 +670,10 @@ namespace Test
         bool result = true;
 
         result = result && GrayFilterAutoTest(View::Int16, FUNC_G(Simd::Base::Laplace), FUNC_G(SimdLaplace));
+        {
+            MultithreadedScope scope;
+            result = result && GrayFilterAutoTest(View::Int16, FUNC_G(Simd::Base::Laplace), TEST_MT_FUNC(FuncG, SimdLaplace));
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable && W - 1 >= Simd::Sse2::A)
@@ -665,6 +713,10 @@ namespace Test
         bool result = true;
 
         result = result && GrayFilterAutoTest(View::Int16, FUNC_G(Simd::Base::LaplaceAbs), FUNC_G(SimdLaplaceAbs));
+        {
+            MultithreadedScope scope;
+            result = result && GrayFilterAutoTest(View::Int16, FUNC_G(Simd::Base::LaplaceAbs), TEST_MT_FUNC(FuncG, SimdLaplaceAbs));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable && W - 1 >= Simd::Ssse3::A)
@@ -191,6 +191,83 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncSF
+        {
+            typedef void(*FuncPtr)(const uint16_t * src, size_t size, int bits, const float * lower, const float * upper, float * dst);
+
+            FuncPtr func;
+            String description;
+
+            FuncSF(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, int bits, float lower, float upper, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func((const uint16_t*)src.data, src.width, bits, &lower, &upper, (float*)dst.data);
+            }
+        };
+    }
+
+#define FUNC_SF(function) FuncSF(function, #function)
+
+    bool Uint16ToFloat32AutoTest(size_t size, int bits, const FuncSF & f1, const FuncSF & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << size << ", " << bits << "].");
+
+        View src(size, 1, View::Int16, NULL, TEST_ALIGN(SIMD_ALIGN));
+        View dst1(size, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+        View dst2(size, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+
+        const float lower = -0.10, upper = 0.10;
+        FillRandom(src);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, bits, lower, upper, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, bits, lower, upper, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32);
+
+        return result;
+    }
+
+    bool Uint16ToFloat32AutoTest(const FuncSF & f1, const FuncSF & f2)
+    {
+        bool result = true;
+
+        result = result && Uint16ToFloat32AutoTest(W*H, 16, f1, f2);
+        result = result && Uint16ToFloat32AutoTest(W*H - 1, 10, f1, f2);
+
+        return result;
+    }
+
+    bool Uint16ToFloat32AutoTest()
+    {
+        bool result = true;
+
+        result = result && Uint16ToFloat32AutoTest(FUNC_SF(Simd::Base::Uint16ToFloat32), FUNC_SF(SimdUint16ToFloat32));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && Uint16ToFloat32AutoTest(FUNC_SF(Simd::Sse2::Uint16ToFloat32), FUNC_SF(SimdUint16ToFloat32));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Uint16ToFloat32AutoTest(FUNC_SF(Simd::Avx2::Uint16ToFloat32), FUNC_SF(SimdUint16ToFloat32));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Uint16ToFloat32AutoTest(FUNC_SF(Simd::Avx512bw::Uint16ToFloat32), FUNC_SF(SimdUint16ToFloat32));
+#endif 
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool Float32ToUint8DataTest(bool create, size_t size, const FuncFB & f)
@@ -0,0 +1,202 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+
+#include "Simd/SimdFrame.hpp"
+
+namespace Test
+{
+    typedef Simd::Frame<Simd::Allocator> Frame;
+
+    static void FillRandom(Frame & frame)
+    {
+        for (size_t i = 0; i < frame.PlaneCount(); ++i)
+            FillRandom(frame.planes[i]);
+    }
+
+    static bool Compare(const Frame & a, const Frame & b)
+    {
+        bool result = a.PlaneCount() == b.PlaneCount();
+        for (size_t i = 0; i < a.PlaneCount() && result; ++i)
+            result = Compare(a.planes[i], b.planes[i], 0, true, 64);
+        return result;
+    }
+
+    bool FrameConvertAutoTest(size_t width, size_t height, Frame::Format srcFormat, Frame::Format midFormat, Frame::Format dstFormat)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Frame::Convert(" << srcFormat << " -> " << midFormat << " -> " << dstFormat << ") [" << width << ", " << height << "].");
+
+        Frame src(width, height, srcFormat);
+        FillRandom(src);
+        Frame mid(width, height, midFormat);
+        Frame dst1(width, height, dstFormat);
+        Frame dst2(width, height, dstFormat);
+
+        result = result && Simd::ConvertPath(src, dst1) == Simd::FrameConvertStrip;
+        result = result && Simd::ConvertPath(src, mid) == Simd::FrameConvertDirect;
+        result = result && Simd::ConvertPath(mid, dst1) == Simd::FrameConvertDirect;
+        if (!result)
+            TEST_LOG_SS(Error, "Unexpected Frame::Convert path!");
+
+        Simd::Convert(src, mid);
+        Simd::Convert(mid, dst1);
+
+        Simd::Convert(src, dst2);
+
+        result = result && Compare(dst1, dst2);
+
+        return result;
+    }
+
+    bool FrameConvertAutoTest(size_t width, size_t height)
+    {
+        bool result = true;
+
+        result = result && FrameConvertAutoTest(width, height, Frame::Rgb24, Frame::Bgr24, Frame::Nv12);
+        result = result && FrameConvertAutoTest(width, height, Frame::Rgb24, Frame::Bgr24, Frame::Yuv420p);
+        result = result && FrameConvertAutoTest(width, height, Frame::P010, Frame::Nv12, Frame::Yuv420p);
+        result = result && FrameConvertAutoTest(width, height, Frame::P010, Frame::Nv12, Frame::Bgr24);
+        result = result && FrameConvertAutoTest(width, height, Frame::P010, Frame::Nv12, Frame::Rgb24);
+        result = result && FrameConvertAutoTest(width, height, Frame::Yuv420p16, Frame::Yuv420p, Frame::Nv12);
+        result = result && FrameConvertAutoTest(width, height, Frame::Yuv420p16, Frame::Yuv420p, Frame::Bgr24);
+        result = result && FrameConvertAutoTest(width, height, Frame::Yuv420p16, Frame::Yuv420p, Frame::Rgb24);
+
+        return result;
+    }
+
+    bool FrameConvertAutoTest()
+    {
+        bool result = true;
+
+        result = result && FrameConvertAutoTest(W, H);
+        result = result && FrameConvertAutoTest(W + O * 2, H * 16 + 2);
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    static void SynetSetInputReference(const Frame & src, const Rect & roi, size_t dstW, size_t dstH, const float * lower, const float * upper,
+        float * dst, size_t channels, SimdTensorFormatType format, bool letterbox, uint8_t padding)
+    {
+        Frame crop = src.Region(roi);
+        Frame converted;
+        switch (crop.format)
+        {
+        case Frame::Gray8:
+        case Frame::Bgra32:
+        case Frame::Bgr24:
+        case Frame::Rgb24:
+            converted = crop;
+            break;
+        default:
+            converted.Recreate(crop.width, crop.height, channels == 1 ? Frame::Gray8 : Frame::Bgr24);
+            Simd::Convert(crop, converted);
+        }
+        const View & image = converted.planes[0];
+        size_t left = 0, top = 0, innerW = dstW, innerH = dstH;
+        if (letterbox)
+        {
+            double scale = std::min(double(dstW) / image.width, double(dstH) / image.height);
+            innerW = size_t(image.width * scale + 0.5);
+            innerH = size_t(image.height * scale + 0.5);
+            left = (dstW - innerW) / 2;
+            top = (dstH - innerH) / 2;
+        }
+        View buffer(dstW, dstH, image.format);
+        Simd::Fill(buffer, padding);
+        View inner = buffer.Region(left, top, left + innerW, top + innerH);
+        Simd::Resize(image, inner);
+        Simd::SynetSetInput(buffer, lower, upper, dst, channels, format);
+    }
+
+    bool FrameSynetSetInputAutoTest(size_t width, size_t height, Frame::Format srcFormat, size_t channels, SimdTensorFormatType format, bool letterbox)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Simd::SynetSetInput(Frame) for format " << srcFormat << " [" << width << ", " << height << "] -> ["
+            << width / 3 << ", " << height / 2 << "], channels = " << channels << ", tensor = " << format << ", letterbox = " << letterbox << ".");
+
+        Frame src(width, height, srcFormat);
+        Rect roi(width / 8, height / 4, width * 7 / 8, height);
+        size_t dstW = width / 3, dstH = height / 2, size = dstW * dstH * channels;
+        const float lower[3] = { -1.0f, -0.5f, 0.0f }, upper[3] = { 1.0f, 0.5f, 2.0f };
+        const uint8_t padding = 114;
+
+        Buffer32f dst1(size), dst2(size), dst3(size);
+
+        Simd::SynetSetInputContext<Simd::Allocator> context;
+        for (int i = 0; i < 2 && result; ++i)
+        {
+            FillRandom(src);
+
+            SynetSetInputReference(src, roi, dstW, dstH, lower, upper, dst1.data(), channels, format, letterbox, padding);
+
+            context.Run(src, roi, dstW, dstH, lower, upper, dst2.data(), channels, format, letterbox, padding);
+
+            Simd::SynetSetInput(src, roi, dstW, dstH, lower, upper, dst3.data(), channels, format, letterbox, padding);
+
+            result = result && Compare(dst1, dst2, EPS, true, 64, true, "context");
+            result = result && Compare(dst1, dst3, EPS, true, 64, true, "function");
+        }
+
+        return result;
+    }
+
+    bool FrameSynetSetInputAutoTest(size_t width, size_t height)
+    {
+        bool result = true;
+
+        SimdTensorFormatType formats[2] = { SimdTensorFormatNchw, SimdTensorFormatNhwc };
+        for (int f = 0; f < 2; ++f)
+        {
+            for (int letterbox = 0; letterbox < 2; ++letterbox)
+            {
+                for (size_t channels = 1; channels <= 3; channels += 2)
+                {
+                    result = result && FrameSynetSetInputAutoTest(width, height, Frame::Gray8, channels, formats[f], letterbox != 0);
+                    result = result && FrameSynetSetInputAutoTest(width, height, Frame::Bgr24, channels, formats[f], letterbox != 0);
+                    result = result && FrameSynetSetInputAutoTest(width, height, Frame::Bgra32, channels, formats[f], letterbox != 0);
+                    result = result && FrameSynetSetInputAutoTest(width, height, Frame::Rgb24, channels, formats[f], letterbox != 0);
+                    result = result && FrameSynetSetInputAutoTest(width, height, Frame::Nv12, channels, formats[f], letterbox != 0);
+                    result = result && FrameSynetSetInputAutoTest(width, height, Frame::Yuv420p, channels, formats[f], letterbox != 0);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    bool FrameSynetSetInputAutoTest()
+    {
+        bool result = true;
+
+        result = result && FrameSynetSetInputAutoTest(W, H);
+        result = result && FrameSynetSetInputAutoTest(W + O * 2, H - O * 2);
+
+        return result;
+    }
+}
@@ -87,6 +87,10 @@ namespace Test
         bool result = true;
 
         result = result && InterleaveUvAutoTest(FUNC2(Simd::Base::InterleaveUv), FUNC2(SimdInterleaveUv));
+        {
+            MultithreadedScope scope;
+            result = result && InterleaveUvAutoTest(FUNC2(Simd::Base::InterleaveUv), TEST_MT_FUNC(Func2, SimdInterleaveUv));
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable)
@@ -178,6 +182,10 @@ namespace Test
         bool result = true;
 
         result = result && InterleaveBgrAutoTest(FUNC3(Simd::Base::InterleaveBgr), FUNC3(SimdInterleaveBgr));
+        {
+            MultithreadedScope scope;
+            result = result && InterleaveBgrAutoTest(FUNC3(Simd::Base::InterleaveBgr), TEST_MT_FUNC(Func3, SimdInterleaveBgr));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable)
@@ -266,6 +274,10 @@ namespace Test
         bool result = true;
 
         result = result && InterleaveBgraAutoTest(FUNC4(Simd::Base::InterleaveBgra), FUNC4(SimdInterleaveBgra));
+        {
+            MultithreadedScope scope;
+            result = result && InterleaveBgraAutoTest(FUNC4(Simd::Base::InterleaveBgra), TEST_MT_FUNC(Func4, SimdInterleaveBgra));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable)
@@ -0,0 +1,210 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+
+#include "Simd/SimdLut3d.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncL3d
+        {
+            typedef void* (*FuncPtr)(const float* table, size_t size, SimdPixelFormatType format, SimdLut3dInterpolationType interpolation);
+
+            FuncPtr func;
+            String description;
+
+            FuncL3d(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(View::Format format, size_t size, SimdLut3dInterpolationType interpolation)
+            {
+                std::stringstream ss;
+                ss << description << "[" << ToString(format) << "-" << size << "-";
+                ss << (interpolation == SimdLut3dInterpolationTrilinear ? "Tri" : "Tet") << "]";
+                description = ss.str();
+            }
+
+            void Call(const Buffer32f& table, size_t size, SimdLut3dInterpolationType interpolation, const View& src, View& dst) const
+            {
+                void* lut3d = func(table.data(), size, (SimdPixelFormatType)src.format, interpolation);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdLut3dRun(lut3d, src.data, src.stride, src.width, src.height, dst.data, dst.stride);
+                }
+                SimdRelease(lut3d);
+            }
+        };
+    }
+
+#define FUNC_L3D(function) FuncL3d(function, #function)
+
+    bool Lut3dAutoTest(size_t width, size_t height, View::Format format, size_t size, SimdLut3dInterpolationType interpolation, FuncL3d f1, FuncL3d f2)
+    {
+        bool result = true;
+
+        f1.Update(format, size, interpolation);
+        f2.Update(format, size, interpolation);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        Buffer32f table(size * size * size * 3);
+        for (size_t b = 0, i = 0; b < size; ++b)
+        {
+            for (size_t g = 0; g < size; ++g)
+            {
+                for (size_t r = 0; r < size; ++r, i += 3)
+                {
+                    table[i + 0] = float(g + b) / float(2 * size - 2) + float(Random()) * 0.2f - 0.1f;
+                    table[i + 1] = float(r) / float(size - 1) + float(Random()) * 0.2f - 0.1f;
+                    table[i + 2] = float(b) / float(size - 1) + float(Random()) * 0.2f - 0.1f;
+                }
+            }
+        }
+
+        View src(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View dst1(width, height, format, NULL, TEST_ALIGN(width));
+        View dst2(width, height, format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(table, size, interpolation, src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(table, size, interpolation, src, dst2));
+
+        result = result && Compare(dst1, dst2, 1, true, 64);
+
+        View dst3(width, height, format, NULL, TEST_ALIGN(width));
+        Simd::Copy(src, dst3);
+        f2.Call(table, size, interpolation, dst3, dst3);
+
+        result = result && Compare(dst2, dst3, 0, true, 64, 0, "in-place");
+
+        return result;
+    }
+
+    /*
+    * Checks an implementation against a known table: identity (node value = node coordinate) or identity with swapped red and blue.
+    * Output must be equal to input (with swapped red and blue) within quantization error, so it pins down the node order.
+    */
+    bool Lut3dIdentityAutoTest(size_t width, size_t height, View::Format format, size_t size, SimdLut3dInterpolationType interpolation, bool swap, FuncL3d f)
+    {
+        bool result = true;
+
+        f.Update(format, size, interpolation);
+        if (swap)
+            f.description += "[swap]";
+
+        TEST_LOG_SS(Info, "Test " << f.description << " with identity table [" << width << ", " << height << "].");
+
+        Buffer32f table(size * size * size * 3);
+        for (size_t b = 0, i = 0; b < size; ++b)
+        {
+            for (size_t g = 0; g < size; ++g)
+            {
+                for (size_t r = 0; r < size; ++r, i += 3)
+                {
+                    table[i + 0] = float(swap ? b : r) / float(size - 1);
+                    table[i + 1] = float(g) / float(size - 1);
+                    table[i + 2] = float(swap ? r : b) / float(size - 1);
+                }
+            }
+        }
+
+        View src(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View expected(width, height, format, NULL, TEST_ALIGN(width));
+        Simd::Copy(src, expected);
+        if (swap)
+        {
+            size_t channels = View::PixelSize(format);
+            for (size_t y = 0; y < height; ++y)
+            {
+                uint8_t * row = expected.data + y * expected.stride;
+                for (size_t x = 0; x < width; ++x, row += channels)
+                    std::swap(row[0], row[2]);
+            }
+        }
+
+        View dst(width, height, format, NULL, TEST_ALIGN(width));
+        f.Call(table, size, interpolation, src, dst);
+
+        result = result && Compare(expected, dst, 1, true, 64, 0, swap ? "swap" : "identity");
+
+        return result;
+    }
+
+    bool Lut3dAutoTest(const FuncL3d& f1, const FuncL3d& f2)
+    {
+        bool result = true;
+
+        View::Format formats[2] = { View::Bgr24, View::Bgra32 };
+        size_t sizes[2] = { 17, 33 };
+        for (int f = 0; f < 2; ++f)
+        {
+            for (int s = 0; s < 2; ++s)
+            {
+                result = result && Lut3dAutoTest(W, H, formats[f], sizes[s], SimdLut3dInterpolationTrilinear, f1, f2);
+                result = result && Lut3dAutoTest(W, H, formats[f], sizes[s], SimdLut3dInterpolationTetrahedral, f1, f2);
+            }
+            result = result && Lut3dAutoTest(W + O, H - O, formats[f], 2, SimdLut3dInterpolationTrilinear, f1, f2);
+            result = result && Lut3dAutoTest(W + O, H - O, formats[f], 2, SimdLut3dInterpolationTetrahedral, f1, f2);
+            for (int s = 0; s < 2; ++s)
+            {
+                result = result && Lut3dIdentityAutoTest(W, H, formats[f], sizes[s], SimdLut3dInterpolationTrilinear, false, f1);
+                result = result && Lut3dIdentityAutoTest(W, H, formats[f], sizes[s], SimdLut3dInterpolationTetrahedral, false, f1);
+                result = result && Lut3dIdentityAutoTest(W, H, formats[f], sizes[s], SimdLut3dInterpolationTrilinear, true, f1);
+                result = result && Lut3dIdentityAutoTest(W, H, formats[f], sizes[s], SimdLut3dInterpolationTetrahedral, true, f1);
+            }
+        }
+
+        return result;
+    }
+
+    bool Lut3dAutoTest()
+    {
+        bool result = true;
+
+        result = result && Lut3dAutoTest(FUNC_L3D(Simd::Base::Lut3dInit), FUNC_L3D(SimdLut3dInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && Lut3dAutoTest(FUNC_L3D(Simd::Sse41::Lut3dInit), FUNC_L3D(SimdLut3dInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Lut3dAutoTest(FUNC_L3D(Simd::Avx2::Lut3dInit), FUNC_L3D(SimdLut3dInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Lut3dAutoTest(FUNC_L3D(Simd::Avx512bw::Lut3dInit), FUNC_L3D(SimdLut3dInit));
+#endif 
+
+        return result;
+    }
+}
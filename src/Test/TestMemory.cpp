@@ -0,0 +1,98 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+
+namespace Test
+{
+    namespace
+    {
+        bool CheckBlock(uint8_t * ptr, size_t size, size_t align, const String & desc)
+        {
+            if (ptr == NULL)
+            {
+                TEST_LOG_SS(Error, "Can't allocate " << size << " bytes (" << desc << ")!");
+                return false;
+            }
+            if (size_t(ptr) % align != 0)
+            {
+                TEST_LOG_SS(Error, "Wrong alignment of " << size << " bytes (" << desc << ")!");
+                return false;
+            }
+            for (size_t i = 0; i < size; ++i)
+                ptr[i] = uint8_t(i);
+            for (size_t i = 0; i < size; ++i)
+            {
+                if (ptr[i] != uint8_t(i))
+                {
+                    TEST_LOG_SS(Error, "Wrong value at " << i << " of " << size << " bytes (" << desc << ")!");
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool AllocateFlagsAutoTest(int flags)
+        {
+            bool result = true;
+
+            const size_t sizes[] = { 1, 1000, 4 * 1024 * 1024 + 123 };
+            for (size_t i = 0; i < 3 && result; ++i)
+            {
+                size_t align = ::SimdAlignment();
+                uint8_t * ptr = (uint8_t*)::SimdAllocateWithFlags(sizes[i], align, flags);
+                result = result && CheckBlock(ptr, sizes[i], align, "flags " + ToString(flags));
+                ::SimdFree(ptr);
+            }
+
+            int global = ::SimdGetAllocateFlags();
+            ::SimdSetAllocateFlags(flags);
+            if (::SimdGetAllocateFlags() != flags)
+            {
+                TEST_LOG_SS(Error, "Can't set global allocate flags " << flags << "!");
+                result = false;
+            }
+            {
+                View view(2048, 1024, View::Bgra32);
+                result = result && CheckBlock(view.data, view.DataSize(), ::SimdAlignment(), "View, global flags " + ToString(flags));
+            }
+            ::SimdSetAllocateFlags(global);
+
+            return result;
+        }
+    }
+
+    bool AllocateAutoTest()
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test memory allocation.");
+
+        result = result && AllocateFlagsAutoTest(SimdAllocateDefault);
+        result = result && AllocateFlagsAutoTest(SimdAllocateHugePages);
+        result = result && AllocateFlagsAutoTest(SimdAllocateNumaLocal);
+        result = result && AllocateFlagsAutoTest(SimdAllocateHugePages | SimdAllocateNumaLocal);
+
+        return result;
+    }
+}
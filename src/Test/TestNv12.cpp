@@ -0,0 +1,448 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncNv
+        {
+            typedef void(*FuncPtr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+                uint8_t * dst, size_t dstStride, SimdYuvType yuvType);
+            typedef void(*FuncAlphaPtr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+                uint8_t * dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType);
+
+            FuncPtr func;
+            FuncAlphaPtr funcAlpha;
+            String description;
+            SimdYuvType yuvType;
+
+            FuncNv(const FuncPtr & f, const String & d) : func(f), funcAlpha(NULL), description(d), yuvType(SimdYuvBt601) {}
+            FuncNv(const FuncAlphaPtr & f, const String & d) : func(NULL), funcAlpha(f), description(d), yuvType(SimdYuvBt601) {}
+
+            void Update(SimdYuvType t)
+            {
+                yuvType = t;
+                description = description + "[" + ToString(t) + "]";
+            }
+
+            void Call(const View & y, const View & uv, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                if (funcAlpha)
+                    funcAlpha(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, 0xFF, yuvType);
+                else
+                    func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, yuvType);
+            }
+        };
+    }
+
+#define FUNC_NV(function) FuncNv(function, #function)
+
+    /*
+    * Two-pass references (deinterleaving of UV plane and conversion of YUV420P image) which were used by Frame::Convert before.
+    * They are compared with single-pass functions both by results and by performance.
+    */
+    static void Nv12ToBgraTwoPass(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+        uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+    {
+        View u(width / 2, height / 2, View::Gray8), v(width / 2, height / 2, View::Gray8);
+        SimdDeinterleaveUv(uv, uvStride, u.width, u.height, u.data, u.stride, v.data, v.stride);
+        SimdYuv420pToBgraV2(y, yStride, u.data, u.stride, v.data, v.stride, width, height, bgra, bgraStride, alpha, yuvType);
+    }
+
+    static void Nv12ToBgrTwoPass(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+        uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+    {
+        View u(width / 2, height / 2, View::Gray8), v(width / 2, height / 2, View::Gray8);
+        SimdDeinterleaveUv(uv, uvStride, u.width, u.height, u.data, u.stride, v.data, v.stride);
+        SimdYuv420pToBgrV2(y, yStride, u.data, u.stride, v.data, v.stride, width, height, bgr, bgrStride, yuvType);
+    }
+
+    static void Nv12ToRgbTwoPass(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+        uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+    {
+        View u(width / 2, height / 2, View::Gray8), v(width / 2, height / 2, View::Gray8);
+        SimdDeinterleaveUv(uv, uvStride, u.width, u.height, u.data, u.stride, v.data, v.stride);
+        SimdYuv420pToRgbV2(y, yStride, u.data, u.stride, v.data, v.stride, width, height, rgb, rgbStride, yuvType);
+    }
+
+    bool NvToAnyAutoTest(int width, int height, View::Format dstType, FuncNv f1, FuncNv f2, SimdYuvType yuvType)
+    {
+        bool result = true;
+
+        f1.Update(yuvType);
+        f2.Update(yuvType);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View uv(width / 2, height / 2, View::Uv16, NULL, TEST_ALIGN(width));
+        FillRandom(uv);
+
+        View dst1(width, height, dstType, NULL, TEST_ALIGN(width));
+        View dst2(width, height, dstType, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, uv, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, uv, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool NvToAnyAutoTest(View::Format dstType, const FuncNv & f1, const FuncNv & f2)
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt709Full; ++type)
+        {
+            result = result && NvToAnyAutoTest(W, H, dstType, f1, f2, (SimdYuvType)type);
+            result = result && NvToAnyAutoTest(W + O * 2, H - O * 2, dstType, f1, f2, (SimdYuvType)type);
+        }
+
+        return result;
+    }
+
+    bool Nv12ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && NvToAnyAutoTest(View::Bgra32, FUNC_NV(Simd::Base::Nv12ToBgra), FUNC_NV(SimdNv12ToBgra));
+        {
+            MultithreadedScope scope;
+            result = result && NvToAnyAutoTest(View::Bgra32, FUNC_NV(Simd::Base::Nv12ToBgra), TEST_MT_FUNC(FuncNv, SimdNv12ToBgra));
+        }
+        result = result && NvToAnyAutoTest(View::Bgra32, FUNC_NV(Nv12ToBgraTwoPass), FUNC_NV(SimdNv12ToBgra));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && NvToAnyAutoTest(View::Bgra32, FUNC_NV(Simd::Sse41::Nv12ToBgra), FUNC_NV(SimdNv12ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && NvToAnyAutoTest(View::Bgra32, FUNC_NV(Simd::Avx2::Nv12ToBgra), FUNC_NV(SimdNv12ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && NvToAnyAutoTest(View::Bgra32, FUNC_NV(Simd::Avx512bw::Nv12ToBgra), FUNC_NV(SimdNv12ToBgra));
+#endif 
+
+        return result;
+    }
+
+    bool Nv12ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Base::Nv12ToBgr), FUNC_NV(SimdNv12ToBgr));
+        {
+            MultithreadedScope scope;
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Base::Nv12ToBgr), TEST_MT_FUNC(FuncNv, SimdNv12ToBgr));
+        }
+        result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Nv12ToBgrTwoPass), FUNC_NV(SimdNv12ToBgr));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Sse41::Nv12ToBgr), FUNC_NV(SimdNv12ToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Avx2::Nv12ToBgr), FUNC_NV(SimdNv12ToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Avx512bw::Nv12ToBgr), FUNC_NV(SimdNv12ToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool Nv12ToRgbAutoTest()
+    {
+        bool result = true;
+
+        result = result && NvToAnyAutoTest(View::Rgb24, FUNC_NV(Simd::Base::Nv12ToRgb), FUNC_NV(SimdNv12ToRgb));
+        {
+            MultithreadedScope scope;
+            result = result && NvToAnyAutoTest(View::Rgb24, FUNC_NV(Simd::Base::Nv12ToRgb), TEST_MT_FUNC(FuncNv, SimdNv12ToRgb));
+        }
+        result = result && NvToAnyAutoTest(View::Rgb24, FUNC_NV(Nv12ToRgbTwoPass), FUNC_NV(SimdNv12ToRgb));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && NvToAnyAutoTest(View::Rgb24, FUNC_NV(Simd::Sse41::Nv12ToRgb), FUNC_NV(SimdNv12ToRgb));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && NvToAnyAutoTest(View::Rgb24, FUNC_NV(Simd::Avx2::Nv12ToRgb), FUNC_NV(SimdNv12ToRgb));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && NvToAnyAutoTest(View::Rgb24, FUNC_NV(Simd::Avx512bw::Nv12ToRgb), FUNC_NV(SimdNv12ToRgb));
+#endif 
+
+        return result;
+    }
+
+    bool Nv21ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && NvToAnyAutoTest(View::Bgra32, FUNC_NV(Simd::Base::Nv21ToBgra), FUNC_NV(SimdNv21ToBgra));
+        {
+            MultithreadedScope scope;
+            result = result && NvToAnyAutoTest(View::Bgra32, FUNC_NV(Simd::Base::Nv21ToBgra), TEST_MT_FUNC(FuncNv, SimdNv21ToBgra));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && NvToAnyAutoTest(View::Bgra32, FUNC_NV(Simd::Sse41::Nv21ToBgra), FUNC_NV(SimdNv21ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && NvToAnyAutoTest(View::Bgra32, FUNC_NV(Simd::Avx2::Nv21ToBgra), FUNC_NV(SimdNv21ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && NvToAnyAutoTest(View::Bgra32, FUNC_NV(Simd::Avx512bw::Nv21ToBgra), FUNC_NV(SimdNv21ToBgra));
+#endif 
+
+        return result;
+    }
+
+    bool Nv21ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Base::Nv21ToBgr), FUNC_NV(SimdNv21ToBgr));
+        {
+            MultithreadedScope scope;
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Base::Nv21ToBgr), TEST_MT_FUNC(FuncNv, SimdNv21ToBgr));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Sse41::Nv21ToBgr), FUNC_NV(SimdNv21ToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Avx2::Nv21ToBgr), FUNC_NV(SimdNv21ToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Avx512bw::Nv21ToBgr), FUNC_NV(SimdNv21ToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool Nv21ToRgbAutoTest()
+    {
+        bool result = true;
+
+        result = result && NvToAnyAutoTest(View::Rgb24, FUNC_NV(Simd::Base::Nv21ToRgb), FUNC_NV(SimdNv21ToRgb));
+        {
+            MultithreadedScope scope;
+            result = result && NvToAnyAutoTest(View::Rgb24, FUNC_NV(Simd::Base::Nv21ToRgb), TEST_MT_FUNC(FuncNv, SimdNv21ToRgb));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && NvToAnyAutoTest(View::Rgb24, FUNC_NV(Simd::Sse41::Nv21ToRgb), FUNC_NV(SimdNv21ToRgb));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && NvToAnyAutoTest(View::Rgb24, FUNC_NV(Simd::Avx2::Nv21ToRgb), FUNC_NV(SimdNv21ToRgb));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && NvToAnyAutoTest(View::Rgb24, FUNC_NV(Simd::Avx512bw::Nv21ToRgb), FUNC_NV(SimdNv21ToRgb));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncToNv
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * y, size_t yStride,
+                uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+            SimdYuvType yuvType;
+
+            FuncToNv(const FuncPtr & f, const String & d) : func(f), description(d), yuvType(SimdYuvBt601) {}
+
+            void Update(SimdYuvType t)
+            {
+                yuvType = t;
+                description = description + "[" + ToString(t) + "]";
+            }
+
+            void Call(const View & src, View & y, View & uv) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.width, src.height, src.stride, y.data, y.stride, uv.data, uv.stride, yuvType);
+            }
+        };
+    }
+
+#define FUNC_TO_NV(function) FuncToNv(function, #function)
+
+    static void BgraToNv12TwoPass(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+        uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+    {
+        View u(width / 2, height / 2, View::Gray8), v(width / 2, height / 2, View::Gray8);
+        SimdBgraToYuv420pV2(bgra, width, height, bgraStride, y, yStride, u.data, u.stride, v.data, v.stride, yuvType);
+        SimdInterleaveUv(u.data, u.stride, v.data, v.stride, u.width, u.height, uv, uvStride);
+    }
+
+    static void BgrToNv12TwoPass(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+    {
+        View u(width / 2, height / 2, View::Gray8), v(width / 2, height / 2, View::Gray8);
+        SimdBgrToYuv420pV2(bgr, width, height, bgrStride, y, yStride, u.data, u.stride, v.data, v.stride, yuvType);
+        SimdInterleaveUv(u.data, u.stride, v.data, v.stride, u.width, u.height, uv, uvStride);
+    }
+
+    bool AnyToNvAutoTest(int width, int height, View::Format srcType, FuncToNv f1, FuncToNv f2, SimdYuvType yuvType)
+    {
+        bool result = true;
+
+        f1.Update(yuvType);
+        f2.Update(yuvType);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width, height, srcType, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View y1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View uv1(width / 2, height / 2, View::Uv16, NULL, TEST_ALIGN(width));
+        View y2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View uv2(width / 2, height / 2, View::Uv16, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, y1, uv1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, y2, uv2));
+
+        result = result && Compare(y1, y2, 0, true, 64, 0, "y");
+        result = result && Compare(uv1, uv2, 0, true, 64, 0, "uv");
+
+        return result;
+    }
+
+    bool AnyToNvAutoTest(View::Format srcType, const FuncToNv & f1, const FuncToNv & f2)
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt709Full; ++type)
+        {
+            result = result && AnyToNvAutoTest(W, H, srcType, f1, f2, (SimdYuvType)type);
+            result = result && AnyToNvAutoTest(W + O * 2, H - O * 2, srcType, f1, f2, (SimdYuvType)type);
+        }
+
+        return result;
+    }
+
+    bool BgraToNv12AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToNvAutoTest(View::Bgra32, FUNC_TO_NV(Simd::Base::BgraToNv12), FUNC_TO_NV(SimdBgraToNv12));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToNvAutoTest(View::Bgra32, FUNC_TO_NV(Simd::Base::BgraToNv12), TEST_MT_FUNC(FuncToNv, SimdBgraToNv12));
+        }
+        result = result && AnyToNvAutoTest(View::Bgra32, FUNC_TO_NV(BgraToNv12TwoPass), FUNC_TO_NV(SimdBgraToNv12));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::DA)
+            result = result && AnyToNvAutoTest(View::Bgra32, FUNC_TO_NV(Simd::Sse41::BgraToNv12), FUNC_TO_NV(SimdBgraToNv12));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToNvAutoTest(View::Bgra32, FUNC_TO_NV(Simd::Avx2::BgraToNv12), FUNC_TO_NV(SimdBgraToNv12));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::DA)
+            result = result && AnyToNvAutoTest(View::Bgra32, FUNC_TO_NV(Simd::Avx512bw::BgraToNv12), FUNC_TO_NV(SimdBgraToNv12));
+#endif 
+
+        return result;
+    }
+
+    bool BgrToNv12AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToNvAutoTest(View::Bgr24, FUNC_TO_NV(Simd::Base::BgrToNv12), FUNC_TO_NV(SimdBgrToNv12));
+        {
+            MultithreadedScope scope;
+            result = result && AnyToNvAutoTest(View::Bgr24, FUNC_TO_NV(Simd::Base::BgrToNv12), TEST_MT_FUNC(FuncToNv, SimdBgrToNv12));
+        }
+        result = result && AnyToNvAutoTest(View::Bgr24, FUNC_TO_NV(BgrToNv12TwoPass), FUNC_TO_NV(SimdBgrToNv12));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::DA)
+            result = result && AnyToNvAutoTest(View::Bgr24, FUNC_TO_NV(Simd::Sse41::BgrToNv12), FUNC_TO_NV(SimdBgrToNv12));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToNvAutoTest(View::Bgr24, FUNC_TO_NV(Simd::Avx2::BgrToNv12), FUNC_TO_NV(SimdBgrToNv12));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::DA)
+            result = result && AnyToNvAutoTest(View::Bgr24, FUNC_TO_NV(Simd::Avx512bw::BgrToNv12), FUNC_TO_NV(SimdBgrToNv12));
+#endif 
+
+        return result;
+    }
+}
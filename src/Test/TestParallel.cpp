@@ -0,0 +1,137 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+
+#include "Simd/SimdParallel.hpp"
+
+#include <future>
+
+namespace Test
+{
+    namespace
+    {
+        template<class Function> void AsyncParallel(size_t begin, size_t end, const Function & function, size_t threadNumber, size_t blockAlign = 1)
+        {
+            threadNumber = std::min<size_t>(threadNumber, std::thread::hardware_concurrency());
+            if (threadNumber <= 1 || size_t(blockAlign * 1.5) >= (end - begin))
+                function(0, begin, end);
+            else
+            {
+                std::vector<std::future<void>> futures;
+                size_t blockSize = (end - begin + threadNumber - 1) / threadNumber;
+                blockSize = (blockSize + blockAlign - 1) / blockAlign * blockAlign;
+                size_t blockBegin = begin;
+                size_t blockEnd = std::min(blockBegin + blockSize, end);
+                for (size_t thread = 0; thread < threadNumber && blockBegin < end; ++thread)
+                {
+                    futures.push_back(std::move(std::async(std::launch::async, [blockBegin, blockEnd, thread, &function] { function(thread, blockBegin, blockEnd); })));
+                    blockBegin += blockSize;
+                    blockEnd = std::min(blockBegin + blockSize, end);
+                }
+                for (size_t i = 0; i < futures.size(); ++i)
+                    futures[i].wait();
+            }
+        }
+
+        void RowSums(const View & src, size_t begin, size_t end, uint32_t * sums)
+        {
+            for (size_t row = begin; row < end; ++row)
+            {
+                const uint8_t * p = src.Row<uint8_t>(row);
+                uint32_t sum = 0;
+                for (size_t col = 0; col < src.width; ++col)
+                    sum += p[col];
+                sums[row] = sum;
+            }
+        }
+
+        struct Func
+        {
+            bool pool;
+            String description;
+
+            Func(bool p, const String & d) : pool(p), description(d) {}
+
+            void Update(const View & src, size_t threads)
+            {
+                std::stringstream ss;
+                ss << description << "[" << src.width << "x" << src.height << "-" << threads << "]";
+                description = ss.str();
+            }
+
+            void Call(const View & src, size_t threads, Sums & sums) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                if (pool)
+                    Simd::Parallel(0, src.height, [&](size_t thread, size_t begin, size_t end) { RowSums(src, begin, end, sums.data()); }, threads);
+                else
+                    AsyncParallel(0, src.height, [&](size_t thread, size_t begin, size_t end) { RowSums(src, begin, end, sums.data()); }, threads);
+            }
+        };
+    }
+
+    bool ParallelAutoTest(size_t width, size_t height, size_t threads, Func f1, Func f2)
+    {
+        bool result = true;
+
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        f1.Update(src, threads);
+        f2.Update(src, threads);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << ".");
+
+        Sums sums1(height, 0), sums2(height, 0);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, threads, sums1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, threads, sums2));
+
+        for (size_t row = 0; row < height && result; ++row)
+        {
+            if (sums1[row] != sums2[row])
+            {
+                TEST_LOG_SS(Error, "Error at row " << row << ": " << sums1[row] << " != " << sums2[row] << ".");
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    bool ParallelAutoTest()
+    {
+        bool result = true;
+
+        size_t threads = std::max<size_t>(std::thread::hardware_concurrency(), 2);
+
+        result = result && ParallelAutoTest(16, 16, threads, Func(false, "Async"), Func(true, "Pool"));
+        result = result && ParallelAutoTest(64, 64, threads, Func(false, "Async"), Func(true, "Pool"));
+        result = result && ParallelAutoTest(W, H, threads, Func(false, "Async"), Func(true, "Pool"));
+
+        return result;
+    }
+}
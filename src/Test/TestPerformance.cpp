@@ -74,6 +74,7 @@ namespace Test
         , _max(std::numeric_limits<double>::min())
         , _entered(false)
         , _size(0)
+        , _batch(0)
     {
     }
 
@@ -85,6 +86,8 @@ namespace Test
         , _max(pm._max)
         , _entered(pm._entered)
         , _size(pm._size)
+        , _batch(pm._batch)
+        , _batches(pm._batches)
     {
     }
 
@@ -102,12 +105,24 @@ namespace Test
         if (_entered)
         {
             _entered = false;
+            if (Benchmark::Warmup())
+                return;
             double difference = double(GetTime() - _start);
             _total += difference;
             _min = std::min(_min, difference);
             _max = std::max(_max, difference);
             ++_count;
             _size += std::max<size_t>(1, size);
+            if (Benchmark::Batch())
+            {
+                if (_batch != Benchmark::Batch())
+                {
+                    _batch = Benchmark::Batch();
+                    _batches.push_back(std::pair<double, int>(0.0, 0));
+                }
+                _batches.back().first += difference;
+                _batches.back().second += 1;
+            }
         }
     }
 
@@ -116,6 +131,39 @@ namespace Test
         return _count ? (_total / _count) : 0;
     }
 
+    static void SortedBatchMeans(const std::vector<std::pair<double, int>> & batches, std::vector<double> & means)
+    {
+        means.resize(batches.size());
+        for (size_t i = 0; i < batches.size(); ++i)
+            means[i] = batches[i].first / batches[i].second;
+        std::sort(means.begin(), means.end());
+    }
+
+    double PerformanceMeasurer::Median() const
+    {
+        if (_batches.empty())
+            return Average();
+        std::vector<double> means;
+        SortedBatchMeans(_batches, means);
+        size_t n = means.size();
+        return n & 1 ? means[n / 2] : (means[n / 2 - 1] + means[n / 2]) * 0.5;
+    }
+
+    void PerformanceMeasurer::Interval(double & lo, double & hi) const
+    {
+        if (_batches.empty())
+        {
+            lo = _count ? _min : 0;
+            hi = _count ? _max : 0;
+            return;
+        }
+        std::vector<double> means;
+        SortedBatchMeans(_batches, means);
+        double n = double(means.size()), d = 0.98 * ::sqrt(n);
+        lo = means[(size_t)std::max(0.0, ::floor(n * 0.5 - d))];
+        hi = means[(size_t)std::min(n - 1.0, ::ceil(n * 0.5 + d) - 1.0)];
+    }
+
     String PerformanceMeasurer::Statistic() const
     {
         std::stringstream ss;
@@ -129,6 +177,24 @@ namespace Test
             double size = double(_size);
             ss << std::setprecision(3) << " [<s>=" << size / _count*0.001 << " kb; <t>=" << _total / size * 1000000000 << " ns]";
         }
+        if (_batches.size())
+        {
+            double lo, hi;
+            Interval(lo, hi);
+            ss << std::setprecision(3) << " {median=" << Median() * 1000.0 << "; ci95=[" << lo * 1000.0 << ", " << hi * 1000.0 << "]; batches=" << _batches.size() << "}";
+        }
+        return ss.str();
+    }
+
+    String PerformanceMeasurer::Json() const
+    {
+        double lo, hi;
+        Interval(lo, hi);
+        std::stringstream ss;
+        ss << std::setprecision(6) << std::fixed;
+        ss << "\"median_ms\": " << Median() * 1000.0 << ", \"ci_lo_ms\": " << lo * 1000.0 << ", \"ci_hi_ms\": " << hi * 1000.0;
+        ss << ", \"average_ms\": " << Average() * 1000.0 << ", \"min_ms\": " << (_count ? _min * 1000.0 : 0.0) << ", \"max_ms\": " << (_count ? _max * 1000.0 : 0.0);
+        ss << ", \"count\": " << _count << ", \"batches\": " << _batches.size();
         return ss.str();
     }
 
@@ -139,6 +205,54 @@ namespace Test
         _min = std::min(_min, other._min);
         _max = std::max(_max, other._max);
         _size += other._size;
+        _batches.insert(_batches.end(), other._batches.begin(), other._batches.end());
+    }
+
+    //-------------------------------------------------------------------------
+
+    thread_local bool Benchmark::s_warmup = false;
+    thread_local size_t Benchmark::s_batch = 0;
+    thread_local bool Benchmark::s_active = false;
+
+    Benchmark::Benchmark()
+        : _warmup(std::max(BENCHMARK_WARMUP, 1))
+        , _batches(std::max(BENCHMARK_BATCHES, 1))
+        , _iterations(1)
+        , _count(0)
+        , _total(0)
+        , _start(0)
+    {
+    }
+
+    bool Benchmark::Next()
+    {
+        if (_count < _warmup)
+        {
+            if (_count == 0)
+            {
+                s_warmup = true;
+                _start = GetTime();
+            }
+            _count++;
+            return true;
+        }
+        if (_count == _warmup)
+        {
+            s_warmup = false;
+            s_active = true;
+            double time = std::max((GetTime() - _start) / _warmup, 0.000001);
+            _iterations = std::max<size_t>(1, size_t(MINIMAL_TEST_EXECUTION_TIME / _batches / time));
+            _total = _warmup + _iterations * _batches;
+        }
+        if (_count == _total)
+        {
+            s_active = false;
+            return false;
+        }
+        if ((_count - _warmup) % _iterations == 0)
+            s_batch++;
+        _count++;
+        return true;
     }
 
     //-------------------------------------------------------------------------
@@ -175,6 +289,22 @@ namespace Test
         return pm;
     }
 
+    PerformanceMeasurerStorage::FunctionMap PerformanceMeasurerStorage::Combined() const
+    {
+        FunctionMap map;
+        std::lock_guard<std::recursive_mutex> lock(_mutex);
+        for (ThreadMap::const_iterator thread = _map.begin(); thread != _map.end(); ++thread)
+        {
+            for (FunctionMap::const_iterator function = thread->second.map.begin(); function != thread->second.map.end(); ++function)
+            {
+                if (map.find(function->first) == map.end())
+                    map[function->first].reset(new PerformanceMeasurer(function->first));
+                map[function->first]->Combine(*function->second);
+            }
+        }
+        return map;
+    }
+
     size_t PerformanceMeasurerStorage::Align(size_t size)
     {
         Thread & thread = ThisThread();
@@ -196,9 +326,14 @@ namespace Test
         }
     }
 
+    static inline double TypicalTime(const PerformanceMeasurer & pm)
+    {
+        return pm.Median();
+    }
+
     template <class Measurer> double Relation(const Measurer & a, const Measurer & b)
     {
-        return b.Average() > 0 ? a.Average() / b.Average() : 0;
+        return TypicalTime(b) > 0 ? TypicalTime(a) / TypicalTime(b) : 0;
     }
 
     class CommonPerformance
@@ -215,10 +350,10 @@ namespace Test
 
         void Add(const PerformanceMeasurer & pm)
         {
-            if (pm.Average() > 0)
+            if (pm.Median() > 0)
             {
                 _count++;
-                _value += ::log(pm.Average());
+                _value += ::log(pm.Median());
             }
         }
 
@@ -228,6 +363,11 @@ namespace Test
         }
     };
 
+    static inline double TypicalTime(const CommonPerformance & cp)
+    {
+        return cp.Average();
+    }
+
     struct Name
     {
         const char * full;
@@ -263,9 +403,12 @@ namespace Test
     typedef Statistic<bool> StatisticEnable;
     typedef Statistic<Name> StatisticNames;
 
-    template <class T> const T & Previous(const T & f)
+    template <class T> const T & Previous(const Statistic<T> & s, size_t i)
     {
-        return (&f)[-1].first.Average() > 0 ? (&f)[-1] : Previous((&f)[-1]);
+        for (size_t j = i - 1; j > 1; --j)
+            if (TypicalTime(s[j].first) > 0)
+                return s[j];
+        return s[1];
     }
 
     static inline void AddToFunction(const PerformanceMeasurer & src, Function & dst, bool & enable)
@@ -311,7 +454,7 @@ namespace Test
 
     static inline const Function & Cond(const Function & a, const Function & b)
     {
-        return a.first.Average() > 0 ? a : b;
+        return TypicalTime(a.first) > 0 ? a : b;
     }
 
     static inline void Add(const Function & src, Common & dst)
@@ -340,19 +483,7 @@ namespace Test
 
     String PerformanceMeasurerStorage::TextReport(bool align, bool raw) const
     {
-        FunctionMap map;
-        {
-            std::lock_guard<std::recursive_mutex> lock(_mutex);
-            for (ThreadMap::const_iterator thread = _map.begin(); thread != _map.end(); ++thread)
-            {
-                for (FunctionMap::const_iterator function = thread->second.map.begin(); function != thread->second.map.end(); ++function)
-                {
-                    if (map.find(function->first) == map.end())
-                        map[function->first].reset(new PerformanceMeasurer(function->first));
-                    map[function->first]->Combine(*function->second);
-                }
-            }
-        }
+        FunctionMap map = Combined();
 
         std::stringstream report;
 
@@ -405,7 +536,7 @@ namespace Test
         table.SetCell(col++, row, name);
         for (size_t i = 0; i < statistic.Size(); ++i)
             if (enable[i])
-                table.SetCell(col++, row, ToString(statistic[i].first.Average()*1000.0, V, false));
+                table.SetCell(col++, row, ToString(TypicalTime(statistic[i].first)*1000.0, V, false));
         if (enable[1])
         {
             for (size_t i = 2; i < statistic.Size(); ++i)
@@ -413,7 +544,7 @@ namespace Test
                     table.SetCell(col++, row, ToString(Test::Relation(statistic[1].first, statistic[i].first), R, false));
             for (size_t i = 2; i < statistic.Size(); ++i)
                 if (enable[i])
-                    table.SetCell(col++, row, ToString(Test::Relation(Previous(statistic[i]).first, statistic[i].first), R, false));
+                    table.SetCell(col++, row, ToString(Test::Relation(Previous(statistic, i).first, statistic[i].first), R, false));
         }
         if (align)
         {
@@ -425,19 +556,7 @@ namespace Test
 
     PerformanceMeasurerStorage::TablePtr PerformanceMeasurerStorage::GenerateTable(bool align) const
     {
-        FunctionMap map;
-        {
-            std::lock_guard<std::recursive_mutex> lock(_mutex);
-            for (ThreadMap::const_iterator thread = _map.begin(); thread != _map.end(); ++thread)
-            {
-                for (FunctionMap::const_iterator function = thread->second.map.begin(); function != thread->second.map.end(); ++function)
-                {
-                    if (map.find(function->first) == map.end())
-                        map[function->first].reset(new PerformanceMeasurer(function->first));
-                    map[function->first]->Combine(*function->second);
-                }
-            }
-        }
+        FunctionMap map = Combined();
 
         FunctionStatisticMap functions;
         CommonStatistic common;
@@ -453,11 +572,14 @@ namespace Test
         for (FunctionStatisticMap::const_iterator it = functions.begin(); it != functions.end(); ++it)
             AddToCommon(it->second, enable, common);
 
-        size_t size = 0;
+        size_t size = 0, extra = 0;
         for (size_t i = 0; i < enable.Size(); ++i)
             if (enable[i])
                 size++;
-        TablePtr table(new Table(size*(align ? 4 : 3) - 3, 1 + functions.size()));
+        for (size_t i = 2; i < enable.Size() && enable[1]; ++i)
+            if (enable[i])
+                extra += 2;
+        TablePtr table(new Table(1 + size*(align ? 2 : 1) + extra, 1 + functions.size()));
         AddHeader(*table, names, enable, align);
         size_t row = 0;
         table->SetRowProp(row, true, true);
@@ -495,6 +617,134 @@ namespace Test
         return true;
     }
 
+    static String IsaName(const String & description)
+    {
+        static const char * isas[] = { "Base", "Sse", "Sse2", "Sse3", "Ssse3", "Sse41", "Sse42", "Avx", "Avx2",
+            "Avx512f", "Avx512bw", "Avx512vnni", "Vmx", "Vsx", "Neon" };
+        for (size_t i = 0; i < sizeof(isas) / sizeof(isas[0]); ++i)
+            if (description.find(String("Simd::") + isas[i] + "::") != std::string::npos)
+                return isas[i];
+        return "Simd";
+    }
+
+    static String JsonEscape(const String & value)
+    {
+        String escaped;
+        for (size_t i = 0; i < value.size(); ++i)
+        {
+            if (value[i] == '"' || value[i] == '\\')
+                escaped.push_back('\\');
+            escaped.push_back(value[i]);
+        }
+        return escaped;
+    }
+
+    bool PerformanceMeasurerStorage::JsonReport(const String & path) const
+    {
+        if (path.find_last_of("/\\") != String::npos)
+            CreatePathIfNotExist(path);
+        std::ofstream file(path);
+        if (!file.is_open())
+            return false;
+
+        FunctionMap map = Combined();
+        file << "{" << std::endl;
+        file << "  \"version\": \"" << SimdVersion() << "\"," << std::endl;
+        file << "  \"time\": \"" << GetCurrentDateTimeString() << "\"," << std::endl;
+        file << "  \"isa\": \"" << ToString((SimdIsaType)SimdCpuInfo(SimdCpuInfoIsa)) << "\"," << std::endl;
+        file << "  \"threads\": " << SimdGetThreadNumber() << "," << std::endl;
+        file << "  \"functions\": [" << std::endl;
+        for (FunctionMap::const_iterator it = map.begin(); it != map.end(); ++it)
+        {
+            const PerformanceMeasurer & pm = *it->second;
+            file << "    {\"name\": \"" << JsonEscape(pm.Description()) << "\", ";
+            file << "\"function\": \"" << JsonEscape(FunctionShortName(pm.Description())) << "\", ";
+            file << "\"isa\": \"" << IsaName(pm.Description()) << "\", " << pm.Json() << "}";
+            file << (std::next(it) == map.end() ? "" : ",") << std::endl;
+        }
+        file << "  ]" << std::endl;
+        file << "}" << std::endl;
+        file.close();
+
+        return true;
+    }
+
+    struct BaselineValue
+    {
+        double median, lo, hi;
+    };
+
+    static bool ReadNumber(const String & line, const String & key, double & value)
+    {
+        size_t pos = line.find("\"" + key + "\": ");
+        if (pos == String::npos)
+            return false;
+        value = ::atof(line.c_str() + pos + key.size() + 4);
+        return true;
+    }
+
+    static bool LoadBaseline(const String & path, std::map<String, BaselineValue> & baseline)
+    {
+        std::ifstream file(path);
+        if (!file.is_open())
+            return false;
+        String line;
+        while (std::getline(file, line))
+        {
+            const String prefix = "{\"name\": \"";
+            size_t beg = line.find(prefix);
+            if (beg == String::npos)
+                continue;
+            String name;
+            for (size_t i = beg + prefix.size(); i < line.size() && line[i] != '"'; ++i)
+            {
+                if (line[i] == '\\' && i + 1 < line.size())
+                    i++;
+                name.push_back(line[i]);
+            }
+            BaselineValue value;
+            if (ReadNumber(line, "median_ms", value.median) && ReadNumber(line, "ci_lo_ms", value.lo) && ReadNumber(line, "ci_hi_ms", value.hi))
+                baseline[name] = value;
+        }
+        return true;
+    }
+
+    bool PerformanceMeasurerStorage::CompareWithBaseline(const String & path, double threshold, size_t & regressions) const
+    {
+        regressions = 0;
+        std::map<String, BaselineValue> baseline;
+        if (!LoadBaseline(path, baseline))
+        {
+            TEST_LOG_SS(Error, "Can't load performance baseline from '" << path << "'!");
+            return false;
+        }
+
+        FunctionMap map = Combined();
+        size_t compared = 0;
+        std::stringstream report;
+        report << std::fixed << std::setprecision(3);
+        for (FunctionMap::const_iterator it = map.begin(); it != map.end(); ++it)
+        {
+            const PerformanceMeasurer & pm = *it->second;
+            std::map<String, BaselineValue>::const_iterator base = baseline.find(pm.Description());
+            if (base == baseline.end() || base->second.median <= 0 || pm.Median() <= 0)
+                continue;
+            compared++;
+            double lo, hi, median = pm.Median() * 1000.0;
+            pm.Interval(lo, hi);
+            if (median > base->second.median * (1.0 + threshold) && lo * 1000.0 > base->second.hi)
+            {
+                regressions++;
+                report << pm.Description() << ": " << base->second.median << " ms -> " << median << " ms (";
+                report << std::setprecision(1) << (median / base->second.median - 1.0) * 100.0 << std::setprecision(3) << "%)" << std::endl;
+            }
+        }
+
+        TEST_LOG_SS(Info, "Comparison with performance baseline '" << path << "' (threshold " << threshold * 100.0 << "%): " 
+            << compared << " functions are compared, " << regressions << " regressions are found." << std::endl << report.str());
+        return true;
+    }
+
     void PerformanceMeasurerStorage::Clear()
     {
         _map.clear();
@@ -44,6 +44,9 @@ namespace Test
 
         long long _size;
 
+        size_t _batch;
+        std::vector<std::pair<double, int>> _batches;
+
     public:
         PerformanceMeasurer(const String & description = "Unnamed");
         PerformanceMeasurer(const PerformanceMeasurer & pm);
@@ -52,7 +55,10 @@ namespace Test
         void Leave(size_t size = 1);
 
         double Average() const;
+        double Median() const;
+        void Interval(double & lo, double & hi) const;
         String Statistic() const;
+        String Json() const;
 
         String Description() const { return _description; }
 
@@ -90,6 +96,26 @@ namespace Test
 
     //-------------------------------------------------------------------------
 
+    class Benchmark
+    {
+        size_t _warmup, _batches, _iterations, _count, _total;
+        double _start;
+
+        static thread_local bool s_warmup;
+        static thread_local size_t s_batch;
+        static thread_local bool s_active;
+
+    public:
+        Benchmark();
+
+        bool Next();
+
+        static bool Warmup() { return s_warmup; }
+        static size_t Batch() { return s_active ? s_batch : 0; }
+    };
+
+    //-------------------------------------------------------------------------
+
     class PerformanceMeasurerStorage
     {
         typedef PerformanceMeasurer Pm;
@@ -107,6 +133,8 @@ namespace Test
 
         Thread & ThisThread();
 
+        FunctionMap Combined() const;
+
         typedef std::shared_ptr<class Table> TablePtr;
         TablePtr GenerateTable(bool align) const;
 
@@ -124,6 +152,10 @@ namespace Test
 
         bool HtmlReport(const String & path, bool align = false) const;
 
+        bool JsonReport(const String & path) const;
+
+        bool CompareWithBaseline(const String & path, double threshold, size_t & regressions) const;
+
         void Clear();
     };
 }
@@ -145,14 +177,27 @@ namespace Test
 #ifdef NDEBUG
 #define TEST_EXECUTE_AT_LEAST_MIN_TIME(test) \
 { \
-	double startTime = Test::GetTime(); \
-	do \
-	{ \
-        if(Test::LITTER_CPU_CACHE) \
-            Simd::LitterCpuCache(Test::LITTER_CPU_CACHE); \
-		test; \
-	} \
-	while(Test::GetTime() - startTime < Test::MINIMAL_TEST_EXECUTION_TIME); \
+    if(Test::BENCHMARK_BATCHES) \
+    { \
+        Test::Benchmark benchmark; \
+        while(benchmark.Next()) \
+        { \
+            if(Test::LITTER_CPU_CACHE) \
+                Simd::LitterCpuCache(Test::LITTER_CPU_CACHE); \
+            test; \
+        } \
+    } \
+    else \
+    { \
+	    double startTime = Test::GetTime(); \
+	    do \
+	    { \
+            if(Test::LITTER_CPU_CACHE) \
+                Simd::LitterCpuCache(Test::LITTER_CPU_CACHE); \
+		    test; \
+	    } \
+	    while(Test::GetTime() - startTime < Test::MINIMAL_TEST_EXECUTION_TIME); \
+    } \
 }
 #else
 #define TEST_EXECUTE_AT_LEAST_MIN_TIME(test) \
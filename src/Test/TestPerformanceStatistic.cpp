@@ -0,0 +1,109 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+
+#include "Simd/SimdPerformance.h"
+
+namespace Test
+{
+    namespace
+    {
+        double JsonValue(const String & json, const String & key)
+        {
+            size_t pos = json.find("\"" + key + "\": ");
+            return pos == String::npos ? -1.0 : ::atof(json.c_str() + pos + key.size() + 4);
+        }
+
+        bool CheckValue(const String & json, const String & key, double expected, double epsilon)
+        {
+            double value = JsonValue(json, key);
+            if (::fabs(value - expected) > epsilon)
+            {
+                TEST_LOG_SS(Error, "Wrong value of '" << key << "': " << value << " instead of " << expected << " in " << json << " !");
+                return false;
+            }
+            return true;
+        }
+    }
+
+    bool PerformanceStatisticAutoTest()
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test performance statistic.");
+
+        const int64_t ms = Simd::TimeFrequency() / 1000;
+        const size_t count = 100;
+        Simd::Base::PerformanceMeasurer pm("Test \"quoted\"", 0, 1000000);
+        for (size_t i = 1; i <= count; ++i)
+            pm.Add(i * ms);
+
+        String json = pm.Json();
+        const char * keys[] = { "name", "count", "total_ms", "average_ms", "min_ms", "max_ms", "p50_ms", "p90_ms", "p99_ms", "gflops", "gbps" };
+        size_t pos = 0;
+        for (size_t i = 0; i < sizeof(keys) / sizeof(keys[0]) && result; ++i)
+        {
+            size_t next = json.find(String("\"") + keys[i] + "\": ", pos);
+            if (next == String::npos)
+            {
+                TEST_LOG_SS(Error, "Can't find key '" << keys[i] << "' in " << json << " !");
+                result = false;
+            }
+            pos = next;
+        }
+        if (result && (json.front() != '{' || json.back() != '}' || json.find("\"name\": \"Test \\\"quoted\\\"\"") != 1))
+        {
+            TEST_LOG_SS(Error, "Wrong JSON format: " << json << " !");
+            result = false;
+        }
+
+        result = result && CheckValue(json, "count", double(count), 0.0);
+        result = result && CheckValue(json, "total_ms", 5050.0, 1.0);
+        result = result && CheckValue(json, "min_ms", 1.0, 0.01);
+        result = result && CheckValue(json, "max_ms", 100.0, 0.01);
+        result = result && CheckValue(json, "p50_ms", 50.0, 50.0 * 0.15);
+        result = result && CheckValue(json, "p90_ms", 90.0, 90.0 * 0.15);
+        result = result && CheckValue(json, "p99_ms", 99.0, 99.0 * 0.15);
+
+        Simd::Base::PerformanceMeasurer::ResetAll();
+        if (result && pm.Actual())
+        {
+            TEST_LOG_SS(Error, "Performance measurer is actual after reset!");
+            result = false;
+        }
+        pm.Add(2 * ms);
+        json = pm.Json();
+        result = result && CheckValue(json, "count", 1.0, 0.0);
+        result = result && CheckValue(json, "p50_ms", 2.0, 2.0 * 0.15);
+
+        String report = ::SimdPerformanceStatisticExport(SimdPerformanceStatisticJson);
+        if (result && report.size() && (report.front() != '[' || report.find("]") == String::npos))
+        {
+            TEST_LOG_SS(Error, "Wrong JSON performance report: " << report << " !");
+            result = false;
+        }
+
+        return result;
+    }
+}
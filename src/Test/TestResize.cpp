@@ -107,6 +107,11 @@ namespace Test
 
         result = result && ResizeAutoTest(FUNC_RB(Simd::Base::ResizeBilinear), FUNC_RB(SimdResizeBilinear));
 
+        {
+            MultithreadedScope scope;
+            result = result && ResizeAutoTest(FUNC_RB(Simd::Base::ResizeBilinear), TEST_MT_FUNC(FuncRB, SimdResizeBilinear));
+        }
+
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable)
             result = result && ResizeAutoTest(FUNC_RB(Simd::Sse2::ResizeBilinear), FUNC_RB(SimdResizeBilinear));
@@ -147,6 +152,10 @@ namespace Test
         case SimdResizeMethodBilinear: return "B";
         case SimdResizeMethodCaffeInterp: return "C";
         case SimdResizeMethodArea: return "A";
+        case SimdResizeMethodBicubic: return "BC";
+        case SimdResizeMethodBicubicPil: return "BP";
+        case SimdResizeMethodLanczos: return "L";
+        case SimdResizeMethodNearest: return "N";
         default: assert(0); return "";
         }
     }
@@ -157,6 +166,7 @@ namespace Test
         {
         case SimdResizeChannelByte:  return "b";
         case SimdResizeChannelFloat:  return "f";
+        case SimdResizeChannelShort:  return "s";
         default: assert(0); return "";
         }
     }
@@ -183,7 +193,7 @@ namespace Test
             void Call(const View & src, View & dst, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method) const
             {
                 void * resizer = NULL;
-                if(src.format == View::Float)
+                if(src.format == View::Float || src.format == View::Int16)
                     resizer = func(src.width / channels, src.height, dst.width / channels, dst.height, channels, type, method);
                 else
                     resizer = func(src.width, src.height, dst.width, dst.height, channels, type, method);
@@ -217,6 +227,12 @@ namespace Test
             srcW *= channels;
             dstW *= channels;
         }
+        else if (type == SimdResizeChannelShort)
+        {
+            format = View::Int16;
+            srcW *= channels;
+            dstW *= channels;
+        }
         else if (type == SimdResizeChannelByte)
         {
             switch (channels)
@@ -253,10 +269,11 @@ namespace Test
 
         TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, channels, type, method));
 
+        bool filter = method == SimdResizeMethodBicubic || method == SimdResizeMethodBicubicPil || method == SimdResizeMethodLanczos;
         if (format == View::Float)
-            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceAbsolute);
+            result = result && Compare(dst1, dst2, EPS, true, 64, filter ? DifferenceBoth : DifferenceAbsolute);
         else
-            result = result && Compare(dst1, dst2, 0, true, 64);
+            result = result && Compare(dst1, dst2, format == View::Int16 || filter ? 1 : 0, true, 64);
 
 #ifdef TEST_RESIZE_REAL_IMAGE
         if (format == View::Bgr24)
@@ -291,6 +308,30 @@ namespace Test
         return result;
     }
 
+    bool ResizerNearestAutoTest(SimdResizeChannelType type, int channels, const FuncRS & f1, const FuncRS & f2)
+    {
+        bool result = true;
+
+        result = result && ResizerAutoTest(SimdResizeMethodNearest, type, channels, 64, 48, 11, 17, f1, f2);
+        result = result && ResizerAutoTest(SimdResizeMethodNearest, type, channels, 64, 48, 128, 96, f1, f2);
+        result = result && ResizerAutoTest(SimdResizeMethodNearest, type, channels, 64, 48, 37, 29, f1, f2);
+
+        return result;
+    }
+
+    bool ResizerAreaAutoTest(SimdResizeChannelType type, int channels, const FuncRS & f1, const FuncRS & f2)
+    {
+        bool result = true;
+
+        result = result && ResizerAutoTest(SimdResizeMethodArea, type, channels, 64, 48, 11, 17, f1, f2);
+        result = result && ResizerAutoTest(SimdResizeMethodArea, type, channels, 64, 48, 32, 24, f1, f2);
+        result = result && ResizerAutoTest(SimdResizeMethodArea, type, channels, 66, 48, 22, 16, f1, f2);
+        result = result && ResizerAutoTest(SimdResizeMethodArea, type, channels, 64, 48, 16, 12, f1, f2);
+        result = result && ResizerAutoTest(SimdResizeMethodArea, type, channels, 64, 48, 37, 29, f1, f2);
+
+        return result;
+    }
+
     bool ResizerAutoTest(const FuncRS & f1, const FuncRS & f2)
     {
         bool result = true;
@@ -304,11 +345,36 @@ namespace Test
             result = result && ResizerAutoTest(method, SimdResizeChannelByte, 4, f1, f2);
             result = result && ResizerAutoTest(method, SimdResizeChannelFloat, 1, f1, f2);
             result = result && ResizerAutoTest(method, SimdResizeChannelFloat, 3, f1, f2);
+            result = result && ResizerAutoTest(method, SimdResizeChannelShort, 1, f1, f2);
+            result = result && ResizerAutoTest(method, SimdResizeChannelShort, 3, f1, f2);
         }
         result = result && ResizerAutoTest(SimdResizeMethodArea, SimdResizeChannelByte, 1, f1, f2);
         result = result && ResizerAutoTest(SimdResizeMethodArea, SimdResizeChannelByte, 2, f1, f2);
         result = result && ResizerAutoTest(SimdResizeMethodArea, SimdResizeChannelByte, 3, f1, f2);
         result = result && ResizerAutoTest(SimdResizeMethodArea, SimdResizeChannelByte, 4, f1, f2);
+        result = result && ResizerAreaAutoTest(SimdResizeChannelShort, 1, f1, f2);
+        result = result && ResizerAreaAutoTest(SimdResizeChannelShort, 3, f1, f2);
+        result = result && ResizerAreaAutoTest(SimdResizeChannelShort, 4, f1, f2);
+        result = result && ResizerAreaAutoTest(SimdResizeChannelFloat, 1, f1, f2);
+        result = result && ResizerAreaAutoTest(SimdResizeChannelFloat, 3, f1, f2);
+        result = result && ResizerAreaAutoTest(SimdResizeChannelFloat, 4, f1, f2);
+        for (SimdResizeMethodType method = SimdResizeMethodBicubic; method <= SimdResizeMethodLanczos; method = SimdResizeMethodType(method + 1))
+        {
+            result = result && ResizerAutoTest(method, SimdResizeChannelByte, 1, f1, f2);
+            result = result && ResizerAutoTest(method, SimdResizeChannelByte, 2, f1, f2);
+            result = result && ResizerAutoTest(method, SimdResizeChannelByte, 3, f1, f2);
+            result = result && ResizerAutoTest(method, SimdResizeChannelByte, 4, f1, f2);
+            result = result && ResizerAutoTest(method, SimdResizeChannelFloat, 1, f1, f2);
+            result = result && ResizerAutoTest(method, SimdResizeChannelFloat, 3, f1, f2);
+        }
+        result = result && ResizerNearestAutoTest(SimdResizeChannelByte, 1, f1, f2);
+        result = result && ResizerNearestAutoTest(SimdResizeChannelByte, 2, f1, f2);
+        result = result && ResizerNearestAutoTest(SimdResizeChannelByte, 3, f1, f2);
+        result = result && ResizerNearestAutoTest(SimdResizeChannelByte, 4, f1, f2);
+        result = result && ResizerNearestAutoTest(SimdResizeChannelShort, 1, f1, f2);
+        result = result && ResizerNearestAutoTest(SimdResizeChannelShort, 3, f1, f2);
+        result = result && ResizerNearestAutoTest(SimdResizeChannelFloat, 1, f1, f2);
+        result = result && ResizerNearestAutoTest(SimdResizeChannelFloat, 3, f1, f2);
 #endif
 
         return result;
@@ -370,6 +436,136 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    bool ResizerRunRowsAutoTest(SimdResizeMethodType method, SimdResizeChannelType type, size_t channels, size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t strip, FuncRS f)
+    {
+        bool result = true;
+
+        f.Update(method, type, channels);
+
+        TEST_LOG_SS(Info, "Test " << f.description << " by strips of " << strip << " rows [" << srcW << ", " << srcH << "] -> [" << dstW << ", " << dstH << "].");
+
+        View::Format format;
+        size_t width = 1;
+        if (type == SimdResizeChannelFloat)
+            format = View::Float, width = channels;
+        else if (type == SimdResizeChannelShort)
+            format = View::Int16, width = channels;
+        else
+            format = channels == 1 ? View::Gray8 : (channels == 2 ? View::Uv16 : (channels == 3 ? View::Bgr24 : View::Bgra32));
+
+        View src(srcW * width, srcH, format, NULL, TEST_ALIGN(srcW * width));
+        if (format == View::Float)
+            FillRandom32f(src);
+        else
+            FillRandom(src);
+        View part(srcW * width, srcH, format, NULL, TEST_ALIGN(srcW * width));
+        Simd::Fill(part, 0);
+
+        View dst1(dstW * width, dstH, format, NULL, TEST_ALIGN(dstW * width));
+        View dst2(dstW * width, dstH, format, NULL, TEST_ALIGN(dstW * width));
+        Simd::Fill(dst2, 0);
+
+        void * resizer = f.func(srcW, srcH, dstW, dstH, channels, type, method);
+
+        SimdResizerRun(resizer, src.data, src.stride, dst1.data, dst1.stride);
+
+        ParallelScope scope(4, 0);
+        for (size_t beg = 0, ready = 0; beg < srcH && result; beg += strip)
+        {
+            size_t end = Simd::Min(beg + strip, srcH);
+            Simd::Copy(src.Region(0, beg, src.width, end), part.Region(0, beg, part.width, end).Ref());
+            size_t rows = SimdResizerRunRows(resizer, part.data, part.stride, beg, end, dst2.data, dst2.stride);
+            if (rows < ready || rows > dstH || (end == srcH && rows != dstH))
+            {
+                TEST_LOG_SS(Error, "Wrong number of ready rows " << rows << " after strip [" << beg << ", " << end << ")!");
+                result = false;
+            }
+            else if (rows > ready)
+                result = result && Compare(dst1.Region(0, ready, dst1.width, rows), dst2.Region(0, ready, dst2.width, rows), 0, true, 64);
+            ready = rows;
+        }
+
+        SimdRelease(resizer);
+
+        return result;
+    }
+
+    bool ResizerRunRowsAutoTest(const FuncRS & f)
+    {
+        bool result = true;
+
+        for (size_t channels = 1; channels <= 4; ++channels)
+        {
+            result = result && ResizerRunRowsAutoTest(SimdResizeMethodBilinear, SimdResizeChannelByte, channels, 64, 48, 37, 29, 5, f);
+            result = result && ResizerRunRowsAutoTest(SimdResizeMethodBilinear, SimdResizeChannelByte, channels, 64, 48, 100, 77, 7, f);
+            result = result && ResizerRunRowsAutoTest(SimdResizeMethodArea, SimdResizeChannelByte, channels, 128, 96, 45, 37, 5, f);
+        }
+        result = result && ResizerRunRowsAutoTest(SimdResizeMethodBilinear, SimdResizeChannelFloat, 1, 64, 48, 37, 29, 5, f);
+        result = result && ResizerRunRowsAutoTest(SimdResizeMethodBilinear, SimdResizeChannelFloat, 3, 64, 48, 100, 77, 7, f);
+        result = result && ResizerRunRowsAutoTest(SimdResizeMethodBilinear, SimdResizeChannelShort, 1, 64, 48, 37, 29, 5, f);
+        result = result && ResizerRunRowsAutoTest(SimdResizeMethodArea, SimdResizeChannelShort, 1, 128, 96, 45, 37, 5, f);
+        result = result && ResizerRunRowsAutoTest(SimdResizeMethodArea, SimdResizeChannelFloat, 3, 128, 96, 64, 48, 7, f);
+        result = result && ResizerRunRowsAutoTest(SimdResizeMethodNearest, SimdResizeChannelByte, 3, 64, 48, 37, 29, 5, f);
+
+        return result;
+    }
+
+    bool ResizerRunRowsAutoTest()
+    {
+        bool result = true;
+
+        result = result && ResizerRunRowsAutoTest(FUNC_RS(Simd::Base::ResizerInit));
+
+#ifdef SIMD_SSE_ENABLE
+        if (Simd::Sse::Enable)
+            result = result && ResizerRunRowsAutoTest(FUNC_RS(Simd::Sse::ResizerInit));
+#endif 
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && ResizerRunRowsAutoTest(FUNC_RS(Simd::Sse2::ResizerInit));
+#endif 
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && ResizerRunRowsAutoTest(FUNC_RS(Simd::Ssse3::ResizerInit));
+#endif
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && ResizerRunRowsAutoTest(FUNC_RS(Simd::Sse41::ResizerInit));
+#endif
+
+#ifdef SIMD_AVX_ENABLE
+        if (Simd::Avx::Enable)
+            result = result && ResizerRunRowsAutoTest(FUNC_RS(Simd::Avx::ResizerInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && ResizerRunRowsAutoTest(FUNC_RS(Simd::Avx2::ResizerInit));
+#endif
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && ResizerRunRowsAutoTest(FUNC_RS(Simd::Avx512f::ResizerInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && ResizerRunRowsAutoTest(FUNC_RS(Simd::Avx512bw::ResizerInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && ResizerRunRowsAutoTest(FUNC_RS(Simd::Neon::ResizerInit));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     bool ResizeDataTest(bool create, int width, int height, View::Format format, const FuncRB & f)
     {
         bool result = true;
@@ -0,0 +1,150 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+
+#include "Simd/SimdRuntime.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct Args
+        {
+            size_t size;
+            Args(size_t s) : size(s) {}
+        };
+
+        struct Func
+        {
+            Func(const String & name, size_t * calls, size_t delay) : _name(name), _calls(calls), _delay(delay) {}
+
+            String Name() const { return _name; }
+
+            void Run(const Args & args)
+            {
+                (*_calls)++;
+                volatile size_t sum = 0;
+                for (size_t i = 0, n = args.size * _delay; i < n; ++i)
+                    sum += i;
+            }
+
+            String Info(const Args & args) const
+            {
+                return "Test [" + ToString(args.size) + "]";
+            }
+
+        private:
+            String _name;
+            size_t * _calls, _delay;
+        };
+    }
+
+    bool RuntimeCacheAutoTest()
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Simd::Runtime cache.");
+
+        ParallelScope parallel;
+
+        const size_t size = 1000, runs = 20;
+        size_t calls[2] = { 0, 0 };
+        std::vector<Func> funcs;
+        funcs.push_back(Func("Slow", calls + 0, 10));
+        funcs.push_back(Func("Fast", calls + 1, 1));
+
+        ::SimdRuntimeCacheClear();
+
+        Simd::Runtime<Func, Args> tuned;
+        tuned.Init(funcs);
+        for (size_t i = 0; i < runs; ++i)
+            tuned.Run(Args(size));
+        if (calls[0] == 0 || calls[1] == 0 || calls[0] + calls[1] != runs)
+        {
+            TEST_LOG_SS(Error, "Candidates were not tested: " << calls[0] << ", " << calls[1] << "!");
+            result = false;
+        }
+
+        std::vector<char> data(::SimdRuntimeCacheExport(NULL, 0));
+        ::SimdRuntimeCacheExport(data.data(), data.size());
+        String cache = data.data();
+        size_t pos = cache.find("|Test [1000]|" + ToString(::SimdGetThreadNumber()) + "|Slow,Fast|");
+        if (result && pos == String::npos)
+        {
+            TEST_LOG_SS(Error, "Runtime cache does not contain tuning result: '" << cache << "'!");
+            result = false;
+        }
+        String best = result ? cache.substr(cache.rfind('|') + 1, 4) : String();
+
+        ::SimdRuntimeCacheClear();
+        if (result && ::SimdRuntimeCacheImport(cache.c_str()) != SimdTrue)
+        {
+            TEST_LOG_SS(Error, "Can't import runtime cache!");
+            result = false;
+        }
+
+        calls[0] = 0, calls[1] = 0;
+        Simd::Runtime<Func, Args> cached;
+        cached.Init(funcs);
+        for (size_t i = 0; i < runs && result; ++i)
+            cached.Run(Args(size));
+        size_t expected = best == "Slow" ? 0 : 1;
+        if (result && (calls[expected] != runs || calls[1 - expected] != 0))
+        {
+            TEST_LOG_SS(Error, "Cached candidate " << best << " was not used: " << calls[0] << ", " << calls[1] << "!");
+            result = false;
+        }
+
+        if (result && ::SimdRuntimeCacheImport("Wrong format") != SimdFalse)
+        {
+            TEST_LOG_SS(Error, "Wrong runtime cache was imported!");
+            result = false;
+        }
+
+        if (result && ::SimdRuntimeCacheImport(NULL) != SimdFalse)
+        {
+            TEST_LOG_SS(Error, "NULL runtime cache was imported!");
+            result = false;
+        }
+
+        size_t threads = ::SimdGetThreadNumber();
+        {
+            ParallelScope scope(threads > 1 ? 1 : 2, ::SimdGetParallelThreshold());
+            calls[0] = 0, calls[1] = 0;
+            Simd::Runtime<Func, Args> other;
+            other.Init(funcs);
+            for (size_t i = 0; i < runs && result; ++i)
+                other.Run(Args(size));
+            if (result && (calls[0] == 0 || calls[1] == 0))
+            {
+                TEST_LOG_SS(Error, "Cached candidate was used for other number of threads: " << calls[0] << ", " << calls[1] << "!");
+                result = false;
+            }
+        }
+
+        ::SimdRuntimeCacheClear();
+
+        return result;
+    }
+}
@@ -328,6 +328,166 @@ namespace Test
 
     //-------------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncSIB
+        {
+            typedef void(*FuncPtr)(const uint8_t* src, size_t width, size_t height, size_t stride, SimdPixelFormatType pixelFormat,
+                const float* rois, size_t count, size_t dstWidth, size_t dstHeight, const float* lower, const float* upper, float* dst, size_t channels, SimdTensorFormatType dstFormat);
+
+            FuncPtr func;
+            String desc;
+
+            FuncSIB(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t n, size_t c, size_t h, size_t w, View::Format src, SimdTensorFormatType dst)
+            {
+                desc = desc + "[" + ToString(n) + "x" + ToString(c) + "x" + ToString(h) + "x" + ToString(w) + ":" + ToString(src) + "->" + ToString(dst) + "]";
+            }
+
+            void Call(const View& src, const Buffer32f & rois, const float* lower, const float* upper, size_t channels, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.data, src.width, src.height, src.stride, (SimdPixelFormatType)src.format, rois.data(), rois.size() / 4, 
+                    dst.Axis(dst.Format() == SimdTensorFormatNchw ? 3 : 2), dst.Axis(dst.Format() == SimdTensorFormatNchw ? 2 : 1), lower, upper, dst.Data(), channels, dst.Format());
+            }
+        };
+    }
+
+#define FUNC_SIB(function) FuncSIB(function, #function)
+
+    bool SynetSetInputBatchAutoTest(size_t n, size_t c, size_t h, size_t w, View::Format srcFormat, SimdTensorFormatType dstFormat, FuncSIB f1, FuncSIB f2)
+    {
+        bool result = true;
+
+        assert(c == 1 || c == 3);
+
+        f1.Update(n, c, h, w, srcFormat, dstFormat);
+        f2.Update(n, c, h, w, srcFormat, dstFormat);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc);
+
+        View src(W, H, srcFormat);
+        FillRandom(src);
+        Buffer32f rois(n * 4);
+        for (size_t i = 0; i < n; ++i)
+        {
+            float size = float(Random(int(H / 2)) + 2) + float(Random());
+            rois[i * 4 + 0] = float(Random(int(W)) - 4) + float(Random());
+            rois[i * 4 + 1] = float(Random(int(H)) - 4) + float(Random());
+            rois[i * 4 + 2] = rois[i * 4 + 0] + size;
+            rois[i * 4 + 3] = rois[i * 4 + 1] + size * float(h) / float(w);
+            if (i % 3 == 1)
+            {
+                float shift = float(Random(8) + 1);
+                for (size_t j = 0; j < 4; ++j)
+                    rois[i * 4 + j] = rois[i * 4 - 4 + j] + shift;
+            }
+        }
+        Tensor32f dst1(ToShape(n, c, h, w, dstFormat), dstFormat);
+        Tensor32f dst2(ToShape(n, c, h, w, dstFormat), dstFormat);
+        TEST_ALIGN(SIMD_ALIGN);
+
+        float lower[3] = { -0.9f, -1.0f, -1.2f };
+        float upper[3] = { 0.91f, 1.01f, 1.21f };
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, rois, lower, upper, c, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, rois, lower, upper, c, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+
+        if (result)
+        {
+            Buffer32f swapped(rois);
+            for (size_t i = 0; i < n; i += 2)
+            {
+                std::swap(swapped[i * 4 + 0], swapped[i * 4 + 2]);
+                std::swap(swapped[i * 4 + 1], swapped[i * 4 + 3]);
+            }
+            Tensor32f dst3(ToShape(n, c, h, w, dstFormat), dstFormat);
+            f2.Call(src, swapped, lower, upper, c, dst3);
+            result = result && Compare(dst2, dst3, 0.0f, true, 64, DifferenceBoth, "swapped rois");
+        }
+
+        if (result && W >= w && H >= h)
+        {
+            Buffer32f exact(n * 4);
+            for (size_t i = 0; i < n; ++i)
+            {
+                float x = float(Random(int(W - w + 1))), y = float(Random(int(H - h + 1)));
+                exact[i * 4 + 0] = x, exact[i * 4 + 1] = y;
+                exact[i * 4 + 2] = x + float(w), exact[i * 4 + 3] = y + float(h);
+                if (i % 2)
+                {
+                    std::swap(exact[i * 4 + 0], exact[i * 4 + 2]);
+                    std::swap(exact[i * 4 + 1], exact[i * 4 + 3]);
+                }
+            }
+            Tensor32f dst4(ToShape(n, c, h, w, dstFormat), dstFormat);
+            Tensor32f dst5(ToShape(n, c, h, w, dstFormat), dstFormat);
+            f2.Call(src, exact, lower, upper, c, dst4);
+            for (size_t i = 0; i < n; ++i)
+            {
+                size_t x = (size_t)Simd::Min(exact[i * 4 + 0], exact[i * 4 + 2]), y = (size_t)Simd::Min(exact[i * 4 + 1], exact[i * 4 + 3]);
+                ::SimdSynetSetInput(src.data + y * src.stride + x * src.PixelSize(), w, h, src.stride, (SimdPixelFormatType)src.format,
+                    lower, upper, dst5.Data() + i * c * h * w, c, dstFormat);
+            }
+            result = result && Compare(dst4, dst5, EPS, true, 64, DifferenceBoth, "batch vs SynetSetInput");
+        }
+
+        return result;
+    }
+
+    bool SynetSetInputBatchAutoTest(const FuncSIB& f1, const FuncSIB& f2)
+    {
+        bool result = true;
+
+        View::Format srcFormat[4] = { View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24 };
+        size_t channels[2] = { 1, 3 };
+        SimdTensorFormatType dstFormat[2] = { SimdTensorFormatNchw, SimdTensorFormatNhwc };
+
+        for (int s = 0; s < 4; ++s)
+        {
+            for (int c = 0; c < 2; ++c)
+            {
+                for (int d = 0; d < 2; ++d)
+                {
+                    result = result && SynetSetInputBatchAutoTest(9, channels[c], 112, 112, srcFormat[s], dstFormat[d], f1, f2);
+                    result = result && SynetSetInputBatchAutoTest(3, channels[c], 64 + O / 2, 48 + O, srcFormat[s], dstFormat[d], f1, f2);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    bool SynetSetInputBatchAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetSetInputBatchAutoTest(FUNC_SIB(Simd::Base::SynetSetInputBatch), FUNC_SIB(SimdSynetSetInputBatch));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetSetInputBatchAutoTest(FUNC_SIB(Simd::Sse41::SynetSetInputBatch), FUNC_SIB(SimdSynetSetInputBatch));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetSetInputBatchAutoTest(FUNC_SIB(Simd::Avx2::SynetSetInputBatch), FUNC_SIB(SimdSynetSetInputBatch));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetSetInputBatchAutoTest(FUNC_SIB(Simd::Avx512bw::SynetSetInputBatch), FUNC_SIB(SimdSynetSetInputBatch));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
     namespace
     {
         struct FuncRT
@@ -0,0 +1,120 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestTensor.h"
+#include "Test/TestSynetConvolutionParam.h"
+
+namespace Test
+{
+    namespace
+    {
+        typedef Test::SynetConvolutionParam<false> Param;
+
+        struct Layer
+        {
+            Param p;
+            void * context;
+            Tensor32f src, weight, bias, params, dst1, dst2;
+
+            Layer(const Param & param)
+                : p(param)
+            {
+                const SimdConvolutionParameters & c = p.conv;
+                src.Reshape({ p.batch, p.trans ? c.srcH : c.srcC, p.trans ? c.srcW : c.srcH, p.trans ? c.srcC : c.srcW });
+                FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+                weight.Reshape({ p.trans ? c.kernelY : c.dstC, p.trans ? c.kernelX : c.srcC / c.group,
+                    p.trans ? c.srcC / c.group : c.kernelY, p.trans ? c.dstC : c.kernelX });
+                FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+                bias.Reshape({ c.dstC });
+                FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+                params.Reshape({ c.dstC });
+                FillRandom(params.Data(), params.Size(), 0.0f, 2.0f);
+                dst1.Reshape({ p.batch, p.trans ? c.dstH : c.dstC, p.trans ? c.dstW : c.dstH, p.trans ? c.dstC : c.dstW });
+                dst2.Reshape(dst1.Shape());
+                context = ::SimdSynetConvolution32fInit(p.batch, &p.conv, NULL);
+                ::SimdSynetConvolution32fSetParams(context, weight.Data(), NULL, bias.Data(), params.Data());
+            }
+
+            ~Layer()
+            {
+                ::SimdRelease(context);
+            }
+        };
+    }
+
+    bool SynetWorkspaceAutoTest()
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Synet workspace.");
+
+        Size _0(0, 0), _1(1, 1), _3(3, 3);
+        std::vector<std::shared_ptr<Layer>> layers;
+        layers.push_back(std::make_shared<Layer>(Param(1, 32, 16, 16, 32, _3, _1, _1, _1, _1, 1, SimdConvolutionActivationRelu, SimdTrue)));
+        layers.push_back(std::make_shared<Layer>(Param(1, 16, 24, 24, 48, _3, _1, _1, _1, _1, 1, SimdConvolutionActivationIdentity, SimdFalse)));
+        layers.push_back(std::make_shared<Layer>(Param(1, 48, 12, 12, 24, _1, _1, _1, _0, _0, 1, SimdConvolutionActivationIdentity, SimdFalse)));
+
+        void * workspace = ::SimdSynetWorkspaceInit();
+        size_t size = 0;
+        for (size_t i = 0; i < layers.size(); ++i)
+        {
+            size_t layer = ::SimdSynetWorkspaceAdd(workspace, layers[i]->context, SimdSynetLayerConvolution32f);
+            if (layer != ::SimdSynetConvolution32fExternalBufferSize(layers[i]->context) * sizeof(float))
+            {
+                TEST_LOG_SS(Error, "Wrong external buffer size of layer " << i << ": " << layer << "!");
+                result = false;
+            }
+            size = std::max(size, layer);
+        }
+        if (result && ::SimdSynetWorkspaceAdd(workspace, layers[0]->context, (SimdSynetLayerType)-1) != SIZE_MAX)
+        {
+            TEST_LOG_SS(Error, "Workspace accepts layer of unknown type!");
+            result = false;
+        }
+        if (result && ::SimdSynetWorkspaceSize(workspace) != size)
+        {
+            TEST_LOG_SS(Error, "Wrong workspace size: " << ::SimdSynetWorkspaceSize(workspace) << " != " << size << "!");
+            result = false;
+        }
+
+        float * buffer = (float*)::SimdSynetWorkspaceBuffer(workspace);
+        if (result && (buffer == NULL || size_t(buffer) % ::SimdAlignment() != 0))
+        {
+            TEST_LOG_SS(Error, "Wrong workspace buffer!");
+            result = false;
+        }
+
+        for (size_t i = 0; i < layers.size() && result; ++i)
+        {
+            Layer & l = *layers[i];
+            ::SimdSynetConvolution32fForward(l.context, l.src.Data(), NULL, l.dst1.Data());
+            ::SimdSynetConvolution32fForward(l.context, l.src.Data(), buffer, l.dst2.Data());
+            result = result && Compare(l.dst1, l.dst2, 0.0f, true, 64, DifferenceAbsolute);
+        }
+
+        ::SimdRelease(workspace);
+
+        return result;
+    }
+}
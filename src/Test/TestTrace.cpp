@@ -0,0 +1,178 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+
+#include "Simd/SimdLib.hpp"
+
+#include <mutex>
+#include <thread>
+#include <atomic>
+
+namespace Test
+{
+    namespace
+    {
+        struct Event
+        {
+            SimdTraceEventType type;
+            String name;
+            size_t thread;
+            int64_t size;
+        };
+
+        struct Events
+        {
+            std::mutex mutex;
+            std::vector<Event> events;
+
+            static void Callback(void * userData, SimdTraceEventType type, const char * name, size_t thread, int64_t size)
+            {
+                Events * events = (Events*)userData;
+                Event event = { type, name, thread, size };
+                std::lock_guard<std::mutex> lock(events->mutex);
+                events->events.push_back(event);
+            }
+        };
+
+        void TracedRegion(size_t size)
+        {
+            Simd::TraceScope scope("TracedRegion", size * size * size * 2);
+            Buffer32f a(size * size, 1.0f), b(size * size, 1.0f), c(size * size, 0.0f);
+            float alpha = 1.0f, beta = 0.0f;
+            ::SimdGemm32fNN(size, size, size, &alpha, a.data(), size, b.data(), size, &beta, c.data(), size);
+        }
+
+        bool Balanced(const std::vector<Event> & events)
+        {
+            std::map<size_t, std::vector<String>> stacks;
+            for (size_t i = 0; i < events.size(); ++i)
+            {
+                std::vector<String> & stack = stacks[events[i].thread];
+                if (events[i].type == SimdTraceEventBegin)
+                    stack.push_back(events[i].name);
+                else
+                {
+                    if (stack.empty() || stack.back() != events[i].name)
+                        return false;
+                    stack.pop_back();
+                }
+            }
+            for (std::map<size_t, std::vector<String>>::const_iterator it = stacks.begin(); it != stacks.end(); ++it)
+                if (!it->second.empty())
+                    return false;
+            return true;
+        }
+
+        void LibraryRegions(size_t size, const std::atomic<bool> * stop)
+        {
+            Buffer32f a(size * size, 1.0f), b(size * size, 1.0f), c(size * size, 0.0f);
+            float alpha = 1.0f, beta = 0.0f;
+            do
+                ::SimdGemm32fNN(size, size, size, &alpha, a.data(), size, b.data(), size, &beta, c.data(), size);
+            while (!stop->load());
+        }
+    }
+
+    bool TraceAutoTest()
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test tracing of instrumented regions.");
+
+        const size_t size = 64;
+        static Events events;
+        events.events.clear();
+        ::SimdSetTraceCallback(Events::Callback, &events);
+        TracedRegion(size);
+        ::SimdSetTraceCallback(NULL, NULL);
+
+        if (events.events.size() < 2 || events.events.front().name != "TracedRegion" || events.events.front().size != size * size * size * 2)
+        {
+            TEST_LOG_SS(Error, "Begin event of user's region is wrong!");
+            result = false;
+        }
+        if (result && !Balanced(events.events))
+        {
+            TEST_LOG_SS(Error, "Begin and end events are not balanced!");
+            result = false;
+        }
+
+        size_t count = events.events.size();
+        TracedRegion(size);
+        if (result && (events.events.size() != count || ::SimdTraceEnabled() != SimdFalse))
+        {
+            TEST_LOG_SS(Error, "Tracing callback was not reset!");
+            result = false;
+        }
+
+        static Events first, second;
+        first.events.clear();
+        second.events.clear();
+        std::atomic<bool> stop(false);
+        std::thread thread(LibraryRegions, size, &stop);
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            if (i % 3 == 2)
+                ::SimdSetTraceCallback(NULL, NULL);
+            else
+                ::SimdSetTraceCallback(Events::Callback, i % 3 ? &second : &first);
+        }
+        ::SimdSetTraceCallback(NULL, NULL);
+        stop.store(true);
+        thread.join();
+        if (result && (!Balanced(first.events) || !Balanced(second.events)))
+        {
+            TEST_LOG_SS(Error, "Callback and user data are mixed up while the callback is changed!");
+            result = false;
+        }
+
+        const String path = "_trace_test.json";
+        if (result && ::SimdChromeTraceStart(path.c_str()) != SimdTrue)
+        {
+            TEST_LOG_SS(Error, "Can't start Chrome trace!");
+            result = false;
+        }
+        if (result)
+        {
+            TracedRegion(size);
+            if (::SimdChromeTraceStop() != SimdTrue)
+            {
+                TEST_LOG_SS(Error, "Can't write Chrome trace!");
+                result = false;
+            }
+            std::ifstream ifs(path.c_str());
+            std::stringstream trace;
+            trace << ifs.rdbuf();
+            ifs.close();
+            if (result && (trace.str().find("{\"traceEvents\": [") != 0 || trace.str().find("\"name\": \"TracedRegion\"") == String::npos))
+            {
+                TEST_LOG_SS(Error, "Chrome trace is wrong: " << trace.str());
+                result = false;
+            }
+            ::remove(path.c_str());
+        }
+
+        return result;
+    }
+}
@@ -158,6 +158,39 @@ namespace Test
         case View::Hsv24:     return "Hsv24";
         case View::Hsl24:     return "Hsl24";
         case View::Rgb24:     return "Rgb24";
+        case View::Yuyv16:    return "Yuyv16";
+        case View::Uyvy16:    return "Uyvy16";
+        case View::Uv32:      return "Uv32";
+        case View::Lab24:     return "Lab24";
+        default: assert(0);  return "";
+        }
+    }
+
+    template <> SIMD_INLINE String ToString<SimdIsaType>(const SimdIsaType & value)
+    {
+        switch (value)
+        {
+        case SimdIsaBase:       return "Base";
+        case SimdIsaVmx:        return "Vmx";
+        case SimdIsaVsx:        return "Vsx";
+        case SimdIsaNeon:       return "Neon";
+        case SimdIsaSse2:       return "Sse2";
+        case SimdIsaSse41:      return "Sse41";
+        case SimdIsaAvx2:       return "Avx2";
+        case SimdIsaAvx512bw:   return "Avx512bw";
+        case SimdIsaAvx512vnni: return "Avx512vnni";
+        default: assert(0);  return "";
+        }
+    }
+
+    template <> SIMD_INLINE String ToString<SimdYuvType>(const SimdYuvType & value)
+    {
+        switch (value)
+        {
+        case SimdYuvBt601:     return "Bt601";
+        case SimdYuvBt709:     return "Bt709";
+        case SimdYuvBt601Full: return "Bt601Full";
+        case SimdYuvBt709Full: return "Bt709Full";
         default: assert(0);  return "";
         }
     }
@@ -206,6 +239,89 @@ namespace Test
     String DirectoryByPath(const String & path);
     bool CreatePath(const String & path);
     bool CreatePathIfNotExist(const String & path);
+
+    // Tests which change or depend on global settings of the library hold this mutex, so they run one after another.
+    inline std::recursive_mutex & GlobalSettingsMutex()
+    {
+        static std::recursive_mutex mutex;
+        return mutex;
+    }
+
+    // Sets thread number and parallel threshold of the library and restores them at exit.
+    // The thread number isn't restricted by hardware threads, so splitting of work is checked on any machine.
+    class ParallelScope
+    {
+        std::lock_guard<std::recursive_mutex> _lock;
+        size_t _threadNumber, _parallelThreshold;
+
+    public:
+        ParallelScope()
+            : _lock(GlobalSettingsMutex())
+            , _threadNumber(SimdGetThreadNumber())
+            , _parallelThreshold(SimdGetParallelThreshold())
+        {
+        }
+
+        ParallelScope(size_t threadNumber, size_t parallelThreshold)
+            : _lock(GlobalSettingsMutex())
+            , _threadNumber(SimdGetThreadNumber())
+            , _parallelThreshold(SimdGetParallelThreshold())
+        {
+            Simd::Base::ForceThreadNumber(threadNumber);
+            SimdSetParallelThreshold(parallelThreshold);
+        }
+
+        ~ParallelScope()
+        {
+            SimdSetParallelThreshold(_parallelThreshold);
+            Simd::Base::ForceThreadNumber(_threadNumber);
+        }
+    };
+
+    // Splits every multithreaded function into Max(2, hardware threads) parts. It is set once for a whole test,
+    // so measured time of "-mt" functions doesn't include creation and joining of worker threads.
+    class MultithreadedScope : public ParallelScope
+    {
+    public:
+        MultithreadedScope()
+            : ParallelScope(std::max<size_t>(2, std::thread::hardware_concurrency()), 0)
+        {
+        }
+    };
+
+    // Holds global settings of the library for a test which restricts instruction sets, and restores the restriction at exit.
+    class MaxIsaScope
+    {
+        std::lock_guard<std::recursive_mutex> _lock;
+        SimdIsaType _maxIsa;
+
+    public:
+        MaxIsaScope()
+            : _lock(GlobalSettingsMutex())
+            , _maxIsa(SimdGetMaxIsa())
+        {
+        }
+
+        ~MaxIsaScope()
+        {
+            SimdSetMaxIsa(_maxIsa);
+        }
+
+        SimdIsaType MaxIsa() const
+        {
+            return _maxIsa;
+        }
+    };
+
+    template<class Func, Func func> struct Multithreaded;
+
+    template<class... Args, void(*func)(Args...)> struct Multithreaded<void(*)(Args...), func>
+    {
+        static void Call(Args... args)
+        {
+            func(args...);
+        }
+    };
 }
 
 #define TEST_CHECK_VALUE(name) \
@@ -215,4 +331,7 @@ namespace Test
         return false; \
     } 
 
+#define TEST_MT_FUNC(Func, function) \
+    Func(Test::Multithreaded<decltype(&function), function>::Call, std::string(#function) + "-mt")
+
 #endif//__TestUtils_h__
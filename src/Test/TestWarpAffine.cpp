@@ -0,0 +1,195 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+
+#include "Simd/SimdWarpAffine.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncWA
+        {
+            typedef void* (*FuncPtr)(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+            FuncPtr func;
+            String description;
+
+            FuncWA(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t channels, SimdWarpAffineFlags flags)
+            {
+                std::stringstream ss;
+                ss << description << "[" << channels;
+                ss << ((flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelFloat ? "f" : "b");
+                ss << ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpBilinear ? "-bl" : "-nr");
+                ss << ((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderReplicate ? "-r" : "-c") << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, View& dst, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border) const
+            {
+                void* context = func(src.width / (src.format == View::Float ? channels : 1), src.height, src.stride,
+                    dst.width / (dst.format == View::Float ? channels : 1), dst.height, dst.stride, channels, mat, flags, border);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdWarpAffineRun(context, src.data, dst.data);
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_WA(function) FuncWA(function, #function)
+
+    bool WarpAffineAutoTest(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdWarpAffineFlags flags, FuncWA f1, FuncWA f2)
+    {
+        bool result = true;
+
+        f1.Update(channels, flags);
+        f2.Update(channels, flags);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << srcW << ", " << srcH << "] -> [" << dstW << ", " << dstH << "].");
+
+        bool isFloat = (flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelFloat;
+        View::Format format = View::Float;
+        if (isFloat)
+        {
+            srcW *= channels;
+            dstW *= channels;
+        }
+        else
+        {
+            switch (channels)
+            {
+            case 1: format = View::Gray8; break;
+            case 2: format = View::Uv16; break;
+            case 3: format = View::Bgr24; break;
+            case 4: format = View::Bgra32; break;
+            default:
+                assert(0);
+            }
+        }
+
+        View src(srcW, srcH, format, NULL, TEST_ALIGN(srcW));
+        if (isFloat)
+            FillRandom32f(src, 0.0f, 1.0f);
+        else
+            FillRandom(src);
+
+        uint8_t border[16];
+        float* border32f = (float*)border;
+        for (size_t c = 0; c < channels; ++c)
+        {
+            if (isFloat)
+                border32f[c] = 0.1f + 0.2f * float(c);
+            else
+                border[c] = uint8_t(11 + 77 * c);
+        }
+
+        double angle = 0.3, scale = 1.17;
+        double cx = double(srcW / (isFloat ? channels : 1)) * 0.5, cy = double(srcH) * 0.5;
+        double dx = double(dstW / (isFloat ? channels : 1)) * 0.5 + 3.3, dy = double(dstH) * 0.5 - 2.7;
+        float mat[6];
+        mat[0] = float(scale * ::cos(angle)), mat[1] = float(-scale * ::sin(angle));
+        mat[3] = float(scale * ::sin(angle)), mat[4] = float(scale * ::cos(angle));
+        mat[2] = float(dx - mat[0] * cx - mat[1] * cy);
+        mat[5] = float(dy - mat[3] * cx - mat[4] * cy);
+
+        View dst1(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        View dst2(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, channels, mat, flags, border));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, channels, mat, flags, border));
+
+        if (isFloat)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool WarpAffineAutoTest(size_t channels, SimdWarpAffineFlags type, const FuncWA& f1, const FuncWA& f2)
+    {
+        bool result = true;
+
+        SimdWarpAffineFlags interps[2] = { SimdWarpAffineInterpNearest, SimdWarpAffineInterpBilinear };
+        SimdWarpAffineFlags borders[2] = { SimdWarpAffineBorderConstant, SimdWarpAffineBorderReplicate };
+        for (int i = 0; i < 2; ++i)
+        {
+            for (int b = 0; b < 2; ++b)
+            {
+                SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(type | interps[i] | borders[b]);
+                result = result && WarpAffineAutoTest(W, H, W, H, channels, flags, f1, f2);
+                result = result && WarpAffineAutoTest(W + O, H - O, W - O, H + O, channels, flags, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool WarpAffineAutoTest(const FuncWA& f1, const FuncWA& f2)
+    {
+        bool result = true;
+
+        result = result && WarpAffineAutoTest(1, SimdWarpAffineChannelByte, f1, f2);
+        result = result && WarpAffineAutoTest(2, SimdWarpAffineChannelByte, f1, f2);
+        result = result && WarpAffineAutoTest(3, SimdWarpAffineChannelByte, f1, f2);
+        result = result && WarpAffineAutoTest(4, SimdWarpAffineChannelByte, f1, f2);
+        result = result && WarpAffineAutoTest(1, SimdWarpAffineChannelFloat, f1, f2);
+        result = result && WarpAffineAutoTest(3, SimdWarpAffineChannelFloat, f1, f2);
+        result = result && WarpAffineAutoTest(4, SimdWarpAffineChannelFloat, f1, f2);
+
+        return result;
+    }
+
+    bool WarpAffineAutoTest()
+    {
+        bool result = true;
+
+        result = result && WarpAffineAutoTest(FUNC_WA(Simd::Base::WarpAffineInit), FUNC_WA(SimdWarpAffineInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && WarpAffineAutoTest(FUNC_WA(Simd::Sse41::WarpAffineInit), FUNC_WA(SimdWarpAffineInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && WarpAffineAutoTest(FUNC_WA(Simd::Avx2::WarpAffineInit), FUNC_WA(SimdWarpAffineInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && WarpAffineAutoTest(FUNC_WA(Simd::Avx512bw::WarpAffineInit), FUNC_WA(SimdWarpAffineInit));
+#endif 
+
+        return result;
+    }
+}
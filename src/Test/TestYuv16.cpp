@@ -0,0 +1,258 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncY16
+        {
+            typedef void(*FuncPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                size_t width, size_t height, int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+            SimdYuvType yuvType;
+            int shift;
+
+            FuncY16(const FuncPtr & f, const String & d) : func(f), description(d), yuvType(SimdYuvBt601), shift(8) {}
+
+            void Update(SimdYuvType t, int s)
+            {
+                yuvType = t;
+                shift = s;
+                description = description + "[" + ToString(t) + "]";
+            }
+
+            void Call(const View & y, const View & u, const View & v, View & bgra) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, shift, bgra.data, bgra.stride, 0xFF, yuvType);
+            }
+        };
+    }
+
+#define FUNC_Y16(function) FuncY16(function, #function)
+
+    /*
+    * Reference: reduction of 16-bit planes to 8 bits and conversion of 8-bit YUV420P image.
+    */
+    static void Yuv420p16ToBgraTwoPass(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+    {
+        View y8(width, height, View::Gray8), u8(width / 2, height / 2, View::Gray8), v8(width / 2, height / 2, View::Gray8);
+        SimdUint16ToGray(y, width, height, yStride, shift, y8.data, y8.stride);
+        SimdUint16ToGray(u, width / 2, height / 2, uStride, shift, u8.data, u8.stride);
+        SimdUint16ToGray(v, width / 2, height / 2, vStride, shift, v8.data, v8.stride);
+        SimdYuv420pToBgraV2(y8.data, y8.stride, u8.data, u8.stride, v8.data, v8.stride, width, height, bgra, bgraStride, alpha, yuvType);
+    }
+
+    bool Yuv420p16ToBgraAutoTest(int width, int height, FuncY16 f1, FuncY16 f2, SimdYuvType yuvType, int shift)
+    {
+        bool result = true;
+
+        f1.Update(yuvType, shift);
+        f2.Update(yuvType, shift);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "] shift " << shift << ".");
+
+        View y(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View u(width / 2, height / 2, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom(u);
+        View v(width / 2, height / 2, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom(v);
+
+        View bgra1(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View bgra2(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, u, v, bgra1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, u, v, bgra2));
+
+        result = result && Compare(bgra1, bgra2, 0, true, 64);
+
+        return result;
+    }
+
+    bool Yuv420p16ToBgraAutoTest(const FuncY16 & f1, const FuncY16 & f2)
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt709Full; ++type)
+        {
+            result = result && Yuv420p16ToBgraAutoTest(W, H, f1, f2, (SimdYuvType)type, 8);
+            result = result && Yuv420p16ToBgraAutoTest(W + O * 2, H - O * 2, f1, f2, (SimdYuvType)type, 2);
+            result = result && Yuv420p16ToBgraAutoTest(W - O * 2, H + O * 2, f1, f2, (SimdYuvType)type, 8);
+        }
+
+        return result;
+    }
+
+    bool Yuv420p16ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuv420p16ToBgraAutoTest(FUNC_Y16(Simd::Base::Yuv420p16ToBgra), FUNC_Y16(SimdYuv420p16ToBgra));
+        {
+            MultithreadedScope scope;
+            result = result && Yuv420p16ToBgraAutoTest(FUNC_Y16(Simd::Base::Yuv420p16ToBgra), TEST_MT_FUNC(FuncY16, SimdYuv420p16ToBgra));
+        }
+        result = result && Yuv420p16ToBgraAutoTest(FUNC_Y16(Yuv420p16ToBgraTwoPass), FUNC_Y16(SimdYuv420p16ToBgra));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && Yuv420p16ToBgraAutoTest(FUNC_Y16(Simd::Sse41::Yuv420p16ToBgra), FUNC_Y16(SimdYuv420p16ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && Yuv420p16ToBgraAutoTest(FUNC_Y16(Simd::Avx2::Yuv420p16ToBgra), FUNC_Y16(SimdYuv420p16ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && Yuv420p16ToBgraAutoTest(FUNC_Y16(Simd::Avx512bw::Yuv420p16ToBgra), FUNC_Y16(SimdYuv420p16ToBgra));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncP16
+        {
+            typedef void(*FuncPtr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+                int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+            SimdYuvType yuvType;
+            int shift;
+
+            FuncP16(const FuncPtr & f, const String & d) : func(f), description(d), yuvType(SimdYuvBt601), shift(8) {}
+
+            void Update(SimdYuvType t, int s)
+            {
+                yuvType = t;
+                shift = s;
+                description = description + "[" + ToString(t) + "]";
+            }
+
+            void Call(const View & y, const View & uv, View & bgra) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, shift, bgra.data, bgra.stride, 0xFF, yuvType);
+            }
+        };
+    }
+
+#define FUNC_P16(function) FuncP16(function, #function)
+
+    /*
+    * Reference: reduction of 16-bit planes to 8 bits and conversion of 8-bit NV12 image.
+    */
+    static void P016ToBgraTwoPass(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+        int shift, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+    {
+        View y8(width, height, View::Gray8), uv8(width / 2, height / 2, View::Uv16);
+        SimdUint16ToGray(y, width, height, yStride, shift, y8.data, y8.stride);
+        SimdUint16ToGray(uv, width, height / 2, uvStride, shift, uv8.data, uv8.stride);
+        SimdNv12ToBgra(y8.data, y8.stride, uv8.data, uv8.stride, width, height, bgra, bgraStride, alpha, yuvType);
+    }
+
+    bool P016ToBgraAutoTest(int width, int height, FuncP16 f1, FuncP16 f2, SimdYuvType yuvType, int shift)
+    {
+        bool result = true;
+
+        f1.Update(yuvType, shift);
+        f2.Update(yuvType, shift);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "] shift " << shift << ".");
+
+        View y(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View uv(width / 2, height / 2, View::Uv32, NULL, TEST_ALIGN(width));
+        FillRandom(uv);
+
+        View bgra1(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View bgra2(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, uv, bgra1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, uv, bgra2));
+
+        result = result && Compare(bgra1, bgra2, 0, true, 64);
+
+        return result;
+    }
+
+    bool P016ToBgraAutoTest(const FuncP16 & f1, const FuncP16 & f2)
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt709Full; ++type)
+        {
+            result = result && P016ToBgraAutoTest(W, H, f1, f2, (SimdYuvType)type, 8);
+            result = result && P016ToBgraAutoTest(W + O * 2, H - O * 2, f1, f2, (SimdYuvType)type, 6);
+            result = result && P016ToBgraAutoTest(W - O * 2, H + O * 2, f1, f2, (SimdYuvType)type, 8);
+        }
+
+        return result;
+    }
+
+    bool P016ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && P016ToBgraAutoTest(FUNC_P16(Simd::Base::P016ToBgra), FUNC_P16(SimdP016ToBgra));
+        {
+            MultithreadedScope scope;
+            result = result && P016ToBgraAutoTest(FUNC_P16(Simd::Base::P016ToBgra), TEST_MT_FUNC(FuncP16, SimdP016ToBgra));
+        }
+        result = result && P016ToBgraAutoTest(FUNC_P16(P016ToBgraTwoPass), FUNC_P16(SimdP016ToBgra));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && P016ToBgraAutoTest(FUNC_P16(Simd::Sse41::P016ToBgra), FUNC_P16(SimdP016ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && P016ToBgraAutoTest(FUNC_P16(Simd::Avx2::P016ToBgra), FUNC_P16(SimdP016ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && P016ToBgraAutoTest(FUNC_P16(Simd::Avx512bw::P016ToBgra), FUNC_P16(SimdP016ToBgra));
+#endif 
+
+        return result;
+    }
+}
@@ -93,6 +93,10 @@ namespace Test
         bool result = true;
 
         result = result && YuvToAnyAutoTest(1, 1, View::Bgr24, FUNC(Simd::Base::Yuv444pToBgr), FUNC(SimdYuv444pToBgr));
+        {
+            MultithreadedScope scope;
+            result = result && YuvToAnyAutoTest(1, 1, View::Bgr24, FUNC(Simd::Base::Yuv444pToBgr), TEST_MT_FUNC(Func, SimdYuv444pToBgr));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable)
@@ -127,6 +131,10 @@ namespace Test
         bool result = true;
 
         result = result && YuvToAnyAutoTest(2, 1, View::Bgr24, FUNC(Simd::Base::Yuv422pToBgr), FUNC(SimdYuv422pToBgr));
+        {
+            MultithreadedScope scope;
+            result = result && YuvToAnyAutoTest(2, 1, View::Bgr24, FUNC(Simd::Base::Yuv422pToBgr), TEST_MT_FUNC(Func, SimdYuv422pToBgr));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable)
@@ -161,6 +169,10 @@ namespace Test
         bool result = true;
 
         result = result && YuvToAnyAutoTest(2, 2, View::Bgr24, FUNC(Simd::Base::Yuv420pToBgr), FUNC(SimdYuv420pToBgr));
+        {
+            MultithreadedScope scope;
+            result = result && YuvToAnyAutoTest(2, 2, View::Bgr24, FUNC(Simd::Base::Yuv420pToBgr), TEST_MT_FUNC(Func, SimdYuv420pToBgr));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable)
@@ -287,6 +299,10 @@ namespace Test
         bool result = true;
 
         result = result && YuvToAnyAutoTest(1, 1, View::Rgb24, FUNC(Simd::Base::Yuv444pToRgb), FUNC(SimdYuv444pToRgb));
+        {
+            MultithreadedScope scope;
+            result = result && YuvToAnyAutoTest(1, 1, View::Rgb24, FUNC(Simd::Base::Yuv444pToRgb), TEST_MT_FUNC(Func, SimdYuv444pToRgb));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable)
@@ -316,6 +332,10 @@ namespace Test
         bool result = true;
 
         result = result && YuvToAnyAutoTest(2, 1, View::Rgb24, FUNC(Simd::Base::Yuv422pToRgb), FUNC(SimdYuv422pToRgb));
+        {
+            MultithreadedScope scope;
+            result = result && YuvToAnyAutoTest(2, 1, View::Rgb24, FUNC(Simd::Base::Yuv422pToRgb), TEST_MT_FUNC(Func, SimdYuv422pToRgb));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable)
@@ -345,6 +365,10 @@ namespace Test
         bool result = true;
 
         result = result && YuvToAnyAutoTest(2, 2, View::Rgb24, FUNC(Simd::Base::Yuv420pToRgb), FUNC(SimdYuv420pToRgb));
+        {
+            MultithreadedScope scope;
+            result = result && YuvToAnyAutoTest(2, 2, View::Rgb24, FUNC(Simd::Base::Yuv420pToRgb), TEST_MT_FUNC(Func, SimdYuv420pToRgb));
+        }
 
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable)
@@ -369,6 +393,248 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncYuvV2
+        {
+            typedef void(*FuncPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+            SimdYuvType yuvType;
+
+            FuncYuvV2(const FuncPtr & f, const String & d, SimdYuvType t = SimdYuvBt601) : func(f), description(d), yuvType(t) {}
+
+            void Update(SimdYuvType t)
+            {
+                yuvType = t;
+                description = description + "[" + ToString(t) + "]";
+            }
+
+            void Call(const View & y, const View & u, const View & v, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, dst.data, dst.stride, yuvType);
+            }
+        };
+    }
+
+#define FUNC_YUV_V2(function) FuncYuvV2(function, #function)
+
+    bool YuvToAnyV2AutoTest(int width, int height, int dx, int dy, View::Format dstType, FuncYuvV2 f1, FuncYuvV2 f2, SimdYuvType yuvType)
+    {
+        bool result = true;
+
+        f1.Update(yuvType);
+        f2.Update(yuvType);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        const int uvWidth = width / dx;
+        const int uvHeight = height / dy;
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View u(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+        FillRandom(u);
+        View v(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+        FillRandom(v);
+
+        View dst1(width, height, dstType, NULL, TEST_ALIGN(width));
+        View dst2(width, height, dstType, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, u, v, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, u, v, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool YuvToAnyV2AutoTest(int dx, int dy, View::Format dstType, const FuncYuvV2 & f1, const FuncYuvV2 & f2)
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt709Full; ++type)
+        {
+            result = result && YuvToAnyV2AutoTest(W, H, dx, dy, dstType, f1, f2, (SimdYuvType)type);
+            result = result && YuvToAnyV2AutoTest(W + O*dx, H - O*dy, dx, dy, dstType, f1, f2, (SimdYuvType)type);
+            result = result && YuvToAnyV2AutoTest(W - O*dx, H + O*dy, dx, dy, dstType, f1, f2, (SimdYuvType)type);
+        }
+
+        return result;
+    }
+
+    bool Yuv444pToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(1, 1, View::Bgr24, FUNC_YUV_V2(Simd::Base::Yuv444pToBgrV2), FUNC_YUV_V2(SimdYuv444pToBgrV2));
+        {
+            MultithreadedScope scope;
+            result = result && YuvToAnyV2AutoTest(1, 1, View::Bgr24, FUNC_YUV_V2(Simd::Base::Yuv444pToBgrV2), TEST_MT_FUNC(FuncYuvV2, SimdYuv444pToBgrV2));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, View::Bgr24, FUNC_YUV_V2(Simd::Sse41::Yuv444pToBgrV2), FUNC_YUV_V2(SimdYuv444pToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, View::Bgr24, FUNC_YUV_V2(Simd::Avx2::Yuv444pToBgrV2), FUNC_YUV_V2(SimdYuv444pToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, View::Bgr24, FUNC_YUV_V2(Simd::Avx512bw::Yuv444pToBgrV2), FUNC_YUV_V2(SimdYuv444pToBgrV2));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv422pToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(2, 1, View::Bgr24, FUNC_YUV_V2(Simd::Base::Yuv422pToBgrV2), FUNC_YUV_V2(SimdYuv422pToBgrV2));
+        {
+            MultithreadedScope scope;
+            result = result && YuvToAnyV2AutoTest(2, 1, View::Bgr24, FUNC_YUV_V2(Simd::Base::Yuv422pToBgrV2), TEST_MT_FUNC(FuncYuvV2, SimdYuv422pToBgrV2));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, View::Bgr24, FUNC_YUV_V2(Simd::Sse41::Yuv422pToBgrV2), FUNC_YUV_V2(SimdYuv422pToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, View::Bgr24, FUNC_YUV_V2(Simd::Avx2::Yuv422pToBgrV2), FUNC_YUV_V2(SimdYuv422pToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, View::Bgr24, FUNC_YUV_V2(Simd::Avx512bw::Yuv422pToBgrV2), FUNC_YUV_V2(SimdYuv422pToBgrV2));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv420pToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(2, 2, View::Bgr24, FUNC_YUV_V2(Simd::Base::Yuv420pToBgrV2), FUNC_YUV_V2(SimdYuv420pToBgrV2));
+        {
+            MultithreadedScope scope;
+            result = result && YuvToAnyV2AutoTest(2, 2, View::Bgr24, FUNC_YUV_V2(Simd::Base::Yuv420pToBgrV2), TEST_MT_FUNC(FuncYuvV2, SimdYuv420pToBgrV2));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, View::Bgr24, FUNC_YUV_V2(Simd::Sse41::Yuv420pToBgrV2), FUNC_YUV_V2(SimdYuv420pToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, View::Bgr24, FUNC_YUV_V2(Simd::Avx2::Yuv420pToBgrV2), FUNC_YUV_V2(SimdYuv420pToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, View::Bgr24, FUNC_YUV_V2(Simd::Avx512bw::Yuv420pToBgrV2), FUNC_YUV_V2(SimdYuv420pToBgrV2));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv444pToRgbV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(1, 1, View::Rgb24, FUNC_YUV_V2(Simd::Base::Yuv444pToRgbV2), FUNC_YUV_V2(SimdYuv444pToRgbV2));
+        {
+            MultithreadedScope scope;
+            result = result && YuvToAnyV2AutoTest(1, 1, View::Rgb24, FUNC_YUV_V2(Simd::Base::Yuv444pToRgbV2), TEST_MT_FUNC(FuncYuvV2, SimdYuv444pToRgbV2));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, View::Rgb24, FUNC_YUV_V2(Simd::Sse41::Yuv444pToRgbV2), FUNC_YUV_V2(SimdYuv444pToRgbV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, View::Rgb24, FUNC_YUV_V2(Simd::Avx2::Yuv444pToRgbV2), FUNC_YUV_V2(SimdYuv444pToRgbV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, View::Rgb24, FUNC_YUV_V2(Simd::Avx512bw::Yuv444pToRgbV2), FUNC_YUV_V2(SimdYuv444pToRgbV2));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv422pToRgbV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(2, 1, View::Rgb24, FUNC_YUV_V2(Simd::Base::Yuv422pToRgbV2), FUNC_YUV_V2(SimdYuv422pToRgbV2));
+        {
+            MultithreadedScope scope;
+            result = result && YuvToAnyV2AutoTest(2, 1, View::Rgb24, FUNC_YUV_V2(Simd::Base::Yuv422pToRgbV2), TEST_MT_FUNC(FuncYuvV2, SimdYuv422pToRgbV2));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, View::Rgb24, FUNC_YUV_V2(Simd::Sse41::Yuv422pToRgbV2), FUNC_YUV_V2(SimdYuv422pToRgbV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, View::Rgb24, FUNC_YUV_V2(Simd::Avx2::Yuv422pToRgbV2), FUNC_YUV_V2(SimdYuv422pToRgbV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, View::Rgb24, FUNC_YUV_V2(Simd::Avx512bw::Yuv422pToRgbV2), FUNC_YUV_V2(SimdYuv422pToRgbV2));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv420pToRgbV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(2, 2, View::Rgb24, FUNC_YUV_V2(Simd::Base::Yuv420pToRgbV2), FUNC_YUV_V2(SimdYuv420pToRgbV2));
+        {
+            MultithreadedScope scope;
+            result = result && YuvToAnyV2AutoTest(2, 2, View::Rgb24, FUNC_YUV_V2(Simd::Base::Yuv420pToRgbV2), TEST_MT_FUNC(FuncYuvV2, SimdYuv420pToRgbV2));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, View::Rgb24, FUNC_YUV_V2(Simd::Sse41::Yuv420pToRgbV2), FUNC_YUV_V2(SimdYuv420pToRgbV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, View::Rgb24, FUNC_YUV_V2(Simd::Avx2::Yuv420pToRgbV2), FUNC_YUV_V2(SimdYuv420pToRgbV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, View::Rgb24, FUNC_YUV_V2(Simd::Avx512bw::Yuv420pToRgbV2), FUNC_YUV_V2(SimdYuv420pToRgbV2));
+#endif 
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool YuvToAnyDataTest(bool create, int width, int height, int dx, int dy, View::Format dstType, const Func & f, int maxDifference = 0)
@@ -94,6 +94,10 @@ namespace Test
         bool result = true;
 
         result = result && YuvaToBgraAutoTest(FUNC_YUVA(Simd::Base::Yuva420pToBgra), FUNC_YUVA(SimdYuva420pToBgra), 2, 2);
+        {
+            MultithreadedScope scope;
+            result = result && YuvaToBgraAutoTest(FUNC_YUVA(Simd::Base::Yuva420pToBgra), TEST_MT_FUNC(FuncYuva, SimdYuva420pToBgra), 2, 2);
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable)
@@ -184,6 +188,10 @@ namespace Test
         bool result = true;
 
         result = result && YuvToBgraAutoTest(FUNC_YUV(Simd::Base::Yuv444pToBgra), FUNC_YUV(SimdYuv444pToBgra), 1, 1);
+        {
+            MultithreadedScope scope;
+            result = result && YuvToBgraAutoTest(FUNC_YUV(Simd::Base::Yuv444pToBgra), TEST_MT_FUNC(FuncYuv, SimdYuv444pToBgra), 1, 1);
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable)
@@ -218,6 +226,10 @@ namespace Test
         bool result = true;
 
         result = result && YuvToBgraAutoTest(FUNC_YUV(Simd::Base::Yuv422pToBgra), FUNC_YUV(SimdYuv422pToBgra), 2, 1);
+        {
+            MultithreadedScope scope;
+            result = result && YuvToBgraAutoTest(FUNC_YUV(Simd::Base::Yuv422pToBgra), TEST_MT_FUNC(FuncYuv, SimdYuv422pToBgra), 2, 1);
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable)
@@ -252,6 +264,10 @@ namespace Test
         bool result = true;
 
         result = result && YuvToBgraAutoTest(FUNC_YUV(Simd::Base::Yuv420pToBgra), FUNC_YUV(SimdYuv420pToBgra), 2, 2);
+        {
+            MultithreadedScope scope;
+            result = result && YuvToBgraAutoTest(FUNC_YUV(Simd::Base::Yuv420pToBgra), TEST_MT_FUNC(FuncYuv, SimdYuv420pToBgra), 2, 2);
+        }
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable)
@@ -281,6 +297,164 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncYuvV2
+        {
+            typedef void(*FuncPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+            SimdYuvType yuvType;
+
+            FuncYuvV2(const FuncPtr & f, const String & d, SimdYuvType t = SimdYuvBt601) : func(f), description(d), yuvType(t) {}
+
+            void Update(SimdYuvType t)
+            {
+                yuvType = t;
+                description = description + "[" + ToString(t) + "]";
+            }
+
+            void Call(const View & y, const View & u, const View & v, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, dst.data, dst.stride, 0xFF, yuvType);
+            }
+        };
+    }
+
+#define FUNC_YUV_V2(function) FuncYuvV2(function, #function)
+
+    bool YuvToAnyV2AutoTest(int width, int height, int dx, int dy, View::Format dstType, FuncYuvV2 f1, FuncYuvV2 f2, SimdYuvType yuvType)
+    {
+        bool result = true;
+
+        f1.Update(yuvType);
+        f2.Update(yuvType);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        const int uvWidth = width / dx;
+        const int uvHeight = height / dy;
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View u(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+        FillRandom(u);
+        View v(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+        FillRandom(v);
+
+        View dst1(width, height, dstType, NULL, TEST_ALIGN(width));
+        View dst2(width, height, dstType, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, u, v, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, u, v, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool YuvToAnyV2AutoTest(int dx, int dy, View::Format dstType, const FuncYuvV2 & f1, const FuncYuvV2 & f2)
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt709Full; ++type)
+        {
+            result = result && YuvToAnyV2AutoTest(W, H, dx, dy, dstType, f1, f2, (SimdYuvType)type);
+            result = result && YuvToAnyV2AutoTest(W + O*dx, H - O*dy, dx, dy, dstType, f1, f2, (SimdYuvType)type);
+            result = result && YuvToAnyV2AutoTest(W - O*dx, H + O*dy, dx, dy, dstType, f1, f2, (SimdYuvType)type);
+        }
+
+        return result;
+    }
+
+    bool Yuv444pToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(1, 1, View::Bgra32, FUNC_YUV_V2(Simd::Base::Yuv444pToBgraV2), FUNC_YUV_V2(SimdYuv444pToBgraV2));
+        {
+            MultithreadedScope scope;
+            result = result && YuvToAnyV2AutoTest(1, 1, View::Bgra32, FUNC_YUV_V2(Simd::Base::Yuv444pToBgraV2), TEST_MT_FUNC(FuncYuvV2, SimdYuv444pToBgraV2));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, View::Bgra32, FUNC_YUV_V2(Simd::Sse41::Yuv444pToBgraV2), FUNC_YUV_V2(SimdYuv444pToBgraV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, View::Bgra32, FUNC_YUV_V2(Simd::Avx2::Yuv444pToBgraV2), FUNC_YUV_V2(SimdYuv444pToBgraV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, View::Bgra32, FUNC_YUV_V2(Simd::Avx512bw::Yuv444pToBgraV2), FUNC_YUV_V2(SimdYuv444pToBgraV2));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv422pToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(2, 1, View::Bgra32, FUNC_YUV_V2(Simd::Base::Yuv422pToBgraV2), FUNC_YUV_V2(SimdYuv422pToBgraV2));
+        {
+            MultithreadedScope scope;
+            result = result && YuvToAnyV2AutoTest(2, 1, View::Bgra32, FUNC_YUV_V2(Simd::Base::Yuv422pToBgraV2), TEST_MT_FUNC(FuncYuvV2, SimdYuv422pToBgraV2));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, View::Bgra32, FUNC_YUV_V2(Simd::Sse41::Yuv422pToBgraV2), FUNC_YUV_V2(SimdYuv422pToBgraV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, View::Bgra32, FUNC_YUV_V2(Simd::Avx2::Yuv422pToBgraV2), FUNC_YUV_V2(SimdYuv422pToBgraV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, View::Bgra32, FUNC_YUV_V2(Simd::Avx512bw::Yuv422pToBgraV2), FUNC_YUV_V2(SimdYuv422pToBgraV2));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv420pToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(2, 2, View::Bgra32, FUNC_YUV_V2(Simd::Base::Yuv420pToBgraV2), FUNC_YUV_V2(SimdYuv420pToBgraV2));
+        {
+            MultithreadedScope scope;
+            result = result && YuvToAnyV2AutoTest(2, 2, View::Bgra32, FUNC_YUV_V2(Simd::Base::Yuv420pToBgraV2), TEST_MT_FUNC(FuncYuvV2, SimdYuv420pToBgraV2));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, View::Bgra32, FUNC_YUV_V2(Simd::Sse41::Yuv420pToBgraV2), FUNC_YUV_V2(SimdYuv420pToBgraV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, View::Bgra32, FUNC_YUV_V2(Simd::Avx2::Yuv420pToBgraV2), FUNC_YUV_V2(SimdYuv420pToBgraV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, View::Bgra32, FUNC_YUV_V2(Simd::Avx512bw::Yuv420pToBgraV2), FUNC_YUV_V2(SimdYuv420pToBgraV2));
+#endif 
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool YuvToBgraDataTest(bool create, int width, int height, const FuncYuv & f, int dx, int dy)
@@ -0,0 +1,588 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncPy
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                uint8_t * dst, size_t dstStride, SimdYuvType yuvType);
+            typedef void(*FuncAlphaPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                uint8_t * dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType);
+
+            FuncPtr func;
+            FuncAlphaPtr funcAlpha;
+            String description;
+            SimdYuvType yuvType;
+
+            FuncPy(const FuncPtr & f, const String & d) : func(f), funcAlpha(NULL), description(d), yuvType(SimdYuvBt601) {}
+            FuncPy(const FuncAlphaPtr & f, const String & d) : func(NULL), funcAlpha(f), description(d), yuvType(SimdYuvBt601) {}
+
+            void Update(SimdYuvType t)
+            {
+                yuvType = t;
+                description = description + "[" + ToString(t) + "]";
+            }
+
+            void Call(const View & src, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                if (funcAlpha)
+                    funcAlpha(src.data, src.stride, src.width, src.height, dst.data, dst.stride, 0xFF, yuvType);
+                else
+                    func(src.data, src.stride, src.width, src.height, dst.data, dst.stride, yuvType);
+            }
+        };
+    }
+
+#define FUNC_PY(function) FuncPy(function, #function)
+
+    /*
+    * Reference: unpacking of YUYV image into YUV422P planes and conversion of YUV422P image.
+    */
+    static void YuyvToBgraTwoPass(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+        uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+    {
+        View y(width, height, View::Gray8), u(width / 2, height, View::Gray8), v(width / 2, height, View::Gray8);
+        for (size_t row = 0; row < height; ++row)
+        {
+            const uint8_t * src = yuyv + row * yuyvStride;
+            for (size_t col = 0; col < width; col += 2, src += 4)
+            {
+                y.At<uint8_t>(col + 0, row) = src[0];
+                u.At<uint8_t>(col / 2, row) = src[1];
+                y.At<uint8_t>(col + 1, row) = src[2];
+                v.At<uint8_t>(col / 2, row) = src[3];
+            }
+        }
+        SimdYuv422pToBgraV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, width, height, bgra, bgraStride, alpha, yuvType);
+    }
+
+    bool PackedYuvToAnyAutoTest(int width, int height, View::Format srcType, View::Format dstType, FuncPy f1, FuncPy f2, SimdYuvType yuvType)
+    {
+        bool result = true;
+
+        f1.Update(yuvType);
+        f2.Update(yuvType);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width, height, srcType, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View dst1(width, height, dstType, NULL, TEST_ALIGN(width));
+        View dst2(width, height, dstType, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool PackedYuvToAnyAutoTest(View::Format srcType, View::Format dstType, const FuncPy & f1, const FuncPy & f2)
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt709Full; ++type)
+        {
+            result = result && PackedYuvToAnyAutoTest(W, H, srcType, dstType, f1, f2, (SimdYuvType)type);
+            result = result && PackedYuvToAnyAutoTest(W + O * 2, H - O * 2, srcType, dstType, f1, f2, (SimdYuvType)type);
+        }
+
+        return result;
+    }
+
+    bool YuyvToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && PackedYuvToAnyAutoTest(View::Yuyv16, View::Bgra32, FUNC_PY(Simd::Base::YuyvToBgra), FUNC_PY(SimdYuyvToBgra));
+        {
+            MultithreadedScope scope;
+            result = result && PackedYuvToAnyAutoTest(View::Yuyv16, View::Bgra32, FUNC_PY(Simd::Base::YuyvToBgra), TEST_MT_FUNC(FuncPy, SimdYuyvToBgra));
+        }
+        result = result && PackedYuvToAnyAutoTest(View::Yuyv16, View::Bgra32, FUNC_PY(YuyvToBgraTwoPass), FUNC_PY(SimdYuyvToBgra));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && PackedYuvToAnyAutoTest(View::Yuyv16, View::Bgra32, FUNC_PY(Simd::Sse41::YuyvToBgra), FUNC_PY(SimdYuyvToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && PackedYuvToAnyAutoTest(View::Yuyv16, View::Bgra32, FUNC_PY(Simd::Avx2::YuyvToBgra), FUNC_PY(SimdYuyvToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && PackedYuvToAnyAutoTest(View::Yuyv16, View::Bgra32, FUNC_PY(Simd::Avx512bw::YuyvToBgra), FUNC_PY(SimdYuyvToBgra));
+#endif 
+
+        return result;
+    }
+
+    bool YuyvToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && PackedYuvToAnyAutoTest(View::Yuyv16, View::Bgr24, FUNC_PY(Simd::Base::YuyvToBgr), FUNC_PY(SimdYuyvToBgr));
+        {
+            MultithreadedScope scope;
+            result = result && PackedYuvToAnyAutoTest(View::Yuyv16, View::Bgr24, FUNC_PY(Simd::Base::YuyvToBgr), TEST_MT_FUNC(FuncPy, SimdYuyvToBgr));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && PackedYuvToAnyAutoTest(View::Yuyv16, View::Bgr24, FUNC_PY(Simd::Sse41::YuyvToBgr), FUNC_PY(SimdYuyvToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && PackedYuvToAnyAutoTest(View::Yuyv16, View::Bgr24, FUNC_PY(Simd::Avx2::YuyvToBgr), FUNC_PY(SimdYuyvToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && PackedYuvToAnyAutoTest(View::Yuyv16, View::Bgr24, FUNC_PY(Simd::Avx512bw::YuyvToBgr), FUNC_PY(SimdYuyvToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool YuyvToRgbAutoTest()
+    {
+        bool result = true;
+
+        result = result && PackedYuvToAnyAutoTest(View::Yuyv16, View::Rgb24, FUNC_PY(Simd::Base::YuyvToRgb), FUNC_PY(SimdYuyvToRgb));
+        {
+            MultithreadedScope scope;
+            result = result && PackedYuvToAnyAutoTest(View::Yuyv16, View::Rgb24, FUNC_PY(Simd::Base::YuyvToRgb), TEST_MT_FUNC(FuncPy, SimdYuyvToRgb));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && PackedYuvToAnyAutoTest(View::Yuyv16, View::Rgb24, FUNC_PY(Simd::Sse41::YuyvToRgb), FUNC_PY(SimdYuyvToRgb));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && PackedYuvToAnyAutoTest(View::Yuyv16, View::Rgb24, FUNC_PY(Simd::Avx2::YuyvToRgb), FUNC_PY(SimdYuyvToRgb));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && PackedYuvToAnyAutoTest(View::Yuyv16, View::Rgb24, FUNC_PY(Simd::Avx512bw::YuyvToRgb), FUNC_PY(SimdYuyvToRgb));
+#endif 
+
+        return result;
+    }
+
+    bool UyvyToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && PackedYuvToAnyAutoTest(View::Uyvy16, View::Bgra32, FUNC_PY(Simd::Base::UyvyToBgra), FUNC_PY(SimdUyvyToBgra));
+        {
+            MultithreadedScope scope;
+            result = result && PackedYuvToAnyAutoTest(View::Uyvy16, View::Bgra32, FUNC_PY(Simd::Base::UyvyToBgra), TEST_MT_FUNC(FuncPy, SimdUyvyToBgra));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && PackedYuvToAnyAutoTest(View::Uyvy16, View::Bgra32, FUNC_PY(Simd::Sse41::UyvyToBgra), FUNC_PY(SimdUyvyToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && PackedYuvToAnyAutoTest(View::Uyvy16, View::Bgra32, FUNC_PY(Simd::Avx2::UyvyToBgra), FUNC_PY(SimdUyvyToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && PackedYuvToAnyAutoTest(View::Uyvy16, View::Bgra32, FUNC_PY(Simd::Avx512bw::UyvyToBgra), FUNC_PY(SimdUyvyToBgra));
+#endif 
+
+        return result;
+    }
+
+    bool UyvyToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && PackedYuvToAnyAutoTest(View::Uyvy16, View::Bgr24, FUNC_PY(Simd::Base::UyvyToBgr), FUNC_PY(SimdUyvyToBgr));
+        {
+            MultithreadedScope scope;
+            result = result && PackedYuvToAnyAutoTest(View::Uyvy16, View::Bgr24, FUNC_PY(Simd::Base::UyvyToBgr), TEST_MT_FUNC(FuncPy, SimdUyvyToBgr));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && PackedYuvToAnyAutoTest(View::Uyvy16, View::Bgr24, FUNC_PY(Simd::Sse41::UyvyToBgr), FUNC_PY(SimdUyvyToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && PackedYuvToAnyAutoTest(View::Uyvy16, View::Bgr24, FUNC_PY(Simd::Avx2::UyvyToBgr), FUNC_PY(SimdUyvyToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && PackedYuvToAnyAutoTest(View::Uyvy16, View::Bgr24, FUNC_PY(Simd::Avx512bw::UyvyToBgr), FUNC_PY(SimdUyvyToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool UyvyToRgbAutoTest()
+    {
+        bool result = true;
+
+        result = result && PackedYuvToAnyAutoTest(View::Uyvy16, View::Rgb24, FUNC_PY(Simd::Base::UyvyToRgb), FUNC_PY(SimdUyvyToRgb));
+        {
+            MultithreadedScope scope;
+            result = result && PackedYuvToAnyAutoTest(View::Uyvy16, View::Rgb24, FUNC_PY(Simd::Base::UyvyToRgb), TEST_MT_FUNC(FuncPy, SimdUyvyToRgb));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && PackedYuvToAnyAutoTest(View::Uyvy16, View::Rgb24, FUNC_PY(Simd::Sse41::UyvyToRgb), FUNC_PY(SimdUyvyToRgb));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && PackedYuvToAnyAutoTest(View::Uyvy16, View::Rgb24, FUNC_PY(Simd::Avx2::UyvyToRgb), FUNC_PY(SimdUyvyToRgb));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && PackedYuvToAnyAutoTest(View::Uyvy16, View::Rgb24, FUNC_PY(Simd::Avx512bw::UyvyToRgb), FUNC_PY(SimdUyvyToRgb));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncPg
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * gray, size_t grayStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncPg(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, View & gray) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, gray.data, gray.stride);
+            }
+        };
+    }
+
+#define FUNC_PG(function) FuncPg(function, #function)
+
+    bool PackedYuvToGrayAutoTest(int width, int height, View::Format srcType, const FuncPg & f1, const FuncPg & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width, height, srcType, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View gray1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View gray2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, gray1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, gray2));
+
+        result = result && Compare(gray1, gray2, 0, true, 64);
+
+        return result;
+    }
+
+    bool PackedYuvToGrayAutoTest(View::Format srcType, const FuncPg & f1, const FuncPg & f2)
+    {
+        bool result = true;
+
+        result = result && PackedYuvToGrayAutoTest(W, H, srcType, f1, f2);
+        result = result && PackedYuvToGrayAutoTest(W + O * 2, H - O * 2, srcType, f1, f2);
+
+        return result;
+    }
+
+    bool YuyvToGrayAutoTest()
+    {
+        bool result = true;
+
+        result = result && PackedYuvToGrayAutoTest(View::Yuyv16, FUNC_PG(Simd::Base::YuyvToGray), FUNC_PG(SimdYuyvToGray));
+        {
+            MultithreadedScope scope;
+            result = result && PackedYuvToGrayAutoTest(View::Yuyv16, FUNC_PG(Simd::Base::YuyvToGray), TEST_MT_FUNC(FuncPg, SimdYuyvToGray));
+        }
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::A)
+            result = result && PackedYuvToGrayAutoTest(View::Yuyv16, FUNC_PG(Simd::Sse2::YuyvToGray), FUNC_PG(SimdYuyvToGray));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && PackedYuvToGrayAutoTest(View::Yuyv16, FUNC_PG(Simd::Avx2::YuyvToGray), FUNC_PG(SimdYuyvToGray));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && PackedYuvToGrayAutoTest(View::Yuyv16, FUNC_PG(Simd::Avx512bw::YuyvToGray), FUNC_PG(SimdYuyvToGray));
+#endif 
+
+        return result;
+    }
+
+    bool UyvyToGrayAutoTest()
+    {
+        bool result = true;
+
+        result = result && PackedYuvToGrayAutoTest(View::Uyvy16, FUNC_PG(Simd::Base::UyvyToGray), FUNC_PG(SimdUyvyToGray));
+        {
+            MultithreadedScope scope;
+            result = result && PackedYuvToGrayAutoTest(View::Uyvy16, FUNC_PG(Simd::Base::UyvyToGray), TEST_MT_FUNC(FuncPg, SimdUyvyToGray));
+        }
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::A)
+            result = result && PackedYuvToGrayAutoTest(View::Uyvy16, FUNC_PG(Simd::Sse2::UyvyToGray), FUNC_PG(SimdUyvyToGray));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && PackedYuvToGrayAutoTest(View::Uyvy16, FUNC_PG(Simd::Avx2::UyvyToGray), FUNC_PG(SimdUyvyToGray));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && PackedYuvToGrayAutoTest(View::Uyvy16, FUNC_PG(Simd::Avx512bw::UyvyToGray), FUNC_PG(SimdUyvyToGray));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncP420
+        {
+            typedef void(*FuncNv12Ptr)(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride);
+            typedef void(*FuncYuv420pPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+            FuncNv12Ptr funcNv12;
+            FuncYuv420pPtr funcYuv420p;
+            String description;
+
+            FuncP420(const FuncNv12Ptr & f, const String & d) : funcNv12(f), funcYuv420p(NULL), description(d) {}
+            FuncP420(const FuncYuv420pPtr & f, const String & d) : funcNv12(NULL), funcYuv420p(f), description(d) {}
+
+            void Call(const View & src, View & y, View & u, View & v) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                if (funcNv12)
+                    funcNv12(src.data, src.stride, src.width, src.height, y.data, y.stride, u.data, u.stride);
+                else
+                    funcYuv420p(src.data, src.stride, src.width, src.height, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+            }
+        };
+    }
+
+#define FUNC_P420(function) FuncP420(function, #function)
+
+    bool PackedYuvTo420AutoTest(int width, int height, View::Format srcType, const FuncP420 & f1, const FuncP420 & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width, height, srcType, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View::Format uFormat = f1.funcNv12 ? View::Uv16 : View::Gray8;
+        View y1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View u1(width / 2, height / 2, uFormat, NULL, TEST_ALIGN(width));
+        View v1(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        View y2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View u2(width / 2, height / 2, uFormat, NULL, TEST_ALIGN(width));
+        View v2(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        if (f1.funcNv12)
+        {
+            Simd::Fill(v1, 0);
+            Simd::Fill(v2, 0);
+        }
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, y1, u1, v1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, y2, u2, v2));
+
+        result = result && Compare(y1, y2, 0, true, 64, 0, "y");
+        result = result && Compare(u1, u2, 0, true, 64, 0, "u");
+        result = result && Compare(v1, v2, 0, true, 64, 0, "v");
+
+        return result;
+    }
+
+    bool PackedYuvTo420AutoTest(View::Format srcType, const FuncP420 & f1, const FuncP420 & f2)
+    {
+        bool result = true;
+
+        result = result && PackedYuvTo420AutoTest(W, H, srcType, f1, f2);
+        result = result && PackedYuvTo420AutoTest(W + O * 2, H - O * 2, srcType, f1, f2);
+
+        return result;
+    }
+
+    bool YuyvToNv12AutoTest()
+    {
+        bool result = true;
+
+        result = result && PackedYuvTo420AutoTest(View::Yuyv16, FUNC_P420(Simd::Base::YuyvToNv12), FUNC_P420(SimdYuyvToNv12));
+        {
+            MultithreadedScope scope;
+            result = result && PackedYuvTo420AutoTest(View::Yuyv16, FUNC_P420(Simd::Base::YuyvToNv12), TEST_MT_FUNC(FuncP420, SimdYuyvToNv12));
+        }
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::A)
+            result = result && PackedYuvTo420AutoTest(View::Yuyv16, FUNC_P420(Simd::Sse2::YuyvToNv12), FUNC_P420(SimdYuyvToNv12));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && PackedYuvTo420AutoTest(View::Yuyv16, FUNC_P420(Simd::Avx2::YuyvToNv12), FUNC_P420(SimdYuyvToNv12));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && PackedYuvTo420AutoTest(View::Yuyv16, FUNC_P420(Simd::Avx512bw::YuyvToNv12), FUNC_P420(SimdYuyvToNv12));
+#endif 
+
+        return result;
+    }
+
+    bool YuyvToYuv420pAutoTest()
+    {
+        bool result = true;
+
+        result = result && PackedYuvTo420AutoTest(View::Yuyv16, FUNC_P420(Simd::Base::YuyvToYuv420p), FUNC_P420(SimdYuyvToYuv420p));
+        {
+            MultithreadedScope scope;
+            result = result && PackedYuvTo420AutoTest(View::Yuyv16, FUNC_P420(Simd::Base::YuyvToYuv420p), TEST_MT_FUNC(FuncP420, SimdYuyvToYuv420p));
+        }
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
+            result = result && PackedYuvTo420AutoTest(View::Yuyv16, FUNC_P420(Simd::Sse2::YuyvToYuv420p), FUNC_P420(SimdYuyvToYuv420p));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && PackedYuvTo420AutoTest(View::Yuyv16, FUNC_P420(Simd::Avx2::YuyvToYuv420p), FUNC_P420(SimdYuyvToYuv420p));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::DA)
+            result = result && PackedYuvTo420AutoTest(View::Yuyv16, FUNC_P420(Simd::Avx512bw::YuyvToYuv420p), FUNC_P420(SimdYuyvToYuv420p));
+#endif 
+
+        return result;
+    }
+
+    bool UyvyToNv12AutoTest()
+    {
+        bool result = true;
+
+        result = result && PackedYuvTo420AutoTest(View::Uyvy16, FUNC_P420(Simd::Base::UyvyToNv12), FUNC_P420(SimdUyvyToNv12));
+        {
+            MultithreadedScope scope;
+            result = result && PackedYuvTo420AutoTest(View::Uyvy16, FUNC_P420(Simd::Base::UyvyToNv12), TEST_MT_FUNC(FuncP420, SimdUyvyToNv12));
+        }
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::A)
+            result = result && PackedYuvTo420AutoTest(View::Uyvy16, FUNC_P420(Simd::Sse2::UyvyToNv12), FUNC_P420(SimdUyvyToNv12));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && PackedYuvTo420AutoTest(View::Uyvy16, FUNC_P420(Simd::Avx2::UyvyToNv12), FUNC_P420(SimdUyvyToNv12));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && PackedYuvTo420AutoTest(View::Uyvy16, FUNC_P420(Simd::Avx512bw::UyvyToNv12), FUNC_P420(SimdUyvyToNv12));
+#endif 
+
+        return result;
+    }
+
+    bool UyvyToYuv420pAutoTest()
+    {
+        bool result = true;
+
+        result = result && PackedYuvTo420AutoTest(View::Uyvy16, FUNC_P420(Simd::Base::UyvyToYuv420p), FUNC_P420(SimdUyvyToYuv420p));
+        {
+            MultithreadedScope scope;
+            result = result && PackedYuvTo420AutoTest(View::Uyvy16, FUNC_P420(Simd::Base::UyvyToYuv420p), TEST_MT_FUNC(FuncP420, SimdUyvyToYuv420p));
+        }
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
+            result = result && PackedYuvTo420AutoTest(View::Uyvy16, FUNC_P420(Simd::Sse2::UyvyToYuv420p), FUNC_P420(SimdUyvyToYuv420p));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && PackedYuvTo420AutoTest(View::Uyvy16, FUNC_P420(Simd::Avx2::UyvyToYuv420p), FUNC_P420(SimdUyvyToYuv420p));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::DA)
+            result = result && PackedYuvTo420AutoTest(View::Uyvy16, FUNC_P420(Simd::Avx512bw::UyvyToYuv420p), FUNC_P420(SimdUyvyToYuv420p));
+#endif 
+
+        return result;
+    }
+}